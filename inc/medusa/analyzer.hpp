@@ -40,6 +40,11 @@ private:
     virtual void Run(void);
 
   protected:
+    enum
+    {
+      SweepInstructionNumber = 32 //! Number of instructions decoded at once while sweeping a basic block
+    };
+
     bool Disassemble(Address const& rAddr);
     bool DisassembleBasicBlock(Address const& rAddr, std::list<Instruction::SPtr>& rBasicBlock);
     bool CreateCrossReferences(Address const& rAddr);
@@ -145,6 +150,13 @@ public:
     std::string        & rStrCell,
     Cell::Mark::List   & rMarks) const;
 
+  bool FormatCell(
+    Document      const& rDoc,
+    BinaryStream  const& rBinStrm,
+    Address       const& rAddress,
+    Cell          const& rCell,
+    FormatBuffer       & rBuf) const;
+
   bool FormatMultiCell(
     Document      const& rDoc,
     BinaryStream  const& rBinStrm,
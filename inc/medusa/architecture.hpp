@@ -15,6 +15,8 @@
 #include "medusa/character.hpp"
 #include "medusa/value.hpp"
 #include "medusa/instruction.hpp"
+#include "medusa/decoded_instruction.hpp"
+#include "medusa/format_buffer.hpp"
 
 #include "medusa/function.hpp"
 #include "medusa/string.hpp"
@@ -42,6 +44,15 @@ public:
   typedef std::tuple<const char*, u8>     NamedMode;
   typedef std::vector<NamedMode>          NamedModeVector;
 
+  //! Flags used to select what Disassemble has to produce
+  enum DisassembleFlags
+  {
+    //! Only decode length, mnemonic and operands
+    DisasmDecodeOnly = 0,
+    //! Build the semantic of the instruction as well
+    DisasmSemantic   = 1 << 0
+  };
+
   Architecture(Tag ArchTag) : m_Tag(ArchTag) {}
 
   //! This method returns the name of the current architecture.
@@ -51,7 +62,22 @@ public:
   virtual bool        Translate(Address const& rVirtAddr, TOffset& rPhysOff) = 0;
 
   //! This method disassembles one instruction.
-  virtual bool        Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode) = 0;
+  //\param Flags must be DisasmSemantic if the semantic is needed, DisasmDecodeOnly otherwise.
+  virtual bool        Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode, u8 Flags) = 0;
+
+  //! This method builds the semantic of an instruction decoded with DisasmDecodeOnly.
+  virtual bool        BuildSemantic(Instruction& rInsn) { return false; }
+
+  //! This method disassembles contiguous instructions without building their semantic.
+  //\param Size is the maximum number of bytes to decode starting from Offset.
+  //\param pInsns is the buffer which receives the decoded instructions.
+  //\param InsnNo is the number of records pInsns can hold.
+  //\return the number of records stored in pInsns, decoding stops on the first invalid instruction.
+  virtual size_t      DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, DecodedInstruction* pInsns, size_t InsnNo);
+
+  //! This method returns the length of an instruction without decoding its operands.
+  //\note the default implementation disassembles the instruction with DisasmDecodeOnly.
+  virtual bool        GetInstructionLength(BinaryStream const& rBinStrm, TOffset Offset, u8 Mode, u16& rLength);
 
   //! This method returns all available mode
   virtual NamedModeVector GetModes(void) const = 0;
@@ -101,6 +127,15 @@ public:
     std::string        & rStrCell,
     Cell::Mark::List   & rMarks) const;
 
+  //! This method formats rCell into rBuf, it doesn't allocate if the architecture overrides
+  //! the FormatBuffer version of FormatInstruction.
+  bool FormatCell(
+    Document      const& rDoc,
+    BinaryStream  const& rBinStrm,
+    Address       const& rAddress,
+    Cell          const& rCell,
+    FormatBuffer       & rBuf) const;
+
   //! This method converts an Instruction object to a string and stores the result on it.
   //\param rDoc is needed if an operand contains a reference.
   //\param rAddr is the address of rInsn.
@@ -113,6 +148,15 @@ public:
     std::string        & rStrCell,
     Cell::Mark::List   & rMarks) const;
 
+  //! This method converts an Instruction object into rBuf.
+  //! The default implementation uses the string version and copies the result.
+  virtual bool FormatInstruction(
+    Document      const& rDoc,
+    BinaryStream  const& rBinStrm,
+    Address       const& rAddr,
+    Instruction   const& rInsn,
+    FormatBuffer       & rBuf) const;
+
   //! This method reads and convert a character.
   //\param rDoc is reserved for future use.
   //\param rBinStrm must be the binary stream of the memory area where rChar is located.
@@ -152,6 +152,15 @@ public:
   u32         GetSize(void)   const { return m_Size;    }
   void const* GetBuffer(void) const { return m_pBuffer; }
 
+  //! This method maps Size bytes of private memory, the first Length bytes are read at Position
+  //! and the remaining ones are zero. Pages are only allocated when they're touched and writing
+  //! the memory never modifies the stream.
+  //\return nullptr if the memory can't be mapped.
+  virtual void* MapPrivateMemory(TOffset Position, u32 Length, u32 Size) const;
+
+  //! This method releases memory returned by MapPrivateMemory.
+  static void UnmapPrivateMemory(void* pMemory, u32 Size);
+
 protected:
   template <typename DataType>
   bool ReadGeneric(TOffset Position, DataType& rData) const
@@ -204,6 +213,9 @@ public:
   void Open(std::wstring const& rFilePath);
   void Close(void);
 
+  //! This method maps the file itself as copy-on-write pages, so only written pages are copied.
+  virtual void* MapPrivateMemory(TOffset Position, u32 Length, u32 Size) const;
+
 protected:
   std::wstring  m_FileName;
   TFileHandle   m_FileHandle;
@@ -222,6 +234,21 @@ public:
   void Close(void);
 };
 
+//! MemoryBinaryStreamView reads memory it doesn't own without copying it, e.g. emulated memory.
+//! The memory must outlive the stream.
+class Medusa_EXPORT MemoryBinaryStreamView : public BinaryStream
+{
+public:
+  MemoryBinaryStreamView(void) {}
+  MemoryBinaryStreamView(void const* pMem, u32 MemSize) { Open(pMem, MemSize); }
+
+  void Open(void const* pMem, u32 MemSize)
+  {
+    m_pBuffer = const_cast<void*>(pMem);
+    m_Size    = MemSize;
+  }
+};
+
 MEDUSA_NAMESPACE_END
 
 #endif // _MEDUSA_BINARY_STREAM_
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <functional>
 
 MEDUSA_NAMESPACE_BEGIN
@@ -21,6 +23,7 @@ public:
   typedef std::list<u32> RegisterList;
 
   CpuContext(CpuInformation const& rCpuInfo) : m_rCpuInfo(rCpuInfo) {}
+  virtual ~CpuContext(void) {}
 
   virtual bool  ReadRegister (u32 Register, void*       pValue, u32 Size) const = 0;
   virtual bool  WriteRegister(u32 Register, void const* pValue, u32 Size, bool SignExtend = false) = 0;
@@ -28,8 +31,22 @@ public:
   virtual void* GetContextAddress(void) = 0;
   virtual u16   GetRegisterOffset(u32 Register) = 0;
 
+  //! This method describes how Register is stored in the buffer returned by GetContextAddress:
+  //! ReadRegister loads rReadSize bytes at rOffset, WriteRegister stores the value zero-extended
+  //! to rWriteSize bytes (e.g. 32-bit registers clear the upper half of 64-bit ones on x86).
+  //\return false if the register must be accessed with ReadRegister and WriteRegister.
+  virtual bool  GetRegisterStorage(u32 Register, u16& rOffset, u8& rReadSize, u8& rWriteSize);
+
   virtual void  GetRegisters(RegisterList& RegList) const = 0;
 
+  //! This method returns the size of the buffer returned by GetContextAddress.
+  //\return 0 if the context can't be copied as a whole.
+  virtual u32   GetContextSize(void) const { return 0; }
+
+  //! These methods save and restore the whole context, only one snapshot is kept.
+  virtual bool  TakeSnapshot(void);
+  virtual bool  RestoreSnapshot(void);
+
   virtual bool Translate(Address const& rLogicalAddress, u64& rLinearAddress) const;
   virtual bool AddMapping(Address const& rLogicalAddress, u64 LinearAddress);
   virtual bool RemoveMapping(Address const& rLogicalAddress);
@@ -42,6 +59,102 @@ protected:
   CpuInformation const& m_rCpuInfo;
   typedef std::unordered_map<Address, u64> AddressMap;
   AddressMap m_AddressMap;
+
+  std::vector<u8> m_Snapshot;
+  AddressMap      m_SnapshotAddressMap;
+};
+
+//! RegisterLayout maps register identifiers to their storage in the buffer returned by
+//! CpuContext::GetContextAddress. Each register is resolved once with CpuContext::GetRegisterStorage
+//! and CpuInformation, then the inline accessors read and write the buffer without going through
+//! the ReadRegister and WriteRegister switches. Registers without storage fall back to them.
+class Medusa_EXPORT RegisterLayout
+{
+public:
+  struct Entry
+  {
+    Entry(void) : m_Resolved(false), m_Offset(), m_ReadSize(), m_WriteSize(), m_Mask() {}
+
+    bool m_Resolved;
+    u16  m_Offset;
+    u8   m_ReadSize;  //! 0 if the register must be accessed with ReadRegister and WriteRegister
+    u8   m_WriteSize; //! The value is zero-extended to this size (@see CpuContext::GetRegisterStorage)
+    u64  m_Mask;      //! Bits of the register value
+  };
+
+  RegisterLayout(CpuContext* pCpuCtxt) : m_pCpuCtxt(pCpuCtxt), m_pCtxt(nullptr) {}
+
+  Entry const& GetEntry(u32 Register)
+  {
+    if (Register >= m_Entries.size() || !m_Entries[Register].m_Resolved)
+      Resolve(Register);
+    return m_Entries[Register];
+  }
+
+  //! This method is the cached version of CpuContext::GetRegisterStorage.
+  bool GetStorage(u32 Register, u16& rOffset, u8& rReadSize, u8& rWriteSize)
+  {
+    auto const& rEntry = GetEntry(Register);
+    if (rEntry.m_ReadSize == 0)
+      return false;
+    rOffset    = rEntry.m_Offset;
+    rReadSize  = rEntry.m_ReadSize;
+    rWriteSize = rEntry.m_WriteSize;
+    return true;
+  }
+
+  bool Read(u32 Register, u64& rValue)
+  {
+    auto const& rEntry = GetEntry(Register);
+    if (rEntry.m_ReadSize == 0)
+    {
+      rValue = 0;
+      return m_pCpuCtxt->ReadRegister(Register, &rValue, GetByteSize(rEntry.m_Mask));
+    }
+    rValue = Load(m_pCtxt + rEntry.m_Offset, rEntry.m_ReadSize) & rEntry.m_Mask;
+    return true;
+  }
+
+  bool Write(u32 Register, u64 Value)
+  {
+    auto const& rEntry = GetEntry(Register);
+    if (rEntry.m_ReadSize == 0)
+      return m_pCpuCtxt->WriteRegister(Register, &Value, GetByteSize(rEntry.m_Mask));
+    Store(m_pCtxt + rEntry.m_Offset, rEntry.m_WriteSize, Value & rEntry.m_Mask);
+    return true;
+  }
+
+  static u64 Load(u8 const* pReg, u8 Size)
+  {
+    switch (Size)
+    {
+    case 1:  return *pReg;
+    case 2:  { u16 Val; memcpy(&Val, pReg, sizeof(Val)); return Val; }
+    case 4:  { u32 Val; memcpy(&Val, pReg, sizeof(Val)); return Val; }
+    case 8:  { u64 Val; memcpy(&Val, pReg, sizeof(Val)); return Val; }
+    default: return 0;
+    }
+  }
+
+  static void Store(u8* pReg, u8 Size, u64 Value)
+  {
+    switch (Size)
+    {
+    case 1:  *pReg = static_cast<u8>(Value); break;
+    case 2:  { u16 Val = static_cast<u16>(Value); memcpy(pReg, &Val, sizeof(Val)); break; }
+    case 4:  { u32 Val = static_cast<u32>(Value); memcpy(pReg, &Val, sizeof(Val)); break; }
+    case 8:  memcpy(pReg, &Value, sizeof(Value)); break;
+    default: break;
+    }
+  }
+
+private:
+  void Resolve(u32 Register);
+  static u32 GetByteSize(u64 Mask) { u32 Size = 0; for (; Mask != 0; Mask >>= 8) ++Size; return Size; }
+
+  CpuContext*        m_pCpuCtxt;
+  u8*                m_pCtxt;
+  std::vector<Entry> m_Entries; //! Indexed by register identifier
 };
 
 class Medusa_EXPORT MemoryContext
@@ -52,35 +165,75 @@ public:
     u64   m_LinearAddress;
     u32   m_Size;
     void* m_Buffer;
+    bool  m_Mapped; //! m_Buffer was returned by BinaryStream::MapPrivateMemory
 
-    MemoryChunk(u64 Address = 0, u32 Size = 0x0, void* Buffer = nullptr)
-      : m_LinearAddress(Address), m_Size(Size), m_Buffer(Buffer) {}
+    MemoryChunk(u64 Address = 0, u32 Size = 0x0, void* Buffer = nullptr, bool Mapped = false)
+      : m_LinearAddress(Address), m_Size(Size), m_Buffer(Buffer), m_Mapped(Mapped) {}
 
     bool operator<(MemoryChunk const& rMemChunk) const
     { return m_LinearAddress < rMemChunk.m_LinearAddress; }
   };
 
   MemoryContext(CpuInformation const& rCpuInfo) : m_rCpuInfo(rCpuInfo) {}
+  virtual ~MemoryContext(void);
 
   virtual bool ReadMemory(u64 LinearAddress, void* pValue,       u32 ValueSize) const;
   virtual bool WriteMemory(u64 LinearAddress, void const* pValue, u32 ValueSize, bool SignExtend = false);
+
+  //! This method returns the host memory at LinearAddress, rSize is the number of contiguous bytes from it.
+  //! Writing through prAddress bypasses code pages, write callbacks and snapshots.
   virtual bool FindMemory(u64 LinearAddress, void*& prAddress, u32& rSize) const;
 
   virtual bool AllocateMemory(u64 LinearAddress, u32 Size, void** ppRawMemory);
   virtual bool FreeMemory    (u64 LinearAddress);
+
+  //! This method maps Size bytes at LinearAddress, the first Length bytes come from rBinStrm at
+  //! Position and the remaining ones are zero (@see BinaryStream::MapPrivateMemory).
+  //! Nothing is copied up front, pages are allocated when they're first touched.
+  virtual bool MapMemory     (u64 LinearAddress, u32 Size, BinaryStream const& rBinStrm, TOffset Position, u32 Length, void** ppRawMemory);
+
+  //! This method maps each memory area of rDoc, file-backed areas are copy-on-write.
   virtual bool MapDocument   (Document const& rDoc, CpuContext const* pCpuCtxt);
 
   virtual std::string ToString(void) const;
 
+  enum { CodePageSize = 0x1000 };
+
+  typedef std::function<void(u64 PageAddress)> CodeWriteCallback;
+
+  //! This method marks the pages containing [LinearAddress, LinearAddress + Size) as translated code,
+  //! the first write to a marked page unmarks it and calls the callback set with SetCodeWriteCallback.
+  void MarkCodePages(u64 LinearAddress, u32 Size);
+  void SetCodeWriteCallback(CodeWriteCallback Callback) { m_CodeWriteCallback = Callback; }
+
+  typedef std::function<void(u64 LinearAddress, void const* pValue, u32 Size)> WriteCallback;
+
+  //! The write callback is called after each successful WriteMemory, e.g. to record a trace.
+  void SetWriteCallback(WriteCallback Callback) { m_WriteCallback = Callback; }
+
+  //! TakeSnapshot saves the content of the memory, RestoreSnapshot sets it back.
+  //! Only one snapshot is kept, allocations done after it are not undone.
+  //\return false if the memory context doesn't support snapshot.
+  virtual bool TakeSnapshot(void)    { return false; }
+  virtual bool RestoreSnapshot(void) { return false; }
+
 protected:
   virtual bool FindMemoryChunk(u64 LinearAddress, MemoryChunk& rMemChnk) const;
+  void NotifyCodeWrite(u64 LinearAddress, u32 Size);
 
   CpuInformation const& m_rCpuInfo;
 
   typedef std::set<MemoryChunk> MemoryChunkSet;
   MemoryChunkSet m_Memories;
+
+  std::unordered_set<u64> m_CodePages;
+  CodeWriteCallback       m_CodeWriteCallback;
+  WriteCallback           m_WriteCallback;
 };
 
+//! VariableContext stores the temporary variables of semantic (@see VariableExpression).
+//! Each name is resolved to a slot once, slots index a flat array so translated code
+//! accesses variables without hashing their name. Names are kept for debugging.
 class Medusa_EXPORT VariableContext
 {
 public:
@@ -94,6 +247,8 @@ public:
     Var64Bit   = 64,
   };
 
+  enum { InvalidSlot = 0xffffffff };
+
   virtual bool ReadVariable(std::string const& rVariableName, u64& rValue) const;
   virtual bool WriteVariable(std::string const& rVariableName, u64 Value, bool SignExtend = false);
   virtual void* GetVariable(std::string const& rVariableName);
@@ -101,6 +256,43 @@ public:
   virtual bool AllocateVariable(u32 Type, std::string const& rVariableName);
   virtual bool FreeVariable(std::string const& rVariableName);
 
+  //! This method returns the slot of rVariableName, it's created if needed but the
+  //! variable must still be allocated before it's used.
+  u32 GetSlot(std::string const& rVariableName);
+
+  //! This method returns the slot of rVariableName without creating it.
+  //\return InvalidSlot if the name has no slot.
+  u32 FindSlot(std::string const& rVariableName) const;
+
+  std::string const& GetSlotName(u32 Slot) const { return m_Names[Slot]; }
+
+  bool AllocateVariable(u32 Type, u32 Slot)
+  {
+    if (Slot >= m_Variables.size())
+      return false;
+    m_Variables[Slot] = VariableInformation(Type, 0x0);
+    return true;
+  }
+
+  bool ReadVariable(u32 Slot, u64& rValue) const
+  {
+    if (Slot >= m_Variables.size() || m_Variables[Slot].m_Type == VarUnknown)
+      return false;
+    rValue = m_Variables[Slot].u.m_Value;
+    return true;
+  }
+
+  bool WriteVariable(u32 Slot, u64 Value)
+  {
+    if (Slot >= m_Variables.size())
+      return false;
+    auto& rVar = m_Variables[Slot];
+    if (rVar.m_Type == VarUnknown)
+      return false;
+    rVar.u.m_Value = Value & GetValueMask(rVar.m_Type);
+    return true;
+  }
+
   virtual std::string ToString(void) const;
 
 protected:
@@ -128,8 +320,13 @@ protected:
 
     u32 GetSizeInBit(void) const { return m_Type; }
   };
-  typedef std::unordered_map<std::string, VariableInformation> VariableMap;
-  VariableMap m_Variables;
+
+  static u64 GetValueMask(u32 Type) { return Type >= 64 ? ~0ULL : ((1ULL << Type) - 1); }
+
+  typedef std::unordered_map<std::string, u32> SlotMap;
+  SlotMap                          m_Slots;
+  std::vector<std::string>         m_Names;     //! Name of each slot
+  std::vector<VariableInformation> m_Variables; //! Indexed by slot, free variables are VarUnknown
 };
 
 MEDUSA_NAMESPACE_END
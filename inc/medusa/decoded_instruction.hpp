@@ -0,0 +1,60 @@
+#ifndef _MEDUSA_DECODED_INSTRUCTION_
+#define _MEDUSA_DECODED_INSTRUCTION_
+
+#include "medusa/namespace.hpp"
+#include "medusa/types.hpp"
+#include "medusa/export.hpp"
+#include "medusa/instruction.hpp"
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! DecodedOperand is the compact form of Operand, the name is not kept.
+struct Medusa_EXPORT DecodedOperand
+{
+  u64 m_Value;    //! This field holds the raw value (immediate, displacement, ...)
+  u32 m_Type;     //! This field holds the operand type (O_REG, O_MEM, ...)
+  u16 m_Reg;      //! This field holds the register
+  u16 m_SecReg;   //! This field holds the second register
+  u16 m_Seg;      //! This field holds the segment register
+  u16 m_SegValue; //! This field holds the segment value
+  u8  m_Offset;   //! This field holds the offset of the operand in the instruction
+};
+
+//! DecodedInstruction is a fixed-size record which holds a decoded instruction without its semantic.
+//! It doesn't allocate and can be copied freely, so it is used to store instructions in
+//! caches and buffers (e.g. Architecture::DisassembleRange), Instruction is only built on demand.
+struct Medusa_EXPORT DecodedInstruction
+{
+  enum
+  {
+    OperandNo = OPERAND_NO
+  };
+
+  TOffset         m_Offset;             //! This field holds the offset of the instruction in the binary stream
+  char const*     m_pName;              //! This field holds the instruction name, it's never owned
+  u32             m_Opcode;             //! This field holds the architecture dependant opcode
+  u32             m_Prefix;             //! This field holds the architecture dependant prefix
+  u32             m_SemId;              //! This field holds the architecture dependant semantic id
+  u32             m_TestedFlags;        //! This field holds flags that are tested by the instruction
+  u32             m_UpdatedFlags;       //! This field holds flags that could be modified by the instruction
+  u32             m_ClearedFlags;       //! This field holds flags that are unset by the instruction
+  u32             m_FixedFlags;         //! This field holds flags that are set by the instruction
+  u16             m_Length;             //! This field holds the length of the instruction
+  u8              m_SubType;            //! This field holds the instruction type (Instruction::JumpType, ...)
+  u8              m_Mode;               //! This field holds the mode used to decode the instruction
+  DecodedOperand  m_Oprd[OperandNo];    //! This array holds all operands
+
+  DecodedInstruction(void);
+  DecodedInstruction(TOffset Offset, Instruction const& rInsn, u8 Mode);
+
+  //! This method fills the record from rInsn, the semantic is not copied.
+  void Load(TOffset Offset, Instruction const& rInsn, u8 Mode);
+
+  //! This method resets rInsn and fills it from the record.
+  //! Operand names and semantic are not restored, use Architecture::BuildSemantic to get the latter.
+  void ToInstruction(Instruction& rInsn) const;
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !_MEDUSA_DECODED_INSTRUCTION_
@@ -22,6 +22,8 @@
 
 MEDUSA_NAMESPACE_BEGIN
 
+class Instruction;
+
 //! Document handles cell, multicell, xref, label and memory area.
 class Medusa_EXPORT Document
 {
@@ -154,14 +156,31 @@ public:
 
   // Cell
                                 /*! This method returns a cell by its address.
+                                 * Instructions are only decoded, their semantic is not built.
                                  * \return A pointer to a cell if the rAddr is valid, nullptr otherwise.
                                  */
   Cell::SPtr                    GetCell(Address const& rAddr);
   Cell::SPtr const              GetCell(Address const& rAddr) const;
 
+                                /*! This method returns a cell by its address, the semantic of
+                                 * an instruction is built as well (e.g. for emulation).
+                                 */
+  Cell::SPtr                    GetCellWithSemantic(Address const& rAddr) const;
+
   u8                            GetCellType(Address const& rAddr) const;
   u8                            GetCellSubType(Address const& rAddr) const;
 
+                                /*! This method returns the mode of the instruction at rAddr.
+                                 * \return Returns false if there is no instruction at rAddr.
+                                 */
+  bool                          GetInstructionMode(Address const& rAddr, u8& rMode) const;
+
+                                /*! This method decodes the instruction at rAddr into rInsn, its storage
+                                 * is reused so a caller which keeps rInsn doesn't allocate a cell.
+                                 * \return Returns false if there is no instruction at rAddr.
+                                 */
+  bool                          DecodeInstruction(Address const& rAddr, Instruction& rInsn) const;
+
                                 /*! This method adds a new cell.
                                  * \param rAddr is the address of the new cell.
                                  * \param pCell is the new cell.
@@ -236,6 +255,7 @@ public:
 
 private:
   void RemoveLabelIfNeeded(Address const& rAddr);
+  Cell::SPtr MakeCell(Address const& rAddr, u8 DisasmFlags) const;
 
   typedef boost::mutex MutexType;
 
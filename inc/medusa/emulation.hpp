@@ -11,6 +11,7 @@
 
 #include <unordered_map>
 #include <functional>
+#include <vector>
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -31,6 +32,28 @@ public:
   virtual bool Execute(Address const& rAddress, Expression const& rExpr) = 0;
   virtual bool Execute(Address const& rAddress, Expression::List const& rExprList) = 0;
 
+  //! Emulators with an internal format can keep translated blocks, a block is then executed
+  //! with ExecuteBlock until the memory it was decoded from is written.
+  //\param Size is the size in byte of the instructions in the block.
+  //\return false if the block can't be kept, Execute must be used instead.
+  virtual bool TranslateBlock(Address const& rAddress, u32 Size, Expression::List const& rExprList);
+  virtual bool IsBlockTranslated(Address const& rAddress) const;
+  virtual bool ExecuteBlock(Address const& rAddress);
+  virtual void InvalidateBlocks(void);
+
+  //! Emulators can chain translated blocks: ExecuteBlock then keeps running the next
+  //! translated blocks instead of returning after the first one.
+  //\param pStopAddr if not null, ExecuteBlock returns before executing the block at this address.
+  virtual void SetBlockChaining(bool Enable, Address const* pStopAddr = nullptr);
+
+  //! These methods save and restore the cpu and memory contexts, see MemoryContext::TakeSnapshot.
+  virtual bool TakeSnapshot(void);
+  virtual bool RestoreSnapshot(void);
+
+  //! This method returns the time in nanoseconds spent translating code inside ExecuteBlock,
+  //! e.g. traces compiled from hot blocks. The time spent in TranslateBlock is measured by its caller.
+  u64 GetTranslationTime(void) const { return m_TranslationTime; }
+
   enum HookType
   {
     HookUnknown   = 0x0,
@@ -41,28 +64,66 @@ public:
 
   typedef std::function<void(CpuContext*, MemoryContext*)> HookCallback;
 
+  //! Each type of hook has its own callback, so an address can have different read, write
+  //! and execute hooks. Adding a hook of a type already set on rAddress replaces its callback.
   virtual bool AddHook(Address const& rAddress, u32 Type, HookCallback Callback);
   virtual bool AddHook(Document const& rDoc, std::string const& rLabelName, u32 Type, HookCallback Callback);
+
+  //! This method adds a hook called for any access of Type in [rAddress, rAddress + Size).
+  //\param Size must not be 0, a size of 1 is the same as a hook on rAddress.
+  virtual bool AddHook(Address const& rAddress, u32 Size, u32 Type, HookCallback Callback);
+
+  //! This method removes all hooks on rAddress, including hooks on a range starting at rAddress.
   virtual bool RemoveHook(Address const& rAddress);
 
+  bool HasHooks(void) const { return m_HookNo != 0; }
+
 protected:
   Emulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext *pMemCtxt, VariableContext *pVarCtxt);
 
-  struct HookInformation
+  enum
   {
-    HookInformation(u32 Type = HookUnknown, HookCallback Callback = nullptr) : m_Type(Type), m_Callback(Callback) {}
+    HookTypeNo       = 3,
+    HookPageBits     = 12,
+    HookFilterSize   = 0x1000, //! Number of entries in the page filter, a power of 2
+  };
+
+  struct HookRange
+  {
+    Address      m_Address;
+    u32          m_Size;
     u32          m_Type;
     HookCallback m_Callback;
   };
 
-  bool TestHook(Address const& rAddress, u32 Type) const;
+  //! This method calls the hooks of Type on rAddress, a page filter rejects most addresses
+  //! without searching the hooks.
+  //\return true if a hook has been called.
+  bool TestHook(Address const& rAddress, u32 Type) const
+  {
+    if (!(m_HookFilter[(rAddress.GetOffset() >> HookPageBits) & (HookFilterSize - 1)] & Type))
+      return false;
+    return CallHooks(rAddress, Type);
+  }
 
   CpuInformation const* m_pCpuInfo;
   CpuContext*           m_pCpuCtxt;
   MemoryContext*        m_pMemCtxt;
   VariableContext*      m_pVarCtxt;
-  typedef std::unordered_map<Address, HookInformation> HookAddressHashMap;
-  HookAddressHashMap m_Hooks;
+  RegisterLayout        m_RegLayout;                  //! Direct access to the registers of m_pCpuCtxt
+  u8                    m_HookFilter[HookFilterSize]; //! Types of the hooks on the pages which have this index
+  u64                   m_TranslationTime;            //! @see GetTranslationTime
+
+private:
+  bool CallHooks(Address const& rAddress, u32 Type) const;
+  void FilterHook(u64 Offset, u32 Size, u32 Type);
+  void UpdateHookFilter(void);
+  static u32 GetHookTypeIndex(u32 Type);
+
+  typedef std::unordered_map<Address, HookCallback> HookAddressHashMap;
+  HookAddressHashMap     m_Hooks[HookTypeNo];         //! Hooks on a single address, indexed by GetHookTypeIndex
+  std::vector<HookRange> m_RangeHooks;
+  u32                    m_HookNo;
 };
 
 typedef Emulator* (*TGetEmulator)(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt);
@@ -7,9 +7,16 @@
 #include "medusa/address.hpp"
 #include "medusa/medusa.hpp"
 #include "medusa/architecture.hpp"
+#include "medusa/decoded_instruction.hpp"
 #include "medusa/os.hpp"
 #include "medusa/context.hpp"
 #include "medusa/emulation.hpp"
+#include "medusa/expression_simplifier.hpp"
+#include "medusa/trace.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -24,7 +31,51 @@ public:
 
   void Execute(Address const& rAddr);
 
+  typedef std::function<bool(u32 RunIndex, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt)> SetupCallback;
+  typedef std::function<void(u32 RunIndex, bool Reached, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt)> ResultCallback;
+
+  //! This method takes a snapshot of the current state, then for each run: rSetup writes the inputs,
+  //! the code is executed from rAddr until the program pointer reaches rStopAddr (at the
+  //! beginning of a block), rResult reads the outputs and the snapshot is restored.
+  //\param rSetup can return false to stop before RunNo runs.
+  //\return the number of completed runs.
+  u32 ExecuteFromSnapshot(Address const& rAddr, Address const& rStopAddr, u32 RunNo, SetupCallback Setup, ResultCallback Result);
+
+  //! Without trace, translated blocks are executed directly: instructions are neither
+  //! disassembled again nor formatted.
+  enum TraceType
+  {
+    TraceNone        = 0x0,
+    TraceInstruction = 0x1, //! Disassemble, format and log every executed instruction
+    TraceBlock       = 0x2, //! Call the trace callback before each block
+  };
+
+  typedef std::function<void(Address const& rBlockAddress, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt)> TraceCallback;
+
+  void SetTrace(u32 TraceMask, TraceCallback Callback = nullptr);
+  u32  GetTraceMask(void) const { return m_TraceMask; }
+
+  //! This method starts recording executed blocks, memory writes and registers with pRecorder,
+  //! the previous recorder is stopped. Blocks aren't chained while recording, each snapshot
+  //! restored by ExecuteFromSnapshot is recorded (@see TraceRecorder::RestoreRecord).
+  //\param pRecorder can be nullptr to stop recording, it must outlive the recording.
+  bool SetTraceRecorder(TraceRecorder* pRecorder);
+
+  //! This method returns the time in nanoseconds spent translating blocks: decoding, building the
+  //! semantic, TranslateBlock and the translations done by the emulator while blocks are executed.
+  u64 GetTranslationTime(void) const;
+
 private:
+  bool ExecuteUntil(Address const& rAddr, Address const* pStopAddr);
+
+  // Blocks are rarely longer, a longer block is decoded with several batches
+  enum { BlockInstructionNumber = 16 };
+
+  //! This method decodes up to InsnNo instructions from the emulated memory at rAddr.
+  //\param rCode receives a view of the memory at rAddr, offsets of pInsns are relative to it.
+  //\return the number of decoded instructions, 0 if rAddr doesn't hold an instruction.
+  size_t DecodeInstructions(Address const& rAddr, MemoryBinaryStreamView& rCode, DecodedInstruction* pInsns, size_t InsnNo) const;
+
   Medusa*                    m_pCore;
   Architecture::SharedPtr    m_spArch;
   OperatingSystem::SharedPtr m_spOs;
@@ -32,6 +83,35 @@ private:
   MemoryContext*             m_pMemCtxt;
   CpuInformation const*      m_pCpuInfo;
   Emulator::SharedPtr        m_spEmul;
+  ExpressionSimplifier       m_Simplifier;
+  u32                        m_TraceMask;
+  TraceCallback              m_TraceCallback;
+  TraceRecorder*             m_pTraceRecorder;
+  u64                        m_TranslationTime; //! Time spent before the emulator executes a new block
+};
+
+//! ParallelExecution emulates many functions of the same document on several threads. Each
+//! thread has its own Execution, so its own contexts and emulator: translated blocks are not
+//! shared between threads.
+class Medusa_EXPORT ParallelExecution
+{
+public:
+  //\param ThreadNo is the number of threads, 0 means one thread per core.
+  ParallelExecution(Medusa* pCore, Architecture::SharedPtr spArch, OperatingSystem::SharedPtr spOs, u32 ThreadNo = 0);
+
+  bool Initialize(u64 StackLinearAddress, u32 StackSize, std::string const& rEmulatorName);
+
+  //! This method executes each function of rFuncAddrs from the initial state until the program
+  //! pointer reaches rStopAddr (@see Execution::ExecuteFromSnapshot), RunIndex is the index of the
+  //! function in rFuncAddrs. Callbacks are called from the worker threads.
+  //\param rSetup can return false to skip a function, it usually pushes rStopAddr as the return address.
+  //\return the number of executed functions.
+  u32 Execute(std::vector<Address> const& rFuncAddrs, Address const& rStopAddr, Execution::SetupCallback Setup, Execution::ResultCallback Result);
+
+  u32 GetThreadNo(void) const { return static_cast<u32>(m_Executions.size()); }
+
+private:
+  std::vector<std::unique_ptr<Execution>> m_Executions;
 };
 
 MEDUSA_NAMESPACE_END
@@ -7,24 +7,48 @@
 #include "medusa/address.hpp"
 #include "medusa/information.hpp"
 #include "medusa/context.hpp"
+#include "medusa/expression_arena.hpp"
 
 #include <list>
 
 MEDUSA_NAMESPACE_BEGIN
 
 class ExpressionVisitor;
+class ExpressionFactory;
 
 class Medusa_EXPORT Expression
 {
 public:
   virtual ~Expression(void) {}
 
+  //! Expressions can be allocated from the heap or from an ExpressionArena,
+  //! in both cases they must be released with delete.
+  static void* operator new(size_t Size);
+  static void* operator new(size_t Size, ExpressionArena& rArena);
+  static void* operator new(size_t Size, ExpressionArena* pArena);
+  static void  operator delete(void* pExpr);
+  static void  operator delete(void* pExpr, ExpressionArena& rArena);
+  static void  operator delete(void* pExpr, ExpressionArena* pArena);
+
+  //! This method returns true if the expression is owned by an ExpressionFactory,
+  //! such expressions are immutable and must not be deleted.
+  bool IsShared(void) const;
+
+  //! This method deletes pExpr unless it's nullptr or shared.
+  static void Release(Expression* pExpr);
+
   typedef std::list<Expression *> List;
   virtual std::string ToString(void) const = 0;
   virtual Expression *Clone(void) const = 0;
+  //! This method copies the expression tree into rArena.
+  virtual Expression *Clone(ExpressionArena& rArena) const = 0;
   virtual u32 GetSizeInBit(void) const = 0;
   virtual Expression* Visit(ExpressionVisitor *pVisitor) const = 0;
   virtual bool SignExtend(u32 NewSizeInBit) = 0;
+
+private:
+  friend class ExpressionFactory;
+  static void MarkAsShared(Expression* pExpr);
 };
 
 class Medusa_EXPORT ContextExpression : public Expression
@@ -90,6 +114,7 @@ public:
 
   virtual std::string ToString(void) const;
   virtual Expression *Clone(void) const;
+  virtual Expression *Clone(ExpressionArena& rArena) const;
   virtual u32 GetSizeInBit(void) const { return 0; }
   virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitBind(m_Expressions); }
   virtual bool SignExtend(u32 NewSizeInBit) { return false; }
@@ -122,6 +147,7 @@ public:
 
   virtual std::string ToString(void) const;
   virtual Expression *Clone(void) const;
+  virtual Expression *Clone(ExpressionArena& rArena) const;
   virtual u32 GetSizeInBit(void) const { return 0; }
   virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitCondition(m_Type, m_pRefExpr, m_pTestExpr); }
   virtual bool SignExtend(u32 NewSizeInBit) { return false; }
@@ -145,6 +171,7 @@ public:
 
   virtual std::string ToString(void) const;
   virtual Expression *Clone(void) const;
+  virtual Expression *Clone(ExpressionArena& rArena) const;
   virtual u32 GetSizeInBit(void) const { return 0; }
   virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitIfCondition(m_Type, m_pRefExpr, m_pTestExpr, m_pThenExpr); }
   virtual bool SignExtend(u32 NewSizeInBit) { return false; }
@@ -162,6 +189,7 @@ public:
 
   virtual std::string ToString(void) const;
   virtual Expression *Clone(void) const;
+  virtual Expression *Clone(ExpressionArena& rArena) const;
   virtual u32 GetSizeInBit(void) const { return 0; }
   virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitIfElseCondition(m_Type, m_pRefExpr, m_pTestExpr, m_pThenExpr, m_pElseExpr); }
   virtual bool SignExtend(u32 NewSizeInBit) { return false; }
@@ -179,6 +207,7 @@ public:
 
   virtual std::string ToString(void) const;
   virtual Expression *Clone(void) const;
+  virtual Expression *Clone(ExpressionArena& rArena) const;
   virtual u32 GetSizeInBit(void) const { return 0; }
   virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitWhileCondition(m_Type, m_pRefExpr, m_pTestExpr, m_pBodyExpr); }
 
@@ -208,12 +237,13 @@ public:
     OpSext /* Sign Extend */
   };
 
-  //! pLeftExpr and pRightExpr must be allocated by standard new
+  //! pLeftExpr and pRightExpr must be allocated by new, either from the heap or from an ExpressionArena
   OperationExpression(Type OpType, Expression *pLeftExpr, Expression *pRightExpr);
   virtual ~OperationExpression(void);
 
   virtual std::string ToString(void) const;
   virtual Expression *Clone(void) const;
+  virtual Expression *Clone(ExpressionArena& rArena) const;
   virtual u32 GetSizeInBit(void) const { return 0; }
   virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitOperation(m_OpType, m_pLeftExpr, m_pRightExpr); }
   virtual bool SignExtend(u32 NewSizeInBit) { return false; }
@@ -250,6 +280,7 @@ public:
 
   virtual std::string ToString(void) const;
   virtual Expression *Clone(void) const;
+  virtual Expression *Clone(ExpressionArena& rArena) const;
   virtual u32 GetSizeInBit(void) const { return m_ConstType; }
   virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitConstant(m_ConstType, m_Value); }
   virtual bool SignExtend(u32 NewSizeInBit);
@@ -275,6 +306,7 @@ public:
 
   virtual std::string ToString(void) const;
   virtual Expression *Clone(void) const;
+  virtual Expression *Clone(ExpressionArena& rArena) const;
   virtual u32 GetSizeInBit(void) const;
   virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitIdentifier(m_Id, m_pCpuInfo); }
   virtual bool SignExtend(u32 NewSizeInBit) { return false; }
@@ -301,6 +333,7 @@ public:
 
   virtual std::string ToString(void) const;
   virtual Expression *Clone(void) const;
+  virtual Expression *Clone(ExpressionArena& rArena) const;
   virtual u32 GetSizeInBit(void) const;
   virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitMemory(m_AccessSizeInBit, m_pExprBase, m_pExprOffset, m_Dereference); }
   virtual bool SignExtend(u32 NewSizeInBit) { return false; }
@@ -329,6 +362,7 @@ public:
 
   virtual std::string ToString(void) const;
   virtual Expression* Clone(void) const;
+  virtual Expression* Clone(ExpressionArena& rArena) const;
   virtual u32 GetSizeInBit(void) const;
   virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitVariable(m_Type, m_Name); }
   virtual bool SignExtend(u32 NewSizeInBit) { return false; }
@@ -0,0 +1,67 @@
+#ifndef _MEDUSA_EXPRESSION_ARENA_HPP_
+#define _MEDUSA_EXPRESSION_ARENA_HPP_
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+
+#include <cstddef>
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! ExpressionArena is a bump allocator used to build a whole semantic tree at once.
+//! Expressions are allocated with new (rArena) XxxExpression(...) and can still be deleted
+//! as usual: the destructor is run but the memory is only released by Reset or by the arena
+//! destructor. Thus the arena must outlive all expressions allocated from it.
+class Medusa_EXPORT ExpressionArena
+{
+public:
+  enum
+  {
+    DefaultChunkSize = 0x400,
+    Alignment        = sizeof(u64)
+  };
+
+  ExpressionArena(u32 ChunkSize = DefaultChunkSize);
+  ~ExpressionArena(void);
+
+  //! This method returns Size bytes aligned on Alignment, it never returns nullptr.
+  void*  Allocate(size_t Size)
+  {
+    Size = (Size + Alignment - 1) & ~static_cast<size_t>(Alignment - 1);
+    if (static_cast<size_t>(m_pEnd - m_pCur) < Size)
+      return AllocateSlow(Size);
+    void* pMem = m_pCur;
+    m_pCur += Size;
+    m_UsedSize += Size;
+    return pMem;
+  }
+
+  //! This method releases all allocations at once, the first chunk is kept for reuse.
+  void   Reset(void);
+
+  //! This method returns the size currently allocated from the arena.
+  size_t GetUsedSize(void) const { return m_UsedSize; }
+
+private:
+  ExpressionArena(ExpressionArena const&);
+  ExpressionArena& operator=(ExpressionArena const&);
+
+  struct Chunk
+  {
+    Chunk* m_pNext;
+    size_t m_Size;
+  };
+
+  void*  AllocateSlow(size_t Size);
+
+  Chunk* m_pChunks;
+  u8*    m_pCur;
+  u8*    m_pEnd;
+  u32    m_ChunkSize;
+  size_t m_UsedSize;
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !_MEDUSA_EXPRESSION_ARENA_HPP_
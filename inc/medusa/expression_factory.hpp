@@ -0,0 +1,149 @@
+#ifndef _MEDUSA_EXPRESSION_FACTORY_HPP_
+#define _MEDUSA_EXPRESSION_FACTORY_HPP_
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+#include "medusa/expression.hpp"
+#include "medusa/expression_arena.hpp"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! ExpressionFacts holds facts derived from an expression, they're computed once per shared expression.
+struct Medusa_EXPORT ExpressionFacts
+{
+  enum Flag
+  {
+    ReadMemory    = 1 << 0,
+    WriteMemory   = 1 << 1,
+    ReadVariable  = 1 << 2,
+    WriteVariable = 1 << 3,
+    Conditional   = 1 << 4,
+    Loop          = 1 << 5
+  };
+
+  ExpressionFacts(void) : m_Flags() {}
+
+  bool ReadsMemory(void)    const { return (m_Flags & ReadMemory)    ? true : false; }
+  bool WritesMemory(void)   const { return (m_Flags & WriteMemory)   ? true : false; }
+  bool ReadsVariable(void)  const { return (m_Flags & ReadVariable)  ? true : false; }
+  bool WritesVariable(void) const { return (m_Flags & WriteVariable) ? true : false; }
+  bool IsConditional(void)  const { return (m_Flags & Conditional)   ? true : false; }
+
+  //! These methods compare identifiers, use CpuInformation::IsRegisterAliased to handle aliases.
+  bool ReadsRegister(u32 Id)  const;
+  bool WritesRegister(u32 Id) const;
+
+  std::vector<u32> const& GetReadRegisters(void)    const { return m_ReadRegisters;    }
+  std::vector<u32> const& GetWrittenRegisters(void) const { return m_WrittenRegisters; }
+
+  u32              m_Flags;
+  std::vector<u32> m_ReadRegisters;    //! Sorted identifiers read by the expression
+  std::vector<u32> m_WrittenRegisters; //! Sorted identifiers written by the expression
+};
+
+//! ExpressionFactory hash-conses expressions: structurally equal expressions are built only once,
+//! so they share their storage and can be compared by pointer. Returned expressions are
+//! immutable (@see Expression::IsShared) and owned by the factory, they live as long as it.
+//! All methods are thread-safe.
+class Medusa_EXPORT ExpressionFactory
+{
+public:
+  ExpressionFactory(void);
+  ~ExpressionFactory(void);
+
+  Expression const* MakeBind           (std::vector<Expression const*> const& rExprs);
+  Expression const* MakeCondition      (u32 Type, Expression const* pRefExpr, Expression const* pTestExpr);
+  Expression const* MakeIfCondition    (u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr);
+  Expression const* MakeIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr);
+  Expression const* MakeWhileCondition (u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr);
+  Expression const* MakeOperation      (u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr);
+  Expression const* MakeConstant       (u32 Type, u64 Value);
+  Expression const* MakeIdentifier     (u32 Id, CpuInformation const* pCpuInfo);
+  Expression const* MakeMemory         (u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref);
+  Expression const* MakeVariable       (u32 Type, std::string const& rName);
+
+  //! This method returns the shared version of pExpr, pExpr is left untouched.
+  //\return nullptr if pExpr is nullptr.
+  Expression const* Intern(Expression const* pExpr);
+
+  //! This method interns each expression of rExprList.
+  void              Intern(Expression::List const& rExprList, std::vector<Expression const*>& rSharedExprs);
+
+  //! This method returns the facts of a shared expression, pExpr must have been returned by this factory.
+  ExpressionFacts const& GetFacts(Expression const* pExpr) const;
+
+  //! This method returns the number of unique expressions.
+  size_t            GetExpressionCount(void) const;
+
+private:
+  ExpressionFactory(ExpressionFactory const&);
+  ExpressionFactory& operator=(ExpressionFactory const&);
+
+  enum Kind
+  {
+    BindKind,
+    ConditionKind,
+    IfConditionKind,
+    IfElseConditionKind,
+    WhileConditionKind,
+    OperationKind,
+    ConstantKind,
+    IdentifierKind,
+    MemoryKind,
+    VariableKind
+  };
+
+  //! Key identifies an expression from its kind, its fields and its (already shared) sub-expressions.
+  struct Key
+  {
+    Key(void) : m_Kind(), m_Type(), m_Value(), m_pCpuInfo(nullptr) {}
+
+    u32                            m_Kind;
+    u32                            m_Type;
+    u64                            m_Value;
+    void const*                    m_pCpuInfo;
+    std::vector<Expression const*> m_SubExprs;
+    std::string                    m_Name;
+
+    bool operator==(Key const& rKey) const;
+  };
+
+  struct KeyHash
+  {
+    size_t operator()(Key const& rKey) const;
+  };
+
+  struct Entry
+  {
+    Key             m_Key;
+    Expression*     m_pExpr;
+    ExpressionFacts m_Facts;
+  };
+
+  typedef std::unordered_map<Key, Entry*, KeyHash> ExpressionMap;
+  typedef std::unordered_map<Expression const*, Entry*> FactsMap;
+
+  Expression const* Insert(Key const& rKey);
+  Expression*       Build(Key const& rKey);
+  Entry const&      GetEntry(Expression const* pExpr) const;
+  void              ComputeFacts(Key const& rKey, ExpressionFacts& rFacts) const;
+  void              AddWriteFacts(Expression const* pDstExpr, ExpressionFacts& rFacts) const;
+
+  class InternVisitor;
+
+  mutable std::recursive_mutex m_Mutex;
+  ExpressionArena              m_Arena;
+  ExpressionMap                m_Expressions;
+  FactsMap                     m_Facts;
+  std::vector<Entry*>          m_Entries;
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !_MEDUSA_EXPRESSION_FACTORY_HPP_
@@ -0,0 +1,72 @@
+#ifndef _MEDUSA_EXPRESSION_SIMPLIFIER_HPP_
+#define _MEDUSA_EXPRESSION_SIMPLIFIER_HPP_
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+#include "medusa/information.hpp"
+#include "medusa/context.hpp"
+#include "medusa/expression.hpp"
+#include "medusa/expression_arena.hpp"
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! ExpressionSimplifier rewrites semantic statements before they're emulated.
+//! Folding and algebraic rules follow the interpreter evaluation: the result of an operation
+//! has the size of its left operand. Memory reads are assumed to have no side effect
+//! unless they're the direct operand of an operation.
+class Medusa_EXPORT ExpressionSimplifier
+{
+public:
+  enum Pass
+  {
+    ConstantFolding           = 1 << 0, //! Evaluate operations and conditions on constants
+    AlgebraicSimplification   = 1 << 1, //! Apply x + 0, x * 1, x & 0, x ^ x, ... rules
+    IdentityElimination       = 1 << 2, //! Remove statements like x = x
+    DeadAssignmentElimination = 1 << 3, //! Remove register writes (including flag bits) overwritten in the same block
+    AllPasses                 = 0xf
+  };
+
+  ExpressionSimplifier(CpuInformation const* pCpuInfo, u32 Passes = AllPasses)
+    : m_pCpuInfo(pCpuInfo), m_pCpuCtxt(nullptr), m_Passes(Passes) {}
+
+  u32  GetPasses(void) const        { return m_Passes;   }
+  void SetPasses(u32 Passes)        { m_Passes = Passes; }
+
+  //! The context tells where registers are stored, without it a register write only
+  //! covers earlier writes of the same register (@see IsSubRegister).
+  void UseCpuContext(CpuContext* pCpuCtxt) { m_pCpuCtxt = pCpuCtxt; }
+
+  //! This method returns a simplified copy of pExpr allocated from rArena.
+  Expression* Simplify(Expression const* pExpr, ExpressionArena& rArena) const;
+
+  //! This method appends the simplified statements of pExpr to rStmts, a statement without
+  //! effect is not appended and a top-level bind is flattened.
+  void        Simplify(Expression const* pExpr, Expression::List& rStmts, ExpressionArena& rArena) const;
+
+  //! This method removes and releases the register writes of rStmts which are overwritten
+  //! before being read, every register is considered as read after the last statement.
+  //\return the number of removed statements.
+  u32         EliminateDeadAssignments(Expression::List& rStmts) const;
+
+private:
+  class SimplifyVisitor;
+  class ReadVisitor;
+
+  struct StatementInformation;
+
+  void AnalyzeStatement(Expression const* pStmt, StatementInformation& rInfo) const;
+  u64  GetRegisterMask(u32 Id) const;
+
+  //! This method returns true if SubId is stored inside Id, so writing Id overwrites SubId.
+  //! Aliased registers aren't always stored together, e.g. x86 flags are computed from other registers.
+  bool IsSubRegister(u32 Id, u32 SubId) const;
+
+  CpuInformation const* m_pCpuInfo;
+  CpuContext*           m_pCpuCtxt;
+  u32                   m_Passes;
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !_MEDUSA_EXPRESSION_SIMPLIFIER_HPP_
@@ -0,0 +1,115 @@
+#ifndef _MEDUSA_FORMAT_BUFFER_
+#define _MEDUSA_FORMAT_BUFFER_
+
+#include "medusa/namespace.hpp"
+#include "medusa/types.hpp"
+#include "medusa/export.hpp"
+#include "medusa/cell.hpp"
+#include "medusa/label.hpp"
+
+#include <string>
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! FormatBuffer is a reusable text buffer used to format a cell without allocating.
+//! The text and the marks are written into caller-provided storage, when it's full
+//! the output is truncated and IsTruncated returns true.
+class Medusa_EXPORT FormatBuffer
+{
+public:
+  FormatBuffer(char* pText, size_t TextSize, Cell::Mark* pMarks, size_t MarkSize)
+    : m_pText(pText), m_TextSize(TextSize), m_TextLength()
+    , m_pMarks(pMarks), m_MarkSize(MarkSize), m_MarkCount()
+    , m_Truncated(false)
+  {
+    if (m_TextSize != 0)
+      m_pText[0] = '\0';
+  }
+
+  //! This method empties the buffer, the storage is kept.
+  void Reset(void)
+  {
+    m_TextLength = 0;
+    m_MarkCount  = 0;
+    m_Truncated  = false;
+    if (m_TextSize != 0)
+      m_pText[0] = '\0';
+  }
+
+  //! This method appends a null terminated string.
+  void Append(char const* pStr);
+
+  //! This method appends Length characters of pStr.
+  void Append(char const* pStr, size_t Length);
+
+  //! This method appends a character.
+  void Append(char Chr);
+
+  //! This method appends Value in hexadecimal, padded with 0 up to Width digits.
+  //\param Prefix adds 0x before the digits.
+  //\return the number of characters written.
+  size_t AppendHex(u64 Value, u8 Width = 0, bool Prefix = true);
+
+  //! This method appends the name of rLabel (@see Label::GetLabel).
+  //\return the number of characters written.
+  size_t AppendLabel(Label const& rLabel);
+
+  //! This method appends a string and marks it with Type.
+  void Append(Cell::Mark::Type Type, char const* pStr)
+  {
+    size_t OldLength = m_TextLength;
+    Append(pStr);
+    AddMark(Type, m_TextLength - OldLength);
+  }
+
+  //! This method adds a mark which covers Length characters.
+  void AddMark(Cell::Mark::Type Type, size_t Length)
+  {
+    if (m_MarkCount >= m_MarkSize)
+    {
+      m_Truncated = true;
+      return;
+    }
+    m_pMarks[m_MarkCount++] = Cell::Mark(Type, Length);
+  }
+
+  //! This method replaces the content of the buffer with the result of the string based formatter.
+  void Assign(std::string const& rStr, Cell::Mark::List const& rMarks);
+
+  //! This method converts the buffer to the string based representation.
+  void ToString(std::string& rStr, Cell::Mark::List& rMarks) const;
+
+  char        const* GetText(void)      const { return m_pText;      }
+  size_t             GetLength(void)    const { return m_TextLength; }
+  Cell::Mark  const* GetMarks(void)     const { return m_pMarks;     }
+  size_t             GetMarkCount(void) const { return m_MarkCount;  }
+  bool               IsTruncated(void)  const { return m_Truncated;  }
+
+private:
+  FormatBuffer(FormatBuffer const&);
+  FormatBuffer& operator=(FormatBuffer const&);
+
+  char*       m_pText;
+  size_t      m_TextSize;
+  size_t      m_TextLength;
+  Cell::Mark* m_pMarks;
+  size_t      m_MarkSize;
+  size_t      m_MarkCount;
+  bool        m_Truncated;
+};
+
+//! FixedFormatBuffer embeds its storage, it's usually kept by the caller and reused for each line.
+template<size_t TextSize = 0x200, size_t MarkSize = 0x40>
+class FixedFormatBuffer : public FormatBuffer
+{
+public:
+  FixedFormatBuffer(void) : FormatBuffer(m_Text, TextSize, m_Marks, MarkSize) {}
+
+private:
+  char       m_Text[TextSize];
+  Cell::Mark m_Marks[MarkSize];
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !_MEDUSA_FORMAT_BUFFER_
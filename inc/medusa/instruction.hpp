@@ -70,7 +70,9 @@ public:
     , m_UpdatedFlags()
     , m_ClearedFlags()
     , m_FixedFlags()
+    , m_SemId()
     , m_Expressions()
+    , m_SemArena()
   {
     m_spDna->Length() = Length;
   }
@@ -84,11 +86,16 @@ public:
     , m_UpdatedFlags()
     , m_ClearedFlags()
     , m_FixedFlags()
+    , m_SemId()
     , m_Expressions()
+    , m_SemArena()
   {}
 
   ~Instruction(void);
 
+  //! This method restores the instruction to its initial state, so it can be reused for decoding.
+  void                    Reset(void);
+
   char const*             GetName(void) const         { return m_pName;           }
 
   void                    SetName(char const* pName)  { m_pName = pName;          }
@@ -97,11 +104,15 @@ public:
   void                    SetUpdatedFlags(u32 Flags)  { m_UpdatedFlags = Flags;   }
   void                    SetClearedFlags(u32 Flags)  { m_ClearedFlags = Flags;   }
   void                    SetFixedFlags(u32 Flags)    { m_FixedFlags = Flags;     }
+  void                    SetSemanticId(u32 SemId)    { m_SemId = SemId;          }
   void                    SetSemantic(Expression::List const& rExprList);
   void                    SetSemantic(Expression* pExpr);
   void                    AddPreSemantic(Expression* pExpr);
   void                    AddPostSemantic(Expression* pExpr);
 
+  //! This arena should be used to allocate the semantic, it's released with the instruction.
+  ExpressionArena&        SemanticArena(void)         { return m_SemArena;        }
+
   medusa::Operand*        Operand(unsigned int Oprd)
   { return Oprd > OPERAND_NO ? nullptr : &m_Oprd[Oprd];                           }
   medusa::Operand const*  Operand(unsigned int Oprd) const
@@ -125,6 +136,7 @@ public:
   u32                     GetUpdatedFlags(void) const { return m_UpdatedFlags;    }
   u32                     GetClearedFlags(void) const { return m_ClearedFlags;    }
   u32                     GetFixedFlags(void) const   { return m_FixedFlags;      }
+  u32                     GetSemanticId(void) const   { return m_SemId;           }
   Expression::List const& GetSemantic(void) const     { return m_Expressions;     }
 
   /*! This method gives the offset of a specified operand
@@ -146,7 +158,9 @@ private:
   u32                     m_UpdatedFlags;     /*! This integer holds flags that could be modified by the instruction  */
   u32                     m_ClearedFlags;     /*! This integer holds flags that are unset by the instruction          */
   u32                     m_FixedFlags;       /*! This integer holds flags that are set by the instruction            */
+  u32                     m_SemId;            /*! This integer holds the architecture specific semantic id            */
   Expression::List        m_Expressions;      /*! This list contains semantic for this instruction if not empty       */
+  ExpressionArena         m_SemArena;         /*! This arena holds expressions allocated by the semantic              */
 
 private:
   Instruction(Instruction const&);
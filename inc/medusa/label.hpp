@@ -47,6 +47,10 @@ public:
   void        SetType(u16 Type) { m_Type = Type; }
   std::string GetLabel(void) const;
 
+  //! This method writes the label into pBuffer without allocating.
+  //\return the length of the label, pBuffer is always terminated by a null character.
+  size_t      GetLabel(char* pBuffer, size_t BufferSize) const;
+
   void IncrementVersion(void);
 
   bool IsAutoGenerated(void) const;
@@ -11,6 +11,7 @@
 #include <sstream>
 #include <iomanip>
 #include <boost/function.hpp>
+#include <boost/thread/mutex.hpp>
 #include <boost/thread/recursive_mutex.hpp>
 #include <boost/thread/locks.hpp>
 #include <boost/type_traits.hpp>
@@ -21,27 +22,41 @@
 
 MEDUSA_NAMESPACE_BEGIN
 
+//! LogWrapper builds one message in its own buffer, so threads can log at the same time.
+//! A message which isn't flushed when the wrapper is destroyed is continued by the next
+//! wrapper of the same type (@see Log::Write).
 class Medusa_EXPORT LogWrapper
 {
 public:
   typedef boost::function<void(std::wstring const&)> LoggerCallback;
   typedef LogWrapper& (*LoggerFunction)(LogWrapper&);
 
-  LogWrapper(LoggerCallback pLog, std::string Name, std::wstring& rBuffer)
+  LogWrapper(LoggerCallback pLog, std::string const& rType, std::wstring const& rPending)
     : m_pLog(pLog)
-    , m_Name(L"")
-    , m_rBuffer(rBuffer)
+    , m_Type(rType)
+    , m_Name(StringToWString(rType))
+    , m_Buffer(rPending)
+    , m_Owner(true)
   {
-    std::wstring WideName = StringToWString(Name);
-    m_Name     = WideName;
-
-    if (m_rBuffer.empty())
+    if (m_Buffer.empty())
     {
-      m_rBuffer  = WideName;
-      m_rBuffer += L": ";
+      m_Buffer  = m_Name;
+      m_Buffer += L": ";
     }
   }
 
+  LogWrapper(LogWrapper&& rLogWrapper)
+    : m_pLog(rLogWrapper.m_pLog)
+    , m_Type(rLogWrapper.m_Type)
+    , m_Name(rLogWrapper.m_Name)
+    , m_Buffer(rLogWrapper.m_Buffer)
+    , m_Owner(rLogWrapper.m_Owner)
+  {
+    rLogWrapper.m_Owner = false;
+  }
+
+  ~LogWrapper(void);
+
   template<typename T> LogWrapper& operator<<(T Value)
   {
     std::wostringstream oss;
@@ -50,36 +65,42 @@ public:
       oss << std::hex << std::internal << std::showbase << std::setfill(L'0') << std::setw(sizeof(Value) * 2 + 2) << Value;
     else
       oss << Value;
-    m_rBuffer += oss.str();
+    m_Buffer += oss.str();
 
     return *this;
   }
 
+  //! The logger callback is called by one thread at a time.
   LogWrapper& Flush(void)
   {
     if (m_pLog)
     {
-      boost::recursive_mutex::scoped_lock(m_Mutex);
-      m_pLog(m_rBuffer);
-      m_rBuffer = m_Name;
-      m_rBuffer += L": ";
+      boost::recursive_mutex::scoped_lock Lock(m_Mutex);
+      m_pLog(m_Buffer);
+      m_Buffer  = m_Name;
+      m_Buffer += L": ";
     }
     return *this;
   }
 
-  std::wstring& GetBuffer(void)   { return m_rBuffer;  }
-  void Write(wchar_t const* pMsg) { m_rBuffer += pMsg; }
-  void Lock(void)                 { m_Mutex.lock();    }
-  void Unlock(void)               { m_Mutex.unlock();  }
+  std::wstring& GetBuffer(void)   { return m_Buffer;  }
+  void Write(wchar_t const* pMsg) { m_Buffer += pMsg; }
+  void Lock(void)                 { m_Mutex.lock();   }
+  void Unlock(void)               { m_Mutex.unlock(); }
 
 private:
+  LogWrapper(LogWrapper const&);
+  LogWrapper& operator=(LogWrapper const&);
+
   static std::wstring StringToWString(std::string const& rString);
 
   typedef boost::recursive_mutex MutexType;
 
   LoggerCallback   m_pLog;
+  std::string      m_Type;
   std::wstring     m_Name;
-  std::wstring&    m_rBuffer;
+  std::wstring     m_Buffer;
+  bool             m_Owner;  //! false once the message is moved to another wrapper
   static MutexType m_Mutex;
 };
 
@@ -97,18 +118,25 @@ Medusa_EXPORT LogWrapper& LogEnd(LogWrapper& rLogWrapper);
 class Medusa_EXPORT Log : boost::noncopyable
 {
 public:
-  static void SetLog(LogWrapper::LoggerCallback pLog)
-  { m_pLog = pLog; }
+  static void SetLog(LogWrapper::LoggerCallback pLog);
 
+  //! This method can be called by several threads, each call returns its own message.
   static LogWrapper Write(std::string const& rType);
 
 private:
+  friend class LogWrapper;
+
   Log(void);
   ~Log(void);
 
+  //! This method keeps a message which isn't flushed, the next call to Write continues it.
+  static void KeepPending(std::string const& rType, std::wstring const& rBuffer);
+
   typedef std::map<std::string, std::wstring> LogMap;
+  typedef boost::mutex                        MutexType;
 
-  static LogMap                     m_LogMap;
+  static MutexType                  m_Mutex;  //! Guards m_LogMap and m_pLog
+  static LogMap                     m_LogMap; //! Pending message of each type
   static LogWrapper::LoggerCallback m_pLog;
 };
 
@@ -59,12 +59,18 @@ public:
 
   Cell::SPtr                      GetCell(Address const& rAddr);
   Cell::SPtr const                GetCell(Address const& rAddr) const;
+  Cell::SPtr                      GetCellWithSemantic(Address const& rAddr) const;
   bool FormatCell(
     Address       const& rAddress,
     Cell          const& rCell,
     std::string        & rStrCell,
     Cell::Mark::List   & rMarks) const;
 
+  bool FormatCell(
+    Address       const& rAddress,
+    Cell          const& rCell,
+    FormatBuffer       & rBuf) const;
+
   MultiCell*                      GetMultiCell(Address const& rAddr);
   MultiCell const*                GetMultiCell(Address const& rAddr) const;
   bool FormatMultiCell(
@@ -154,13 +154,15 @@ public:
     case DS_64BIT: default: return m_Value;
     }
   }
+  u64         GetRawValue(void) const            { return m_Value;           }
   u16         GetSegValue(void) const            { return m_SegValue;        }
 
   u8          GetLength(void) const;
   u8          GetRawLength(void) const;
   u32         GetSizeInBit(void) const;
 
-  Expression *GetSemantic(CpuInformation const* pCpuInfo, u8 InstructionLength = 0, bool Dereference = true) const;
+  //! This method builds the semantic of the operand, pArena is used if it's not nullptr.
+  Expression *GetSemantic(CpuInformation const* pCpuInfo, u8 InstructionLength = 0, bool Dereference = true, ExpressionArena* pArena = nullptr) const;
 
   void        SetType(u32 Type)                  { m_Type     = Type;        }
   void        SetName(std::string const& rName)  { m_Name     = rName;       }
@@ -0,0 +1,129 @@
+#ifndef __MEDUSA_PAGED_MEMORY_HPP__
+#define __MEDUSA_PAGED_MEMORY_HPP__
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+#include "medusa/context.hpp"
+#include "medusa/memory_area.hpp"
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! PagedMemoryContext finds the memory chunk of an address with a 4-level page table
+//! (4 x 13 bits plus a 12-bit page offset) cached by a small direct-mapped TLB.
+//! Each page has an access (see MemoryArea::Access), every page is readable, writable
+//! and executable until ProtectMemory is called. An access to an unmapped or protected
+//! page fails and is reported with the fault callback.
+//! Snapshots are copy-on-write: a page is saved the first time it's written after
+//! TakeSnapshot and RestoreSnapshot only copies back the pages written since the last restore.
+//! Memory written through a raw pointer (e.g. FindMemory) is not tracked.
+class Medusa_EXPORT PagedMemoryContext : public MemoryContext
+{
+public:
+  enum
+  {
+    PageBits   = 12,
+    PageSize   = 1 << PageBits,
+    LevelBits  = 13,
+    LevelSize  = 1 << LevelBits,
+    LevelNo    = 4,
+    TlbSize    = 64,
+  };
+
+  typedef std::function<void(u64 LinearAddress, u32 Size, u32 Access)> FaultCallback;
+
+  PagedMemoryContext(CpuInformation const& rCpuInfo);
+  virtual ~PagedMemoryContext(void);
+
+  virtual bool ReadMemory(u64 LinearAddress, void* pValue,       u32 ValueSize) const;
+  virtual bool WriteMemory(u64 LinearAddress, void const* pValue, u32 ValueSize, bool SignExtend = false);
+
+  virtual bool AllocateMemory(u64 LinearAddress, u32 Size, void** ppRawMemory);
+  virtual bool FreeMemory    (u64 LinearAddress);
+  virtual bool MapMemory     (u64 LinearAddress, u32 Size, BinaryStream const& rBinStrm, TOffset Position, u32 Length, void** ppRawMemory);
+
+  virtual bool TakeSnapshot(void);
+  virtual bool RestoreSnapshot(void);
+
+  //! This method sets the access of all pages in [LinearAddress, LinearAddress + Size).
+  //\return false if one of these pages is not mapped.
+  bool ProtectMemory(u64 LinearAddress, u32 Size, u32 Access);
+  bool GetMemoryAccess(u64 LinearAddress, u32& rAccess) const;
+
+  //! This method tests if [LinearAddress, LinearAddress + Size) is mapped with Access,
+  //! the fault callback is called if it's not the case.
+  bool CheckAccess(u64 LinearAddress, u32 Size, u32 Access) const;
+
+  void SetFaultCallback(FaultCallback Callback) { m_FaultCallback = Callback; }
+
+  //! This method returns the last faulting access.
+  //\return false if no access has faulted.
+  bool GetLastFault(u64& rLinearAddress, u32& rAccess) const;
+
+protected:
+  virtual bool FindMemoryChunk(u64 LinearAddress, MemoryChunk& rMemChnk) const;
+
+private:
+  struct PageEntry
+  {
+    PageEntry(void) : m_Access(MemoryArea::Read | MemoryArea::Write | MemoryArea::Execute), m_Shared(false), m_DirtyGeneration() {}
+
+    MemoryChunk m_Chunk;  //! Chunk backing this page
+    u32         m_Access;
+    bool        m_Shared; //! Several chunks use this page, the chunk must be searched
+    u32         m_DirtyGeneration; //! Equals to m_DirtyGeneration if written since the last restore
+  };
+
+  struct SavedRange
+  {
+    u8*             m_pHost;
+    std::vector<u8> m_Data;
+  };
+  typedef std::vector<SavedRange> SavedPage;
+
+  struct PageDirectory
+  {
+    PageDirectory(void) { for (u32 i = 0; i < LevelSize; ++i) m_pEntries[i] = nullptr; }
+
+    void* m_pEntries[LevelSize]; //! PageDirectory* for upper levels, PageEntry* for the last one
+  };
+
+  struct TlbEntry
+  {
+    u64        m_PageAddress;
+    PageEntry* m_pEntry;
+  };
+
+  PageEntry* GetPageEntry(u64 LinearAddress) const;
+  PageEntry* GetOrCreatePageEntry(u64 LinearAddress);
+  void       RemovePageEntry(u64 LinearAddress);
+  void       UpdatePageEntry(u64 PageAddress);
+  void       UpdatePageEntries(u64 LinearAddress, u32 Size);
+  void       FreeDirectory(PageDirectory* pDir, u32 Level);
+  void       FlushTlb(void) const;
+  bool       Fault(u64 LinearAddress, u32 Size, u32 Access) const;
+
+  void       MarkDirtyPages(u64 LinearAddress, u32 Size);
+  void       SavePage(u64 PageAddress, SavedPage& rSavedPage) const;
+
+  bool       CopyMemory(u64 LinearAddress, void* pValue, u32 ValueSize, u32 Access, bool Write) const;
+
+  PageDirectory*   m_pRootDirectory;
+  mutable TlbEntry m_Tlb[TlbSize];
+  FaultCallback    m_FaultCallback;
+  mutable u64      m_LastFaultAddress;
+  mutable u32      m_LastFaultAccess;
+
+  bool                                  m_HasSnapshot;
+  u32                                   m_DirtyGeneration;
+  std::unordered_map<u64, SavedPage>    m_SavedPages; //! Content of pages when the snapshot was taken
+  std::vector<u64>                      m_DirtyPages; //! Pages written since the last restore
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !__MEDUSA_PAGED_MEMORY_HPP__
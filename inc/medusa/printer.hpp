@@ -5,6 +5,8 @@
 #include "medusa/namespace.hpp"
 #include "medusa/types.hpp"
 #include "medusa/medusa.hpp"
+#include "medusa/format_buffer.hpp"
+#include "medusa/instruction.hpp"
 
 #include <sstream>
 
@@ -35,7 +37,16 @@ protected:
   virtual u32 PrintMemoryArea(Address const& rAddress, u32 xOffset, u32 yOffset) { return 0; }
   virtual u32 PrintEmpty     (Address const& rAddress, u32 xOffset, u32 yOffset) { return 0; }
 
+  //! This method formats the cell at rAddress into m_CellBuffer.
+  //\return false if there is no cell at rAddress.
+  bool FormatCell(Address const& rAddress) const;
+
   Medusa const& m_rCore;
+
+  //! This buffer is reused to format each cell, so printing a whole screen doesn't allocate.
+  mutable FixedFormatBuffer<> m_CellBuffer;
+  //! Instructions are decoded into this one instead of a new cell.
+  mutable Instruction         m_CellInsn;
 };
 
 class Medusa_EXPORT StreamPrinter : public Printer
@@ -0,0 +1,137 @@
+#ifndef __MEDUSA_TRACE_HPP__
+#define __MEDUSA_TRACE_HPP__
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+#include "medusa/context.hpp"
+
+#include <functional>
+#include <iosfwd>
+#include <unordered_map>
+#include <vector>
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! A trace is a header followed by records, each record starts with its type:
+//! - RegisterRecord: the 64-bit words of the CpuContext buffer modified since the previous one,
+//!   as (word index delta, value xor previous value) pairs,
+//! - BlockRecord: the address of the executed block, as a delta from the previous block,
+//! - MemoryRecord: a memory write done by the last block, its address as a delta from the
+//!   previous write, its size and the written bytes,
+//! - RestoreRecord: the memory and the registers were restored from a snapshot, so the memory
+//!   doesn't contain the writes recorded before it anymore (@see Execution::ExecuteFromSnapshot).
+//! Integers are LEB128-encoded and signed deltas are zigzag-encoded, so a block which modifies
+//! a few registers usually takes less than 16 bytes.
+class Medusa_EXPORT TraceRecorder
+{
+public:
+  enum RecordType
+  {
+    EndRecord,
+    RegisterRecord,
+    BlockRecord,
+    MemoryRecord,
+    RestoreRecord,
+  };
+
+  enum
+  {
+    Magic     = 0x5254444d, //! "MDTR"
+    Version   = 2,
+    FlushSize = 0x10000,    //! The buffer is written to the stream when it exceeds this size
+  };
+
+  //! If pStream is nullptr, the trace is kept in memory (@see GetBuffer).
+  TraceRecorder(std::ostream* pStream = nullptr);
+  ~TraceRecorder(void);
+
+  //! This method starts a new trace of pCpuCtxt, the previous one is discarded.
+  //\return false if the context can't be copied (@see CpuContext::GetContextSize).
+  bool Start(CpuContext* pCpuCtxt);
+
+  //! This method records the registers modified since the previous block, then the block itself.
+  void RecordBlock(u64 LinearAddress);
+  void RecordMemoryWrite(u64 LinearAddress, void const* pValue, u32 Size);
+
+  //! This method records the registers modified by the last block, then the restoration of a snapshot.
+  void RecordRestore(void);
+
+  //! This method records the last modified registers and the end of the trace.
+  void Stop(void);
+
+  bool                   IsRecording(void) const { return m_pCpuCtxt != nullptr; }
+  u64                    GetBlockNo(void)  const { return m_BlockNo;             }
+  std::vector<u8> const& GetBuffer(void)   const { return m_Buffer;              }
+
+private:
+  void RecordRegisters(void);
+  void WriteUnsigned(u64 Value);
+  void WriteSigned(s64 Value) { WriteUnsigned((static_cast<u64>(Value) << 1) ^ static_cast<u64>(Value >> 63)); }
+  void Flush(void);
+
+  std::ostream*    m_pStream;
+  CpuContext*      m_pCpuCtxt;
+  std::vector<u8>  m_Buffer;
+  std::vector<u64> m_Registers;     //! Registers at the previous record
+  u64              m_LastBlock;
+  u64              m_LastWrite;
+  u64              m_BlockNo;
+};
+
+//! TraceReader replays a trace written by TraceRecorder. Index builds a table of the memory
+//! writes of each page, so FindWrites doesn't have to replay the whole trace.
+class Medusa_EXPORT TraceReader
+{
+public:
+  struct Event
+  {
+    u8        m_Type;       //! TraceRecorder::BlockRecord, TraceRecorder::MemoryRecord or TraceRecorder::RestoreRecord
+    u64       m_BlockIndex; //! Index of the executed block, of the block which wrote memory, or of the next block after a restore
+    u64       m_Address;
+    u32       m_Size;       //! Size of the memory write
+    u8 const* m_pData;      //! Written bytes
+  };
+
+  //! rRegisters contains the CpuContext buffer at the beginning of the current block.
+  //\return false to stop the replay.
+  typedef std::function<bool(Event const& rEvent, std::vector<u8> const& rRegisters)> ReplayCallback;
+
+  TraceReader(void) : m_ContextSize(), m_DataOffset(), m_Indexed(false) {}
+
+  bool Open(std::vector<u8> const& rTrace);
+  bool Open(std::istream& rStream);
+
+  //\return false if the trace is truncated or invalid.
+  bool Replay(ReplayCallback Callback) const;
+
+  //! This method returns the registers at the beginning of the block BlockIndex.
+  bool GetRegisters(u64 BlockIndex, std::vector<u8>& rRegisters) const;
+
+  bool Index(void);
+
+  //! This method returns the index of the blocks which wrote in [LinearAddress, LinearAddress + Size).
+  bool FindWrites(u64 LinearAddress, u32 Size, std::vector<u64>& rBlockIndexes);
+
+  u32 GetContextSize(void) const { return m_ContextSize; }
+
+private:
+  struct WriteEntry
+  {
+    u64 m_BlockIndex;
+    u64 m_Address;
+    u32 m_Size;
+  };
+
+  enum { IndexPageBits = 12 };
+
+  std::vector<u8> m_Trace;
+  u32             m_ContextSize;
+  u32             m_DataOffset;  //! Offset of the first record
+  bool            m_Indexed;
+  std::unordered_map<u64, std::vector<WriteEntry>> m_WriteIndex; //! Writes by page
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !__MEDUSA_TRACE_HPP__
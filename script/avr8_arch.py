@@ -0,0 +1,177 @@
+#!/usr/env/bin python
+
+# Generates src/arch/avr8/avr8_opcode.cpp, the direct dispatch table indexed
+# by the whole 16-bit opcode word
+
+import sys
+
+# (mask, value, handler), the first matching entry is used, every handler decodes exactly one
+# instruction so Decode never dispatches twice
+opcodes = [
+    (0xff00, 0x0000, 'Nop'),
+    (0xff00, 0x0100, 'Movw'),
+    (0xff00, 0x0200, 'Muls'),
+    (0xff88, 0x0300, 'Mulsu'),
+    (0xff88, 0x0308, 'Fmul'),
+    (0xff88, 0x0380, 'Fmuls'),
+    (0xff88, 0x0388, 'Fmulsu'),
+    (0xfc00, 0x0400, 'Cpc'),
+    (0xfc00, 0x0800, 'Sbc'),
+    (0xfc00, 0x0c00, 'Add'),
+    (0xfc00, 0x1000, 'Cpse'),
+    (0xfc00, 0x1400, 'Cp'),
+    (0xfc00, 0x1800, 'Sub'),
+    (0xfc00, 0x1c00, 'Adc'),
+    (0xfc00, 0x2000, 'And'),
+    (0xfc00, 0x2400, 'Eor'),
+    (0xfc00, 0x2800, 'Or'),
+    (0xfc00, 0x2c00, 'Mov'),
+    (0xf000, 0x3000, 'Cpi'),
+    (0xf000, 0x4000, 'Sbci'),
+    (0xf000, 0x5000, 'Subi'),
+    (0xf000, 0x6000, 'Ori'),
+    (0xf000, 0x7000, 'Andi'),
+
+    # ld and st on Y and Z are ldd and std without displacement
+    (0xfe07, 0x8000, 'Ld'),
+    (0xfe07, 0x8200, 'St'),
+    (0xf200, 0x8000, 'Ldd'),
+    (0xf200, 0x8200, 'Std'),
+
+    (0xfe0f, 0x9000, 'Lds'),
+    (0xfe0f, 0x9001, 'Ld'),
+    (0xfe0f, 0x9002, 'Ld'),
+    (0xfe0f, 0x9009, 'Ld'),
+    (0xfe0f, 0x900a, 'Ld'),
+    (0xfe0f, 0x900c, 'Ld'),
+    (0xfe0f, 0x900d, 'Ld'),
+    (0xfe0f, 0x900e, 'Ld'),
+    (0xfe0e, 0x9004, 'Lpm'),
+    (0xfe0e, 0x9006, 'Elpm'),
+    (0xfe0f, 0x900f, 'Pop'),
+    (0xfe00, 0x9000, 'Invalid'),
+
+    (0xfe0f, 0x9200, 'Sts'),
+    (0xfe0f, 0x9201, 'St'),
+    (0xfe0f, 0x9202, 'St'),
+    (0xfe0f, 0x9209, 'St'),
+    (0xfe0f, 0x920a, 'St'),
+    (0xfe0f, 0x920c, 'St'),
+    (0xfe0f, 0x920d, 'St'),
+    (0xfe0f, 0x920e, 'St'),
+    (0xfe0f, 0x920f, 'Push'),
+    (0xfe00, 0x9200, 'Invalid'),
+
+    (0xffff, 0x9408, 'Sec'),
+    (0xffff, 0x9418, 'Sez'),
+    (0xffff, 0x9428, 'Sen'),
+    (0xffff, 0x9438, 'Sev'),
+    (0xffff, 0x9448, 'Ses'),
+    (0xffff, 0x9458, 'Seh'),
+    (0xffff, 0x9468, 'Set'),
+    (0xffff, 0x9478, 'Sei'),
+    (0xffff, 0x9488, 'Clc'),
+    (0xffff, 0x9498, 'Clz'),
+    (0xffff, 0x94a8, 'Cln'),
+    (0xffff, 0x94b8, 'Clv'),
+    (0xffff, 0x94c8, 'Cls'),
+    (0xffff, 0x94d8, 'Clh'),
+    (0xffff, 0x94e8, 'Clt'),
+    (0xffff, 0x94f8, 'Cli'),
+    (0xffff, 0x9409, 'Ijmp'),
+    (0xffff, 0x9419, 'Eijmp'),
+    (0xff0f, 0x940b, 'Invalid'), # des is not decoded
+    (0xffff, 0x9508, 'Ret'),
+    (0xffff, 0x9509, 'Icall'),
+    (0xffff, 0x9511, 'Eicall'),
+    (0xffff, 0x9518, 'Reti'),
+    (0xffff, 0x9588, 'Sleep'),
+    (0xffff, 0x9598, 'Break'),
+    (0xffff, 0x95a8, 'Wdr'),
+    (0xffff, 0x95c8, 'LpmR0'),
+    (0xffff, 0x95d8, 'ElpmR0'),
+    (0xffef, 0x95e8, 'Spm'),
+    (0xfe0f, 0x9400, 'Com'),
+    (0xfe0f, 0x9401, 'Neg'),
+    (0xfe0f, 0x9402, 'Swap'),
+    (0xfe0f, 0x9403, 'Inc'),
+    (0xfe0f, 0x9405, 'Asr'),
+    (0xfe0f, 0x9406, 'Lsr'),
+    (0xfe0f, 0x9407, 'Ror'),
+    (0xfe0f, 0x940a, 'Dec'),
+    (0xfe0e, 0x940c, 'Jmp'),
+    (0xfe0e, 0x940e, 'Call'),
+    (0xfe00, 0x9400, 'Invalid'),
+
+    (0xff00, 0x9600, 'Adiw'),
+    (0xff00, 0x9700, 'Sbiw'),
+    (0xff00, 0x9800, 'Cbi'),
+    (0xff00, 0x9900, 'Sbic'),
+    (0xff00, 0x9a00, 'Sbi'),
+    (0xff00, 0x9b00, 'Sbis'),
+    (0xfc00, 0x9c00, 'Mulu'),
+
+    (0xf000, 0xa000, 'Invalid'), # ldd and std with a displacement above 31 are not decoded
+    (0xf800, 0xb000, 'In'),
+    (0xf800, 0xb800, 'Out'),
+    (0xf000, 0xc000, 'Rjmp'),
+    (0xf000, 0xd000, 'Rcall'),
+    (0xf000, 0xe000, 'Ldi'),
+
+    (0xfe00, 0xf800, 'Bld'),
+    (0xfe00, 0xfa00, 'Bst'),
+    (0xfe00, 0xfc00, 'Sbrc'),
+    (0xfe00, 0xfe00, 'Sbrs'),
+    (0xfc07, 0xf000, 'Brlo'),
+    (0xfc07, 0xf001, 'Breq'),
+    (0xfc07, 0xf002, 'Brmi'),
+    (0xfc07, 0xf003, 'Brvs'),
+    (0xfc07, 0xf004, 'Brlt'),
+    (0xfc07, 0xf005, 'Brhs'),
+    (0xfc07, 0xf006, 'Brts'),
+    (0xfc07, 0xf007, 'Brie'),
+    (0xfc07, 0xf400, 'Brsh'),
+    (0xfc07, 0xf401, 'Brne'),
+    (0xfc07, 0xf402, 'Brpl'),
+    (0xfc07, 0xf403, 'Brvc'),
+    (0xfc07, 0xf404, 'Brge'),
+    (0xfc07, 0xf405, 'Brhc'),
+    (0xfc07, 0xf406, 'Brtc'),
+    (0xfc07, 0xf407, 'Brid'),
+]
+
+def GetHandler(word):
+    for mask, value, hndl in opcodes:
+        if word & mask == value:
+            return hndl
+    raise Exception('No handler for %04x' % word)
+
+hndls = []
+for mask, value, hndl in opcodes:
+    if not hndl in hndls:
+        hndls.append(hndl)
+
+print '#include "avr8_architecture.hpp"'
+print ''
+print '// Generated by script/avr8_arch.py'
+print ''
+print 'Avr8Architecture::TDisassembler const Avr8Architecture::m_Handler[%#x] =' % len(hndls)
+print '{'
+for i in range(len(hndls)):
+    sep = ','
+    if i == len(hndls) - 1:
+        sep = ''
+    print '  %-40s /* %02x */' % ('&Avr8Architecture::Insn_%s%s' % (hndls[i], sep), i)
+print '};'
+print ''
+print 'u8 const Avr8Architecture::m_OpcodeMap[0x10000] ='
+print '{'
+step = 16
+for i in range(0, 0x10000, step):
+    line = ', '.join('0x%02x' % hndls.index(GetHandler(x)) for x in range(i, i + step))
+    if i + step < 0x10000:
+        line += ','
+    else:
+        line += ' '
+    print '  %s /* %04x */' % (line, i)
+print '};'
@@ -95,11 +95,11 @@ class ArchConvertion:
                 body_name = self.visit(node.body[0])
 
                 if len(node.orelse) == 0:
-                    return 'new IfConditionExpression(\n%s,\n%s)\n' % (Indent(test_name), Indent(body_name))
+                    return 'new (rInsn.SemanticArena()) IfConditionExpression(\n%s,\n%s)\n' % (Indent(test_name), Indent(body_name))
 
                 assert(len(node.orelse) == 1)
                 else_name = self.visit(node.orelse[0])
-                return 'new IfElseConditionExpression(\n%s,\n%s,\n%s)\n' % (Indent(test_name), Indent(body_name), Indent(else_name))
+                return 'new (rInsn.SemanticArena()) IfElseConditionExpression(\n%s,\n%s,\n%s)\n' % (Indent(test_name), Indent(body_name), Indent(else_name))
 
             def visit_IfExp(self, node):
                 assert(0)
@@ -146,7 +146,7 @@ class ArchConvertion:
                 oper_name  = self.visit(node.op)
                 left_name  = self.visit(node.left)
                 right_name = self.visit(node.right)
-                return 'new OperationExpression(\n%s,\n%s,\n%s)'\
+                return 'new (rInsn.SemanticArena()) OperationExpression(\n%s,\n%s,\n%s)'\
                         % (Indent(oper_name), Indent(left_name), Indent(right_name))
 
             def visit_Call(self, node):
@@ -162,7 +162,7 @@ class ArchConvertion:
                 if 'OperationExpression::OpXchg' in func_name:
                     if len(args_name) != 2:
                         assert(0)
-                    return 'new OperationExpression(\n%s,\n%s,\n%s);'\
+                    return 'new (rInsn.SemanticArena()) OperationExpression(\n%s,\n%s,\n%s);'\
                             % (Indent(func_name), Indent(args_name[0]), Indent(args_name[1]))
 
                 if 'VariableExpression' in func_name:
@@ -175,19 +175,19 @@ class ArchConvertion:
                 value_name = self.visit(node.value)
 
                 if attr_name == 'id':
-                    return 'new IdentifierExpression(%s, &m_CpuInfo)' % value_name
+                    return 'new (rInsn.SemanticArena()) IdentifierExpression(%s, &m_CpuInfo)' % value_name
 
                 elif attr_name == 'val':
 
                     if value_name.startswith('rInsn.Operand'):
-                        return '%s->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)' % value_name
+                        return '%s->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())' % value_name
 
                     else: assert(0)
 
                 elif attr_name == 'addr':
 
                     if value_name.startswith('rInsn.Operand'):
-                        return '%s->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false)' % value_name
+                        return '%s->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false, &rInsn.SemanticArena())' % value_name
 
                     else: assert(0)
 
@@ -195,17 +195,17 @@ class ArchConvertion:
 
                     if value_name == 'rInsn':
                         get_pc_size_bit = 'm_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister))'
-                        return 'new ConstantExpression(\n%s,\n%s)'\
+                        return 'new (rInsn.SemanticArena()) ConstantExpression(\n%s,\n%s)'\
                                 % (Indent(get_pc_size_bit), Indent('rInsn.GetLength()'))
 
                     elif value_name.startswith('rInsn.Operand'):
                         get_insn_size_bit = '%s->GetLength()' % value_name
-                        return 'new ConstantExpression(\n%s,\n%s)'\
+                        return 'new (rInsn.SemanticArena()) ConstantExpression(\n%s,\n%s)'\
                                 % (Indent('32'), Indent(get_insn_size_bit))
 
                     else:
                         get_reg_size_bit = 'm_CpuInfo.GetSizeOfRegisterInBit(%s)' % value_name
-                        return 'new ConstantExpression(\n%s,\n%s / 8)'\
+                        return 'new (rInsn.SemanticArena()) ConstantExpression(\n%s,\n%s / 8)'\
                                 % (Indent(get_reg_size_bit), Indent(get_reg_size_bit))
 
                 elif attr_name == 'bit':
@@ -216,7 +216,7 @@ class ArchConvertion:
 
                 elif attr_name == 'mem':
                     get_reg_size_bit = 'm_CpuInfo.GetSizeOfRegisterInBit(%s)' % value_name
-                    return 'new MemoryExpression(%s, nullptr, new IdentifierExpression(%s, &m_CpuInfo))' % (get_reg_size_bit, value_name)
+                    return 'new (rInsn.SemanticArena()) MemoryExpression(%s, nullptr, new (rInsn.SemanticArena()) IdentifierExpression(%s, &m_CpuInfo))' % (get_reg_size_bit, value_name)
 
                 assert(0)
 
@@ -227,7 +227,7 @@ class ArchConvertion:
                     return self.id_mapper[node_name]
 
                 if node_name in self.var_expr:
-                    return 'new VariableExpression(0, "%s")' % node_name
+                    return 'new (rInsn.SemanticArena()) VariableExpression(0, "%s")' % node_name
 
                 # Operand
                 if node_name.startswith('op'):
@@ -235,21 +235,21 @@ class ArchConvertion:
 
                 # Identifier (register)
                 elif node_name == 'id':
-                    return 'new IdentifierExpression(%s, &m_CpuInfo)'
+                    return 'new (rInsn.SemanticArena()) IdentifierExpression(%s, &m_CpuInfo)'
 
                 # Integer
                 elif node_name == 'int':
-                    return 'new ConstantExpression(%s, %s)'
+                    return 'new (rInsn.SemanticArena()) ConstantExpression(%s, %s)'
                 elif node_name.startswith('int'):
                     int_size = int(node_name[3:])
-                    return 'new ConstantExpression(%d, %%s)' % int_size
+                    return 'new (rInsn.SemanticArena()) ConstantExpression(%d, %%s)' % int_size
 
                 # Variable
                 elif node_name == 'var':
-                    return 'new VariableExpression(%s, %s)'
+                    return 'new (rInsn.SemanticArena()) VariableExpression(%s, %s)'
                 elif node_name.startswith('var'):
                     var_size = int(node_name[3:])
-                    return 'new VariableExpression(%d, %%s)' % var_size
+                    return 'new (rInsn.SemanticArena()) VariableExpression(%d, %%s)' % var_size
 
                 # Flags
                 elif node_name == 'update_flags':
@@ -284,13 +284,13 @@ class ArchConvertion:
                 elif node_name == 'swap':
                     return 'OperationExpression::OpXchg'
                 elif node_name == 'sign_extend':
-                    return 'new OperationExpression(OperationExpression::OpSext, %s, %s)'
+                    return 'new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpSext, %s, %s)'
 
                 assert(0)
 
             def visit_Num(self, node):
                 return '%#x' % node.n
-                return 'new ConstantExpression(0, %#x)' % node.n
+                return 'new (rInsn.SemanticArena()) ConstantExpression(0, %#x)' % node.n
 
             def visit_Str(self, node):
                 return '"%s"' % node.s
@@ -302,16 +302,16 @@ class ArchConvertion:
                 assert(len(node.targets) == 1)
                 target_name = self.visit(node.targets[0])
                 value_name  = self.visit(node.value)
-                return 'new OperationExpression(OperationExpression::OpAff,\n%s,\n%s)\n'\
+                return 'new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,\n%s,\n%s)\n'\
                         % (Indent(target_name), Indent(value_name))
 
             def visit_AugAssign(self, node):
                 oper_name   = self.visit(node.op)
                 target_name = self.visit(node.target)
                 value_name  = self.visit(node.value)
-                sub_expr = 'new OperationExpression(\n%s,\n%s,\n%s)'\
+                sub_expr = 'new (rInsn.SemanticArena()) OperationExpression(\n%s,\n%s,\n%s)'\
                         % (Indent(oper_name), Indent(target_name), Indent(value_name))
-                return 'new OperationExpression(\n  OperationExpression::OpAff,\n%s,\n%s)\n'\
+                return 'new (rInsn.SemanticArena()) OperationExpression(\n  OperationExpression::OpAff,\n%s,\n%s)\n'\
                         % (Indent(target_name), Indent(sub_expr))
 
             def visit_Expr(self, node):
@@ -359,7 +359,7 @@ class ArchConvertion:
         var = 'Expression::List AllExpr;\n'
         res += 'rInsn.SetSemantic(AllExpr);\n'
 
-        return self._GenerateBrace(var + res)
+        return var + res
 
     def GenerateHeader(self):
         pass
@@ -367,6 +367,18 @@ class ArchConvertion:
     def GenerateSource(self):
         pass
 
+    def GenerateSemanticHeader(self):
+        return ''
+
+    def GenerateSemanticSource(self):
+        return ''
+
+    def GenerateLengthHeader(self):
+        return ''
+
+    def GenerateLengthSource(self):
+        return ''
+
     def GenerateOpcodeEnum(self):
         pass
 
@@ -385,6 +397,9 @@ class X86ArchConvertion(ArchConvertion):
         self.all_mnemo = set()
         self.all_oprd = set()
         self.all_dec = set()
+        self.all_sem = []
+        self.sem_ids = {}
+        self.len_grp = []
 
     # Architecture dependant methods
     def __X86_GenerateMethodName(self, type_name, opcd_no, in_class = False):
@@ -516,7 +531,7 @@ class X86ArchConvertion(ArchConvertion):
             res += 'rInsn.Length()++;\n'
             if 'mnemonic' in opcd:
                 res += 'rInsn.Prefix() |= X86_Prefix_%s;\n' % opcd['mnemonic']
-            res += 'return Disassemble(rBinStrm, Offset + %d, rInsn, Mode);\n' % (pfx_n - 1)
+            res += 'return Disassemble(rBinStrm, Offset + %d, rInsn, Mode, DisasmDecodeOnly);\n' % (pfx_n - 1)
             return res
 
         if 'suffix' in opcd:
@@ -567,13 +582,179 @@ class X86ArchConvertion(ArchConvertion):
                 'r8':'X86_Reg_R8', 'r9':'X86_Reg_R9', 'r10':'X86_Reg_R10', 'r11':'X86_Reg_R11',
                 'r12':'X86_Reg_R12', 'r13':'X86_Reg_R13', 'r14':'X86_Reg_R14', 'r15':'X86_Reg_R15' }
 
+        # The semantic is not built while decoding, we only keep track of the
+        # method which is able to build it (see X86Architecture::BuildSemantic)
         if 'semantic' in opcd:
-            res += self._ConvertSemanticToCode(opcd, opcd['semantic'], id_mapper)
+            sem = self._ConvertSemanticToCode(opcd, opcd['semantic'], id_mapper)
         else:
-            res += self._ConvertSemanticToCode(opcd, None, id_mapper)
+            sem = self._ConvertSemanticToCode(opcd, None, id_mapper)
+        if len(sem) != 0:
+            res += 'rInsn.SetSemanticId(%#06x);\n' % self.__X86_GetSemanticId(sem)
         res += 'return true;\n'
         return res
 
+    # Length decoder
+    len_maps = [ 'table_1', 'table_2', 'table_3_38', 'table_3_3A' ]
+    len_imms = {
+            'Ib':'Ib', 'Ibs':'Ib', 'Jb':'Ib', 'Lx':'Ib',
+            'Iw':'Iw', 'Iz':'Iz', 'Jz':'Iz', 'Iv':'Iv',
+            'Ap':'Ap', 'Ob':'Ov', 'Ov':'Ov' }
+
+    def __X86_NewLengthAttribute(self, flags = [], imm = None, arg = 0):
+        return { 'flags': set(flags), 'imm': imm, 'arg': arg }
+
+    def __X86_GetOperandLengthAttribute(self, oprd):
+        attr = self.__X86_NewLengthAttribute()
+        imm = []
+        for o in oprd:
+            o = str(o)
+            if o in self.len_imms:
+                imm.append(self.len_imms[o])
+            elif len(o) >= 2 and o[0] in 'NRU' and o[1].islower():
+                # the full decoder ignores ModR/M.mod for register only operands
+                return self.__X86_NewLengthAttribute([ 'Fallback' ])
+            elif o == 'M' or o[0] == 'm' or (len(o) >= 2 and o[0] in 'CDEGMPQSTVW' and o[1].islower()):
+                attr['flags'].add('ModRm')
+
+        if len(imm) == 1:
+            attr['imm'] = imm[0]
+        elif imm == [ 'Iw', 'Ib' ]:
+            attr['imm'] = 'Iw_Ib'
+        elif imm == [ 'Ib', 'Ib' ]:
+            attr['imm'] = 'Iw'
+        elif len(imm) != 0:
+            raise Exception('Unhandled immediate operands %s' % str(oprd))
+
+        return attr
+
+    def __X86_GetLengthAttribute(self, opcd, oprd = None):
+        if 'sub_opcodes' in opcd:
+            return self.__X86_MergeLengthAttribute([ self.__X86_GetLengthAttribute(x) for x in opcd['sub_opcodes'] ])
+
+        if 'invalid' in opcd:
+            return self.__X86_NewLengthAttribute([ 'Invalid' ])
+
+        if 'constraint' in opcd and opcd['constraint'].startswith('pfx'):
+            # outside 64-bit mode, a 64-bit prefix is invalid unless an instruction shares its opcode
+            if 'attr' in opcd and 'm64' in opcd['attr']:
+                return self.__X86_NewLengthAttribute([ 'Prefix64', 'Invalid' ], None, int(opcd['constraint'][3:]) - 1)
+            return self.__X86_NewLengthAttribute([ 'Prefix' ], None, int(opcd['constraint'][3:]) - 1)
+
+        if 'reference' in opcd:
+            ref_oprd = None
+            if 'operand' in opcd:
+                ref_oprd = opcd['operand']
+            return self.__X86_GetReferenceLengthAttribute(opcd['reference'], ref_oprd)
+
+        if oprd == None:
+            oprd = opcd.get('operand', [])
+        attr = self.__X86_GetOperandLengthAttribute(oprd)
+        if 'attr' in opcd and 'nm64' in opcd['attr']:
+            attr['flags'].add('Invalid64')
+
+        return attr
+
+    def __X86_GetReferenceLengthAttribute(self, ref, oprd):
+        if ref in self.len_maps:
+            return self.__X86_NewLengthAttribute([ 'Escape' ], None, self.len_maps.index(ref))
+
+        # tables which are not opcode maps are handled by the full decoder
+        if ref.startswith('table_'):
+            for opcd in self.arch['insn']['table'][ref]:
+                if not 'invalid' in opcd:
+                    return self.__X86_NewLengthAttribute([ 'Fallback' ])
+            return self.__X86_NewLengthAttribute([ 'Invalid' ])
+
+        # x87 instructions only contain a ModR/M byte
+        if ref.startswith('fpu'):
+            return self.__X86_NewLengthAttribute([ 'ModRm' ])
+
+        grp = self.arch['insn']['group'][ref]
+        regs = []
+        for reg in range(8):
+            if reg >= len(grp):
+                regs.append(self.__X86_NewLengthAttribute([ 'Invalid' ]))
+                continue
+
+            opcd_g = grp[reg]
+            if type(opcd_g) == list:
+                attr = self.__X86_NewLengthAttribute([ 'Fallback' ])
+            elif oprd != None and not 'invalid' in opcd_g and not 'sub_opcodes' in opcd_g:
+                attr = self.__X86_GetLengthAttribute(opcd_g, oprd)
+            else:
+                attr = self.__X86_GetLengthAttribute(opcd_g)
+
+            # A group instruction is always followed by a ModR/M byte
+            if len(attr['flags'] & set([ 'Invalid', 'Prefix', 'Prefix64', 'Fallback' ])) == 0:
+                attr['flags'].add('ModRm')
+            elif 'Prefix' in attr['flags'] or 'Prefix64' in attr['flags']:
+                attr = self.__X86_NewLengthAttribute([ 'Fallback' ])
+            regs.append(attr)
+
+        if all(x == regs[0] for x in regs):
+            return regs[0]
+
+        if regs not in self.len_grp:
+            self.len_grp.append(regs)
+        return self.__X86_NewLengthAttribute([ 'ModRm', 'Group' ], None, self.len_grp.index(regs))
+
+    def __X86_MergeLengthAttribute(self, attrs):
+        valid = [ x for x in attrs if not 'Invalid' in x['flags'] or 'Prefix64' in x['flags'] ]
+        if len(valid) == 0:
+            return self.__X86_NewLengthAttribute([ 'Invalid' ])
+
+        # when an opcode map is referenced, other alternatives are vendor specific
+        for attr in valid:
+            if 'Escape' in attr['flags']:
+                return attr
+
+        pfxs  = [ x for x in valid if 'Prefix' in x['flags'] or 'Prefix64' in x['flags'] ]
+        insns = [ x for x in valid if not x in pfxs ]
+        if len(insns) == 0:
+            return pfxs[0]
+
+        res = self.__X86_NewLengthAttribute(insns[0]['flags'], insns[0]['imm'], insns[0]['arg'])
+        for attr in insns[1:]:
+            if attr['imm'] != res['imm'] or attr['arg'] != res['arg']\
+                    or (attr['flags'] ^ res['flags']) - set([ 'Invalid64' ]):
+                return self.__X86_NewLengthAttribute([ 'Fallback' ])
+            if not 'Invalid64' in attr['flags']:
+                res['flags'].discard('Invalid64')
+
+        # VEX prefixes select another opcode map, only REX can be skipped
+        if len(pfxs) != 0:
+            if not all('Prefix64' in x['flags'] and x['arg'] == 0 for x in pfxs) or res['arg'] != 0:
+                return self.__X86_NewLengthAttribute([ 'Fallback' ])
+            res['flags'].add('Prefix64')
+            res['arg'] = pfxs[0]['arg']
+
+        return res
+
+    def __X86_GenerateLengthAttribute(self, attr):
+        res = []
+        for flag in [ 'ModRm', 'Prefix', 'Prefix64', 'Escape', 'Group', 'Invalid', 'Invalid64', 'Fallback' ]:
+            if flag in attr['flags']:
+                res.append('X86_Len_%s' % flag)
+        if attr['imm'] != None:
+            res.append('X86_Len_%s' % attr['imm'])
+        if attr['arg'] != 0:
+            res.append('(%d << X86_Len_ArgShift)' % attr['arg'])
+        if len(res) == 0:
+            return 'X86_Len_None'
+        return ' | '.join(res)
+
+    def __X86_GetSemanticId(self, sem):
+        if sem not in self.sem_ids:
+            self.all_sem.append(sem)
+            self.sem_ids[sem] = len(self.all_sem)
+        return self.sem_ids[sem]
+
+    def __X86_GenerateSemanticName(self, sem_id, in_class = False):
+        meth_fmt = 'bool Semantic_%04x(Instruction& rInsn)'
+        if in_class == False:
+            meth_fmt = 'bool %sArchitecture::Semantic_%%04x(Instruction& rInsn)' % self.arch['arch_info']['name'].capitalize()
+        return meth_fmt % sem_id
+
 
     def __X86_GenerateInstructionCondition(self, opcd):
         cond = []
@@ -710,6 +891,75 @@ class X86ArchConvertion(ArchConvertion):
 
         return res
 
+    def GenerateSemanticHeader(self):
+        res = ''
+
+        res += Indent('typedef bool (%sArchitecture:: *TSemantic)(Instruction&);\n' % self.arch['arch_info']['name'].capitalize())
+        res += Indent('static const TSemantic m_Semantic[%#x];\n' % (len(self.all_sem) + 1))
+        for sem_id in range(1, len(self.all_sem) + 1):
+            res += Indent('%s;\n' % self.__X86_GenerateSemanticName(sem_id, True))
+        res += '\n'
+
+        return res
+
+    def GenerateSemanticSource(self):
+        res = ''
+        arch_name = self.arch['arch_info']['name'].capitalize()
+
+        res += 'const %sArchitecture::TSemantic %sArchitecture::m_Semantic[%#x] =\n' % (arch_name, arch_name, len(self.all_sem) + 1)
+        res += '{\n'
+        tbl_elm = [ Indent('nullptr') ]
+        for sem_id in range(1, len(self.all_sem) + 1):
+            tbl_elm.append(Indent('&%sArchitecture::Semantic_%04x' % (arch_name, sem_id)))
+        res += ',\n'.join(tbl_elm)
+        res += '\n};\n\n'
+
+        sem_id = 1
+        for sem in self.all_sem:
+            res += '%s\n' % self.__X86_GenerateSemanticName(sem_id, False)
+            res += self._GenerateBrace(sem + 'return true;\n')
+            res += '\n'
+            sem_id += 1
+
+        return res
+
+    def GenerateLengthHeader(self):
+        res = ''
+
+        for name in self.len_maps:
+            res += Indent('static const u16 m_Length_%s[0x100];\n' % name[6:].lower())
+        res += Indent('static const u16* const m_LengthMap[%#x];\n' % len(self.len_maps))
+        res += Indent('static const u16 m_LengthGroup[%#x][0x8];\n' % len(self.len_grp))
+        res += '\n'
+
+        return res
+
+    def GenerateLengthSource(self):
+        res = ''
+        arch_name = self.arch['arch_info']['name'].capitalize()
+
+        tbls = []
+        for name in self.len_maps:
+            tbl_name = 'm_Length_%s' % name[6:].lower()
+            tbls.append(Indent(tbl_name))
+            tbl_elm = []
+            for opcd in self.arch['insn']['table'][name]:
+                attr = self.__X86_GetLengthAttribute(opcd)
+                tbl_elm.append(Indent('/* %02x */ %s' % (opcd['opcode'], self.__X86_GenerateLengthAttribute(attr))))
+            res += 'const u16 %sArchitecture::%s[0x100] =\n' % (arch_name, tbl_name)
+            res += '{\n' + ',\n'.join(tbl_elm) + '\n};\n\n'
+
+        res += 'const u16* const %sArchitecture::m_LengthMap[%#x] =\n' % (arch_name, len(self.len_maps))
+        res += '{\n' + ',\n'.join(tbls) + '\n};\n\n'
+
+        grps = []
+        for grp in self.len_grp:
+            grps.append(Indent('{\n' + ',\n'.join(Indent(self.__X86_GenerateLengthAttribute(x)) for x in grp) + '\n}'))
+        res += 'const u16 %sArchitecture::m_LengthGroup[%#x][0x8] =\n' % (arch_name, len(self.len_grp))
+        res += '{\n' + ',\n'.join(grps) + '\n};\n\n'
+
+        return res
+
     def GenerateSource(self):
         res = ''
         arch_name = self.arch['arch_info']['name'].capitalize()
@@ -810,6 +1060,15 @@ class ArmArchConvertion(ArchConvertion):
         self.arm_insns = []
         self.thumb_insns = []
 
+        # Decision tree parameters
+        # Duplication trades size for dispatch depth: with arm_max_duplication = 2
+        # arm_opcode.cpp grows from 17.3k to 27.5k lines and leaves test at most 8
+        # candidates, without duplication (1) it stays at 18.8k lines but a leaf
+        # tests up to 78 candidates sequentially.
+        self.arm_max_field_width = 4
+        self.arm_max_leaf_size = 2
+        self.arm_max_duplication = 2
+
         for insn in all_instructions:
 
             # We need to flatten the encoding array
@@ -1207,7 +1466,7 @@ class ArmArchConvertion(ArchConvertion):
     def GenerateSource(self):
         res = ''
 
-        res += 'bool ArmArchitecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)\n'
+        res += 'bool ArmArchitecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode, u8 Flags)\n'
         res += self._GenerateBrace(
                 self._GenerateSwitch('Mode',
                     [('ARM_ModeArm',   'return DisassembleArm(rBinStrm, Offset, rInsn);\n',   False),
@@ -1215,8 +1474,10 @@ class ArmArchConvertion(ArchConvertion):
                     'return false;\n')
                 )
 
+        # The dispatcher is a decision tree: each node switches on the bit field
+        # which splits the remaining encodings the best, leaves test the
+        # remaining candidates sequentially using the original priority.
         def __ARM_GenerateDispatcher(arm, insns):
-            res = ''
             insns_dict = {}
 
             for insn in insns:
@@ -1225,17 +1486,107 @@ class ArmArchConvertion(ArchConvertion):
                     insns_dict[mask] = []
                 insns_dict[mask].append(insn)
 
+            # 16-bit and 32-bit encodings don't share discriminating bits,
+            # so each size gets its own tree, the narrowest one is tried first
+            cands = {}
             for mask, insn_list in insns_dict.items():
-                if len(insn_list) == 1:
-                    value = arm.__ARM_GetValue(insn_list[0])
-                    res += arm._GenerateCondition('if', '(Opcode & %#010x) == %#010x' % (mask, value), self.__ARM_GenerateInstructionComment(insn) + 'return %s(rBinStrm, Offset, Opcode, rInsn);' % arm.__ARM_GenerateMethodName(insn_list[0]))
+                for insn in insn_list:
+                    size = arm.__ARM_GetSize(insn)
+                    if not size in cands:
+                        cands[size] = []
+                    cands[size].append((mask, arm.__ARM_GetValue(insn), insn))
+
+            res = ''
+            for size in sorted(cands):
+                res += __ARM_GenerateDecisionNode(arm, cands[size], 0x0)
+            return res
+
+        def __ARM_SplitCandidates(cands, beg, width):
+            fmask = ((1 << width) - 1) << beg
+            buckets = []
+            for val in range(1 << width):
+                fval = val << beg
+                buckets.append([ x for x in cands if (x[1] & x[0] & fmask) == (fval & x[0]) ])
+            return buckets
+
+        def __ARM_ChooseField(cands, used):
+            best = None
+            best_score = None
+            best_dup = None
+            best_dup_score = None
+            for beg in range(32):
+                for width in range(1, self.arm_max_field_width + 1):
+                    fmask = ((1 << width) - 1) << beg
+                    if beg + width > 32 or fmask & used:
+                        break
+
+                    # Ignore fields which are not discriminating any candidate
+                    if all((x[0] & fmask) == 0 for x in cands):
+                        continue
+
+                    buckets = __ARM_SplitCandidates(cands, beg, width)
+                    total = sum(len(x) for x in buckets)
+                    score = (max(len(x) for x in buckets), total, width)
+                    if total == len(cands):
+                        if best_score == None or score < best_score:
+                            best = (beg, width)
+                            best_score = score
+                    elif total <= len(cands) * self.arm_max_duplication:
+                        if best_dup_score == None or score < best_dup_score:
+                            best_dup = (beg, width)
+                            best_dup_score = score
+
+            # Candidates which don't care about the field are duplicated in
+            # each case, this is only worth it when no other field splits well
+            if best_dup != None and len(cands) > self.arm_max_leaf_size * 4\
+                    and (best == None or (best_score[0] * 2 > len(cands) and best_dup_score < best_score)):
+                best = best_dup
+                best_score = best_dup_score
+
+            if best == None or best_score[0] >= len(cands):
+                return None
+            return best
+
+        def __ARM_GenerateDecisionLeaf(arm, cands):
+            res = ''
+            for mask, value, insn in cands:
+                res += arm._GenerateCondition('if', '(Opcode & %#010x) == %#010x' % (mask, value),
+                        arm.__ARM_GenerateInstructionComment(insn) + 'return %s(rBinStrm, Offset, Opcode, rInsn);' % arm.__ARM_GenerateMethodName(insn))
+            return res
+
+        def __ARM_GenerateDecisionNode(arm, cands, used):
+            if len(cands) <= self.arm_max_leaf_size:
+                return __ARM_GenerateDecisionLeaf(arm, cands)
+
+            field = __ARM_ChooseField(cands, used)
+            if field == None:
+                return __ARM_GenerateDecisionLeaf(arm, cands)
+
+            beg, width = field
+            fmask = ((1 << width) - 1) << beg
+
+            # Share the code of cases which have the same candidates
+            cases = []
+            for val, bucket in enumerate(__ARM_SplitCandidates(cands, beg, width)):
+                if len(bucket) == 0:
+                    continue
+                for case in cases:
+                    if case[1] == bucket:
+                        case[0].append(val)
+                        break
                 else:
-                    cases = []
-                    for insn in insn_list:
-                        value = arm.__ARM_GetValue(insn)
-                        cases.append( ('%#010x' % value, self.__ARM_GenerateInstructionComment(insn) + 'return %s(rBinStrm, Offset, Opcode, rInsn);\n' % arm.__ARM_GenerateMethodName(insn), False) )
-                    res += arm._GenerateSwitch('Opcode & %#010x' % mask, cases, 'break;\n')
+                    cases.append(([ val ], bucket))
 
+            if width == 1:
+                res = 'switch (ExtractBit<%d>(Opcode))\n{\n' % beg
+            else:
+                res = 'switch (ExtractBits<%d, %d>(Opcode))\n{\n' % (beg, beg + width - 1)
+            for vals, bucket in cases:
+                for val in vals:
+                    res += 'case %#x:\n' % val
+                res += Indent(__ARM_GenerateDecisionNode(arm, bucket, used | fmask) + 'break;\n')
+                res += '\n'
+            res += 'default:\n' + Indent('break;\n') + '}\n'
             return res
 
         res += 'bool ArmArchitecture::DisassembleArm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)\n'
@@ -1289,6 +1640,10 @@ def main():
 
         hdr = conv.GenerateHeader()
         src = conv.GenerateSource()
+        smh = conv.GenerateSemanticHeader()
+        sms = conv.GenerateSemanticSource()
+        lns = conv.GenerateLengthSource()
+        lnh = conv.GenerateLengthHeader()
         enm = conv.GenerateOpcodeEnum()
         mns = conv.GenerateOpcodeString()
         opd = conv.GenerateOperandDefinition()
@@ -1300,12 +1655,16 @@ def main():
         arch_hpp.write(conv.GenerateBanner())
         arch_hpp.write(enm)
         arch_hpp.write(hdr)
+        arch_hpp.write(smh)
+        arch_hpp.write(lnh)
         arch_hpp.write(opd)
 
         arch_cpp.write(conv.GenerateBanner())
         arch_cpp.write('#include "%s_architecture.hpp"\n' % d['arch_info']['name'])
         arch_cpp.write(mns)
         arch_cpp.write(src)
+        arch_cpp.write(sms)
+        arch_cpp.write(lns)
         arch_cpp.write(opc)
 
 if __name__ == "__main__":
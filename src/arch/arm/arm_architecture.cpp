@@ -120,6 +120,40 @@ std::string ArmArchitecture::ARMCpuContext::ToString(void) const
   return oss.str();
 }
 
+size_t ArmArchitecture::DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, DecodedInstruction* pInsns, size_t InsnNo)
+{
+  typedef bool (ArmArchitecture:: *TDecoder)(BinaryStream const&, TOffset, Instruction&);
+
+  // The mode is the same for the whole range, so we select the decoder only once
+  TDecoder pDecoder;
+  switch (Mode)
+  {
+  case ARM_ModeArm:   pDecoder = &ArmArchitecture::DisassembleArm;   break;
+  case ARM_ModeThumb: pDecoder = &ArmArchitecture::DisassembleThumb; break;
+  default:            return 0;
+  }
+
+  TOffset EndOffset = Offset + Size;
+  if (EndOffset > rBinStrm.GetSize())
+    EndOffset = rBinStrm.GetSize();
+
+  Instruction Insn;
+  size_t DecodedNo = 0;
+
+  while (DecodedNo < InsnNo && Offset < EndOffset)
+  {
+    Insn.Reset();
+    if (!(this->*pDecoder)(rBinStrm, Offset, Insn))
+      break;
+    if (Insn.GetLength() == 0 || Offset + Insn.GetLength() > EndOffset)
+      break;
+
+    pInsns[DecodedNo++].Load(Offset, Insn, Mode);
+    Offset += Insn.GetLength();
+  }
+
+  return DecodedNo;
+}
 
 void ArmArchitecture::FillConfigurationModel(ConfigurationModel& rCfgMdl)
 {
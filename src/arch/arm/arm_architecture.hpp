@@ -71,7 +71,10 @@ public:
   virtual std::string           GetName(void) const                                    { return "ARM"; }
   virtual bool                  Translate(Address const& rVirtAddr, TOffset& rPhysOff) { return false; }
   virtual EEndianness           GetEndianness(void)                                    { return LittleEndian; }
-  virtual bool                  Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  virtual bool                  Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode, u8 Flags);
+  // ARM instructions have no semantic yet, decoding is all Disassemble does whatever the flags
+  virtual bool                  BuildSemantic(Instruction& rInsn)                      { return true; }
+  virtual size_t                DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, DecodedInstruction* pInsns, size_t InsnNo);
   virtual NamedModeVector       GetModes(void) const
   {
     NamedModeVector ArmModes;
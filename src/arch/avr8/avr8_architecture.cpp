@@ -17,40 +17,19 @@ bool Avr8Architecture::Translate(Address const& rVirtAddr, TOffset& rPhysOff)
   return true;
 }
 
-bool Avr8Architecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)
+bool Avr8Architecture::Decode(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
 {
-  u8 Opcode1;
-  bool Result;
+  u8 Opcode1, Opcode2;
 
-  rBinStrm.Read(Offset + 1, Opcode1);
+  if (!rBinStrm.Read(Offset, Opcode2) || !rBinStrm.Read(Offset + 1, Opcode1))
+    return false;
 
-  switch (Opcode1 & 0xf0)
-    {
-    case 0x00:
-      Result = Insn_0xxx(rBinStrm, Offset, rInsn);  break;
-    case 0x10:
-      Result = Insn_1xxx(rBinStrm, Offset, rInsn);  break;
-    case 0x20:
-      Result = Insn_2xxx(rBinStrm, Offset, rInsn);  break;
-    case 0x30: case 0x40: case 0x50: case 0x60: case 0x70:
-      Result = Insn_3xxx(rBinStrm, Offset, rInsn);  break;
-    case 0x80:
-      Result = Insn_8xxx(rBinStrm, Offset, rInsn);  break;
-    case 0x90:
-      Result = Insn_9xxx(rBinStrm, Offset, rInsn);  break;
-    case 0xa0:
-      Result = Insn_axxx(rBinStrm, Offset, rInsn);  break;
-    case 0xb0:
-      Result = Insn_bxxx(rBinStrm, Offset, rInsn);  break;
-    case 0xc0:
-      Result = Insn_Rjmp(rBinStrm, Offset, rInsn);  break;
-    case 0xd0:
-      Result = Insn_Rcall(rBinStrm, Offset, rInsn); break;
-    case 0xe0:
-      Result = Insn_Ldi(rBinStrm, Offset, rInsn);   break;
-    case 0xf0:
-      Result = Insn_fxxx(rBinStrm, Offset, rInsn);  break;
-    }
+  return (this->*m_Handler[m_OpcodeMap[Opcode1 << 8 | Opcode2]])(rBinStrm, Offset, rInsn);
+}
+
+bool Avr8Architecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode, u8 Flags)
+{
+  bool Result = Decode(rBinStrm, Offset, rInsn);
 
   if (Result == true)
   {
@@ -62,6 +41,31 @@ bool Avr8Architecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset,
   return Result;
 }
 
+size_t Avr8Architecture::DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, DecodedInstruction* pInsns, size_t InsnNo)
+{
+  TOffset EndOffset = Offset + Size;
+  if (EndOffset > rBinStrm.GetSize())
+    EndOffset = rBinStrm.GetSize();
+
+  Instruction Insn;
+  size_t DecodedNo = 0;
+
+  // Records don't hold operand names, so FormatOperand is not called here
+  while (DecodedNo < InsnNo && Offset < EndOffset)
+  {
+    Insn.Reset();
+    if (!Decode(rBinStrm, Offset, Insn))
+      break;
+    if (Insn.GetLength() == 0 || Offset + Insn.GetLength() > EndOffset)
+      break;
+
+    pInsns[DecodedNo++].Load(Offset, Insn, Mode);
+    Offset += Insn.GetLength();
+  }
+
+  return DecodedNo;
+}
+
 void Avr8Architecture::FillConfigurationModel(ConfigurationModel& rCfgMdl)
 {
   Architecture::FillConfigurationModel(rCfgMdl);
@@ -87,422 +91,206 @@ void Avr8Architecture::FormatOperand(Operand& Op, TOffset Offset)
   Op.SetName(oss.str().c_str());
 }
 
-bool Avr8Architecture::Insn_axxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
-{
-  /*  u8 Opcode1, Opcode2;
+// Operand formats shared by several instructions, opcodes are stored in little endian so
+// Opcode1 is the high byte of the instruction word and Opcode2 the low one
 
-  rInsn.Opcode() = AVR8_Invalid_Insn;
+static bool DecodeImplied(Instruction& rInsn, u32 Opcode, char const* pName)
+{
+  rInsn.Opcode() = Opcode;
   rInsn.Length() = 2;
-  rInsn.SetName("");
+  rInsn.SetName(pName);
+
+  return true;
+}
+
+// Rd, Rr with both registers in r0-r31
+static bool DecodeRdRr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u32 Opcode, char const* pName)
+{
+  u8 Opcode1, Opcode2;
+
+  DecodeImplied(rInsn, Opcode, pName);
 
   rBinStrm.Read(Offset,     Opcode2);
   rBinStrm.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
-  FrstOperand.Type()   = 0;
-  FrstOperand.Value()  = 0;
+  FrstOperand.Type()   = O_REG8;
   FrstOperand.Reg()    = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
 
-  Operand& ScdOperand = rInsn.SecondOperand();
-  ScdOperand.Type()   = 0;
-  ScdOperand.Value()  = 0;
-  ScdOperand.Reg()    = (Opcode1 & 0x02) << 3 | (Opcode2 & 0x0f);
-  */
-  return false;
+  Operand& ScdOperand  = rInsn.SecondOperand();
+  ScdOperand.Type()    = O_REG8;
+  ScdOperand.Reg()     = (Opcode1 & 0x02) << 3 | (Opcode2 & 0x0f);
+
+  return true;
 }
 
-bool Avr8Architecture::Insn_fxxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+// Rd in r0-r31
+static bool DecodeRd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u32 Opcode, char const* pName)
 {
   u8 Opcode1, Opcode2;
-  bool Result;
 
-  rBinStrm.Read(Offset    , Opcode2);
+  DecodeImplied(rInsn, Opcode, pName);
+
+  rBinStrm.Read(Offset,     Opcode2);
   rBinStrm.Read(Offset + 1, Opcode1);
-  rInsn.Length() = 2;
 
-  if ((Opcode1 & 0x0c) > 0x04)
-    {
-      Result = true;
-
-      switch (Opcode1 & 0x06)
-        {
-        case 0x00: rInsn.Opcode() = AVR8_Bld;  rInsn.SetName("bld");  break;
-        case 0x02: rInsn.Opcode() = AVR8_Bst;  rInsn.SetName("bst");  break;
-        case 0x04: rInsn.Opcode() = AVR8_Sbrc; rInsn.SetName("sbrc"); break;
-        case 0x06: rInsn.Opcode() = AVR8_Sbrs; rInsn.SetName("sbrs"); break;
-        }
-
-      Operand& FrstOperand = rInsn.FirstOperand();
-      FrstOperand.Type()   = O_REG8;
-      FrstOperand.Reg()    = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
-
-      Operand& ScdOperand = rInsn.SecondOperand();
-      ScdOperand.Type()   = O_IMM;
-      ScdOperand.Value()  = Opcode2 & 0x07;
-    }
-  else
-    {
-      Result = true;
-      rInsn.SubType() = Instruction::JumpType;
-
-      if (!(Opcode1 & 0x0c))
-      {
-        switch (Opcode2 & 0x07)
-        {
-        case 0x00: rInsn.Opcode() = AVR8_Brlo; rInsn.SetName("brlo"); rInsn.SubType() |= Instruction::ConditionalType; break;
-        case 0x01: rInsn.Opcode() = AVR8_Breq; rInsn.SetName("breq"); rInsn.SubType() |= Instruction::ConditionalType; break;
-        case 0x02: rInsn.Opcode() = AVR8_Brmi; rInsn.SetName("brmi"); rInsn.SubType() |= Instruction::ConditionalType; break;
-        case 0x03: rInsn.Opcode() = AVR8_Brvs; rInsn.SetName("brvs"); rInsn.SubType() |= Instruction::ConditionalType; break;
-        case 0x04: rInsn.Opcode() = AVR8_Brlt; rInsn.SetName("brlt"); rInsn.SubType() |= Instruction::ConditionalType; break;
-        case 0x05: rInsn.Opcode() = AVR8_Brhs; rInsn.SetName("brhs"); rInsn.SubType() |= Instruction::ConditionalType; break;
-        case 0x06: rInsn.Opcode() = AVR8_Brts; rInsn.SetName("brts"); rInsn.SubType() |= Instruction::ConditionalType; break;
-        case 0x07: rInsn.Opcode() = AVR8_Brie; rInsn.SetName("brie"); rInsn.SubType() |= Instruction::ConditionalType; break;
-        }
-      }
-      else // ((Opcode1 & 0x0c) == 0x04)
-        {
-          switch (Opcode2 & 0x07)
-            {
-            case 0x00: rInsn.Opcode() = AVR8_Brsh; rInsn.SetName("brsh"); rInsn.SubType() |= Instruction::ConditionalType; break;
-            case 0x01: rInsn.Opcode() = AVR8_Brne; rInsn.SetName("brne"); rInsn.SubType() |= Instruction::ConditionalType; break;
-            case 0x02: rInsn.Opcode() = AVR8_Brpl; rInsn.SetName("brpl"); rInsn.SubType() |= Instruction::ConditionalType; break;
-            case 0x03: rInsn.Opcode() = AVR8_Brvc; rInsn.SetName("brvc"); rInsn.SubType() |= Instruction::ConditionalType; break;
-            case 0x04: rInsn.Opcode() = AVR8_Brge; rInsn.SetName("brge"); rInsn.SubType() |= Instruction::ConditionalType; break;
-            case 0x05: rInsn.Opcode() = AVR8_Brhc; rInsn.SetName("brhc"); rInsn.SubType() |= Instruction::ConditionalType; break;
-            case 0x06: rInsn.Opcode() = AVR8_Brtc; rInsn.SetName("brtc"); rInsn.SubType() |= Instruction::ConditionalType; break;
-            case 0x07: rInsn.Opcode() = AVR8_Brid; rInsn.SetName("brid"); rInsn.SubType() |= Instruction::ConditionalType; break;
-            }
-        }
-
-      Operand& FrstOperand = rInsn.FirstOperand();
-      FrstOperand.Type()   = O_REL;
-      // Get the 7-bit signed value.
-      FrstOperand.Value() = ((Opcode1 & 0x03) << 5 | Opcode2 >> 3);
-      // Dirty sign-extension from 7-bit to 8-bit (and then implicitly to sizeof(Value)).
-      if ((Opcode1 & 0x02))
-        FrstOperand.Value() = (s8) (((u8)FrstOperand.Value()) | (u8)0x80);
-      // This instruction uses program memory (not data memory).
-      // On avr8, program memory is not byte addressable but word addressable.
-      FrstOperand.Value() *= 2;
-    }
+  Operand& FrstOperand = rInsn.FirstOperand();
+  FrstOperand.Type()   = O_REG8;
+  FrstOperand.Reg()    = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
 
-  return Result;
+  return true;
 }
 
-bool Avr8Architecture::Insn_1xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+// Rd, K with Rd in r16-r31 and an 8-bit immediate
+static bool DecodeRdK(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u32 Opcode, char const* pName)
 {
   u8 Opcode1, Opcode2;
-  //u8 Operand1, Operand2;
 
-  rBinStrm.Read(Offset    , Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
-  rInsn.Length() = 2;
+  DecodeImplied(rInsn, Opcode, pName);
 
-  switch (Opcode1 & 0x0c)
-    {
-    case 0x00: rInsn.Opcode() = AVR8_Cpse; rInsn.SetName("cpse"); break;
-    case 0x04: rInsn.Opcode() = AVR8_Cp;   rInsn.SetName("cp");   break;
-    case 0x08: rInsn.Opcode() = AVR8_Sub;  rInsn.SetName("sub");  break;
-    case 0x0c: rInsn.Opcode() = AVR8_Adc;  rInsn.SetName("adc");  break;
-    }
+  rBinStrm.Read(Offset,     Opcode2);
+  rBinStrm.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG8;
-  FrstOperand.Reg()    = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
+  FrstOperand.Reg()    = (Opcode2 >> 4) + 16;
 
-  Operand& ScdOperand  = rInsn.SecondOperand();
-  ScdOperand.Type()    = O_REG8;
-  ScdOperand.Reg()     = (Opcode1 & 0x02) << 3 | (Opcode2 & 0x0f);
+  Operand& ScdOperand = rInsn.SecondOperand();
+  ScdOperand.Type()   = O_IMM8;
+  ScdOperand.Value()  = (Opcode1 & 0x0f) << 4 | (Opcode2 & 0x0f);
 
   return true;
 }
 
-bool Avr8Architecture::Insn_0xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+// Rd, b with Rd in r0-r31 and b a bit number
+static bool DecodeRdBit(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u32 Opcode, char const* pName)
 {
   u8 Opcode1, Opcode2;
-  u8 Operand1, Operand2;
-  bool Result;
 
-  rBinStrm.Read(Offset    , Opcode2);
+  DecodeImplied(rInsn, Opcode, pName);
+
+  rBinStrm.Read(Offset,     Opcode2);
   rBinStrm.Read(Offset + 1, Opcode1);
-  rInsn.Length() = 2;
 
-  if (!(Opcode1 & 0x0c))
-    {
-      switch (Opcode1)
-        {
-        case 0x00: rInsn.Opcode() = AVR8_Nop;  rInsn.SetName("nop");        break;
-        case 0x01: rInsn.Opcode() = AVR8_Movw; rInsn.SetName("movw");
-          Operand1 = (Opcode2 >> 4) * 2; Operand2 = (Opcode2 & 0x0f) * 2;   break;
-        case 0x02: rInsn.Opcode() = AVR8_Muls; rInsn.SetName("muls");
-          Operand1 = (Opcode2 >> 4) + 16; Operand2 = (Opcode2 & 0x0f) + 16; break;
-        case 0x03:
-          switch (Opcode2 & 0x88)
-            {
-            case 0x00: rInsn.Opcode() = AVR8_Mulsu;  rInsn.SetName("mulsu");  break;
-            case 0x08: rInsn.Opcode() = AVR8_Fmul;   rInsn.SetName("fmul");   break;
-            case 0x80: rInsn.Opcode() = AVR8_Fmuls;  rInsn.SetName("fmuls");  break;
-            case 0x88: rInsn.Opcode() = AVR8_Fmulsu; rInsn.SetName("fmulsu"); break;
-            }
-          Opcode2 &= ~0x88;
-          Operand1 = 16 + (Opcode2 >> 4);
-          Operand2 = 16 + (Opcode2 & 0x0f);
-          break;
-        }
-
-      if (Opcode1) // Operands except for nop
-        {
-          Operand& FrstOperand = rInsn.FirstOperand();
-          FrstOperand.Type()   = O_REG8;
-          FrstOperand.Reg()    = Operand1;
-
-          Operand& ScdOperand = rInsn.SecondOperand();
-          ScdOperand.Type()   = O_REG8;
-          ScdOperand.Reg()    = Operand2;
-        }
-      Result = true;
-    }
-  else
-    {
-      Result = true;
-      switch (Opcode1 & 0x0c)
-        {
-        case 0x04:
-          rInsn.Opcode() = AVR8_Cpc; rInsn.SetName("cpc"); break;
-        case 0x08:
-          rInsn.Opcode() = AVR8_Sbc; rInsn.SetName("sbc"); break;
-        case 0x0c:
-          rInsn.Opcode() = AVR8_Add; rInsn.SetName("add"); break;
-        }
-
-      Operand& FrstOperand = rInsn.FirstOperand();
-      FrstOperand.Type()   = O_REG8;
-      FrstOperand.Reg()    = (Opcode1 & 0x01) << 4 | (Opcode2 >> 4);
-
-      Operand& ScdOperand = rInsn.SecondOperand();
-      ScdOperand.Type()   = O_REG8;
-      ScdOperand.Reg()    = (Opcode1 & 0x02) << 3 | (Opcode2 & 0x0f);
-    }
+  Operand& FrstOperand = rInsn.FirstOperand();
+  FrstOperand.Type()   = O_REG8;
+  FrstOperand.Reg()    = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
 
-  return Result;
+  Operand& ScdOperand = rInsn.SecondOperand();
+  ScdOperand.Type()   = O_IMM;
+  ScdOperand.Value()  = Opcode2 & 0x07;
+
+  return true;
 }
 
-bool Avr8Architecture::Insn_8xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+// A, b with A an address in the lower I/O space and b a bit number
+static bool DecodeIoBit(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u32 Opcode, char const* pName)
 {
-  u8 Opcode1, Opcode2;
+  u8 Opcode2;
 
-  rInsn.Length() = 2;
+  DecodeImplied(rInsn, Opcode, pName);
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rBinStrm.Read(Offset, Opcode2);
 
-  if (!(Opcode1 & 0x0c) && !(Opcode2 & 0x07))
-    {
-      if (Opcode1 & 0x02)
-        {
-          rInsn.Opcode() = AVR8_St; rInsn.SetName("st");
-
-          Operand& FrstOperand = rInsn.FirstOperand();
-          FrstOperand.Type()   = O_MEM8 | O_REG16;
-          FrstOperand.Reg()    = (Opcode2 & 0x08) ? AVR8_RegY : AVR8_RegZ;
-
-          Operand& ScdOperand  = rInsn.SecondOperand();
-          ScdOperand.Type()    = O_REG8;
-          ScdOperand.Reg()     = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
-        }
-      else
-        {
-          rInsn.Opcode() = AVR8_Ld; rInsn.SetName("ld");
-
-          Operand& FrstOperand = rInsn.FirstOperand();
-          FrstOperand.Type()   = O_REG8;
-          FrstOperand.Reg()    = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
-
-          Operand& ScdOperand  = rInsn.SecondOperand();
-          ScdOperand.Type()    = O_MEM8 | O_REG16;
-          ScdOperand.Reg()     = (Opcode2 & 0x08) ? AVR8_RegY : AVR8_RegZ;
-        }
-    }
-  else
-    {
-      if (Opcode1 & 0x02)
-        {
-          rInsn.Opcode() = AVR8_Std; rInsn.SetName("std");
-
-          Operand& FrstOperand = rInsn.FirstOperand();
-          FrstOperand.Type()   = O_MEM8 | O_REG16 | O_DISP;
-          FrstOperand.Reg()    = (Opcode2 & 0x08) ? AVR8_RegY : AVR8_RegZ;
-          FrstOperand.Value()  = (Opcode1 & 0x0c) << 1 | (Opcode2 & 0x07);
-
-          Operand& ScdOperand  = rInsn.SecondOperand();
-          ScdOperand.Type()    = O_REG8;
-          ScdOperand.Reg()     = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
-        }
-      else
-        {
-          rInsn.Opcode() = AVR8_Ldd; rInsn.SetName("ldd");
-
-          Operand& FrstOperand = rInsn.FirstOperand();
-          FrstOperand.Type()   = O_REG8;
-          FrstOperand.Reg()    = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
-
-          Operand& ScdOperand  = rInsn.SecondOperand();
-          ScdOperand.Type()    = O_MEM8 | O_REG16 | O_DISP;
-          ScdOperand.Reg()     = (Opcode2 & 0x08) ? AVR8_RegY : AVR8_RegZ;
-          ScdOperand.Value()   = (Opcode1 & 0x0c) << 1 | (Opcode2 & 0x07);
-        }
-    }
+  Operand& FrstOperand = rInsn.FirstOperand();
+  FrstOperand.Type()   = O_IMM; // Actually it's an address in I/O space.
+  FrstOperand.Value()  = Opcode2 >> 3;
+
+  Operand& ScdOperand = rInsn.SecondOperand();
+  ScdOperand.Type()   = O_IMM;
+  ScdOperand.Value()  = Opcode2 & 0x07;
 
   return true;
 }
 
-bool Avr8Architecture::Insn_3xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+// Rd, K with Rd in r24, r26, r28, r30 and a 6-bit immediate
+static bool DecodeRdwK(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u32 Opcode, char const* pName)
 {
-  u8 Opcode1, Opcode2;
+  u8 Opcode2;
 
-  rInsn.Length() = 2;
+  DecodeImplied(rInsn, Opcode, pName);
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rBinStrm.Read(Offset, Opcode2);
 
   Operand& FrstOperand = rInsn.FirstOperand();
-  FrstOperand.Type()   = O_REG8;
-  FrstOperand.Reg()    = (Opcode2 >> 4) + 16;
+  FrstOperand.Type()   = O_REG;
+  FrstOperand.Reg()    = ((Opcode2 >> 4) & 0x03) * 2 + 24;
 
   Operand& ScdOperand = rInsn.SecondOperand();
-  ScdOperand.Type()   = O_IMM8;
-  ScdOperand.Value()  = (Opcode1 & 0x0f) << 4 | (Opcode2 & 0x0f);
+  ScdOperand.Type()   = O_IMM;
+  ScdOperand.Value()  = ((Opcode2 & 0xc0) >> 2) | (Opcode2 & 0x0f);
 
-  switch (Opcode1 & 0xf0)
-    {
-    case 0x30: rInsn.Opcode() = AVR8_Cpi;  rInsn.SetName("cpi");  break;
-    case 0x40: rInsn.Opcode() = AVR8_Sbci; rInsn.SetName("sbci"); break;
-    case 0x50: rInsn.Opcode() = AVR8_Subi; rInsn.SetName("subi"); break;
-    case 0x60: rInsn.Opcode() = AVR8_Ori;  rInsn.SetName("ori");  break;
-    case 0x70: rInsn.Opcode() = AVR8_Andi; rInsn.SetName("andi"); break;
-    }
+  return true;
+}
+
+// Rd, Rr with both registers in r16-r23
+static bool DecodeFractionalMul(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u32 Opcode, char const* pName)
+{
+  u8 Opcode2;
+
+  DecodeImplied(rInsn, Opcode, pName);
+
+  rBinStrm.Read(Offset, Opcode2);
+
+  Operand& FrstOperand = rInsn.FirstOperand();
+  FrstOperand.Type()   = O_REG8;
+  FrstOperand.Reg()    = 16 + ((Opcode2 >> 4) & 0x07);
+
+  Operand& ScdOperand = rInsn.SecondOperand();
+  ScdOperand.Type()   = O_REG8;
+  ScdOperand.Reg()    = 16 + (Opcode2 & 0x07);
 
   return true;
 }
 
-bool Avr8Architecture::Insn_94xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+// k with k the 7-bit signed offset of a conditional branch
+static bool DecodeBranch(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u32 Opcode, char const* pName)
 {
   u8 Opcode1, Opcode2;
-  bool Result;
 
-  rInsn.Length() = 2;
-  rBinStrm.Read(Offset, Opcode2);
+  DecodeImplied(rInsn, Opcode, pName);
+  rInsn.SubType() = Instruction::JumpType | Instruction::ConditionalType;
+
+  rBinStrm.Read(Offset,     Opcode2);
   rBinStrm.Read(Offset + 1, Opcode1);
 
-  if ((Opcode1 & 0x0f) == 0x04)
-    {
-      if ((Opcode2 & 0x0f) == 0x0b)
-        Result = false;
-      else
-        switch (Opcode2)
-          {
-          case 0x08: rInsn.Opcode() = AVR8_Sec;   rInsn.SetName("sec");   Result = true; break;
-          case 0x18: rInsn.Opcode() = AVR8_Sez;   rInsn.SetName("sez");   Result = true; break;
-          case 0x28: rInsn.Opcode() = AVR8_Sen;   rInsn.SetName("sen");   Result = true; break;
-          case 0x38: rInsn.Opcode() = AVR8_Sev;   rInsn.SetName("sev");   Result = true; break;
-          case 0x48: rInsn.Opcode() = AVR8_Ses;   rInsn.SetName("ses");   Result = true; break;
-          case 0x58: rInsn.Opcode() = AVR8_Seh;   rInsn.SetName("seh");   Result = true; break;
-          case 0x68: rInsn.Opcode() = AVR8_Set;   rInsn.SetName("set");   Result = true; break;
-          case 0x78: rInsn.Opcode() = AVR8_Sei;   rInsn.SetName("sei");   Result = true; break;
-          case 0x88: rInsn.Opcode() = AVR8_Clc;   rInsn.SetName("clc");   Result = true; break;
-          case 0x98: rInsn.Opcode() = AVR8_Clz;   rInsn.SetName("clz");   Result = true; break;
-          case 0xA8: rInsn.Opcode() = AVR8_Cln;   rInsn.SetName("cln");   Result = true; break;
-          case 0xB8: rInsn.Opcode() = AVR8_Clv;   rInsn.SetName("clv");   Result = true; break;
-          case 0xC8: rInsn.Opcode() = AVR8_Cls;   rInsn.SetName("cls");   Result = true; break;
-          case 0xD8: rInsn.Opcode() = AVR8_Clh;   rInsn.SetName("clh");   Result = true; break;
-          case 0xE8: rInsn.Opcode() = AVR8_Clt;   rInsn.SetName("clt");   Result = true; break;
-          case 0xF8: rInsn.Opcode() = AVR8_Cli;   rInsn.SetName("cli");   Result = true; break;
-          case 0x09: rInsn.Opcode() = AVR8_Ijmp;  rInsn.SetName("ijmp");  Result = true; break;
-          case 0x19: rInsn.Opcode() = AVR8_Eijmp; rInsn.SetName("eijmp"); Result = true; break;
-
-          default:
-            if ((Opcode2 & 0x0f) == 0x0b)
-              Result = Insn_Des(rBinStrm, Offset, rInsn);
-            else
-              Result = false;
-            break;
-          }
-    }
-  else // ((Opcode1 & 0x0f) == 0x05)
-    {
-      switch (Opcode2)
-        {
-        case 0x08: rInsn.Opcode() = AVR8_Ret;    rInsn.SetName("ret");    Result = true;
-                   rInsn.SubType() = Instruction::ReturnType;                           break;
-        case 0x09: rInsn.Opcode() = AVR8_Icall;  rInsn.SetName("icall");  Result = true; break;
-        case 0x11: rInsn.Opcode() = AVR8_Eicall; rInsn.SetName("eicall"); Result = true; break;
-        case 0x18: rInsn.Opcode() = AVR8_Reti;   rInsn.SetName("reti");   Result = true; break;
-        case 0x88: rInsn.Opcode() = AVR8_Sleep;  rInsn.SetName("sleep");  Result = true; break;
-        case 0x98: rInsn.Opcode() = AVR8_Break;  rInsn.SetName("break");  Result = true; break;
-        case 0xA8: rInsn.Opcode() = AVR8_Wdr;    rInsn.SetName("wdr");    Result = true; break;
-        case 0xC8: rInsn.Opcode() = AVR8_Lpm;    rInsn.SetName("lpm")  ;  Result = true; break;
-        case 0xD8: rInsn.Opcode() = AVR8_Elpm;   rInsn.SetName("elpm");   Result = true; break;
-        case 0xE8: rInsn.Opcode() = AVR8_Spm;    rInsn.SetName("spm");    Result = true; break;
-        case 0xF8: rInsn.Opcode() = AVR8_Spm;    rInsn.SetName("spm");    Result = true; break;
-        default:
-          Result = false; break;
-        }
-    }
+  Operand& FrstOperand = rInsn.FirstOperand();
+  FrstOperand.Type()   = O_REL;
+  // Get the 7-bit signed value.
+  FrstOperand.Value() = ((Opcode1 & 0x03) << 5 | Opcode2 >> 3);
+  // Dirty sign-extension from 7-bit to 8-bit (and then implicitly to sizeof(Value)).
+  if ((Opcode1 & 0x02))
+    FrstOperand.Value() = (s8) (((u8)FrstOperand.Value()) | (u8)0x80);
+  // This instruction uses program memory (not data memory).
+  // On avr8, program memory is not byte addressable but word addressable.
+  FrstOperand.Value() *= 2;
 
-  if (Result == false)
-    {
-      switch (Opcode2 & 0x0f)
-        {
-        case 0x00: rInsn.Opcode() = AVR8_Com;   rInsn.SetName("com");   Result = true; break;
-        case 0x01: rInsn.Opcode() = AVR8_Neg;   rInsn.SetName("neg");   Result = true; break;
-        case 0x02: rInsn.Opcode() = AVR8_Swap;  rInsn.SetName("swap");  Result = true; break;
-        case 0x03: rInsn.Opcode() = AVR8_Inc;   rInsn.SetName("inc");   Result = true; break;
-        case 0x05: rInsn.Opcode() = AVR8_Asr;   rInsn.SetName("asr");   Result = true; break;
-        case 0x06: rInsn.Opcode() = AVR8_Lsr;   rInsn.SetName("lsr");   Result = true; break;
-        case 0x07: rInsn.Opcode() = AVR8_Ror;   rInsn.SetName("ror");   Result = true; break;
-        case 0x0a: rInsn.Opcode() = AVR8_Dec;   rInsn.SetName("dec");   Result = true; break;
-        default:
-          Result = false; break;
-        }
-
-      if (Result == true)
-        {
-          Operand& FrstOperand = rInsn.FirstOperand();
-          FrstOperand.Type()   = O_REG8;
-          FrstOperand.Reg()    = (Opcode1 & 0x1) << 4 | (Opcode2 >> 4);
-        }
-    }
+  return true;
+}
 
-  if (Result == false && (Opcode2 & 0x0e) >= 0x0c)
-    {
-      if ((Opcode2 & 0x0e) == 0x0c)
-        {
-          rInsn.Opcode() = AVR8_Jmp;
-          rInsn.SetName("jmp");
-          rInsn.SubType() = Instruction::JumpType;
-        }
-      else if ((Opcode2 & 0x0e) == 0x0e)
-        {
-          rInsn.Opcode() = AVR8_Call;
-          rInsn.SetName("call");
-          rInsn.SubType() = Instruction::CallType;
-        }
-
-      u8 Addr3, Addr4;
-      rInsn.Length() = 4;
-      Operand& FrstOperand = rInsn.FirstOperand();
-      FrstOperand.Type()   = O_ABS;
-      rBinStrm.Read(Offset + 2, Addr4);
-      rBinStrm.Read(Offset + 3, Addr3);
-      FrstOperand.Value()  = ( ((Opcode1 & 0x01) << 21)
-                               | ((Opcode2 & 0xf0) << 13) | ((Opcode2 & 0x01) << 16)
-                               | (Addr3 << 8)
-                               | Addr4
-                               ) << 1;
-      Result = true;
-    }
+// k with k the 22-bit absolute address of a 32-bit instruction
+static bool DecodeAbsolute(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u32 Opcode, char const* pName)
+{
+  u8 Opcode1, Opcode2;
+  u8 Addr3, Addr4;
 
-  return Result;
+  DecodeImplied(rInsn, Opcode, pName);
+  rInsn.Length() = 4;
+
+  rBinStrm.Read(Offset,     Opcode2);
+  rBinStrm.Read(Offset + 1, Opcode1);
+  rBinStrm.Read(Offset + 2, Addr4);
+  rBinStrm.Read(Offset + 3, Addr3);
+
+  Operand& FrstOperand = rInsn.FirstOperand();
+  FrstOperand.Type()   = O_ABS;
+  FrstOperand.Value()  = ( ((Opcode1 & 0x01) << 21)
+                           | ((Opcode2 & 0xf0) << 13) | ((Opcode2 & 0x01) << 16)
+                           | (Addr3 << 8)
+                           | Addr4
+                           ) << 1;
+
+  return true;
 }
 
 bool Avr8Architecture::Insn_Des(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
@@ -564,31 +352,6 @@ bool Avr8Architecture::Insn_Lds(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool Avr8Architecture::Insn_90xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
-{
-  u8 Opcode2;
-  bool Result;
-
-  rBinStrm.Read(Offset, Opcode2);
-
-  switch (Opcode2 & 0x0f)
-    {
-    case 0x00:
-      Result = Insn_Lds(rBinStrm, Offset, rInsn);  break;
-    case 0x01: case 0x02: case 0x09: case 0x0a: case 0x0c: case 0x0d: case 0x0e:
-      Result = Insn_Ld(rBinStrm, Offset, rInsn);   break;
-    case 0x04: case 0x05:
-      Result = Insn_Lpm(rBinStrm, Offset, rInsn);  break;
-    case 0x06: case 0x07:
-      Result = Insn_Elpm(rBinStrm, Offset, rInsn); break;
-    case 0x0f:
-      Result = Insn_Pop(rBinStrm, Offset, rInsn);  break;
-    default:
-      Result = false; break;
-    }
-  return Result;
-}
-
 bool Avr8Architecture::Insn_Elpm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
@@ -668,8 +431,10 @@ bool Avr8Architecture::Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset, Ins
 
   switch (Opcode2 & 0x0f)
     {
+    case 0x00: ScdOperand.Reg() = AVR8_RegZ;         Result = true; break;
     case 0x01: ScdOperand.Reg() = AVR8_RegZ_PostInc; Result = true; break;
     case 0x02: ScdOperand.Reg() = AVR8_RegZ_PreDec;  Result = true; break;
+    case 0x08: ScdOperand.Reg() = AVR8_RegY;         Result = true; break;
     case 0x09: ScdOperand.Reg() = AVR8_RegY_PostInc; Result = true; break;
     case 0x0a: ScdOperand.Reg() = AVR8_RegY_PreDec;  Result = true; break;
     case 0x0c: ScdOperand.Reg() = AVR8_RegX;         Result = true; break;
@@ -720,8 +485,10 @@ bool Avr8Architecture::Insn_St(BinaryStream const& rBinStrm, TOffset Offset, Ins
 
   switch (Opcode2 & 0x0f)
     {
+    case 0x00: FrstOperand.Reg() = AVR8_RegZ;         Result = true; break;
     case 0x01: FrstOperand.Reg() = AVR8_RegZ_PostInc; Result = true; break;
     case 0x02: FrstOperand.Reg() = AVR8_RegZ_PreDec;  Result = true; break;
+    case 0x08: FrstOperand.Reg() = AVR8_RegY;         Result = true; break;
     case 0x09: FrstOperand.Reg() = AVR8_RegY_PostInc; Result = true; break;
     case 0x0a: FrstOperand.Reg() = AVR8_RegY_PreDec;  Result = true; break;
     case 0x0c: FrstOperand.Reg() = AVR8_RegX;         Result = true; break;
@@ -757,110 +524,6 @@ bool Avr8Architecture::Insn_Sts(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool Avr8Architecture::Insn_92xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
-{
-  u8 Opcode2;
-  bool Result;
-
-  rBinStrm.Read(Offset, Opcode2);
-
-  switch (Opcode2 & 0x0f)
-    {
-    case 0x00:
-      Result = Insn_Sts(rBinStrm, Offset, rInsn); break;
-    case 0x01: case 0x02: case 0x09: case 0x0a: case 0x0c: case 0x0d: case 0x0e:
-      Result = Insn_St(rBinStrm, Offset, rInsn); break;
-    case 0x0f:
-      Result = Insn_Push(rBinStrm, Offset, rInsn); break;
-    default:
-      Result = false; break;
-    }
-
-  return Result;
-}
-
-bool Avr8Architecture::Insn_98xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
-{
-  u8 Opcode1, Opcode2;
-  bool Result;
-
-  rInsn.Length() = 2;
-
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
-
-  Operand& FrstOperand = rInsn.FirstOperand();
-  FrstOperand.Type()   = O_IMM; // Actually it's an address in I/O space.
-  FrstOperand.Value()  = Opcode2 >> 3;
-
-  Operand& ScdOperand = rInsn.SecondOperand();
-  ScdOperand.Type()   = O_IMM;
-  ScdOperand.Value()  = Opcode2 & 0x07;
-
-  switch (Opcode1 & 0x0f)
-    {
-    case 0x08: rInsn.Opcode() = AVR8_Cbi;  rInsn.SetName("cbi");  Result = true; break;
-    case 0x09: rInsn.Opcode() = AVR8_Sbic; rInsn.SetName("sbic"); Result = true; break;
-    case 0x0a: rInsn.Opcode() = AVR8_Sbi;  rInsn.SetName("sbi");  Result = true; break;
-    case 0x0b: rInsn.Opcode() = AVR8_Sbis; rInsn.SetName("sbis"); Result = true; break;
-    default: Result = false; break;
-    }
-
-  return Result;
-}
-
-bool Avr8Architecture::Insn_96xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
-{
-  u8 Opcode1, Opcode2;
-  bool Result;
-
-  rInsn.Length() = 2;
-
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
-
-  Operand& FrstOperand = rInsn.FirstOperand();
-  FrstOperand.Type()   = O_REG;
-  FrstOperand.Reg()    = ((Opcode2 >> 4) & 0x03) * 2 + 24;
-
-  Operand& ScdOperand = rInsn.SecondOperand();
-  ScdOperand.Type()   = O_IMM;
-  ScdOperand.Value()  = ((Opcode2 & 0xc0) >> 2) | (Opcode2 & 0x0f);
-
-  switch (Opcode1 & 0x0f)
-    {
-    case 0x06: rInsn.Opcode() = AVR8_Adiw; rInsn.SetName("adiw"); Result = true; break;
-    case 0x07: rInsn.Opcode() = AVR8_Sbiw; rInsn.SetName("sbiw"); Result = true; break;
-    }
-
-  return Result;
-}
-
-bool Avr8Architecture::Insn_9xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
-{
-  u8 Opcode1;
-  bool Result;
-
-  rBinStrm.Read(Offset + 1, Opcode1);
-
-  switch (Opcode1 & 0x0e)
-    {
-    case 0x00:
-      Result = Insn_90xx(rBinStrm, Offset, rInsn);  break;
-    case 0x02:
-      Result = Insn_92xx(rBinStrm, Offset, rInsn);  break;
-    case 0x04:
-      Result = Insn_94xx(rBinStrm, Offset, rInsn);  break;
-    case 0x06:
-      Result = Insn_96xx(rBinStrm, Offset, rInsn);  break;
-    case 0x08: case 0x0a:
-      Result = Insn_98xx(rBinStrm, Offset, rInsn);  break;
-    case 0x0c: case 0x0e:
-      Result = Insn_Mulu(rBinStrm, Offset, rInsn);  break;
-    }
-  return Result;
-}
-
 bool Avr8Architecture::Insn_Mulu(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
@@ -957,67 +620,558 @@ bool Avr8Architecture::Insn_Ldi(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool Avr8Architecture::Insn_bxxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Nop(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
 {
-  u8 Opcode1, Opcode2;
+  return DecodeImplied(rInsn, AVR8_Nop, "nop");
+}
 
-  rInsn.Length() = 2;
+bool Avr8Architecture::Insn_Movw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  u8 Opcode2;
+
+  DecodeImplied(rInsn, AVR8_Movw, "movw");
+
+  rBinStrm.Read(Offset, Opcode2);
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
   Operand& FrstOperand = rInsn.FirstOperand();
+  FrstOperand.Type()   = O_REG8;
+  FrstOperand.Reg()    = (Opcode2 >> 4) * 2;
+
   Operand& ScdOperand = rInsn.SecondOperand();
+  ScdOperand.Type()   = O_REG8;
+  ScdOperand.Reg()    = (Opcode2 & 0x0f) * 2;
 
-  if (Opcode1 & 0x08)
-    {
-      rInsn.Opcode() = AVR8_Out;
-      rInsn.SetName("out");
-      FrstOperand.Type()  = O_IMM;
-      FrstOperand.Value() = (Opcode1 & 0x06) << 3 | (Opcode2 & 0x0f);
-      ScdOperand.Type()   = O_REG8;
-      ScdOperand.Reg()    = ((Opcode1 & 0x01) << 4 | (Opcode2 & 0xf0) >> 4);
-    }
-  else
-    {
-      rInsn.Opcode() = AVR8_In;
-      rInsn.SetName("in");
-      FrstOperand.Type() = O_REG8;
-      FrstOperand.Reg()  = ((Opcode1 & 0x01) << 4 | (Opcode2 & 0xf0) >> 4);
-      ScdOperand.Type()  = O_IMM;
-      ScdOperand.Value() = (Opcode1 & 0x06) << 3 | (Opcode2 & 0x0f);
-    }
+  return true;
+}
+
+bool Avr8Architecture::Insn_Muls(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  u8 Opcode2;
+
+  DecodeImplied(rInsn, AVR8_Muls, "muls");
+
+  rBinStrm.Read(Offset, Opcode2);
+
+  Operand& FrstOperand = rInsn.FirstOperand();
+  FrstOperand.Type()   = O_REG8;
+  FrstOperand.Reg()    = (Opcode2 >> 4) + 16;
+
+  Operand& ScdOperand = rInsn.SecondOperand();
+  ScdOperand.Type()   = O_REG8;
+  ScdOperand.Reg()    = (Opcode2 & 0x0f) + 16;
 
   return true;
 }
 
-bool Avr8Architecture::Insn_2xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Mulsu(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeFractionalMul(rBinStrm, Offset, rInsn, AVR8_Mulsu, "mulsu");
+}
+
+bool Avr8Architecture::Insn_Fmul(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeFractionalMul(rBinStrm, Offset, rInsn, AVR8_Fmul, "fmul");
+}
+
+bool Avr8Architecture::Insn_Fmuls(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeFractionalMul(rBinStrm, Offset, rInsn, AVR8_Fmuls, "fmuls");
+}
+
+bool Avr8Architecture::Insn_Fmulsu(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeFractionalMul(rBinStrm, Offset, rInsn, AVR8_Fmulsu, "fmulsu");
+}
+
+bool Avr8Architecture::Insn_Cpc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdRr(rBinStrm, Offset, rInsn, AVR8_Cpc, "cpc");
+}
+
+bool Avr8Architecture::Insn_Sbc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdRr(rBinStrm, Offset, rInsn, AVR8_Sbc, "sbc");
+}
+
+bool Avr8Architecture::Insn_Add(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdRr(rBinStrm, Offset, rInsn, AVR8_Add, "add");
+}
+
+bool Avr8Architecture::Insn_Cpse(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdRr(rBinStrm, Offset, rInsn, AVR8_Cpse, "cpse");
+}
+
+bool Avr8Architecture::Insn_Cp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdRr(rBinStrm, Offset, rInsn, AVR8_Cp, "cp");
+}
+
+bool Avr8Architecture::Insn_Sub(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdRr(rBinStrm, Offset, rInsn, AVR8_Sub, "sub");
+}
+
+bool Avr8Architecture::Insn_Adc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdRr(rBinStrm, Offset, rInsn, AVR8_Adc, "adc");
+}
+
+bool Avr8Architecture::Insn_And(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdRr(rBinStrm, Offset, rInsn, AVR8_And, "and");
+}
+
+bool Avr8Architecture::Insn_Eor(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdRr(rBinStrm, Offset, rInsn, AVR8_Eor, "eor");
+}
+
+bool Avr8Architecture::Insn_Or(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdRr(rBinStrm, Offset, rInsn, AVR8_Or, "or");
+}
+
+bool Avr8Architecture::Insn_Mov(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdRr(rBinStrm, Offset, rInsn, AVR8_Mov, "mov");
+}
+
+bool Avr8Architecture::Insn_Cpi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdK(rBinStrm, Offset, rInsn, AVR8_Cpi, "cpi");
+}
+
+bool Avr8Architecture::Insn_Sbci(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdK(rBinStrm, Offset, rInsn, AVR8_Sbci, "sbci");
+}
+
+bool Avr8Architecture::Insn_Subi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdK(rBinStrm, Offset, rInsn, AVR8_Subi, "subi");
+}
+
+bool Avr8Architecture::Insn_Ori(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdK(rBinStrm, Offset, rInsn, AVR8_Ori, "ori");
+}
+
+bool Avr8Architecture::Insn_Andi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdK(rBinStrm, Offset, rInsn, AVR8_Andi, "andi");
+}
+
+bool Avr8Architecture::Insn_Ldd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
 
+  rInsn.Opcode() = AVR8_Ldd;
   rInsn.Length() = 2;
+  rInsn.SetName("ldd");
 
   rBinStrm.Read(Offset,     Opcode2);
   rBinStrm.Read(Offset + 1, Opcode1);
 
-  switch (Opcode1 & 0x0c)
-    {
-    case 0x00:  rInsn.Opcode() = AVR8_And;  rInsn.SetName("and");  break;
-    case 0x04:  rInsn.Opcode() = AVR8_Eor;  rInsn.SetName("eor");  break;
-    case 0x08:  rInsn.Opcode() = AVR8_Or;   rInsn.SetName("or");   break;
-    case 0x0c:  rInsn.Opcode() = AVR8_Mov;  rInsn.SetName("mov");  break;
-    }
+  Operand& FrstOperand = rInsn.FirstOperand();
+  FrstOperand.Type()   = O_REG8;
+  FrstOperand.Reg()    = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
+
+  Operand& ScdOperand  = rInsn.SecondOperand();
+  ScdOperand.Type()    = O_MEM8 | O_REG16 | O_DISP;
+  ScdOperand.Reg()     = (Opcode2 & 0x08) ? AVR8_RegY : AVR8_RegZ;
+  ScdOperand.Value()   = (Opcode1 & 0x0c) << 1 | (Opcode2 & 0x07);
+
+  return true;
+}
+
+bool Avr8Architecture::Insn_Std(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  u8 Opcode1, Opcode2;
+
+  rInsn.Opcode() = AVR8_Std;
+  rInsn.Length() = 2;
+  rInsn.SetName("std");
+
+  rBinStrm.Read(Offset,     Opcode2);
+  rBinStrm.Read(Offset + 1, Opcode1);
+
+  Operand& FrstOperand = rInsn.FirstOperand();
+  FrstOperand.Type()   = O_MEM8 | O_REG16 | O_DISP;
+  FrstOperand.Reg()    = (Opcode2 & 0x08) ? AVR8_RegY : AVR8_RegZ;
+  FrstOperand.Value()  = (Opcode1 & 0x0c) << 1 | (Opcode2 & 0x07);
+
+  Operand& ScdOperand  = rInsn.SecondOperand();
+  ScdOperand.Type()    = O_REG8;
+  ScdOperand.Reg()     = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
+
+  return true;
+}
+
+bool Avr8Architecture::Insn_Sec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Sec, "sec");
+}
+
+bool Avr8Architecture::Insn_Sez(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Sez, "sez");
+}
+
+bool Avr8Architecture::Insn_Sen(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Sen, "sen");
+}
+
+bool Avr8Architecture::Insn_Sev(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Sev, "sev");
+}
+
+bool Avr8Architecture::Insn_Ses(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Ses, "ses");
+}
+
+bool Avr8Architecture::Insn_Seh(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Seh, "seh");
+}
+
+bool Avr8Architecture::Insn_Set(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Set, "set");
+}
+
+bool Avr8Architecture::Insn_Sei(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Sei, "sei");
+}
+
+bool Avr8Architecture::Insn_Clc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Clc, "clc");
+}
+
+bool Avr8Architecture::Insn_Clz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Clz, "clz");
+}
+
+bool Avr8Architecture::Insn_Cln(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Cln, "cln");
+}
+
+bool Avr8Architecture::Insn_Clv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Clv, "clv");
+}
+
+bool Avr8Architecture::Insn_Cls(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Cls, "cls");
+}
+
+bool Avr8Architecture::Insn_Clh(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Clh, "clh");
+}
+
+bool Avr8Architecture::Insn_Clt(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Clt, "clt");
+}
+
+bool Avr8Architecture::Insn_Cli(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Cli, "cli");
+}
+
+bool Avr8Architecture::Insn_Ijmp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Ijmp, "ijmp");
+}
+
+bool Avr8Architecture::Insn_Eijmp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Eijmp, "eijmp");
+}
+
+bool Avr8Architecture::Insn_Ret(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  rInsn.SubType() = Instruction::ReturnType;
+  return DecodeImplied(rInsn, AVR8_Ret, "ret");
+}
+
+bool Avr8Architecture::Insn_Icall(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Icall, "icall");
+}
+
+bool Avr8Architecture::Insn_Eicall(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Eicall, "eicall");
+}
+
+bool Avr8Architecture::Insn_Reti(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Reti, "reti");
+}
+
+bool Avr8Architecture::Insn_Sleep(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Sleep, "sleep");
+}
+
+bool Avr8Architecture::Insn_Break(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Break, "break");
+}
+
+bool Avr8Architecture::Insn_Wdr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Wdr, "wdr");
+}
+
+bool Avr8Architecture::Insn_LpmR0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Lpm, "lpm");
+}
+
+bool Avr8Architecture::Insn_ElpmR0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Elpm, "elpm");
+}
+
+bool Avr8Architecture::Insn_Spm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeImplied(rInsn, AVR8_Spm, "spm");
+}
+
+bool Avr8Architecture::Insn_Com(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRd(rBinStrm, Offset, rInsn, AVR8_Com, "com");
+}
+
+bool Avr8Architecture::Insn_Neg(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRd(rBinStrm, Offset, rInsn, AVR8_Neg, "neg");
+}
+
+bool Avr8Architecture::Insn_Swap(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRd(rBinStrm, Offset, rInsn, AVR8_Swap, "swap");
+}
+
+bool Avr8Architecture::Insn_Inc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRd(rBinStrm, Offset, rInsn, AVR8_Inc, "inc");
+}
+
+bool Avr8Architecture::Insn_Asr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRd(rBinStrm, Offset, rInsn, AVR8_Asr, "asr");
+}
+
+bool Avr8Architecture::Insn_Lsr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRd(rBinStrm, Offset, rInsn, AVR8_Lsr, "lsr");
+}
+
+bool Avr8Architecture::Insn_Ror(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRd(rBinStrm, Offset, rInsn, AVR8_Ror, "ror");
+}
+
+bool Avr8Architecture::Insn_Dec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRd(rBinStrm, Offset, rInsn, AVR8_Dec, "dec");
+}
+
+bool Avr8Architecture::Insn_Jmp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  rInsn.SubType() = Instruction::JumpType;
+  return DecodeAbsolute(rBinStrm, Offset, rInsn, AVR8_Jmp, "jmp");
+}
+
+bool Avr8Architecture::Insn_Call(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  rInsn.SubType() = Instruction::CallType;
+  return DecodeAbsolute(rBinStrm, Offset, rInsn, AVR8_Call, "call");
+}
+
+bool Avr8Architecture::Insn_Adiw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdwK(rBinStrm, Offset, rInsn, AVR8_Adiw, "adiw");
+}
+
+bool Avr8Architecture::Insn_Sbiw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdwK(rBinStrm, Offset, rInsn, AVR8_Sbiw, "sbiw");
+}
+
+bool Avr8Architecture::Insn_Cbi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeIoBit(rBinStrm, Offset, rInsn, AVR8_Cbi, "cbi");
+}
+
+bool Avr8Architecture::Insn_Sbic(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeIoBit(rBinStrm, Offset, rInsn, AVR8_Sbic, "sbic");
+}
+
+bool Avr8Architecture::Insn_Sbi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeIoBit(rBinStrm, Offset, rInsn, AVR8_Sbi, "sbi");
+}
+
+bool Avr8Architecture::Insn_Sbis(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeIoBit(rBinStrm, Offset, rInsn, AVR8_Sbis, "sbis");
+}
+
+bool Avr8Architecture::Insn_In(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  u8 Opcode1, Opcode2;
+
+  DecodeImplied(rInsn, AVR8_In, "in");
+
+  rBinStrm.Read(Offset,     Opcode2);
+  rBinStrm.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG8;
-  FrstOperand.Reg()    = ((Opcode1 & 0x01) << 4 | (Opcode2 & 0xf0) >> 4);
+  FrstOperand.Reg()    = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
+
+  Operand& ScdOperand = rInsn.SecondOperand();
+  ScdOperand.Type()   = O_IMM;
+  ScdOperand.Value()  = (Opcode1 & 0x06) << 3 | (Opcode2 & 0x0f);
+
+  return true;
+}
+
+bool Avr8Architecture::Insn_Out(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  u8 Opcode1, Opcode2;
+
+  DecodeImplied(rInsn, AVR8_Out, "out");
+
+  rBinStrm.Read(Offset,     Opcode2);
+  rBinStrm.Read(Offset + 1, Opcode1);
+
+  Operand& FrstOperand = rInsn.FirstOperand();
+  FrstOperand.Type()   = O_IMM;
+  FrstOperand.Value()  = (Opcode1 & 0x06) << 3 | (Opcode2 & 0x0f);
 
   Operand& ScdOperand = rInsn.SecondOperand();
   ScdOperand.Type()   = O_REG8;
-  ScdOperand.Reg()    = ((Opcode1 & 0x02) << 3 | Opcode2 & 0x0f);
+  ScdOperand.Reg()    = (Opcode1 & 0x01) << 4 | Opcode2 >> 4;
 
   return true;
 }
 
+bool Avr8Architecture::Insn_Bld(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdBit(rBinStrm, Offset, rInsn, AVR8_Bld, "bld");
+}
+
+bool Avr8Architecture::Insn_Bst(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdBit(rBinStrm, Offset, rInsn, AVR8_Bst, "bst");
+}
+
+bool Avr8Architecture::Insn_Sbrc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdBit(rBinStrm, Offset, rInsn, AVR8_Sbrc, "sbrc");
+}
+
+bool Avr8Architecture::Insn_Sbrs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeRdBit(rBinStrm, Offset, rInsn, AVR8_Sbrs, "sbrs");
+}
+
+bool Avr8Architecture::Insn_Brlo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brlo, "brlo");
+}
+
+bool Avr8Architecture::Insn_Breq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Breq, "breq");
+}
+
+bool Avr8Architecture::Insn_Brmi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brmi, "brmi");
+}
+
+bool Avr8Architecture::Insn_Brvs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brvs, "brvs");
+}
+
+bool Avr8Architecture::Insn_Brlt(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brlt, "brlt");
+}
+
+bool Avr8Architecture::Insn_Brhs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brhs, "brhs");
+}
+
+bool Avr8Architecture::Insn_Brts(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brts, "brts");
+}
+
+bool Avr8Architecture::Insn_Brie(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brie, "brie");
+}
+
+bool Avr8Architecture::Insn_Brsh(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brsh, "brsh");
+}
+
+bool Avr8Architecture::Insn_Brne(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brne, "brne");
+}
+
+bool Avr8Architecture::Insn_Brpl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brpl, "brpl");
+}
+
+bool Avr8Architecture::Insn_Brvc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brvc, "brvc");
+}
+
+bool Avr8Architecture::Insn_Brge(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brge, "brge");
+}
+
+bool Avr8Architecture::Insn_Brhc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brhc, "brhc");
+}
+
+bool Avr8Architecture::Insn_Brtc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brtc, "brtc");
+}
+
+bool Avr8Architecture::Insn_Brid(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+{
+  return DecodeBranch(rBinStrm, Offset, rInsn, AVR8_Brid, "brid");
+}
+
 bool Avr8Architecture::Insn_Invalid(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("invalid");
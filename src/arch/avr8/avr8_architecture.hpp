@@ -30,7 +30,10 @@ public:
 
   virtual std::string GetName(void) const { return "Atmel AVR 8-bit"; }
   virtual bool        Translate(Address const& rVirtAddr, TOffset& rPhyslOff);
-  virtual bool        Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  virtual bool        Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode, u8 Flags);
+  // AVR8 instructions have no semantic yet, decoding is all Disassemble does whatever the flags
+  virtual bool        BuildSemantic(Instruction& rInsn) { return true; }
+  virtual size_t      DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, DecodedInstruction* pInsns, size_t InsnNo);
   virtual NamedModeVector GetModes(void) const
   {
     NamedModeVector Avr8Modes;
@@ -45,10 +48,19 @@ public:
   virtual MemoryContext* MakeMemoryContext(void) const { return nullptr; }
 
 private:
+  typedef bool (Avr8Architecture:: *TDisassembler)(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
+
   static char const *m_RegName[];
 
+  // Generated by script/avr8_arch.py, m_OpcodeMap gives the m_Handler index of each 16-bit opcode
+  static TDisassembler const m_Handler[0x68];
+  static u8            const m_OpcodeMap[0x10000];
+
   void FormatOperand(Operand& Op, TOffset Offset);
 
+  // Decodes one instruction without formatting its operands
+  bool Decode(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
+
   bool Insn_(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn); // DELETE WHEN FINISH
 
   // Handles one instruction
@@ -106,6 +118,7 @@ private:
   bool Insn_Eicall(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Eijmp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Elpm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
+  bool Insn_ElpmR0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Eor(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Fmul(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Fmuls(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
@@ -116,9 +129,11 @@ private:
   bool Insn_Inc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Jmp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Ldi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ldd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Lds(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Lpm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
+  bool Insn_LpmR0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Lsl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Lsr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Mov(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
@@ -160,28 +175,13 @@ private:
   bool Insn_Sleep(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Spm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Sts(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
+  bool Insn_Std(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_St(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Sub(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Subi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Swap(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Tst(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Wdr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-
-  // Handles multiple instructions
-  bool Insn_0xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_1xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_2xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_3xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_8xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_9xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_axxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_90xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_92xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_94xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_96xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_98xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_bxxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_fxxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
 };
 
 #endif
\ No newline at end of file
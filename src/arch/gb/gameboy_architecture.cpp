@@ -126,7 +126,7 @@ bool GameBoyArchitecture::Translate(Address const& rVirtAddr, TOffset& rPhysOff)
   return true;
 }
 
-bool GameBoyArchitecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)
+bool GameBoyArchitecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode, u8 Flags)
 {
   u8 Opcode;
   rBinStrm.Read(Offset, Opcode);
@@ -140,9 +140,119 @@ bool GameBoyArchitecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offs
   else
     Result = (this->*m_OpcodeMap[Opcode])(rBinStrm, Offset, rInsn);
 
+  if (Result && (Flags & DisasmSemantic))
+    Result = BuildSemantic(rInsn);
+
   return Result;
 }
 
+bool GameBoyArchitecture::BuildSemantic(Instruction& rInsn)
+{
+  // Semantic is already built
+  if (!rInsn.GetSemantic().empty())
+    return true;
+
+  switch (rInsn.GetOpcode())
+  {
+  case GB_Inc:  return Semantic_Inc(rInsn);
+  case GB_Dec:  return Semantic_Dec(rInsn);
+  case GB_Add:  return Semantic_Add(rInsn);
+  case GB_Sub:  return Semantic_Sub(rInsn);
+  case GB_Adc:  return Semantic_Adc(rInsn);
+  case GB_Sbc:  return Semantic_Sbc(rInsn);
+  case GB_And:  return Semantic_And(rInsn);
+  case GB_Or:   return Semantic_Or(rInsn);
+  case GB_Xor:  return Semantic_Xor(rInsn);
+  case GB_Bit:  return Semantic_Bit(rInsn);
+  case GB_Set:  return Semantic_Set(rInsn);
+  case GB_Res:  return Semantic_Res(rInsn);
+  case GB_Rl:   return Semantic_Rl(rInsn);
+  case GB_Rr:   return Semantic_Rr(rInsn);
+  case GB_Rlc:  return Semantic_Rlc(rInsn);
+  case GB_Rrc:  return Semantic_Rrc(rInsn);
+  case GB_Sla:  return Semantic_Sla(rInsn);
+  case GB_Sra:  return Semantic_Sra(rInsn);
+  case GB_Srl:  return Semantic_Srl(rInsn);
+  case GB_Swap: return Semantic_Swap(rInsn);
+  case GB_Cpl:  return Semantic_Cpl(rInsn);
+  case GB_Ccf:  return Semantic_Ccf(rInsn);
+  case GB_Cp:   return Semantic_Cp(rInsn);
+  case GB_Ld:   return Semantic_Ld(rInsn);
+  case GB_Ldi:  return Semantic_Ldi(rInsn);
+  case GB_Ldd:  return Semantic_Ldd(rInsn);
+  case GB_Ldh:  return Semantic_Ldh(rInsn);
+  case GB_Ldhl: return Semantic_Ldhl(rInsn);
+  case GB_Push: return Semantic_Push(rInsn);
+  case GB_Pop:  return Semantic_Pop(rInsn);
+  case GB_Jr:   return Semantic_Jr(rInsn);
+  case GB_Jp:   return Semantic_Jp(rInsn);
+  case GB_Call: return Semantic_Call(rInsn);
+  case GB_Rst:  return Semantic_Rst(rInsn);
+  case GB_Ret:  return Semantic_Ret(rInsn);
+  case GB_Reti: return Semantic_Reti(rInsn);
+
+  // This instruction has no semantic
+  default:      return true;
+  }
+}
+
+Expression* GameBoyArchitecture::MakeConditional(Instruction const& rInsn, Expression* pExpr)
+{
+  u32  Flag;
+  bool Equal;
+
+  switch (rInsn.GetSemanticId())
+  {
+  case GB_Cond_NotZero:  Flag = GB_FlZf; Equal = false; break;
+  case GB_Cond_Zero:     Flag = GB_FlZf; Equal = true;  break;
+  case GB_Cond_NotCarry: Flag = GB_FlCf; Equal = false; break;
+  case GB_Cond_Carry:    Flag = GB_FlCf; Equal = true;  break;
+  default:               return pExpr;
+  }
+
+  return new IfConditionExpression(
+    Equal == true ? ConditionExpression::CondEq : ConditionExpression::CondNe,
+    new IdentifierExpression(Flag, &m_CpuInfo),
+    new ConstantExpression(ConstantExpression::Const1Bit, 1),
+    pExpr);
+}
+
+size_t GameBoyArchitecture::DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, DecodedInstruction* pInsns, size_t InsnNo)
+{
+  TOffset EndOffset = Offset + Size;
+  if (EndOffset > rBinStrm.GetSize())
+    EndOffset = rBinStrm.GetSize();
+
+  Instruction Insn;
+  size_t DecodedNo = 0;
+
+  while (DecodedNo < InsnNo && Offset < EndOffset)
+  {
+    u8 Opcode;
+    if (!rBinStrm.Read(Offset, Opcode))
+      break;
+
+    Insn.Reset();
+    bool Result;
+    if (Opcode == 0xCB)
+    {
+      if (!rBinStrm.Read(Offset + 1, Opcode))
+        break;
+      Result = (this->*m_CbPrefix[Opcode])(rBinStrm, Offset + 1, Insn);
+    }
+    else
+      Result = (this->*m_OpcodeMap[Opcode])(rBinStrm, Offset, Insn);
+
+    if (!Result || Insn.GetLength() == 0 || Offset + Insn.GetLength() > EndOffset)
+      break;
+
+    pInsns[DecodedNo++].Load(Offset, Insn, Mode);
+    Offset += Insn.GetLength();
+  }
+
+  return DecodedNo;
+}
+
 u16 GameBoyArchitecture::GetRegisterByOpcode(u8 Opcode)
 {
   u8 Reg = Opcode & 0x7;
@@ -275,15 +385,6 @@ bool GameBoyArchitecture::Insn_Inc(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.SetFixedFlags(GB_FlNf);
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  auto pOprdExpr = FrstOperand.GetSemantic(&m_CpuInfo);
-  if (pOprdExpr != nullptr)
-  {
-    auto pExpr = new OperationExpression(OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(OperationExpression::OpAdd, pOprdExpr, new ConstantExpression(pOprdExpr->GetSizeInBit(), 1))
-    );
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -324,15 +425,6 @@ bool GameBoyArchitecture::Insn_Dec(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.SetClearedFlags(GB_FlNf);
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  auto pOprdExpr = FrstOperand.GetSemantic(&m_CpuInfo);
-  if (pOprdExpr != nullptr)
-  {
-    auto pExpr = new OperationExpression(OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(OperationExpression::OpSub, pOprdExpr, new ConstantExpression(pOprdExpr->GetSizeInBit(), 1))
-    );
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -412,23 +504,6 @@ bool GameBoyArchitecture::Insn_Add(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  if (Res == true)
-  {
-    auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
-    auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
-
-    if (pLeftOprd != nullptr && pRightOprd != nullptr)
-    {
-      auto pExpr = new OperationExpression(
-        OperationExpression::OpAff,
-        pLeftOprd->Clone(),
-          new OperationExpression(OperationExpression::OpAdd,
-            pLeftOprd,
-            pRightOprd
-          ));
-      rInsn.SetSemantic(pExpr);
-    }
-  }
 
   return Res;
 }
@@ -478,23 +553,6 @@ bool GameBoyArchitecture::Insn_Sub(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  if (Res == true)
-  {
-    auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
-    auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
-
-    if (pLeftOprd != nullptr && pRightOprd != nullptr)
-    {
-      auto pExpr = new OperationExpression(
-        OperationExpression::OpAff,
-        pLeftOprd->Clone(),
-          new OperationExpression(OperationExpression::OpSub,
-            pLeftOprd,
-            pRightOprd
-          ));
-      rInsn.SetSemantic(pExpr);
-    }
-  }
 
   return Res;
 }
@@ -545,25 +603,6 @@ bool GameBoyArchitecture::Insn_Adc(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  if (Res == true)
-  {
-    auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
-    auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
-
-    if (pLeftOprd != nullptr && pRightOprd != nullptr)
-    {
-      auto pExpr = new OperationExpression(
-        OperationExpression::OpAff,
-        pLeftOprd->Clone(),
-          new OperationExpression(OperationExpression::OpAdd,
-            pLeftOprd,
-            new OperationExpression(
-              OperationExpression::OpAdd,
-              pRightOprd,
-              new IdentifierExpression(GB_FlCf, &m_CpuInfo))));
-      rInsn.SetSemantic(pExpr);
-    }
-  }
 
   return Res;
 }
@@ -615,25 +654,6 @@ bool GameBoyArchitecture::Insn_Sbc(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  if (Res == true)
-  {
-    auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
-    auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
-
-    if (pLeftOprd != nullptr && pRightOprd != nullptr)
-    {
-      auto pExpr = new OperationExpression(
-        OperationExpression::OpAff,
-        pLeftOprd->Clone(),
-          new OperationExpression(OperationExpression::OpSub,
-            pLeftOprd,
-            new OperationExpression(
-              OperationExpression::OpSub,
-              pRightOprd,
-              new IdentifierExpression(GB_FlCf, &m_CpuInfo))));
-      rInsn.SetSemantic(pExpr);
-    }
-  }
 
   return Res;
 }
@@ -694,23 +714,6 @@ bool GameBoyArchitecture::Insn_And(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  if (Res == true)
-  {
-    auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
-    auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
-
-    if (pLeftOprd != nullptr && pRightOprd != nullptr)
-    {
-      auto pExpr = new OperationExpression(
-        OperationExpression::OpAff,
-        pLeftOprd->Clone(),
-          new OperationExpression(OperationExpression::OpAnd,
-            pLeftOprd,
-            pRightOprd
-          ));
-      rInsn.SetSemantic(pExpr);
-    }
-  }
 
   return Res;
 }
@@ -761,23 +764,6 @@ bool GameBoyArchitecture::Insn_Or(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  if (Res == true)
-  {
-    auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
-    auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
-
-    if (pLeftOprd != nullptr && pRightOprd != nullptr)
-    {
-      auto pExpr = new OperationExpression(
-        OperationExpression::OpAff,
-        pLeftOprd->Clone(),
-          new OperationExpression(OperationExpression::OpOr,
-            pLeftOprd,
-            pRightOprd
-          ));
-      rInsn.SetSemantic(pExpr);
-    }
-  }
 
   return Res;
 }
@@ -828,23 +814,6 @@ bool GameBoyArchitecture::Insn_Xor(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  if (Res == true)
-  {
-    auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
-    auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
-
-    if (pLeftOprd != nullptr && pRightOprd != nullptr)
-    {
-      auto pExpr = new OperationExpression(
-        OperationExpression::OpAff,
-        pLeftOprd->Clone(),
-          new OperationExpression(OperationExpression::OpXor,
-            pLeftOprd,
-            pRightOprd
-          ));
-      rInsn.SetSemantic(pExpr);
-    }
-  }
 
   return Res;
 }
@@ -874,23 +843,6 @@ bool GameBoyArchitecture::Insn_Bit(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  auto pOprdExpr = ScdOp.GetSemantic(&m_CpuInfo);
-
-  if (pOprdExpr != nullptr)
-  {
-    /* zf = ((op₀ >> op₁) & 1) */
-    auto pExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_FlZf, &m_CpuInfo),
-      new OperationExpression(
-        OperationExpression::OpAnd,
-        new OperationExpression(
-          OperationExpression::OpLls,
-          pOprdExpr,
-          new ConstantExpression(ConstantExpression::Const8Bit, FrstOp.GetValue())),
-        new ConstantExpression(0, 1)));
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -917,19 +869,6 @@ bool GameBoyArchitecture::Insn_Set(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  auto pOprdExpr = ScdOp.GetSemantic(&m_CpuInfo);
-  if (pOprdExpr != nullptr)
-  {
-    /* op₀ = op₀ | (1 << op₁) */
-    auto pExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(
-        OperationExpression::OpOr,
-        pOprdExpr,
-        new ConstantExpression(ConstantExpression::Const8Bit, 1 << FrstOp.GetValue())));
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -956,19 +895,6 @@ bool GameBoyArchitecture::Insn_Res(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  auto pOprdExpr = ScdOp.GetSemantic(&m_CpuInfo);
-  if (pOprdExpr != nullptr)
-  {
-    /* op₀ = op₀ & ((1 << op₁) ^ -1) */
-    auto pExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(
-        OperationExpression::OpAnd,
-        pOprdExpr,
-        new ConstantExpression(ConstantExpression::Const8Bit, ~(1 << FrstOp.GetValue()))));
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -997,23 +923,6 @@ bool GameBoyArchitecture::Insn_Rl(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
-
-  if (pOprdExpr != nullptr)
-  {
-    /* Op₀ = (Op₀ << 1) | cf */
-    auto pExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(
-        OperationExpression::OpOr,
-        new OperationExpression(
-          OperationExpression::OpLls,
-          pOprdExpr,
-          new ConstantExpression(ConstantExpression::Const8Bit, 1)),
-        new IdentifierExpression(GB_FlCf, &m_CpuInfo)));
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -1041,26 +950,6 @@ bool GameBoyArchitecture::Insn_Rr(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.SetClearedFlags(GB_FlNf | GB_FlHf);
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
-
-  if (pOprdExpr != nullptr)
-  {
-    /* Op₀ = (Op₀ >> 1) | (cf << 7) */
-    auto pExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(
-        OperationExpression::OpOr,
-        new OperationExpression(
-          OperationExpression::OpLrs,
-          pOprdExpr,
-          new ConstantExpression(ConstantExpression::Const8Bit, 1)),
-        new OperationExpression(
-          OperationExpression::OpLrs,
-          new IdentifierExpression(GB_FlCf, &m_CpuInfo),
-          new ConstantExpression(ConstantExpression::Const8Bit, 7))));
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -1088,38 +977,6 @@ bool GameBoyArchitecture::Insn_Rlc(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.SetClearedFlags(GB_FlNf | GB_FlHf);
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
-
-  if (pOprdExpr != nullptr)
-  {
-    /* cf = (Op₀ & 0x80) >> 7; Op₀ = (Op₀ << 1) | cf */
-    auto pExprCarry = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
-      new OperationExpression(
-        OperationExpression::OpLrs,
-        new OperationExpression(
-          OperationExpression::OpAnd,
-          pOprdExpr->Clone(),
-          new ConstantExpression(ConstantExpression::Const8Bit, 0x80)),
-        new ConstantExpression(ConstantExpression::Const8Bit, 7)));
-
-    auto pExprShift = new OperationExpression(
-      OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(
-        OperationExpression::OpOr,
-        new OperationExpression(
-          OperationExpression::OpLls,
-          pOprdExpr,
-          new ConstantExpression(ConstantExpression::Const8Bit, 1)),
-        new IdentifierExpression(GB_FlCf, &m_CpuInfo)));
-
-    Expression::List ExprList;
-    ExprList.push_back(pExprCarry);
-    ExprList.push_back(pExprShift);
-    rInsn.SetSemantic(ExprList);
-  }
 
   return true;
 }
@@ -1147,38 +1004,6 @@ bool GameBoyArchitecture::Insn_Rrc(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.SetClearedFlags(GB_FlNf | GB_FlHf);
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
-
-  if (pOprdExpr != nullptr)
-  {
-    /* cf = Op₀ & 0x01; Op₀ = (Op₀ >> 1) | (cf << 7) */
-    auto pExprCarry = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
-      new OperationExpression(
-        OperationExpression::OpAnd,
-        pOprdExpr->Clone(),
-        new ConstantExpression(ConstantExpression::Const8Bit, 1)));
-
-    auto pExprShift = new OperationExpression(
-      OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(
-        OperationExpression::OpOr,
-        new OperationExpression(
-          OperationExpression::OpLrs,
-          pOprdExpr,
-          new ConstantExpression(ConstantExpression::Const8Bit, 1)),
-        new OperationExpression(
-          OperationExpression::OpLls,
-          new IdentifierExpression(GB_FlCf, &m_CpuInfo),
-          new ConstantExpression(ConstantExpression::Const8Bit, 7))));
-
-    Expression::List ExprList;
-    ExprList.push_back(pExprCarry);
-    ExprList.push_back(pExprShift);
-    rInsn.SetSemantic(ExprList);
-  }
 
   return true;
 }
@@ -1206,32 +1031,6 @@ bool GameBoyArchitecture::Insn_Sla(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.SetClearedFlags(GB_FlNf | GB_FlHf);
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
-  if (pOprdExpr != nullptr)
-  {
-    auto pCarryExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
-      new OperationExpression(
-        OperationExpression::OpAnd,
-        new OperationExpression(
-          OperationExpression::OpLrs,
-          pOprdExpr->Clone(),
-          new ConstantExpression(ConstantExpression::Const8Bit, 7)),
-      new ConstantExpression(ConstantExpression::Const8Bit, 1)));
-    auto pShiftExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(
-        OperationExpression::OpLls,
-        pOprdExpr,
-        new ConstantExpression(0, 1)));
-
-    Expression::List ExprList;
-    ExprList.push_back(pCarryExpr);
-    ExprList.push_back(pShiftExpr);
-    rInsn.SetSemantic(ExprList);
-  }
 
   return true;
 }
@@ -1259,36 +1058,6 @@ bool GameBoyArchitecture::Insn_Sra(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.SetClearedFlags(GB_FlHf | GB_FlNf);
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
-  if (pOprdExpr != nullptr)
-  {
-    /* cf = Op₀ & 0x01; Op₀ = (Op₀ >> 1) | (Op₀ & 0x80) */
-    auto pCarryExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
-      new OperationExpression(
-        OperationExpression::OpAnd,
-        pOprdExpr->Clone(),
-        new ConstantExpression(ConstantExpression::Const8Bit, 1)));
-    auto pShiftExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(
-        OperationExpression::OpOr,
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            pOprdExpr->Clone(),
-            new ConstantExpression(ConstantExpression::Const8Bit, 1)),
-          new OperationExpression(
-          OperationExpression::OpAnd,
-            pOprdExpr,
-            new ConstantExpression(ConstantExpression::Const8Bit, 0x80))));
-    
-    Expression::List ExprList;
-    ExprList.push_back(pCarryExpr);
-    ExprList.push_back(pShiftExpr);
-    rInsn.SetSemantic(ExprList);
-  }
 
   return true;
 }
@@ -1317,47 +1086,6 @@ bool GameBoyArchitecture::Insn_Srl(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.SetClearedFlags(GB_FlNf | GB_FlHf);
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
-  if (pOprdExpr != nullptr)
-  {
-    auto pExprCf = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
-      new OperationExpression(
-      OperationExpression::OpAnd,
-      pOprdExpr->Clone(),
-      new ConstantExpression(0, 1)));
-
-    auto pShiftExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(
-        OperationExpression::OpLrs,
-        pOprdExpr->Clone(),
-        new ConstantExpression(0, 1)));
-
-    auto pExprZf = new IfElseConditionExpression(
-      /* If */
-      ConditionExpression::CondEq,
-      pOprdExpr,
-      new ConstantExpression(pOprdExpr->GetSizeInBit(), 0),
-      /* Then */
-      new OperationExpression(
-        OperationExpression::OpAff,
-        new IdentifierExpression(GB_FlZf, &m_CpuInfo),
-        new ConstantExpression(ConstantExpression::Const1Bit, 1)),
-      /* Else */
-      new OperationExpression(
-        OperationExpression::OpAff,
-        new IdentifierExpression(GB_FlZf, &m_CpuInfo),
-        new ConstantExpression(ConstantExpression::Const1Bit, 0)));
-
-    Expression::List ExprList;
-    ExprList.push_back(pExprCf);
-    ExprList.push_back(pShiftExpr);
-    ExprList.push_back(pExprZf);
-    rInsn.SetSemantic(ExprList);
-  }
 
   return true;
 }
@@ -1386,25 +1114,6 @@ bool GameBoyArchitecture::Insn_Swap(BinaryStream const& rBinStrm, TOffset Offset
   rInsn.SetClearedFlags(GB_FlNf | GB_FlHf | GB_FlCf);
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  // op = (op >> 4) | (op << 4)
-  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
-  if (pOprdExpr != nullptr)
-  {
-    auto pExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pOprdExpr->Clone(),
-      new OperationExpression(
-        OperationExpression::OpOr,
-        new OperationExpression(
-          OperationExpression::OpLls,
-          pOprdExpr->Clone(),
-          new ConstantExpression(ConstantExpression::Const8Bit, 4)),
-        new OperationExpression(
-          OperationExpression::OpLrs,
-          pOprdExpr,
-          new ConstantExpression(ConstantExpression::Const8Bit, 4))));
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -1417,16 +1126,6 @@ bool GameBoyArchitecture::Insn_Cpl(BinaryStream const& rBinStrm, TOffset Offset,
 
   rInsn.SetFixedFlags(GB_FlNf | GB_FlHf);
 
-  // ~A
-  auto pExpr = new OperationExpression(
-    OperationExpression::OpAff,
-    new IdentifierExpression(GB_RegA, &m_CpuInfo),
-    new OperationExpression(
-      OperationExpression::OpXor,
-      new IdentifierExpression(GB_RegA, &m_CpuInfo),
-      new ConstantExpression(ConstantExpression::Const8Bit, ~0)));
-  rInsn.SetSemantic(pExpr);
-
   return true;
 }
 
@@ -1439,15 +1138,6 @@ bool GameBoyArchitecture::Insn_Ccf(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.SetClearedFlags(GB_FlHf | GB_FlNf);
   rInsn.SetUpdatedFlags(GB_FlCf);
 
-  /* cf ^= 1 */
-  auto pExpr = new OperationExpression(
-    OperationExpression::OpAff,
-    new IdentifierExpression(GB_FlCf, &m_CpuInfo),
-    new OperationExpression(
-      OperationExpression::OpXor,
-      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
-      new ConstantExpression(ConstantExpression::Const1Bit, 1)));
-  rInsn.SetSemantic(pExpr);
   return true;
 }
 
@@ -1511,21 +1201,6 @@ bool GameBoyArchitecture::Insn_Cp(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  auto pFstOprdExpr = FrstOp.GetSemantic(&m_CpuInfo);
-  auto pScdOprdExpr = ScdOp.GetSemantic(&m_CpuInfo);
-
-  if (pFstOprdExpr != nullptr && pScdOprdExpr != nullptr)
-  {
-    auto pExpr = new IfConditionExpression(
-      ConditionExpression::CondEq,
-      pFstOprdExpr,
-      pScdOprdExpr,
-      new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
-      new ConstantExpression(ConstantExpression::Const1Bit, 1)));
-    rInsn.SetSemantic(pExpr);
-  }
 
   return Res;
 }
@@ -1709,17 +1384,6 @@ bool GameBoyArchitecture::Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  auto pLeftOprd  = FstOp.GetSemantic(&m_CpuInfo);
-  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
-
-  if (pLeftOprd != nullptr && pRightOprd != nullptr)
-  {
-    auto pExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pLeftOprd,
-      pRightOprd);
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -1759,34 +1423,6 @@ bool GameBoyArchitecture::Insn_Ldi(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
-  auto pRightOprd = dynamic_cast<MemoryExpression *>(ScdOp.GetSemantic(&m_CpuInfo));
-
-  if (pRightOprd != nullptr)
-  {
-    auto pRightOprdAddr = pRightOprd->GetAddressExpression();
-
-    if (pLeftOprd != nullptr && pRightOprd != nullptr && pRightOprdAddr != nullptr)
-    {
-      auto pExpr = new OperationExpression(
-        OperationExpression::OpAff,
-        pLeftOprd,
-        pRightOprd);
-
-      auto pIncExpr = new OperationExpression(
-        OperationExpression::OpAff,
-        pRightOprdAddr->Clone(),
-        new OperationExpression(
-        OperationExpression::OpAdd,
-        pRightOprdAddr->Clone(),
-        new ConstantExpression(pRightOprdAddr->GetSizeInBit(), 1)));
-
-      Expression::List ExprList;
-      ExprList.push_back(pExpr);
-      ExprList.push_back(pIncExpr);
-      rInsn.SetSemantic(ExprList);
-    }
-  }
 
   return true;
 }
@@ -1826,32 +1462,6 @@ bool GameBoyArchitecture::Insn_Ldd(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
-  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
-  auto pRightOprdAddr = dynamic_cast<MemoryExpression const *>(pRightOprd);
-
-  if (pLeftOprd != nullptr && pRightOprd != nullptr && pRightOprdAddr != nullptr)
-  {
-    auto pExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pLeftOprd,
-      pRightOprd);
-
-    auto pIncExpr = new OperationExpression(
-      OperationExpression::OpSub,
-      pRightOprdAddr->Clone(),
-      new ConstantExpression(pRightOprdAddr->GetSizeInBit(), 1));
-
-    Expression::List ExprList;
-    ExprList.push_back(pExpr);
-    ExprList.push_back(pIncExpr);
-    rInsn.SetSemantic(ExprList);
-  }
-  else
-  {
-    delete pLeftOprd;
-    delete pRightOprd;
-  }
 
   return true;
 }
@@ -1908,17 +1518,6 @@ bool GameBoyArchitecture::Insn_Ldh(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
-  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
-  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
-
-  if (pLeftOprd != nullptr && pRightOprd != nullptr)
-  {
-    auto pExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pLeftOprd,
-      pRightOprd);
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -1941,21 +1540,6 @@ bool GameBoyArchitecture::Insn_Ldhl(BinaryStream const& rBinStrm, TOffset Offset
   FormatOperand(rInsn.FirstOperand(),  Offset);
   FormatOperand(rInsn.SecondOperand(), Offset);
   FormatOperand(rInsn.ThirdOperand(),  Offset);
-  auto pLeftOprd  = rInsn.FirstOperand().GetSemantic(&m_CpuInfo);
-  auto pRightOprd = rInsn.SecondOperand().GetSemantic(&m_CpuInfo);
-  auto pImmOprd   = rInsn.ThirdOperand().GetSemantic(&m_CpuInfo);
-
-  if (pLeftOprd != nullptr && pRightOprd != nullptr)
-  {
-    auto pExpr = new OperationExpression(
-      OperationExpression::OpAff,
-      pLeftOprd,
-      new OperationExpression(
-        OperationExpression::OpAdd,
-        pRightOprd,
-        pImmOprd));
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -1984,27 +1568,6 @@ bool GameBoyArchitecture::Insn_Push(BinaryStream const& rBinStrm, TOffset Offset
   rInsn.FirstOperand().Type() = O_REG;
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  auto pExprOprd = rInsn.FirstOperand().GetSemantic(&m_CpuInfo);
-  if (pExprOprd != nullptr)
-  {
-    auto pAllocStack = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-      new OperationExpression(
-        OperationExpression::OpSub,
-        new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-        new ConstantExpression(ConstantExpression::Const16Bit, 2)));
-
-    auto pStoreStack = new OperationExpression(
-      OperationExpression::OpAff,
-      new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)),
-      pExprOprd);
-
-    Expression::List ExprList;
-    ExprList.push_back(pAllocStack);
-    ExprList.push_back(pStoreStack);
-    rInsn.SetSemantic(ExprList);
-  }
 
   return true;
 }
@@ -2033,27 +1596,6 @@ bool GameBoyArchitecture::Insn_Pop(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.FirstOperand().Type() = O_REG;
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  auto pOprdExpr = rInsn.FirstOperand().GetSemantic(&m_CpuInfo);
-  if (pOprdExpr != nullptr)
-  {
-    auto pStoreOprd = new OperationExpression(
-      OperationExpression::OpAff,
-      pOprdExpr,
-      new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)));
-
-    auto pFreeStack = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-      new OperationExpression(
-        OperationExpression::OpAdd,
-        new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-        new ConstantExpression(ConstantExpression::Const16Bit, 2)));
-
-    Expression::List ExprList;
-    ExprList.push_back(pStoreOprd);
-    ExprList.push_back(pFreeStack);
-    rInsn.SetSemantic(ExprList);
-  }
 
   return true;
 }
@@ -2072,36 +1614,17 @@ bool GameBoyArchitecture::Insn_Jr(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.FirstOperand().Type() = O_REL;
   rInsn.FirstOperand().Value() = Relative;
 
-  u32 Flags = 0;
-  bool Equal = true;
-
   switch (Opcode)
   {
-  case 0x18:                                                                               rInsn.SetName("jr");    break;
-  case 0x20: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlZf; Equal = false; rInsn.SetName("jr nz"); break;
-  case 0x28: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlZf;                rInsn.SetName("jr z");  break;
-  case 0x30: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlCf; Equal = false; rInsn.SetName("jr nc"); break;
-  case 0x38: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlCf;                rInsn.SetName("jr c");  break;
+  case 0x18:                                                                                        rInsn.SetName("jr");    break;
+  case 0x20: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_NotZero); rInsn.SetName("jr nz"); break;
+  case 0x28: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_Zero);    rInsn.SetName("jr z");  break;
+  case 0x30: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_NotCarry); rInsn.SetName("jr nc"); break;
+  case 0x38: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_Carry);   rInsn.SetName("jr c");  break;
   default: return false;
   }
 
   FormatOperand(rInsn.FirstOperand(), Offset);
-  auto pOprdExpr = rInsn.FirstOperand().GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()));
-  if (pOprdExpr != nullptr)
-  {
-    Expression *pExpr = new OperationExpression(OperationExpression::OpAff,
-      new IdentifierExpression(GB_RegPc, &m_CpuInfo),
-      pOprdExpr);
-
-    if (Flags != 0)
-      pExpr = new IfConditionExpression(
-        Equal == true ? ConditionExpression::CondEq : ConditionExpression::CondNe,
-        new IdentifierExpression(Flags, &m_CpuInfo),
-        new ConstantExpression(ConstantExpression::Const1Bit, 1),
-        pExpr);
-
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -2131,36 +1654,17 @@ bool GameBoyArchitecture::Insn_Jp(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.FirstOperand().Type()  = O_ABS16;
   rInsn.FirstOperand().Value() = Absolute;
 
-  u32 Flags = 0;
-  bool Equal = true;
-
   switch (Opcode)
   {
-  case 0xC3:                                                                                  rInsn.SetName("jp");    break;
-  case 0xC2: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlZf; Equal = false; rInsn.SetName("jp nz"); break;
-  case 0xCA: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlZf;                rInsn.SetName("jp z");  break;
-  case 0xD2: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlCf; Equal = false; rInsn.SetName("jp nc"); break;
-  case 0xDA: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlCf;                rInsn.SetName("jp c");  break;
+  case 0xC3:                                                                                        rInsn.SetName("jp");    break;
+  case 0xC2: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_NotZero); rInsn.SetName("jp nz"); break;
+  case 0xCA: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_Zero);    rInsn.SetName("jp z");  break;
+  case 0xD2: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_NotCarry); rInsn.SetName("jp nc"); break;
+  case 0xDA: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_Carry);   rInsn.SetName("jp c");  break;
   default: return false;
   }
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  auto pOprdExpr = rInsn.FirstOperand().GetSemantic(&m_CpuInfo);
-  if (pOprdExpr)
-  {
-    Expression *pExpr = new OperationExpression(OperationExpression::OpAff,
-      new IdentifierExpression(GB_RegPc, &m_CpuInfo),
-      pOprdExpr);
-
-    if (Flags != 0)
-      pExpr = new IfConditionExpression(
-        Equal == true ? ConditionExpression::CondEq : ConditionExpression::CondNe,
-        new IdentifierExpression(Flags, &m_CpuInfo),
-        new ConstantExpression(ConstantExpression::Const1Bit, 1),
-        pExpr);
-
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -2180,61 +1684,20 @@ bool GameBoyArchitecture::Insn_Call(BinaryStream const& rBinStrm, TOffset Offset
   rInsn.FirstOperand().Value() = Absolute;
 
   u32  Flags = 0;
-  bool Equal = true;
 
   switch (Opcode)
   {
-  case 0xCD:                                                                               rInsn.SetName("call");    break;
-  case 0xC4: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlZf; Equal = false; rInsn.SetName("call nz"); break;
-  case 0xCC: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlZf;                rInsn.SetName("call z");  break;
-  case 0xD4: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlCf; Equal = false; rInsn.SetName("call nc"); break;
-  case 0xDC: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlCf;                rInsn.SetName("call c");  break;
+  case 0xCD:                                                                                                         rInsn.SetName("call");    break;
+  case 0xC4: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlZf; rInsn.SetSemanticId(GB_Cond_NotZero); rInsn.SetName("call nz"); break;
+  case 0xCC: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlZf; rInsn.SetSemanticId(GB_Cond_Zero);    rInsn.SetName("call z");  break;
+  case 0xD4: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlCf; rInsn.SetSemanticId(GB_Cond_NotCarry); rInsn.SetName("call nc"); break;
+  case 0xDC: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlCf; rInsn.SetSemanticId(GB_Cond_Carry);   rInsn.SetName("call c");  break;
   default: return false;
   }
 
   rInsn.SetUpdatedFlags(Flags);
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
-  /* CALL → sp -= 2 ; ld (sp), pc + insn_len ; pc = oprd */
-  auto pOprdExpr = rInsn.FirstOperand().GetSemantic(&m_CpuInfo);
-  if (pOprdExpr != nullptr)
-  {
-    auto pExprAllocStack = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-      new OperationExpression(
-        OperationExpression::OpSub,
-        new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-        new ConstantExpression(ConstantExpression::Const16Bit, 2)));
-
-    auto pExprStoreStack = new OperationExpression(
-      OperationExpression::OpAff,
-      new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)),
-      new OperationExpression(
-        OperationExpression::OpAdd,
-        new IdentifierExpression(GB_RegPc, &m_CpuInfo),
-        new ConstantExpression(ConstantExpression::Const16Bit, rInsn.GetLength())));
-
-    auto pExprJmp = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_RegPc, &m_CpuInfo),
-      pOprdExpr);
-
-    Expression::List ExprList;
-    ExprList.push_back(pExprAllocStack);
-    ExprList.push_back(pExprStoreStack);
-    ExprList.push_back(pExprJmp);
-    Expression *pExpr = new BindExpression(ExprList);
-
-    if (Flags != 0)
-      pExpr = new IfConditionExpression(
-        Equal == true ? ConditionExpression::CondEq : ConditionExpression::CondNe,
-        new IdentifierExpression(Flags, &m_CpuInfo),
-        new ConstantExpression(ConstantExpression::Const1Bit, 1),
-        pExpr);
-
-    rInsn.SetSemantic(pExpr);
-  }
 
   return true;
 }
@@ -2253,33 +1716,6 @@ bool GameBoyArchitecture::Insn_Rst(BinaryStream const& rBinStrm, TOffset Offset,
 
   FormatOperand(rInsn.FirstOperand(),  Offset);
 
-    auto pExprAllocStack = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-      new OperationExpression(
-        OperationExpression::OpSub,
-        new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-        new ConstantExpression(ConstantExpression::Const16Bit, 2)));
-
-    auto pExprStoreStack = new OperationExpression(
-      OperationExpression::OpAff,
-      new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)),
-      new OperationExpression(
-        OperationExpression::OpAdd,
-        new IdentifierExpression(GB_RegPc, &m_CpuInfo),
-        new ConstantExpression(ConstantExpression::Const16Bit, rInsn.GetLength())));
-
-    auto pExprJmp = new OperationExpression(
-      OperationExpression::OpAff,
-      new IdentifierExpression(GB_RegPc, &m_CpuInfo),
-      new ConstantExpression(ConstantExpression::Const16Bit, rInsn.FirstOperand().GetValue()));
-
-    Expression::List ExprList;
-    ExprList.push_back(pExprAllocStack);
-    ExprList.push_back(pExprStoreStack);
-    ExprList.push_back(pExprJmp);
-    rInsn.SetSemantic(ExprList);
-
   return true;
 }
 
@@ -2292,46 +1728,16 @@ bool GameBoyArchitecture::Insn_Ret(BinaryStream const& rBinStrm, TOffset Offset,
   u8 Opcode;
   rBinStrm.Read(Offset, Opcode);
 
-  u32 Flags = 0;
-  bool Equal = true;
-
   switch (Opcode)
   {
-  case 0xC9:                                                                               rInsn.SetName("ret");    break;
-  case 0xC0: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlZf; Equal = false; rInsn.SetName("ret nz"); break;
-  case 0xC8: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlZf;                rInsn.SetName("ret z");  break;
-  case 0xD0: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlCf; Equal = false; rInsn.SetName("ret nc"); break;
-  case 0xD8: rInsn.SubType() |= Instruction::ConditionalType; Flags = GB_FlCf;                rInsn.SetName("ret c");  break;
+  case 0xC9:                                                                                        rInsn.SetName("ret");    break;
+  case 0xC0: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_NotZero); rInsn.SetName("ret nz"); break;
+  case 0xC8: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_Zero);    rInsn.SetName("ret z");  break;
+  case 0xD0: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_NotCarry); rInsn.SetName("ret nc"); break;
+  case 0xD8: rInsn.SubType() |= Instruction::ConditionalType; rInsn.SetSemanticId(GB_Cond_Carry);   rInsn.SetName("ret c");  break;
   default: return false;
   }
 
-  auto pLoadStack = new OperationExpression(
-    OperationExpression::OpAff,
-    new IdentifierExpression(GB_RegPc, &m_CpuInfo),
-    new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)));
-
-  auto pFreeStack = new OperationExpression(
-    OperationExpression::OpAff,
-    new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-    new OperationExpression(
-      OperationExpression::OpAdd,
-      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-      new ConstantExpression(ConstantExpression::Const16Bit, 2)));
-
-  Expression::List ExprList;
-  ExprList.push_back(pLoadStack);
-  ExprList.push_back(pFreeStack);
-  Expression *pExpr = new BindExpression(ExprList);
-
-  if (Flags != 0)
-    pExpr = new IfConditionExpression(
-    Equal == true ? ConditionExpression::CondEq : ConditionExpression::CondNe,
-    new IdentifierExpression(Flags, &m_CpuInfo),
-    new ConstantExpression(ConstantExpression::Const1Bit, 1),
-    pExpr);
-
-  rInsn.SetSemantic(pExpr);
-
   return true;
 }
 
@@ -2342,24 +1748,6 @@ bool GameBoyArchitecture::Insn_Reti(BinaryStream const& rBinStrm, TOffset Offset
   rInsn.Length()        = 1;
   rInsn.SubType() = Instruction::ReturnType;
 
-  auto pLoadStack = new OperationExpression(
-    OperationExpression::OpAff,
-    new IdentifierExpression(GB_RegPc, &m_CpuInfo),
-    new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)));
-
-  auto pFreeStack = new OperationExpression(
-    OperationExpression::OpAff,
-    new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-    new OperationExpression(
-      OperationExpression::OpAdd,
-      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
-      new ConstantExpression(ConstantExpression::Const16Bit, 2)));
-
-  Expression::List ExprList;
-  ExprList.push_back(pLoadStack);
-  ExprList.push_back(pFreeStack);
-  rInsn.SetSemantic(ExprList);
-
   return true;
 }
 
@@ -2398,3 +1786,951 @@ bool GameBoyArchitecture::Insn_Di(BinaryStream const& rBinStrm, TOffset Offset,
 
   return true;
 }
+
+bool GameBoyArchitecture::Semantic_Inc(Instruction& rInsn)
+{
+  Operand& FrstOperand = rInsn.FirstOperand();
+
+  auto pOprdExpr = FrstOperand.GetSemantic(&m_CpuInfo);
+  if (pOprdExpr != nullptr)
+  {
+    auto pExpr = new OperationExpression(OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(OperationExpression::OpAdd, pOprdExpr, new ConstantExpression(pOprdExpr->GetSizeInBit(), 1))
+    );
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Dec(Instruction& rInsn)
+{
+  Operand& FrstOperand = rInsn.FirstOperand();
+
+  auto pOprdExpr = FrstOperand.GetSemantic(&m_CpuInfo);
+  if (pOprdExpr != nullptr)
+  {
+    auto pExpr = new OperationExpression(OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(OperationExpression::OpSub, pOprdExpr, new ConstantExpression(pOprdExpr->GetSizeInBit(), 1))
+    );
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Add(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
+
+  if (pLeftOprd != nullptr && pRightOprd != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pLeftOprd->Clone(),
+        new OperationExpression(OperationExpression::OpAdd,
+          pLeftOprd,
+          pRightOprd
+        ));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Sub(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
+
+  if (pLeftOprd != nullptr && pRightOprd != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pLeftOprd->Clone(),
+        new OperationExpression(OperationExpression::OpSub,
+          pLeftOprd,
+          pRightOprd
+        ));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Adc(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
+
+  if (pLeftOprd != nullptr && pRightOprd != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pLeftOprd->Clone(),
+        new OperationExpression(OperationExpression::OpAdd,
+          pLeftOprd,
+          new OperationExpression(
+            OperationExpression::OpAdd,
+            pRightOprd,
+            new IdentifierExpression(GB_FlCf, &m_CpuInfo))));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Sbc(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
+
+  if (pLeftOprd != nullptr && pRightOprd != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pLeftOprd->Clone(),
+        new OperationExpression(OperationExpression::OpSub,
+          pLeftOprd,
+          new OperationExpression(
+            OperationExpression::OpSub,
+            pRightOprd,
+            new IdentifierExpression(GB_FlCf, &m_CpuInfo))));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_And(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
+
+  if (pLeftOprd != nullptr && pRightOprd != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pLeftOprd->Clone(),
+        new OperationExpression(OperationExpression::OpAnd,
+          pLeftOprd,
+          pRightOprd
+        ));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Or(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
+
+  if (pLeftOprd != nullptr && pRightOprd != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pLeftOprd->Clone(),
+        new OperationExpression(OperationExpression::OpOr,
+          pLeftOprd,
+          pRightOprd
+        ));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Xor(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
+
+  if (pLeftOprd != nullptr && pRightOprd != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pLeftOprd->Clone(),
+        new OperationExpression(OperationExpression::OpXor,
+          pLeftOprd,
+          pRightOprd
+        ));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Bit(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pOprdExpr = ScdOp.GetSemantic(&m_CpuInfo);
+
+  if (pOprdExpr != nullptr)
+  {
+    /* zf = ((op₀ >> op₁) & 1) */
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      new IdentifierExpression(GB_FlZf, &m_CpuInfo),
+      new OperationExpression(
+        OperationExpression::OpAnd,
+        new OperationExpression(
+          OperationExpression::OpLls,
+          pOprdExpr,
+          new ConstantExpression(ConstantExpression::Const8Bit, FrstOp.GetValue())),
+        new ConstantExpression(0, 1)));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Set(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pOprdExpr = ScdOp.GetSemantic(&m_CpuInfo);
+  if (pOprdExpr != nullptr)
+  {
+    /* op₀ = op₀ | (1 << op₁) */
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(
+        OperationExpression::OpOr,
+        pOprdExpr,
+        new ConstantExpression(ConstantExpression::Const8Bit, 1 << FrstOp.GetValue())));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Res(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pOprdExpr = ScdOp.GetSemantic(&m_CpuInfo);
+  if (pOprdExpr != nullptr)
+  {
+    /* op₀ = op₀ & ((1 << op₁) ^ -1) */
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(
+        OperationExpression::OpAnd,
+        pOprdExpr,
+        new ConstantExpression(ConstantExpression::Const8Bit, ~(1 << FrstOp.GetValue()))));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Rl(Instruction& rInsn)
+{
+  Operand& Op    = rInsn.FirstOperand();
+
+  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
+
+  if (pOprdExpr != nullptr)
+  {
+    /* Op₀ = (Op₀ << 1) | cf */
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(
+        OperationExpression::OpOr,
+        new OperationExpression(
+          OperationExpression::OpLls,
+          pOprdExpr,
+          new ConstantExpression(ConstantExpression::Const8Bit, 1)),
+        new IdentifierExpression(GB_FlCf, &m_CpuInfo)));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Rr(Instruction& rInsn)
+{
+  Operand& Op    = rInsn.FirstOperand();
+
+  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
+
+  if (pOprdExpr != nullptr)
+  {
+    /* Op₀ = (Op₀ >> 1) | (cf << 7) */
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(
+        OperationExpression::OpOr,
+        new OperationExpression(
+          OperationExpression::OpLrs,
+          pOprdExpr,
+          new ConstantExpression(ConstantExpression::Const8Bit, 1)),
+        new OperationExpression(
+          OperationExpression::OpLrs,
+          new IdentifierExpression(GB_FlCf, &m_CpuInfo),
+          new ConstantExpression(ConstantExpression::Const8Bit, 7))));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Rlc(Instruction& rInsn)
+{
+  Operand& Op    = rInsn.FirstOperand();
+
+  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
+
+  if (pOprdExpr != nullptr)
+  {
+    /* cf = (Op₀ & 0x80) >> 7; Op₀ = (Op₀ << 1) | cf */
+    auto pExprCarry = new OperationExpression(
+      OperationExpression::OpAff,
+      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
+      new OperationExpression(
+        OperationExpression::OpLrs,
+        new OperationExpression(
+          OperationExpression::OpAnd,
+          pOprdExpr->Clone(),
+          new ConstantExpression(ConstantExpression::Const8Bit, 0x80)),
+        new ConstantExpression(ConstantExpression::Const8Bit, 7)));
+
+    auto pExprShift = new OperationExpression(
+      OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(
+        OperationExpression::OpOr,
+        new OperationExpression(
+          OperationExpression::OpLls,
+          pOprdExpr,
+          new ConstantExpression(ConstantExpression::Const8Bit, 1)),
+        new IdentifierExpression(GB_FlCf, &m_CpuInfo)));
+
+    Expression::List ExprList;
+    ExprList.push_back(pExprCarry);
+    ExprList.push_back(pExprShift);
+    rInsn.SetSemantic(ExprList);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Rrc(Instruction& rInsn)
+{
+  Operand& Op    = rInsn.FirstOperand();
+
+  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
+
+  if (pOprdExpr != nullptr)
+  {
+    /* cf = Op₀ & 0x01; Op₀ = (Op₀ >> 1) | (cf << 7) */
+    auto pExprCarry = new OperationExpression(
+      OperationExpression::OpAff,
+      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
+      new OperationExpression(
+        OperationExpression::OpAnd,
+        pOprdExpr->Clone(),
+        new ConstantExpression(ConstantExpression::Const8Bit, 1)));
+
+    auto pExprShift = new OperationExpression(
+      OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(
+        OperationExpression::OpOr,
+        new OperationExpression(
+          OperationExpression::OpLrs,
+          pOprdExpr,
+          new ConstantExpression(ConstantExpression::Const8Bit, 1)),
+        new OperationExpression(
+          OperationExpression::OpLls,
+          new IdentifierExpression(GB_FlCf, &m_CpuInfo),
+          new ConstantExpression(ConstantExpression::Const8Bit, 7))));
+
+    Expression::List ExprList;
+    ExprList.push_back(pExprCarry);
+    ExprList.push_back(pExprShift);
+    rInsn.SetSemantic(ExprList);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Sla(Instruction& rInsn)
+{
+  Operand& Op    = rInsn.FirstOperand();
+
+  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
+  if (pOprdExpr != nullptr)
+  {
+    auto pCarryExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
+      new OperationExpression(
+        OperationExpression::OpAnd,
+        new OperationExpression(
+          OperationExpression::OpLrs,
+          pOprdExpr->Clone(),
+          new ConstantExpression(ConstantExpression::Const8Bit, 7)),
+      new ConstantExpression(ConstantExpression::Const8Bit, 1)));
+    auto pShiftExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(
+        OperationExpression::OpLls,
+        pOprdExpr,
+        new ConstantExpression(0, 1)));
+
+    Expression::List ExprList;
+    ExprList.push_back(pCarryExpr);
+    ExprList.push_back(pShiftExpr);
+    rInsn.SetSemantic(ExprList);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Sra(Instruction& rInsn)
+{
+  Operand& Op    = rInsn.FirstOperand();
+
+  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
+  if (pOprdExpr != nullptr)
+  {
+    /* cf = Op₀ & 0x01; Op₀ = (Op₀ >> 1) | (Op₀ & 0x80) */
+    auto pCarryExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
+      new OperationExpression(
+        OperationExpression::OpAnd,
+        pOprdExpr->Clone(),
+        new ConstantExpression(ConstantExpression::Const8Bit, 1)));
+    auto pShiftExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(
+        OperationExpression::OpOr,
+          new OperationExpression(
+            OperationExpression::OpLrs,
+            pOprdExpr->Clone(),
+            new ConstantExpression(ConstantExpression::Const8Bit, 1)),
+          new OperationExpression(
+          OperationExpression::OpAnd,
+            pOprdExpr,
+            new ConstantExpression(ConstantExpression::Const8Bit, 0x80))));
+    
+    Expression::List ExprList;
+    ExprList.push_back(pCarryExpr);
+    ExprList.push_back(pShiftExpr);
+    rInsn.SetSemantic(ExprList);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Srl(Instruction& rInsn)
+{
+  Operand& Op    = rInsn.FirstOperand();
+
+  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
+  if (pOprdExpr != nullptr)
+  {
+    auto pExprCf = new OperationExpression(
+      OperationExpression::OpAff,
+      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
+      new OperationExpression(
+      OperationExpression::OpAnd,
+      pOprdExpr->Clone(),
+      new ConstantExpression(0, 1)));
+
+    auto pShiftExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(
+        OperationExpression::OpLrs,
+        pOprdExpr->Clone(),
+        new ConstantExpression(0, 1)));
+
+    auto pExprZf = new IfElseConditionExpression(
+      /* If */
+      ConditionExpression::CondEq,
+      pOprdExpr,
+      new ConstantExpression(pOprdExpr->GetSizeInBit(), 0),
+      /* Then */
+      new OperationExpression(
+        OperationExpression::OpAff,
+        new IdentifierExpression(GB_FlZf, &m_CpuInfo),
+        new ConstantExpression(ConstantExpression::Const1Bit, 1)),
+      /* Else */
+      new OperationExpression(
+        OperationExpression::OpAff,
+        new IdentifierExpression(GB_FlZf, &m_CpuInfo),
+        new ConstantExpression(ConstantExpression::Const1Bit, 0)));
+
+    Expression::List ExprList;
+    ExprList.push_back(pExprCf);
+    ExprList.push_back(pShiftExpr);
+    ExprList.push_back(pExprZf);
+    rInsn.SetSemantic(ExprList);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Swap(Instruction& rInsn)
+{
+  Operand& Op    = rInsn.FirstOperand();
+
+  // op = (op >> 4) | (op << 4)
+  auto pOprdExpr = Op.GetSemantic(&m_CpuInfo);
+  if (pOprdExpr != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pOprdExpr->Clone(),
+      new OperationExpression(
+        OperationExpression::OpOr,
+        new OperationExpression(
+          OperationExpression::OpLls,
+          pOprdExpr->Clone(),
+          new ConstantExpression(ConstantExpression::Const8Bit, 4)),
+        new OperationExpression(
+          OperationExpression::OpLrs,
+          pOprdExpr,
+          new ConstantExpression(ConstantExpression::Const8Bit, 4))));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Cpl(Instruction& rInsn)
+{
+  // ~A
+  auto pExpr = new OperationExpression(
+    OperationExpression::OpAff,
+    new IdentifierExpression(GB_RegA, &m_CpuInfo),
+    new OperationExpression(
+      OperationExpression::OpXor,
+      new IdentifierExpression(GB_RegA, &m_CpuInfo),
+      new ConstantExpression(ConstantExpression::Const8Bit, ~0)));
+  rInsn.SetSemantic(pExpr);
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Ccf(Instruction& rInsn)
+{
+  /* cf ^= 1 */
+  auto pExpr = new OperationExpression(
+    OperationExpression::OpAff,
+    new IdentifierExpression(GB_FlCf, &m_CpuInfo),
+    new OperationExpression(
+      OperationExpression::OpXor,
+      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
+      new ConstantExpression(ConstantExpression::Const1Bit, 1)));
+  rInsn.SetSemantic(pExpr);
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Cp(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pFstOprdExpr = FrstOp.GetSemantic(&m_CpuInfo);
+  auto pScdOprdExpr = ScdOp.GetSemantic(&m_CpuInfo);
+
+  if (pFstOprdExpr != nullptr && pScdOprdExpr != nullptr)
+  {
+    auto pExpr = new IfConditionExpression(
+      ConditionExpression::CondEq,
+      pFstOprdExpr,
+      pScdOprdExpr,
+      new OperationExpression(
+      OperationExpression::OpAff,
+      new IdentifierExpression(GB_FlCf, &m_CpuInfo),
+      new ConstantExpression(ConstantExpression::Const1Bit, 1)));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Ld(Instruction& rInsn)
+{
+  Operand& FstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pLeftOprd  = FstOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
+
+  if (pLeftOprd != nullptr && pRightOprd != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pLeftOprd,
+      pRightOprd);
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Ldi(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprd = dynamic_cast<MemoryExpression *>(ScdOp.GetSemantic(&m_CpuInfo));
+
+  if (pRightOprd != nullptr)
+  {
+    auto pRightOprdAddr = pRightOprd->GetAddressExpression();
+
+    if (pLeftOprd != nullptr && pRightOprd != nullptr && pRightOprdAddr != nullptr)
+    {
+      auto pExpr = new OperationExpression(
+        OperationExpression::OpAff,
+        pLeftOprd,
+        pRightOprd);
+
+      auto pIncExpr = new OperationExpression(
+        OperationExpression::OpAff,
+        pRightOprdAddr->Clone(),
+        new OperationExpression(
+        OperationExpression::OpAdd,
+        pRightOprdAddr->Clone(),
+        new ConstantExpression(pRightOprdAddr->GetSizeInBit(), 1)));
+
+      Expression::List ExprList;
+      ExprList.push_back(pExpr);
+      ExprList.push_back(pIncExpr);
+      rInsn.SetSemantic(ExprList);
+    }
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Ldd(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprdAddr = dynamic_cast<MemoryExpression const *>(pRightOprd);
+
+  if (pLeftOprd != nullptr && pRightOprd != nullptr && pRightOprdAddr != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pLeftOprd,
+      pRightOprd);
+
+    auto pIncExpr = new OperationExpression(
+      OperationExpression::OpSub,
+      pRightOprdAddr->Clone(),
+      new ConstantExpression(pRightOprdAddr->GetSizeInBit(), 1));
+
+    Expression::List ExprList;
+    ExprList.push_back(pExpr);
+    ExprList.push_back(pIncExpr);
+    rInsn.SetSemantic(ExprList);
+  }
+  else
+  {
+    delete pLeftOprd;
+    delete pRightOprd;
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Ldh(Instruction& rInsn)
+{
+  Operand& FrstOp = rInsn.FirstOperand();
+  Operand& ScdOp  = rInsn.SecondOperand();
+
+  auto pLeftOprd  = FrstOp.GetSemantic(&m_CpuInfo);
+  auto pRightOprd = ScdOp.GetSemantic(&m_CpuInfo);
+
+  if (pLeftOprd != nullptr && pRightOprd != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pLeftOprd,
+      pRightOprd);
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Ldhl(Instruction& rInsn)
+{
+  auto pLeftOprd  = rInsn.FirstOperand().GetSemantic(&m_CpuInfo);
+  auto pRightOprd = rInsn.SecondOperand().GetSemantic(&m_CpuInfo);
+  auto pImmOprd   = rInsn.ThirdOperand().GetSemantic(&m_CpuInfo);
+
+  if (pLeftOprd != nullptr && pRightOprd != nullptr)
+  {
+    auto pExpr = new OperationExpression(
+      OperationExpression::OpAff,
+      pLeftOprd,
+      new OperationExpression(
+        OperationExpression::OpAdd,
+        pRightOprd,
+        pImmOprd));
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Push(Instruction& rInsn)
+{
+  auto pExprOprd = rInsn.FirstOperand().GetSemantic(&m_CpuInfo);
+  if (pExprOprd != nullptr)
+  {
+    auto pAllocStack = new OperationExpression(
+      OperationExpression::OpAff,
+      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+      new OperationExpression(
+        OperationExpression::OpSub,
+        new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+        new ConstantExpression(ConstantExpression::Const16Bit, 2)));
+
+    auto pStoreStack = new OperationExpression(
+      OperationExpression::OpAff,
+      new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)),
+      pExprOprd);
+
+    Expression::List ExprList;
+    ExprList.push_back(pAllocStack);
+    ExprList.push_back(pStoreStack);
+    rInsn.SetSemantic(ExprList);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Pop(Instruction& rInsn)
+{
+  auto pOprdExpr = rInsn.FirstOperand().GetSemantic(&m_CpuInfo);
+  if (pOprdExpr != nullptr)
+  {
+    auto pStoreOprd = new OperationExpression(
+      OperationExpression::OpAff,
+      pOprdExpr,
+      new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)));
+
+    auto pFreeStack = new OperationExpression(
+      OperationExpression::OpAff,
+      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+      new OperationExpression(
+        OperationExpression::OpAdd,
+        new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+        new ConstantExpression(ConstantExpression::Const16Bit, 2)));
+
+    Expression::List ExprList;
+    ExprList.push_back(pStoreOprd);
+    ExprList.push_back(pFreeStack);
+    rInsn.SetSemantic(ExprList);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Jr(Instruction& rInsn)
+{
+  auto pOprdExpr = rInsn.FirstOperand().GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()));
+  if (pOprdExpr != nullptr)
+  {
+    Expression *pExpr = new OperationExpression(OperationExpression::OpAff,
+      new IdentifierExpression(GB_RegPc, &m_CpuInfo),
+      pOprdExpr);
+
+    pExpr = MakeConditional(rInsn, pExpr);
+
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Jp(Instruction& rInsn)
+{
+  auto pOprdExpr = rInsn.FirstOperand().GetSemantic(&m_CpuInfo);
+  if (pOprdExpr)
+  {
+    Expression *pExpr = new OperationExpression(OperationExpression::OpAff,
+      new IdentifierExpression(GB_RegPc, &m_CpuInfo),
+      pOprdExpr);
+
+    pExpr = MakeConditional(rInsn, pExpr);
+
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Call(Instruction& rInsn)
+{
+  /* CALL → sp -= 2 ; ld (sp), pc + insn_len ; pc = oprd */
+  auto pOprdExpr = rInsn.FirstOperand().GetSemantic(&m_CpuInfo);
+  if (pOprdExpr != nullptr)
+  {
+    auto pExprAllocStack = new OperationExpression(
+      OperationExpression::OpAff,
+      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+      new OperationExpression(
+        OperationExpression::OpSub,
+        new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+        new ConstantExpression(ConstantExpression::Const16Bit, 2)));
+
+    auto pExprStoreStack = new OperationExpression(
+      OperationExpression::OpAff,
+      new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)),
+      new OperationExpression(
+        OperationExpression::OpAdd,
+        new IdentifierExpression(GB_RegPc, &m_CpuInfo),
+        new ConstantExpression(ConstantExpression::Const16Bit, rInsn.GetLength())));
+
+    auto pExprJmp = new OperationExpression(
+      OperationExpression::OpAff,
+      new IdentifierExpression(GB_RegPc, &m_CpuInfo),
+      pOprdExpr);
+
+    Expression::List ExprList;
+    ExprList.push_back(pExprAllocStack);
+    ExprList.push_back(pExprStoreStack);
+    ExprList.push_back(pExprJmp);
+    Expression *pExpr = new BindExpression(ExprList);
+
+    pExpr = MakeConditional(rInsn, pExpr);
+
+    rInsn.SetSemantic(pExpr);
+  }
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Rst(Instruction& rInsn)
+{
+  auto pExprAllocStack = new OperationExpression(
+    OperationExpression::OpAff,
+    new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+    new OperationExpression(
+      OperationExpression::OpSub,
+      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+      new ConstantExpression(ConstantExpression::Const16Bit, 2)));
+
+  auto pExprStoreStack = new OperationExpression(
+    OperationExpression::OpAff,
+    new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)),
+    new OperationExpression(
+      OperationExpression::OpAdd,
+      new IdentifierExpression(GB_RegPc, &m_CpuInfo),
+      new ConstantExpression(ConstantExpression::Const16Bit, rInsn.GetLength())));
+
+  auto pExprJmp = new OperationExpression(
+    OperationExpression::OpAff,
+    new IdentifierExpression(GB_RegPc, &m_CpuInfo),
+    new ConstantExpression(ConstantExpression::Const16Bit, rInsn.FirstOperand().GetValue()));
+
+  Expression::List ExprList;
+  ExprList.push_back(pExprAllocStack);
+  ExprList.push_back(pExprStoreStack);
+  ExprList.push_back(pExprJmp);
+  rInsn.SetSemantic(ExprList);
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Ret(Instruction& rInsn)
+{
+  auto pLoadStack = new OperationExpression(
+    OperationExpression::OpAff,
+    new IdentifierExpression(GB_RegPc, &m_CpuInfo),
+    new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)));
+
+  auto pFreeStack = new OperationExpression(
+    OperationExpression::OpAff,
+    new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+    new OperationExpression(
+      OperationExpression::OpAdd,
+      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+      new ConstantExpression(ConstantExpression::Const16Bit, 2)));
+
+  Expression::List ExprList;
+  ExprList.push_back(pLoadStack);
+  ExprList.push_back(pFreeStack);
+  Expression *pExpr = new BindExpression(ExprList);
+
+  pExpr = MakeConditional(rInsn, pExpr);
+
+  rInsn.SetSemantic(pExpr);
+
+  return true;
+}
+
+bool GameBoyArchitecture::Semantic_Reti(Instruction& rInsn)
+{
+  auto pLoadStack = new OperationExpression(
+    OperationExpression::OpAff,
+    new IdentifierExpression(GB_RegPc, &m_CpuInfo),
+    new MemoryExpression(16, nullptr, new IdentifierExpression(GB_RegSp, &m_CpuInfo)));
+
+  auto pFreeStack = new OperationExpression(
+    OperationExpression::OpAff,
+    new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+    new OperationExpression(
+      OperationExpression::OpAdd,
+      new IdentifierExpression(GB_RegSp, &m_CpuInfo),
+      new ConstantExpression(ConstantExpression::Const16Bit, 2)));
+
+  Expression::List ExprList;
+  ExprList.push_back(pLoadStack);
+  ExprList.push_back(pFreeStack);
+  rInsn.SetSemantic(ExprList);
+
+  return true;
+}
@@ -6,6 +6,7 @@
 #include "medusa/binary_stream.hpp"
 #include "medusa/instruction.hpp"
 #include "medusa/context.hpp"
+#include "medusa/paged_memory.hpp"
 
 #include "gameboy_instruction.hpp"
 #include "gameboy_register.hpp"
@@ -42,7 +43,9 @@ public:
 
   virtual std::string           GetName(void) const { return "Nintendo GameBoy Z80"; }
   virtual bool                  Translate(Address const& rVirtAddr, TOffset& rPhyslOff);
-  virtual bool                  Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  virtual bool                  Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode, u8 Flags);
+  virtual bool                  BuildSemantic(Instruction& rInsn);
+  virtual size_t                DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, DecodedInstruction* pInsns, size_t InsnNo);
   virtual NamedModeVector       GetModes(void) const
   {
     NamedModeVector GbModes;
@@ -55,7 +58,7 @@ public:
   virtual EEndianness           GetEndianness(void) { return LittleEndian; }
   virtual CpuInformation const* GetCpuInformation(void) const { return &m_CpuInfo; }
   virtual CpuContext*           MakeCpuContext(void) const { return nullptr; }
-  virtual MemoryContext*        MakeMemoryContext(void) const { return new MemoryContext(m_CpuInfo); }
+  virtual MemoryContext*        MakeMemoryContext(void) const { return new PagedMemoryContext(m_CpuInfo); }
 
 private:
   typedef bool (GameBoyArchitecture:: *TDisassembler)(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
@@ -122,6 +125,47 @@ private:
   bool Insn_Stop(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Ei(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
   bool Insn_Di(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
+
+  // Semantics are built from the decoded instruction, the semantic id holds the
+  // condition (EGameBoyConditionType) of conditional jumps, calls and returns
+  Expression* MakeConditional(Instruction const& rInsn, Expression* pExpr);
+
+  bool Semantic_Inc(Instruction& rInsn);
+  bool Semantic_Dec(Instruction& rInsn);
+  bool Semantic_Add(Instruction& rInsn);
+  bool Semantic_Sub(Instruction& rInsn);
+  bool Semantic_Adc(Instruction& rInsn);
+  bool Semantic_Sbc(Instruction& rInsn);
+  bool Semantic_And(Instruction& rInsn);
+  bool Semantic_Or(Instruction& rInsn);
+  bool Semantic_Xor(Instruction& rInsn);
+  bool Semantic_Bit(Instruction& rInsn);
+  bool Semantic_Set(Instruction& rInsn);
+  bool Semantic_Res(Instruction& rInsn);
+  bool Semantic_Rl(Instruction& rInsn);
+  bool Semantic_Rr(Instruction& rInsn);
+  bool Semantic_Rlc(Instruction& rInsn);
+  bool Semantic_Rrc(Instruction& rInsn);
+  bool Semantic_Sla(Instruction& rInsn);
+  bool Semantic_Sra(Instruction& rInsn);
+  bool Semantic_Srl(Instruction& rInsn);
+  bool Semantic_Swap(Instruction& rInsn);
+  bool Semantic_Cpl(Instruction& rInsn);
+  bool Semantic_Ccf(Instruction& rInsn);
+  bool Semantic_Cp(Instruction& rInsn);
+  bool Semantic_Ld(Instruction& rInsn);
+  bool Semantic_Ldi(Instruction& rInsn);
+  bool Semantic_Ldd(Instruction& rInsn);
+  bool Semantic_Ldh(Instruction& rInsn);
+  bool Semantic_Ldhl(Instruction& rInsn);
+  bool Semantic_Push(Instruction& rInsn);
+  bool Semantic_Pop(Instruction& rInsn);
+  bool Semantic_Jr(Instruction& rInsn);
+  bool Semantic_Jp(Instruction& rInsn);
+  bool Semantic_Call(Instruction& rInsn);
+  bool Semantic_Rst(Instruction& rInsn);
+  bool Semantic_Ret(Instruction& rInsn);
+  bool Semantic_Reti(Instruction& rInsn);
 };
 
 #endif // _GAMEBOY_ARCHITECTURE_
\ No newline at end of file
@@ -19,7 +19,7 @@ char const* X86Architecture::X86CpuInformation::ConvertIdentifierToName(u32 Id)
    "tr5", "tr6", "tr7", "rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi", "r8", "r9", "r10", "r11", "r12", "r13",
    "r14", "r15", "rip", "rflags", "st0", "st1", "st2", "st3", "st4", "st5", "st6", "st7", "mm0", "mm1", "mm2", "mm3", "mm4", "mm5",
    "mm6", "mm7", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7", "xmm8", "xmm9", "xmm10", "xmm11", "xmm12",
-   "xmm13", "xmm14", "xmm15" };
+   "xmm13", "xmm14", "xmm15", "lazy_op", "lazy_dst", "lazy_src", "lazy_res" };
   if (Id < (sizeof(RegisterName) / sizeof(*RegisterName)))
     return RegisterName[Id];
 
@@ -130,6 +130,7 @@ u32 X86Architecture::X86CpuInformation::GetSizeOfRegisterInBit(u32 Id) const
   case X86_Reg_R12d: case X86_Reg_R13d: case X86_Reg_R14d: case X86_Reg_R15d:
   case X86_Reg_Eip:
   case X86_Reg_Eflags:
+  case X86_Reg_LazyOp:
     return 32;
 
   case X86_Reg_Rax:  case X86_Reg_Rbx:  case X86_Reg_Rcx:  case X86_Reg_Rdx:
@@ -138,6 +139,7 @@ u32 X86Architecture::X86CpuInformation::GetSizeOfRegisterInBit(u32 Id) const
   case X86_Reg_R12:  case X86_Reg_R13:  case X86_Reg_R14:  case X86_Reg_R15:
   case X86_Reg_Rip:
   case X86_Reg_Rflags:
+  case X86_Reg_LazyDst: case X86_Reg_LazySrc: case X86_Reg_LazyRes:
     return 64;
   }
 }
@@ -191,6 +193,10 @@ bool X86Architecture::X86CpuInformation::IsRegisterAliased(u32 Id0, u32 Id1) con
     return Id1 == X86_Reg_R15b || Id1 == X86_Reg_R15w || Id1 == X86_Reg_R15d || Id1 == X86_Reg_R15;
   case X86_Reg_Ip: case X86_Reg_Eip: case X86_Reg_Rip:
     return Id1 == X86_Reg_Ip || Id1 == X86_Reg_Eip || Id1 == X86_Reg_Rip;
+
+  // Flags registers are computed from the lazy flags
+  case X86_Reg_Flags: case X86_Reg_Eflags: case X86_Reg_Rflags:
+    return Id1 == X86_Reg_LazyOp || Id1 == X86_Reg_LazyDst || Id1 == X86_Reg_LazySrc || Id1 == X86_Reg_LazyRes;
   }
   return false;
 }
@@ -198,74 +204,59 @@ bool X86Architecture::X86CpuInformation::IsRegisterAliased(u32 Id0, u32 Id1) con
 Expression* X86Architecture::UpdateFlags(Instruction& rInsn, Expression* pResultExpr)
 {
   u32 RegFlags = m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister);
-  u32 RegFlagsSize = m_CpuInfo.GetSizeOfRegisterInBit(RegFlags);
   assert(RegFlags != 0 && "Invalid flags");
+  ExpressionArena& rArena = rInsn.SemanticArena();
 
   u32 Bit = rInsn.Operand(0)->GetSizeInBit();
   assert(Bit && "Invalid operand");
 
   auto InsnLen = static_cast<u8>(rInsn.GetLength());
 
-  std::list<Expression *> FlagExprs;
-
+  // Flags are not computed here: the operation, its operands and its result are saved,
+  // X86CpuContext computes the flags only when the flags register is read
+  u32 LazyOp;
+  Expression* pSrcExpr = nullptr;
   switch (rInsn.GetOpcode())
   {
-  case X86_Opcode_Inc: case X86_Opcode_Add:
-    FlagExprs.push_back(new IfElseConditionExpression(IfElseConditionExpression::CondUlt,
-      pResultExpr->Clone(), rInsn.Operand(0)->GetSemantic(&m_CpuInfo, InsnLen),
-      SetFlags(rInsn, X86_FlCf), ResetFlags(rInsn, X86_FlCf)));
-    break;
-
-  case X86_Opcode_Adc:
-    FlagExprs.push_back(new IfElseConditionExpression(IfElseConditionExpression::CondUlt,
-      pResultExpr->Clone(),
-      new OperationExpression(OperationExpression::OpAdd, rInsn.Operand(0)->GetSemantic(&m_CpuInfo, InsnLen), ExtractFlag(rInsn, X86_FlCf)),
-      SetFlags(rInsn, X86_FlCf), ResetFlags(rInsn, X86_FlCf)));
-    break;
-
-  case X86_Opcode_Dec:
-    FlagExprs.push_back(new IfElseConditionExpression(IfElseConditionExpression::CondUlt,
-      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, InsnLen), new ConstantExpression(Bit, 1),
-      SetFlags(rInsn, X86_FlCf), ResetFlags(rInsn, X86_FlCf)));
-    break;
-
-  case X86_Opcode_Sub: case X86_Opcode_Cmp:
-    FlagExprs.push_back(new IfElseConditionExpression(IfElseConditionExpression::CondUlt,
-      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, InsnLen), rInsn.Operand(1)->GetSemantic(&m_CpuInfo, InsnLen),
-      SetFlags(rInsn, X86_FlCf), ResetFlags(rInsn, X86_FlCf)));
-    break;
-
-  case X86_Opcode_Sbb:
-    FlagExprs.push_back(new IfElseConditionExpression(IfElseConditionExpression::CondUlt,
-      pResultExpr->Clone(),
-      new OperationExpression(OperationExpression::OpSub, rInsn.Operand(0)->GetSemantic(&m_CpuInfo, InsnLen), ExtractFlag(rInsn, X86_FlCf)),
-      SetFlags(rInsn, X86_FlCf), ResetFlags(rInsn, X86_FlCf)));
-    break;
+  case X86_Opcode_Add:                      LazyOp = X86_LazyOp_Add; break;
+  case X86_Opcode_Adc:                      LazyOp = X86_LazyOp_Adc; break;
+  case X86_Opcode_Sub: case X86_Opcode_Cmp: LazyOp = X86_LazyOp_Sub; break;
+  case X86_Opcode_Sbb:                      LazyOp = X86_LazyOp_Sbb; break;
+  case X86_Opcode_Inc:                      LazyOp = X86_LazyOp_Inc; pSrcExpr = new (rArena) ConstantExpression(Bit, 1); break;
+  case X86_Opcode_Dec:                      LazyOp = X86_LazyOp_Dec; pSrcExpr = new (rArena) ConstantExpression(Bit, 1); break;
+  default:                                  LazyOp = X86_LazyOp_Logic; pSrcExpr = new (rArena) ConstantExpression(Bit, 0); break;
   }
+  if (pSrcExpr == nullptr)
+    pSrcExpr = rInsn.Operand(1)->GetSemantic(&m_CpuInfo, InsnLen, true, &rArena);
 
-  auto UpdatedFlags = rInsn.GetUpdatedFlags();
+  u32 PendingFlags = ConvertFlagIdToMask(rInsn.GetUpdatedFlags() & (X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf));
+  if (PendingFlags == 0)
+    return pResultExpr;
 
-  if (UpdatedFlags & X86_FlZf)
-  {
-    FlagExprs.push_back(new IfElseConditionExpression(ConditionExpression::CondEq,
-      pResultExpr->Clone(),
-      new ConstantExpression(Bit, 0x0),
-      SetFlags(rInsn, X86_FlZf), ResetFlags(rInsn, X86_FlZf)));
-  }
+  // Inc and dec keep the carry flag, it's saved in the operation
+  bool KeepCarry = LazyOp == X86_LazyOp_Inc || LazyOp == X86_LazyOp_Dec;
+  if (KeepCarry)
+    PendingFlags |= 1 << X86_CfBit;
 
-  if (UpdatedFlags & X86_FlSf)
-  {
-    FlagExprs.push_back(new IfElseConditionExpression(ConditionExpression::CondEq,
-      new OperationExpression(OperationExpression::OpAnd, pResultExpr->Clone(), new ConstantExpression(Bit, 1 << (Bit - 1))),
-      new ConstantExpression(Bit, 1 << (Bit - 1)),
-      SetFlags(rInsn, X86_FlSf), ResetFlags(rInsn, X86_FlSf)));
-  }
+  Expression* pOpExpr = new (rArena) ConstantExpression(32, PendingFlags | (Bit << X86_LazyOp_SizeBit) | (LazyOp << X86_LazyOp_OpBit));
+  if (KeepCarry)
+    pOpExpr = new (rArena) OperationExpression(OperationExpression::OpOr, pOpExpr,
+      /**/new (rArena) OperationExpression(OperationExpression::OpLls,
+      /****/ExtractFlag(rInsn, X86_FlCf),
+      /****/new (rArena) ConstantExpression(32, X86_LazyOp_CarryBit)));
 
-  if (FlagExprs.empty())
-    return pResultExpr;
-
-  delete pResultExpr;
-  return new BindExpression(FlagExprs);
+  // The operation is written first, so the flags of the previous operation can still be read
+  std::list<Expression *> FlagExprs;
+  FlagExprs.push_back(new (rArena) OperationExpression(OperationExpression::OpAff,
+    new (rArena) IdentifierExpression(X86_Reg_LazyOp, &m_CpuInfo), pOpExpr));
+  FlagExprs.push_back(new (rArena) OperationExpression(OperationExpression::OpAff,
+    new (rArena) IdentifierExpression(X86_Reg_LazyDst, &m_CpuInfo), rInsn.Operand(0)->GetSemantic(&m_CpuInfo, InsnLen, true, &rArena)));
+  FlagExprs.push_back(new (rArena) OperationExpression(OperationExpression::OpAff,
+    new (rArena) IdentifierExpression(X86_Reg_LazySrc, &m_CpuInfo), pSrcExpr));
+  FlagExprs.push_back(new (rArena) OperationExpression(OperationExpression::OpAff,
+    new (rArena) IdentifierExpression(X86_Reg_LazyRes, &m_CpuInfo), pResultExpr));
+
+  return new (rArena) BindExpression(FlagExprs);
 }
 
 OperationExpression* X86Architecture::SetFlags(Instruction& rInsn, u32 Flags)
@@ -273,13 +264,14 @@ OperationExpression* X86Architecture::SetFlags(Instruction& rInsn, u32 Flags)
   u32 RegFlags = m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister);
   u32 RegFlagsSize = m_CpuInfo.GetSizeOfRegisterInBit(RegFlags);
   assert(RegFlags != 0 && "Invalid flags");
+  ExpressionArena& rArena = rInsn.SemanticArena();
 
   u32 FlagsMask = ConvertFlagIdToMask(Flags);
-  return new OperationExpression(OperationExpression::OpAff,
-    /**/new IdentifierExpression(RegFlags, &m_CpuInfo),
-    /**/new OperationExpression(OperationExpression::OpOr,
-    /****/new IdentifierExpression(RegFlags, &m_CpuInfo),
-    /****/new ConstantExpression(RegFlagsSize, FlagsMask)));
+  return new (rArena) OperationExpression(OperationExpression::OpAff,
+    /**/new (rArena) IdentifierExpression(RegFlags, &m_CpuInfo),
+    /**/new (rArena) OperationExpression(OperationExpression::OpOr,
+    /****/new (rArena) IdentifierExpression(RegFlags, &m_CpuInfo),
+    /****/new (rArena) ConstantExpression(RegFlagsSize, FlagsMask)));
 }
 
 OperationExpression* X86Architecture::ResetFlags(Instruction& rInsn, u32 Flags)
@@ -287,13 +279,14 @@ OperationExpression* X86Architecture::ResetFlags(Instruction& rInsn, u32 Flags)
   u32 RegFlags = m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister);
   u32 RegFlagsSize = m_CpuInfo.GetSizeOfRegisterInBit(RegFlags);
   assert(RegFlags != 0 && "Invalid flags");
+  ExpressionArena& rArena = rInsn.SemanticArena();
 
   u32 FlagsMask = ConvertFlagIdToMask(Flags);
-  return new OperationExpression(OperationExpression::OpAff,
-    /**/new IdentifierExpression(RegFlags, &m_CpuInfo),
-    /**/new OperationExpression(OperationExpression::OpAnd,
-    /****/new IdentifierExpression(RegFlags, &m_CpuInfo),
-    /****/new ConstantExpression(RegFlagsSize, ~FlagsMask)));
+  return new (rArena) OperationExpression(OperationExpression::OpAff,
+    /**/new (rArena) IdentifierExpression(RegFlags, &m_CpuInfo),
+    /**/new (rArena) OperationExpression(OperationExpression::OpAnd,
+    /****/new (rArena) IdentifierExpression(RegFlags, &m_CpuInfo),
+    /****/new (rArena) ConstantExpression(RegFlagsSize, ~FlagsMask)));
 }
 
 ConditionExpression* X86Architecture::TestFlags(Instruction& rInsn, u32 Flags)
@@ -301,13 +294,14 @@ ConditionExpression* X86Architecture::TestFlags(Instruction& rInsn, u32 Flags)
   u32 RegFlags = m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister);
   u32 RegFlagsSize = m_CpuInfo.GetSizeOfRegisterInBit(RegFlags);
   assert(RegFlags != 0 && "Invalid flags");
+  ExpressionArena& rArena = rInsn.SemanticArena();
 
   u32 FlagsMask = ConvertFlagIdToMask(Flags);
-  return new ConditionExpression(ConditionExpression::CondEq,
-    /**/new OperationExpression(OperationExpression::OpAnd,
-    /****/new IdentifierExpression(RegFlags, &m_CpuInfo),
-    /****/new ConstantExpression(RegFlagsSize, FlagsMask)),
-    /**/new ConstantExpression(RegFlagsSize, FlagsMask));
+  return new (rArena) ConditionExpression(ConditionExpression::CondEq,
+    /**/new (rArena) OperationExpression(OperationExpression::OpAnd,
+    /****/new (rArena) IdentifierExpression(RegFlags, &m_CpuInfo),
+    /****/new (rArena) ConstantExpression(RegFlagsSize, FlagsMask)),
+    /**/new (rArena) ConstantExpression(RegFlagsSize, FlagsMask));
 }
 
 ConditionExpression* X86Architecture::TestNotFlags(Instruction& rInsn, u32 Flags)
@@ -315,13 +309,14 @@ ConditionExpression* X86Architecture::TestNotFlags(Instruction& rInsn, u32 Flags
   u32 RegFlags = m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister);
   u32 RegFlagsSize = m_CpuInfo.GetSizeOfRegisterInBit(RegFlags);
   assert(RegFlags != 0 && "Invalid flags");
+  ExpressionArena& rArena = rInsn.SemanticArena();
 
   u32 FlagsMask = ConvertFlagIdToMask(Flags);
-  return new ConditionExpression(ConditionExpression::CondEq,
-    /**/new OperationExpression(OperationExpression::OpAnd,
-    /****/new IdentifierExpression(RegFlags, &m_CpuInfo),
-    /****/new ConstantExpression(RegFlagsSize, FlagsMask)),
-    /**/new ConstantExpression(RegFlagsSize, 0x0));
+  return new (rArena) ConditionExpression(ConditionExpression::CondEq,
+    /**/new (rArena) OperationExpression(OperationExpression::OpAnd,
+    /****/new (rArena) IdentifierExpression(RegFlags, &m_CpuInfo),
+    /****/new (rArena) ConstantExpression(RegFlagsSize, FlagsMask)),
+    /**/new (rArena) ConstantExpression(RegFlagsSize, 0x0));
 }
 
 OperationExpression* X86Architecture::ExtractFlag(Instruction& rInsn, u32 Flag)
@@ -329,6 +324,7 @@ OperationExpression* X86Architecture::ExtractFlag(Instruction& rInsn, u32 Flag)
   u32 RegFlags = m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister);
   u32 RegFlagsSize = m_CpuInfo.GetSizeOfRegisterInBit(RegFlags);
   assert(RegFlags != 0 && "Invalid flags");
+  ExpressionArena& rArena = rInsn.SemanticArena();
 
     u32 FlagPos = 0;
 #define CONVERT_FLAG_ID_TO_POS(fl) (Flag & X86_Fl##fl) FlagPos = X86_##fl##Bit
@@ -343,22 +339,81 @@ OperationExpression* X86Architecture::ExtractFlag(Instruction& rInsn, u32 Flag)
     else if CONVERT_FLAG_ID_TO_POS(Of);
 #undef CONVERT_FLAG_ID_TO_MASK
 
-    return new OperationExpression(OperationExpression::OpAnd,
-      /**/new OperationExpression(OperationExpression::OpLrs,
-      /****/new IdentifierExpression(RegFlags, &m_CpuInfo),
-      /****/new ConstantExpression(RegFlagsSize, FlagPos)),
-      /**/new ConstantExpression(RegFlagsSize, 1));
+    return new (rArena) OperationExpression(OperationExpression::OpAnd,
+      /**/new (rArena) OperationExpression(OperationExpression::OpLrs,
+      /****/new (rArena) IdentifierExpression(RegFlags, &m_CpuInfo),
+      /****/new (rArena) ConstantExpression(RegFlagsSize, FlagPos)),
+      /**/new (rArena) ConstantExpression(RegFlagsSize, 1));
 }
 
-bool X86Architecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)
+bool X86Architecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode, u8 Flags)
 {
   u8 Opcode;
   rBinStrm.Read(Offset, Opcode);
   bool Res = (this->*m_Table_1[Opcode])(rBinStrm, Offset + 1, rInsn, Mode);
   rInsn.SetName(m_Mnemonic[rInsn.GetOpcode()]);
+  if (Res && (Flags & DisasmSemantic))
+    Res = BuildSemantic(rInsn);
   return Res;
 }
 
+bool X86Architecture::BuildSemantic(Instruction& rInsn)
+{
+  u32 SemId = rInsn.GetSemanticId();
+
+  // This instruction has no semantic
+  if (SemId == 0)
+    return true;
+
+  if (SemId >= sizeof(m_Semantic) / sizeof(*m_Semantic))
+    return false;
+
+  // Semantic is already built
+  if (!rInsn.GetSemantic().empty())
+    return true;
+
+  return (this->*m_Semantic[SemId])(rInsn);
+}
+
+size_t X86Architecture::DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, DecodedInstruction* pInsns, size_t InsnNo)
+{
+  TOffset EndOffset = Offset + Size;
+  if (EndOffset > rBinStrm.GetSize())
+    EndOffset = rBinStrm.GetSize();
+
+  Instruction Insn;
+  size_t DecodedNo = 0;
+
+  while (DecodedNo < InsnNo && Offset < EndOffset)
+  {
+    u8 Opcode;
+    if (!rBinStrm.Read(Offset, Opcode))
+      break;
+
+    // Near the end of the range, the length decoder tells if the instruction fits
+    // without letting the full decoder read the bytes behind the range
+    if (Offset + X86_MAX_INSN_LENGTH > EndOffset)
+    {
+      u16 Length;
+      if (!GetInstructionLength(rBinStrm, Offset, Mode, Length) || Offset + Length > EndOffset)
+        break;
+    }
+
+    // We call the opcode table directly to avoid the virtual call and the semantic flags check
+    Insn.Reset();
+    if (!(this->*m_Table_1[Opcode])(rBinStrm, Offset + 1, Insn, Mode))
+      break;
+    Insn.SetName(m_Mnemonic[Insn.GetOpcode()]);
+    if (Insn.GetLength() == 0 || Offset + Insn.GetLength() > EndOffset)
+      break;
+
+    pInsns[DecodedNo++].Load(Offset, Insn, Mode);
+    Offset += Insn.GetLength();
+  }
+
+  return DecodedNo;
+}
+
 void X86Architecture::FillConfigurationModel(ConfigurationModel& rCfgMdl)
 {
   Architecture::FillConfigurationModel(rCfgMdl);
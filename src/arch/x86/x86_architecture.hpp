@@ -9,6 +9,7 @@
 #include <medusa/instruction.hpp>
 #include <medusa/information.hpp>
 #include <medusa/context.hpp>
+#include <medusa/paged_memory.hpp>
 #include <medusa/medusa.hpp>
 
 #include "x86.hpp"
@@ -53,12 +54,18 @@ private:
     virtual bool WriteRegister(u32 Register, void const* pValue, u32 Size, bool SignExtend = false);
     virtual void* GetRegisterAddress(u32 Register);
     virtual void* GetContextAddress(void) { return &m_Context; }
+    virtual u32 GetContextSize(void) const { return sizeof(m_Context); }
     virtual u16 GetRegisterOffset(u32 Register);
+    virtual bool GetRegisterStorage(u32 Register, u16& rOffset, u8& rReadSize, u8& rWriteSize);
     virtual void GetRegisters(RegisterList& RegList) const;
     virtual bool Translate(Address const& rLogicalAddress, u64& rLinearAddress) const;
     virtual std::string ToString(void) const;
 
   private:
+    //! This method returns the flags register with the flags of the last operation
+    //! computed from the lazy flags, see X86_LazyOp.
+    u32 GetFlags(void) const;
+
     union X86Register
     {
       u64 r;
@@ -72,6 +79,8 @@ private:
       X86Register a, b, c, d, si, di, bp, sp, ip, r8, r9, r10, r11, r12, r13, r14, r15;
       u16 cs, ds, es, ss, fs, gs;
       u32 flags;
+      u32 lazy_op;
+      u64 lazy_dst, lazy_src, lazy_res;
     } m_Context;
 
     Configuration const& m_rCfg;
@@ -87,7 +96,10 @@ public:
   virtual std::string           GetName(void) const { return "Intel x86"; }
   virtual bool                  Translate(Address const& rVirtAddr, TOffset& rPhysOff) { return false; }
   virtual EEndianness           GetEndianness(void) { return LittleEndian; }
-  virtual bool                  Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  virtual bool                  Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode, u8 Flags);
+  virtual bool                  BuildSemantic(Instruction& rInsn);
+  virtual size_t                DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, DecodedInstruction* pInsns, size_t InsnNo);
+  virtual bool                  GetInstructionLength(BinaryStream const& rBinStrm, TOffset Offset, u8 Mode, u16& rLength);
   virtual NamedModeVector       GetModes(void) const
   {
     NamedModeVector X86Modes;
@@ -110,10 +122,16 @@ public:
     Instruction   const& rInsn,
     std::string        & rStrCell,
     Cell::Mark::List   & rMarks) const;
+  virtual bool                  FormatInstruction(
+    Document      const& rDoc,
+    BinaryStream  const& rBinStrm,
+    Address       const& rAddr,
+    Instruction   const& rInsn,
+    FormatBuffer       & rBuf) const;
   virtual void                  FillConfigurationModel(ConfigurationModel& rCfgMdl);
   virtual CpuInformation const* GetCpuInformation(void) const { return &m_CpuInfo; }
   virtual CpuContext*           MakeCpuContext(void) const { return new X86CpuContext(m_Cfg, m_CpuInfo); }
-  virtual MemoryContext*        MakeMemoryContext(void) const { return new MemoryContext(m_CpuInfo); }
+  virtual MemoryContext*        MakeMemoryContext(void) const { return new PagedMemoryContext(m_CpuInfo); }
   virtual Expression*           UpdateFlags(Instruction& rInsn, Expression* pResultExpr);
   virtual OperationExpression*  SetFlags(Instruction& rInsn, u32 Flags);
   virtual OperationExpression*  ResetFlags(Instruction& rInsn, u32 Flags);
@@ -152,6 +170,12 @@ private:
     TOffset              Offset,
     Instruction   const& rInsn,
     Operand       const* pOprd) const;
+  void                FormatOperand(
+    FormatBuffer       & rBuf,
+    Document      const& rDoc,
+    TOffset              Offset,
+    Instruction   const& rInsn,
+    Operand       const* pOprd) const;
   void                ApplySegmentOverridePrefix(Instruction& rInsn, Operand* pOprd);
 };
 
@@ -157,7 +157,13 @@ enum X86_Reg
   X86_Reg_Xmm12,
   X86_Reg_Xmm13,
   X86_Reg_Xmm14,
-  X86_Reg_Xmm15
+  X86_Reg_Xmm15,
+
+  // Lazy flags, see X86_LazyOp
+  X86_Reg_LazyOp,
+  X86_Reg_LazyDst,
+  X86_Reg_LazySrc,
+  X86_Reg_LazyRes
 };
 
 enum X86_Flag
@@ -186,6 +192,26 @@ enum X86_FlagBit
   X86_OfBit = 11
 };
 
+// X86_Reg_LazyOp contains the mask of the flags to compute (eflags bits 0-11), the carry
+// flag before the operation (bit 12), the operand size in bit (bits 16-23) and the
+// operation (bits 24-31). Flags are computed from X86_Reg_LazyDst, X86_Reg_LazySrc and
+// X86_Reg_LazyRes when the flags register is read.
+enum X86_LazyOp
+{
+  X86_LazyOp_None,
+  X86_LazyOp_Add,
+  X86_LazyOp_Adc,
+  X86_LazyOp_Sub,
+  X86_LazyOp_Sbb,
+  X86_LazyOp_Inc,
+  X86_LazyOp_Dec,
+  X86_LazyOp_Logic,
+
+  X86_LazyOp_CarryBit = 12,
+  X86_LazyOp_SizeBit  = 16,
+  X86_LazyOp_OpBit    = 24
+};
+
 enum X86_Prefix
 {
   X86_Prefix_Wait         = 0x1,
@@ -372,4 +398,33 @@ enum X86_Condition
   X86_Cond_Z
 };
 
+// The longest valid x86 instruction is 15 bytes long
+#define X86_MAX_INSN_LENGTH 15
+
+// Attributes stored in the generated length tables (see X86Architecture::GetInstructionLength)
+enum X86_Length
+{
+  X86_Len_None      = 0x0000,
+  X86_Len_Ib        = 0x0001,
+  X86_Len_Iw        = 0x0002,
+  X86_Len_Iz        = 0x0003,
+  X86_Len_Iv        = 0x0004,
+  X86_Len_Ap        = 0x0005,
+  X86_Len_Ov        = 0x0006,
+  X86_Len_Iw_Ib     = 0x0007,
+  X86_Len_ImmMask   = 0x000f,
+
+  X86_Len_ModRm     = 0x0010, // a ModR/M byte follows the opcode
+  X86_Len_Prefix    = 0x0020, // argument is the size of the prefix payload
+  X86_Len_Prefix64  = 0x0040, // prefix only in 64-bit mode
+  X86_Len_Escape    = 0x0080, // argument is the index of the next opcode map
+  X86_Len_Group     = 0x0100, // argument is the index of the group, ModR/M.reg selects the entry
+  X86_Len_Invalid   = 0x0200,
+  X86_Len_Invalid64 = 0x0400,
+  X86_Len_Fallback  = 0x0800, // length depends on more than the opcode, use the full decoder
+
+  X86_Len_ArgShift  = 12,
+  X86_Len_ArgMask   = 0xf000
+};
+
 #endif // !_X86_CONST_
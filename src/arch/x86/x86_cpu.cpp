@@ -28,13 +28,18 @@ bool X86Architecture::X86CpuContext::ReadRegister(u32 Register, void* pValue, u3
   //case X86_FlOf:    READ_F(X86_OfBit); break;
 
   case X86_Reg_Flags:
-    *reinterpret_cast<u16 *>(pValue) = m_Context.flags;
+    *reinterpret_cast<u16 *>(pValue) = static_cast<u16>(GetFlags());
     break;
   case X86_Reg_Eflags:
   case X86_Reg_Rflags:
-    *reinterpret_cast<u32 *>(pValue) = m_Context.flags;
+    *reinterpret_cast<u32 *>(pValue) = GetFlags();
     break;
 
+  case X86_Reg_LazyOp:  *reinterpret_cast<u32 *>(pValue) = m_Context.lazy_op;  break;
+  case X86_Reg_LazyDst: *reinterpret_cast<u64 *>(pValue) = m_Context.lazy_dst; break;
+  case X86_Reg_LazySrc: *reinterpret_cast<u64 *>(pValue) = m_Context.lazy_src; break;
+  case X86_Reg_LazyRes: *reinterpret_cast<u64 *>(pValue) = m_Context.lazy_res; break;
+
   case X86_Reg_Al:  READ_R_L(a);       break;
   case X86_Reg_Ah:  READ_R_H(a);       break;
   case X86_Reg_Bl:  READ_R_L(b);       break;
@@ -153,14 +158,22 @@ bool X86Architecture::X86CpuContext::WriteRegister(u32 Register, void const* pVa
   //case X86_FlDf:    WRITE_F(X86_DfBit); break;
   //case X86_FlOf:    WRITE_F(X86_OfBit); break;
 
+  // Writing the flags register sets all flags, no flag is computed from the last operation anymore
   case X86_Reg_Flags:
-    m_Context.flags = *reinterpret_cast<u16 const*>(pValue);
+    m_Context.flags   = *reinterpret_cast<u16 const*>(pValue);
+    m_Context.lazy_op = X86_LazyOp_None;
     break;
   case X86_Reg_Eflags:
   case X86_Reg_Rflags:
-    m_Context.flags = *reinterpret_cast<u32 const*>(pValue);
+    m_Context.flags   = *reinterpret_cast<u32 const*>(pValue);
+    m_Context.lazy_op = X86_LazyOp_None;
     break;
 
+  case X86_Reg_LazyOp:  m_Context.lazy_op  = *reinterpret_cast<u32 const*>(pValue); break;
+  case X86_Reg_LazyDst: m_Context.lazy_dst = *reinterpret_cast<u64 const*>(pValue); break;
+  case X86_Reg_LazySrc: m_Context.lazy_src = *reinterpret_cast<u64 const*>(pValue); break;
+  case X86_Reg_LazyRes: m_Context.lazy_res = *reinterpret_cast<u64 const*>(pValue); break;
+
   case X86_Reg_Al:  WRITE_R_L(a);       break;
   case X86_Reg_Ah:  WRITE_R_H(a);       break;
   case X86_Reg_Bl:  WRITE_R_L(b);       break;
@@ -475,6 +488,10 @@ u16 X86Architecture::X86CpuContext::GetRegisterOffset(u32 Register)
   case X86_Reg_R14:  return OFF_R_R(r14);
   case X86_Reg_R15:  return OFF_R_R(r15);
   case X86_Reg_Rip:  return OFF_R_R(ip);
+  case X86_Reg_LazyOp:  return offsetof(Context, lazy_op);
+  case X86_Reg_LazyDst: return offsetof(Context, lazy_dst);
+  case X86_Reg_LazySrc: return offsetof(Context, lazy_src);
+  case X86_Reg_LazyRes: return offsetof(Context, lazy_res);
   default:           break;
   }
 
@@ -488,6 +505,44 @@ u16 X86Architecture::X86CpuContext::GetRegisterOffset(u32 Register)
   return -1;
 }
 
+bool X86Architecture::X86CpuContext::GetRegisterStorage(u32 Register, u16& rOffset, u8& rReadSize, u8& rWriteSize)
+{
+  u16 Offset = GetRegisterOffset(Register);
+  if (Offset == static_cast<u16>(-1))
+    return false;
+
+  u32 RegSize = m_rCpuInfo.GetSizeOfRegisterInBit(Register) / 8;
+  if (RegSize != 1 && RegSize != 2 && RegSize != 4 && RegSize != 8)
+    return false;
+
+  rOffset    = Offset;
+  rReadSize  = static_cast<u8>(RegSize);
+  rWriteSize = static_cast<u8>(RegSize);
+
+  // Keep in sync with ReadRegister and WriteRegister
+  switch (Register)
+  {
+  // Flags can be computed when they're read, so they must be accessed with ReadRegister and WriteRegister
+  case X86_Reg_Flags:
+  case X86_Reg_Eflags:
+  case X86_Reg_Rflags:
+    return false;
+
+  case X86_Reg_Eax:  case X86_Reg_Ebx:  case X86_Reg_Ecx:  case X86_Reg_Edx:
+  case X86_Reg_Esp:  case X86_Reg_Ebp:  case X86_Reg_Esi:  case X86_Reg_Edi:
+  case X86_Reg_R8d:  case X86_Reg_R9d:  case X86_Reg_R10d: case X86_Reg_R11d:
+  case X86_Reg_R12d: case X86_Reg_R13d: case X86_Reg_R14d: case X86_Reg_R15d:
+  case X86_Reg_Eip:
+    rWriteSize = sizeof(X86Register);
+    break;
+
+  default:
+    break;
+  }
+
+  return true;
+}
+
 void X86Architecture::X86CpuContext::GetRegisters(RegisterList& RegList) const
 {
   switch (m_rCfg.Get("Bit"))
@@ -559,16 +614,17 @@ std::string X86Architecture::X86CpuContext::ToString(void) const
 {
   std::string Result = "";
 
+  u32 Flags = GetFlags();
   std::string FmtFlags = "";
-  FmtFlags += (m_Context.flags & (1 << X86_CfBit)) ? 'C' : 'c';
-  FmtFlags += (m_Context.flags & (1 << X86_PfBit)) ? 'P' : 'p';
-  FmtFlags += (m_Context.flags & (1 << X86_AfBit)) ? 'A' : 'a';
-  FmtFlags += (m_Context.flags & (1 << X86_ZfBit)) ? 'Z' : 'z';
-  FmtFlags += (m_Context.flags & (1 << X86_SfBit)) ? 'S' : 's';
-  FmtFlags += (m_Context.flags & (1 << X86_TfBit)) ? 'T' : 't';
-  FmtFlags += (m_Context.flags & (1 << X86_IfBit)) ? 'I' : 'i';
-  FmtFlags += (m_Context.flags & (1 << X86_DfBit)) ? 'D' : 'd';
-  FmtFlags += (m_Context.flags & (1 << X86_OfBit)) ? 'O' : 'o';
+  FmtFlags += (Flags & (1 << X86_CfBit)) ? 'C' : 'c';
+  FmtFlags += (Flags & (1 << X86_PfBit)) ? 'P' : 'p';
+  FmtFlags += (Flags & (1 << X86_AfBit)) ? 'A' : 'a';
+  FmtFlags += (Flags & (1 << X86_ZfBit)) ? 'Z' : 'z';
+  FmtFlags += (Flags & (1 << X86_SfBit)) ? 'S' : 's';
+  FmtFlags += (Flags & (1 << X86_TfBit)) ? 'T' : 't';
+  FmtFlags += (Flags & (1 << X86_IfBit)) ? 'I' : 'i';
+  FmtFlags += (Flags & (1 << X86_DfBit)) ? 'D' : 'd';
+  FmtFlags += (Flags & (1 << X86_OfBit)) ? 'O' : 'o';
 
   switch (m_rCfg.Get("Bit"))
   {
@@ -602,4 +658,55 @@ std::string X86Architecture::X86CpuContext::ToString(void) const
     % m_Context.cs % m_Context.ds % m_Context.es % m_Context.ss % m_Context.fs % m_Context.gs).str();
   Result += "\n";
   return Result;
-}
\ No newline at end of file
+}
+
+u32 X86Architecture::X86CpuContext::GetFlags(void) const
+{
+  u32 LazyOp  = m_Context.lazy_op;
+  u32 Pending = LazyOp & ((1 << X86_LazyOp_CarryBit) - 1);
+  u32 Bit     = (LazyOp >> X86_LazyOp_SizeBit) & 0xff;
+  if (Pending == 0 || Bit == 0)
+    return m_Context.flags;
+
+  u64 Mask    = Bit >= 64 ? ~0ULL : ((1ULL << Bit) - 1);
+  u64 SignBit = 1ULL << (Bit - 1);
+  u64 Dst     = m_Context.lazy_dst & Mask;
+  u64 Src     = m_Context.lazy_src & Mask;
+  u64 Res     = m_Context.lazy_res & Mask;
+
+  // Adc and sbb results contain the carry, it's computed back from the operands
+  u32  Op = LazyOp >> X86_LazyOp_OpBit;
+  bool Cf = false, Of = false;
+  switch (Op)
+  {
+  case X86_LazyOp_Add: Cf = Res < Dst;                                           Of = ((Dst ^ Res) & (Src ^ Res) & SignBit) != 0; break;
+  case X86_LazyOp_Adc: Cf = ((Res - Dst - Src) & Mask) ? Res <= Dst : Res < Dst; Of = ((Dst ^ Res) & (Src ^ Res) & SignBit) != 0; break;
+  case X86_LazyOp_Sub: Cf = Dst < Src;                                           Of = ((Dst ^ Src) & (Dst ^ Res) & SignBit) != 0; break;
+  case X86_LazyOp_Sbb: Cf = ((Dst - Src - Res) & Mask) ? Dst <= Src : Dst < Src; Of = ((Dst ^ Src) & (Dst ^ Res) & SignBit) != 0; break;
+  case X86_LazyOp_Inc: Cf = (LazyOp & (1 << X86_LazyOp_CarryBit)) != 0;          Of = Res == SignBit;                             break;
+  case X86_LazyOp_Dec: Cf = (LazyOp & (1 << X86_LazyOp_CarryBit)) != 0;          Of = Res == SignBit - 1;                         break;
+  default:             break;
+  }
+
+  u32 Flags = 0;
+  if (Cf)
+    Flags |= 1 << X86_CfBit;
+  if (Of)
+    Flags |= 1 << X86_OfBit;
+  if (Op != X86_LazyOp_Logic && ((Dst ^ Src ^ Res) & 0x10))
+    Flags |= 1 << X86_AfBit;
+  if (Res == 0)
+    Flags |= 1 << X86_ZfBit;
+  if (Res & SignBit)
+    Flags |= 1 << X86_SfBit;
+
+  // The parity flag only depends on the least significant byte
+  u8 Parity = static_cast<u8>(Res);
+  Parity ^= Parity >> 4;
+  Parity ^= Parity >> 2;
+  Parity ^= Parity >> 1;
+  if (!(Parity & 1))
+    Flags |= 1 << X86_PfBit;
+
+  return (m_Context.flags & ~Pending) | (Flags & Pending);
+}
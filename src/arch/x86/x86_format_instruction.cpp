@@ -70,6 +70,52 @@ bool X86Architecture::FormatInstruction(
   return true;
 }
 
+bool X86Architecture::FormatInstruction(
+  Document      const& rDoc,
+  BinaryStream  const& rBinStrm,
+  Address       const& rAddr,
+  Instruction   const& rInsn,
+  FormatBuffer       & rBuf) const
+{
+  size_t BegLength = rBuf.GetLength();
+
+  if (rInsn.GetPrefix())
+  {
+    if (rInsn.GetPrefix() & X86_Prefix_Lock)
+      rBuf.Append("lock ");
+    else if (rInsn.GetPrefix() & X86_Prefix_RepNz)
+      rBuf.Append("repnz ");
+    else if (rInsn.GetPrefix() & X86_Prefix_Rep)
+    {
+      // 0xF3 is only used as REPZ prefix for cmps and scas instructions.
+      if (rInsn.GetOpcode() == X86_Opcode_Cmps || rInsn.GetOpcode() == X86_Opcode_Scas)
+        rBuf.Append("repz ");
+      else
+        rBuf.Append("rep ");
+    }
+  }
+
+  rBuf.Append(m_Mnemonic[rInsn.GetOpcode()]);
+  rBuf.Append(' ');
+  rBuf.AddMark(Cell::Mark::MnemonicType, rBuf.GetLength() - BegLength);
+
+  for (unsigned int i = 0; i < OPERAND_NO; ++i)
+  {
+    Operand const* pOprd = rInsn.Operand(i);
+    if (pOprd == nullptr)
+      break;
+    if (pOprd->GetType() == O_NONE)
+      break;
+
+    if (i != 0)
+      rBuf.Append(Cell::Mark::OperatorType, ", ");
+
+    FormatOperand(rBuf, rDoc, rAddr.GetOffset(), rInsn, pOprd);
+  }
+
+  return true;
+}
+
 void X86Architecture::ApplySegmentOverridePrefix(Instruction& rInsn, Operand* pOprd)
 {
   if (rInsn.GetPrefix() && pOprd->GetType() & O_MEM)
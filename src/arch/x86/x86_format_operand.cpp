@@ -236,4 +236,182 @@ void X86Architecture::FormatOperand(
     rInsnBuf << pRegName;
     rMarks.push_back(Cell::Mark(Cell::Mark::RegisterType, strlen(pRegName)));
   }
-}
\ No newline at end of file
+}
+static char const* X86_GetAccessType(u32 OprdType)
+{
+  switch (OprdType & MS_MASK)
+  {
+  case MS_8BIT:   return "byte ";
+  case MS_16BIT:  return "word ";
+  case MS_32BIT:  return "dword ";
+  case MS_64BIT:  return "qword ";
+  case MS_80BIT:  return "tword ";
+  case MS_128BIT: return "oword ";
+  default:        return "";
+  }
+}
+
+// This version must produce exactly the same text and marks than the std::ostringstream one
+void X86Architecture::FormatOperand(
+  FormatBuffer       & rBuf,
+  Document      const& rDoc,
+  TOffset              Offset,
+  Instruction   const& rInsn,
+  Operand       const* pOprd) const
+{
+  u32 OprdType = pOprd->GetType();
+
+  if (OprdType & O_REG_PC_REL)
+  {
+    Label OprdLabel = rDoc.GetLabelFromAddress(Address(Address::FlatType, pOprd->GetSegValue(), rInsn.GetLength() + pOprd->GetValue() + Offset));
+    if (OprdLabel.GetType() != Label::Unknown)
+    {
+      if (OprdType & O_MEM)
+      {
+        rBuf.Append(Cell::Mark::KeywordType, X86_GetAccessType(OprdType));
+        rBuf.Append(Cell::Mark::OperatorType, "[");
+        rBuf.AddMark(Cell::Mark::LabelType, rBuf.AppendLabel(OprdLabel));
+        rBuf.Append(Cell::Mark::OperatorType, "]");
+      }
+      else
+        rBuf.AddMark(Cell::Mark::LabelType, rBuf.AppendLabel(OprdLabel));
+      return;
+    }
+  }
+
+  if (OprdType & O_IMM)
+  {
+    Label OprdLabel = rDoc.GetLabelFromAddress(Address(Address::FlatType, pOprd->GetSegValue(), pOprd->GetValue()));
+
+    if (OprdLabel.GetType() != Label::Unknown)
+    {
+      rBuf.AddMark(Cell::Mark::LabelType, rBuf.AppendLabel(OprdLabel));
+      return;
+    }
+
+    size_t ImmLen;
+    switch (OprdType & DS_MASK)
+    {
+    case DS_8BIT:  ImmLen = rBuf.AppendHex(static_cast<u8> (pOprd->GetValue()),  2); break;
+    case DS_16BIT: ImmLen = rBuf.AppendHex(static_cast<u16>(pOprd->GetValue()),  4); break;
+    case DS_32BIT: ImmLen = rBuf.AppendHex(static_cast<u32>(pOprd->GetValue()),  8); break;
+    case DS_64BIT: ImmLen = rBuf.AppendHex(                 pOprd->GetValue(),  16); break;
+    default:       ImmLen = rBuf.AppendHex(                 pOprd->GetValue()     ); break;
+    }
+    rBuf.AddMark(Cell::Mark::ImmediateType, ImmLen);
+    return;
+  }
+
+  if (OprdType & O_REL)
+  {
+    TOffset OprdOff = Offset + rInsn.GetLength();
+    switch (OprdType & DS_MASK)
+    {
+    case DS_8BIT:  OprdOff += static_cast<s8> (pOprd->GetValue()); break;
+    case DS_16BIT: OprdOff += static_cast<s16>(pOprd->GetValue()); break;
+    case DS_32BIT: OprdOff += static_cast<s32>(pOprd->GetValue()); break;
+    case DS_64BIT: OprdOff += static_cast<s64>(pOprd->GetValue()); break;
+    default:       OprdOff += pOprd->GetValue();                   break;
+    }
+    Label OprdLabel = rDoc.GetLabelFromAddress(Address(Address::FlatType, pOprd->GetSegValue(), OprdOff));
+    if (OprdLabel.GetType() != Label::Unknown)
+    {
+      rBuf.AddMark(Cell::Mark::LabelType, rBuf.AppendLabel(OprdLabel));
+      return;
+    }
+
+    size_t RelLen;
+    switch (OprdType & DS_MASK)
+    {
+    case DS_8BIT:  RelLen = rBuf.AppendHex(static_cast<u8> (OprdOff),  2); break;
+    case DS_16BIT: RelLen = rBuf.AppendHex(static_cast<u16>(OprdOff),  4); break;
+    case DS_32BIT: RelLen = rBuf.AppendHex(static_cast<u32>(OprdOff),  8); break;
+    case DS_64BIT: RelLen = rBuf.AppendHex(                 OprdOff,  16); break;
+    default:       RelLen = rBuf.AppendHex(                 OprdOff     ); break;
+    }
+    rBuf.AddMark(Cell::Mark::ImmediateType, RelLen);
+    return;
+  }
+
+  if (OprdType & O_MEM)
+  {
+    rBuf.Append(Cell::Mark::KeywordType, X86_GetAccessType(OprdType));
+
+    if (OprdType & O_SEG)
+    {
+      rBuf.Append(Cell::Mark::RegisterType, m_CpuInfo.ConvertIdentifierToName(pOprd->GetSeg()));
+      rBuf.Append(Cell::Mark::OperatorType, ":");
+    }
+
+    if (OprdType & O_SEG_VAL)
+    {
+      rBuf.AddMark(Cell::Mark::ImmediateType, rBuf.AppendHex(pOprd->GetSeg(), 4, false));
+      rBuf.Append(Cell::Mark::OperatorType, ":");
+    }
+
+    rBuf.Append(Cell::Mark::OperatorType, "[");
+
+    if (OprdType & O_REG && pOprd->GetReg() != X86_Reg_Unknown)
+      rBuf.Append(Cell::Mark::RegisterType, m_CpuInfo.ConvertIdentifierToName(pOprd->GetReg()));
+
+    if (OprdType & O_SREG && pOprd->GetSecReg() != X86_Reg_Unknown)
+    {
+      if (pOprd->GetReg() != X86_Reg_Unknown)
+        rBuf.Append(Cell::Mark::OperatorType, " + ");
+
+      rBuf.Append(Cell::Mark::RegisterType, m_CpuInfo.ConvertIdentifierToName(pOprd->GetSecReg()));
+    }
+
+    if (OprdType & O_SCALE && pOprd->GetSecReg() != X86_Reg_Unknown)
+    {
+      char const* pScaleValue = "1";
+      switch (OprdType & SC_MASK)
+      {
+      case SC_2: pScaleValue = "2"; break;
+      case SC_4: pScaleValue = "4"; break;
+      case SC_8: pScaleValue = "8"; break;
+      }
+      rBuf.Append(Cell::Mark::OperatorType, " * ");
+      rBuf.Append(Cell::Mark::ImmediateType, pScaleValue);
+    }
+
+    if (OprdType & O_DISP)
+    {
+      u64 Disp;
+      switch (OprdType & DS_MASK)
+      {
+      case DS_8BIT:  Disp = SignExtend<s64,  8>(pOprd->GetValue()); break;
+      case DS_16BIT: Disp = SignExtend<s64, 16>(pOprd->GetValue()); break;
+      case DS_32BIT: Disp = SignExtend<s64, 32>(pOprd->GetValue()); break;
+      default:       Disp = pOprd->GetValue(); break;
+      }
+
+      if (pOprd->GetReg() != 0x0 || pOprd->GetSecReg() != 0x0)
+        rBuf.Append(Cell::Mark::OperatorType, " + ");
+
+      Address AddrDst(pOprd->GetSegValue(), Disp);
+      Label const& Lbl = rDoc.GetLabelFromAddress(AddrDst);
+      if (Lbl.GetType() != Label::Unknown)
+        rBuf.AddMark(Cell::Mark::LabelType, rBuf.AppendLabel(Lbl));
+      else
+      {
+        size_t DispLen;
+        switch (OprdType & AS_MASK)
+        {
+        case AS_8BIT:  DispLen = rBuf.AppendHex(static_cast<u32>(Disp),  2); break;
+        case AS_16BIT: DispLen = rBuf.AppendHex(static_cast<u16>(Disp),  4); break;
+        case AS_32BIT: DispLen = rBuf.AppendHex(static_cast<u32>(Disp),  8); break;
+        case AS_64BIT: DispLen = rBuf.AppendHex(                 Disp,  16); break;
+        default:       DispLen = rBuf.AppendHex(                 Disp     ); break;
+        }
+        rBuf.AddMark(Cell::Mark::ImmediateType, DispLen);
+      }
+    }
+
+    rBuf.Append(Cell::Mark::OperatorType, "]");
+    return;
+  }
+
+  if (OprdType & O_REG)
+    rBuf.Append(Cell::Mark::RegisterType, m_CpuInfo.ConvertIdentifierToName(pOprd->GetReg()));
+}
@@ -0,0 +1,140 @@
+#include "x86_architecture.hpp"
+
+static u8 GetModRmLength(u8 ModRmByte, u8 SibByte, bool AdSize16)
+{
+  u8 Mod = ModRmByte >> 6;
+  u8 Rm  = ModRmByte & 7;
+
+  if (Mod == 3)
+    return 0;
+
+  if (AdSize16)
+  {
+    if (Mod == 0)
+      return Rm == 6 ? 2 : 0;
+    return Mod == 1 ? 1 : 2;
+  }
+
+  u8 Len = 0;
+  if (Rm == 4)
+  {
+    Len++;
+    if (Mod == 0 && (SibByte & 7) == 5)
+      return Len + 4;
+  }
+
+  if (Mod == 0)
+    return Rm == 5 ? Len + 4 : Len;
+  return Mod == 1 ? Len + 1 : Len + 4;
+}
+
+bool X86Architecture::GetInstructionLength(BinaryStream const& rBinStrm, TOffset Offset, u8 Mode, u16& rLength)
+{
+  u16 const* pMap = m_Length_1;
+  TOffset CurOff  = Offset;
+  bool OpSize     = false;
+  bool AdSize     = false;
+  bool RexW       = false;
+  u16 Attr;
+
+  for (;;)
+  {
+    // A run of prefixes can't go beyond the longest instruction
+    if (CurOff - Offset >= X86_MAX_INSN_LENGTH)
+      return false;
+
+    u8 Opcode;
+    if (!rBinStrm.Read(CurOff, Opcode))
+      return false;
+    CurOff++;
+
+    Attr = pMap[Opcode];
+    u8 Arg = static_cast<u8>((Attr & X86_Len_ArgMask) >> X86_Len_ArgShift);
+
+    if (Attr & X86_Len_Prefix64)
+    {
+      if (Mode == X86_Bit_64)
+      {
+        if ((Opcode & 0xf0) == 0x40)
+          RexW = (Opcode & 0x8) ? true : false;
+        CurOff += Arg;
+        continue;
+      }
+
+      // Outside 64-bit mode, the opcode is decoded as the instruction which shares it (or is invalid)
+      Attr &= ~(X86_Len_Prefix64 | X86_Len_ArgMask);
+    }
+
+    else if (Attr & X86_Len_Prefix)
+    {
+      // REX is ignored if it's not the last prefix
+      RexW = false;
+      if (Opcode == 0x66)
+        OpSize = true;
+      else if (Opcode == 0x67)
+        AdSize = true;
+      CurOff += Arg;
+      continue;
+    }
+
+    else if (Attr & X86_Len_Escape)
+    {
+      pMap = m_LengthMap[Arg];
+      continue;
+    }
+
+    break;
+  }
+
+  u8 ModRmByte = 0;
+  u8 SibByte   = 0;
+  if (Attr & X86_Len_ModRm)
+  {
+    if (!rBinStrm.Read(CurOff, ModRmByte))
+      return false;
+    rBinStrm.Read(CurOff + 1, SibByte);
+
+    if (Attr & X86_Len_Group)
+      Attr = m_LengthGroup[(Attr & X86_Len_ArgMask) >> X86_Len_ArgShift][(ModRmByte >> 3) & 7];
+  }
+
+  if (Attr & X86_Len_Invalid)
+    return false;
+  if ((Attr & X86_Len_Invalid64) && Mode == X86_Bit_64)
+    return false;
+
+  if (Attr & X86_Len_Fallback)
+  {
+    Instruction Insn;
+    if (!Disassemble(rBinStrm, Offset, Insn, Mode, DisasmDecodeOnly))
+      return false;
+    rLength = static_cast<u16>(Insn.GetLength());
+    return rLength != 0;
+  }
+
+  bool OpSize16 = (Mode == X86_Bit_16) != OpSize;
+  bool AdSize16 = Mode != X86_Bit_64 && (Mode == X86_Bit_16) != AdSize;
+
+  if (Attr & X86_Len_ModRm)
+    CurOff += 1 + GetModRmLength(ModRmByte, SibByte, AdSize16);
+
+  u8 ImmSize = 0;
+  switch (Attr & X86_Len_ImmMask)
+  {
+  case X86_Len_Ib:    ImmSize = 1; break;
+  case X86_Len_Iw:    ImmSize = 2; break;
+  case X86_Len_Iz:    ImmSize = OpSize16 ? 2 : 4; break;
+  case X86_Len_Iv:    ImmSize = (Mode == X86_Bit_64 && RexW) ? 8 : (OpSize16 ? 2 : 4); break;
+  case X86_Len_Ap:    ImmSize = OpSize16 ? 4 : 6; break;
+  case X86_Len_Ov:    ImmSize = (Mode == X86_Bit_64) ? (AdSize ? 4 : 8) : (AdSize16 ? 2 : 4); break;
+  case X86_Len_Iw_Ib: ImmSize = 3; break;
+  default:                         break;
+  }
+  CurOff += ImmSize;
+
+  if (CurOff - Offset > X86_MAX_INSN_LENGTH)
+    return false;
+
+  rLength = static_cast<u16>(CurOff - Offset);
+  return true;
+}
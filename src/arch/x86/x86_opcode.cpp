@@ -1,4 +1,4 @@
-/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Feb 23 20:08:51 2014) */
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Mon Oct 19 01:30:23 2026) */
 #include "x86_architecture.hpp"
 const char *X86Architecture::m_Mnemonic[0x371] =
 {
@@ -3004,29 +3004,7 @@ bool X86Architecture::Table_1_00(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0001);
     return true;
 }
 
@@ -3046,29 +3024,7 @@ bool X86Architecture::Table_1_01(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0001);
     return true;
 }
 
@@ -3088,29 +3044,7 @@ bool X86Architecture::Table_1_02(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0001);
     return true;
 }
 
@@ -3130,29 +3064,7 @@ bool X86Architecture::Table_1_03(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0001);
     return true;
 }
 
@@ -3172,29 +3084,7 @@ bool X86Architecture::Table_1_04(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0001);
     return true;
 }
 
@@ -3214,29 +3104,7 @@ bool X86Architecture::Table_1_05(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0001);
     return true;
 }
 
@@ -3257,26 +3125,7 @@ bool X86Architecture::Table_1_06(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -3300,26 +3149,7 @@ bool X86Architecture::Table_1_07(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -3344,30 +3174,7 @@ bool X86Architecture::Table_1_08(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val | op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpOr,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0004);
     return true;
 }
 
@@ -3389,30 +3196,7 @@ bool X86Architecture::Table_1_09(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val | op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpOr,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0004);
     return true;
 }
 
@@ -3434,30 +3218,7 @@ bool X86Architecture::Table_1_0a(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val | op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpOr,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0004);
     return true;
 }
 
@@ -3479,30 +3240,7 @@ bool X86Architecture::Table_1_0b(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val | op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpOr,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0004);
     return true;
 }
 
@@ -3524,30 +3262,7 @@ bool X86Architecture::Table_1_0c(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val | op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpOr,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0004);
     return true;
 }
 
@@ -3569,30 +3284,7 @@ bool X86Architecture::Table_1_0d(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val | op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpOr,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0004);
     return true;
 }
 
@@ -3613,26 +3305,7 @@ bool X86Architecture::Table_1_0e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -3674,32 +3347,7 @@ bool X86Architecture::Table_1_10(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val + extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0005);
     return true;
 }
 
@@ -3721,32 +3369,7 @@ bool X86Architecture::Table_1_11(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val + extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0005);
     return true;
 }
 
@@ -3768,32 +3391,7 @@ bool X86Architecture::Table_1_12(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val + extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0005);
     return true;
 }
 
@@ -3815,32 +3413,7 @@ bool X86Architecture::Table_1_13(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val + extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0005);
     return true;
 }
 
@@ -3862,32 +3435,7 @@ bool X86Architecture::Table_1_14(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val + extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0005);
     return true;
 }
 
@@ -3909,32 +3457,7 @@ bool X86Architecture::Table_1_15(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val + op1.val + extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0005);
     return true;
 }
 
@@ -3955,26 +3478,7 @@ bool X86Architecture::Table_1_16(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -3998,26 +3502,7 @@ bool X86Architecture::Table_1_17(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -4042,32 +3527,7 @@ bool X86Architecture::Table_1_18(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val - extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0006);
     return true;
 }
 
@@ -4089,32 +3549,7 @@ bool X86Architecture::Table_1_19(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val - extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0006);
     return true;
 }
 
@@ -4136,32 +3571,7 @@ bool X86Architecture::Table_1_1a(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val - extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0006);
     return true;
 }
 
@@ -4183,32 +3593,7 @@ bool X86Architecture::Table_1_1b(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val - extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0006);
     return true;
 }
 
@@ -4230,32 +3615,7 @@ bool X86Architecture::Table_1_1c(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val - extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0006);
     return true;
 }
 
@@ -4277,32 +3637,7 @@ bool X86Architecture::Table_1_1d(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val - extract_flag(cf) */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-          ExtractFlag(rInsn, X86_FlCf)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0006);
     return true;
 }
 
@@ -4323,26 +3658,7 @@ bool X86Architecture::Table_1_1e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -4366,26 +3682,7 @@ bool X86Architecture::Table_1_1f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -4410,30 +3707,7 @@ bool X86Architecture::Table_1_20(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAnd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0007);
     return true;
 }
 
@@ -4455,30 +3729,7 @@ bool X86Architecture::Table_1_21(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAnd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0007);
     return true;
 }
 
@@ -4500,30 +3751,7 @@ bool X86Architecture::Table_1_22(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAnd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0007);
     return true;
 }
 
@@ -4545,30 +3773,7 @@ bool X86Architecture::Table_1_23(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAnd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0007);
     return true;
 }
 
@@ -4590,30 +3795,7 @@ bool X86Architecture::Table_1_24(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAnd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0007);
     return true;
 }
 
@@ -4635,30 +3817,7 @@ bool X86Architecture::Table_1_25(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAnd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0007);
     return true;
 }
 
@@ -4671,7 +3830,7 @@ bool X86Architecture::Table_1_26(BinaryStream const& rBinStrm, TOffset Offset, I
 {
     rInsn.Length()++;
     rInsn.Prefix() |= X86_Prefix_ES;
-    return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+    return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
 }
 
 /** instruction
@@ -4691,11 +3850,7 @@ bool X86Architecture::Table_1_27(BinaryStream const& rBinStrm, TOffset Offset, I
       rInsn.SetTestedFlags(X86_FlAf | X86_FlCf);
       rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
       rInsn.SetClearedFlags(X86_FlOf);
-      {
-        Expression::List AllExpr;
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlOf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0008);
       return true;
     }
     else
@@ -4718,29 +3873,7 @@ bool X86Architecture::Table_1_28(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0009);
     return true;
 }
 
@@ -4760,29 +3893,7 @@ bool X86Architecture::Table_1_29(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0009);
     return true;
 }
 
@@ -4802,29 +3913,7 @@ bool X86Architecture::Table_1_2a(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0009);
     return true;
 }
 
@@ -4844,29 +3933,7 @@ bool X86Architecture::Table_1_2b(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0009);
     return true;
 }
 
@@ -4886,29 +3953,7 @@ bool X86Architecture::Table_1_2c(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0009);
     return true;
 }
 
@@ -4928,29 +3973,7 @@ bool X86Architecture::Table_1_2d(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0009);
     return true;
 }
 
@@ -4971,13 +3994,13 @@ bool X86Architecture::Table_1_2e(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_HintNotTaken;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_CS;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
 }
 
@@ -4998,11 +4021,7 @@ bool X86Architecture::Table_1_2f(BinaryStream const& rBinStrm, TOffset Offset, I
       rInsn.SetTestedFlags(X86_FlAf | X86_FlCf);
       rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
       rInsn.SetClearedFlags(X86_FlOf);
-      {
-        Expression::List AllExpr;
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlOf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0008);
       return true;
     }
     else
@@ -5027,30 +4046,7 @@ bool X86Architecture::Table_1_30(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val ^ op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpXor,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000a);
     return true;
 }
 
@@ -5072,30 +4068,7 @@ bool X86Architecture::Table_1_31(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val ^ op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpXor,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000a);
     return true;
 }
 
@@ -5117,30 +4090,7 @@ bool X86Architecture::Table_1_32(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val ^ op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpXor,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000a);
     return true;
 }
 
@@ -5162,30 +4112,7 @@ bool X86Architecture::Table_1_33(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val ^ op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpXor,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000a);
     return true;
 }
 
@@ -5207,30 +4134,7 @@ bool X86Architecture::Table_1_34(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val ^ op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpXor,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000a);
     return true;
 }
 
@@ -5252,30 +4156,7 @@ bool X86Architecture::Table_1_35(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val ^ op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpXor,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      auto pExpr3 = /* Semantic: op0.val = res */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr3);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000a);
     return true;
 }
 
@@ -5288,7 +4169,7 @@ bool X86Architecture::Table_1_36(BinaryStream const& rBinStrm, TOffset Offset, I
 {
     rInsn.Length()++;
     rInsn.Prefix() |= X86_Prefix_SS;
-    return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+    return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
 }
 
 /** instruction
@@ -5305,11 +4186,7 @@ bool X86Architecture::Table_1_37(BinaryStream const& rBinStrm, TOffset Offset, I
     rInsn.SetTestedFlags(X86_FlAf | X86_FlCf);
     rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
     rInsn.SetClearedFlags(X86_FlOf);
-    {
-      Expression::List AllExpr;
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlOf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0008);
     return true;
 }
 
@@ -5329,24 +4206,7 @@ bool X86Architecture::Table_1_38(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000b);
     return true;
 }
 
@@ -5366,24 +4226,7 @@ bool X86Architecture::Table_1_39(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000b);
     return true;
 }
 
@@ -5403,24 +4246,7 @@ bool X86Architecture::Table_1_3a(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000b);
     return true;
 }
 
@@ -5440,24 +4266,7 @@ bool X86Architecture::Table_1_3b(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000b);
     return true;
 }
 
@@ -5477,24 +4286,7 @@ bool X86Architecture::Table_1_3c(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000b);
     return true;
 }
 
@@ -5514,24 +4306,7 @@ bool X86Architecture::Table_1_3d(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x000b);
     return true;
 }
 
@@ -5552,13 +4327,13 @@ bool X86Architecture::Table_1_3e(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_HintTaken;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_DS;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
 }
 
@@ -5579,11 +4354,7 @@ bool X86Architecture::Table_1_3f(BinaryStream const& rBinStrm, TOffset Offset, I
       rInsn.SetTestedFlags(X86_FlAf);
       rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
       rInsn.SetClearedFlags(X86_FlOf | X86_FlSf | X86_FlZf | X86_FlPf);
-      {
-        Expression::List AllExpr;
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlOf | X86_FlSf | X86_FlZf | X86_FlPf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000c);
       return true;
     }
     else
@@ -5609,7 +4380,7 @@ bool X86Architecture::Table_1_40(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -5620,29 +4391,7 @@ bool X86Architecture::Table_1_40(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000d);
       return true;
     }
 }
@@ -5666,7 +4415,7 @@ bool X86Architecture::Table_1_41(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_b;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -5677,29 +4426,7 @@ bool X86Architecture::Table_1_41(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000d);
       return true;
     }
 }
@@ -5723,7 +4450,7 @@ bool X86Architecture::Table_1_42(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_x;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -5734,29 +4461,7 @@ bool X86Architecture::Table_1_42(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000d);
       return true;
     }
 }
@@ -5780,7 +4485,7 @@ bool X86Architecture::Table_1_43(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_xb;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -5791,29 +4496,7 @@ bool X86Architecture::Table_1_43(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000d);
       return true;
     }
 }
@@ -5837,7 +4520,7 @@ bool X86Architecture::Table_1_44(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_r;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -5848,29 +4531,7 @@ bool X86Architecture::Table_1_44(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000d);
       return true;
     }
 }
@@ -5894,7 +4555,7 @@ bool X86Architecture::Table_1_45(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_rb;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -5905,29 +4566,7 @@ bool X86Architecture::Table_1_45(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000d);
       return true;
     }
 }
@@ -5951,7 +4590,7 @@ bool X86Architecture::Table_1_46(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_rx;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -5962,29 +4601,7 @@ bool X86Architecture::Table_1_46(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000d);
       return true;
     }
 }
@@ -6008,7 +4625,7 @@ bool X86Architecture::Table_1_47(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_rxb;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -6019,29 +4636,7 @@ bool X86Architecture::Table_1_47(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000d);
       return true;
     }
 }
@@ -6065,7 +4660,7 @@ bool X86Architecture::Table_1_48(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_w;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -6076,29 +4671,7 @@ bool X86Architecture::Table_1_48(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000e);
       return true;
     }
 }
@@ -6122,7 +4695,7 @@ bool X86Architecture::Table_1_49(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_wb;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -6133,29 +4706,7 @@ bool X86Architecture::Table_1_49(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000e);
       return true;
     }
 }
@@ -6179,7 +4730,7 @@ bool X86Architecture::Table_1_4a(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_wx;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -6190,29 +4741,7 @@ bool X86Architecture::Table_1_4a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000e);
       return true;
     }
 }
@@ -6236,7 +4765,7 @@ bool X86Architecture::Table_1_4b(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_wxb;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -6247,29 +4776,7 @@ bool X86Architecture::Table_1_4b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000e);
       return true;
     }
 }
@@ -6293,7 +4800,7 @@ bool X86Architecture::Table_1_4c(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_wr;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -6304,29 +4811,7 @@ bool X86Architecture::Table_1_4c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000e);
       return true;
     }
 }
@@ -6350,7 +4835,7 @@ bool X86Architecture::Table_1_4d(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_wrb;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -6361,29 +4846,7 @@ bool X86Architecture::Table_1_4d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000e);
       return true;
     }
 }
@@ -6407,7 +4870,7 @@ bool X86Architecture::Table_1_4e(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_wrx;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -6418,29 +4881,7 @@ bool X86Architecture::Table_1_4e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000e);
       return true;
     }
 }
@@ -6464,7 +4905,7 @@ bool X86Architecture::Table_1_4f(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_REX_wrxb;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -6475,29 +4916,7 @@ bool X86Architecture::Table_1_4f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000e);
       return true;
     }
 }
@@ -6526,26 +4945,7 @@ bool X86Architecture::Table_1_50(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -6560,26 +4960,7 @@ bool X86Architecture::Table_1_50(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
 }
@@ -6608,26 +4989,7 @@ bool X86Architecture::Table_1_51(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -6642,26 +5004,7 @@ bool X86Architecture::Table_1_51(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
 }
@@ -6690,26 +5033,7 @@ bool X86Architecture::Table_1_52(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -6724,26 +5048,7 @@ bool X86Architecture::Table_1_52(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
 }
@@ -6772,26 +5077,7 @@ bool X86Architecture::Table_1_53(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -6806,26 +5092,7 @@ bool X86Architecture::Table_1_53(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
 }
@@ -6854,26 +5121,7 @@ bool X86Architecture::Table_1_54(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -6888,26 +5136,7 @@ bool X86Architecture::Table_1_54(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
 }
@@ -6941,26 +5170,7 @@ bool X86Architecture::Table_1_55(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -6975,26 +5185,7 @@ bool X86Architecture::Table_1_55(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
 }
@@ -7028,26 +5219,7 @@ bool X86Architecture::Table_1_56(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -7062,26 +5234,7 @@ bool X86Architecture::Table_1_56(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
 }
@@ -7115,26 +5268,7 @@ bool X86Architecture::Table_1_57(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -7149,26 +5283,7 @@ bool X86Architecture::Table_1_57(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
 }
@@ -7202,26 +5317,7 @@ bool X86Architecture::Table_1_58(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -7236,26 +5332,7 @@ bool X86Architecture::Table_1_58(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
 }
@@ -7289,26 +5366,7 @@ bool X86Architecture::Table_1_59(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -7323,26 +5381,7 @@ bool X86Architecture::Table_1_59(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
 }
@@ -7376,26 +5415,7 @@ bool X86Architecture::Table_1_5a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -7410,26 +5430,7 @@ bool X86Architecture::Table_1_5a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
 }
@@ -7463,26 +5464,7 @@ bool X86Architecture::Table_1_5b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -7497,26 +5479,7 @@ bool X86Architecture::Table_1_5b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
 }
@@ -7550,26 +5513,7 @@ bool X86Architecture::Table_1_5c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -7584,26 +5528,7 @@ bool X86Architecture::Table_1_5c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
 }
@@ -7637,26 +5562,7 @@ bool X86Architecture::Table_1_5d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -7671,26 +5577,7 @@ bool X86Architecture::Table_1_5d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
 }
@@ -7724,26 +5611,7 @@ bool X86Architecture::Table_1_5e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -7758,26 +5626,7 @@ bool X86Architecture::Table_1_5e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
 }
@@ -7811,26 +5660,7 @@ bool X86Architecture::Table_1_5f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -7845,26 +5675,7 @@ bool X86Architecture::Table_1_5f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
 }
@@ -7889,250 +5700,14 @@ bool X86Architecture::Table_1_60(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Pushad);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = eax.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Eax, &m_CpuInfo));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: stack.id -= int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: stack.mem = ecx.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Ecx, &m_CpuInfo));
-        AllExpr.push_back(pExpr3);
-        auto pExpr4 = /* Semantic: stack.id -= int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr4);
-        auto pExpr5 = /* Semantic: stack.mem = edx.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Edx, &m_CpuInfo));
-        AllExpr.push_back(pExpr5);
-        auto pExpr6 = /* Semantic: stack.id -= int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr6);
-        auto pExpr7 = /* Semantic: stack.mem = ebx.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Ebx, &m_CpuInfo));
-        AllExpr.push_back(pExpr7);
-        auto pExpr8 = /* Semantic: stack.id -= int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr8);
-        auto pExpr9 = /* Semantic: stack.mem = esp.id + int(32, 16) */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(X86_Reg_Esp, &m_CpuInfo),
-            new ConstantExpression(0x20, 0x10)));
-        AllExpr.push_back(pExpr9);
-        auto pExpr10 = /* Semantic: stack.id -= int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr10);
-        auto pExpr11 = /* Semantic: stack.mem = ebp.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Ebp, &m_CpuInfo));
-        AllExpr.push_back(pExpr11);
-        auto pExpr12 = /* Semantic: stack.id -= int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr12);
-        auto pExpr13 = /* Semantic: stack.mem = esi.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Esi, &m_CpuInfo));
-        AllExpr.push_back(pExpr13);
-        auto pExpr14 = /* Semantic: stack.id -= int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr14);
-        auto pExpr15 = /* Semantic: stack.mem = edi.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Edi, &m_CpuInfo));
-        AllExpr.push_back(pExpr15);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000f);
       return true;
     }
     else if (m_Cfg.Get("Architecture") >= X86_Arch_80186 && Mode != X86_Bit_64)
     {
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Pusha);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = ax.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Ax, &m_CpuInfo));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: stack.id -= int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: stack.mem = cx.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Cx, &m_CpuInfo));
-        AllExpr.push_back(pExpr3);
-        auto pExpr4 = /* Semantic: stack.id -= int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr4);
-        auto pExpr5 = /* Semantic: stack.mem = dx.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Dx, &m_CpuInfo));
-        AllExpr.push_back(pExpr5);
-        auto pExpr6 = /* Semantic: stack.id -= int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr6);
-        auto pExpr7 = /* Semantic: stack.mem = bx.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Bx, &m_CpuInfo));
-        AllExpr.push_back(pExpr7);
-        auto pExpr8 = /* Semantic: stack.id -= int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr8);
-        auto pExpr9 = /* Semantic: stack.mem = sp.id + int(16, 8) */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(X86_Reg_Sp, &m_CpuInfo),
-            new ConstantExpression(0x10, 0x8)));
-        AllExpr.push_back(pExpr9);
-        auto pExpr10 = /* Semantic: stack.id -= int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr10);
-        auto pExpr11 = /* Semantic: stack.mem = bp.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Bp, &m_CpuInfo));
-        AllExpr.push_back(pExpr11);
-        auto pExpr12 = /* Semantic: stack.id -= int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr12);
-        auto pExpr13 = /* Semantic: stack.mem = si.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Si, &m_CpuInfo));
-        AllExpr.push_back(pExpr13);
-        auto pExpr14 = /* Semantic: stack.id -= int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr14);
-        auto pExpr15 = /* Semantic: stack.mem = di.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new IdentifierExpression(X86_Reg_Di, &m_CpuInfo));
-        AllExpr.push_back(pExpr15);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0010);
       return true;
     }
     return false;
@@ -8158,244 +5733,14 @@ bool X86Architecture::Table_1_61(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Popad);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: edi.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Edi, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: esi.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Esi, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: stack.id += int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr3);
-        auto pExpr4 = /* Semantic: ebp.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Ebp, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr4);
-        auto pExpr5 = /* Semantic: stack.id += int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr5);
-        auto pExpr6 = /* Semantic: esp.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Esp, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr6);
-        auto pExpr7 = /* Semantic: stack.id += int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr7);
-        auto pExpr8 = /* Semantic: ebx.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Ebx, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr8);
-        auto pExpr9 = /* Semantic: stack.id += int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr9);
-        auto pExpr10 = /* Semantic: edx.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Edx, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr10);
-        auto pExpr11 = /* Semantic: stack.id += int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr11);
-        auto pExpr12 = /* Semantic: ecx.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Ecx, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr12);
-        auto pExpr13 = /* Semantic: stack.id += int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr13);
-        auto pExpr14 = /* Semantic: eax.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr14);
-        auto pExpr15 = /* Semantic: stack.id += int(32, 4) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x20, 0x4)));
-        AllExpr.push_back(pExpr15);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0011);
       return true;
     }
     else if (m_Cfg.Get("Architecture") >= X86_Arch_80186 && Mode != X86_Bit_64)
     {
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Popa);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: di.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Di, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: si.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Si, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: stack.id += int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr3);
-        auto pExpr4 = /* Semantic: bp.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Bp, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr4);
-        auto pExpr5 = /* Semantic: stack.id += int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr5);
-        auto pExpr6 = /* Semantic: sp.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Sp, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr6);
-        auto pExpr7 = /* Semantic: stack.id += int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr7);
-        auto pExpr8 = /* Semantic: bx.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Bx, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr8);
-        auto pExpr9 = /* Semantic: stack.id += int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr9);
-        auto pExpr10 = /* Semantic: dx.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Dx, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr10);
-        auto pExpr11 = /* Semantic: stack.id += int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr11);
-        auto pExpr12 = /* Semantic: cx.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Cx, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr12);
-        auto pExpr13 = /* Semantic: stack.id += int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr13);
-        auto pExpr14 = /* Semantic: ax.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr14);
-        auto pExpr15 = /* Semantic: stack.id += int(16, 2) */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(0x10, 0x2)));
-        AllExpr.push_back(pExpr15);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0012);
       return true;
     }
     return false;
@@ -8451,17 +5796,7 @@ bool X86Architecture::Table_1_63(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = sign_extend(op1.val, op0.size) */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(OperationExpression::OpSext, rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true), new ConstantExpression(
-            32,
-            rInsn.Operand(0)->GetLength())));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0013);
       return true;
     }
     else if (m_Cfg.Get("Architecture") == X86_Arch_80286 && Mode != X86_Bit_64)
@@ -8497,13 +5832,13 @@ bool X86Architecture::Table_1_64(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_HintAltTaken;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else if (m_Cfg.Get("Architecture") >= X86_Arch_80386)
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_FS;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     return false;
 }
@@ -8520,7 +5855,7 @@ bool X86Architecture::Table_1_65(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_GS;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
       return false;
@@ -8538,7 +5873,7 @@ bool X86Architecture::Table_1_66(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_OpSize;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
       return false;
@@ -8556,7 +5891,7 @@ bool X86Architecture::Table_1_67(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_AdSize;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     }
     else
       return false;
@@ -8584,26 +5919,7 @@ bool X86Architecture::Table_1_68(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -8631,27 +5947,7 @@ bool X86Architecture::Table_1_69(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op1.val * op2.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpMul,
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(2)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlSf | X86_FlZf | X86_FlAf | X86_FlPf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0014);
       return true;
     }
     else
@@ -8680,26 +5976,7 @@ bool X86Architecture::Table_1_6a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -8727,27 +6004,7 @@ bool X86Architecture::Table_1_6b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op1.val * op2.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpMul,
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(2)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlSf | X86_FlZf | X86_FlAf | X86_FlPf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0014);
       return true;
     }
     else
@@ -8868,18 +6125,7 @@ bool X86Architecture::Table_1_70(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_flags(of): program.id = op0.val */
-      new IfConditionExpression(
-        TestFlags(rInsn, X86_FlOf),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0015);
     return true;
 }
 
@@ -8901,18 +6147,7 @@ bool X86Architecture::Table_1_71(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_not_flags(of): program.id = op0.val */
-      new IfConditionExpression(
-        TestNotFlags(rInsn, X86_FlOf),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0016);
     return true;
 }
 
@@ -8934,18 +6169,7 @@ bool X86Architecture::Table_1_72(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_flags(cf): program.id = op0.val */
-      new IfConditionExpression(
-        TestFlags(rInsn, X86_FlCf),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0017);
     return true;
 }
 
@@ -8967,18 +6191,7 @@ bool X86Architecture::Table_1_73(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_not_flags(cf): program.id = op0.val */
-      new IfConditionExpression(
-        TestNotFlags(rInsn, X86_FlCf),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0018);
     return true;
 }
 
@@ -9000,18 +6213,7 @@ bool X86Architecture::Table_1_74(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_flags(zf): program.id = op0.val */
-      new IfConditionExpression(
-        TestFlags(rInsn, X86_FlZf),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0019);
     return true;
 }
 
@@ -9033,18 +6235,7 @@ bool X86Architecture::Table_1_75(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_not_flags(zf): program.id = op0.val */
-      new IfConditionExpression(
-        TestNotFlags(rInsn, X86_FlZf),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x001a);
     return true;
 }
 
@@ -9066,23 +6257,7 @@ bool X86Architecture::Table_1_76(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) != int(flag.bit, 0): program.id = op0.val */
-      new IfConditionExpression(
-        ConditionExpression::CondNe,
-        new OperationExpression(
-          OperationExpression::OpOr,
-          ExtractFlag(rInsn, X86_FlCf),
-          ExtractFlag(rInsn, X86_FlZf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x001b);
     return true;
 }
 
@@ -9104,23 +6279,7 @@ bool X86Architecture::Table_1_77(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) == int(flag.bit, 0): program.id = op0.val */
-      new IfConditionExpression(
-        ConditionExpression::CondEq,
-        new OperationExpression(
-          OperationExpression::OpOr,
-          ExtractFlag(rInsn, X86_FlCf),
-          ExtractFlag(rInsn, X86_FlZf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x001c);
     return true;
 }
 
@@ -9142,18 +6301,7 @@ bool X86Architecture::Table_1_78(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_flags(sf): program.id = op0.val */
-      new IfConditionExpression(
-        TestFlags(rInsn, X86_FlSf),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x001d);
     return true;
 }
 
@@ -9175,18 +6323,7 @@ bool X86Architecture::Table_1_79(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_not_flags(sf): program.id = op0.val */
-      new IfConditionExpression(
-        TestNotFlags(rInsn, X86_FlSf),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x001e);
     return true;
 }
 
@@ -9208,18 +6345,7 @@ bool X86Architecture::Table_1_7a(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_flags(pf): program.id = op0.val */
-      new IfConditionExpression(
-        TestFlags(rInsn, X86_FlPf),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x001f);
     return true;
 }
 
@@ -9241,18 +6367,7 @@ bool X86Architecture::Table_1_7b(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_not_flags(pf): program.id = op0.val */
-      new IfConditionExpression(
-        TestNotFlags(rInsn, X86_FlPf),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0020);
     return true;
 }
 
@@ -9274,23 +6389,7 @@ bool X86Architecture::Table_1_7c(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) != int(flag.bit, 0): program.id = op0.val */
-      new IfConditionExpression(
-        ConditionExpression::CondNe,
-        new OperationExpression(
-          OperationExpression::OpXor,
-          ExtractFlag(rInsn, X86_FlSf),
-          ExtractFlag(rInsn, X86_FlOf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0021);
     return true;
 }
 
@@ -9312,23 +6411,7 @@ bool X86Architecture::Table_1_7d(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) == int(flag.bit, 0): program.id = op0.val */
-      new IfConditionExpression(
-        ConditionExpression::CondEq,
-        new OperationExpression(
-          OperationExpression::OpXor,
-          ExtractFlag(rInsn, X86_FlSf),
-          ExtractFlag(rInsn, X86_FlOf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0022);
     return true;
 }
 
@@ -9350,26 +6433,7 @@ bool X86Architecture::Table_1_7e(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) != int(flag.bit, 0): program.id = op0.val */
-      new IfConditionExpression(
-        ConditionExpression::CondNe,
-        new OperationExpression(
-          OperationExpression::OpOr,
-          new OperationExpression(
-            OperationExpression::OpXor,
-            ExtractFlag(rInsn, X86_FlSf),
-            ExtractFlag(rInsn, X86_FlOf)),
-          ExtractFlag(rInsn, X86_FlZf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0023);
     return true;
 }
 
@@ -9391,26 +6455,7 @@ bool X86Architecture::Table_1_7f(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) == int(flag.bit, 0): program.id = op0.val */
-      new IfConditionExpression(
-        ConditionExpression::CondEq,
-        new OperationExpression(
-          OperationExpression::OpOr,
-          new OperationExpression(
-            OperationExpression::OpXor,
-            ExtractFlag(rInsn, X86_FlSf),
-            ExtractFlag(rInsn, X86_FlOf)),
-          ExtractFlag(rInsn, X86_FlZf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0024);
     return true;
 }
 
@@ -9478,29 +6523,7 @@ bool X86Architecture::Table_1_80(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0001);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -9511,30 +6534,7 @@ bool X86Architecture::Table_1_80(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val | op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0004);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -9545,32 +6545,7 @@ bool X86Architecture::Table_1_80(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + op1.val + extract_flag(cf) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new OperationExpression(
-              OperationExpression::OpAdd,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            ExtractFlag(rInsn, X86_FlCf)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0005);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -9581,32 +6556,7 @@ bool X86Architecture::Table_1_80(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val - extract_flag(cf) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new OperationExpression(
-              OperationExpression::OpSub,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            ExtractFlag(rInsn, X86_FlCf)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0006);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -9617,30 +6567,7 @@ bool X86Architecture::Table_1_80(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0007);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -9650,29 +6577,7 @@ bool X86Architecture::Table_1_80(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0009);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -9683,30 +6588,7 @@ bool X86Architecture::Table_1_80(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val ^ op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpXor,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000a);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -9716,24 +6598,7 @@ bool X86Architecture::Table_1_80(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000b);
       return true;
     default:
       return false;
@@ -9812,29 +6677,7 @@ bool X86Architecture::Table_1_81(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0001);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -9845,30 +6688,7 @@ bool X86Architecture::Table_1_81(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val | op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0004);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -9879,32 +6699,7 @@ bool X86Architecture::Table_1_81(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + op1.val + extract_flag(cf) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new OperationExpression(
-              OperationExpression::OpAdd,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            ExtractFlag(rInsn, X86_FlCf)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0005);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -9915,32 +6710,7 @@ bool X86Architecture::Table_1_81(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val - extract_flag(cf) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new OperationExpression(
-              OperationExpression::OpSub,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            ExtractFlag(rInsn, X86_FlCf)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0006);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -9951,30 +6721,7 @@ bool X86Architecture::Table_1_81(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0007);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -9984,29 +6731,7 @@ bool X86Architecture::Table_1_81(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0009);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -10017,30 +6742,7 @@ bool X86Architecture::Table_1_81(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val ^ op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpXor,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000a);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -10050,24 +6752,7 @@ bool X86Architecture::Table_1_81(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000b);
       return true;
     default:
       return false;
@@ -10146,29 +6831,7 @@ bool X86Architecture::Table_1_82(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0001);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -10179,30 +6842,7 @@ bool X86Architecture::Table_1_82(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val | op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0004);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -10213,32 +6853,7 @@ bool X86Architecture::Table_1_82(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + op1.val + extract_flag(cf) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new OperationExpression(
-              OperationExpression::OpAdd,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            ExtractFlag(rInsn, X86_FlCf)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0005);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -10249,32 +6864,7 @@ bool X86Architecture::Table_1_82(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val - extract_flag(cf) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new OperationExpression(
-              OperationExpression::OpSub,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            ExtractFlag(rInsn, X86_FlCf)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0006);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -10285,30 +6875,7 @@ bool X86Architecture::Table_1_82(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0007);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -10318,29 +6885,7 @@ bool X86Architecture::Table_1_82(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0009);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -10351,30 +6896,7 @@ bool X86Architecture::Table_1_82(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val ^ op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpXor,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000a);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -10384,24 +6906,7 @@ bool X86Architecture::Table_1_82(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000b);
       return true;
     default:
       return false;
@@ -10480,29 +6985,7 @@ bool X86Architecture::Table_1_83(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0001);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -10513,30 +6996,7 @@ bool X86Architecture::Table_1_83(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val | op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0004);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -10547,32 +7007,7 @@ bool X86Architecture::Table_1_83(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + op1.val + extract_flag(cf) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new OperationExpression(
-              OperationExpression::OpAdd,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            ExtractFlag(rInsn, X86_FlCf)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0005);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -10583,32 +7018,7 @@ bool X86Architecture::Table_1_83(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val - extract_flag(cf) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new OperationExpression(
-              OperationExpression::OpSub,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            ExtractFlag(rInsn, X86_FlCf)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0006);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -10619,30 +7029,7 @@ bool X86Architecture::Table_1_83(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0007);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -10652,29 +7039,7 @@ bool X86Architecture::Table_1_83(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0009);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -10685,30 +7050,7 @@ bool X86Architecture::Table_1_83(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val ^ op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpXor,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000a);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -10718,24 +7060,7 @@ bool X86Architecture::Table_1_83(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000b);
       return true;
     default:
       return false;
@@ -10760,25 +7085,7 @@ bool X86Architecture::Table_1_84(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAnd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0025);
     return true;
 }
 
@@ -10800,25 +7107,7 @@ bool X86Architecture::Table_1_85(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAnd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0025);
     return true;
 }
 
@@ -10836,16 +7125,7 @@ bool X86Architecture::Table_1_86(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-      new OperationExpression(
-        OperationExpression::OpXchg,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0026);
     return true;
 }
 
@@ -10863,16 +7143,7 @@ bool X86Architecture::Table_1_87(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-      new OperationExpression(
-        OperationExpression::OpXchg,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0026);
     return true;
 }
 
@@ -10890,15 +7161,7 @@ bool X86Architecture::Table_1_88(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0027);
     return true;
 }
 
@@ -10916,15 +7179,7 @@ bool X86Architecture::Table_1_89(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0027);
     return true;
 }
 
@@ -10942,15 +7197,7 @@ bool X86Architecture::Table_1_8a(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0027);
     return true;
 }
 
@@ -10968,15 +7215,7 @@ bool X86Architecture::Table_1_8b(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0027);
     return true;
 }
 
@@ -10994,15 +7233,7 @@ bool X86Architecture::Table_1_8c(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0027);
     return true;
 }
 
@@ -11020,15 +7251,7 @@ bool X86Architecture::Table_1_8d(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.addr */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0028);
     return true;
 }
 
@@ -11046,15 +7269,7 @@ bool X86Architecture::Table_1_8e(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0027);
     return true;
 }
 
@@ -11105,31 +7320,12 @@ bool X86Architecture::Table_1_8f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     case 0x1:
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_Xop;
-      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
     case 0x2:
       return false;
     case 0x3:
@@ -11167,31 +7363,14 @@ bool X86Architecture::Table_1_90(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
     else
     {
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Nop);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     }
 }
@@ -11219,16 +7398,7 @@ bool X86Architecture::Table_1_91(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
     else
@@ -11239,16 +7409,7 @@ bool X86Architecture::Table_1_91(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
 }
@@ -11276,16 +7437,7 @@ bool X86Architecture::Table_1_92(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
     else
@@ -11296,16 +7448,7 @@ bool X86Architecture::Table_1_92(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
 }
@@ -11333,16 +7476,7 @@ bool X86Architecture::Table_1_93(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
     else
@@ -11353,16 +7487,7 @@ bool X86Architecture::Table_1_93(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
 }
@@ -11390,16 +7515,7 @@ bool X86Architecture::Table_1_94(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
     else
@@ -11410,16 +7526,7 @@ bool X86Architecture::Table_1_94(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
 }
@@ -11447,16 +7554,7 @@ bool X86Architecture::Table_1_95(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
     else
@@ -11467,16 +7565,7 @@ bool X86Architecture::Table_1_95(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
 }
@@ -11504,16 +7593,7 @@ bool X86Architecture::Table_1_96(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
     else
@@ -11524,16 +7604,7 @@ bool X86Architecture::Table_1_96(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
 }
@@ -11561,16 +7632,7 @@ bool X86Architecture::Table_1_97(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
     else
@@ -11581,16 +7643,7 @@ bool X86Architecture::Table_1_97(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
-        new OperationExpression(
-          OperationExpression::OpXchg,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));;
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0026);
       return true;
     }
 }
@@ -11617,108 +7670,21 @@ bool X86Architecture::Table_1_98(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Cdqe);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (eax.id & int32(0x80000000)) == int32(0): rax.id &= int64(0x00000000ffffffff)
-        else: rax.id |= int64(0xffffffff00000000) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            new IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
-            new ConstantExpression(32, 0x80000000)),
-          new ConstantExpression(32, 0x0),
-          new OperationExpression(
-            OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Rax, &m_CpuInfo),
-            new OperationExpression(
-              OperationExpression::OpAnd,
-              new IdentifierExpression(X86_Reg_Rax, &m_CpuInfo),
-              new ConstantExpression(64, 0xffffffff)))
-        ,
-          new OperationExpression(
-            OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Rax, &m_CpuInfo),
-            new OperationExpression(
-              OperationExpression::OpOr,
-              new IdentifierExpression(X86_Reg_Rax, &m_CpuInfo),
-              new ConstantExpression(64, 0xffffffff00000000)))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x002a);
       return true;
     }
     else if (m_Cfg.Get("Architecture") >= X86_Arch_80386)
     {
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Cwde);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (ax.id & int16(0x8000)) == int16(0): eax.id &= int32(0x0000ffff)
-        else: eax.id |= int32(0xffff0000) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            new IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
-            new ConstantExpression(16, 0x8000)),
-          new ConstantExpression(16, 0x0),
-          new OperationExpression(
-            OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
-            new OperationExpression(
-              OperationExpression::OpAnd,
-              new IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
-              new ConstantExpression(32, 0xffff)))
-        ,
-          new OperationExpression(
-            OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
-            new OperationExpression(
-              OperationExpression::OpOr,
-              new IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
-              new ConstantExpression(32, 0xffff0000)))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x002b);
       return true;
     }
     else if (m_Cfg.Get("Architecture") == X86_Arch_8088)
     {
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Cbw);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (al.id & int8(0x80)) == int8(0): ax.id &= int16(0x00ff)
-        else: ax.id |= int16(0xff00) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            new IdentifierExpression(X86_Reg_Al, &m_CpuInfo),
-            new ConstantExpression(8, 0x80)),
-          new ConstantExpression(8, 0x0),
-          new OperationExpression(
-            OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
-            new OperationExpression(
-              OperationExpression::OpAnd,
-              new IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
-              new ConstantExpression(16, 0xff)))
-        ,
-          new OperationExpression(
-            OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
-            new OperationExpression(
-              OperationExpression::OpOr,
-              new IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
-              new ConstantExpression(16, 0xff00)))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x002c);
       return true;
     }
     return false;
@@ -11746,84 +7712,21 @@ bool X86Architecture::Table_1_99(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Cqo);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (rax.id & int64(0x8000000000000000)) == int64(0): rdx.id = int64(0xffffffffffffffff)
-        else: rdx.id = int64(0) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            new IdentifierExpression(X86_Reg_Rax, &m_CpuInfo),
-            new ConstantExpression(64, 0x8000000000000000)),
-          new ConstantExpression(64, 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Rdx, &m_CpuInfo),
-            new ConstantExpression(64, 0xffffffffffffffff))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Rdx, &m_CpuInfo),
-            new ConstantExpression(64, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x002d);
       return true;
     }
     else if (m_Cfg.Get("Architecture") >= X86_Arch_80386)
     {
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Cdq);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (eax.id & int32(0x80000000)) == int32(0): edx.id = int32(0xffffffff)
-        else: edx.id = int32(0) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            new IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
-            new ConstantExpression(32, 0x80000000)),
-          new ConstantExpression(32, 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Edx, &m_CpuInfo),
-            new ConstantExpression(32, 0xffffffff))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Edx, &m_CpuInfo),
-            new ConstantExpression(32, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x002e);
       return true;
     }
     else if (m_Cfg.Get("Architecture") == X86_Arch_8088)
     {
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Cwd);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (ax.id & int16(0x8000)) == int16(0): dx.id = int16(0xffff)
-        else: dx.id = int16(0) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            new IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
-            new ConstantExpression(16, 0x8000)),
-          new ConstantExpression(16, 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Dx, &m_CpuInfo),
-            new ConstantExpression(16, 0xffff))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(X86_Reg_Dx, &m_CpuInfo),
-            new ConstantExpression(16, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x002f);
       return true;
     }
     return false;
@@ -11946,15 +7849,7 @@ bool X86Architecture::Table_1_a0(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0027);
     return true;
 }
 
@@ -11972,15 +7867,7 @@ bool X86Architecture::Table_1_a1(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0027);
     return true;
 }
 
@@ -11998,15 +7885,7 @@ bool X86Architecture::Table_1_a2(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0027);
     return true;
 }
 
@@ -12024,15 +7903,7 @@ bool X86Architecture::Table_1_a3(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0027);
     return true;
 }
 
@@ -12130,25 +8001,7 @@ bool X86Architecture::Table_1_a8(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAnd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0025);
     return true;
 }
 
@@ -12170,25 +8023,7 @@ bool X86Architecture::Table_1_a9(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-      new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new VariableExpression(0, "res"),
-        new OperationExpression(
-          OperationExpression::OpAnd,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: update_flags(res) */
-      UpdateFlags(rInsn, new VariableExpression(0, "res"));
-      AllExpr.push_back(pExpr2);
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlAf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0025);
     return true;
 }
 
@@ -12208,40 +8043,7 @@ bool X86Architecture::Table_1_aa(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: if test_flags(df): op0.addr -= op0.size
-      else:op0.addr += op0.size */
-      new IfElseConditionExpression(
-        TestFlags(rInsn, X86_FlDf),
-        new OperationExpression(
-          OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-            new ConstantExpression(
-              32,
-              rInsn.Operand(0)->GetLength())))
-      ,
-        new OperationExpression(
-          OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-            new ConstantExpression(
-              32,
-              rInsn.Operand(0)->GetLength())))
-      );
-      AllExpr.push_back(pExpr1);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0030);
     return true;
 }
 
@@ -12261,40 +8063,7 @@ bool X86Architecture::Table_1_ab(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: op0.val = op1.val */
-      new OperationExpression(OperationExpression::OpAff,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: if test_flags(df): op0.addr -= op0.size
-      else:op0.addr += op0.size */
-      new IfElseConditionExpression(
-        TestFlags(rInsn, X86_FlDf),
-        new OperationExpression(
-          OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-            new ConstantExpression(
-              32,
-              rInsn.Operand(0)->GetLength())))
-      ,
-        new OperationExpression(
-          OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-            new ConstantExpression(
-              32,
-              rInsn.Operand(0)->GetLength())))
-      );
-      AllExpr.push_back(pExpr1);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0030);
     return true;
 }
 
@@ -12352,44 +8121,7 @@ bool X86Architecture::Table_1_ae(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if op0.val == op1.val: set_flags(zf)
-      else: reset_flags(zf) */
-      new IfElseConditionExpression(
-        ConditionExpression::CondEq,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        SetFlags(rInsn, X86_FlZf),
-        ResetFlags(rInsn, X86_FlZf));
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: if test_flags(df): op0.addr -= op0.size
-      else: op0.addr += op0.size */
-      new IfElseConditionExpression(
-        TestFlags(rInsn, X86_FlDf),
-        new OperationExpression(
-          OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-            new ConstantExpression(
-              32,
-              rInsn.Operand(0)->GetLength())))
-      ,
-        new OperationExpression(
-          OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-            new ConstantExpression(
-              32,
-              rInsn.Operand(0)->GetLength())))
-      );
-      AllExpr.push_back(pExpr1);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0031);
     return true;
 }
 
@@ -12411,44 +8143,7 @@ bool X86Architecture::Table_1_af(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if op0.val == op1.val: set_flags(zf)
-      else: reset_flags(zf) */
-      new IfElseConditionExpression(
-        ConditionExpression::CondEq,
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-        SetFlags(rInsn, X86_FlZf),
-        ResetFlags(rInsn, X86_FlZf));
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: if test_flags(df): op0.addr -= op0.size
-      else: op0.addr += op0.size */
-      new IfElseConditionExpression(
-        TestFlags(rInsn, X86_FlDf),
-        new OperationExpression(
-          OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-            new ConstantExpression(
-              32,
-              rInsn.Operand(0)->GetLength())))
-      ,
-        new OperationExpression(
-          OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false),
-            new ConstantExpression(
-              32,
-              rInsn.Operand(0)->GetLength())))
-      );
-      AllExpr.push_back(pExpr1);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0031);
     return true;
 }
 
@@ -12475,15 +8170,7 @@ bool X86Architecture::Table_1_b0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -12494,15 +8181,7 @@ bool X86Architecture::Table_1_b0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -12530,15 +8209,7 @@ bool X86Architecture::Table_1_b1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -12549,15 +8220,7 @@ bool X86Architecture::Table_1_b1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -12585,15 +8248,7 @@ bool X86Architecture::Table_1_b2(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -12604,15 +8259,7 @@ bool X86Architecture::Table_1_b2(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -12640,15 +8287,7 @@ bool X86Architecture::Table_1_b3(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -12659,15 +8298,7 @@ bool X86Architecture::Table_1_b3(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -12695,15 +8326,7 @@ bool X86Architecture::Table_1_b4(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -12714,15 +8337,7 @@ bool X86Architecture::Table_1_b4(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -12750,15 +8365,7 @@ bool X86Architecture::Table_1_b5(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -12769,15 +8376,7 @@ bool X86Architecture::Table_1_b5(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -12805,15 +8404,7 @@ bool X86Architecture::Table_1_b6(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -12824,15 +8415,7 @@ bool X86Architecture::Table_1_b6(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -12860,15 +8443,7 @@ bool X86Architecture::Table_1_b7(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -12879,15 +8454,7 @@ bool X86Architecture::Table_1_b7(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -12915,15 +8482,7 @@ bool X86Architecture::Table_1_b8(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -12934,15 +8493,7 @@ bool X86Architecture::Table_1_b8(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -12970,15 +8521,7 @@ bool X86Architecture::Table_1_b9(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -12989,15 +8532,7 @@ bool X86Architecture::Table_1_b9(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -13025,15 +8560,7 @@ bool X86Architecture::Table_1_ba(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -13044,15 +8571,7 @@ bool X86Architecture::Table_1_ba(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -13080,15 +8599,7 @@ bool X86Architecture::Table_1_bb(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -13099,15 +8610,7 @@ bool X86Architecture::Table_1_bb(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -13135,15 +8638,7 @@ bool X86Architecture::Table_1_bc(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -13154,15 +8649,7 @@ bool X86Architecture::Table_1_bc(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -13190,15 +8677,7 @@ bool X86Architecture::Table_1_bd(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -13209,15 +8688,7 @@ bool X86Architecture::Table_1_bd(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -13245,15 +8716,7 @@ bool X86Architecture::Table_1_be(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -13264,15 +8727,7 @@ bool X86Architecture::Table_1_be(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -13300,15 +8755,7 @@ bool X86Architecture::Table_1_bf(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -13319,15 +8766,7 @@ bool X86Architecture::Table_1_bf(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
 }
@@ -13380,35 +8819,7 @@ bool X86Architecture::Table_1_c0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val << op1.val) | (op0.val >> (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0032);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -13417,35 +8828,7 @@ bool X86Architecture::Table_1_c0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val >> op1.val) | (op0.val << (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0033);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -13470,18 +8853,7 @@ bool X86Architecture::Table_1_c0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -13490,18 +8862,7 @@ bool X86Architecture::Table_1_c0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -13510,18 +8871,7 @@ bool X86Architecture::Table_1_c0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -13530,18 +8880,7 @@ bool X86Architecture::Table_1_c0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     default:
       return false;
@@ -13604,35 +8943,7 @@ bool X86Architecture::Table_1_c1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val << op1.val) | (op0.val >> (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0032);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -13641,35 +8952,7 @@ bool X86Architecture::Table_1_c1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val >> op1.val) | (op0.val << (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0033);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -13694,18 +8977,7 @@ bool X86Architecture::Table_1_c1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -13714,18 +8986,7 @@ bool X86Architecture::Table_1_c1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -13734,18 +8995,7 @@ bool X86Architecture::Table_1_c1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -13754,18 +9004,7 @@ bool X86Architecture::Table_1_c1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     default:
       return false;
@@ -13788,35 +9027,7 @@ bool X86Architecture::Table_1_c2(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: program.id = stack.mem */
-      new OperationExpression(OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-        new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: stack.id += stack.size */
-      new OperationExpression(
-        OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new ConstantExpression(
-            m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-            m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: stack.id += op0.val */
-      new OperationExpression(
-        OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-      AllExpr.push_back(pExpr2);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0036);
     return true;
 }
 
@@ -13831,26 +9042,7 @@ bool X86Architecture::Table_1_c3(BinaryStream const& rBinStrm, TOffset Offset, I
     rInsn.Length()++;
     rInsn.SetOpcode(X86_Opcode_Ret);
     rInsn.SubType() |= Instruction::ReturnType;
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: program.id = stack.mem */
-      new OperationExpression(OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-        new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: stack.id += stack.size */
-      new OperationExpression(
-        OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new ConstantExpression(
-            m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-            m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-      AllExpr.push_back(pExpr1);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0037);
     return true;
 }
 
@@ -13871,7 +9063,7 @@ bool X86Architecture::Table_1_c4(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_VEX3;
-      return Disassemble(rBinStrm, Offset + 2, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 2, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -13902,7 +9094,7 @@ bool X86Architecture::Table_1_c5(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       rInsn.Length()++;
       rInsn.Prefix() |= X86_Prefix_VEX2;
-      return Disassemble(rBinStrm, Offset + 1, rInsn, Mode);
+      return Disassemble(rBinStrm, Offset + 1, rInsn, Mode, DisasmDecodeOnly);
     }
     else
     {
@@ -13959,15 +9151,7 @@ bool X86Architecture::Table_1_c6(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     case 0x1:
       return false; /* INVALID */
@@ -14039,15 +9223,7 @@ bool X86Architecture::Table_1_c7(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     case 0x1:
       return false; /* INVALID */
@@ -14112,31 +9288,7 @@ bool X86Architecture::Table_1_c9(BinaryStream const& rBinStrm, TOffset Offset, I
       }
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Leave);
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id = frame.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackFrameRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: frame.id = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackFrameRegister), &m_CpuInfo),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0038);
       return true;
     }
     else
@@ -14292,35 +9444,7 @@ bool X86Architecture::Table_1_d0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val << op1.val) | (op0.val >> (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0032);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -14329,35 +9453,7 @@ bool X86Architecture::Table_1_d0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val >> op1.val) | (op0.val << (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0033);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -14382,18 +9478,7 @@ bool X86Architecture::Table_1_d0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -14402,18 +9487,7 @@ bool X86Architecture::Table_1_d0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -14422,18 +9496,7 @@ bool X86Architecture::Table_1_d0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -14442,18 +9505,7 @@ bool X86Architecture::Table_1_d0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     default:
       return false;
@@ -14516,35 +9568,7 @@ bool X86Architecture::Table_1_d1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val << op1.val) | (op0.val >> (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0032);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -14553,35 +9577,7 @@ bool X86Architecture::Table_1_d1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val >> op1.val) | (op0.val << (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0033);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -14606,18 +9602,7 @@ bool X86Architecture::Table_1_d1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -14626,18 +9611,7 @@ bool X86Architecture::Table_1_d1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -14646,18 +9620,7 @@ bool X86Architecture::Table_1_d1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -14666,18 +9629,7 @@ bool X86Architecture::Table_1_d1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     default:
       return false;
@@ -14740,35 +9692,7 @@ bool X86Architecture::Table_1_d2(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val << op1.val) | (op0.val >> (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0032);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -14777,35 +9701,7 @@ bool X86Architecture::Table_1_d2(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val >> op1.val) | (op0.val << (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0033);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -14830,18 +9726,7 @@ bool X86Architecture::Table_1_d2(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -14850,18 +9735,7 @@ bool X86Architecture::Table_1_d2(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -14870,18 +9744,7 @@ bool X86Architecture::Table_1_d2(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -14890,18 +9753,7 @@ bool X86Architecture::Table_1_d2(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     default:
       return false;
@@ -14964,35 +9816,7 @@ bool X86Architecture::Table_1_d3(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val << op1.val) | (op0.val >> (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0032);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -15001,35 +9825,7 @@ bool X86Architecture::Table_1_d3(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = ((op0.val >> op1.val) | (op0.val << (int(op0.bit, op0.bit) - op1.val))) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpLrs,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)),
-            new OperationExpression(
-              OperationExpression::OpLls,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              new OperationExpression(
-                OperationExpression::OpSub,
-                new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
-                rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)))));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0033);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -15054,18 +9850,7 @@ bool X86Architecture::Table_1_d3(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -15074,18 +9859,7 @@ bool X86Architecture::Table_1_d3(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -15094,18 +9868,7 @@ bool X86Architecture::Table_1_d3(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLls,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0034);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -15114,18 +9877,7 @@ bool X86Architecture::Table_1_d3(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpLrs,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0035);
       return true;
     default:
       return false;
@@ -15152,11 +9904,7 @@ bool X86Architecture::Table_1_d4(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlOf | X86_FlAf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0039);
       return true;
     }
     else
@@ -15183,11 +9931,7 @@ bool X86Architecture::Table_1_d5(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlOf | X86_FlAf | X86_FlCf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0039);
       return true;
     }
     else
@@ -16018,35 +10762,7 @@ bool X86Architecture::Table_1_e0(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: cnt.id -= int(cnt.bit, 1) */
-      new OperationExpression(
-        OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x1)));
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: if (extract_flag(zf) ^ int(cnt.bit, 1) & cnt.id) != int(cnt.bit, 0): program.id = op0.val */
-      new IfConditionExpression(
-        ConditionExpression::CondNe,
-        new OperationExpression(
-          OperationExpression::OpXor,
-          ExtractFlag(rInsn, X86_FlZf),
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x1),
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo))),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr1);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x003a);
     return true;
 }
 
@@ -16068,32 +10784,7 @@ bool X86Architecture::Table_1_e1(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: cnt.id -= int(cnt.bit, 1) */
-      new OperationExpression(
-        OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x1)));
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: if (cnt.id | extract_flag(zf)) != int(cnt.bit, 0): program.id = op0.val */
-      new IfConditionExpression(
-        ConditionExpression::CondNe,
-        new OperationExpression(
-          OperationExpression::OpOr,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
-          ExtractFlag(rInsn, X86_FlZf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr1);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x003b);
     return true;
 }
 
@@ -16113,29 +10804,7 @@ bool X86Architecture::Table_1_e2(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: cnt.id -= int(cnt.bit, 1) */
-      new OperationExpression(
-        OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x1)));
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: if cnt.id != int(cnt.bit, 0): program.id = op0.val */
-      new IfConditionExpression(
-        ConditionExpression::CondNe,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr1);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x003c);
     return true;
 }
 
@@ -16171,20 +10840,7 @@ bool X86Architecture::Table_1_e3(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if cnt.id == int(cnt.bit, 0): program.id = op0.val */
-        new IfConditionExpression(
-          ConditionExpression::CondEq,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x003d);
       return true;
     }
     else if ((Mode == X86_Bit_16 && rInsn.Prefix() & X86_Prefix_AdSize) || (Mode != X86_Bit_16 && !(rInsn.Prefix() & X86_Prefix_AdSize)))
@@ -16196,20 +10852,7 @@ bool X86Architecture::Table_1_e3(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if cnt.id == int(cnt.bit, 0): program.id = op0.val */
-        new IfConditionExpression(
-          ConditionExpression::CondEq,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x003d);
       return true;
     }
     else
@@ -16221,20 +10864,7 @@ bool X86Architecture::Table_1_e3(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if cnt.id == int(cnt.bit, 0): program.id = op0.val */
-        new IfConditionExpression(
-          ConditionExpression::CondEq,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x003d);
       return true;
     }
 }
@@ -16308,7 +10938,7 @@ bool X86Architecture::Table_1_e7(BinaryStream const& rBinStrm, TOffset Offset, I
  * operand: ['Jz']
  * opcode: e8
  * operation_type: ['call']
- * semantic: ['stack.id -= stack.size', 'stack.mem = (program.id + insn.size)', 'program.id = op0.val']
+ * semantic: ['stack.id -= stack.size', 'stack.mem = program.id', 'program.id = op0.val']
 **/
 bool X86Architecture::Table_1_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)
 {
@@ -16319,36 +10949,7 @@ bool X86Architecture::Table_1_e8(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: stack.id -= stack.size */
-      new OperationExpression(
-        OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-        new OperationExpression(
-          OperationExpression::OpSub,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new ConstantExpression(
-            m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-            m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-      AllExpr.push_back(pExpr0);
-      auto pExpr1 = /* Semantic: stack.mem = (program.id + insn.size) */
-      new OperationExpression(OperationExpression::OpAff,
-        new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-        new OperationExpression(
-          OperationExpression::OpAdd,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new ConstantExpression(
-            m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister)),
-            rInsn.GetLength())));
-      AllExpr.push_back(pExpr1);
-      auto pExpr2 = /* Semantic: program.id = op0.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr2);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x003e);
     return true;
 }
 
@@ -16368,15 +10969,7 @@ bool X86Architecture::Table_1_e9(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: program.id = op0.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x003f);
     return true;
 }
 
@@ -16399,15 +10992,7 @@ bool X86Architecture::Table_1_ea(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x003f);
       return true;
     }
     else
@@ -16430,15 +11015,7 @@ bool X86Architecture::Table_1_eb(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: program.id = op0.val */
-      new OperationExpression(OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x003f);
     return true;
 }
 
@@ -16515,7 +11092,7 @@ bool X86Architecture::Table_1_f0(BinaryStream const& rBinStrm, TOffset Offset, I
 {
     rInsn.Length()++;
     rInsn.Prefix() |= X86_Prefix_Lock;
-    return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+    return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
 }
 
 /** instruction
@@ -16539,7 +11116,7 @@ bool X86Architecture::Table_1_f2(BinaryStream const& rBinStrm, TOffset Offset, I
 {
     rInsn.Length()++;
     rInsn.Prefix() |= X86_Prefix_RepNz;
-    return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+    return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
 }
 
 /** instruction
@@ -16552,7 +11129,7 @@ bool X86Architecture::Table_1_f3(BinaryStream const& rBinStrm, TOffset Offset, I
 {
     rInsn.Length()++;
     rInsn.Prefix() |= X86_Prefix_Rep;
-    return Disassemble(rBinStrm, Offset + 0, rInsn, Mode);
+    return Disassemble(rBinStrm, Offset + 0, rInsn, Mode, DisasmDecodeOnly);
 }
 
 /** instruction
@@ -16641,25 +11218,7 @@ bool X86Architecture::Table_1_f6(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0025);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -16670,25 +11229,7 @@ bool X86Architecture::Table_1_f6(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0025);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -16697,29 +11238,7 @@ bool X86Architecture::Table_1_f6(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val ^ int(op0.bit, -1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpXor,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, -0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0040);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -16744,19 +11263,7 @@ bool X86Architecture::Table_1_f6(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: acc.id *= op0.val */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::AccumulatorRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpMul,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::AccumulatorRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0041);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -16839,25 +11346,7 @@ bool X86Architecture::Table_1_f7(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0025);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -16868,25 +11357,7 @@ bool X86Architecture::Table_1_f7(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val & op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAnd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        AllExpr.push_back(ResetFlags(rInsn, X86_FlAf));
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0025);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -16895,29 +11366,7 @@ bool X86Architecture::Table_1_f7(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val ^ int(op0.bit, -1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpXor,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, -0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0040);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -16942,19 +11391,7 @@ bool X86Architecture::Table_1_f7(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: acc.id *= op0.val */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::AccumulatorRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpMul,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::AccumulatorRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0041);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -16987,11 +11424,7 @@ bool X86Architecture::Table_1_f8(BinaryStream const& rBinStrm, TOffset Offset, I
     rInsn.Length()++;
     rInsn.SetOpcode(X86_Opcode_Clc);
     rInsn.SetClearedFlags(X86_FlCf);
-    {
-      Expression::List AllExpr;
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlCf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0042);
     return true;
 }
 
@@ -17018,11 +11451,7 @@ bool X86Architecture::Table_1_fa(BinaryStream const& rBinStrm, TOffset Offset, I
     rInsn.Length()++;
     rInsn.SetOpcode(X86_Opcode_Cli);
     rInsn.SetClearedFlags(X86_FlIf);
-    {
-      Expression::List AllExpr;
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlIf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0043);
     return true;
 }
 
@@ -17035,11 +11464,7 @@ bool X86Architecture::Table_1_fb(BinaryStream const& rBinStrm, TOffset Offset, I
 {
     rInsn.Length()++;
     rInsn.SetOpcode(X86_Opcode_Sti);
-    {
-      Expression::List AllExpr;
-      AllExpr.push_back(SetFlags(rInsn, X86_FlIf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0044);
     return true;
 }
 
@@ -17053,11 +11478,7 @@ bool X86Architecture::Table_1_fc(BinaryStream const& rBinStrm, TOffset Offset, I
     rInsn.Length()++;
     rInsn.SetOpcode(X86_Opcode_Cld);
     rInsn.SetClearedFlags(X86_FlDf);
-    {
-      Expression::List AllExpr;
-      AllExpr.push_back(ResetFlags(rInsn, X86_FlDf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0045);
     return true;
 }
 
@@ -17070,11 +11491,7 @@ bool X86Architecture::Table_1_fd(BinaryStream const& rBinStrm, TOffset Offset, I
 {
     rInsn.Length()++;
     rInsn.SetOpcode(X86_Opcode_Std);
-    {
-      Expression::List AllExpr;
-      AllExpr.push_back(SetFlags(rInsn, X86_FlDf));
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0046);
     return true;
 }
 
@@ -17082,11 +11499,13 @@ bool X86Architecture::Table_1_fd(BinaryStream const& rBinStrm, TOffset Offset, I
  * mnemonic: inc
  * operand: ['Eb']
  * opcode: 00
+ * update_flags: ['pf', 'af', 'zf', 'sf', 'of']
  * semantic: ['var(op0.bit, "res")', 'res = op0.val + int(op0.bit, 1)', 'update_flags(res)', 'op0.val = res']
  *
  * mnemonic: dec
  * operand: ['Eb']
  * opcode: 01
+ * update_flags: ['pf', 'af', 'zf', 'sf', 'of']
  * semantic: ['var(op0.bit, "res")', 'res = op0.val - int(op0.bit, 1)', 'update_flags(res)', 'op0.val = res']
  *
  * opcode: 02
@@ -17120,64 +11539,22 @@ bool X86Architecture::Table_1_fe(BinaryStream const& rBinStrm, TOffset Offset, I
     case 0x0:
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Inc);
+      rInsn.SetUpdatedFlags(X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
       if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000d);
       return true;
     case 0x1:
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Dec);
+      rInsn.SetUpdatedFlags(X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
       if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000e);
       return true;
     case 0x2:
       return false;
@@ -17200,16 +11577,18 @@ bool X86Architecture::Table_1_fe(BinaryStream const& rBinStrm, TOffset Offset, I
  * mnemonic: inc
  * operand: ['Ev']
  * opcode: 00
+ * update_flags: ['pf', 'af', 'zf', 'sf', 'of']
  * semantic: ['var(op0.bit, "res")', 'res = op0.val + int(op0.bit, 1)', 'update_flags(res)', 'op0.val = res']
  *
  * mnemonic: dec
  * operand: ['Ev']
  * opcode: 01
+ * update_flags: ['pf', 'af', 'zf', 'sf', 'of']
  * semantic: ['var(op0.bit, "res")', 'res = op0.val - int(op0.bit, 1)', 'update_flags(res)', 'op0.val = res']
  *
  * mnemonic: call
  * operand: ['Ev']
- * semantic: ['stack.id -= stack.size', 'stack.mem = (program.id + insn.size)', 'program.id = op0.val']
+ * semantic: ['stack.id -= stack.size', 'stack.mem = program.id', 'program.id = op0.val']
  * constraint: df64
  * operation_type: ['call']
  * opcode: 02
@@ -17254,64 +11633,22 @@ bool X86Architecture::Table_1_ff(BinaryStream const& rBinStrm, TOffset Offset, I
     case 0x0:
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Inc);
+      rInsn.SetUpdatedFlags(X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
       if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val + int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000d);
       return true;
     case 0x1:
       rInsn.Length()++;
       rInsn.SetOpcode(X86_Opcode_Dec);
+      rInsn.SetUpdatedFlags(X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
       if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val - int(op0.bit, 1) */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: update_flags(res) */
-        UpdateFlags(rInsn, new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x000e);
       return true;
     case 0x2:
       if (!(rInsn.Prefix() & X86_Prefix_OpSize))
@@ -17325,36 +11662,7 @@ bool X86Architecture::Table_1_ff(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = (program.id + insn.size) */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister)),
-              rInsn.GetLength())));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: program.id = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x003e);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -17377,15 +11685,7 @@ bool X86Architecture::Table_1_ff(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x003f);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -17395,15 +11695,7 @@ bool X86Architecture::Table_1_ff(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x003f);
       return true;
     case 0x6:
       if (!(rInsn.Prefix() & X86_Prefix_OpSize))
@@ -17416,26 +11708,7 @@ bool X86Architecture::Table_1_ff(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     case 0x7:
       return false;
@@ -18110,15 +12383,7 @@ bool X86Architecture::Table_2_0d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     }
     else
@@ -18737,15 +13002,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -18754,15 +13011,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -18771,15 +13020,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -18788,15 +13029,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -18805,15 +13038,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -18822,15 +13047,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -18839,15 +13056,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -18856,15 +13065,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     default:
       return false;
@@ -18929,15 +13130,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -18946,15 +13139,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -18963,15 +13148,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -18980,15 +13157,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -18997,15 +13166,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -19014,15 +13175,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -19031,15 +13184,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -19048,15 +13193,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     default:
       return false;
@@ -19121,15 +13258,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -19138,15 +13267,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -19155,15 +13276,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -19172,15 +13285,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -19189,15 +13294,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -19206,15 +13303,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -19223,15 +13312,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -19240,15 +13321,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     default:
       return false;
@@ -19313,15 +13386,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -19330,15 +13395,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -19347,15 +13404,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -19364,15 +13413,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -19381,15 +13422,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -19398,15 +13431,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -19415,15 +13440,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -19432,15 +13449,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     default:
       return false;
@@ -19505,15 +13514,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -19522,15 +13523,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -19539,15 +13532,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -19556,15 +13541,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -19573,15 +13550,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -19590,15 +13559,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -19607,15 +13568,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -19624,15 +13577,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     default:
       return false;
@@ -19697,15 +13642,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -19714,15 +13651,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -19731,15 +13660,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -19748,15 +13669,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -19765,15 +13678,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -19782,15 +13687,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -19799,15 +13696,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -19816,15 +13705,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     default:
       return false;
@@ -19889,15 +13770,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -19906,15 +13779,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -19923,15 +13788,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -19940,15 +13797,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -19957,15 +13806,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -19974,15 +13815,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -19991,15 +13824,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -20008,15 +13833,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     default:
       return false;
@@ -20081,15 +13898,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x1:
       rInsn.Length()++;
@@ -20098,15 +13907,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x2:
       rInsn.Length()++;
@@ -20115,15 +13916,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x3:
       rInsn.Length()++;
@@ -20132,15 +13925,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x4:
       rInsn.Length()++;
@@ -20149,15 +13934,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x5:
       rInsn.Length()++;
@@ -20166,15 +13943,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x6:
       rInsn.Length()++;
@@ -20183,15 +13952,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     case 0x7:
       rInsn.Length()++;
@@ -20200,15 +13961,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: program.id = program.id */
-        new OperationExpression(OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0029);
       return true;
     default:
       return false;
@@ -20354,15 +14107,7 @@ bool X86Architecture::Table_2_24(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -20410,15 +14155,7 @@ bool X86Architecture::Table_2_26(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0027);
       return true;
     }
     else
@@ -21256,18 +14993,7 @@ bool X86Architecture::Table_2_40(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_flags(of): op0.val = op1.val */
-      new IfConditionExpression(
-        TestFlags(rInsn, X86_FlOf),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0047);
     return true;
 }
 
@@ -21289,18 +15015,7 @@ bool X86Architecture::Table_2_41(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_not_flags(of): op0.val = op1.val */
-      new IfConditionExpression(
-        TestNotFlags(rInsn, X86_FlOf),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0048);
     return true;
 }
 
@@ -21322,18 +15037,7 @@ bool X86Architecture::Table_2_42(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_flags(cf): op0.val = op1.val */
-      new IfConditionExpression(
-        TestFlags(rInsn, X86_FlCf),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0049);
     return true;
 }
 
@@ -21355,18 +15059,7 @@ bool X86Architecture::Table_2_43(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_not_flags(cf): op0.val = op1.val */
-      new IfConditionExpression(
-        TestNotFlags(rInsn, X86_FlCf),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x004a);
     return true;
 }
 
@@ -21388,18 +15081,7 @@ bool X86Architecture::Table_2_44(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_flags(zf): op0.val = op1.val */
-      new IfConditionExpression(
-        TestFlags(rInsn, X86_FlZf),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x004b);
     return true;
 }
 
@@ -21421,18 +15103,7 @@ bool X86Architecture::Table_2_45(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_not_flags(zf): op0.val = op1.val */
-      new IfConditionExpression(
-        TestNotFlags(rInsn, X86_FlZf),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x004c);
     return true;
 }
 
@@ -21454,23 +15125,7 @@ bool X86Architecture::Table_2_46(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) != int(flag.bit, 0): op0.val = op1.val */
-      new IfConditionExpression(
-        ConditionExpression::CondNe,
-        new OperationExpression(
-          OperationExpression::OpOr,
-          ExtractFlag(rInsn, X86_FlCf),
-          ExtractFlag(rInsn, X86_FlZf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x004d);
     return true;
 }
 
@@ -21492,23 +15147,7 @@ bool X86Architecture::Table_2_47(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) == int(flag.bit, 0): op0.val = op1.val */
-      new IfConditionExpression(
-        ConditionExpression::CondEq,
-        new OperationExpression(
-          OperationExpression::OpOr,
-          ExtractFlag(rInsn, X86_FlCf),
-          ExtractFlag(rInsn, X86_FlZf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x004e);
     return true;
 }
 
@@ -21530,18 +15169,7 @@ bool X86Architecture::Table_2_48(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_flags(sf): op0.val = op1.val */
-      new IfConditionExpression(
-        TestFlags(rInsn, X86_FlSf),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x004f);
     return true;
 }
 
@@ -21563,18 +15191,7 @@ bool X86Architecture::Table_2_49(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_not_flags(sf): op0.val = op1.val */
-      new IfConditionExpression(
-        TestNotFlags(rInsn, X86_FlSf),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0050);
     return true;
 }
 
@@ -21596,18 +15213,7 @@ bool X86Architecture::Table_2_4a(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_flags(pf): op0.val = op1.val */
-      new IfConditionExpression(
-        TestFlags(rInsn, X86_FlPf),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0051);
     return true;
 }
 
@@ -21629,18 +15235,7 @@ bool X86Architecture::Table_2_4b(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if test_not_flags(pf): op0.val = op1.val */
-      new IfConditionExpression(
-        TestNotFlags(rInsn, X86_FlPf),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0052);
     return true;
 }
 
@@ -21662,23 +15257,7 @@ bool X86Architecture::Table_2_4c(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) != int(flag.bit, 0): op0.val = op1.val */
-      new IfConditionExpression(
-        ConditionExpression::CondNe,
-        new OperationExpression(
-          OperationExpression::OpXor,
-          ExtractFlag(rInsn, X86_FlSf),
-          ExtractFlag(rInsn, X86_FlOf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0053);
     return true;
 }
 
@@ -21700,23 +15279,7 @@ bool X86Architecture::Table_2_4d(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) == int(flag.bit, 0): op0.val = op1.val */
-      new IfConditionExpression(
-        ConditionExpression::CondEq,
-        new OperationExpression(
-          OperationExpression::OpXor,
-          ExtractFlag(rInsn, X86_FlSf),
-          ExtractFlag(rInsn, X86_FlOf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0054);
     return true;
 }
 
@@ -21738,26 +15301,7 @@ bool X86Architecture::Table_2_4e(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) != int(flag.bit, 0): op0.val = op1.val */
-      new IfConditionExpression(
-        ConditionExpression::CondNe,
-        new OperationExpression(
-          OperationExpression::OpOr,
-          new OperationExpression(
-            OperationExpression::OpXor,
-            ExtractFlag(rInsn, X86_FlSf),
-            ExtractFlag(rInsn, X86_FlOf)),
-          ExtractFlag(rInsn, X86_FlZf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0055);
     return true;
 }
 
@@ -21779,26 +15323,7 @@ bool X86Architecture::Table_2_4f(BinaryStream const& rBinStrm, TOffset Offset, I
     {
       return false;
     }
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) == int(flag.bit, 0): op0.val = op1.val */
-      new IfConditionExpression(
-        ConditionExpression::CondEq,
-        new OperationExpression(
-          OperationExpression::OpOr,
-          new OperationExpression(
-            OperationExpression::OpXor,
-            ExtractFlag(rInsn, X86_FlSf),
-            ExtractFlag(rInsn, X86_FlOf)),
-          ExtractFlag(rInsn, X86_FlZf)),
-        new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-      );
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0056);
     return true;
 }
 
@@ -23995,18 +17520,7 @@ bool X86Architecture::Table_2_80(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_flags(of): program.id = op0.val */
-        new IfConditionExpression(
-          TestFlags(rInsn, X86_FlOf),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0015);
       return true;
     }
     else
@@ -24039,18 +17553,7 @@ bool X86Architecture::Table_2_81(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_not_flags(of): program.id = op0.val */
-        new IfConditionExpression(
-          TestNotFlags(rInsn, X86_FlOf),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0016);
       return true;
     }
     else
@@ -24083,18 +17586,7 @@ bool X86Architecture::Table_2_82(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_flags(cf): program.id = op0.val */
-        new IfConditionExpression(
-          TestFlags(rInsn, X86_FlCf),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0017);
       return true;
     }
     else
@@ -24127,18 +17619,7 @@ bool X86Architecture::Table_2_83(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_not_flags(cf): program.id = op0.val */
-        new IfConditionExpression(
-          TestNotFlags(rInsn, X86_FlCf),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0018);
       return true;
     }
     else
@@ -24171,18 +17652,7 @@ bool X86Architecture::Table_2_84(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_flags(zf): program.id = op0.val */
-        new IfConditionExpression(
-          TestFlags(rInsn, X86_FlZf),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0019);
       return true;
     }
     else
@@ -24215,18 +17685,7 @@ bool X86Architecture::Table_2_85(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_not_flags(zf): program.id = op0.val */
-        new IfConditionExpression(
-          TestNotFlags(rInsn, X86_FlZf),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x001a);
       return true;
     }
     else
@@ -24259,23 +17718,7 @@ bool X86Architecture::Table_2_86(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) != int(flag.bit, 0): program.id = op0.val */
-        new IfConditionExpression(
-          ConditionExpression::CondNe,
-          new OperationExpression(
-            OperationExpression::OpOr,
-            ExtractFlag(rInsn, X86_FlCf),
-            ExtractFlag(rInsn, X86_FlZf)),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x001b);
       return true;
     }
     else
@@ -24308,23 +17751,7 @@ bool X86Architecture::Table_2_87(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) == int(flag.bit, 0): program.id = op0.val */
-        new IfConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpOr,
-            ExtractFlag(rInsn, X86_FlCf),
-            ExtractFlag(rInsn, X86_FlZf)),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x001c);
       return true;
     }
     else
@@ -24357,18 +17784,7 @@ bool X86Architecture::Table_2_88(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_flags(sf): program.id = op0.val */
-        new IfConditionExpression(
-          TestFlags(rInsn, X86_FlSf),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x001d);
       return true;
     }
     else
@@ -24401,18 +17817,7 @@ bool X86Architecture::Table_2_89(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_not_flags(sf): program.id = op0.val */
-        new IfConditionExpression(
-          TestNotFlags(rInsn, X86_FlSf),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x001e);
       return true;
     }
     else
@@ -24445,18 +17850,7 @@ bool X86Architecture::Table_2_8a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_flags(pf): program.id = op0.val */
-        new IfConditionExpression(
-          TestFlags(rInsn, X86_FlPf),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x001f);
       return true;
     }
     else
@@ -24489,18 +17883,7 @@ bool X86Architecture::Table_2_8b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_not_flags(pf): program.id = op0.val */
-        new IfConditionExpression(
-          TestNotFlags(rInsn, X86_FlPf),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0020);
       return true;
     }
     else
@@ -24533,23 +17916,7 @@ bool X86Architecture::Table_2_8c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) != int(flag.bit, 0): program.id = op0.val */
-        new IfConditionExpression(
-          ConditionExpression::CondNe,
-          new OperationExpression(
-            OperationExpression::OpXor,
-            ExtractFlag(rInsn, X86_FlSf),
-            ExtractFlag(rInsn, X86_FlOf)),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0021);
       return true;
     }
     else
@@ -24582,23 +17949,7 @@ bool X86Architecture::Table_2_8d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) == int(flag.bit, 0): program.id = op0.val */
-        new IfConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpXor,
-            ExtractFlag(rInsn, X86_FlSf),
-            ExtractFlag(rInsn, X86_FlOf)),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0022);
       return true;
     }
     else
@@ -24631,26 +17982,7 @@ bool X86Architecture::Table_2_8e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) != int(flag.bit, 0): program.id = op0.val */
-        new IfConditionExpression(
-          ConditionExpression::CondNe,
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpXor,
-              ExtractFlag(rInsn, X86_FlSf),
-              ExtractFlag(rInsn, X86_FlOf)),
-            ExtractFlag(rInsn, X86_FlZf)),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0023);
       return true;
     }
     else
@@ -24683,26 +18015,7 @@ bool X86Architecture::Table_2_8f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) == int(flag.bit, 0): program.id = op0.val */
-        new IfConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpXor,
-              ExtractFlag(rInsn, X86_FlSf),
-              ExtractFlag(rInsn, X86_FlOf)),
-            ExtractFlag(rInsn, X86_FlZf)),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0024);
       return true;
     }
     else
@@ -24728,23 +18041,7 @@ bool X86Architecture::Table_2_90(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_flags(of): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          TestFlags(rInsn, X86_FlOf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0057);
       return true;
     }
     else
@@ -24770,23 +18067,7 @@ bool X86Architecture::Table_2_91(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_not_flags(of): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          TestNotFlags(rInsn, X86_FlOf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0058);
       return true;
     }
     else
@@ -24812,23 +18093,7 @@ bool X86Architecture::Table_2_92(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_flags(cf): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          TestFlags(rInsn, X86_FlCf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0059);
       return true;
     }
     else
@@ -24854,23 +18119,7 @@ bool X86Architecture::Table_2_93(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_not_flags(cf): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          TestNotFlags(rInsn, X86_FlCf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x005a);
       return true;
     }
     else
@@ -24896,23 +18145,7 @@ bool X86Architecture::Table_2_94(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_flags(zf): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          TestFlags(rInsn, X86_FlZf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x005b);
       return true;
     }
     else
@@ -24938,23 +18171,7 @@ bool X86Architecture::Table_2_95(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_not_flags(zf): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          TestNotFlags(rInsn, X86_FlZf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x005c);
       return true;
     }
     else
@@ -24980,28 +18197,7 @@ bool X86Architecture::Table_2_96(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) != int(flag.bit, 0): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondNe,
-          new OperationExpression(
-            OperationExpression::OpOr,
-            ExtractFlag(rInsn, X86_FlCf),
-            ExtractFlag(rInsn, X86_FlZf)),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x005d);
       return true;
     }
     else
@@ -25027,28 +18223,7 @@ bool X86Architecture::Table_2_97(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) == int(flag.bit, 0): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpOr,
-            ExtractFlag(rInsn, X86_FlCf),
-            ExtractFlag(rInsn, X86_FlZf)),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x005e);
       return true;
     }
     else
@@ -25074,23 +18249,7 @@ bool X86Architecture::Table_2_98(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_flags(sf): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          TestFlags(rInsn, X86_FlSf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x005f);
       return true;
     }
     else
@@ -25116,23 +18275,7 @@ bool X86Architecture::Table_2_99(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_not_flags(sf): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          TestNotFlags(rInsn, X86_FlSf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0060);
       return true;
     }
     else
@@ -25158,23 +18301,7 @@ bool X86Architecture::Table_2_9a(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_flags(pf): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          TestFlags(rInsn, X86_FlPf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0061);
       return true;
     }
     else
@@ -25200,23 +18327,7 @@ bool X86Architecture::Table_2_9b(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if test_not_flags(pf): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          TestNotFlags(rInsn, X86_FlPf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0062);
       return true;
     }
     else
@@ -25242,28 +18353,7 @@ bool X86Architecture::Table_2_9c(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) != int(flag.bit, 0): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondNe,
-          new OperationExpression(
-            OperationExpression::OpXor,
-            ExtractFlag(rInsn, X86_FlSf),
-            ExtractFlag(rInsn, X86_FlOf)),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0063);
       return true;
     }
     else
@@ -25289,28 +18379,7 @@ bool X86Architecture::Table_2_9d(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) == int1(0): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpXor,
-            ExtractFlag(rInsn, X86_FlSf),
-            ExtractFlag(rInsn, X86_FlOf)),
-          new ConstantExpression(1, 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0064);
       return true;
     }
     else
@@ -25336,31 +18405,7 @@ bool X86Architecture::Table_2_9e(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) != int(flag.bit, 0): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondNe,
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpXor,
-              ExtractFlag(rInsn, X86_FlSf),
-              ExtractFlag(rInsn, X86_FlOf)),
-            ExtractFlag(rInsn, X86_FlZf)),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0065);
       return true;
     }
     else
@@ -25386,31 +18431,7 @@ bool X86Architecture::Table_2_9f(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) == int(flag.bit, 0): op0.val = int8(1)
-        else: op0.val = int8(0) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondEq,
-          new OperationExpression(
-            OperationExpression::OpOr,
-            new OperationExpression(
-              OperationExpression::OpXor,
-              ExtractFlag(rInsn, X86_FlSf),
-              ExtractFlag(rInsn, X86_FlOf)),
-            ExtractFlag(rInsn, X86_FlZf)),
-          new ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x1))
-        ,
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new ConstantExpression(8, 0x0))
-        );
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0066);
       return true;
     }
     else
@@ -25439,26 +18460,7 @@ bool X86Architecture::Table_2_a0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -25487,26 +18489,7 @@ bool X86Architecture::Table_2_a1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -25684,26 +18667,7 @@ bool X86Architecture::Table_2_a8(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: stack.id -= stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpSub,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.mem = op0.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0002);
       return true;
     }
     else
@@ -25732,26 +18696,7 @@ bool X86Architecture::Table_2_a9(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = stack.mem */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: stack.id += stack.size */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-          new OperationExpression(
-            OperationExpression::OpAdd,
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
-            new ConstantExpression(
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
-              m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0003);
       return true;
     }
     else
@@ -26084,26 +19029,7 @@ bool X86Architecture::Table_2_af(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op0.bit, "res") */
-        new VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: res = op0.val * op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "res"),
-          new OperationExpression(
-            OperationExpression::OpMul,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true)));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = res */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new VariableExpression(0, "res"));
-        AllExpr.push_back(pExpr2);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0067);
       return true;
     }
     else
@@ -26127,27 +19053,7 @@ bool X86Architecture::Table_2_b0(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if op0.val == acc.id: set_flags(zf)
-        else: reset_flags(zf) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondEq,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::AccumulatorRegister), &m_CpuInfo),
-          SetFlags(rInsn, X86_FlZf),
-          ResetFlags(rInsn, X86_FlZf));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: if test_flags(zf): op0.val = op1.val */
-        new IfConditionExpression(
-          TestFlags(rInsn, X86_FlZf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0068);
       return true;
     }
     else
@@ -26171,27 +19077,7 @@ bool X86Architecture::Table_2_b1(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: if op0.val == acc.id: set_flags(zf)
-        else: reset_flags(zf) */
-        new IfElseConditionExpression(
-          ConditionExpression::CondEq,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::AccumulatorRegister), &m_CpuInfo),
-          SetFlags(rInsn, X86_FlZf),
-          ResetFlags(rInsn, X86_FlZf));
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: if test_flags(zf): op0.val = op1.val */
-        new IfConditionExpression(
-          TestFlags(rInsn, X86_FlZf),
-          new OperationExpression(OperationExpression::OpAff,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-        );
-        AllExpr.push_back(pExpr1);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0068);
       return true;
     }
     else
@@ -26303,32 +19189,7 @@ bool X86Architecture::Table_2_b6(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op1.bit, "tmp") */
-        new VariableExpression(rInsn.Operand(1)->GetLength() * 8, "tmp");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: tmp = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "tmp"),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = int(op0.bit, 0) */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x0));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val |= tmp */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new VariableExpression(0, "tmp")));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0069);
       return true;
     }
     else
@@ -26352,32 +19213,7 @@ bool X86Architecture::Table_2_b7(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: var(op1.bit, "tmp") */
-        new VariableExpression(rInsn.Operand(1)->GetLength() * 8, "tmp");
-        AllExpr.push_back(pExpr0);
-        auto pExpr1 = /* Semantic: tmp = op1.val */
-        new OperationExpression(OperationExpression::OpAff,
-          new VariableExpression(0, "tmp"),
-          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true));
-        AllExpr.push_back(pExpr1);
-        auto pExpr2 = /* Semantic: op0.val = int(op0.bit, 0) */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x0));
-        AllExpr.push_back(pExpr2);
-        auto pExpr3 = /* Semantic: op0.val |= tmp */
-        new OperationExpression(
-          OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(
-            OperationExpression::OpOr,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new VariableExpression(0, "tmp")));
-        AllExpr.push_back(pExpr3);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0069);
       return true;
     }
     else
@@ -26702,17 +19538,7 @@ bool X86Architecture::Table_2_be(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = sign_extend(op1.val, op0.size) */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(OperationExpression::OpSext, rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true), new ConstantExpression(
-            32,
-            rInsn.Operand(0)->GetLength())));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0013);
       return true;
     }
     else
@@ -26736,17 +19562,7 @@ bool X86Architecture::Table_2_bf(BinaryStream const& rBinStrm, TOffset Offset, I
       {
         return false;
       }
-      {
-        Expression::List AllExpr;
-        auto pExpr0 = /* Semantic: op0.val = sign_extend(op1.val, op0.size) */
-        new OperationExpression(OperationExpression::OpAff,
-          rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-          new OperationExpression(OperationExpression::OpSext, rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true), new ConstantExpression(
-            32,
-            rInsn.Operand(0)->GetLength())));
-        AllExpr.push_back(pExpr0);
-        rInsn.SetSemantic(AllExpr);
-      }
+      rInsn.SetSemanticId(0x0013);
       return true;
     }
     else
@@ -27001,27 +19817,7 @@ bool X86Architecture::Table_2_c7(BinaryStream const& rBinStrm, TOffset Offset, I
         {
           return false;
         }
-        {
-          Expression::List AllExpr;
-          auto pExpr0 = /* Semantic: if op0.val == acc.id: set_flags(zf)
-          else: reset_flags(zf) */
-          new IfElseConditionExpression(
-            ConditionExpression::CondEq,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::AccumulatorRegister), &m_CpuInfo),
-            SetFlags(rInsn, X86_FlZf),
-            ResetFlags(rInsn, X86_FlZf));
-          AllExpr.push_back(pExpr0);
-          auto pExpr1 = /* Semantic: if test_flags(zf): op0.val = op1.val */
-          new IfConditionExpression(
-            TestFlags(rInsn, X86_FlZf),
-            new OperationExpression(OperationExpression::OpAff,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-          );
-          AllExpr.push_back(pExpr1);
-          rInsn.SetSemantic(AllExpr);
-        }
+        rInsn.SetSemanticId(0x0068);
         return true;
       }
       else
@@ -27032,27 +19828,7 @@ bool X86Architecture::Table_2_c7(BinaryStream const& rBinStrm, TOffset Offset, I
         {
           return false;
         }
-        {
-          Expression::List AllExpr;
-          auto pExpr0 = /* Semantic: if op0.val == acc.id: set_flags(zf)
-          else: reset_flags(zf) */
-          new IfElseConditionExpression(
-            ConditionExpression::CondEq,
-            rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-            new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::AccumulatorRegister), &m_CpuInfo),
-            SetFlags(rInsn, X86_FlZf),
-            ResetFlags(rInsn, X86_FlZf));
-          AllExpr.push_back(pExpr0);
-          auto pExpr1 = /* Semantic: if test_flags(zf): op0.val = op1.val */
-          new IfConditionExpression(
-            TestFlags(rInsn, X86_FlZf),
-            new OperationExpression(OperationExpression::OpAff,
-              rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true),
-              rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true))
-          );
-          AllExpr.push_back(pExpr1);
-          rInsn.SetSemantic(AllExpr);
-        }
+        rInsn.SetSemanticId(0x0068);
         return true;
       }
     case 0x2:
@@ -45917,15 +38693,7 @@ bool X86Architecture::Table_fp4_e3(BinaryStream const& rBinStrm, TOffset Offset,
 {
     rInsn.Length()++;
     rInsn.SetOpcode(X86_Opcode_Fninit);
-    {
-      Expression::List AllExpr;
-      auto pExpr0 = /* Semantic: program.id = program.id */
-      new OperationExpression(OperationExpression::OpAff,
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
-        new IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
-      AllExpr.push_back(pExpr0);
-      rInsn.SetSemantic(AllExpr);
-    }
+    rInsn.SetSemanticId(0x0029);
     return true;
 }
 
@@ -52688,6 +45456,3862 @@ bool X86Architecture::Table_sse5a_ff(BinaryStream const& rBinStrm, TOffset Offse
     return false; /* INVALID */
 }
 
+const X86Architecture::TSemantic X86Architecture::m_Semantic[0x6a] =
+{
+  nullptr,
+  &X86Architecture::Semantic_0001,
+  &X86Architecture::Semantic_0002,
+  &X86Architecture::Semantic_0003,
+  &X86Architecture::Semantic_0004,
+  &X86Architecture::Semantic_0005,
+  &X86Architecture::Semantic_0006,
+  &X86Architecture::Semantic_0007,
+  &X86Architecture::Semantic_0008,
+  &X86Architecture::Semantic_0009,
+  &X86Architecture::Semantic_000a,
+  &X86Architecture::Semantic_000b,
+  &X86Architecture::Semantic_000c,
+  &X86Architecture::Semantic_000d,
+  &X86Architecture::Semantic_000e,
+  &X86Architecture::Semantic_000f,
+  &X86Architecture::Semantic_0010,
+  &X86Architecture::Semantic_0011,
+  &X86Architecture::Semantic_0012,
+  &X86Architecture::Semantic_0013,
+  &X86Architecture::Semantic_0014,
+  &X86Architecture::Semantic_0015,
+  &X86Architecture::Semantic_0016,
+  &X86Architecture::Semantic_0017,
+  &X86Architecture::Semantic_0018,
+  &X86Architecture::Semantic_0019,
+  &X86Architecture::Semantic_001a,
+  &X86Architecture::Semantic_001b,
+  &X86Architecture::Semantic_001c,
+  &X86Architecture::Semantic_001d,
+  &X86Architecture::Semantic_001e,
+  &X86Architecture::Semantic_001f,
+  &X86Architecture::Semantic_0020,
+  &X86Architecture::Semantic_0021,
+  &X86Architecture::Semantic_0022,
+  &X86Architecture::Semantic_0023,
+  &X86Architecture::Semantic_0024,
+  &X86Architecture::Semantic_0025,
+  &X86Architecture::Semantic_0026,
+  &X86Architecture::Semantic_0027,
+  &X86Architecture::Semantic_0028,
+  &X86Architecture::Semantic_0029,
+  &X86Architecture::Semantic_002a,
+  &X86Architecture::Semantic_002b,
+  &X86Architecture::Semantic_002c,
+  &X86Architecture::Semantic_002d,
+  &X86Architecture::Semantic_002e,
+  &X86Architecture::Semantic_002f,
+  &X86Architecture::Semantic_0030,
+  &X86Architecture::Semantic_0031,
+  &X86Architecture::Semantic_0032,
+  &X86Architecture::Semantic_0033,
+  &X86Architecture::Semantic_0034,
+  &X86Architecture::Semantic_0035,
+  &X86Architecture::Semantic_0036,
+  &X86Architecture::Semantic_0037,
+  &X86Architecture::Semantic_0038,
+  &X86Architecture::Semantic_0039,
+  &X86Architecture::Semantic_003a,
+  &X86Architecture::Semantic_003b,
+  &X86Architecture::Semantic_003c,
+  &X86Architecture::Semantic_003d,
+  &X86Architecture::Semantic_003e,
+  &X86Architecture::Semantic_003f,
+  &X86Architecture::Semantic_0040,
+  &X86Architecture::Semantic_0041,
+  &X86Architecture::Semantic_0042,
+  &X86Architecture::Semantic_0043,
+  &X86Architecture::Semantic_0044,
+  &X86Architecture::Semantic_0045,
+  &X86Architecture::Semantic_0046,
+  &X86Architecture::Semantic_0047,
+  &X86Architecture::Semantic_0048,
+  &X86Architecture::Semantic_0049,
+  &X86Architecture::Semantic_004a,
+  &X86Architecture::Semantic_004b,
+  &X86Architecture::Semantic_004c,
+  &X86Architecture::Semantic_004d,
+  &X86Architecture::Semantic_004e,
+  &X86Architecture::Semantic_004f,
+  &X86Architecture::Semantic_0050,
+  &X86Architecture::Semantic_0051,
+  &X86Architecture::Semantic_0052,
+  &X86Architecture::Semantic_0053,
+  &X86Architecture::Semantic_0054,
+  &X86Architecture::Semantic_0055,
+  &X86Architecture::Semantic_0056,
+  &X86Architecture::Semantic_0057,
+  &X86Architecture::Semantic_0058,
+  &X86Architecture::Semantic_0059,
+  &X86Architecture::Semantic_005a,
+  &X86Architecture::Semantic_005b,
+  &X86Architecture::Semantic_005c,
+  &X86Architecture::Semantic_005d,
+  &X86Architecture::Semantic_005e,
+  &X86Architecture::Semantic_005f,
+  &X86Architecture::Semantic_0060,
+  &X86Architecture::Semantic_0061,
+  &X86Architecture::Semantic_0062,
+  &X86Architecture::Semantic_0063,
+  &X86Architecture::Semantic_0064,
+  &X86Architecture::Semantic_0065,
+  &X86Architecture::Semantic_0066,
+  &X86Architecture::Semantic_0067,
+  &X86Architecture::Semantic_0068,
+  &X86Architecture::Semantic_0069
+};
+
+bool X86Architecture::Semantic_0001(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val + op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr3);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0002(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: stack.id -= stack.size */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: stack.mem = op0.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()));
+  AllExpr.push_back(pExpr1);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0003(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: op0.val = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: stack.id += stack.size */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
+  AllExpr.push_back(pExpr1);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0004(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val | op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr3);
+  AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0005(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val + op1.val + extract_flag(cf) */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpAdd,
+        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())),
+      ExtractFlag(rInsn, X86_FlCf)));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr3);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0006(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val - op1.val - extract_flag(cf) */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpSub,
+        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())),
+      ExtractFlag(rInsn, X86_FlCf)));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr3);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0007(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val & op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAnd,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr3);
+  AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0008(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  AllExpr.push_back(ResetFlags(rInsn, X86_FlOf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0009(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val - op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr3);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_000a(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val ^ op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpXor,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr3);
+  AllExpr.push_back(ResetFlags(rInsn, X86_FlAf | X86_FlOf | X86_FlCf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_000b(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val - op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_000c(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  AllExpr.push_back(ResetFlags(rInsn, X86_FlOf | X86_FlSf | X86_FlZf | X86_FlPf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_000d(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val + int(op0.bit, 1) */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr3);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_000e(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val - int(op0.bit, 1) */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x1)));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr3);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_000f(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: stack.id -= int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: stack.mem = eax.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Eax, &m_CpuInfo));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: stack.id -= int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: stack.mem = ecx.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ecx, &m_CpuInfo));
+  AllExpr.push_back(pExpr3);
+  auto pExpr4 = /* Semantic: stack.id -= int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr4);
+  auto pExpr5 = /* Semantic: stack.mem = edx.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Edx, &m_CpuInfo));
+  AllExpr.push_back(pExpr5);
+  auto pExpr6 = /* Semantic: stack.id -= int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr6);
+  auto pExpr7 = /* Semantic: stack.mem = ebx.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ebx, &m_CpuInfo));
+  AllExpr.push_back(pExpr7);
+  auto pExpr8 = /* Semantic: stack.id -= int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr8);
+  auto pExpr9 = /* Semantic: stack.mem = esp.id + int(32, 16) */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Esp, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x10)));
+  AllExpr.push_back(pExpr9);
+  auto pExpr10 = /* Semantic: stack.id -= int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr10);
+  auto pExpr11 = /* Semantic: stack.mem = ebp.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ebp, &m_CpuInfo));
+  AllExpr.push_back(pExpr11);
+  auto pExpr12 = /* Semantic: stack.id -= int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr12);
+  auto pExpr13 = /* Semantic: stack.mem = esi.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Esi, &m_CpuInfo));
+  AllExpr.push_back(pExpr13);
+  auto pExpr14 = /* Semantic: stack.id -= int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr14);
+  auto pExpr15 = /* Semantic: stack.mem = edi.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Edi, &m_CpuInfo));
+  AllExpr.push_back(pExpr15);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0010(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: stack.id -= int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: stack.mem = ax.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ax, &m_CpuInfo));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: stack.id -= int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: stack.mem = cx.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Cx, &m_CpuInfo));
+  AllExpr.push_back(pExpr3);
+  auto pExpr4 = /* Semantic: stack.id -= int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr4);
+  auto pExpr5 = /* Semantic: stack.mem = dx.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Dx, &m_CpuInfo));
+  AllExpr.push_back(pExpr5);
+  auto pExpr6 = /* Semantic: stack.id -= int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr6);
+  auto pExpr7 = /* Semantic: stack.mem = bx.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Bx, &m_CpuInfo));
+  AllExpr.push_back(pExpr7);
+  auto pExpr8 = /* Semantic: stack.id -= int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr8);
+  auto pExpr9 = /* Semantic: stack.mem = sp.id + int(16, 8) */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Sp, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x8)));
+  AllExpr.push_back(pExpr9);
+  auto pExpr10 = /* Semantic: stack.id -= int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr10);
+  auto pExpr11 = /* Semantic: stack.mem = bp.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Bp, &m_CpuInfo));
+  AllExpr.push_back(pExpr11);
+  auto pExpr12 = /* Semantic: stack.id -= int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr12);
+  auto pExpr13 = /* Semantic: stack.mem = si.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Si, &m_CpuInfo));
+  AllExpr.push_back(pExpr13);
+  auto pExpr14 = /* Semantic: stack.id -= int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr14);
+  auto pExpr15 = /* Semantic: stack.mem = di.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Di, &m_CpuInfo));
+  AllExpr.push_back(pExpr15);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0011(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: edi.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Edi, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: stack.id += int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: esi.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Esi, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: stack.id += int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr3);
+  auto pExpr4 = /* Semantic: ebp.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ebp, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr4);
+  auto pExpr5 = /* Semantic: stack.id += int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr5);
+  auto pExpr6 = /* Semantic: esp.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Esp, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr6);
+  auto pExpr7 = /* Semantic: stack.id += int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr7);
+  auto pExpr8 = /* Semantic: ebx.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ebx, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr8);
+  auto pExpr9 = /* Semantic: stack.id += int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr9);
+  auto pExpr10 = /* Semantic: edx.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Edx, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr10);
+  auto pExpr11 = /* Semantic: stack.id += int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr11);
+  auto pExpr12 = /* Semantic: ecx.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ecx, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr12);
+  auto pExpr13 = /* Semantic: stack.id += int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr13);
+  auto pExpr14 = /* Semantic: eax.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr14);
+  auto pExpr15 = /* Semantic: stack.id += int(32, 4) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x20, 0x4)));
+  AllExpr.push_back(pExpr15);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0012(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: di.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Di, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: stack.id += int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: si.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Si, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: stack.id += int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr3);
+  auto pExpr4 = /* Semantic: bp.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Bp, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr4);
+  auto pExpr5 = /* Semantic: stack.id += int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr5);
+  auto pExpr6 = /* Semantic: sp.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Sp, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr6);
+  auto pExpr7 = /* Semantic: stack.id += int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr7);
+  auto pExpr8 = /* Semantic: bx.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Bx, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr8);
+  auto pExpr9 = /* Semantic: stack.id += int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr9);
+  auto pExpr10 = /* Semantic: dx.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Dx, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr10);
+  auto pExpr11 = /* Semantic: stack.id += int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr11);
+  auto pExpr12 = /* Semantic: cx.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Cx, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr12);
+  auto pExpr13 = /* Semantic: stack.id += int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr13);
+  auto pExpr14 = /* Semantic: ax.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr14);
+  auto pExpr15 = /* Semantic: stack.id += int(16, 2) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(0x10, 0x2)));
+  AllExpr.push_back(pExpr15);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0013(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: op0.val = sign_extend(op1.val, op0.size) */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpSext, rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()), new (rInsn.SemanticArena()) ConstantExpression(
+      32,
+      rInsn.Operand(0)->GetLength())));
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0014(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op1.val * op2.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpMul,
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(2)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  AllExpr.push_back(ResetFlags(rInsn, X86_FlSf | X86_FlZf | X86_FlAf | X86_FlPf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0015(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(of): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestFlags(rInsn, X86_FlOf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0016(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(of): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestNotFlags(rInsn, X86_FlOf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0017(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(cf): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestFlags(rInsn, X86_FlCf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0018(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(cf): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestNotFlags(rInsn, X86_FlCf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0019(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(zf): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestFlags(rInsn, X86_FlZf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_001a(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(zf): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestNotFlags(rInsn, X86_FlZf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_001b(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) != int(flag.bit, 0): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      ExtractFlag(rInsn, X86_FlCf),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_001c(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) == int(flag.bit, 0): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      ExtractFlag(rInsn, X86_FlCf),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_001d(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(sf): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestFlags(rInsn, X86_FlSf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_001e(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(sf): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestNotFlags(rInsn, X86_FlSf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_001f(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(pf): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestFlags(rInsn, X86_FlPf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0020(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(pf): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestNotFlags(rInsn, X86_FlPf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0021(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) != int(flag.bit, 0): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpXor,
+      ExtractFlag(rInsn, X86_FlSf),
+      ExtractFlag(rInsn, X86_FlOf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0022(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) == int(flag.bit, 0): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpXor,
+      ExtractFlag(rInsn, X86_FlSf),
+      ExtractFlag(rInsn, X86_FlOf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0023(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) != int(flag.bit, 0): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpXor,
+        ExtractFlag(rInsn, X86_FlSf),
+        ExtractFlag(rInsn, X86_FlOf)),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0024(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) == int(flag.bit, 0): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpXor,
+        ExtractFlag(rInsn, X86_FlSf),
+        ExtractFlag(rInsn, X86_FlOf)),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0025(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val & op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAnd,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  AllExpr.push_back(ResetFlags(rInsn, X86_FlAf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0026(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: swap(op0.val, op1.val) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpXchg,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()));;
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0027(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: op0.val = op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()));
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0028(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: op0.val = op1.addr */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false, &rInsn.SemanticArena()));
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0029(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: program.id = program.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_002a(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (eax.id & int32(0x80000000)) == int32(0): rax.id &= int64(0x00000000ffffffff)
+  else: rax.id |= int64(0xffffffff00000000) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAnd,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(32, 0x80000000)),
+    new (rInsn.SemanticArena()) ConstantExpression(32, 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Rax, &m_CpuInfo),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpAnd,
+        new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Rax, &m_CpuInfo),
+        new (rInsn.SemanticArena()) ConstantExpression(64, 0xffffffff)))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Rax, &m_CpuInfo),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpOr,
+        new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Rax, &m_CpuInfo),
+        new (rInsn.SemanticArena()) ConstantExpression(64, 0xffffffff00000000)))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_002b(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (ax.id & int16(0x8000)) == int16(0): eax.id &= int32(0x0000ffff)
+  else: eax.id |= int32(0xffff0000) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAnd,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(16, 0x8000)),
+    new (rInsn.SemanticArena()) ConstantExpression(16, 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpAnd,
+        new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
+        new (rInsn.SemanticArena()) ConstantExpression(32, 0xffff)))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpOr,
+        new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
+        new (rInsn.SemanticArena()) ConstantExpression(32, 0xffff0000)))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_002c(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (al.id & int8(0x80)) == int8(0): ax.id &= int16(0x00ff)
+  else: ax.id |= int16(0xff00) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAnd,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Al, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x80)),
+    new (rInsn.SemanticArena()) ConstantExpression(8, 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpAnd,
+        new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
+        new (rInsn.SemanticArena()) ConstantExpression(16, 0xff)))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpOr,
+        new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
+        new (rInsn.SemanticArena()) ConstantExpression(16, 0xff00)))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_002d(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (rax.id & int64(0x8000000000000000)) == int64(0): rdx.id = int64(0xffffffffffffffff)
+  else: rdx.id = int64(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAnd,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Rax, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(64, 0x8000000000000000)),
+    new (rInsn.SemanticArena()) ConstantExpression(64, 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Rdx, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(64, 0xffffffffffffffff))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Rdx, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(64, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_002e(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (eax.id & int32(0x80000000)) == int32(0): edx.id = int32(0xffffffff)
+  else: edx.id = int32(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAnd,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Eax, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(32, 0x80000000)),
+    new (rInsn.SemanticArena()) ConstantExpression(32, 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Edx, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(32, 0xffffffff))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Edx, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(32, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_002f(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (ax.id & int16(0x8000)) == int16(0): dx.id = int16(0xffff)
+  else: dx.id = int16(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAnd,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Ax, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(16, 0x8000)),
+    new (rInsn.SemanticArena()) ConstantExpression(16, 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Dx, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(16, 0xffff))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(X86_Reg_Dx, &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(16, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0030(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: op0.val = op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: if test_flags(df): op0.addr -= op0.size
+  else:op0.addr += op0.size */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestFlags(rInsn, X86_FlDf),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpSub,
+        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false, &rInsn.SemanticArena()),
+        new (rInsn.SemanticArena()) ConstantExpression(
+          32,
+          rInsn.Operand(0)->GetLength())))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpAdd,
+        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false, &rInsn.SemanticArena()),
+        new (rInsn.SemanticArena()) ConstantExpression(
+          32,
+          rInsn.Operand(0)->GetLength())))
+  );
+  AllExpr.push_back(pExpr1);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0031(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if op0.val == op1.val: set_flags(zf)
+  else: reset_flags(zf) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondEq,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    SetFlags(rInsn, X86_FlZf),
+    ResetFlags(rInsn, X86_FlZf));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: if test_flags(df): op0.addr -= op0.size
+  else: op0.addr += op0.size */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestFlags(rInsn, X86_FlDf),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpSub,
+        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false, &rInsn.SemanticArena()),
+        new (rInsn.SemanticArena()) ConstantExpression(
+          32,
+          rInsn.Operand(0)->GetLength())))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpAdd,
+        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), false, &rInsn.SemanticArena()),
+        new (rInsn.SemanticArena()) ConstantExpression(
+          32,
+          rInsn.Operand(0)->GetLength())))
+  );
+  AllExpr.push_back(pExpr1);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0032(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = ((op0.val << op1.val) | (op0.val >> (int(op0.bit, op0.bit) - op1.val))) */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpLls,
+        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpLrs,
+        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+        new (rInsn.SemanticArena()) OperationExpression(
+          OperationExpression::OpSub,
+          new (rInsn.SemanticArena()) ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
+          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())))));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0033(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = ((op0.val >> op1.val) | (op0.val << (int(op0.bit, op0.bit) - op1.val))) */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpLrs,
+        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+        rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpLls,
+        rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+        new (rInsn.SemanticArena()) OperationExpression(
+          OperationExpression::OpSub,
+          new (rInsn.SemanticArena()) ConstantExpression(rInsn.Operand(0)->GetLength() * 8, rInsn.Operand(0)->GetLength() * 8),
+          rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())))));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0034(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: op0.val = op0.val << op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpLls,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0035(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: op0.val = op0.val >> op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpLrs,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0036(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: program.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: stack.id += stack.size */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: stack.id += op0.val */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr2);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0037(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: program.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: stack.id += stack.size */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
+  AllExpr.push_back(pExpr1);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0038(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: stack.id = frame.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackFrameRegister), &m_CpuInfo));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: frame.id = stack.mem */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackFrameRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: stack.id += stack.size */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpAdd,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
+  AllExpr.push_back(pExpr2);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0039(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  AllExpr.push_back(ResetFlags(rInsn, X86_FlOf | X86_FlAf | X86_FlCf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_003a(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: cnt.id -= int(cnt.bit, 1) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x1)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: if (extract_flag(zf) ^ int(cnt.bit, 1) & cnt.id) != int(cnt.bit, 0): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpXor,
+      ExtractFlag(rInsn, X86_FlZf),
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpAnd,
+        new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x1),
+        new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo))),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr1);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_003b(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: cnt.id -= int(cnt.bit, 1) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x1)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: if (cnt.id | extract_flag(zf)) != int(cnt.bit, 0): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr1);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_003c(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: cnt.id -= int(cnt.bit, 1) */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x1)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: if cnt.id != int(cnt.bit, 0): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr1);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_003d(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if cnt.id == int(cnt.bit, 0): program.id = op0.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_003e(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: stack.id -= stack.size */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpSub,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo),
+      new (rInsn.SemanticArena()) ConstantExpression(
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)),
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)) / 8)));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: stack.mem = program.id */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) MemoryExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister)), nullptr, new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister), &m_CpuInfo)),
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: program.id = op0.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()));
+  AllExpr.push_back(pExpr2);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_003f(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: program.id = op0.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister), &m_CpuInfo),
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()));
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0040(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val ^ int(op0.bit, -1) */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpXor,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(rInsn.Operand(0)->GetLength() * 8, -0x1)));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: update_flags(res) */
+  UpdateFlags(rInsn, new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr3);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0041(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: acc.id *= op0.val */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::AccumulatorRegister), &m_CpuInfo),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpMul,
+      new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::AccumulatorRegister), &m_CpuInfo),
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0042(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  AllExpr.push_back(ResetFlags(rInsn, X86_FlCf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0043(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  AllExpr.push_back(ResetFlags(rInsn, X86_FlIf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0044(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  AllExpr.push_back(SetFlags(rInsn, X86_FlIf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0045(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  AllExpr.push_back(ResetFlags(rInsn, X86_FlDf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0046(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  AllExpr.push_back(SetFlags(rInsn, X86_FlDf));
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0047(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(of): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestFlags(rInsn, X86_FlOf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0048(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(of): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestNotFlags(rInsn, X86_FlOf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0049(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(cf): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestFlags(rInsn, X86_FlCf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_004a(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(cf): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestNotFlags(rInsn, X86_FlCf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_004b(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(zf): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestFlags(rInsn, X86_FlZf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_004c(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(zf): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestNotFlags(rInsn, X86_FlZf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_004d(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) != int(flag.bit, 0): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      ExtractFlag(rInsn, X86_FlCf),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_004e(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) == int(flag.bit, 0): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      ExtractFlag(rInsn, X86_FlCf),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_004f(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(sf): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestFlags(rInsn, X86_FlSf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0050(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(sf): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestNotFlags(rInsn, X86_FlSf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0051(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(pf): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestFlags(rInsn, X86_FlPf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0052(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(pf): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestNotFlags(rInsn, X86_FlPf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0053(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) != int(flag.bit, 0): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpXor,
+      ExtractFlag(rInsn, X86_FlSf),
+      ExtractFlag(rInsn, X86_FlOf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0054(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) == int(flag.bit, 0): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpXor,
+      ExtractFlag(rInsn, X86_FlSf),
+      ExtractFlag(rInsn, X86_FlOf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0055(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) != int(flag.bit, 0): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpXor,
+        ExtractFlag(rInsn, X86_FlSf),
+        ExtractFlag(rInsn, X86_FlOf)),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0056(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) == int(flag.bit, 0): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpXor,
+        ExtractFlag(rInsn, X86_FlSf),
+        ExtractFlag(rInsn, X86_FlOf)),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0057(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(of): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestFlags(rInsn, X86_FlOf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0058(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(of): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestNotFlags(rInsn, X86_FlOf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0059(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(cf): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestFlags(rInsn, X86_FlCf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_005a(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(cf): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestNotFlags(rInsn, X86_FlCf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_005b(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(zf): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestFlags(rInsn, X86_FlZf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_005c(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(zf): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestNotFlags(rInsn, X86_FlZf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_005d(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) != int(flag.bit, 0): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      ExtractFlag(rInsn, X86_FlCf),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_005e(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(cf) | extract_flag(zf)) == int(flag.bit, 0): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      ExtractFlag(rInsn, X86_FlCf),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_005f(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(sf): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestFlags(rInsn, X86_FlSf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0060(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(sf): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestNotFlags(rInsn, X86_FlSf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0061(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_flags(pf): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestFlags(rInsn, X86_FlPf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0062(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if test_not_flags(pf): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    TestNotFlags(rInsn, X86_FlPf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0063(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) != int(flag.bit, 0): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpXor,
+      ExtractFlag(rInsn, X86_FlSf),
+      ExtractFlag(rInsn, X86_FlOf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0064(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if (extract_flag(sf) ^ extract_flag(of)) == int1(0): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpXor,
+      ExtractFlag(rInsn, X86_FlSf),
+      ExtractFlag(rInsn, X86_FlOf)),
+    new (rInsn.SemanticArena()) ConstantExpression(1, 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0065(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) != int(flag.bit, 0): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondNe,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpXor,
+        ExtractFlag(rInsn, X86_FlSf),
+        ExtractFlag(rInsn, X86_FlOf)),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0066(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if ((extract_flag(sf) ^ extract_flag(of)) | extract_flag(zf)) == int(flag.bit, 0): op0.val = int8(1)
+  else: op0.val = int8(0) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondEq,
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      new (rInsn.SemanticArena()) OperationExpression(
+        OperationExpression::OpXor,
+        ExtractFlag(rInsn, X86_FlSf),
+        ExtractFlag(rInsn, X86_FlOf)),
+      ExtractFlag(rInsn, X86_FlZf)),
+    new (rInsn.SemanticArena()) ConstantExpression(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::FlagRegister)), 0x0),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x1))
+  ,
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) ConstantExpression(8, 0x0))
+  );
+  AllExpr.push_back(pExpr0);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0067(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op0.bit, "res") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(0)->GetLength() * 8, "res");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: res = op0.val * op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpMul,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena())));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: op0.val = res */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) VariableExpression(0, "res"));
+  AllExpr.push_back(pExpr2);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0068(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: if op0.val == acc.id: set_flags(zf)
+  else: reset_flags(zf) */
+  new (rInsn.SemanticArena()) IfElseConditionExpression(
+    ConditionExpression::CondEq,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) IdentifierExpression(m_CpuInfo.GetRegisterByType(CpuInformation::AccumulatorRegister), &m_CpuInfo),
+    SetFlags(rInsn, X86_FlZf),
+    ResetFlags(rInsn, X86_FlZf));
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: if test_flags(zf): op0.val = op1.val */
+  new (rInsn.SemanticArena()) IfConditionExpression(
+    TestFlags(rInsn, X86_FlZf),
+    new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()))
+  );
+  AllExpr.push_back(pExpr1);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+bool X86Architecture::Semantic_0069(Instruction& rInsn)
+{
+  Expression::List AllExpr;
+  auto pExpr0 = /* Semantic: var(op1.bit, "tmp") */
+  new (rInsn.SemanticArena()) VariableExpression(rInsn.Operand(1)->GetLength() * 8, "tmp");
+  AllExpr.push_back(pExpr0);
+  auto pExpr1 = /* Semantic: tmp = op1.val */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    new (rInsn.SemanticArena()) VariableExpression(0, "tmp"),
+    rInsn.Operand(1)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()));
+  AllExpr.push_back(pExpr1);
+  auto pExpr2 = /* Semantic: op0.val = int(op0.bit, 0) */
+  new (rInsn.SemanticArena()) OperationExpression(OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) ConstantExpression(rInsn.Operand(0)->GetLength() * 8, 0x0));
+  AllExpr.push_back(pExpr2);
+  auto pExpr3 = /* Semantic: op0.val |= tmp */
+  new (rInsn.SemanticArena()) OperationExpression(
+    OperationExpression::OpAff,
+    rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+    new (rInsn.SemanticArena()) OperationExpression(
+      OperationExpression::OpOr,
+      rInsn.Operand(0)->GetSemantic(&m_CpuInfo, static_cast<u8>(rInsn.GetLength()), true, &rInsn.SemanticArena()),
+      new (rInsn.SemanticArena()) VariableExpression(0, "tmp")));
+  AllExpr.push_back(pExpr3);
+  rInsn.SetSemantic(AllExpr);
+  return true;
+}
+
+const u16 X86Architecture::m_Length_1[0x100] =
+{
+  /* 00 */ X86_Len_ModRm,
+  /* 01 */ X86_Len_ModRm,
+  /* 02 */ X86_Len_ModRm,
+  /* 03 */ X86_Len_ModRm,
+  /* 04 */ X86_Len_Ib,
+  /* 05 */ X86_Len_Iz,
+  /* 06 */ X86_Len_Invalid64,
+  /* 07 */ X86_Len_Invalid64,
+  /* 08 */ X86_Len_ModRm,
+  /* 09 */ X86_Len_ModRm,
+  /* 0a */ X86_Len_ModRm,
+  /* 0b */ X86_Len_ModRm,
+  /* 0c */ X86_Len_Ib,
+  /* 0d */ X86_Len_Iz,
+  /* 0e */ X86_Len_Invalid64,
+  /* 0f */ X86_Len_Escape | (1 << X86_Len_ArgShift),
+  /* 10 */ X86_Len_ModRm,
+  /* 11 */ X86_Len_ModRm,
+  /* 12 */ X86_Len_ModRm,
+  /* 13 */ X86_Len_ModRm,
+  /* 14 */ X86_Len_Ib,
+  /* 15 */ X86_Len_Iz,
+  /* 16 */ X86_Len_Invalid64,
+  /* 17 */ X86_Len_Invalid64,
+  /* 18 */ X86_Len_ModRm,
+  /* 19 */ X86_Len_ModRm,
+  /* 1a */ X86_Len_ModRm,
+  /* 1b */ X86_Len_ModRm,
+  /* 1c */ X86_Len_Ib,
+  /* 1d */ X86_Len_Iz,
+  /* 1e */ X86_Len_Invalid64,
+  /* 1f */ X86_Len_Invalid64,
+  /* 20 */ X86_Len_ModRm,
+  /* 21 */ X86_Len_ModRm,
+  /* 22 */ X86_Len_ModRm,
+  /* 23 */ X86_Len_ModRm,
+  /* 24 */ X86_Len_Ib,
+  /* 25 */ X86_Len_Iz,
+  /* 26 */ X86_Len_Prefix,
+  /* 27 */ X86_Len_Invalid64,
+  /* 28 */ X86_Len_ModRm,
+  /* 29 */ X86_Len_ModRm,
+  /* 2a */ X86_Len_ModRm,
+  /* 2b */ X86_Len_ModRm,
+  /* 2c */ X86_Len_Ib,
+  /* 2d */ X86_Len_Iz,
+  /* 2e */ X86_Len_Prefix,
+  /* 2f */ X86_Len_Invalid64,
+  /* 30 */ X86_Len_ModRm,
+  /* 31 */ X86_Len_ModRm,
+  /* 32 */ X86_Len_ModRm,
+  /* 33 */ X86_Len_ModRm,
+  /* 34 */ X86_Len_Ib,
+  /* 35 */ X86_Len_Iz,
+  /* 36 */ X86_Len_Prefix,
+  /* 37 */ X86_Len_None,
+  /* 38 */ X86_Len_ModRm,
+  /* 39 */ X86_Len_ModRm,
+  /* 3a */ X86_Len_ModRm,
+  /* 3b */ X86_Len_ModRm,
+  /* 3c */ X86_Len_Ib,
+  /* 3d */ X86_Len_Iz,
+  /* 3e */ X86_Len_Prefix,
+  /* 3f */ X86_Len_Invalid64,
+  /* 40 */ X86_Len_Prefix64,
+  /* 41 */ X86_Len_Prefix64,
+  /* 42 */ X86_Len_Prefix64,
+  /* 43 */ X86_Len_Prefix64,
+  /* 44 */ X86_Len_Prefix64,
+  /* 45 */ X86_Len_Prefix64,
+  /* 46 */ X86_Len_Prefix64,
+  /* 47 */ X86_Len_Prefix64,
+  /* 48 */ X86_Len_Prefix64,
+  /* 49 */ X86_Len_Prefix64,
+  /* 4a */ X86_Len_Prefix64,
+  /* 4b */ X86_Len_Prefix64,
+  /* 4c */ X86_Len_Prefix64,
+  /* 4d */ X86_Len_Prefix64,
+  /* 4e */ X86_Len_Prefix64,
+  /* 4f */ X86_Len_Prefix64,
+  /* 50 */ X86_Len_None,
+  /* 51 */ X86_Len_None,
+  /* 52 */ X86_Len_None,
+  /* 53 */ X86_Len_None,
+  /* 54 */ X86_Len_None,
+  /* 55 */ X86_Len_None,
+  /* 56 */ X86_Len_None,
+  /* 57 */ X86_Len_None,
+  /* 58 */ X86_Len_None,
+  /* 59 */ X86_Len_None,
+  /* 5a */ X86_Len_None,
+  /* 5b */ X86_Len_None,
+  /* 5c */ X86_Len_None,
+  /* 5d */ X86_Len_None,
+  /* 5e */ X86_Len_None,
+  /* 5f */ X86_Len_None,
+  /* 60 */ X86_Len_Invalid64,
+  /* 61 */ X86_Len_Invalid64,
+  /* 62 */ X86_Len_ModRm | X86_Len_Invalid64,
+  /* 63 */ X86_Len_ModRm,
+  /* 64 */ X86_Len_Prefix,
+  /* 65 */ X86_Len_Prefix,
+  /* 66 */ X86_Len_Prefix,
+  /* 67 */ X86_Len_Prefix,
+  /* 68 */ X86_Len_Iz,
+  /* 69 */ X86_Len_ModRm | X86_Len_Iz,
+  /* 6a */ X86_Len_Ib,
+  /* 6b */ X86_Len_ModRm | X86_Len_Ib,
+  /* 6c */ X86_Len_None,
+  /* 6d */ X86_Len_None,
+  /* 6e */ X86_Len_None,
+  /* 6f */ X86_Len_None,
+  /* 70 */ X86_Len_Ib,
+  /* 71 */ X86_Len_Ib,
+  /* 72 */ X86_Len_Ib,
+  /* 73 */ X86_Len_Ib,
+  /* 74 */ X86_Len_Ib,
+  /* 75 */ X86_Len_Ib,
+  /* 76 */ X86_Len_Ib,
+  /* 77 */ X86_Len_Ib,
+  /* 78 */ X86_Len_Ib,
+  /* 79 */ X86_Len_Ib,
+  /* 7a */ X86_Len_Ib,
+  /* 7b */ X86_Len_Ib,
+  /* 7c */ X86_Len_Ib,
+  /* 7d */ X86_Len_Ib,
+  /* 7e */ X86_Len_Ib,
+  /* 7f */ X86_Len_Ib,
+  /* 80 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 81 */ X86_Len_ModRm | X86_Len_Iz,
+  /* 82 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 83 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 84 */ X86_Len_ModRm,
+  /* 85 */ X86_Len_ModRm,
+  /* 86 */ X86_Len_ModRm,
+  /* 87 */ X86_Len_ModRm,
+  /* 88 */ X86_Len_ModRm,
+  /* 89 */ X86_Len_ModRm,
+  /* 8a */ X86_Len_ModRm,
+  /* 8b */ X86_Len_ModRm,
+  /* 8c */ X86_Len_ModRm,
+  /* 8d */ X86_Len_ModRm,
+  /* 8e */ X86_Len_ModRm,
+  /* 8f */ X86_Len_ModRm | X86_Len_Group,
+  /* 90 */ X86_Len_None,
+  /* 91 */ X86_Len_None,
+  /* 92 */ X86_Len_None,
+  /* 93 */ X86_Len_None,
+  /* 94 */ X86_Len_None,
+  /* 95 */ X86_Len_None,
+  /* 96 */ X86_Len_None,
+  /* 97 */ X86_Len_None,
+  /* 98 */ X86_Len_None,
+  /* 99 */ X86_Len_None,
+  /* 9a */ X86_Len_Invalid64 | X86_Len_Ap,
+  /* 9b */ X86_Len_None,
+  /* 9c */ X86_Len_None,
+  /* 9d */ X86_Len_None,
+  /* 9e */ X86_Len_None,
+  /* 9f */ X86_Len_None,
+  /* a0 */ X86_Len_Ov,
+  /* a1 */ X86_Len_Ov,
+  /* a2 */ X86_Len_Ov,
+  /* a3 */ X86_Len_Ov,
+  /* a4 */ X86_Len_None,
+  /* a5 */ X86_Len_None,
+  /* a6 */ X86_Len_None,
+  /* a7 */ X86_Len_None,
+  /* a8 */ X86_Len_Ib,
+  /* a9 */ X86_Len_Iz,
+  /* aa */ X86_Len_None,
+  /* ab */ X86_Len_None,
+  /* ac */ X86_Len_None,
+  /* ad */ X86_Len_None,
+  /* ae */ X86_Len_None,
+  /* af */ X86_Len_None,
+  /* b0 */ X86_Len_Ib,
+  /* b1 */ X86_Len_Ib,
+  /* b2 */ X86_Len_Ib,
+  /* b3 */ X86_Len_Ib,
+  /* b4 */ X86_Len_Ib,
+  /* b5 */ X86_Len_Ib,
+  /* b6 */ X86_Len_Ib,
+  /* b7 */ X86_Len_Ib,
+  /* b8 */ X86_Len_Iv,
+  /* b9 */ X86_Len_Iv,
+  /* ba */ X86_Len_Iv,
+  /* bb */ X86_Len_Iv,
+  /* bc */ X86_Len_Iv,
+  /* bd */ X86_Len_Iv,
+  /* be */ X86_Len_Iv,
+  /* bf */ X86_Len_Iv,
+  /* c0 */ X86_Len_ModRm | X86_Len_Ib,
+  /* c1 */ X86_Len_ModRm | X86_Len_Ib,
+  /* c2 */ X86_Len_Iw,
+  /* c3 */ X86_Len_None,
+  /* c4 */ X86_Len_Fallback,
+  /* c5 */ X86_Len_Fallback,
+  /* c6 */ X86_Len_ModRm | X86_Len_Group | (1 << X86_Len_ArgShift),
+  /* c7 */ X86_Len_ModRm | X86_Len_Group | (2 << X86_Len_ArgShift),
+  /* c8 */ X86_Len_Iw_Ib,
+  /* c9 */ X86_Len_None,
+  /* ca */ X86_Len_Iw,
+  /* cb */ X86_Len_None,
+  /* cc */ X86_Len_None,
+  /* cd */ X86_Len_Ib,
+  /* ce */ X86_Len_Invalid64,
+  /* cf */ X86_Len_None,
+  /* d0 */ X86_Len_ModRm,
+  /* d1 */ X86_Len_ModRm,
+  /* d2 */ X86_Len_ModRm,
+  /* d3 */ X86_Len_ModRm,
+  /* d4 */ X86_Len_Invalid64 | X86_Len_Ib,
+  /* d5 */ X86_Len_Invalid64 | X86_Len_Ib,
+  /* d6 */ X86_Len_Invalid64,
+  /* d7 */ X86_Len_None,
+  /* d8 */ X86_Len_ModRm,
+  /* d9 */ X86_Len_ModRm,
+  /* da */ X86_Len_ModRm,
+  /* db */ X86_Len_ModRm,
+  /* dc */ X86_Len_ModRm,
+  /* dd */ X86_Len_ModRm,
+  /* de */ X86_Len_ModRm,
+  /* df */ X86_Len_ModRm,
+  /* e0 */ X86_Len_Ib,
+  /* e1 */ X86_Len_Ib,
+  /* e2 */ X86_Len_Ib,
+  /* e3 */ X86_Len_Ib,
+  /* e4 */ X86_Len_Ib,
+  /* e5 */ X86_Len_Ib,
+  /* e6 */ X86_Len_Ib,
+  /* e7 */ X86_Len_Ib,
+  /* e8 */ X86_Len_Iz,
+  /* e9 */ X86_Len_Iz,
+  /* ea */ X86_Len_Invalid64 | X86_Len_Ap,
+  /* eb */ X86_Len_Ib,
+  /* ec */ X86_Len_None,
+  /* ed */ X86_Len_None,
+  /* ee */ X86_Len_None,
+  /* ef */ X86_Len_None,
+  /* f0 */ X86_Len_Prefix,
+  /* f1 */ X86_Len_None,
+  /* f2 */ X86_Len_Prefix,
+  /* f3 */ X86_Len_Prefix,
+  /* f4 */ X86_Len_None,
+  /* f5 */ X86_Len_None,
+  /* f6 */ X86_Len_ModRm | X86_Len_Group | (3 << X86_Len_ArgShift),
+  /* f7 */ X86_Len_ModRm | X86_Len_Group | (4 << X86_Len_ArgShift),
+  /* f8 */ X86_Len_None,
+  /* f9 */ X86_Len_None,
+  /* fa */ X86_Len_None,
+  /* fb */ X86_Len_None,
+  /* fc */ X86_Len_None,
+  /* fd */ X86_Len_None,
+  /* fe */ X86_Len_ModRm | X86_Len_Group | (5 << X86_Len_ArgShift),
+  /* ff */ X86_Len_ModRm | X86_Len_Group | (6 << X86_Len_ArgShift)
+};
+
+const u16 X86Architecture::m_Length_2[0x100] =
+{
+  /* 00 */ X86_Len_ModRm | X86_Len_Group | (7 << X86_Len_ArgShift),
+  /* 01 */ X86_Len_ModRm | X86_Len_Group | (8 << X86_Len_ArgShift),
+  /* 02 */ X86_Len_ModRm,
+  /* 03 */ X86_Len_ModRm,
+  /* 04 */ X86_Len_None,
+  /* 05 */ X86_Len_None,
+  /* 06 */ X86_Len_None,
+  /* 07 */ X86_Len_None,
+  /* 08 */ X86_Len_None,
+  /* 09 */ X86_Len_None,
+  /* 0a */ X86_Len_Invalid,
+  /* 0b */ X86_Len_None,
+  /* 0c */ X86_Len_Invalid,
+  /* 0d */ X86_Len_ModRm,
+  /* 0e */ X86_Len_None,
+  /* 0f */ X86_Len_Invalid,
+  /* 10 */ X86_Len_ModRm,
+  /* 11 */ X86_Len_ModRm,
+  /* 12 */ X86_Len_ModRm,
+  /* 13 */ X86_Len_ModRm,
+  /* 14 */ X86_Len_ModRm,
+  /* 15 */ X86_Len_ModRm,
+  /* 16 */ X86_Len_ModRm,
+  /* 17 */ X86_Len_ModRm,
+  /* 18 */ X86_Len_ModRm,
+  /* 19 */ X86_Len_ModRm,
+  /* 1a */ X86_Len_ModRm,
+  /* 1b */ X86_Len_ModRm,
+  /* 1c */ X86_Len_ModRm,
+  /* 1d */ X86_Len_ModRm,
+  /* 1e */ X86_Len_ModRm,
+  /* 1f */ X86_Len_ModRm,
+  /* 20 */ X86_Len_Fallback,
+  /* 21 */ X86_Len_Fallback,
+  /* 22 */ X86_Len_Fallback,
+  /* 23 */ X86_Len_Fallback,
+  /* 24 */ X86_Len_Invalid,
+  /* 25 */ X86_Len_Invalid,
+  /* 26 */ X86_Len_Fallback,
+  /* 27 */ X86_Len_Invalid,
+  /* 28 */ X86_Len_ModRm,
+  /* 29 */ X86_Len_ModRm,
+  /* 2a */ X86_Len_Fallback,
+  /* 2b */ X86_Len_ModRm,
+  /* 2c */ X86_Len_ModRm,
+  /* 2d */ X86_Len_ModRm,
+  /* 2e */ X86_Len_ModRm,
+  /* 2f */ X86_Len_ModRm,
+  /* 30 */ X86_Len_None,
+  /* 31 */ X86_Len_None,
+  /* 32 */ X86_Len_None,
+  /* 33 */ X86_Len_None,
+  /* 34 */ X86_Len_None,
+  /* 35 */ X86_Len_None,
+  /* 36 */ X86_Len_ModRm,
+  /* 37 */ X86_Len_Fallback,
+  /* 38 */ X86_Len_Escape | (2 << X86_Len_ArgShift),
+  /* 39 */ X86_Len_None,
+  /* 3a */ X86_Len_Escape | (3 << X86_Len_ArgShift),
+  /* 3b */ X86_Len_None,
+  /* 3c */ X86_Len_None,
+  /* 3d */ X86_Len_None,
+  /* 3e */ X86_Len_Invalid,
+  /* 3f */ X86_Len_None,
+  /* 40 */ X86_Len_ModRm,
+  /* 41 */ X86_Len_ModRm,
+  /* 42 */ X86_Len_ModRm,
+  /* 43 */ X86_Len_ModRm,
+  /* 44 */ X86_Len_ModRm,
+  /* 45 */ X86_Len_ModRm,
+  /* 46 */ X86_Len_ModRm,
+  /* 47 */ X86_Len_ModRm,
+  /* 48 */ X86_Len_ModRm,
+  /* 49 */ X86_Len_ModRm,
+  /* 4a */ X86_Len_ModRm,
+  /* 4b */ X86_Len_ModRm,
+  /* 4c */ X86_Len_ModRm,
+  /* 4d */ X86_Len_ModRm,
+  /* 4e */ X86_Len_ModRm,
+  /* 4f */ X86_Len_ModRm,
+  /* 50 */ X86_Len_Fallback,
+  /* 51 */ X86_Len_ModRm,
+  /* 52 */ X86_Len_ModRm,
+  /* 53 */ X86_Len_ModRm,
+  /* 54 */ X86_Len_ModRm,
+  /* 55 */ X86_Len_ModRm,
+  /* 56 */ X86_Len_ModRm,
+  /* 57 */ X86_Len_ModRm,
+  /* 58 */ X86_Len_ModRm,
+  /* 59 */ X86_Len_ModRm,
+  /* 5a */ X86_Len_ModRm,
+  /* 5b */ X86_Len_ModRm,
+  /* 5c */ X86_Len_ModRm,
+  /* 5d */ X86_Len_ModRm,
+  /* 5e */ X86_Len_ModRm,
+  /* 5f */ X86_Len_ModRm,
+  /* 60 */ X86_Len_ModRm,
+  /* 61 */ X86_Len_ModRm,
+  /* 62 */ X86_Len_ModRm,
+  /* 63 */ X86_Len_ModRm,
+  /* 64 */ X86_Len_ModRm,
+  /* 65 */ X86_Len_ModRm,
+  /* 66 */ X86_Len_ModRm,
+  /* 67 */ X86_Len_ModRm,
+  /* 68 */ X86_Len_ModRm,
+  /* 69 */ X86_Len_ModRm,
+  /* 6a */ X86_Len_ModRm,
+  /* 6b */ X86_Len_ModRm,
+  /* 6c */ X86_Len_ModRm,
+  /* 6d */ X86_Len_ModRm,
+  /* 6e */ X86_Len_ModRm,
+  /* 6f */ X86_Len_ModRm,
+  /* 70 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 71 */ X86_Len_Invalid,
+  /* 72 */ X86_Len_Invalid,
+  /* 73 */ X86_Len_Invalid,
+  /* 74 */ X86_Len_ModRm,
+  /* 75 */ X86_Len_ModRm,
+  /* 76 */ X86_Len_ModRm,
+  /* 77 */ X86_Len_None,
+  /* 78 */ X86_Len_Fallback,
+  /* 79 */ X86_Len_Fallback,
+  /* 7a */ X86_Len_Invalid,
+  /* 7b */ X86_Len_Invalid,
+  /* 7c */ X86_Len_ModRm,
+  /* 7d */ X86_Len_ModRm,
+  /* 7e */ X86_Len_ModRm,
+  /* 7f */ X86_Len_ModRm,
+  /* 80 */ X86_Len_Iz,
+  /* 81 */ X86_Len_Iz,
+  /* 82 */ X86_Len_Iz,
+  /* 83 */ X86_Len_Iz,
+  /* 84 */ X86_Len_Iz,
+  /* 85 */ X86_Len_Iz,
+  /* 86 */ X86_Len_Iz,
+  /* 87 */ X86_Len_Iz,
+  /* 88 */ X86_Len_Iz,
+  /* 89 */ X86_Len_Iz,
+  /* 8a */ X86_Len_Iz,
+  /* 8b */ X86_Len_Iz,
+  /* 8c */ X86_Len_Iz,
+  /* 8d */ X86_Len_Iz,
+  /* 8e */ X86_Len_Iz,
+  /* 8f */ X86_Len_Iz,
+  /* 90 */ X86_Len_ModRm,
+  /* 91 */ X86_Len_ModRm,
+  /* 92 */ X86_Len_ModRm,
+  /* 93 */ X86_Len_ModRm,
+  /* 94 */ X86_Len_ModRm,
+  /* 95 */ X86_Len_ModRm,
+  /* 96 */ X86_Len_ModRm,
+  /* 97 */ X86_Len_ModRm,
+  /* 98 */ X86_Len_ModRm,
+  /* 99 */ X86_Len_ModRm,
+  /* 9a */ X86_Len_ModRm,
+  /* 9b */ X86_Len_ModRm,
+  /* 9c */ X86_Len_ModRm,
+  /* 9d */ X86_Len_ModRm,
+  /* 9e */ X86_Len_ModRm,
+  /* 9f */ X86_Len_ModRm,
+  /* a0 */ X86_Len_None,
+  /* a1 */ X86_Len_None,
+  /* a2 */ X86_Len_None,
+  /* a3 */ X86_Len_ModRm,
+  /* a4 */ X86_Len_ModRm | X86_Len_Ib,
+  /* a5 */ X86_Len_ModRm,
+  /* a6 */ X86_Len_None,
+  /* a7 */ X86_Len_None,
+  /* a8 */ X86_Len_None,
+  /* a9 */ X86_Len_None,
+  /* aa */ X86_Len_None,
+  /* ab */ X86_Len_ModRm,
+  /* ac */ X86_Len_ModRm | X86_Len_Ib,
+  /* ad */ X86_Len_ModRm,
+  /* ae */ X86_Len_ModRm | X86_Len_Group | (9 << X86_Len_ArgShift),
+  /* af */ X86_Len_ModRm,
+  /* b0 */ X86_Len_ModRm,
+  /* b1 */ X86_Len_ModRm,
+  /* b2 */ X86_Len_ModRm,
+  /* b3 */ X86_Len_ModRm,
+  /* b4 */ X86_Len_ModRm,
+  /* b5 */ X86_Len_ModRm,
+  /* b6 */ X86_Len_ModRm,
+  /* b7 */ X86_Len_ModRm,
+  /* b8 */ X86_Len_Fallback,
+  /* b9 */ X86_Len_ModRm,
+  /* ba */ X86_Len_ModRm | X86_Len_Group | (10 << X86_Len_ArgShift),
+  /* bb */ X86_Len_ModRm,
+  /* bc */ X86_Len_ModRm,
+  /* bd */ X86_Len_ModRm,
+  /* be */ X86_Len_ModRm,
+  /* bf */ X86_Len_ModRm,
+  /* c0 */ X86_Len_ModRm,
+  /* c1 */ X86_Len_ModRm,
+  /* c2 */ X86_Len_Invalid,
+  /* c3 */ X86_Len_ModRm,
+  /* c4 */ X86_Len_ModRm | X86_Len_Ib,
+  /* c5 */ X86_Len_Fallback,
+  /* c6 */ X86_Len_ModRm | X86_Len_Ib,
+  /* c7 */ X86_Len_ModRm | X86_Len_Group | (11 << X86_Len_ArgShift),
+  /* c8 */ X86_Len_None,
+  /* c9 */ X86_Len_None,
+  /* ca */ X86_Len_None,
+  /* cb */ X86_Len_None,
+  /* cc */ X86_Len_None,
+  /* cd */ X86_Len_None,
+  /* ce */ X86_Len_None,
+  /* cf */ X86_Len_None,
+  /* d0 */ X86_Len_ModRm,
+  /* d1 */ X86_Len_ModRm,
+  /* d2 */ X86_Len_ModRm,
+  /* d3 */ X86_Len_ModRm,
+  /* d4 */ X86_Len_ModRm,
+  /* d5 */ X86_Len_ModRm,
+  /* d6 */ X86_Len_Fallback,
+  /* d7 */ X86_Len_Fallback,
+  /* d8 */ X86_Len_ModRm,
+  /* d9 */ X86_Len_ModRm,
+  /* da */ X86_Len_ModRm,
+  /* db */ X86_Len_ModRm,
+  /* dc */ X86_Len_ModRm,
+  /* dd */ X86_Len_ModRm,
+  /* de */ X86_Len_ModRm,
+  /* df */ X86_Len_ModRm,
+  /* e0 */ X86_Len_ModRm,
+  /* e1 */ X86_Len_ModRm,
+  /* e2 */ X86_Len_ModRm,
+  /* e3 */ X86_Len_ModRm,
+  /* e4 */ X86_Len_ModRm,
+  /* e5 */ X86_Len_ModRm,
+  /* e6 */ X86_Len_ModRm,
+  /* e7 */ X86_Len_ModRm,
+  /* e8 */ X86_Len_ModRm,
+  /* e9 */ X86_Len_ModRm,
+  /* ea */ X86_Len_ModRm,
+  /* eb */ X86_Len_ModRm,
+  /* ec */ X86_Len_ModRm,
+  /* ed */ X86_Len_ModRm,
+  /* ee */ X86_Len_ModRm,
+  /* ef */ X86_Len_ModRm,
+  /* f0 */ X86_Len_ModRm,
+  /* f1 */ X86_Len_ModRm,
+  /* f2 */ X86_Len_ModRm,
+  /* f3 */ X86_Len_ModRm,
+  /* f4 */ X86_Len_ModRm,
+  /* f5 */ X86_Len_ModRm,
+  /* f6 */ X86_Len_ModRm,
+  /* f7 */ X86_Len_Fallback,
+  /* f8 */ X86_Len_ModRm,
+  /* f9 */ X86_Len_ModRm,
+  /* fa */ X86_Len_ModRm,
+  /* fb */ X86_Len_ModRm,
+  /* fc */ X86_Len_ModRm,
+  /* fd */ X86_Len_ModRm,
+  /* fe */ X86_Len_ModRm,
+  /* ff */ X86_Len_None
+};
+
+const u16 X86Architecture::m_Length_3_38[0x100] =
+{
+  /* 00 */ X86_Len_ModRm,
+  /* 01 */ X86_Len_ModRm,
+  /* 02 */ X86_Len_ModRm,
+  /* 03 */ X86_Len_ModRm,
+  /* 04 */ X86_Len_ModRm,
+  /* 05 */ X86_Len_ModRm,
+  /* 06 */ X86_Len_ModRm,
+  /* 07 */ X86_Len_ModRm,
+  /* 08 */ X86_Len_ModRm,
+  /* 09 */ X86_Len_ModRm,
+  /* 0a */ X86_Len_ModRm,
+  /* 0b */ X86_Len_ModRm,
+  /* 0c */ X86_Len_ModRm,
+  /* 0d */ X86_Len_ModRm,
+  /* 0e */ X86_Len_ModRm,
+  /* 0f */ X86_Len_ModRm,
+  /* 10 */ X86_Len_ModRm,
+  /* 11 */ X86_Len_Invalid,
+  /* 12 */ X86_Len_Invalid,
+  /* 13 */ X86_Len_ModRm,
+  /* 14 */ X86_Len_ModRm,
+  /* 15 */ X86_Len_ModRm,
+  /* 16 */ X86_Len_ModRm,
+  /* 17 */ X86_Len_ModRm,
+  /* 18 */ X86_Len_Fallback,
+  /* 19 */ X86_Len_Fallback,
+  /* 1a */ X86_Len_ModRm,
+  /* 1b */ X86_Len_Invalid,
+  /* 1c */ X86_Len_ModRm,
+  /* 1d */ X86_Len_ModRm,
+  /* 1e */ X86_Len_ModRm,
+  /* 1f */ X86_Len_Invalid,
+  /* 20 */ X86_Len_ModRm,
+  /* 21 */ X86_Len_ModRm,
+  /* 22 */ X86_Len_ModRm,
+  /* 23 */ X86_Len_ModRm,
+  /* 24 */ X86_Len_ModRm,
+  /* 25 */ X86_Len_ModRm,
+  /* 26 */ X86_Len_Invalid,
+  /* 27 */ X86_Len_Invalid,
+  /* 28 */ X86_Len_ModRm,
+  /* 29 */ X86_Len_ModRm,
+  /* 2a */ X86_Len_ModRm,
+  /* 2b */ X86_Len_ModRm,
+  /* 2c */ X86_Len_ModRm,
+  /* 2d */ X86_Len_ModRm,
+  /* 2e */ X86_Len_ModRm,
+  /* 2f */ X86_Len_ModRm,
+  /* 30 */ X86_Len_ModRm,
+  /* 31 */ X86_Len_ModRm,
+  /* 32 */ X86_Len_ModRm,
+  /* 33 */ X86_Len_ModRm,
+  /* 34 */ X86_Len_ModRm,
+  /* 35 */ X86_Len_ModRm,
+  /* 36 */ X86_Len_ModRm,
+  /* 37 */ X86_Len_ModRm,
+  /* 38 */ X86_Len_ModRm,
+  /* 39 */ X86_Len_ModRm,
+  /* 3a */ X86_Len_ModRm,
+  /* 3b */ X86_Len_ModRm,
+  /* 3c */ X86_Len_ModRm,
+  /* 3d */ X86_Len_ModRm,
+  /* 3e */ X86_Len_ModRm,
+  /* 3f */ X86_Len_ModRm,
+  /* 40 */ X86_Len_ModRm,
+  /* 41 */ X86_Len_ModRm,
+  /* 42 */ X86_Len_Invalid,
+  /* 43 */ X86_Len_Invalid,
+  /* 44 */ X86_Len_Invalid,
+  /* 45 */ X86_Len_ModRm,
+  /* 46 */ X86_Len_ModRm,
+  /* 47 */ X86_Len_ModRm,
+  /* 48 */ X86_Len_Invalid,
+  /* 49 */ X86_Len_Invalid,
+  /* 4a */ X86_Len_Invalid,
+  /* 4b */ X86_Len_Invalid,
+  /* 4c */ X86_Len_Invalid,
+  /* 4d */ X86_Len_Invalid,
+  /* 4e */ X86_Len_Invalid,
+  /* 4f */ X86_Len_Invalid,
+  /* 50 */ X86_Len_Invalid,
+  /* 51 */ X86_Len_Invalid,
+  /* 52 */ X86_Len_Invalid,
+  /* 53 */ X86_Len_Invalid,
+  /* 54 */ X86_Len_Invalid,
+  /* 55 */ X86_Len_Invalid,
+  /* 56 */ X86_Len_Invalid,
+  /* 57 */ X86_Len_Invalid,
+  /* 58 */ X86_Len_ModRm,
+  /* 59 */ X86_Len_ModRm,
+  /* 5a */ X86_Len_ModRm,
+  /* 5b */ X86_Len_Invalid,
+  /* 5c */ X86_Len_Invalid,
+  /* 5d */ X86_Len_Invalid,
+  /* 5e */ X86_Len_Invalid,
+  /* 5f */ X86_Len_Invalid,
+  /* 60 */ X86_Len_Invalid,
+  /* 61 */ X86_Len_Invalid,
+  /* 62 */ X86_Len_Invalid,
+  /* 63 */ X86_Len_Invalid,
+  /* 64 */ X86_Len_Invalid,
+  /* 65 */ X86_Len_Invalid,
+  /* 66 */ X86_Len_Invalid,
+  /* 67 */ X86_Len_Invalid,
+  /* 68 */ X86_Len_Invalid,
+  /* 69 */ X86_Len_Invalid,
+  /* 6a */ X86_Len_Invalid,
+  /* 6b */ X86_Len_Invalid,
+  /* 6c */ X86_Len_Invalid,
+  /* 6d */ X86_Len_Invalid,
+  /* 6e */ X86_Len_Invalid,
+  /* 6f */ X86_Len_Invalid,
+  /* 70 */ X86_Len_Invalid,
+  /* 71 */ X86_Len_Invalid,
+  /* 72 */ X86_Len_Invalid,
+  /* 73 */ X86_Len_Invalid,
+  /* 74 */ X86_Len_Invalid,
+  /* 75 */ X86_Len_Invalid,
+  /* 76 */ X86_Len_Invalid,
+  /* 77 */ X86_Len_Invalid,
+  /* 78 */ X86_Len_ModRm,
+  /* 79 */ X86_Len_ModRm,
+  /* 7a */ X86_Len_Invalid,
+  /* 7b */ X86_Len_Invalid,
+  /* 7c */ X86_Len_Invalid,
+  /* 7d */ X86_Len_Invalid,
+  /* 7e */ X86_Len_Invalid,
+  /* 7f */ X86_Len_Invalid,
+  /* 80 */ X86_Len_ModRm,
+  /* 81 */ X86_Len_ModRm,
+  /* 82 */ X86_Len_ModRm,
+  /* 83 */ X86_Len_Invalid,
+  /* 84 */ X86_Len_Invalid,
+  /* 85 */ X86_Len_Invalid,
+  /* 86 */ X86_Len_Invalid,
+  /* 87 */ X86_Len_Invalid,
+  /* 88 */ X86_Len_Invalid,
+  /* 89 */ X86_Len_Invalid,
+  /* 8a */ X86_Len_Invalid,
+  /* 8b */ X86_Len_Invalid,
+  /* 8c */ X86_Len_ModRm,
+  /* 8d */ X86_Len_Invalid,
+  /* 8e */ X86_Len_ModRm,
+  /* 8f */ X86_Len_Invalid,
+  /* 90 */ X86_Len_ModRm,
+  /* 91 */ X86_Len_ModRm,
+  /* 92 */ X86_Len_ModRm,
+  /* 93 */ X86_Len_ModRm,
+  /* 94 */ X86_Len_Invalid,
+  /* 95 */ X86_Len_Invalid,
+  /* 96 */ X86_Len_ModRm,
+  /* 97 */ X86_Len_ModRm,
+  /* 98 */ X86_Len_ModRm,
+  /* 99 */ X86_Len_ModRm,
+  /* 9a */ X86_Len_ModRm,
+  /* 9b */ X86_Len_ModRm,
+  /* 9c */ X86_Len_ModRm,
+  /* 9d */ X86_Len_ModRm,
+  /* 9e */ X86_Len_ModRm,
+  /* 9f */ X86_Len_ModRm,
+  /* a0 */ X86_Len_Invalid,
+  /* a1 */ X86_Len_Invalid,
+  /* a2 */ X86_Len_Invalid,
+  /* a3 */ X86_Len_Invalid,
+  /* a4 */ X86_Len_Invalid,
+  /* a5 */ X86_Len_Invalid,
+  /* a6 */ X86_Len_ModRm,
+  /* a7 */ X86_Len_ModRm,
+  /* a8 */ X86_Len_ModRm,
+  /* a9 */ X86_Len_ModRm,
+  /* aa */ X86_Len_ModRm,
+  /* ab */ X86_Len_ModRm,
+  /* ac */ X86_Len_ModRm,
+  /* ad */ X86_Len_ModRm,
+  /* ae */ X86_Len_ModRm,
+  /* af */ X86_Len_ModRm,
+  /* b0 */ X86_Len_Invalid,
+  /* b1 */ X86_Len_Invalid,
+  /* b2 */ X86_Len_Invalid,
+  /* b3 */ X86_Len_Invalid,
+  /* b4 */ X86_Len_Invalid,
+  /* b5 */ X86_Len_Invalid,
+  /* b6 */ X86_Len_ModRm,
+  /* b7 */ X86_Len_ModRm,
+  /* b8 */ X86_Len_ModRm,
+  /* b9 */ X86_Len_ModRm,
+  /* ba */ X86_Len_ModRm,
+  /* bb */ X86_Len_ModRm,
+  /* bc */ X86_Len_ModRm,
+  /* bd */ X86_Len_ModRm,
+  /* be */ X86_Len_ModRm,
+  /* bf */ X86_Len_ModRm,
+  /* c0 */ X86_Len_Invalid,
+  /* c1 */ X86_Len_Invalid,
+  /* c2 */ X86_Len_Invalid,
+  /* c3 */ X86_Len_Invalid,
+  /* c4 */ X86_Len_Invalid,
+  /* c5 */ X86_Len_Invalid,
+  /* c6 */ X86_Len_Invalid,
+  /* c7 */ X86_Len_Invalid,
+  /* c8 */ X86_Len_Invalid,
+  /* c9 */ X86_Len_Invalid,
+  /* ca */ X86_Len_Invalid,
+  /* cb */ X86_Len_Invalid,
+  /* cc */ X86_Len_Invalid,
+  /* cd */ X86_Len_Invalid,
+  /* ce */ X86_Len_Invalid,
+  /* cf */ X86_Len_Invalid,
+  /* d0 */ X86_Len_Invalid,
+  /* d1 */ X86_Len_Invalid,
+  /* d2 */ X86_Len_Invalid,
+  /* d3 */ X86_Len_Invalid,
+  /* d4 */ X86_Len_Invalid,
+  /* d5 */ X86_Len_Invalid,
+  /* d6 */ X86_Len_Invalid,
+  /* d7 */ X86_Len_Invalid,
+  /* d8 */ X86_Len_Invalid,
+  /* d9 */ X86_Len_Invalid,
+  /* da */ X86_Len_Invalid,
+  /* db */ X86_Len_ModRm,
+  /* dc */ X86_Len_ModRm,
+  /* dd */ X86_Len_ModRm,
+  /* de */ X86_Len_ModRm,
+  /* df */ X86_Len_ModRm,
+  /* e0 */ X86_Len_Invalid,
+  /* e1 */ X86_Len_Invalid,
+  /* e2 */ X86_Len_Invalid,
+  /* e3 */ X86_Len_Invalid,
+  /* e4 */ X86_Len_Invalid,
+  /* e5 */ X86_Len_Invalid,
+  /* e6 */ X86_Len_Invalid,
+  /* e7 */ X86_Len_Invalid,
+  /* e8 */ X86_Len_Invalid,
+  /* e9 */ X86_Len_Invalid,
+  /* ea */ X86_Len_Invalid,
+  /* eb */ X86_Len_Invalid,
+  /* ec */ X86_Len_Invalid,
+  /* ed */ X86_Len_Invalid,
+  /* ee */ X86_Len_Invalid,
+  /* ef */ X86_Len_Invalid,
+  /* f0 */ X86_Len_ModRm,
+  /* f1 */ X86_Len_ModRm,
+  /* f2 */ X86_Len_ModRm,
+  /* f3 */ X86_Len_ModRm | X86_Len_Group | (12 << X86_Len_ArgShift),
+  /* f4 */ X86_Len_Invalid,
+  /* f5 */ X86_Len_ModRm,
+  /* f6 */ X86_Len_ModRm,
+  /* f7 */ X86_Len_ModRm,
+  /* f8 */ X86_Len_Invalid,
+  /* f9 */ X86_Len_Invalid,
+  /* fa */ X86_Len_Invalid,
+  /* fb */ X86_Len_Invalid,
+  /* fc */ X86_Len_Invalid,
+  /* fd */ X86_Len_Invalid,
+  /* fe */ X86_Len_Invalid,
+  /* ff */ X86_Len_Invalid
+};
+
+const u16 X86Architecture::m_Length_3_3a[0x100] =
+{
+  /* 00 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 01 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 02 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 03 */ X86_Len_Invalid,
+  /* 04 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 05 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 06 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 07 */ X86_Len_Invalid,
+  /* 08 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 09 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 0a */ X86_Len_ModRm | X86_Len_Ib,
+  /* 0b */ X86_Len_ModRm | X86_Len_Ib,
+  /* 0c */ X86_Len_ModRm | X86_Len_Ib,
+  /* 0d */ X86_Len_ModRm | X86_Len_Ib,
+  /* 0e */ X86_Len_ModRm | X86_Len_Ib,
+  /* 0f */ X86_Len_ModRm | X86_Len_Ib,
+  /* 10 */ X86_Len_Invalid,
+  /* 11 */ X86_Len_Invalid,
+  /* 12 */ X86_Len_Invalid,
+  /* 13 */ X86_Len_Invalid,
+  /* 14 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 15 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 16 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 17 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 18 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 19 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 1a */ X86_Len_Invalid,
+  /* 1b */ X86_Len_Invalid,
+  /* 1c */ X86_Len_Invalid,
+  /* 1d */ X86_Len_ModRm | X86_Len_Ib,
+  /* 1e */ X86_Len_Invalid,
+  /* 1f */ X86_Len_Invalid,
+  /* 20 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 21 */ X86_Len_Fallback,
+  /* 22 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 23 */ X86_Len_Invalid,
+  /* 24 */ X86_Len_Invalid,
+  /* 25 */ X86_Len_Invalid,
+  /* 26 */ X86_Len_Invalid,
+  /* 27 */ X86_Len_Invalid,
+  /* 28 */ X86_Len_Invalid,
+  /* 29 */ X86_Len_Invalid,
+  /* 2a */ X86_Len_Invalid,
+  /* 2b */ X86_Len_Invalid,
+  /* 2c */ X86_Len_Invalid,
+  /* 2d */ X86_Len_Invalid,
+  /* 2e */ X86_Len_Invalid,
+  /* 2f */ X86_Len_Invalid,
+  /* 30 */ X86_Len_Invalid,
+  /* 31 */ X86_Len_Invalid,
+  /* 32 */ X86_Len_Invalid,
+  /* 33 */ X86_Len_Invalid,
+  /* 34 */ X86_Len_Invalid,
+  /* 35 */ X86_Len_Invalid,
+  /* 36 */ X86_Len_Invalid,
+  /* 37 */ X86_Len_Invalid,
+  /* 38 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 39 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 3a */ X86_Len_Invalid,
+  /* 3b */ X86_Len_Invalid,
+  /* 3c */ X86_Len_Invalid,
+  /* 3d */ X86_Len_Invalid,
+  /* 3e */ X86_Len_Invalid,
+  /* 3f */ X86_Len_Invalid,
+  /* 40 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 41 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 42 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 43 */ X86_Len_Invalid,
+  /* 44 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 45 */ X86_Len_Invalid,
+  /* 46 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 47 */ X86_Len_Invalid,
+  /* 48 */ X86_Len_Invalid,
+  /* 49 */ X86_Len_Invalid,
+  /* 4a */ X86_Len_ModRm | X86_Len_Ib,
+  /* 4b */ X86_Len_ModRm | X86_Len_Ib,
+  /* 4c */ X86_Len_ModRm | X86_Len_Ib,
+  /* 4d */ X86_Len_Invalid,
+  /* 4e */ X86_Len_Invalid,
+  /* 4f */ X86_Len_Invalid,
+  /* 50 */ X86_Len_Invalid,
+  /* 51 */ X86_Len_Invalid,
+  /* 52 */ X86_Len_Invalid,
+  /* 53 */ X86_Len_Invalid,
+  /* 54 */ X86_Len_Invalid,
+  /* 55 */ X86_Len_Invalid,
+  /* 56 */ X86_Len_Invalid,
+  /* 57 */ X86_Len_Invalid,
+  /* 58 */ X86_Len_Invalid,
+  /* 59 */ X86_Len_Invalid,
+  /* 5a */ X86_Len_Invalid,
+  /* 5b */ X86_Len_Invalid,
+  /* 5c */ X86_Len_Invalid,
+  /* 5d */ X86_Len_Invalid,
+  /* 5e */ X86_Len_Invalid,
+  /* 5f */ X86_Len_Invalid,
+  /* 60 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 61 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 62 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 63 */ X86_Len_ModRm | X86_Len_Ib,
+  /* 64 */ X86_Len_Invalid,
+  /* 65 */ X86_Len_Invalid,
+  /* 66 */ X86_Len_Invalid,
+  /* 67 */ X86_Len_Invalid,
+  /* 68 */ X86_Len_Invalid,
+  /* 69 */ X86_Len_Invalid,
+  /* 6a */ X86_Len_Invalid,
+  /* 6b */ X86_Len_Invalid,
+  /* 6c */ X86_Len_Invalid,
+  /* 6d */ X86_Len_Invalid,
+  /* 6e */ X86_Len_Invalid,
+  /* 6f */ X86_Len_Invalid,
+  /* 70 */ X86_Len_Invalid,
+  /* 71 */ X86_Len_Invalid,
+  /* 72 */ X86_Len_Invalid,
+  /* 73 */ X86_Len_Invalid,
+  /* 74 */ X86_Len_Invalid,
+  /* 75 */ X86_Len_Invalid,
+  /* 76 */ X86_Len_Invalid,
+  /* 77 */ X86_Len_Invalid,
+  /* 78 */ X86_Len_Invalid,
+  /* 79 */ X86_Len_Invalid,
+  /* 7a */ X86_Len_Invalid,
+  /* 7b */ X86_Len_Invalid,
+  /* 7c */ X86_Len_Invalid,
+  /* 7d */ X86_Len_Invalid,
+  /* 7e */ X86_Len_Invalid,
+  /* 7f */ X86_Len_Invalid,
+  /* 80 */ X86_Len_Invalid,
+  /* 81 */ X86_Len_Invalid,
+  /* 82 */ X86_Len_Invalid,
+  /* 83 */ X86_Len_Invalid,
+  /* 84 */ X86_Len_Invalid,
+  /* 85 */ X86_Len_Invalid,
+  /* 86 */ X86_Len_Invalid,
+  /* 87 */ X86_Len_Invalid,
+  /* 88 */ X86_Len_Invalid,
+  /* 89 */ X86_Len_Invalid,
+  /* 8a */ X86_Len_Invalid,
+  /* 8b */ X86_Len_Invalid,
+  /* 8c */ X86_Len_Invalid,
+  /* 8d */ X86_Len_Invalid,
+  /* 8e */ X86_Len_Invalid,
+  /* 8f */ X86_Len_Invalid,
+  /* 90 */ X86_Len_Invalid,
+  /* 91 */ X86_Len_Invalid,
+  /* 92 */ X86_Len_Invalid,
+  /* 93 */ X86_Len_Invalid,
+  /* 94 */ X86_Len_Invalid,
+  /* 95 */ X86_Len_Invalid,
+  /* 96 */ X86_Len_Invalid,
+  /* 97 */ X86_Len_Invalid,
+  /* 98 */ X86_Len_Invalid,
+  /* 99 */ X86_Len_Invalid,
+  /* 9a */ X86_Len_Invalid,
+  /* 9b */ X86_Len_Invalid,
+  /* 9c */ X86_Len_Invalid,
+  /* 9d */ X86_Len_Invalid,
+  /* 9e */ X86_Len_Invalid,
+  /* 9f */ X86_Len_Invalid,
+  /* a0 */ X86_Len_Invalid,
+  /* a1 */ X86_Len_Invalid,
+  /* a2 */ X86_Len_Invalid,
+  /* a3 */ X86_Len_Invalid,
+  /* a4 */ X86_Len_Invalid,
+  /* a5 */ X86_Len_Invalid,
+  /* a6 */ X86_Len_Invalid,
+  /* a7 */ X86_Len_Invalid,
+  /* a8 */ X86_Len_Invalid,
+  /* a9 */ X86_Len_Invalid,
+  /* aa */ X86_Len_Invalid,
+  /* ab */ X86_Len_Invalid,
+  /* ac */ X86_Len_Invalid,
+  /* ad */ X86_Len_Invalid,
+  /* ae */ X86_Len_Invalid,
+  /* af */ X86_Len_Invalid,
+  /* b0 */ X86_Len_Invalid,
+  /* b1 */ X86_Len_Invalid,
+  /* b2 */ X86_Len_Invalid,
+  /* b3 */ X86_Len_Invalid,
+  /* b4 */ X86_Len_Invalid,
+  /* b5 */ X86_Len_Invalid,
+  /* b6 */ X86_Len_Invalid,
+  /* b7 */ X86_Len_Invalid,
+  /* b8 */ X86_Len_Invalid,
+  /* b9 */ X86_Len_Invalid,
+  /* ba */ X86_Len_Invalid,
+  /* bb */ X86_Len_Invalid,
+  /* bc */ X86_Len_Invalid,
+  /* bd */ X86_Len_Invalid,
+  /* be */ X86_Len_Invalid,
+  /* bf */ X86_Len_Invalid,
+  /* c0 */ X86_Len_Invalid,
+  /* c1 */ X86_Len_Invalid,
+  /* c2 */ X86_Len_Invalid,
+  /* c3 */ X86_Len_Invalid,
+  /* c4 */ X86_Len_Invalid,
+  /* c5 */ X86_Len_Invalid,
+  /* c6 */ X86_Len_Invalid,
+  /* c7 */ X86_Len_Invalid,
+  /* c8 */ X86_Len_Invalid,
+  /* c9 */ X86_Len_Invalid,
+  /* ca */ X86_Len_Invalid,
+  /* cb */ X86_Len_Invalid,
+  /* cc */ X86_Len_Invalid,
+  /* cd */ X86_Len_Invalid,
+  /* ce */ X86_Len_Invalid,
+  /* cf */ X86_Len_Invalid,
+  /* d0 */ X86_Len_Invalid,
+  /* d1 */ X86_Len_Invalid,
+  /* d2 */ X86_Len_Invalid,
+  /* d3 */ X86_Len_Invalid,
+  /* d4 */ X86_Len_Invalid,
+  /* d5 */ X86_Len_Invalid,
+  /* d6 */ X86_Len_Invalid,
+  /* d7 */ X86_Len_Invalid,
+  /* d8 */ X86_Len_Invalid,
+  /* d9 */ X86_Len_Invalid,
+  /* da */ X86_Len_Invalid,
+  /* db */ X86_Len_Invalid,
+  /* dc */ X86_Len_Invalid,
+  /* dd */ X86_Len_Invalid,
+  /* de */ X86_Len_Invalid,
+  /* df */ X86_Len_ModRm | X86_Len_Ib,
+  /* e0 */ X86_Len_Invalid,
+  /* e1 */ X86_Len_Invalid,
+  /* e2 */ X86_Len_Invalid,
+  /* e3 */ X86_Len_Invalid,
+  /* e4 */ X86_Len_Invalid,
+  /* e5 */ X86_Len_Invalid,
+  /* e6 */ X86_Len_Invalid,
+  /* e7 */ X86_Len_Invalid,
+  /* e8 */ X86_Len_Invalid,
+  /* e9 */ X86_Len_Invalid,
+  /* ea */ X86_Len_Invalid,
+  /* eb */ X86_Len_Invalid,
+  /* ec */ X86_Len_Invalid,
+  /* ed */ X86_Len_Invalid,
+  /* ee */ X86_Len_Invalid,
+  /* ef */ X86_Len_Invalid,
+  /* f0 */ X86_Len_ModRm | X86_Len_Ib,
+  /* f1 */ X86_Len_Invalid,
+  /* f2 */ X86_Len_Invalid,
+  /* f3 */ X86_Len_Invalid,
+  /* f4 */ X86_Len_Invalid,
+  /* f5 */ X86_Len_Invalid,
+  /* f6 */ X86_Len_Invalid,
+  /* f7 */ X86_Len_Invalid,
+  /* f8 */ X86_Len_Invalid,
+  /* f9 */ X86_Len_Invalid,
+  /* fa */ X86_Len_Invalid,
+  /* fb */ X86_Len_Invalid,
+  /* fc */ X86_Len_Invalid,
+  /* fd */ X86_Len_Invalid,
+  /* fe */ X86_Len_Invalid,
+  /* ff */ X86_Len_Invalid
+};
+
+const u16* const X86Architecture::m_LengthMap[0x4] =
+{
+  m_Length_1,
+  m_Length_2,
+  m_Length_3_38,
+  m_Length_3_3a
+};
+
+const u16 X86Architecture::m_LengthGroup[0xd][0x8] =
+{
+  {
+    X86_Len_ModRm,
+    X86_Len_Fallback,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid
+  },
+  {
+    X86_Len_ModRm | X86_Len_Ib,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid
+  },
+  {
+    X86_Len_ModRm | X86_Len_Iz,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid
+  },
+  {
+    X86_Len_ModRm | X86_Len_Ib,
+    X86_Len_ModRm | X86_Len_Ib,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm
+  },
+  {
+    X86_Len_ModRm | X86_Len_Iz,
+    X86_Len_ModRm | X86_Len_Iz,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm
+  },
+  {
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid
+  },
+  {
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_Invalid
+  },
+  {
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_ModRm,
+    X86_Len_Invalid
+  },
+  {
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_Invalid,
+    X86_Len_Fallback,
+    X86_Len_Fallback
+  },
+  {
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_ModRm,
+    X86_Len_Fallback,
+    X86_Len_Fallback,
+    X86_Len_Fallback
+  },
+  {
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_ModRm | X86_Len_Ib,
+    X86_Len_ModRm | X86_Len_Ib,
+    X86_Len_ModRm | X86_Len_Ib,
+    X86_Len_ModRm | X86_Len_Ib
+  },
+  {
+    X86_Len_Invalid,
+    X86_Len_ModRm,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Fallback,
+    X86_Len_ModRm
+  },
+  {
+    X86_Len_Invalid,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_ModRm,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid,
+    X86_Len_Invalid
+  }
+};
+
 bool X86Architecture::Operand__Ev_Iz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)
 {
   size_t PrefixOpcodeLength = rInsn.GetLength();
@@ -1,4 +1,4 @@
-/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Feb 23 20:08:51 2014) */
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Mon Oct 19 01:30:23 2026) */
 enum X86Opcode
 {
   X86_Opcode_Unknown,
@@ -2961,6 +2961,121 @@ private:
   bool Table_sse5a_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
   bool Table_sse5a_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
 
+  typedef bool (X86Architecture:: *TSemantic)(Instruction&);
+  static const TSemantic m_Semantic[0x6a];
+  bool Semantic_0001(Instruction& rInsn);
+  bool Semantic_0002(Instruction& rInsn);
+  bool Semantic_0003(Instruction& rInsn);
+  bool Semantic_0004(Instruction& rInsn);
+  bool Semantic_0005(Instruction& rInsn);
+  bool Semantic_0006(Instruction& rInsn);
+  bool Semantic_0007(Instruction& rInsn);
+  bool Semantic_0008(Instruction& rInsn);
+  bool Semantic_0009(Instruction& rInsn);
+  bool Semantic_000a(Instruction& rInsn);
+  bool Semantic_000b(Instruction& rInsn);
+  bool Semantic_000c(Instruction& rInsn);
+  bool Semantic_000d(Instruction& rInsn);
+  bool Semantic_000e(Instruction& rInsn);
+  bool Semantic_000f(Instruction& rInsn);
+  bool Semantic_0010(Instruction& rInsn);
+  bool Semantic_0011(Instruction& rInsn);
+  bool Semantic_0012(Instruction& rInsn);
+  bool Semantic_0013(Instruction& rInsn);
+  bool Semantic_0014(Instruction& rInsn);
+  bool Semantic_0015(Instruction& rInsn);
+  bool Semantic_0016(Instruction& rInsn);
+  bool Semantic_0017(Instruction& rInsn);
+  bool Semantic_0018(Instruction& rInsn);
+  bool Semantic_0019(Instruction& rInsn);
+  bool Semantic_001a(Instruction& rInsn);
+  bool Semantic_001b(Instruction& rInsn);
+  bool Semantic_001c(Instruction& rInsn);
+  bool Semantic_001d(Instruction& rInsn);
+  bool Semantic_001e(Instruction& rInsn);
+  bool Semantic_001f(Instruction& rInsn);
+  bool Semantic_0020(Instruction& rInsn);
+  bool Semantic_0021(Instruction& rInsn);
+  bool Semantic_0022(Instruction& rInsn);
+  bool Semantic_0023(Instruction& rInsn);
+  bool Semantic_0024(Instruction& rInsn);
+  bool Semantic_0025(Instruction& rInsn);
+  bool Semantic_0026(Instruction& rInsn);
+  bool Semantic_0027(Instruction& rInsn);
+  bool Semantic_0028(Instruction& rInsn);
+  bool Semantic_0029(Instruction& rInsn);
+  bool Semantic_002a(Instruction& rInsn);
+  bool Semantic_002b(Instruction& rInsn);
+  bool Semantic_002c(Instruction& rInsn);
+  bool Semantic_002d(Instruction& rInsn);
+  bool Semantic_002e(Instruction& rInsn);
+  bool Semantic_002f(Instruction& rInsn);
+  bool Semantic_0030(Instruction& rInsn);
+  bool Semantic_0031(Instruction& rInsn);
+  bool Semantic_0032(Instruction& rInsn);
+  bool Semantic_0033(Instruction& rInsn);
+  bool Semantic_0034(Instruction& rInsn);
+  bool Semantic_0035(Instruction& rInsn);
+  bool Semantic_0036(Instruction& rInsn);
+  bool Semantic_0037(Instruction& rInsn);
+  bool Semantic_0038(Instruction& rInsn);
+  bool Semantic_0039(Instruction& rInsn);
+  bool Semantic_003a(Instruction& rInsn);
+  bool Semantic_003b(Instruction& rInsn);
+  bool Semantic_003c(Instruction& rInsn);
+  bool Semantic_003d(Instruction& rInsn);
+  bool Semantic_003e(Instruction& rInsn);
+  bool Semantic_003f(Instruction& rInsn);
+  bool Semantic_0040(Instruction& rInsn);
+  bool Semantic_0041(Instruction& rInsn);
+  bool Semantic_0042(Instruction& rInsn);
+  bool Semantic_0043(Instruction& rInsn);
+  bool Semantic_0044(Instruction& rInsn);
+  bool Semantic_0045(Instruction& rInsn);
+  bool Semantic_0046(Instruction& rInsn);
+  bool Semantic_0047(Instruction& rInsn);
+  bool Semantic_0048(Instruction& rInsn);
+  bool Semantic_0049(Instruction& rInsn);
+  bool Semantic_004a(Instruction& rInsn);
+  bool Semantic_004b(Instruction& rInsn);
+  bool Semantic_004c(Instruction& rInsn);
+  bool Semantic_004d(Instruction& rInsn);
+  bool Semantic_004e(Instruction& rInsn);
+  bool Semantic_004f(Instruction& rInsn);
+  bool Semantic_0050(Instruction& rInsn);
+  bool Semantic_0051(Instruction& rInsn);
+  bool Semantic_0052(Instruction& rInsn);
+  bool Semantic_0053(Instruction& rInsn);
+  bool Semantic_0054(Instruction& rInsn);
+  bool Semantic_0055(Instruction& rInsn);
+  bool Semantic_0056(Instruction& rInsn);
+  bool Semantic_0057(Instruction& rInsn);
+  bool Semantic_0058(Instruction& rInsn);
+  bool Semantic_0059(Instruction& rInsn);
+  bool Semantic_005a(Instruction& rInsn);
+  bool Semantic_005b(Instruction& rInsn);
+  bool Semantic_005c(Instruction& rInsn);
+  bool Semantic_005d(Instruction& rInsn);
+  bool Semantic_005e(Instruction& rInsn);
+  bool Semantic_005f(Instruction& rInsn);
+  bool Semantic_0060(Instruction& rInsn);
+  bool Semantic_0061(Instruction& rInsn);
+  bool Semantic_0062(Instruction& rInsn);
+  bool Semantic_0063(Instruction& rInsn);
+  bool Semantic_0064(Instruction& rInsn);
+  bool Semantic_0065(Instruction& rInsn);
+  bool Semantic_0066(Instruction& rInsn);
+  bool Semantic_0067(Instruction& rInsn);
+  bool Semantic_0068(Instruction& rInsn);
+  bool Semantic_0069(Instruction& rInsn);
+
+  static const u16 m_Length_1[0x100];
+  static const u16 m_Length_2[0x100];
+  static const u16 m_Length_3_38[0x100];
+  static const u16 m_Length_3_3a[0x100];
+  static const u16* const m_LengthMap[0x4];
+  static const u16 m_LengthGroup[0xd][0x8];
+
   bool Operand__Ev_Iz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
   bool Operand__rBX_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
   bool Operand__Rv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
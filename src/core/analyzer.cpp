@@ -6,6 +6,7 @@
 #include "medusa/label.hpp"
 #include "medusa/log.hpp"
 #include "medusa/module.hpp"
+#include "medusa/decoded_instruction.hpp"
 
 #include <list>
 #include <stack>
@@ -194,6 +195,11 @@ bool Analyzer::DisassembleTask::DisassembleBasicBlock(Address const& rAddr, std:
   Address CurAddr = rAddr;
   MemoryArea const* pMemArea = m_rDoc.GetMemoryArea(CurAddr);
 
+  // Instructions are decoded by batch, then converted one by one while the basic block goes on
+  DecodedInstruction DecInsns[SweepInstructionNumber];
+  size_t DecInsnNo  = 0;
+  size_t DecInsnIdx = 0;
+
   try
   {
     auto Lbl = m_rDoc.GetLabelFromAddress(CurAddr);
@@ -220,17 +226,27 @@ bool Analyzer::DisassembleTask::DisassembleBasicBlock(Address const& rAddr, std:
       if (!m_rDoc.ContainsUnknown(CurAddr))
         throw std::string("Cell at \"") + CurAddr.ToString() + std::string("\" is not unknown");
 
-      // We create a new entry and disassemble it
-      auto spInsn = std::make_shared<Instruction>();
+      // When the batch is consumed, we decode the following instructions up to the end of the memory area
+      // The semantic is not needed to build the basic block, so instructions are only decoded
+      if (DecInsnIdx == DecInsnNo)
+      {
+        TOffset PhysicalOffset;
 
-      TOffset PhysicalOffset;
+        if (pMemArea->ConvertOffsetToFileOffset(CurAddr.GetOffset(), PhysicalOffset) == false)
+          throw std::string("Unable to convert address ") + CurAddr.ToString() + std::string(" to offset");
 
-      if (pMemArea->ConvertOffsetToFileOffset(CurAddr.GetOffset(), PhysicalOffset) == false)
-        throw std::string("Unable to convert address ") + CurAddr.ToString() + std::string(" to offset");
+        u32 AreaSize = static_cast<u32>(pMemArea->GetFileOffset() + pMemArea->GetFileSize() - PhysicalOffset);
 
-      // If something bad happens, we skip this instruction and go to the next function
-      if (!m_rArch.Disassemble(m_rDoc.GetBinaryStream(), PhysicalOffset, *spInsn, m_Mode))
-        throw std::string("Unable to disassemble instruction at ") + CurAddr.ToString();
+        // If something bad happens, we skip this instruction and go to the next function
+        DecInsnIdx = 0;
+        DecInsnNo  = m_rArch.DisassembleRange(m_rDoc.GetBinaryStream(), PhysicalOffset, AreaSize, m_Mode, DecInsns, SweepInstructionNumber);
+        if (DecInsnNo == 0)
+          throw std::string("Unable to disassemble instruction at ") + CurAddr.ToString();
+      }
+
+      // We create a new entry from the decoded instruction
+      auto spInsn = std::make_shared<Instruction>();
+      DecInsns[DecInsnIdx++].ToInstruction(*spInsn);
 
       spInsn->GetData()->Mode() = m_Mode;
 
@@ -889,6 +905,14 @@ bool Analyzer::FormatCell(Document const& rDoc, BinaryStream const& rBinStrm, Ad
   return spArch->FormatCell(rDoc, rBinStrm, rAddress, rCell, rStrCell, rMarks);
 }
 
+bool Analyzer::FormatCell(Document const& rDoc, BinaryStream const& rBinStrm, Address const& rAddress, Cell const& rCell, FormatBuffer& rBuf) const
+{
+  auto spArch = ModuleManager::Instance().GetArchitecture(rCell.GetArchitectureTag());
+  if (spArch == nullptr)
+    return false;
+  return spArch->FormatCell(rDoc, rBinStrm, rAddress, rCell, rBuf);
+}
+
 bool Analyzer::FormatMultiCell(Document const& rDoc,BinaryStream const& rBinStrm,Address const& rAddress,MultiCell const& rMultiCell,std::string & rStrMultiCell,Cell::Mark::List & rMarks) const
 {
   auto spCell = rDoc.GetCell(rAddress);
@@ -2,6 +2,39 @@
 
 MEDUSA_NAMESPACE_BEGIN
 
+size_t Architecture::DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, DecodedInstruction* pInsns, size_t InsnNo)
+{
+  TOffset EndOffset = Offset + Size;
+  if (EndOffset > rBinStrm.GetSize())
+    EndOffset = rBinStrm.GetSize();
+
+  Instruction Insn;
+  size_t DecodedNo = 0;
+
+  while (DecodedNo < InsnNo && Offset < EndOffset)
+  {
+    Insn.Reset();
+    if (!Disassemble(rBinStrm, Offset, Insn, Mode, DisasmDecodeOnly))
+      break;
+    if (Insn.GetLength() == 0 || Offset + Insn.GetLength() > EndOffset)
+      break;
+
+    pInsns[DecodedNo++].Load(Offset, Insn, Mode);
+    Offset += Insn.GetLength();
+  }
+
+  return DecodedNo;
+}
+
+bool Architecture::GetInstructionLength(BinaryStream const& rBinStrm, TOffset Offset, u8 Mode, u16& rLength)
+{
+  Instruction Insn;
+  if (!Disassemble(rBinStrm, Offset, Insn, Mode, DisasmDecodeOnly))
+    return false;
+  rLength = static_cast<u16>(Insn.GetLength());
+  return rLength != 0;
+}
+
   bool Architecture::FormatCell(
   Document      const& rDoc,
   BinaryStream  const& rBinStrm,
@@ -20,6 +53,42 @@ MEDUSA_NAMESPACE_BEGIN
   }
 }
 
+bool Architecture::FormatCell(
+  Document      const& rDoc,
+  BinaryStream  const& rBinStrm,
+  Address       const& rAddr,
+  Cell          const& rCell,
+  FormatBuffer       & rBuf) const
+{
+  if (rCell.GetType() == Cell::InstructionType)
+  {
+    rBuf.Reset();
+    return FormatInstruction(rDoc, rBinStrm, rAddr, static_cast<Instruction const&>(rCell), rBuf);
+  }
+
+  std::string StrCell;
+  Cell::Mark::List Marks;
+  if (!FormatCell(rDoc, rBinStrm, rAddr, rCell, StrCell, Marks))
+    return false;
+  rBuf.Assign(StrCell, Marks);
+  return true;
+}
+
+bool Architecture::FormatInstruction(
+  Document      const& rDoc,
+  BinaryStream  const& rBinStrm,
+  Address       const& rAddr,
+  Instruction   const& rInsn,
+  FormatBuffer       & rBuf) const
+{
+  std::string StrCell;
+  Cell::Mark::List Marks;
+  if (!FormatInstruction(rDoc, rBinStrm, rAddr, rInsn, StrCell, Marks))
+    return false;
+  rBuf.Assign(StrCell, Marks);
+  return true;
+}
+
 bool Architecture::FormatInstruction(
   Document      const& rDoc,
   BinaryStream  const& rBinStrm,
@@ -3,6 +3,33 @@
 
 MEDUSA_NAMESPACE_BEGIN
 
+bool CpuContext::GetRegisterStorage(u32 Register, u16& rOffset, u8& rReadSize, u8& rWriteSize)
+{
+  return false;
+}
+
+bool CpuContext::TakeSnapshot(void)
+{
+  u32 CtxtSize = GetContextSize();
+  if (CtxtSize == 0)
+    return false;
+
+  auto pCtxt = static_cast<u8 const*>(GetContextAddress());
+  m_Snapshot.assign(pCtxt, pCtxt + CtxtSize);
+  m_SnapshotAddressMap = m_AddressMap;
+  return true;
+}
+
+bool CpuContext::RestoreSnapshot(void)
+{
+  if (m_Snapshot.empty() || m_Snapshot.size() != GetContextSize())
+    return false;
+
+  memcpy(GetContextAddress(), m_Snapshot.data(), m_Snapshot.size());
+  m_AddressMap = m_SnapshotAddressMap;
+  return true;
+}
+
 bool CpuContext::Translate(Address const& rLogicalAddress, u64& rLinearAddress) const
 {
   auto itAddr = m_AddressMap.find(Address(rLogicalAddress.GetBase(), 0x0));
@@ -32,6 +59,31 @@ bool CpuContext::RemoveMapping(Address const& rLogicalAddress)
   return true;
 }
 
+void RegisterLayout::Resolve(u32 Register)
+{
+  if (Register >= m_Entries.size())
+    m_Entries.resize(Register + 1);
+  if (m_pCtxt == nullptr)
+    m_pCtxt = static_cast<u8*>(m_pCpuCtxt->GetContextAddress());
+
+  auto& rEntry = m_Entries[Register];
+  rEntry.m_Resolved = true;
+
+  u32 RegSize = m_pCpuCtxt->GetCpuInformation().GetSizeOfRegisterInBit(Register);
+  rEntry.m_Mask = RegSize >= 64 ? ~0ULL : ((1ULL << RegSize) - 1);
+
+  u16 Offset;
+  u8 ReadSize, WriteSize;
+  if (m_pCtxt == nullptr || RegSize < 8 || m_pCpuCtxt->GetRegisterStorage(Register, Offset, ReadSize, WriteSize) == false)
+    return;
+  if ((ReadSize != 1 && ReadSize != 2 && ReadSize != 4 && ReadSize != 8) || (WriteSize != 1 && WriteSize != 2 && WriteSize != 4 && WriteSize != 8))
+    return;
+
+  rEntry.m_Offset    = Offset;
+  rEntry.m_ReadSize  = ReadSize;
+  rEntry.m_WriteSize = WriteSize;
+}
+
 bool MemoryContext::ReadMemory(u64 LinearAddress, void* pValue, u32 ValueSize) const
 {
   MemoryChunk MemChnk;
@@ -57,9 +109,56 @@ bool MemoryContext::WriteMemory(u64 LinearAddress, void const* pValue, u32 Value
   // LATER: Check boundary!
   auto Offset = LinearAddress - MemChnk.m_LinearAddress;
   memcpy(reinterpret_cast<u8 *>(MemChnk.m_Buffer) + Offset, pValue, ValueSize);
+
+  if (!m_CodePages.empty())
+    NotifyCodeWrite(LinearAddress, ValueSize);
+  if (m_WriteCallback)
+    m_WriteCallback(LinearAddress, pValue, ValueSize);
   return true;
 }
 
+void MemoryContext::MarkCodePages(u64 LinearAddress, u32 Size)
+{
+  if (Size == 0)
+    Size = 1;
+  u64 CurPage  = LinearAddress & ~static_cast<u64>(CodePageSize - 1);
+  u64 LastPage = (LinearAddress + Size - 1) & ~static_cast<u64>(CodePageSize - 1);
+  while (true)
+  {
+    m_CodePages.insert(CurPage);
+    if (CurPage == LastPage)
+      break;
+    CurPage += CodePageSize;
+  }
+}
+
+void MemoryContext::NotifyCodeWrite(u64 LinearAddress, u32 Size)
+{
+  if (Size == 0)
+    return;
+  u64 CurPage  = LinearAddress & ~static_cast<u64>(CodePageSize - 1);
+  u64 LastPage = (LinearAddress + Size - 1) & ~static_cast<u64>(CodePageSize - 1);
+  while (true)
+  {
+    if (m_CodePages.erase(CurPage) != 0 && m_CodeWriteCallback)
+      m_CodeWriteCallback(CurPage);
+    if (CurPage == LastPage)
+      break;
+    CurPage += CodePageSize;
+  }
+}
+
+MemoryContext::~MemoryContext(void)
+{
+  for (auto itMemChunk = std::begin(m_Memories); itMemChunk != std::end(m_Memories); ++itMemChunk)
+  {
+    if (itMemChunk->m_Mapped)
+      BinaryStream::UnmapPrivateMemory(itMemChunk->m_Buffer, itMemChunk->m_Size);
+    else
+      delete [] static_cast<u8*>(itMemChunk->m_Buffer);
+  }
+}
+
 bool MemoryContext::FindMemory(u64 LinearAddress, void*& prAddress, u32& rSize) const
 {
   MemoryChunk MemChk;
@@ -70,8 +169,9 @@ bool MemoryContext::FindMemory(u64 LinearAddress, void*& prAddress, u32& rSize)
   if (FindMemoryChunk(LinearAddress, MemChk) == false)
     return false;
 
-  prAddress = MemChk.m_Buffer;
-  rSize = MemChk.m_Size;
+  auto Offset = LinearAddress - MemChk.m_LinearAddress;
+  prAddress = reinterpret_cast<u8*>(MemChk.m_Buffer) + Offset;
+  rSize = MemChk.m_Size - static_cast<u32>(Offset);
   return true;
 }
 
@@ -94,11 +194,27 @@ bool MemoryContext::FreeMemory(u64 Address)
   auto itMemChunk = m_Memories.find(MemoryChunk(Address));
   if (itMemChunk == std::end(m_Memories))
     return false;
-  delete [] static_cast<u8*>(itMemChunk->m_Buffer);
+  if (itMemChunk->m_Mapped)
+    BinaryStream::UnmapPrivateMemory(itMemChunk->m_Buffer, itMemChunk->m_Size);
+  else
+    delete [] static_cast<u8*>(itMemChunk->m_Buffer);
   m_Memories.erase(itMemChunk);
   return true;
 }
 
+bool MemoryContext::MapMemory(u64 LinearAddress, u32 Size, BinaryStream const& rBinStrm, TOffset Position, u32 Length, void** ppRawMemory)
+{
+  if (ppRawMemory)
+    *ppRawMemory = nullptr;
+  void* pRawMemory = rBinStrm.MapPrivateMemory(Position, Length, Size);
+  if (pRawMemory == nullptr)
+    return false;
+  m_Memories.insert(MemoryChunk(LinearAddress, Size, pRawMemory, true));
+  if (ppRawMemory)
+    *ppRawMemory = pRawMemory;
+  return true;
+}
+
 bool MemoryContext::MapDocument(Document const& rDoc, CpuContext const* pCpuCtxt)
 {
   bool Res = true;
@@ -108,26 +224,33 @@ bool MemoryContext::MapDocument(Document const& rDoc, CpuContext const* pCpuCtxt
     u32 MemAreaSize             = rMemArea.GetSize();
     u32 MemAreaFileSize         = rMemArea.GetFileSize();
 
-    void* pRawMemory;
     u64 LinearAddress;
     if (pCpuCtxt->Translate(rMemAreaAddr, LinearAddress) == false)
       LinearAddress = rMemAreaAddr.GetOffset();
 
+    if (MemAreaFileSize > MemAreaSize)
+      MemAreaFileSize = MemAreaSize;
+
+    TOffset MemAreaFileOff = 0;
+    if (MemAreaFileSize != 0x0 && rMemArea.ConvertOffsetToFileOffset(rMemAreaAddr.GetOffset(), MemAreaFileOff) == false)
+      MemAreaFileSize = 0x0;
+
+    BinaryStream const& rBinStrm = rDoc.GetBinaryStream();
+    if (MapMemory(LinearAddress, MemAreaSize, rBinStrm, MemAreaFileOff, MemAreaFileSize, nullptr))
+      return;
+
+    // The memory can't be mapped, the area is copied instead
+    void* pRawMemory;
     if (AllocateMemory(LinearAddress, MemAreaSize, &pRawMemory) == false)
     {
       Res = false;
       return;
     }
 
-    // TODO: Do we have to zero-out memory?
     if (MemAreaFileSize == 0x0)
       return;
 
-    TOffset MemAreaFileOff;
-    if (rMemArea.ConvertOffsetToFileOffset(rMemAreaAddr.GetOffset(), MemAreaFileOff) == false)
-      return;
-
-    if (!rDoc.GetBinaryStream().Read(MemAreaFileOff, pRawMemory, MemAreaFileSize))
+    if (!rBinStrm.Read(MemAreaFileOff, pRawMemory, MemAreaFileSize))
     {
       FreeMemory(LinearAddress);
       Res = false;
@@ -176,78 +299,72 @@ bool MemoryContext::FindMemoryChunk(u64 LinearAddress, MemoryChunk& rMemChnk) co
 
 bool VariableContext::ReadVariable(std::string const& rVariableName, u64& rValue) const
 {
-  auto const itVar = m_Variables.find(rVariableName);
-  if (itVar == std::end(m_Variables))
-    return false;
-
-  switch (itVar->second.m_Type)
-  {
-  case Var1Bit:  rValue = (itVar->second.u.m_Value & 0x00000001); break;
-  case Var8Bit:  rValue = (itVar->second.u.m_Value & 0x000000ff); break;
-  case Var16Bit: rValue = (itVar->second.u.m_Value & 0x0000ffff); break;
-  case Var32Bit: rValue = (itVar->second.u.m_Value & 0xffffffff); break;
-  case Var64Bit: rValue = (itVar->second.u.m_Value);              break;
-  default: return false;
-  }
-
-  return true;
+  return ReadVariable(FindSlot(rVariableName), rValue);
 }
 
 bool VariableContext::WriteVariable(std::string const& rVariableName, u64 Value, bool SignExtend)
 {
-  auto itVar = m_Variables.find(rVariableName);
-  if (itVar == std::end(m_Variables))
-    return false;
-
-  switch (itVar->second.m_Type)
-  {
-  case Var1Bit:  itVar->second.u.m_Value = (Value & 0x00000001); break;
-  case Var8Bit:  itVar->second.u.m_Value = (Value & 0x000000ff); break;
-  case Var16Bit: itVar->second.u.m_Value = (Value & 0x0000ffff); break;
-  case Var32Bit: itVar->second.u.m_Value = (Value & 0xffffffff); break;
-  case Var64Bit: itVar->second.u.m_Value = (Value);              break;
-  default: return false;
-  }
-
-  return true;
+  return WriteVariable(FindSlot(rVariableName), Value);
 }
 
 void* VariableContext::GetVariable(std::string const& rVariableName)
 {
-  auto itVar = m_Variables.find(rVariableName);
-  if (itVar == std::end(m_Variables))
+  u32 Slot = FindSlot(rVariableName);
+  if (Slot == InvalidSlot || m_Variables[Slot].m_Type == VarUnknown)
     return nullptr;
-  return itVar->second.u.m_pValue;
+  return m_Variables[Slot].u.m_pValue;
 }
 
 bool VariableContext::AllocateVariable(u32 Type, std::string const& rVariableName)
 {
-  FreeVariable(rVariableName);
+  return AllocateVariable(Type, GetSlot(rVariableName));
+}
 
-  m_Variables[rVariableName] = VariableInformation(Type, 0x0);
+bool VariableContext::FreeVariable(std::string const& rVariableName)
+{
+  u32 Slot = FindSlot(rVariableName);
+  if (Slot == InvalidSlot || m_Variables[Slot].m_Type == VarUnknown)
+    return false;
+  m_Variables[Slot] = VariableInformation();
   return true;
 }
 
-bool VariableContext::FreeVariable(std::string const& rVariableName)
+u32 VariableContext::GetSlot(std::string const& rVariableName)
 {
-  auto VarNo = m_Variables.size();
-  m_Variables.erase(rVariableName);
-  return VarNo != m_Variables.size();
+  auto itSlot = m_Slots.find(rVariableName);
+  if (itSlot != std::end(m_Slots))
+    return itSlot->second;
+
+  u32 Slot = static_cast<u32>(m_Variables.size());
+  m_Slots[rVariableName] = Slot;
+  m_Names.push_back(rVariableName);
+  m_Variables.push_back(VariableInformation());
+  return Slot;
 }
 
-std::string VariableContext::ToString(void) const
+u32 VariableContext::FindSlot(std::string const& rVariableName) const
 {
-  if (m_Variables.empty())
-    return "";
+  auto itSlot = m_Slots.find(rVariableName);
+  if (itSlot == std::end(m_Slots))
+    return InvalidSlot;
+  return itSlot->second;
+}
 
+std::string VariableContext::ToString(void) const
+{
   std::ostringstream oss;
 
-  for (auto itVar = std::begin(m_Variables); itVar != std::end(m_Variables); ++itVar)
+  for (u32 Slot = 0; Slot < m_Variables.size(); ++Slot)
+  {
+    auto const& rVar = m_Variables[Slot];
+    if (rVar.m_Type == VarUnknown)
+      continue;
     oss
-      << "var: " << itVar->first
-      << ", type: " << static_cast<int>(itVar->second.m_Type)
-      << ", value: " << std::hex << std::setfill('0') << std::setw(itVar->second.m_Type / 8 * 2) << itVar->second.u.m_Value
+      << "var: " << m_Names[Slot]
+      << ", type: " << static_cast<int>(rVar.m_Type)
+      << ", value: " << std::hex << std::setfill('0') << std::setw(rVar.m_Type / 8 * 2) << rVar.u.m_Value
       << std::endl;
+  }
   return oss.str();
 }
 
@@ -0,0 +1,77 @@
+#include "medusa/decoded_instruction.hpp"
+
+#include <cstring>
+
+MEDUSA_NAMESPACE_BEGIN
+
+DecodedInstruction::DecodedInstruction(void)
+{
+  ::memset(this, 0x0, sizeof(*this));
+}
+
+DecodedInstruction::DecodedInstruction(TOffset Offset, Instruction const& rInsn, u8 Mode)
+{
+  Load(Offset, rInsn, Mode);
+}
+
+void DecodedInstruction::Load(TOffset Offset, Instruction const& rInsn, u8 Mode)
+{
+  m_Offset       = Offset;
+  m_pName        = rInsn.GetName();
+  m_Opcode       = rInsn.GetOpcode();
+  m_Prefix       = rInsn.GetPrefix();
+  m_SemId        = rInsn.GetSemanticId();
+  m_TestedFlags  = rInsn.GetTestedFlags();
+  m_UpdatedFlags = rInsn.GetUpdatedFlags();
+  m_ClearedFlags = rInsn.GetClearedFlags();
+  m_FixedFlags   = rInsn.GetFixedFlags();
+  m_Length       = static_cast<u16>(rInsn.GetLength());
+  m_SubType      = rInsn.GetSubType();
+  m_Mode         = Mode;
+
+  for (u8 CurOprd = 0; CurOprd < OperandNo; ++CurOprd)
+  {
+    Operand const* pOprd = rInsn.Operand(CurOprd);
+    DecodedOperand& rDecOprd = m_Oprd[CurOprd];
+
+    rDecOprd.m_Value    = pOprd->GetRawValue();
+    rDecOprd.m_Type     = pOprd->GetType();
+    rDecOprd.m_Reg      = pOprd->GetReg();
+    rDecOprd.m_SecReg   = pOprd->GetSecReg();
+    rDecOprd.m_Seg      = pOprd->GetSeg();
+    rDecOprd.m_SegValue = pOprd->GetSegValue();
+    rDecOprd.m_Offset   = pOprd->GetOffset();
+  }
+}
+
+void DecodedInstruction::ToInstruction(Instruction& rInsn) const
+{
+  rInsn.Reset();
+
+  rInsn.SetName(m_pName);
+  rInsn.SetOpcode(m_Opcode);
+  rInsn.Prefix() = m_Prefix;
+  rInsn.SetSemanticId(m_SemId);
+  rInsn.SetTestedFlags(m_TestedFlags);
+  rInsn.SetUpdatedFlags(m_UpdatedFlags);
+  rInsn.SetClearedFlags(m_ClearedFlags);
+  rInsn.SetFixedFlags(m_FixedFlags);
+  rInsn.Length() = m_Length;
+  rInsn.SubType() = m_SubType;
+
+  for (u8 CurOprd = 0; CurOprd < OperandNo; ++CurOprd)
+  {
+    Operand* pOprd = rInsn.Operand(CurOprd);
+    DecodedOperand const& rDecOprd = m_Oprd[CurOprd];
+
+    pOprd->SetValue(rDecOprd.m_Value);
+    pOprd->SetType(rDecOprd.m_Type);
+    pOprd->SetReg(rDecOprd.m_Reg);
+    pOprd->SetSecReg(rDecOprd.m_SecReg);
+    pOprd->SetSeg(rDecOprd.m_Seg);
+    pOprd->SetSegValue(rDecOprd.m_SegValue);
+    pOprd->SetOffset(rDecOprd.m_Offset);
+  }
+}
+
+MEDUSA_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include "medusa/value.hpp"
 #include "medusa/log.hpp"
 #include "medusa/module.hpp"
+#include "medusa/instruction.hpp"
 
 #include <boost/bind.hpp>
 #include <boost/foreach.hpp>
@@ -218,41 +219,28 @@ bool Document::SetComment(Address const& rAddress, std::string const& rComment)
 
 Cell::SPtr Document::GetCell(Address const& rAddr)
 {
-  boost::mutex::scoped_lock Lock(m_CellMutex);
-
-  CellData CurCellData;
-  if (!m_spDatabase->GetCellData(rAddr, CurCellData))
-    return false;
-  auto spCellData = std::make_shared<CellData>(CurCellData); // TODO: we can avoid this
-
-  switch (CurCellData.GetType())
-  {
-  case Cell::ValueType:     return std::make_shared<Value>(spCellData);
-  case Cell::CharacterType: return std::make_shared<Character>(spCellData);
-  case Cell::StringType:    return std::make_shared<String>(spCellData);
-  case Cell::InstructionType:
-    {
-      auto spInsn = std::make_shared<Instruction>();
-      auto spArch = ModuleManager::Instance().GetArchitecture(CurCellData.GetArchitectureTag());
-      TOffset Offset;
-      ConvertAddressToFileOffset(rAddr, Offset);
-      spArch->Disassemble(GetBinaryStream(), Offset, *spInsn, CurCellData.GetMode());
-      return spInsn;
-    }
-  default:
-    break;
-  }
-
-  return Cell::SPtr();
+  return MakeCell(rAddr, Architecture::DisasmDecodeOnly);
 }
 
 Cell::SPtr const Document::GetCell(Address const& rAddr) const
 {
-  boost::mutex::scoped_lock Lock(m_CellMutex);
+  return MakeCell(rAddr, Architecture::DisasmDecodeOnly);
+}
+
+Cell::SPtr Document::GetCellWithSemantic(Address const& rAddr) const
+{
+  return MakeCell(rAddr, Architecture::DisasmSemantic);
+}
 
+Cell::SPtr Document::MakeCell(Address const& rAddr, u8 DisasmFlags) const
+{
+  // Instructions are disassembled without the lock, so emulations can decode them in parallel
   CellData CurCellData;
-  if (!m_spDatabase->GetCellData(rAddr, CurCellData))
-    return false;
+  {
+    boost::mutex::scoped_lock Lock(m_CellMutex);
+    if (!m_spDatabase->GetCellData(rAddr, CurCellData))
+      return Cell::SPtr();
+  }
   auto spCellData = std::make_shared<CellData>(CurCellData); // TODO: we can avoid this
 
   switch (CurCellData.GetType())
@@ -266,7 +254,7 @@ Cell::SPtr const Document::GetCell(Address const& rAddr) const
       auto spArch = ModuleManager::Instance().GetArchitecture(CurCellData.GetArchitectureTag());
       TOffset Offset;
       ConvertAddressToFileOffset(rAddr, Offset);
-      spArch->Disassemble(GetBinaryStream(), Offset, *spInsn, CurCellData.GetMode());
+      spArch->Disassemble(GetBinaryStream(), Offset, *spInsn, CurCellData.GetMode(), DisasmFlags);
       return spInsn;
     }
   default:
@@ -292,6 +280,39 @@ u8 Document::GetCellSubType(Address const& rAddr) const
   return CurCellData.GetSubType();
 }
 
+bool Document::GetInstructionMode(Address const& rAddr, u8& rMode) const
+{
+  CellData CurCellData;
+  {
+    boost::mutex::scoped_lock Lock(m_CellMutex);
+    if (!m_spDatabase->GetCellData(rAddr, CurCellData))
+      return false;
+  }
+  if (CurCellData.GetType() != Cell::InstructionType)
+    return false;
+  rMode = CurCellData.GetMode();
+  return true;
+}
+
+bool Document::DecodeInstruction(Address const& rAddr, Instruction& rInsn) const
+{
+  CellData CurCellData;
+  {
+    boost::mutex::scoped_lock Lock(m_CellMutex);
+    if (!m_spDatabase->GetCellData(rAddr, CurCellData))
+      return false;
+  }
+  if (CurCellData.GetType() != Cell::InstructionType)
+    return false;
+
+  auto spArch = ModuleManager::Instance().GetArchitecture(CurCellData.GetArchitectureTag());
+  TOffset Offset;
+  if (spArch == nullptr || !ConvertAddressToFileOffset(rAddr, Offset))
+    return false;
+  rInsn.Reset();
+  return spArch->Disassemble(GetBinaryStream(), Offset, rInsn, CurCellData.GetMode(), Architecture::DisasmDecodeOnly);
+}
+
 bool Document::SetCell(Address const& rAddr, Cell::SPtr spCell, bool Force)
 {
   Address::List ErasedAddresses;
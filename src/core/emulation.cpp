@@ -4,7 +4,11 @@ MEDUSA_NAMESPACE_BEGIN
 
 Emulator::Emulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt)
   : m_pCpuInfo(pCpuInfo), m_pCpuCtxt(pCpuCtxt), m_pMemCtxt(pMemCtxt), m_pVarCtxt(pVarCtxt)
+  , m_RegLayout(pCpuCtxt)
+  , m_TranslationTime()
+  , m_HookNo()
 {
+  UpdateHookFilter();
 }
 
 Emulator::~Emulator(void)
@@ -36,18 +40,46 @@ bool Emulator::WriteMemory(Address const& rAddress, void const* pValue, u32 Valu
   return m_pMemCtxt->WriteMemory(LinAddr, pValue, ValueSize);
 }
 
-bool Emulator::AddHook(Address const& rAddress, u32 Type, HookCallback Callback)
+bool Emulator::TranslateBlock(Address const& rAddress, u32 Size, Expression::List const& rExprList)
 {
-  auto itHook = m_Hooks.find(rAddress);
-  if (itHook != std::end(m_Hooks))
-  {
-    itHook->second.m_Callback = Callback;
-    itHook->second.m_Type |= Type;
-    return true;
-  }
+  return false;
+}
 
-  m_Hooks[rAddress] = HookInformation(Type, Callback);
-  return true;
+bool Emulator::IsBlockTranslated(Address const& rAddress) const
+{
+  return false;
+}
+
+bool Emulator::ExecuteBlock(Address const& rAddress)
+{
+  return false;
+}
+
+void Emulator::InvalidateBlocks(void)
+{
+}
+
+void Emulator::SetBlockChaining(bool Enable, Address const* pStopAddr)
+{
+}
+
+bool Emulator::TakeSnapshot(void)
+{
+  if (m_pCpuCtxt->TakeSnapshot() == false)
+    return false;
+  return m_pMemCtxt->TakeSnapshot();
+}
+
+bool Emulator::RestoreSnapshot(void)
+{
+  if (m_pCpuCtxt->RestoreSnapshot() == false)
+    return false;
+  return m_pMemCtxt->RestoreSnapshot();
+}
+
+bool Emulator::AddHook(Address const& rAddress, u32 Type, HookCallback Callback)
+{
+  return AddHook(rAddress, 1, Type, Callback);
 }
 
 bool Emulator::AddHook(Document const& rDoc, std::string const& rLabelName, u32 Type, HookCallback Callback)
@@ -56,26 +88,136 @@ bool Emulator::AddHook(Document const& rDoc, std::string const& rLabelName, u32
   return AddHook(Addr, Type, Callback);
 }
 
-bool Emulator::RemoveHook(Address const& rAddress)
+bool Emulator::AddHook(Address const& rAddress, u32 Size, u32 Type, HookCallback Callback)
 {
-  auto itHook = m_Hooks.find(rAddress);
-  if (itHook == std::end(m_Hooks))
+  if (Size == 0 || (Type & (HookOnRead | HookOnWrite | HookOnExecute)) == 0)
     return false;
-  m_Hooks.erase(itHook);
+
+  if (Size == 1)
+  {
+    for (u32 CurType = HookOnRead; CurType <= HookOnExecute; CurType <<= 1)
+    {
+      if (!(Type & CurType))
+        continue;
+      auto& rHooks = m_Hooks[GetHookTypeIndex(CurType)];
+      if (rHooks.find(rAddress) == std::end(rHooks))
+        ++m_HookNo;
+      rHooks[rAddress] = Callback;
+    }
+  }
+  else
+  {
+    HookRange Range;
+    Range.m_Address  = rAddress;
+    Range.m_Size     = Size;
+    Range.m_Type     = Type;
+    Range.m_Callback = Callback;
+    m_RangeHooks.push_back(Range);
+    ++m_HookNo;
+  }
+
+  FilterHook(rAddress.GetOffset(), Size, Type);
   return true;
 }
 
-bool Emulator::TestHook(Address const& rAddress, u32 Type) const
+bool Emulator::RemoveHook(Address const& rAddress)
 {
-  auto itHook = m_Hooks.find(rAddress);
-  if (itHook == std::end(m_Hooks))
-    return false;
+  u32 OldHookNo = m_HookNo;
+
+  for (u32 i = 0; i < HookTypeNo; ++i)
+    m_HookNo -= static_cast<u32>(m_Hooks[i].erase(rAddress));
+
+  for (auto itRange = std::begin(m_RangeHooks); itRange != std::end(m_RangeHooks);)
+  {
+    if (itRange->m_Address == rAddress)
+    {
+      itRange = m_RangeHooks.erase(itRange);
+      --m_HookNo;
+    }
+    else
+      ++itRange;
+  }
 
-  if (!(itHook->second.m_Type & Type))
+  if (m_HookNo == OldHookNo)
     return false;
 
-  itHook->second.m_Callback(m_pCpuCtxt, m_pMemCtxt);
+  // Bits can't be cleared from the filter, it's built again
+  UpdateHookFilter();
   return true;
 }
 
+bool Emulator::CallHooks(Address const& rAddress, u32 Type) const
+{
+  bool Called = false;
+
+  for (u32 CurType = HookOnRead; CurType <= HookOnExecute; CurType <<= 1)
+  {
+    if (!(Type & CurType))
+      continue;
+    auto const& rHooks = m_Hooks[GetHookTypeIndex(CurType)];
+    auto itHook = rHooks.find(rAddress);
+    if (itHook == std::end(rHooks))
+      continue;
+    itHook->second(m_pCpuCtxt, m_pMemCtxt);
+    Called = true;
+  }
+
+  for (auto itRange = std::begin(m_RangeHooks); itRange != std::end(m_RangeHooks); ++itRange)
+  {
+    if (!(itRange->m_Type & Type) || itRange->m_Address.GetBase() != rAddress.GetBase())
+      continue;
+    // The subtraction also handles ranges which wrap around
+    if (rAddress.GetOffset() - itRange->m_Address.GetOffset() >= itRange->m_Size)
+      continue;
+    itRange->m_Callback(m_pCpuCtxt, m_pMemCtxt);
+    Called = true;
+  }
+
+  return Called;
+}
+
+void Emulator::FilterHook(u64 Offset, u32 Size, u32 Type)
+{
+  u64 FirstPage = Offset >> HookPageBits;
+  u64 LastPage  = (Offset + Size - 1) >> HookPageBits;
+
+  // A range larger than the filter (or which wraps around) sets every entry
+  if (LastPage < FirstPage || LastPage - FirstPage >= HookFilterSize)
+  {
+    for (u32 i = 0; i < HookFilterSize; ++i)
+      m_HookFilter[i] |= static_cast<u8>(Type);
+    return;
+  }
+
+  for (u64 CurPage = FirstPage; CurPage <= LastPage; ++CurPage)
+    m_HookFilter[CurPage & (HookFilterSize - 1)] |= static_cast<u8>(Type);
+}
+
+void Emulator::UpdateHookFilter(void)
+{
+  for (u32 i = 0; i < HookFilterSize; ++i)
+    m_HookFilter[i] = 0;
+
+  for (u32 CurType = HookOnRead; CurType <= HookOnExecute; CurType <<= 1)
+  {
+    auto const& rHooks = m_Hooks[GetHookTypeIndex(CurType)];
+    for (auto itHook = std::begin(rHooks); itHook != std::end(rHooks); ++itHook)
+      FilterHook(itHook->first.GetOffset(), 1, CurType);
+  }
+
+  for (auto itRange = std::begin(m_RangeHooks); itRange != std::end(m_RangeHooks); ++itRange)
+    FilterHook(itRange->m_Address.GetOffset(), itRange->m_Size, itRange->m_Type);
+}
+
+u32 Emulator::GetHookTypeIndex(u32 Type)
+{
+  switch (Type)
+  {
+  case HookOnRead:    return 0;
+  case HookOnWrite:   return 1;
+  case HookOnExecute: return 2;
+  default:            return 0;
+  }
+}
+
 MEDUSA_NAMESPACE_END
\ No newline at end of file
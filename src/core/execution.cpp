@@ -3,27 +3,85 @@
 
 #include "medusa/log.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 MEDUSA_NAMESPACE_BEGIN
 
+namespace
+{
+
+// This visitor tells if a statement writes memory
+class WriteMemoryVisitor : public ExpressionVisitor
+{
+public:
+  WriteMemoryVisitor(void) : m_WriteMemory(false) {}
+
+  virtual Expression* VisitBind(Expression::List const& rExprList)
+  {
+    for (auto itExpr = std::begin(rExprList); itExpr != std::end(rExprList); ++itExpr)
+      (*itExpr)->Visit(this);
+    return nullptr;
+  }
+
+  virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+  {
+    return pThenExpr->Visit(this);
+  }
+
+  virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+  {
+    pThenExpr->Visit(this);
+    return pElseExpr->Visit(this);
+  }
+
+  virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+  {
+    return pBodyExpr->Visit(this);
+  }
+
+  virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+  {
+    if (Type == OperationExpression::OpAff && dynamic_cast<MemoryExpression const*>(pLeftExpr) != nullptr)
+      m_WriteMemory = true;
+    else if (Type == OperationExpression::OpXchg
+      && (dynamic_cast<MemoryExpression const*>(pLeftExpr) != nullptr || dynamic_cast<MemoryExpression const*>(pRightExpr) != nullptr))
+      m_WriteMemory = true;
+    return nullptr;
+  }
+
+  bool m_WriteMemory;
+};
+
+}
+
 Execution::Execution(Medusa* pCore, Architecture::SharedPtr spArch, OperatingSystem::SharedPtr spOs)
 : m_pCore(pCore)
 , m_spArch(spArch), m_spOs(spOs)
 , m_pCpuCtxt(nullptr), m_pMemCtxt(nullptr)
 , m_pCpuInfo(spArch->GetCpuInformation())
+, m_Simplifier(m_pCpuInfo)
+, m_TraceMask(TraceNone)
+, m_pTraceRecorder(nullptr)
+, m_TranslationTime()
 {
 }
 
 Execution::~Execution(void)
 {
+  SetTraceRecorder(nullptr);
 }
 
 bool Execution::Initialize(u64 StackLinearAddress, u32 StackSize)
 {
+  SetTraceRecorder(nullptr);
   delete m_pCpuCtxt;
   delete m_pMemCtxt;
 
   m_pCpuCtxt = m_spArch->MakeCpuContext();
   m_pMemCtxt = m_spArch->MakeMemoryContext();
+  m_Simplifier.UseCpuContext(m_pCpuCtxt);
   if (m_spOs != nullptr)
   {
     m_spOs->InitializeCpuContext(m_pCore->GetDocument(), *m_pCpuCtxt);
@@ -62,75 +120,228 @@ bool Execution::SetEmulator(std::string const& rEmulatorName)
   return true;
 }
 
+void Execution::SetTrace(u32 TraceMask, TraceCallback Callback)
+{
+  m_TraceMask     = TraceMask;
+  m_TraceCallback = Callback;
+}
+
+u64 Execution::GetTranslationTime(void) const
+{
+  u64 TranslationTime = m_TranslationTime;
+  if (m_spEmul != nullptr)
+    TranslationTime += m_spEmul->GetTranslationTime();
+  return TranslationTime;
+}
+
+bool Execution::SetTraceRecorder(TraceRecorder* pRecorder)
+{
+  if (m_pTraceRecorder != nullptr)
+  {
+    m_pTraceRecorder->Stop();
+    if (m_pMemCtxt != nullptr)
+      m_pMemCtxt->SetWriteCallback(nullptr);
+    m_pTraceRecorder = nullptr;
+  }
+
+  if (pRecorder == nullptr)
+    return true;
+
+  if (m_pCpuCtxt == nullptr || m_pMemCtxt == nullptr || pRecorder->Start(m_pCpuCtxt) == false)
+    return false;
+
+  m_pTraceRecorder = pRecorder;
+  m_pMemCtxt->SetWriteCallback([pRecorder](u64 LinearAddress, void const* pValue, u32 Size)
+  { pRecorder->RecordMemoryWrite(LinearAddress, pValue, Size); });
+  return true;
+}
+
 void Execution::Execute(Address const& rAddr)
+{
+  ExecuteUntil(rAddr, nullptr);
+}
+
+u32 Execution::ExecuteFromSnapshot(Address const& rAddr, Address const& rStopAddr, u32 RunNo, SetupCallback Setup, ResultCallback Result)
+{
+  if (m_spEmul == nullptr)
+    return 0;
+
+  if (m_spEmul->TakeSnapshot() == false)
+    return 0;
+
+  u32 RunIdx = 0;
+  for (; RunIdx < RunNo; ++RunIdx)
+  {
+    if (Setup && Setup(RunIdx, m_pCpuCtxt, m_pMemCtxt) == false)
+      break;
+
+    bool Reached = ExecuteUntil(rAddr, &rStopAddr);
+
+    if (Result)
+      Result(RunIdx, Reached, m_pCpuCtxt, m_pMemCtxt);
+
+    if (m_spEmul->RestoreSnapshot() == false)
+    {
+      ++RunIdx;
+      break;
+    }
+
+    // The memory is restored without write callback, the trace must tell its writes are undone
+    if (m_pTraceRecorder != nullptr)
+      m_pTraceRecorder->RecordRestore();
+  }
+
+  return RunIdx;
+}
+
+bool Execution::ExecuteUntil(Address const& rAddr, Address const* pStopAddr)
 {
   if (m_spEmul == nullptr)
-    return;
+    return false;
 
   Address CurAddr = rAddr;
 
   u32 ProgPtrReg = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister);
   if (ProgPtrReg == CpuInformation::InvalidRegister)
-    return;
+    return false;
   u32 ProgPtrRegSize = m_pCpuInfo->GetSizeOfRegisterInBit(ProgPtrReg);
   if (ProgPtrRegSize < 8)
-    return;
+    return false;
   ProgPtrRegSize /= 8;
 
   u64 CurInsn = rAddr.GetOffset();
   if (m_pCpuCtxt->WriteRegister(ProgPtrReg, &CurInsn, ProgPtrRegSize) == false)
-    return;
+    return false;
+
+  // Chained blocks don't return to this loop, so they can't be traced
+  m_spEmul->SetBlockChaining(m_TraceMask == TraceNone && m_pTraceRecorder == nullptr, pStopAddr);
 
-  Address BlkAddr = CurAddr;
+  ExpressionArena BlkArena;
   while (true)
   {
     //std::cout << m_pCpuCtxt->ToString() << std::endl;
 
+    Address BlkAddr = CurAddr;
+
+    if (pStopAddr != nullptr && BlkAddr.GetOffset() == pStopAddr->GetOffset())
+      return true;
+
+    if ((m_TraceMask & TraceBlock) && m_TraceCallback)
+      m_TraceCallback(BlkAddr, m_pCpuCtxt, m_pMemCtxt);
+
+    if (m_pTraceRecorder != nullptr)
+    {
+      u64 BlkLinAddr;
+      if (m_pCpuCtxt->Translate(BlkAddr, BlkLinAddr) == false)
+        BlkLinAddr = BlkAddr.GetOffset();
+      m_pTraceRecorder->RecordBlock(BlkLinAddr);
+    }
+
+    // The emulator keeps translated blocks, it's not worth to disassemble them again
+    // unless each instruction has to be traced
+    bool TraceInsn = (m_TraceMask & TraceInstruction) ? true : false;
+    if (!TraceInsn && m_spEmul->IsBlockTranslated(BlkAddr))
+    {
+      if (m_spEmul->ExecuteBlock(BlkAddr) == false)
+      {
+        Log::Write("exec") << "execution failed\n" << m_pCpuCtxt->ToString() << "\n" << m_pMemCtxt->ToString() << LogEnd;
+        break;
+      }
+
+      u64 NextInsn = 0;
+      if (m_pCpuCtxt->ReadRegister(ProgPtrReg, &NextInsn, ProgPtrRegSize) == false)
+        break;
+      CurAddr.SetOffset(NextInsn);
+      continue;
+    }
+
+    // The block is new or has been invalidated, everything until it's executed is translation
+    auto TranslationStart = std::chrono::steady_clock::now();
+
+    // Instructions are decoded by batches into records, a record is turned into an instruction
+    // only to build its semantic
+    DecodedInstruction DecInsns[BlockInstructionNumber];
+    size_t DecInsnNo = 0, DecInsnIdx = 0;
+    MemoryBinaryStreamView Code;
+    Instruction CurInsn;
+
     Expression::List Sems;
     while (true)
     {
-      auto spCurInsn = std::dynamic_pointer_cast<Instruction>(m_pCore->GetCell(CurAddr));
-      if (spCurInsn == nullptr)
+      if (DecInsnIdx == DecInsnNo)
+      {
+        DecInsnNo  = DecodeInstructions(CurAddr, Code, DecInsns, BlockInstructionNumber);
+        DecInsnIdx = 0;
+      }
+      if (DecInsnNo == 0)
       {
         Log::Write("exec") << "execution finished\n" << m_pCpuCtxt->ToString() << "\n" << m_pMemCtxt->ToString() << LogEnd;
-        return;
+        return false;
       }
 
-      std::string StrCell;
-      Cell::Mark::List Marks;
-      if (m_pCore->FormatCell(CurAddr, *spCurInsn, StrCell, Marks) == false)
-        break;
+      auto const& rDecInsn = DecInsns[DecInsnIdx++];
+      if (TraceInsn)
+      {
+        // Records don't keep operand names, the instruction is disassembled again to be formatted
+        std::string StrCell;
+        Cell::Mark::List Marks;
+        CurInsn.Reset();
+        if (m_spArch->Disassemble(Code, rDecInsn.m_Offset, CurInsn, rDecInsn.m_Mode, Architecture::DisasmDecodeOnly) == false
+          || m_pCore->FormatCell(CurAddr, CurInsn, StrCell, Marks) == false)
+          break;
+
+        Log::Write("exec") << StrCell << LogEnd;
+      }
 
-      Log::Write("exec") << StrCell << LogEnd;
+      rDecInsn.ToInstruction(CurInsn);
+      m_spArch->BuildSemantic(CurInsn);
 
-      Sems.push_back(new OperationExpression(OperationExpression::OpAff,
-        new IdentifierExpression(ProgPtrReg, m_pCpuInfo),
-        new OperationExpression(OperationExpression::OpAdd,
-        /**/new IdentifierExpression(ProgPtrReg, m_pCpuInfo),
-        /**/new ConstantExpression(ProgPtrRegSize * 8, spCurInsn->GetLength())
+      Sems.push_back(new (BlkArena) OperationExpression(OperationExpression::OpAff,
+        new (BlkArena) IdentifierExpression(ProgPtrReg, m_pCpuInfo),
+        new (BlkArena) OperationExpression(OperationExpression::OpAdd,
+        /**/new (BlkArena) IdentifierExpression(ProgPtrReg, m_pCpuInfo),
+        /**/new (BlkArena) ConstantExpression(ProgPtrRegSize * 8, CurInsn.GetLength())
         )));
-      CurAddr.SetOffset(CurAddr.GetOffset() + spCurInsn->GetLength());
+      CurAddr.SetOffset(CurAddr.GetOffset() + CurInsn.GetLength());
 
-      auto const& rCurSem = spCurInsn->GetSemantic();
+      auto const& rCurSem = CurInsn.GetSemantic();
       if (rCurSem.empty())
       {
         Log::Write("exec") << "no semantic available" << LogEnd;
         break;
       }
+      WriteMemoryVisitor WriteMem;
       std::for_each(std::begin(rCurSem), std::end(rCurSem), [&](Expression const* pExpr)
-      { Sems.push_back(pExpr->Clone()); });
+      {
+        m_Simplifier.Simplify(pExpr, Sems, BlkArena);
+        pExpr->Visit(&WriteMem);
+      });
 
-      if (spCurInsn->GetSubType() != Instruction::NoneType)
+      if (CurInsn.GetSubType() != Instruction::NoneType)
+        break;
+
+      // The following instructions could be modified by this one, they're decoded again once
+      // it's executed if it writes their page
+      if (WriteMem.m_WriteMemory)
         break;
     };
 
-    bool Res = m_spEmul->Execute(BlkAddr, Sems);
+    // Flags and registers overwritten in the same block don't need to be emulated
+    m_Simplifier.EliminateDeadAssignments(Sems);
+
+    u32 BlkSize = static_cast<u32>(CurAddr.GetOffset() - BlkAddr.GetOffset());
+    bool Translated = !TraceInsn && m_spEmul->TranslateBlock(BlkAddr, BlkSize, Sems);
+    m_TranslationTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - TranslationStart).count();
+    bool Res = Translated
+      ? m_spEmul->ExecuteBlock(BlkAddr)
+      : m_spEmul->Execute(BlkAddr, Sems);
     std::for_each(std::begin(Sems), std::end(Sems), [](Expression* pExpr)
     { delete pExpr; });
+    BlkArena.Reset();
 
     if (Res == false)
     {
-      std::cout << "Execution failed:\n" << m_pCpuCtxt->ToString() << std::endl << m_pMemCtxt->ToString() << std::endl;
+      Log::Write("exec") << "execution failed\n" << m_pCpuCtxt->ToString() << "\n" << m_pMemCtxt->ToString() << LogEnd;
       break;
     }
 
@@ -139,6 +350,86 @@ void Execution::Execute(Address const& rAddr)
       break;
     CurAddr.SetOffset(NextInsn);
   }
+
+  return false;
+}
+
+size_t Execution::DecodeInstructions(Address const& rAddr, MemoryBinaryStreamView& rCode, DecodedInstruction* pInsns, size_t InsnNo) const
+{
+  Document const& rDoc = m_pCore->GetDocument();
+
+  // Code which hasn't been analyzed, e.g. written by the emulated program, uses the default mode
+  u8 Mode;
+  if (rDoc.GetInstructionMode(rAddr, Mode) == false)
+    Mode = m_spArch->GetDefaultMode(rAddr);
+
+  u64 LinAddr;
+  if (m_pCpuCtxt->Translate(rAddr, LinAddr) == false)
+    LinAddr = rAddr.GetOffset();
+
+  // Instructions are read from the emulated memory, so modified code is decoded as it is now
+  void* pCode;
+  u32 CodeSize;
+  if (m_pMemCtxt->FindMemory(LinAddr, pCode, CodeSize) == false)
+    return 0;
+  rCode.Open(pCode, CodeSize);
+  rCode.SetEndianness(rDoc.GetBinaryStream().GetEndianness());
+
+  return m_spArch->DisassembleRange(rCode, 0, CodeSize, Mode, pInsns, InsnNo);
+}
+
+ParallelExecution::ParallelExecution(Medusa* pCore, Architecture::SharedPtr spArch, OperatingSystem::SharedPtr spOs, u32 ThreadNo)
+{
+  if (ThreadNo == 0)
+    ThreadNo = std::max(std::thread::hardware_concurrency(), 1U);
+  for (u32 i = 0; i < ThreadNo; ++i)
+    m_Executions.push_back(std::unique_ptr<Execution>(new Execution(pCore, spArch, spOs)));
+}
+
+bool ParallelExecution::Initialize(u64 StackLinearAddress, u32 StackSize, std::string const& rEmulatorName)
+{
+  // Contexts are initialized from the document here, workers only read it when they decode instructions
+  for (auto itExec = std::begin(m_Executions); itExec != std::end(m_Executions); ++itExec)
+  {
+    if ((*itExec)->Initialize(StackLinearAddress, StackSize) == false)
+      return false;
+    if ((*itExec)->SetEmulator(rEmulatorName) == false)
+      return false;
+  }
+  return true;
+}
+
+u32 ParallelExecution::Execute(std::vector<Address> const& rFuncAddrs, Address const& rStopAddr, Execution::SetupCallback Setup, Execution::ResultCallback Result)
+{
+  std::atomic<u32> NextFunc(0);
+  std::atomic<u32> ExecutedNo(0);
+  u32 FuncNo = static_cast<u32>(rFuncAddrs.size());
+
+  // Functions are taken one by one, so a long function doesn't delay a whole range of them
+  auto Worker = [&](Execution* pExec)
+  {
+    while (true)
+    {
+      u32 FuncIdx = NextFunc++;
+      if (FuncIdx >= FuncNo)
+        break;
+
+      auto FuncSetup = [&](u32, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt)
+      { return !Setup || Setup(FuncIdx, pCpuCtxt, pMemCtxt); };
+      auto FuncResult = [&](u32, bool Reached, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt)
+      { if (Result) Result(FuncIdx, Reached, pCpuCtxt, pMemCtxt); };
+
+      ExecutedNo += pExec->ExecuteFromSnapshot(rFuncAddrs[FuncIdx], rStopAddr, 1, FuncSetup, FuncResult);
+    }
+  };
+
+  std::vector<std::thread> Threads;
+  for (auto itExec = std::begin(m_Executions); itExec != std::end(m_Executions); ++itExec)
+    Threads.push_back(std::thread(Worker, itExec->get()));
+  for (auto itThread = std::begin(Threads); itThread != std::end(Threads); ++itThread)
+    itThread->join();
+
+  return ExecutedNo;
 }
 
 MEDUSA_NAMESPACE_END
\ No newline at end of file
@@ -6,6 +6,75 @@
 
 MEDUSA_NAMESPACE_USE
 
+// Each expression is prefixed by a tag which tells where it was allocated,
+// so delete can be used regardless of the allocator.
+enum
+{
+  ExprHeapAllocated   = 0x68656170,
+  ExprArenaAllocated  = 0x6172656e,
+  ExprSharedAllocated = 0x73686172,
+  ExprTagSize         = sizeof(u64)
+};
+
+void* Expression::operator new(size_t Size)
+{
+  auto pMem = static_cast<u64*>(::operator new(Size + ExprTagSize));
+  *pMem = ExprHeapAllocated;
+  return pMem + 1;
+}
+
+void* Expression::operator new(size_t Size, ExpressionArena& rArena)
+{
+  auto pMem = static_cast<u64*>(rArena.Allocate(Size + ExprTagSize));
+  *pMem = ExprArenaAllocated;
+  return pMem + 1;
+}
+
+void* Expression::operator new(size_t Size, ExpressionArena* pArena)
+{
+  if (pArena == nullptr)
+    return Expression::operator new(Size);
+  return Expression::operator new(Size, *pArena);
+}
+
+void Expression::operator delete(void* pExpr)
+{
+  if (pExpr == nullptr)
+    return;
+  auto pMem = static_cast<u64*>(pExpr) - 1;
+  // Memory from an arena is released with the arena
+  if (*pMem != ExprHeapAllocated)
+    return;
+  ::operator delete(pMem);
+}
+
+bool Expression::IsShared(void) const
+{
+  return *(reinterpret_cast<u64 const*>(this) - 1) == ExprSharedAllocated;
+}
+
+void Expression::Release(Expression* pExpr)
+{
+  if (pExpr == nullptr || pExpr->IsShared())
+    return;
+  delete pExpr;
+}
+
+void Expression::MarkAsShared(Expression* pExpr)
+{
+  assert(*(reinterpret_cast<u64 const*>(pExpr) - 1) == ExprArenaAllocated);
+  *(reinterpret_cast<u64*>(pExpr) - 1) = ExprSharedAllocated;
+}
+
+void Expression::operator delete(void* pExpr, ExpressionArena& rArena)
+{
+}
+
+void Expression::operator delete(void* pExpr, ExpressionArena* pArena)
+{
+  Expression::operator delete(pExpr);
+}
+
 /* Usually the main operation is located in the first expression */
 Expression* ExpressionVisitor_FindOperation::VisitBind(Expression::List const& rExprList)
 {
@@ -95,7 +164,7 @@ BindExpression::~BindExpression(void)
 {
   std::for_each(std::begin(m_Expressions), std::end(m_Expressions), [](Expression *pExpr)
   {
-    delete pExpr;
+    Release(pExpr);
   });
   m_Expressions.clear();
 }
@@ -123,6 +192,17 @@ Expression *BindExpression::Clone(void) const
   return new BindExpression(ExprListCloned);
 }
 
+Expression *BindExpression::Clone(ExpressionArena& rArena) const
+{
+  Expression::List ExprListCloned;
+  std::for_each(std::begin(m_Expressions), std::end(m_Expressions), [&](Expression *pExpr)
+  {
+    ExprListCloned.push_back(pExpr->Clone(rArena));
+  });
+
+  return new (rArena) BindExpression(ExprListCloned);
+}
+
 ConditionExpression::ConditionExpression(Type CondType, Expression *pRefExpr, Expression *pTestExpr)
     : m_Type(CondType), m_pRefExpr(pRefExpr), m_pTestExpr(pTestExpr)
 {
@@ -130,8 +210,8 @@ ConditionExpression::ConditionExpression(Type CondType, Expression *pRefExpr, Ex
 
 ConditionExpression::~ConditionExpression(void)
 {
-  delete m_pRefExpr;
-  delete m_pTestExpr;
+  Release(m_pRefExpr);
+  Release(m_pTestExpr);
 }
 
 std::string ConditionExpression::ToString(void) const
@@ -148,6 +228,11 @@ Expression *ConditionExpression::Clone(void) const
   return new ConditionExpression(m_Type, m_pRefExpr->Clone(), m_pTestExpr->Clone());
 }
 
+Expression *ConditionExpression::Clone(ExpressionArena& rArena) const
+{
+  return new (rArena) ConditionExpression(m_Type, m_pRefExpr->Clone(rArena), m_pTestExpr->Clone(rArena));
+}
+
 IfConditionExpression::IfConditionExpression(Type CondType, Expression *pRefExpr, Expression *pTestExpr, Expression *pThenExpr)
     : ConditionExpression(CondType, pRefExpr, pTestExpr), m_pThenExpr(pThenExpr)
 {
@@ -165,7 +250,7 @@ IfConditionExpression::IfConditionExpression(ConditionExpression* pCondExpr, Exp
 
 IfConditionExpression::~IfConditionExpression(void)
 {
-  delete m_pThenExpr;
+  Release(m_pThenExpr);
 }
 
 std::string IfConditionExpression::ToString(void) const
@@ -178,6 +263,11 @@ Expression *IfConditionExpression::Clone(void) const
   return new IfConditionExpression(m_Type, m_pRefExpr->Clone(), m_pTestExpr->Clone(), m_pThenExpr->Clone());
 }
 
+Expression *IfConditionExpression::Clone(ExpressionArena& rArena) const
+{
+  return new (rArena) IfConditionExpression(m_Type, m_pRefExpr->Clone(rArena), m_pTestExpr->Clone(rArena), m_pThenExpr->Clone(rArena));
+}
+
 IfElseConditionExpression::IfElseConditionExpression(Type CondType, Expression *pRefExpr, Expression *pTestExpr, Expression *pThenExpr, Expression *pElseExpr)
   : IfConditionExpression(CondType, pRefExpr, pTestExpr, pThenExpr), m_pElseExpr(pElseExpr)
 {
@@ -190,7 +280,7 @@ IfElseConditionExpression::IfElseConditionExpression(ConditionExpression* pCondE
 
 IfElseConditionExpression::~IfElseConditionExpression(void)
 {
-  delete m_pElseExpr;
+  Release(m_pElseExpr);
 }
 
 std::string IfElseConditionExpression::ToString(void) const
@@ -203,6 +293,11 @@ Expression *IfElseConditionExpression::Clone(void) const
   return new IfElseConditionExpression(m_Type, m_pRefExpr->Clone(), m_pTestExpr->Clone(), m_pThenExpr->Clone(), m_pElseExpr->Clone());
 }
 
+Expression *IfElseConditionExpression::Clone(ExpressionArena& rArena) const
+{
+  return new (rArena) IfElseConditionExpression(m_Type, m_pRefExpr->Clone(rArena), m_pTestExpr->Clone(rArena), m_pThenExpr->Clone(rArena), m_pElseExpr->Clone(rArena));
+}
+
 WhileConditionExpression::WhileConditionExpression(Type CondType, Expression *pRefExpr, Expression *pTestExpr, Expression *pBodyExpr)
   : ConditionExpression(CondType, pRefExpr, pTestExpr), m_pBodyExpr(pBodyExpr)
 {
@@ -215,7 +310,7 @@ WhileConditionExpression::WhileConditionExpression(ConditionExpression* pCondExp
 
 WhileConditionExpression::~WhileConditionExpression(void)
 {
-  delete m_pBodyExpr;
+  Release(m_pBodyExpr);
 }
 
 std::string WhileConditionExpression::ToString(void) const
@@ -228,6 +323,11 @@ Expression *WhileConditionExpression::Clone(void) const
   return new WhileConditionExpression(m_Type, m_pRefExpr->Clone(), m_pTestExpr->Clone(), m_pBodyExpr->Clone());
 }
 
+Expression *WhileConditionExpression::Clone(ExpressionArena& rArena) const
+{
+  return new (rArena) WhileConditionExpression(m_Type, m_pRefExpr->Clone(rArena), m_pTestExpr->Clone(rArena), m_pBodyExpr->Clone(rArena));
+}
+
 OperationExpression::OperationExpression(Type OpType, Expression *pLeftExpr, Expression *pRightExpr)
     : m_OpType(OpType), m_pLeftExpr(pLeftExpr), m_pRightExpr(pRightExpr)
 {
@@ -235,8 +335,8 @@ OperationExpression::OperationExpression(Type OpType, Expression *pLeftExpr, Exp
 
 OperationExpression::~OperationExpression(void)
 {
-  delete m_pLeftExpr;
-  delete m_pRightExpr;
+  Release(m_pLeftExpr);
+  Release(m_pRightExpr);
 }
 
 std::string OperationExpression::ToString(void) const
@@ -266,6 +366,11 @@ Expression *OperationExpression::Clone(void) const
   return new OperationExpression(static_cast<Type>(m_OpType), m_pLeftExpr->Clone(), m_pRightExpr->Clone());
 }
 
+Expression *OperationExpression::Clone(ExpressionArena& rArena) const
+{
+  return new (rArena) OperationExpression(static_cast<Type>(m_OpType), m_pLeftExpr->Clone(rArena), m_pRightExpr->Clone(rArena));
+}
+
 ConstantExpression::ConstantExpression(u32 ConstType, u64 Value)
   : m_ConstType(ConstType), m_Value(
     ConstType == ConstUnknownBit ||
@@ -297,6 +402,11 @@ Expression *ConstantExpression::Clone(void) const
   return new ConstantExpression(m_ConstType, m_Value);
 }
 
+Expression *ConstantExpression::Clone(ExpressionArena& rArena) const
+{
+  return new (rArena) ConstantExpression(m_ConstType, m_Value);
+}
+
 bool ConstantExpression::Read(CpuContext *pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt, u64& rValue, bool SignExtend) const
 {
   rValue = m_Value;
@@ -350,6 +460,11 @@ Expression *IdentifierExpression::Clone(void) const
   return new IdentifierExpression(m_Id, m_pCpuInfo);
 }
 
+Expression *IdentifierExpression::Clone(ExpressionArena& rArena) const
+{
+  return new (rArena) IdentifierExpression(m_Id, m_pCpuInfo);
+}
+
 u32 IdentifierExpression::GetSizeInBit(void) const
 {
   return m_pCpuInfo->GetSizeOfRegisterInBit(m_Id);
@@ -389,8 +504,8 @@ bool IdentifierExpression::GetAddress(CpuContext *pCpuCtxt, MemoryContext* pMemC
 
 MemoryExpression::~MemoryExpression(void)
 {
-  delete m_pExprBase;
-  delete m_pExprOffset;
+  Release(m_pExprBase);
+  Release(m_pExprOffset);
 }
 
 std::string MemoryExpression::ToString(void) const
@@ -410,6 +525,14 @@ Expression *MemoryExpression::Clone(void) const
   return new MemoryExpression(m_AccessSizeInBit, m_pExprBase->Clone(), m_pExprOffset->Clone(), m_Dereference);
 }
 
+Expression *MemoryExpression::Clone(ExpressionArena& rArena) const
+{
+  if (m_pExprBase == nullptr)
+    return new (rArena) MemoryExpression(m_AccessSizeInBit, nullptr, m_pExprOffset->Clone(rArena), m_Dereference);
+
+  return new (rArena) MemoryExpression(m_AccessSizeInBit, m_pExprBase->Clone(rArena), m_pExprOffset->Clone(rArena), m_Dereference);
+}
+
 u32 MemoryExpression::GetSizeInBit(void) const
 {
   return m_AccessSizeInBit;
@@ -474,6 +597,11 @@ Expression* VariableExpression::Clone(void) const
   return new VariableExpression(m_Type, m_Name);
 }
 
+Expression* VariableExpression::Clone(ExpressionArena& rArena) const
+{
+  return new (rArena) VariableExpression(m_Type, m_Name);
+}
+
 u32 VariableExpression::GetSizeInBit(void) const
 {
   return m_Type;
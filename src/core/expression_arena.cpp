@@ -0,0 +1,62 @@
+#include "medusa/expression_arena.hpp"
+
+#include <new>
+
+MEDUSA_NAMESPACE_BEGIN
+
+ExpressionArena::ExpressionArena(u32 ChunkSize)
+  : m_pChunks(nullptr), m_pCur(nullptr), m_pEnd(nullptr)
+  , m_ChunkSize(ChunkSize), m_UsedSize()
+{
+}
+
+ExpressionArena::~ExpressionArena(void)
+{
+  while (m_pChunks != nullptr)
+  {
+    auto pNext = m_pChunks->m_pNext;
+    ::operator delete(m_pChunks);
+    m_pChunks = pNext;
+  }
+}
+
+void ExpressionArena::Reset(void)
+{
+  if (m_pChunks == nullptr)
+    return;
+
+  // Only the last allocated chunk is kept, it's the head of the list
+  auto pCurChunk = m_pChunks->m_pNext;
+  while (pCurChunk != nullptr)
+  {
+    auto pNext = pCurChunk->m_pNext;
+    ::operator delete(pCurChunk);
+    pCurChunk = pNext;
+  }
+  m_pChunks->m_pNext = nullptr;
+
+  m_pCur     = reinterpret_cast<u8*>(m_pChunks) + sizeof(Chunk);
+  m_pEnd     = m_pCur + m_pChunks->m_Size;
+  m_UsedSize = 0;
+}
+
+void* ExpressionArena::AllocateSlow(size_t Size)
+{
+  // Large allocations get their own chunk
+  size_t ChunkSize = Size > m_ChunkSize ? Size : m_ChunkSize;
+
+  auto pChunk = static_cast<Chunk*>(::operator new(sizeof(Chunk) + ChunkSize));
+  pChunk->m_pNext = m_pChunks;
+  pChunk->m_Size  = ChunkSize;
+  m_pChunks = pChunk;
+
+  m_pCur = reinterpret_cast<u8*>(pChunk) + sizeof(Chunk);
+  m_pEnd = m_pCur + ChunkSize;
+
+  void* pMem = m_pCur;
+  m_pCur += Size;
+  m_UsedSize += Size;
+  return pMem;
+}
+
+MEDUSA_NAMESPACE_END
@@ -0,0 +1,459 @@
+#include "medusa/expression_factory.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <functional>
+
+MEDUSA_NAMESPACE_BEGIN
+
+bool ExpressionFacts::ReadsRegister(u32 Id) const
+{
+  return std::binary_search(std::begin(m_ReadRegisters), std::end(m_ReadRegisters), Id);
+}
+
+bool ExpressionFacts::WritesRegister(u32 Id) const
+{
+  return std::binary_search(std::begin(m_WrittenRegisters), std::end(m_WrittenRegisters), Id);
+}
+
+static void MergeRegisters(std::vector<u32>& rDst, std::vector<u32> const& rSrc)
+{
+  if (rSrc.empty())
+    return;
+  std::vector<u32> Result;
+  Result.reserve(rDst.size() + rSrc.size());
+  std::set_union(std::begin(rDst), std::end(rDst), std::begin(rSrc), std::end(rSrc), std::back_inserter(Result));
+  rDst.swap(Result);
+}
+
+static void MergeFacts(ExpressionFacts& rDst, ExpressionFacts const& rSrc)
+{
+  rDst.m_Flags |= rSrc.m_Flags;
+  MergeRegisters(rDst.m_ReadRegisters,    rSrc.m_ReadRegisters);
+  MergeRegisters(rDst.m_WrittenRegisters, rSrc.m_WrittenRegisters);
+}
+
+bool ExpressionFactory::Key::operator==(Key const& rKey) const
+{
+  return m_Kind     == rKey.m_Kind
+    &&   m_Type     == rKey.m_Type
+    &&   m_Value    == rKey.m_Value
+    &&   m_pCpuInfo == rKey.m_pCpuInfo
+    &&   m_SubExprs == rKey.m_SubExprs
+    &&   m_Name     == rKey.m_Name;
+}
+
+size_t ExpressionFactory::KeyHash::operator()(Key const& rKey) const
+{
+  // Sub-expressions are shared, so hashing their address is enough
+  size_t Hash = rKey.m_Kind;
+  auto Combine = [&Hash](size_t Value)
+  {
+    Hash ^= Value + 0x9e3779b9 + (Hash << 6) + (Hash >> 2);
+  };
+
+  Combine(rKey.m_Type);
+  Combine(std::hash<u64>()(rKey.m_Value));
+  Combine(std::hash<void const*>()(rKey.m_pCpuInfo));
+  for (auto itExpr = std::begin(rKey.m_SubExprs); itExpr != std::end(rKey.m_SubExprs); ++itExpr)
+    Combine(std::hash<void const*>()(*itExpr));
+  if (!rKey.m_Name.empty())
+    Combine(std::hash<std::string>()(rKey.m_Name));
+  return Hash;
+}
+
+// This visitor rebuilds an expression bottom-up with shared sub-expressions
+class ExpressionFactory::InternVisitor : public ExpressionVisitor
+{
+public:
+  InternVisitor(ExpressionFactory& rFactory) : m_rFactory(rFactory) {}
+
+  virtual Expression* VisitBind(Expression::List const& rExprList)
+  {
+    std::vector<Expression const*> SharedExprs;
+    m_rFactory.Intern(rExprList, SharedExprs);
+    return Shared(m_rFactory.MakeBind(SharedExprs));
+  }
+
+  virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+  {
+    return Shared(m_rFactory.MakeCondition(Type, m_rFactory.Intern(pRefExpr), m_rFactory.Intern(pTestExpr)));
+  }
+
+  virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+  {
+    return Shared(m_rFactory.MakeIfCondition(Type,
+      m_rFactory.Intern(pRefExpr), m_rFactory.Intern(pTestExpr), m_rFactory.Intern(pThenExpr)));
+  }
+
+  virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+  {
+    return Shared(m_rFactory.MakeIfElseCondition(Type,
+      m_rFactory.Intern(pRefExpr), m_rFactory.Intern(pTestExpr), m_rFactory.Intern(pThenExpr), m_rFactory.Intern(pElseExpr)));
+  }
+
+  virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+  {
+    return Shared(m_rFactory.MakeWhileCondition(Type,
+      m_rFactory.Intern(pRefExpr), m_rFactory.Intern(pTestExpr), m_rFactory.Intern(pBodyExpr)));
+  }
+
+  virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+  {
+    return Shared(m_rFactory.MakeOperation(Type, m_rFactory.Intern(pLeftExpr), m_rFactory.Intern(pRightExpr)));
+  }
+
+  virtual Expression* VisitConstant(u32 Type, u64 Value)
+  {
+    return Shared(m_rFactory.MakeConstant(Type, Value));
+  }
+
+  virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo)
+  {
+    return Shared(m_rFactory.MakeIdentifier(Id, pCpuInfo));
+  }
+
+  virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+  {
+    return Shared(m_rFactory.MakeMemory(AccessSizeInBit, m_rFactory.Intern(pBaseExpr), m_rFactory.Intern(pOffsetExpr), Deref));
+  }
+
+  virtual Expression* VisitVariable(u32 SizeInBit, std::string const& rName)
+  {
+    return Shared(m_rFactory.MakeVariable(SizeInBit, rName));
+  }
+
+private:
+  // Visit can't return a const expression
+  static Expression* Shared(Expression const* pExpr) { return const_cast<Expression*>(pExpr); }
+
+  ExpressionFactory& m_rFactory;
+};
+
+ExpressionFactory::ExpressionFactory(void)
+  : m_Arena(0x4000)
+{
+}
+
+ExpressionFactory::~ExpressionFactory(void)
+{
+  // Sub-expressions are shared, so destructors don't release them
+  for (auto itEntry = m_Entries.rbegin(); itEntry != m_Entries.rend(); ++itEntry)
+  {
+    (*itEntry)->m_pExpr->~Expression();
+    delete *itEntry;
+  }
+}
+
+Expression const* ExpressionFactory::MakeBind(std::vector<Expression const*> const& rExprs)
+{
+  Key BindKey;
+  BindKey.m_Kind     = BindKind;
+  BindKey.m_SubExprs = rExprs;
+  return Insert(BindKey);
+}
+
+Expression const* ExpressionFactory::MakeCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+{
+  Key CondKey;
+  CondKey.m_Kind = ConditionKind;
+  CondKey.m_Type = Type;
+  CondKey.m_SubExprs.reserve(2);
+  CondKey.m_SubExprs.push_back(pRefExpr);
+  CondKey.m_SubExprs.push_back(pTestExpr);
+  return Insert(CondKey);
+}
+
+Expression const* ExpressionFactory::MakeIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+{
+  Key CondKey;
+  CondKey.m_Kind = IfConditionKind;
+  CondKey.m_Type = Type;
+  CondKey.m_SubExprs.reserve(3);
+  CondKey.m_SubExprs.push_back(pRefExpr);
+  CondKey.m_SubExprs.push_back(pTestExpr);
+  CondKey.m_SubExprs.push_back(pThenExpr);
+  return Insert(CondKey);
+}
+
+Expression const* ExpressionFactory::MakeIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+{
+  Key CondKey;
+  CondKey.m_Kind = IfElseConditionKind;
+  CondKey.m_Type = Type;
+  CondKey.m_SubExprs.reserve(4);
+  CondKey.m_SubExprs.push_back(pRefExpr);
+  CondKey.m_SubExprs.push_back(pTestExpr);
+  CondKey.m_SubExprs.push_back(pThenExpr);
+  CondKey.m_SubExprs.push_back(pElseExpr);
+  return Insert(CondKey);
+}
+
+Expression const* ExpressionFactory::MakeWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+{
+  Key CondKey;
+  CondKey.m_Kind = WhileConditionKind;
+  CondKey.m_Type = Type;
+  CondKey.m_SubExprs.reserve(3);
+  CondKey.m_SubExprs.push_back(pRefExpr);
+  CondKey.m_SubExprs.push_back(pTestExpr);
+  CondKey.m_SubExprs.push_back(pBodyExpr);
+  return Insert(CondKey);
+}
+
+Expression const* ExpressionFactory::MakeOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+{
+  Key OpKey;
+  OpKey.m_Kind = OperationKind;
+  OpKey.m_Type = Type;
+  OpKey.m_SubExprs.reserve(2);
+  OpKey.m_SubExprs.push_back(pLeftExpr);
+  OpKey.m_SubExprs.push_back(pRightExpr);
+  return Insert(OpKey);
+}
+
+Expression const* ExpressionFactory::MakeConstant(u32 Type, u64 Value)
+{
+  // Keep the value as ConstantExpression stores it, so equal constants share the same key
+  if (Type != ConstantExpression::ConstUnknownBit && Type < ConstantExpression::Const64Bit)
+    Value &= (1ULL << Type) - 1;
+
+  Key ConstKey;
+  ConstKey.m_Kind  = ConstantKind;
+  ConstKey.m_Type  = Type;
+  ConstKey.m_Value = Value;
+  return Insert(ConstKey);
+}
+
+Expression const* ExpressionFactory::MakeIdentifier(u32 Id, CpuInformation const* pCpuInfo)
+{
+  Key IdKey;
+  IdKey.m_Kind     = IdentifierKind;
+  IdKey.m_Type     = Id;
+  IdKey.m_pCpuInfo = pCpuInfo;
+  return Insert(IdKey);
+}
+
+Expression const* ExpressionFactory::MakeMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+{
+  Key MemKey;
+  MemKey.m_Kind  = MemoryKind;
+  MemKey.m_Type  = AccessSizeInBit;
+  MemKey.m_Value = Deref ? 1 : 0;
+  MemKey.m_SubExprs.reserve(2);
+  MemKey.m_SubExprs.push_back(pBaseExpr);
+  MemKey.m_SubExprs.push_back(pOffsetExpr);
+  return Insert(MemKey);
+}
+
+Expression const* ExpressionFactory::MakeVariable(u32 Type, std::string const& rName)
+{
+  Key VarKey;
+  VarKey.m_Kind = VariableKind;
+  VarKey.m_Type = Type;
+  VarKey.m_Name = rName;
+  return Insert(VarKey);
+}
+
+Expression const* ExpressionFactory::Intern(Expression const* pExpr)
+{
+  if (pExpr == nullptr)
+    return nullptr;
+
+  if (pExpr->IsShared())
+  {
+    std::lock_guard<std::recursive_mutex> Lock(m_Mutex);
+    if (m_Facts.find(pExpr) != std::end(m_Facts))
+      return pExpr;
+  }
+
+  InternVisitor Visitor(*this);
+  return pExpr->Visit(&Visitor);
+}
+
+void ExpressionFactory::Intern(Expression::List const& rExprList, std::vector<Expression const*>& rSharedExprs)
+{
+  rSharedExprs.reserve(rSharedExprs.size() + rExprList.size());
+  for (auto itExpr = std::begin(rExprList); itExpr != std::end(rExprList); ++itExpr)
+    rSharedExprs.push_back(Intern(*itExpr));
+}
+
+ExpressionFacts const& ExpressionFactory::GetFacts(Expression const* pExpr) const
+{
+  return GetEntry(pExpr).m_Facts;
+}
+
+size_t ExpressionFactory::GetExpressionCount(void) const
+{
+  std::lock_guard<std::recursive_mutex> Lock(m_Mutex);
+  return m_Entries.size();
+}
+
+Expression const* ExpressionFactory::Insert(Key const& rKey)
+{
+  std::lock_guard<std::recursive_mutex> Lock(m_Mutex);
+
+  auto itExpr = m_Expressions.find(rKey);
+  if (itExpr != std::end(m_Expressions))
+    return itExpr->second->m_pExpr;
+
+  auto pEntry = new Entry;
+  pEntry->m_Key   = rKey;
+  pEntry->m_pExpr = Build(rKey);
+  ComputeFacts(rKey, pEntry->m_Facts);
+  Expression::MarkAsShared(pEntry->m_pExpr);
+
+  m_Expressions[rKey] = pEntry;
+  m_Facts[pEntry->m_pExpr] = pEntry;
+  m_Entries.push_back(pEntry);
+  return pEntry->m_pExpr;
+}
+
+Expression* ExpressionFactory::Build(Key const& rKey)
+{
+  auto const& rSubExprs = rKey.m_SubExprs;
+  auto SubExpr = [&rSubExprs](size_t Idx) { return const_cast<Expression*>(rSubExprs[Idx]); };
+
+  switch (rKey.m_Kind)
+  {
+  case BindKind:
+    {
+      Expression::List Exprs;
+      for (size_t Idx = 0; Idx < rSubExprs.size(); ++Idx)
+        Exprs.push_back(SubExpr(Idx));
+      return new (m_Arena) BindExpression(Exprs);
+    }
+
+  case ConditionKind:
+    return new (m_Arena) ConditionExpression(static_cast<ConditionExpression::Type>(rKey.m_Type), SubExpr(0), SubExpr(1));
+
+  case IfConditionKind:
+    return new (m_Arena) IfConditionExpression(static_cast<ConditionExpression::Type>(rKey.m_Type), SubExpr(0), SubExpr(1), SubExpr(2));
+
+  case IfElseConditionKind:
+    return new (m_Arena) IfElseConditionExpression(static_cast<ConditionExpression::Type>(rKey.m_Type), SubExpr(0), SubExpr(1), SubExpr(2), SubExpr(3));
+
+  case WhileConditionKind:
+    return new (m_Arena) WhileConditionExpression(static_cast<ConditionExpression::Type>(rKey.m_Type), SubExpr(0), SubExpr(1), SubExpr(2));
+
+  case OperationKind:
+    return new (m_Arena) OperationExpression(static_cast<OperationExpression::Type>(rKey.m_Type), SubExpr(0), SubExpr(1));
+
+  case ConstantKind:
+    return new (m_Arena) ConstantExpression(rKey.m_Type, rKey.m_Value);
+
+  case IdentifierKind:
+    return new (m_Arena) IdentifierExpression(rKey.m_Type, static_cast<CpuInformation const*>(rKey.m_pCpuInfo));
+
+  case MemoryKind:
+    return new (m_Arena) MemoryExpression(rKey.m_Type, SubExpr(0), SubExpr(1), rKey.m_Value != 0);
+
+  case VariableKind:
+    return new (m_Arena) VariableExpression(rKey.m_Type, rKey.m_Name);
+
+  default:
+    assert(0 && "Unknown expression kind");
+    return nullptr;
+  }
+}
+
+ExpressionFactory::Entry const& ExpressionFactory::GetEntry(Expression const* pExpr) const
+{
+  std::lock_guard<std::recursive_mutex> Lock(m_Mutex);
+  auto itEntry = m_Facts.find(pExpr);
+  assert(itEntry != std::end(m_Facts) && "Expression doesn't belong to this factory");
+  return *itEntry->second;
+}
+
+void ExpressionFactory::ComputeFacts(Key const& rKey, ExpressionFacts& rFacts) const
+{
+  auto const& rSubExprs = rKey.m_SubExprs;
+
+  switch (rKey.m_Kind)
+  {
+  case IdentifierKind:
+    rFacts.m_ReadRegisters.push_back(rKey.m_Type);
+    return;
+
+  case VariableKind:
+    rFacts.m_Flags |= ExpressionFacts::ReadVariable;
+    return;
+
+  case ConstantKind:
+    return;
+
+  case MemoryKind:
+    if (rSubExprs[0] != nullptr)
+      MergeFacts(rFacts, GetFacts(rSubExprs[0]));
+    MergeFacts(rFacts, GetFacts(rSubExprs[1]));
+    if (rKey.m_Value != 0)
+      rFacts.m_Flags |= ExpressionFacts::ReadMemory;
+    return;
+
+  case OperationKind:
+    if (rKey.m_Type == OperationExpression::OpAff)
+    {
+      AddWriteFacts(rSubExprs[0], rFacts);
+      MergeFacts(rFacts, GetFacts(rSubExprs[1]));
+      return;
+    }
+    if (rKey.m_Type == OperationExpression::OpXchg)
+    {
+      AddWriteFacts(rSubExprs[0], rFacts);
+      AddWriteFacts(rSubExprs[1], rFacts);
+    }
+    break;
+
+  case ConditionKind:
+  case IfConditionKind:
+  case IfElseConditionKind:
+    rFacts.m_Flags |= ExpressionFacts::Conditional;
+    break;
+
+  case WhileConditionKind:
+    rFacts.m_Flags |= ExpressionFacts::Conditional | ExpressionFacts::Loop;
+    break;
+
+  default:
+    break;
+  }
+
+  for (auto itExpr = std::begin(rSubExprs); itExpr != std::end(rSubExprs); ++itExpr)
+    if (*itExpr != nullptr)
+      MergeFacts(rFacts, GetFacts(*itExpr));
+}
+
+void ExpressionFactory::AddWriteFacts(Expression const* pDstExpr, ExpressionFacts& rFacts) const
+{
+  auto const& rDstEntry = GetEntry(pDstExpr);
+  auto const& rDstKey   = rDstEntry.m_Key;
+
+  switch (rDstKey.m_Kind)
+  {
+  case IdentifierKind:
+    {
+      std::vector<u32> WrittenRegister(1, rDstKey.m_Type);
+      MergeRegisters(rFacts.m_WrittenRegisters, WrittenRegister);
+    }
+    break;
+
+  case VariableKind:
+    rFacts.m_Flags |= ExpressionFacts::WriteVariable;
+    break;
+
+  case MemoryKind:
+    // Only the address is read
+    if (rDstKey.m_SubExprs[0] != nullptr)
+      MergeFacts(rFacts, GetFacts(rDstKey.m_SubExprs[0]));
+    MergeFacts(rFacts, GetFacts(rDstKey.m_SubExprs[1]));
+    if (rDstKey.m_Value != 0)
+      rFacts.m_Flags |= ExpressionFacts::WriteMemory;
+    break;
+
+  default:
+    MergeFacts(rFacts, rDstEntry.m_Facts);
+    break;
+  }
+}
+
+MEDUSA_NAMESPACE_END
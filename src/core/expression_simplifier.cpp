@@ -0,0 +1,728 @@
+#include "medusa/expression_simplifier.hpp"
+
+#include <vector>
+
+MEDUSA_NAMESPACE_BEGIN
+
+// Conditions are evaluated like the interpreter does, both sides are compared on 64-bit
+static bool EvaluateCondition(u32 Type, u64 Ref, u64 Test, bool& rCond)
+{
+  s64 SignedRef = static_cast<s64>(Ref), SignedTest = static_cast<s64>(Test);
+  switch (Type)
+  {
+  case ConditionExpression::CondEq:  rCond = Ref == Test;              break;
+  case ConditionExpression::CondNe:  rCond = Ref != Test;              break;
+  case ConditionExpression::CondUgt: rCond = Ref >  Test;              break;
+  case ConditionExpression::CondUge: rCond = Ref >= Test;              break;
+  case ConditionExpression::CondUlt: rCond = Ref <  Test;              break;
+  case ConditionExpression::CondUle: rCond = Ref <= Test;              break;
+  case ConditionExpression::CondSgt: rCond = SignedRef >  SignedTest;  break;
+  case ConditionExpression::CondSge: rCond = SignedRef >= SignedTest;  break;
+  case ConditionExpression::CondSlt: rCond = SignedRef <  SignedTest;  break;
+  case ConditionExpression::CondSle: rCond = SignedRef <= SignedTest;  break;
+  default: return false;
+  }
+  return true;
+}
+
+static u64 GetSizeMask(u32 SizeInBit)
+{
+  if (SizeInBit == 0 || SizeInBit >= 64)
+    return ~0ULL;
+  return (1ULL << SizeInBit) - 1;
+}
+
+// This visitor collects registers read by an expression, a test like (id & mask) only reads the masked bits
+class ExpressionSimplifier::ReadVisitor : public ExpressionVisitor
+{
+public:
+  typedef std::vector<std::pair<u32, u64>> ReadList;
+
+  ReadVisitor(ReadList& rReads) : m_rReads(rReads), m_AccessMemory(false) {}
+
+  bool AccessMemory(void) const { return m_AccessMemory; }
+
+  virtual Expression* VisitBind(Expression::List const& rExprList)
+  {
+    for (auto itExpr = std::begin(rExprList); itExpr != std::end(rExprList); ++itExpr)
+      (*itExpr)->Visit(this);
+    return nullptr;
+  }
+
+  virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+  {
+    pRefExpr->Visit(this);
+    pTestExpr->Visit(this);
+    return nullptr;
+  }
+
+  virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+  {
+    VisitCondition(Type, pRefExpr, pTestExpr);
+    pThenExpr->Visit(this);
+    return nullptr;
+  }
+
+  virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+  {
+    VisitCondition(Type, pRefExpr, pTestExpr);
+    pThenExpr->Visit(this);
+    pElseExpr->Visit(this);
+    return nullptr;
+  }
+
+  virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+  {
+    VisitCondition(Type, pRefExpr, pTestExpr);
+    pBodyExpr->Visit(this);
+    return nullptr;
+  }
+
+  virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+  {
+    if (Type == OperationExpression::OpAnd)
+    {
+      auto pIdExpr    = dynamic_cast<IdentifierExpression const*>(pLeftExpr);
+      auto pConstExpr = dynamic_cast<ConstantExpression const*>(pRightExpr);
+      if (pIdExpr != nullptr && pConstExpr != nullptr)
+      {
+        m_rReads.push_back(std::make_pair(pIdExpr->GetId(), pConstExpr->GetConstant()));
+        return nullptr;
+      }
+    }
+
+    pLeftExpr->Visit(this);
+    pRightExpr->Visit(this);
+    return nullptr;
+  }
+
+  virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo)
+  {
+    m_rReads.push_back(std::make_pair(Id, ~0ULL));
+    return nullptr;
+  }
+
+  virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+  {
+    if (Deref)
+      m_AccessMemory = true;
+    if (pBaseExpr != nullptr)
+      pBaseExpr->Visit(this);
+    pOffsetExpr->Visit(this);
+    return nullptr;
+  }
+
+private:
+  ReadList& m_rReads;
+  bool      m_AccessMemory;
+};
+
+// This visitor returns a simplified copy of the visited expression
+class ExpressionSimplifier::SimplifyVisitor : public ExpressionVisitor
+{
+public:
+  SimplifyVisitor(ExpressionArena& rArena, u32 Passes) : m_rArena(rArena), m_Passes(Passes) {}
+
+  virtual Expression* VisitBind(Expression::List const& rExprList)
+  {
+    Expression::List SmplExprList;
+    for (auto itExpr = std::begin(rExprList); itExpr != std::end(rExprList); ++itExpr)
+      SmplExprList.push_back((*itExpr)->Visit(this));
+    return new (m_rArena) BindExpression(SmplExprList);
+  }
+
+  virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+  {
+    auto pRef  = pRefExpr->Visit(this);
+    auto pTest = pTestExpr->Visit(this);
+
+    bool Cond;
+    if (FoldCondition(Type, pRef, pTest, Cond))
+    {
+      delete pRef;
+      delete pTest;
+      return new (m_rArena) ConstantExpression(ConstantExpression::Const1Bit, Cond);
+    }
+
+    return new (m_rArena) ConditionExpression(static_cast<ConditionExpression::Type>(Type), pRef, pTest);
+  }
+
+  virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+  {
+    auto pRef  = pRefExpr->Visit(this);
+    auto pTest = pTestExpr->Visit(this);
+
+    bool Cond;
+    if (FoldCondition(Type, pRef, pTest, Cond))
+    {
+      delete pRef;
+      delete pTest;
+      if (Cond)
+        return pThenExpr->Visit(this);
+      return new (m_rArena) ConstantExpression(ConstantExpression::Const1Bit, 0);
+    }
+
+    return new (m_rArena) IfConditionExpression(static_cast<ConditionExpression::Type>(Type), pRef, pTest, pThenExpr->Visit(this));
+  }
+
+  virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+  {
+    auto pRef  = pRefExpr->Visit(this);
+    auto pTest = pTestExpr->Visit(this);
+
+    bool Cond;
+    if (FoldCondition(Type, pRef, pTest, Cond))
+    {
+      delete pRef;
+      delete pTest;
+      return Cond ? pThenExpr->Visit(this) : pElseExpr->Visit(this);
+    }
+
+    return new (m_rArena) IfElseConditionExpression(static_cast<ConditionExpression::Type>(Type), pRef, pTest,
+      pThenExpr->Visit(this), pElseExpr->Visit(this));
+  }
+
+  // The interpreter fails on a false loop condition, so loops are never folded
+  virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+  {
+    return new (m_rArena) WhileConditionExpression(static_cast<ConditionExpression::Type>(Type),
+      pRefExpr->Visit(this), pTestExpr->Visit(this), pBodyExpr->Visit(this));
+  }
+
+  virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+  {
+    auto pLeft  = pLeftExpr->Visit(this);
+    auto pRight = pRightExpr->Visit(this);
+
+    switch (Type)
+    {
+    case OperationExpression::OpAff:
+    case OperationExpression::OpXchg:
+    case OperationExpression::OpSext:
+    case OperationExpression::OpUnk:
+      break;
+
+    default:
+      {
+        Expression* pSmplExpr = nullptr;
+        if (m_Passes & ExpressionSimplifier::ConstantFolding)
+          pSmplExpr = FoldOperation(Type, pLeft, pRight);
+        if (pSmplExpr == nullptr && (m_Passes & ExpressionSimplifier::AlgebraicSimplification))
+          pSmplExpr = SimplifyOperation(Type, pLeft, pRight);
+        if (pSmplExpr != nullptr)
+          return pSmplExpr;
+      }
+      break;
+    }
+
+    return new (m_rArena) OperationExpression(static_cast<OperationExpression::Type>(Type), pLeft, pRight);
+  }
+
+  virtual Expression* VisitConstant(u32 Type, u64 Value)
+  {
+    return new (m_rArena) ConstantExpression(Type, Value);
+  }
+
+  virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo)
+  {
+    return new (m_rArena) IdentifierExpression(Id, pCpuInfo);
+  }
+
+  virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+  {
+    Expression* pBase = nullptr;
+    if (pBaseExpr != nullptr)
+      pBase = pBaseExpr->Visit(this);
+    return new (m_rArena) MemoryExpression(AccessSizeInBit, pBase, pOffsetExpr->Visit(this), Deref);
+  }
+
+  virtual Expression* VisitVariable(u32 SizeInBit, std::string const& rName)
+  {
+    return new (m_rArena) VariableExpression(SizeInBit, rName);
+  }
+
+private:
+  bool FoldCondition(u32 Type, Expression const* pRef, Expression const* pTest, bool& rCond) const
+  {
+    if (!(m_Passes & ExpressionSimplifier::ConstantFolding))
+      return false;
+
+    auto pRefConst  = dynamic_cast<ConstantExpression const*>(pRef);
+    auto pTestConst = dynamic_cast<ConstantExpression const*>(pTest);
+    if (pRefConst == nullptr || pTestConst == nullptr)
+      return false;
+
+    return EvaluateCondition(Type, pRefConst->GetConstant(), pTestConst->GetConstant(), rCond);
+  }
+
+  Expression* FoldOperation(u32 Type, Expression* pLeft, Expression* pRight)
+  {
+    auto pLeftConst  = dynamic_cast<ConstantExpression const*>(pLeft);
+    auto pRightConst = dynamic_cast<ConstantExpression const*>(pRight);
+    if (pLeftConst == nullptr || pRightConst == nullptr)
+      return nullptr;
+
+    u64 Left = pLeftConst->GetConstant(), Right = pRightConst->GetConstant();
+    switch (Type)
+    {
+    case OperationExpression::OpAdd: Left += Right; break;
+    case OperationExpression::OpSub: Left -= Right; break;
+    case OperationExpression::OpMul: Left *= Right; break;
+    case OperationExpression::OpUDiv:
+    case OperationExpression::OpSDiv:
+      if (Right == 0)
+        return nullptr;
+      Left /= Right;
+      break;
+    case OperationExpression::OpAnd: Left &= Right; break;
+    case OperationExpression::OpOr:  Left |= Right; break;
+    case OperationExpression::OpXor: Left ^= Right; break;
+    case OperationExpression::OpLls:
+      if (Right >= 64)
+        return nullptr;
+      Left <<= Right;
+      break;
+    case OperationExpression::OpLrs:
+      if (Right >= 64)
+        return nullptr;
+      Left >>= Right;
+      break;
+    case OperationExpression::OpArs:
+      if (Right >= 64)
+        return nullptr;
+      Left = static_cast<s64>(Left) >> Right;
+      break;
+    default:
+      return nullptr;
+    }
+
+    u32 Bit = pLeftConst->GetSizeInBit();
+    delete pLeft;
+    delete pRight;
+    return new (m_rArena) ConstantExpression(Bit, Left);
+  }
+
+  Expression* SimplifyOperation(u32 Type, Expression* pLeft, Expression* pRight)
+  {
+    auto pLeftConst  = dynamic_cast<ConstantExpression const*>(pLeft);
+    auto pRightConst = dynamic_cast<ConstantExpression const*>(pRight);
+
+    // x op c
+    if (pRightConst != nullptr && pLeftConst == nullptr)
+    {
+      u64 Right = pRightConst->GetConstant();
+      u32 LeftBit = GetKnownSizeInBit(pLeft);
+
+      if (Right == 0)
+        switch (Type)
+        {
+        case OperationExpression::OpAdd: case OperationExpression::OpSub:
+        case OperationExpression::OpOr:  case OperationExpression::OpXor:
+        case OperationExpression::OpLls: case OperationExpression::OpLrs:
+        case OperationExpression::OpArs:
+          return KeepOperand(pLeft, pRight);
+
+        case OperationExpression::OpAnd: case OperationExpression::OpMul:
+          if (LeftBit != 0 && !AccessMemory(pLeft))
+            return ReplaceByConstant(pLeft, pRight, LeftBit, 0);
+          break;
+
+        default:
+          break;
+        }
+
+      if (Right == 1)
+        switch (Type)
+        {
+        case OperationExpression::OpMul: case OperationExpression::OpUDiv:
+        case OperationExpression::OpSDiv:
+          return KeepOperand(pLeft, pRight);
+
+        default:
+          break;
+        }
+
+      if (Type == OperationExpression::OpAnd && LeftBit != 0 && (Right & GetSizeMask(LeftBit)) == GetSizeMask(LeftBit))
+        return KeepOperand(pLeft, pRight);
+
+      return nullptr;
+    }
+
+    // c op x, only for commutative operations which keep the size
+    if (pLeftConst != nullptr && pRightConst == nullptr)
+    {
+      u64 Left = pLeftConst->GetConstant();
+      u32 RightBit = GetKnownSizeInBit(pRight);
+      if (RightBit == 0 || RightBit != pLeftConst->GetSizeInBit())
+        return nullptr;
+
+      bool IsNeutral = false;
+      switch (Type)
+      {
+      case OperationExpression::OpAdd: case OperationExpression::OpOr:
+      case OperationExpression::OpXor: IsNeutral = (Left == 0);                      break;
+      case OperationExpression::OpMul: IsNeutral = (Left == 1);                      break;
+      case OperationExpression::OpAnd: IsNeutral = (Left == GetSizeMask(RightBit));  break;
+      default:                                                                       break;
+      }
+      if (IsNeutral)
+        return KeepOperand(pRight, pLeft);
+      return nullptr;
+    }
+
+    // x ^ x, x - x
+    if (Type == OperationExpression::OpXor || Type == OperationExpression::OpSub)
+    {
+      auto pLeftId  = dynamic_cast<IdentifierExpression const*>(pLeft);
+      auto pRightId = dynamic_cast<IdentifierExpression const*>(pRight);
+      if (pLeftId != nullptr && pRightId != nullptr && pLeftId->GetId() == pRightId->GetId())
+        return ReplaceByConstant(pLeft, pRight, pLeftId->GetSizeInBit(), 0);
+    }
+
+    return nullptr;
+  }
+
+  static u32 GetKnownSizeInBit(Expression const* pExpr)
+  {
+    // Operations don't know their size, it depends on the evaluated operands
+    if (dynamic_cast<ContextExpression const*>(pExpr) == nullptr)
+      return 0;
+    return pExpr->GetSizeInBit();
+  }
+
+  static bool AccessMemory(Expression const* pExpr)
+  {
+    ReadVisitor::ReadList Reads;
+    ReadVisitor Visitor(Reads);
+    pExpr->Visit(&Visitor);
+    return Visitor.AccessMemory();
+  }
+
+  Expression* KeepOperand(Expression* pKeptExpr, Expression* pDroppedExpr)
+  {
+    // A memory operand triggers read hooks
+    if (dynamic_cast<MemoryExpression const*>(pDroppedExpr) != nullptr)
+      return nullptr;
+    delete pDroppedExpr;
+    return pKeptExpr;
+  }
+
+  Expression* ReplaceByConstant(Expression* pLeft, Expression* pRight, u32 Bit, u64 Value)
+  {
+    if (Bit == 0 || AccessMemory(pLeft) || AccessMemory(pRight))
+      return nullptr;
+    delete pLeft;
+    delete pRight;
+    return new (m_rArena) ConstantExpression(Bit, Value);
+  }
+
+  ExpressionArena& m_rArena;
+  u32              m_Passes;
+};
+
+namespace
+{
+
+// This visitor returns the statements of a top-level bind
+class FlattenVisitor : public ExpressionVisitor
+{
+public:
+  FlattenVisitor(void) : m_IsBind(false), m_pExprList(nullptr) {}
+
+  virtual Expression* VisitBind(Expression::List const& rExprList)
+  {
+    m_IsBind    = true;
+    m_pExprList = &rExprList;
+    return nullptr;
+  }
+
+  bool                    m_IsBind;
+  Expression::List const* m_pExprList;
+};
+
+}
+
+struct ExpressionSimplifier::StatementInformation
+{
+  StatementInformation(void)
+    : m_WrittenId(CpuInformation::InvalidRegister), m_WrittenMask(), m_PartialMask()
+    , m_Removable(false) {}
+
+  u32                   m_WrittenId;   //! Register written by the statement
+  u64                   m_WrittenMask; //! Bits always written
+  u64                   m_PartialMask; //! Bits which could be written
+  ReadVisitor::ReadList m_Reads;
+  bool                  m_Removable;
+};
+
+Expression* ExpressionSimplifier::Simplify(Expression const* pExpr, ExpressionArena& rArena) const
+{
+  if (m_Passes == 0)
+    return pExpr->Clone(rArena);
+
+  SimplifyVisitor Visitor(rArena, m_Passes);
+  return pExpr->Visit(&Visitor);
+}
+
+void ExpressionSimplifier::Simplify(Expression const* pExpr, Expression::List& rStmts, ExpressionArena& rArena) const
+{
+  if (m_Passes == 0)
+  {
+    rStmts.push_back(pExpr->Clone(rArena));
+    return;
+  }
+
+  FlattenVisitor Flatten;
+  pExpr->Visit(&Flatten);
+  if (Flatten.m_IsBind)
+  {
+    for (auto itExpr = std::begin(*Flatten.m_pExprList); itExpr != std::end(*Flatten.m_pExprList); ++itExpr)
+      Simplify(*itExpr, rStmts, rArena);
+    return;
+  }
+
+  auto pSmplExpr = Simplify(pExpr, rArena);
+
+  // A constant is what remains of a folded condition
+  if ((m_Passes & ConstantFolding) && dynamic_cast<ConstantExpression const*>(pSmplExpr) != nullptr)
+  {
+    delete pSmplExpr;
+    return;
+  }
+
+  if (m_Passes & IdentityElimination)
+  {
+    auto pOpExpr = dynamic_cast<OperationExpression const*>(pSmplExpr);
+    if (pOpExpr != nullptr && pOpExpr->GetOperation() == OperationExpression::OpAff)
+    {
+      auto pDstId = dynamic_cast<IdentifierExpression const*>(pOpExpr->GetLeftExpression());
+      auto pSrcId = dynamic_cast<IdentifierExpression const*>(pOpExpr->GetRightExpression());
+      if (pDstId != nullptr && pSrcId != nullptr && pDstId->GetId() == pSrcId->GetId())
+      {
+        delete pSmplExpr;
+        return;
+      }
+    }
+  }
+
+  // Simplification could have produced a bind, e.g. a folded if/else
+  Flatten.m_IsBind = false;
+  pSmplExpr->Visit(&Flatten);
+  if (Flatten.m_IsBind)
+  {
+    for (auto itExpr = std::begin(*Flatten.m_pExprList); itExpr != std::end(*Flatten.m_pExprList); ++itExpr)
+      Simplify(*itExpr, rStmts, rArena);
+    delete pSmplExpr;
+    return;
+  }
+
+  rStmts.push_back(pSmplExpr);
+}
+
+u32 ExpressionSimplifier::EliminateDeadAssignments(Expression::List& rStmts) const
+{
+  if (!(m_Passes & DeadAssignmentElimination) || m_pCpuInfo == nullptr)
+    return 0;
+
+  // Bits of registers which are overwritten before being read, relative to the current statement
+  typedef std::vector<std::pair<u32, u64>> DeadBitsList;
+  DeadBitsList DeadBits;
+  u32 RemovedCount = 0;
+
+  auto itStmt = rStmts.end();
+  while (itStmt != rStmts.begin())
+  {
+    --itStmt;
+
+    StatementInformation Info;
+    AnalyzeStatement(*itStmt, Info);
+
+    u64 WrittenBits = Info.m_WrittenMask | Info.m_PartialMask;
+    if (Info.m_Removable && WrittenBits != 0)
+    {
+      bool IsDead = false;
+      for (auto itDead = std::begin(DeadBits); itDead != std::end(DeadBits); ++itDead)
+      {
+        if (itDead->first == Info.m_WrittenId)
+        {
+          if ((itDead->second & WrittenBits) == WrittenBits)
+            IsDead = true;
+        }
+        // A fully overwritten register covers its sub-registers
+        else if (itDead->second == GetRegisterMask(itDead->first)
+          && IsSubRegister(itDead->first, Info.m_WrittenId))
+          IsDead = true;
+
+        if (IsDead)
+          break;
+      }
+
+      if (IsDead)
+      {
+        Expression::Release(*itStmt);
+        itStmt = rStmts.erase(itStmt);
+        ++RemovedCount;
+        continue;
+      }
+    }
+
+    if (Info.m_WrittenMask != 0)
+    {
+      auto itDead = std::begin(DeadBits);
+      for (; itDead != std::end(DeadBits); ++itDead)
+        if (itDead->first == Info.m_WrittenId)
+          break;
+      if (itDead == std::end(DeadBits))
+        DeadBits.push_back(std::make_pair(Info.m_WrittenId, Info.m_WrittenMask));
+      else
+        itDead->second |= Info.m_WrittenMask;
+    }
+
+    for (auto itRead = std::begin(Info.m_Reads); itRead != std::end(Info.m_Reads); ++itRead)
+      for (auto itDead = std::begin(DeadBits); itDead != std::end(DeadBits); ++itDead)
+      {
+        if (itDead->first == itRead->first)
+          itDead->second &= ~itRead->second;
+        // Reading an aliased register reads the dead one, e.g. x86 flags are computed from the lazy flags registers
+        else if (itDead->second != 0 && m_pCpuInfo->IsRegisterAliased(itDead->first, itRead->first))
+          itDead->second = 0;
+      }
+  }
+
+  return RemovedCount;
+}
+
+namespace
+{
+
+// This visitor recognizes register writes: id = expr, id = id | mask, id = id & mask
+// and if/else statements whose both branches write the same register
+class AnalyzeVisitor : public ExpressionVisitor
+{
+public:
+  AnalyzeVisitor(void)
+    : m_Handled(false), m_pDstId(nullptr), m_pSrcExpr(nullptr)
+    , m_pRefExpr(nullptr), m_pTestExpr(nullptr), m_pThenExpr(nullptr), m_pElseExpr(nullptr) {}
+
+  virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+  {
+    if (Type != OperationExpression::OpAff)
+      return nullptr;
+    auto pDstId = dynamic_cast<IdentifierExpression const*>(pLeftExpr);
+    if (pDstId == nullptr)
+      return nullptr;
+
+    m_Handled  = true;
+    m_pDstId   = pDstId;
+    m_pSrcExpr = pRightExpr;
+    return nullptr;
+  }
+
+  virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+  {
+    m_Handled   = true;
+    m_pDstId    = nullptr;
+    m_pRefExpr  = pRefExpr;
+    m_pTestExpr = pTestExpr;
+    m_pThenExpr = pThenExpr;
+    m_pElseExpr = pElseExpr;
+    return nullptr;
+  }
+
+  bool                        m_Handled;
+  IdentifierExpression const* m_pDstId;
+  Expression const*           m_pSrcExpr;
+  Expression const*           m_pRefExpr;
+  Expression const*           m_pTestExpr;
+  Expression const*           m_pThenExpr;
+  Expression const*           m_pElseExpr;
+};
+
+}
+
+void ExpressionSimplifier::AnalyzeStatement(Expression const* pStmt, StatementInformation& rInfo) const
+{
+  AnalyzeVisitor Analyze;
+  pStmt->Visit(&Analyze);
+
+  if (Analyze.m_Handled && Analyze.m_pDstId != nullptr)
+  {
+    u32 Id = Analyze.m_pDstId->GetId();
+    rInfo.m_WrittenId = Id;
+
+    // id = id | mask or id = id & mask only write the masked bits
+    auto pOpExpr = dynamic_cast<OperationExpression const*>(Analyze.m_pSrcExpr);
+    if (pOpExpr != nullptr && (pOpExpr->GetOperation() == OperationExpression::OpOr || pOpExpr->GetOperation() == OperationExpression::OpAnd))
+    {
+      auto pSrcId    = dynamic_cast<IdentifierExpression const*>(pOpExpr->GetLeftExpression());
+      auto pMaskExpr = dynamic_cast<ConstantExpression const*>(pOpExpr->GetRightExpression());
+      if (pSrcId != nullptr && pMaskExpr != nullptr && pSrcId->GetId() == Id)
+      {
+        u64 Mask = pMaskExpr->GetConstant();
+        if (pOpExpr->GetOperation() == OperationExpression::OpAnd)
+          Mask = ~Mask;
+        rInfo.m_WrittenMask = Mask & GetRegisterMask(Id);
+        rInfo.m_Removable   = true;
+        // The other bits are read back, they can be computed from aliased registers (e.g. x86 lazy flags)
+        rInfo.m_Reads.push_back(std::make_pair(Id, ~Mask & GetRegisterMask(Id)));
+        return;
+      }
+    }
+
+    ReadVisitor Reader(rInfo.m_Reads);
+    Analyze.m_pSrcExpr->Visit(&Reader);
+    rInfo.m_WrittenMask = GetRegisterMask(Id);
+    rInfo.m_Removable   = !Reader.AccessMemory();
+    return;
+  }
+
+  if (Analyze.m_Handled)
+  {
+    StatementInformation ThenInfo, ElseInfo;
+    AnalyzeStatement(Analyze.m_pThenExpr, ThenInfo);
+    AnalyzeStatement(Analyze.m_pElseExpr, ElseInfo);
+
+    if (ThenInfo.m_WrittenId != CpuInformation::InvalidRegister && ThenInfo.m_WrittenId == ElseInfo.m_WrittenId)
+    {
+      ReadVisitor Reader(rInfo.m_Reads);
+      Analyze.m_pRefExpr->Visit(&Reader);
+      Analyze.m_pTestExpr->Visit(&Reader);
+      rInfo.m_Reads.insert(std::end(rInfo.m_Reads), std::begin(ThenInfo.m_Reads), std::end(ThenInfo.m_Reads));
+      rInfo.m_Reads.insert(std::end(rInfo.m_Reads), std::begin(ElseInfo.m_Reads), std::end(ElseInfo.m_Reads));
+
+      rInfo.m_WrittenId   = ThenInfo.m_WrittenId;
+      rInfo.m_WrittenMask = ThenInfo.m_WrittenMask & ElseInfo.m_WrittenMask;
+      rInfo.m_PartialMask = ThenInfo.m_WrittenMask | ElseInfo.m_WrittenMask | ThenInfo.m_PartialMask | ElseInfo.m_PartialMask;
+      rInfo.m_Removable   = ThenInfo.m_Removable && ElseInfo.m_Removable && !Reader.AccessMemory();
+      return;
+    }
+  }
+
+  // Unknown statement, it reads every register it references and writes nothing for sure
+  ReadVisitor Reader(rInfo.m_Reads);
+  pStmt->Visit(&Reader);
+}
+
+u64 ExpressionSimplifier::GetRegisterMask(u32 Id) const
+{
+  return GetSizeMask(m_pCpuInfo->GetSizeOfRegisterInBit(Id));
+}
+
+bool ExpressionSimplifier::IsSubRegister(u32 Id, u32 SubId) const
+{
+  if (m_pCpuCtxt == nullptr || !m_pCpuInfo->IsRegisterAliased(Id, SubId))
+    return false;
+  if ((GetRegisterMask(SubId) & ~GetRegisterMask(Id)) != 0)
+    return false;
+
+  // Registers without storage are computed, they aren't part of another register
+  u16 Offset, SubOffset;
+  u8 ReadSize, SubReadSize, WriteSize;
+  if (!m_pCpuCtxt->GetRegisterStorage(Id, Offset, ReadSize, WriteSize)
+    || !m_pCpuCtxt->GetRegisterStorage(SubId, SubOffset, SubReadSize, WriteSize))
+    return false;
+
+  return SubOffset >= Offset && SubOffset + SubReadSize <= Offset + ReadSize;
+}
+
+MEDUSA_NAMESPACE_END
@@ -0,0 +1,93 @@
+#include "medusa/format_buffer.hpp"
+
+#include <cstring>
+
+MEDUSA_NAMESPACE_BEGIN
+
+void FormatBuffer::Append(char const* pStr)
+{
+  Append(pStr, ::strlen(pStr));
+}
+
+void FormatBuffer::Append(char const* pStr, size_t Length)
+{
+  if (m_TextSize == 0)
+  {
+    m_Truncated = true;
+    return;
+  }
+
+  size_t Room = m_TextSize - m_TextLength - 1;
+  if (Length > Room)
+  {
+    Length = Room;
+    m_Truncated = true;
+  }
+
+  ::memcpy(m_pText + m_TextLength, pStr, Length);
+  m_TextLength += Length;
+  m_pText[m_TextLength] = '\0';
+}
+
+void FormatBuffer::Append(char Chr)
+{
+  Append(&Chr, 1);
+}
+
+size_t FormatBuffer::AppendHex(u64 Value, u8 Width, bool Prefix)
+{
+  static char const s_HexDigits[] = "0123456789abcdef";
+  char Digits[2 + 16];
+  size_t DigitNo = 0;
+
+  // Digits are produced from the least significant one
+  do
+  {
+    Digits[sizeof(Digits) - ++DigitNo] = s_HexDigits[Value & 0xf];
+    Value >>= 4;
+  } while (Value != 0);
+
+  while (DigitNo < Width && DigitNo < 16)
+    Digits[sizeof(Digits) - ++DigitNo] = '0';
+
+  if (Prefix)
+  {
+    Digits[sizeof(Digits) - ++DigitNo] = 'x';
+    Digits[sizeof(Digits) - ++DigitNo] = '0';
+  }
+
+  Append(Digits + sizeof(Digits) - DigitNo, DigitNo);
+  return DigitNo;
+}
+
+size_t FormatBuffer::AppendLabel(Label const& rLabel)
+{
+  if (m_TextSize == 0)
+  {
+    m_Truncated = true;
+    return 0;
+  }
+
+  size_t Room = m_TextSize - m_TextLength;
+  size_t Length = rLabel.GetLabel(m_pText + m_TextLength, Room);
+  if (Length + 1 == Room)
+    m_Truncated = true;
+  m_TextLength += Length;
+  return Length;
+}
+
+void FormatBuffer::Assign(std::string const& rStr, Cell::Mark::List const& rMarks)
+{
+  Reset();
+  Append(rStr.c_str(), rStr.length());
+  for (auto itMark = std::begin(rMarks); itMark != std::end(rMarks); ++itMark)
+    AddMark(static_cast<Cell::Mark::Type>(itMark->GetType()), itMark->GetLength());
+}
+
+void FormatBuffer::ToString(std::string& rStr, Cell::Mark::List& rMarks) const
+{
+  rStr.assign(m_pText, m_TextLength);
+  rMarks.insert(std::end(rMarks), m_pMarks, m_pMarks + m_MarkCount);
+}
+
+MEDUSA_NAMESPACE_END
@@ -5,14 +5,34 @@ MEDUSA_NAMESPACE_BEGIN
 Instruction::~Instruction(void)
 {
   for (auto itExpr = std::begin(m_Expressions); itExpr != std::end(m_Expressions); ++itExpr)
-    delete *itExpr;
+    Expression::Release(*itExpr);
   m_Expressions.clear();
 }
 
+void Instruction::Reset(void)
+{
+  m_pName = nullptr;
+  for (u8 CurOprd = 0; CurOprd < OPERAND_NO; ++CurOprd)
+    m_Oprd[CurOprd] = medusa::Operand();
+  m_Opcd         = I_NONE;
+  m_Prefix       = P_NONE;
+  m_TestedFlags  = 0;
+  m_UpdatedFlags = 0;
+  m_ClearedFlags = 0;
+  m_FixedFlags   = 0;
+  m_SemId        = 0;
+  for (auto itExpr = std::begin(m_Expressions); itExpr != std::end(m_Expressions); ++itExpr)
+    Expression::Release(*itExpr);
+  m_Expressions.clear();
+  m_SemArena.Reset();
+  m_spDna->SubType() = NoneType;
+  m_spDna->Length()  = 0;
+}
+
 void Instruction::SetSemantic(Expression::List const& rExprList)
 {
   for (auto itExpr = std::begin(m_Expressions); itExpr != std::end(m_Expressions); ++itExpr)
-    delete *itExpr;
+    Expression::Release(*itExpr);
   m_Expressions.clear();
   m_Expressions = rExprList;
 }
@@ -20,7 +40,7 @@ void Instruction::SetSemantic(Expression::List const& rExprList)
 void Instruction::SetSemantic(Expression* pExpr)
 {
   for (auto itExpr = std::begin(m_Expressions); itExpr != std::end(m_Expressions); ++itExpr)
-    delete *itExpr;
+    Expression::Release(*itExpr);
   m_Expressions.clear();
   m_Expressions.push_back(pExpr);
 }
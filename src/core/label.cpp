@@ -1,7 +1,7 @@
 #include "medusa/label.hpp"
 #include <algorithm>
 #include <sstream>
-#include <boost/format.hpp>
+#include <cstdio>
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -79,48 +79,75 @@ std::string Label::GetLabel(void) const
   if (m_NameLength == 0x0)
     return "";
 
-  std::string Result;
+  // Name (or 16 characters for strings), "uname", '.' and a 32-bit version
+  std::string Result(m_NameLength + 0x20, '\0');
+  Result.resize(GetLabel(&Result[0], Result.size()));
+  return Result;
+}
+
+size_t Label::GetLabel(char* pBuffer, size_t BufferSize) const
+{
+  if (BufferSize == 0x0)
+    return 0;
+
+  size_t Length = 0;
+  size_t Limit  = BufferSize - 1;
 
-  if ((m_Type & CellMask) == String)
+  if (m_NameLength != 0x0)
   {
-    size_t Limit = 0x10;
-    bool Maj = true;
-    for (auto pRawName = m_spName.get(); *pRawName; ++pRawName)
+    if ((m_Type & CellMask) == String)
     {
-      char CurChr = ConvertToLabel(*pRawName);
-      if (CurChr == '\0')
+      size_t StrLimit = 0x10;
+      bool Maj = true;
+      for (auto pRawName = m_spName.get(); *pRawName && Length < Limit; ++pRawName)
       {
-        Maj = true;
-        continue;
+        char CurChr = ConvertToLabel(*pRawName);
+        if (CurChr == '\0')
+        {
+          Maj = true;
+          continue;
+        }
+        CurChr = tolower(CurChr);
+        if (Maj)
+        {
+          Maj = false;
+          CurChr = toupper(CurChr);
+        }
+        pBuffer[Length++] = CurChr;
+
+        if (!--StrLimit)
+          break;
       }
-      CurChr = tolower(CurChr);
-      if (Maj)
+    }
+    else
+      for (auto pRawName = m_spName.get(); *pRawName && Length < Limit; ++pRawName)
       {
-        Maj = false;
-        CurChr = toupper(CurChr);
+        char CurChr = ConvertToLabel(*pRawName);
+        if (CurChr == '\0')
+          continue;
+        pBuffer[Length++] = CurChr;
       }
-      Result += CurChr;
 
-      if (!--Limit)
-        break;
-    }
-  }
-  else
-    for (auto pRawName = m_spName.get(); *pRawName; ++pRawName)
+    if (Length == 0)
     {
-      char CurChr = ConvertToLabel(*pRawName);
-      if (CurChr == '\0')
-        continue;
-      Result += CurChr;
+      static char const s_Unnamed[] = "uname";
+      while (Length < Limit && s_Unnamed[Length] != '\0')
+      {
+        pBuffer[Length] = s_Unnamed[Length];
+        ++Length;
+      }
     }
 
-  if (Result.empty())
-    Result = "uname";
-
-  if (m_Version == 0)
-    return Result;
+    if (m_Version != 0)
+    {
+      int VerLen = snprintf(pBuffer + Length, BufferSize - Length, ".%u", m_Version);
+      if (VerLen > 0)
+        Length = std::min(Length + VerLen, Limit);
+    }
+  }
 
-  return (boost::format("%s.%d") % Result % m_Version).str();
+  pBuffer[Length] = '\0';
+  return Length;
 }
 
 void Label::IncrementVersion(void)
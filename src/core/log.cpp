@@ -3,15 +3,22 @@
 MEDUSA_NAMESPACE_BEGIN
 
 LogWrapper::MutexType      LogWrapper::m_Mutex;
+Log::MutexType             Log::m_Mutex;
 Log::LogMap                Log::m_LogMap;
 LogWrapper::LoggerCallback Log::m_pLog;
 
+LogWrapper::~LogWrapper(void)
+{
+  if (m_Owner)
+    Log::KeepPending(m_Type, m_Buffer);
+}
+
 template<> LogWrapper& LogWrapper::operator<<(s16 Value)
 {
   std::wostringstream oss;
 
   oss << std::hex << std::internal << std::showbase << std::setfill(L'0') << std::setw(sizeof(Value) * 2 + 2) << static_cast<s32>(Value);
-  m_rBuffer += oss.str();
+  m_Buffer += oss.str();
   return *this;
 }
 
@@ -20,28 +27,25 @@ template<> LogWrapper& LogWrapper::operator<<(u16 Value)
   std::wostringstream oss;
 
   oss << std::hex << std::internal << std::showbase << std::setfill(L'0') << std::setw(sizeof(Value) * 2 + 2) << static_cast<u32>(Value);
-  m_rBuffer += oss.str();
+  m_Buffer += oss.str();
   return *this;
 }
 
 template<> LogWrapper& LogWrapper::operator<<(Address Addr)
 {
-  boost::recursive_mutex::scoped_lock(m_Mutex);
-  m_rBuffer += StringToWString(Addr.ToString());
+  m_Buffer += StringToWString(Addr.ToString());
   return *this;
 }
 
 template<> LogWrapper& LogWrapper::operator<<(std::string Msg)
 {
-  boost::recursive_mutex::scoped_lock(m_Mutex);
-  m_rBuffer += StringToWString(Msg);
+  m_Buffer += StringToWString(Msg);
   return *this;
 }
 
 template<> LogWrapper& LogWrapper::operator<<(std::wstring Msg)
 {
-  boost::recursive_mutex::scoped_lock(m_Mutex);
-  m_rBuffer += (Msg);
+  m_Buffer += Msg;
   return *this;
 }
 
@@ -82,9 +86,40 @@ std::wstring LogWrapper::StringToWString(std::string const& rString)
   return Result;
 }
 
+void Log::SetLog(LogWrapper::LoggerCallback pLog)
+{
+  boost::mutex::scoped_lock Lock(m_Mutex);
+  m_pLog = pLog;
+}
+
 LogWrapper Log::Write(std::string const& rType)
 {
-  return LogWrapper(Log::m_pLog, rType, Log::m_LogMap[rType]);
+  LogWrapper::LoggerCallback pLog;
+  std::wstring Pending;
+  {
+    boost::mutex::scoped_lock Lock(m_Mutex);
+    pLog = m_pLog;
+    auto itPending = m_LogMap.find(rType);
+    if (itPending != std::end(m_LogMap))
+    {
+      Pending.swap(itPending->second);
+      m_LogMap.erase(itPending);
+    }
+  }
+  return LogWrapper(pLog, rType, Pending);
+}
+
+void Log::KeepPending(std::string const& rType, std::wstring const& rBuffer)
+{
+  // A wrapper which was flushed only contains its prefix
+  if (rBuffer.size() <= rType.size() + 2)
+    return;
+  boost::mutex::scoped_lock Lock(m_Mutex);
+  auto& rPending = m_LogMap[rType];
+  if (rPending.empty())
+    rPending = rBuffer;
+  else
+    rPending.append(rBuffer, rType.size() + 2, std::wstring::npos);
 }
 
 MEDUSA_NAMESPACE_END
\ No newline at end of file
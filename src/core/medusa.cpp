@@ -116,6 +116,11 @@ Cell::SPtr const Medusa::GetCell(Address const& rAddr) const
   return m_Document.GetCell(rAddr);
 }
 
+Cell::SPtr Medusa::GetCellWithSemantic(Address const& rAddr) const
+{
+  return m_Document.GetCellWithSemantic(rAddr);
+}
+
 bool Medusa::FormatCell(
   Address       const& rAddress,
   Cell          const& rCell,
@@ -125,6 +130,14 @@ bool Medusa::FormatCell(
   return m_Analyzer.FormatCell(m_Document, m_Document.GetBinaryStream(), rAddress, rCell, rStrCell, rMarks);
 }
 
+bool Medusa::FormatCell(
+  Address       const& rAddress,
+  Cell          const& rCell,
+  FormatBuffer       & rBuf) const
+{
+  return m_Analyzer.FormatCell(m_Document, m_Document.GetBinaryStream(), rAddress, rCell, rBuf);
+}
+
 MultiCell* Medusa::GetMultiCell(Address const& rAddr)
 {
   return m_Document.GetMultiCell(rAddr);
@@ -67,7 +67,7 @@ u32 Operand::GetSizeInBit(void) const
   return 0;
 }
 
-Expression * Operand::GetSemantic(CpuInformation const* pCpuInfo, u8 InstructionLength /*= 0*/, bool Dereference /*= true*/) const
+Expression * Operand::GetSemantic(CpuInformation const* pCpuInfo, u8 InstructionLength /*= 0*/, bool Dereference /*= true*/, ExpressionArena* pArena /*= nullptr*/) const
 {
   Expression *pExpr = nullptr;
 
@@ -85,32 +85,32 @@ Expression * Operand::GetSemantic(CpuInformation const* pCpuInfo, u8 Instruction
     case DS_64BIT: ConstType = ConstantExpression::Const64Bit; break;
     default: break;
     }
-    pExpr = new ConstantExpression(ConstType, m_Value);
+    pExpr = new (pArena) ConstantExpression(ConstType, m_Value);
   }
 
   else if (m_Type & (O_REG | O_SREG))
   {
     if (m_Type & O_SREG)
     {
-      pExpr = new IdentifierExpression(m_SecReg, pCpuInfo);
+      pExpr = new (pArena) IdentifierExpression(m_SecReg, pCpuInfo);
 
       // FIXME: pExpr can be nullptr at this state
       if (m_Type & O_SCALE)
-        pExpr = new OperationExpression(
+        pExpr = new (pArena) OperationExpression(
         OperationExpression::OpMul,
         pExpr,
-        new ConstantExpression(ConstantExpression::Const8Bit, (m_Type >> 8) & 0xf));
+        new (pArena) ConstantExpression(ConstantExpression::Const8Bit, (m_Type >> 8) & 0xf));
     }
 
     if (m_Reg != 0x0)
     {
       if (pExpr == nullptr)
-        pExpr = new IdentifierExpression(m_Reg, pCpuInfo);
+        pExpr = new (pArena) IdentifierExpression(m_Reg, pCpuInfo);
       else
-        pExpr = new OperationExpression(
+        pExpr = new (pArena) OperationExpression(
         OperationExpression::OpAdd,
         pExpr,
-        new IdentifierExpression(m_Reg, pCpuInfo));
+        new (pArena) IdentifierExpression(m_Reg, pCpuInfo));
     }
 
 
@@ -138,10 +138,10 @@ Expression * Operand::GetSemantic(CpuInformation const* pCpuInfo, u8 Instruction
       if (m_Reg == pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister))
         Disp += InstructionLength;
 
-      pExpr = new OperationExpression(
+      pExpr = new (pArena) OperationExpression(
         OperationExpression::OpAdd,
         pExpr,
-        new ConstantExpression(ConstType, Disp));
+        new (pArena) ConstantExpression(ConstType, Disp));
     }
   }
 
@@ -157,10 +157,10 @@ Expression * Operand::GetSemantic(CpuInformation const* pCpuInfo, u8 Instruction
     default: break;
     }
 
-    pExpr = new OperationExpression(
+    pExpr = new (pArena) OperationExpression(
       OperationExpression::OpAdd,
-      new IdentifierExpression(pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister), pCpuInfo),
-      new ConstantExpression(ConstType, m_Value));
+      new (pArena) IdentifierExpression(pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister), pCpuInfo),
+      new (pArena) ConstantExpression(ConstType, m_Value));
   }
 
   if (m_Type & O_MEM)
@@ -177,14 +177,14 @@ Expression * Operand::GetSemantic(CpuInformation const* pCpuInfo, u8 Instruction
       case DS_64BIT: ConstType = ConstantExpression::Const64Bit; break;
       default: break;
       }
-      pExpr = new ConstantExpression(ConstType, m_Value);
+      pExpr = new (pArena) ConstantExpression(ConstType, m_Value);
     }
 
     Expression *pBaseExpr = nullptr;
     if (m_Type & O_SEG)
-      pBaseExpr = new IdentifierExpression(m_Seg, pCpuInfo);
+      pBaseExpr = new (pArena) IdentifierExpression(m_Seg, pCpuInfo);
     else if (m_Type & O_SEG_VAL)
-      pBaseExpr = new ConstantExpression(ConstantExpression::Const16Bit, m_SegValue);
+      pBaseExpr = new (pArena) ConstantExpression(ConstantExpression::Const16Bit, m_SegValue);
 
 /*
 #define MS_MASK      0x0000f000
@@ -204,7 +204,7 @@ Expression * Operand::GetSemantic(CpuInformation const* pCpuInfo, u8 Instruction
     case MS_64BIT: MemAccessSizeInBit = 64; break;
     }
 
-    pExpr = new MemoryExpression(MemAccessSizeInBit, pBaseExpr, pExpr, Dereference);
+    pExpr = new (pArena) MemoryExpression(MemAccessSizeInBit, pBaseExpr, pExpr, Dereference);
   }
 
   assert(pExpr != nullptr);
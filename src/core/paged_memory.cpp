@@ -0,0 +1,437 @@
+#include "medusa/paged_memory.hpp"
+
+#include <cstring>
+
+MEDUSA_NAMESPACE_BEGIN
+
+PagedMemoryContext::PagedMemoryContext(CpuInformation const& rCpuInfo)
+  : MemoryContext(rCpuInfo)
+  , m_pRootDirectory(new PageDirectory)
+  , m_LastFaultAddress(), m_LastFaultAccess(MemoryArea::Unknown)
+  , m_HasSnapshot(false), m_DirtyGeneration(1)
+{
+  FlushTlb();
+}
+
+PagedMemoryContext::~PagedMemoryContext(void)
+{
+  FreeDirectory(m_pRootDirectory, 0);
+}
+
+bool PagedMemoryContext::ReadMemory(u64 LinearAddress, void* pValue, u32 ValueSize) const
+{
+  return CopyMemory(LinearAddress, pValue, ValueSize, MemoryArea::Read, false);
+}
+
+bool PagedMemoryContext::WriteMemory(u64 LinearAddress, void const* pValue, u32 ValueSize, bool SignExtend)
+{
+  if (m_HasSnapshot && ValueSize != 0)
+  {
+    if (CheckAccess(LinearAddress, ValueSize, MemoryArea::Write) == false)
+      return false;
+    MarkDirtyPages(LinearAddress, ValueSize);
+  }
+
+  if (CopyMemory(LinearAddress, const_cast<void*>(pValue), ValueSize, MemoryArea::Write, true) == false)
+    return false;
+
+  if (!m_CodePages.empty())
+    NotifyCodeWrite(LinearAddress, ValueSize);
+  if (m_WriteCallback)
+    m_WriteCallback(LinearAddress, pValue, ValueSize);
+  return true;
+}
+
+bool PagedMemoryContext::AllocateMemory(u64 LinearAddress, u32 Size, void** ppRawMemory)
+{
+  if (Size == 0)
+    return false;
+
+  if (MemoryContext::AllocateMemory(LinearAddress, Size, ppRawMemory) == false)
+    return false;
+
+  UpdatePageEntries(LinearAddress, Size);
+  return true;
+}
+
+bool PagedMemoryContext::MapMemory(u64 LinearAddress, u32 Size, BinaryStream const& rBinStrm, TOffset Position, u32 Length, void** ppRawMemory)
+{
+  if (Size == 0)
+    return false;
+
+  if (MemoryContext::MapMemory(LinearAddress, Size, rBinStrm, Position, Length, ppRawMemory) == false)
+    return false;
+
+  UpdatePageEntries(LinearAddress, Size);
+  return true;
+}
+
+bool PagedMemoryContext::FreeMemory(u64 LinearAddress)
+{
+  auto itMemChunk = m_Memories.find(MemoryChunk(LinearAddress));
+  if (itMemChunk == std::end(m_Memories))
+    return false;
+  u32 Size = itMemChunk->m_Size;
+
+  if (MemoryContext::FreeMemory(LinearAddress) == false)
+    return false;
+
+  if (Size == 0)
+    return true;
+
+  u64 CurPage  = LinearAddress & ~static_cast<u64>(PageSize - 1);
+  u64 LastPage = (LinearAddress + Size - 1) & ~static_cast<u64>(PageSize - 1);
+  while (true)
+  {
+    // The saved content refers to the freed buffer
+    m_SavedPages.erase(CurPage);
+    UpdatePageEntry(CurPage);
+    if (CurPage == LastPage)
+      break;
+    CurPage += PageSize;
+  }
+  return true;
+}
+
+bool PagedMemoryContext::TakeSnapshot(void)
+{
+  // Pages are saved lazily, before they're written for the first time
+  m_SavedPages.clear();
+  m_DirtyPages.clear();
+  ++m_DirtyGeneration;
+  m_HasSnapshot = true;
+  return true;
+}
+
+bool PagedMemoryContext::RestoreSnapshot(void)
+{
+  if (!m_HasSnapshot)
+    return false;
+
+  for (auto itPage = std::begin(m_DirtyPages); itPage != std::end(m_DirtyPages); ++itPage)
+  {
+    auto itSavedPage = m_SavedPages.find(*itPage);
+    if (itSavedPage == std::end(m_SavedPages))
+      continue;
+    for (auto itRange = std::begin(itSavedPage->second); itRange != std::end(itSavedPage->second); ++itRange)
+      memcpy(itRange->m_pHost, itRange->m_Data.data(), itRange->m_Data.size());
+
+    // Translated code could have been modified
+    if (!m_CodePages.empty())
+      NotifyCodeWrite(*itPage, PageSize);
+  }
+
+  m_DirtyPages.clear();
+  ++m_DirtyGeneration;
+  return true;
+}
+
+bool PagedMemoryContext::ProtectMemory(u64 LinearAddress, u32 Size, u32 Access)
+{
+  if (Size == 0)
+    return false;
+
+  u64 CurPage  = LinearAddress & ~static_cast<u64>(PageSize - 1);
+  u64 LastPage = (LinearAddress + Size - 1) & ~static_cast<u64>(PageSize - 1);
+  bool Res = true;
+  while (true)
+  {
+    auto pEntry = GetPageEntry(CurPage);
+    if (pEntry != nullptr)
+      pEntry->m_Access = Access;
+    else
+      Res = false;
+    if (CurPage == LastPage)
+      break;
+    CurPage += PageSize;
+  }
+  return Res;
+}
+
+bool PagedMemoryContext::GetMemoryAccess(u64 LinearAddress, u32& rAccess) const
+{
+  auto pEntry = GetPageEntry(LinearAddress);
+  if (pEntry == nullptr)
+    return false;
+  rAccess = pEntry->m_Access;
+  return true;
+}
+
+bool PagedMemoryContext::CheckAccess(u64 LinearAddress, u32 Size, u32 Access) const
+{
+  if (Size == 0)
+    return true;
+
+  u64 CurPage  = LinearAddress & ~static_cast<u64>(PageSize - 1);
+  u64 LastPage = (LinearAddress + Size - 1) & ~static_cast<u64>(PageSize - 1);
+  while (true)
+  {
+    auto pEntry = GetPageEntry(CurPage);
+    if (pEntry == nullptr || (pEntry->m_Access & Access) != Access)
+      return Fault(CurPage < LinearAddress ? LinearAddress : CurPage, Size, Access);
+    if (CurPage == LastPage)
+      break;
+    CurPage += PageSize;
+  }
+  return true;
+}
+
+bool PagedMemoryContext::GetLastFault(u64& rLinearAddress, u32& rAccess) const
+{
+  if (m_LastFaultAccess == MemoryArea::Unknown)
+    return false;
+  rLinearAddress = m_LastFaultAddress;
+  rAccess        = m_LastFaultAccess;
+  return true;
+}
+
+bool PagedMemoryContext::FindMemoryChunk(u64 LinearAddress, MemoryChunk& rMemChnk) const
+{
+  auto pEntry = GetPageEntry(LinearAddress);
+  if (pEntry == nullptr)
+    return false;
+
+  if (pEntry->m_Shared)
+    return MemoryContext::FindMemoryChunk(LinearAddress, rMemChnk);
+
+  auto const& rChunk = pEntry->m_Chunk;
+  if (LinearAddress < rChunk.m_LinearAddress || LinearAddress - rChunk.m_LinearAddress >= rChunk.m_Size)
+    return false;
+  rMemChnk = rChunk;
+  return true;
+}
+
+PagedMemoryContext::PageEntry* PagedMemoryContext::GetPageEntry(u64 LinearAddress) const
+{
+  u64 PageAddr = LinearAddress & ~static_cast<u64>(PageSize - 1);
+  auto& rTlbEntry = m_Tlb[(LinearAddress >> PageBits) & (TlbSize - 1)];
+  if (rTlbEntry.m_PageAddress == PageAddr)
+    return rTlbEntry.m_pEntry;
+
+  u64 PageNo = LinearAddress >> PageBits;
+  PageDirectory* pDir = m_pRootDirectory;
+  for (u32 Level = 0; Level < LevelNo - 1; ++Level)
+  {
+    pDir = static_cast<PageDirectory*>(pDir->m_pEntries[(PageNo >> (LevelBits * (LevelNo - 1 - Level))) & (LevelSize - 1)]);
+    if (pDir == nullptr)
+      return nullptr;
+  }
+
+  auto pEntry = static_cast<PageEntry*>(pDir->m_pEntries[PageNo & (LevelSize - 1)]);
+  if (pEntry != nullptr)
+  {
+    rTlbEntry.m_PageAddress = PageAddr;
+    rTlbEntry.m_pEntry      = pEntry;
+  }
+  return pEntry;
+}
+
+PagedMemoryContext::PageEntry* PagedMemoryContext::GetOrCreatePageEntry(u64 LinearAddress)
+{
+  u64 PageNo = LinearAddress >> PageBits;
+  PageDirectory* pDir = m_pRootDirectory;
+  for (u32 Level = 0; Level < LevelNo - 1; ++Level)
+  {
+    auto& rpNextDir = pDir->m_pEntries[(PageNo >> (LevelBits * (LevelNo - 1 - Level))) & (LevelSize - 1)];
+    if (rpNextDir == nullptr)
+      rpNextDir = new PageDirectory;
+    pDir = static_cast<PageDirectory*>(rpNextDir);
+  }
+
+  auto& rpEntry = pDir->m_pEntries[PageNo & (LevelSize - 1)];
+  if (rpEntry == nullptr)
+    rpEntry = new PageEntry;
+  return static_cast<PageEntry*>(rpEntry);
+}
+
+void PagedMemoryContext::RemovePageEntry(u64 LinearAddress)
+{
+  u64 PageNo = LinearAddress >> PageBits;
+  PageDirectory* pDir = m_pRootDirectory;
+  for (u32 Level = 0; Level < LevelNo - 1; ++Level)
+  {
+    pDir = static_cast<PageDirectory*>(pDir->m_pEntries[(PageNo >> (LevelBits * (LevelNo - 1 - Level))) & (LevelSize - 1)]);
+    if (pDir == nullptr)
+      return;
+  }
+
+  auto& rpEntry = pDir->m_pEntries[PageNo & (LevelSize - 1)];
+  delete static_cast<PageEntry*>(rpEntry);
+  rpEntry = nullptr;
+}
+
+void PagedMemoryContext::UpdatePageEntry(u64 PageAddress)
+{
+  FlushTlb();
+
+  // Chunks aren't always aligned on pages, so a page can be shared by several chunks
+  MemoryChunk PageChunk;
+  u32 ChunkNo = 0;
+  for (auto itMemChnk = std::begin(m_Memories); itMemChnk != std::end(m_Memories); ++itMemChnk)
+  {
+    if (itMemChnk->m_Size == 0)
+      continue;
+    u64 ChunkLastAddr = itMemChnk->m_LinearAddress + itMemChnk->m_Size - 1;
+    if (ChunkLastAddr < PageAddress || itMemChnk->m_LinearAddress > PageAddress + (PageSize - 1))
+      continue;
+    if (ChunkNo++ == 0)
+      PageChunk = *itMemChnk;
+  }
+
+  if (ChunkNo == 0)
+  {
+    RemovePageEntry(PageAddress);
+    return;
+  }
+
+  auto pEntry = GetOrCreatePageEntry(PageAddress);
+  pEntry->m_Chunk  = PageChunk;
+  pEntry->m_Shared = ChunkNo > 1;
+}
+
+void PagedMemoryContext::UpdatePageEntries(u64 LinearAddress, u32 Size)
+{
+  u64 CurPage  = LinearAddress & ~static_cast<u64>(PageSize - 1);
+  u64 LastPage = (LinearAddress + Size - 1) & ~static_cast<u64>(PageSize - 1);
+  while (true)
+  {
+    UpdatePageEntry(CurPage);
+    if (CurPage == LastPage)
+      break;
+    CurPage += PageSize;
+  }
+}
+
+void PagedMemoryContext::FreeDirectory(PageDirectory* pDir, u32 Level)
+{
+  for (u32 i = 0; i < LevelSize; ++i)
+  {
+    if (pDir->m_pEntries[i] == nullptr)
+      continue;
+    if (Level == LevelNo - 1)
+      delete static_cast<PageEntry*>(pDir->m_pEntries[i]);
+    else
+      FreeDirectory(static_cast<PageDirectory*>(pDir->m_pEntries[i]), Level + 1);
+  }
+  delete pDir;
+}
+
+void PagedMemoryContext::FlushTlb(void) const
+{
+  for (u32 i = 0; i < TlbSize; ++i)
+  {
+    m_Tlb[i].m_PageAddress = ~0ULL; // never aligned on a page
+    m_Tlb[i].m_pEntry      = nullptr;
+  }
+}
+
+bool PagedMemoryContext::Fault(u64 LinearAddress, u32 Size, u32 Access) const
+{
+  m_LastFaultAddress = LinearAddress;
+  m_LastFaultAccess  = Access;
+  if (m_FaultCallback)
+    m_FaultCallback(LinearAddress, Size, Access);
+  return false;
+}
+
+void PagedMemoryContext::MarkDirtyPages(u64 LinearAddress, u32 Size)
+{
+  u64 CurPage  = LinearAddress & ~static_cast<u64>(PageSize - 1);
+  u64 LastPage = (LinearAddress + Size - 1) & ~static_cast<u64>(PageSize - 1);
+  while (true)
+  {
+    auto pEntry = GetPageEntry(CurPage);
+    if (pEntry != nullptr && pEntry->m_DirtyGeneration != m_DirtyGeneration)
+    {
+      pEntry->m_DirtyGeneration = m_DirtyGeneration;
+      m_DirtyPages.push_back(CurPage);
+      if (m_SavedPages.find(CurPage) == std::end(m_SavedPages))
+        SavePage(CurPage, m_SavedPages[CurPage]);
+    }
+    if (CurPage == LastPage)
+      break;
+    CurPage += PageSize;
+  }
+}
+
+void PagedMemoryContext::SavePage(u64 PageAddress, SavedPage& rSavedPage) const
+{
+  u64 PageLastAddr = PageAddress + (PageSize - 1);
+  for (auto itMemChnk = std::begin(m_Memories); itMemChnk != std::end(m_Memories); ++itMemChnk)
+  {
+    if (itMemChnk->m_Size == 0)
+      continue;
+    u64 ChunkLastAddr = itMemChnk->m_LinearAddress + itMemChnk->m_Size - 1;
+    if (ChunkLastAddr < PageAddress || itMemChnk->m_LinearAddress > PageLastAddr)
+      continue;
+
+    u64 Begin = itMemChnk->m_LinearAddress > PageAddress ? itMemChnk->m_LinearAddress : PageAddress;
+    u64 End   = ChunkLastAddr < PageLastAddr ? ChunkLastAddr : PageLastAddr;
+
+    SavedRange Range;
+    Range.m_pHost = static_cast<u8*>(itMemChnk->m_Buffer) + (Begin - itMemChnk->m_LinearAddress);
+    Range.m_Data.assign(Range.m_pHost, Range.m_pHost + (End - Begin + 1));
+    rSavedPage.push_back(Range);
+  }
+}
+
+bool PagedMemoryContext::CopyMemory(u64 LinearAddress, void* pValue, u32 ValueSize, u32 Access, bool Write) const
+{
+  if (ValueSize == 0)
+    return true;
+
+  // Fast path: the access is contained in a page backed by a single chunk
+  u64 PageOff = LinearAddress & (PageSize - 1);
+  if (PageOff + ValueSize <= PageSize)
+  {
+    auto pEntry = GetPageEntry(LinearAddress);
+    if (pEntry == nullptr || (pEntry->m_Access & Access) == 0)
+      return Fault(LinearAddress, ValueSize, Access);
+
+    if (!pEntry->m_Shared)
+    {
+      auto const& rChunk = pEntry->m_Chunk;
+      if (LinearAddress < rChunk.m_LinearAddress || LinearAddress + ValueSize > rChunk.m_LinearAddress + rChunk.m_Size)
+        return Fault(LinearAddress, ValueSize, Access);
+
+      u8* pHost = static_cast<u8*>(rChunk.m_Buffer) + (LinearAddress - rChunk.m_LinearAddress);
+      if (Write)
+        memcpy(pHost, pValue, ValueSize);
+      else
+        memcpy(pValue, pHost, ValueSize);
+      return true;
+    }
+  }
+
+  // Check the whole range first, a faulting write must not be partially done
+  if (CheckAccess(LinearAddress, ValueSize, Access) == false)
+    return false;
+
+  u8* pCurValue = static_cast<u8*>(pValue);
+  u64 CurAddr   = LinearAddress;
+  u32 Remaining = ValueSize;
+  while (Remaining != 0)
+  {
+    MemoryChunk MemChnk;
+    if (FindMemoryChunk(CurAddr, MemChnk) == false)
+      return Fault(CurAddr, Remaining, Access);
+
+    u64 ChunkOff = CurAddr - MemChnk.m_LinearAddress;
+    u32 CurSize  = MemChnk.m_Size - static_cast<u32>(ChunkOff);
+    if (CurSize > Remaining)
+      CurSize = Remaining;
+
+    u8* pHost = static_cast<u8*>(MemChnk.m_Buffer) + ChunkOff;
+    if (Write)
+      memcpy(pHost, pCurValue, CurSize);
+    else
+      memcpy(pCurValue, pHost, CurSize);
+
+    pCurValue += CurSize;
+    CurAddr   += CurSize;
+    Remaining -= CurSize;
+  }
+  return true;
+}
+
+MEDUSA_NAMESPACE_END
@@ -49,7 +49,7 @@ u32 Printer::operator()(Address const& rAddress, u32 xOffset, u32 yOffset, u32 F
     NumberOfLine += PrintMultiCell(rAddress, xOffset - NumberOfRow, yOffset + NumberOfLine);
   }
 
-  if (rDoc.GetCell(rAddress) != nullptr)
+  if (rDoc.GetCellType(rAddress) != Cell::CellType)
   {
     if (Flags & ShowAddress)
       NumberOfRow = PrintAddress(rAddress, xOffset, yOffset + NumberOfLine);
@@ -87,6 +87,18 @@ u16 Printer::GetLineHeight(Address const& rAddress, u32 Flags) const
   return Height;
 }
 
+bool Printer::FormatCell(Address const& rAddress) const
+{
+  if (m_rCore.GetDocument().DecodeInstruction(rAddress, m_CellInsn))
+    return m_rCore.FormatCell(rAddress, m_CellInsn, m_CellBuffer);
+
+  // Other cells are small, they still go through the document
+  auto spCell = m_rCore.GetCell(rAddress);
+  if (spCell == nullptr)
+    return false;
+  return m_rCore.FormatCell(rAddress, *spCell, m_CellBuffer);
+}
+
 u16 Printer::GetLineWidth(Address const& rAddress, u32 Flags) const
 {
   auto& rDoc = m_rCore.GetDocument();
@@ -120,14 +132,11 @@ u16 Printer::GetLineWidth(Address const& rAddress, u32 Flags) const
 
   // Cell
   size_t CellLen = 0;
-  auto pCell = m_rCore.GetCell(rAddress);
-  if (pCell == nullptr)
+  if (rDoc.GetCellType(rAddress) == Cell::CellType)
     return 0;
 
-  std::string StrCell;
-  Cell::Mark::List CellMarks;
-  m_rCore.FormatCell(rAddress, *pCell, StrCell, CellMarks);
-  CellLen += StrCell.length();
+  if (FormatCell(rAddress))
+    CellLen += m_CellBuffer.GetLength();
   std::string Comment;
   if (rDoc.GetComment(rAddress, Comment))
     CellLen += (Comment.length() + 3);
@@ -165,24 +174,15 @@ u32 StreamPrinter::PrintAddress(Address const& rAddress, u32 xOffset, u32 yOffse
 
 u32 StreamPrinter::PrintCell(Address const& rAddress, u32 xOffset, u32 yOffset)
 {
-  std::ostringstream Buffer;
-  auto pCell = m_rCore.GetCell(rAddress);
-  if (pCell == nullptr)
-  {
-    Buffer << "invalid cell" << std::endl;
-    return 1;
-  }
+  // NOTE: xOffset is ignored since HandleOffset has no effect on the stream
+  if (FormatCell(rAddress))
+    m_rStream.write(m_CellBuffer.GetText(), m_CellBuffer.GetLength());
 
-  std::string CellStr;
-  Cell::Mark::List Marks;
-  m_rCore.FormatCell(rAddress, *pCell, CellStr, Marks);
-  Buffer << CellStr;
   std::string Comment;
   if (m_rCore.GetDocument().GetComment(rAddress, Comment))
-    Buffer << " ; " << Comment;
+    m_rStream << " ; " << Comment;
 
-  HandleOffset(Buffer, xOffset);
-  m_rStream << Buffer.str() << std::endl;
+  m_rStream << std::endl;
   return 1;
 }
 
@@ -79,8 +79,9 @@ void TaskManager::Stop(void)
 
 void TaskManager::Wait(void)
 {
-  m_Running = false;
-  m_Thread.join();
+  // Clearing m_Running isn't enough, the thread could already wait for a new task,
+  // Stop queues a null task which wakes it up once the previous tasks are done
+  Stop();
 }
 
 void TaskManager::AddTask(Task* pTask)
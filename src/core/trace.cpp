@@ -0,0 +1,370 @@
+#include "medusa/trace.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+
+MEDUSA_NAMESPACE_BEGIN
+
+namespace
+{
+
+bool ReadUnsigned(std::vector<u8> const& rTrace, size_t& rPos, u64& rValue)
+{
+  rValue = 0;
+  for (u32 Shift = 0; Shift < 64; Shift += 7)
+  {
+    if (rPos >= rTrace.size())
+      return false;
+    u8 Byte = rTrace[rPos++];
+    rValue |= static_cast<u64>(Byte & 0x7f) << Shift;
+    if (!(Byte & 0x80))
+      return true;
+  }
+  return false;
+}
+
+bool ReadSigned(std::vector<u8> const& rTrace, size_t& rPos, s64& rValue)
+{
+  u64 Value;
+  if (ReadUnsigned(rTrace, rPos, Value) == false)
+    return false;
+  rValue = static_cast<s64>(Value >> 1) ^ -static_cast<s64>(Value & 1);
+  return true;
+}
+
+}
+
+TraceRecorder::TraceRecorder(std::ostream* pStream)
+  : m_pStream(pStream), m_pCpuCtxt(nullptr)
+  , m_LastBlock(), m_LastWrite(), m_BlockNo()
+{
+}
+
+TraceRecorder::~TraceRecorder(void)
+{
+  if (IsRecording())
+    Stop();
+}
+
+bool TraceRecorder::Start(CpuContext* pCpuCtxt)
+{
+  m_pCpuCtxt = nullptr;
+  m_Buffer.clear();
+
+  u32 CtxtSize = pCpuCtxt->GetContextSize();
+  if (CtxtSize == 0 || pCpuCtxt->GetContextAddress() == nullptr)
+    return false;
+
+  m_pCpuCtxt  = pCpuCtxt;
+  m_Registers.assign((CtxtSize + sizeof(u64) - 1) / sizeof(u64), 0);
+  m_LastBlock = 0;
+  m_LastWrite = 0;
+  m_BlockNo   = 0;
+
+  u32 Magic = TraceRecorder::Magic;
+  for (u32 i = 0; i < sizeof(Magic); ++i)
+    m_Buffer.push_back(static_cast<u8>(Magic >> (i * 8)));
+  m_Buffer.push_back(Version);
+  WriteUnsigned(CtxtSize);
+  return true;
+}
+
+void TraceRecorder::RecordBlock(u64 LinearAddress)
+{
+  if (!IsRecording())
+    return;
+
+  RecordRegisters();
+
+  m_Buffer.push_back(BlockRecord);
+  WriteSigned(static_cast<s64>(LinearAddress - m_LastBlock));
+  m_LastBlock = LinearAddress;
+  ++m_BlockNo;
+
+  if (m_pStream != nullptr && m_Buffer.size() >= FlushSize)
+    Flush();
+}
+
+void TraceRecorder::RecordMemoryWrite(u64 LinearAddress, void const* pValue, u32 Size)
+{
+  if (!IsRecording())
+    return;
+
+  m_Buffer.push_back(MemoryRecord);
+  WriteSigned(static_cast<s64>(LinearAddress - m_LastWrite));
+  WriteUnsigned(Size);
+  auto pBytes = static_cast<u8 const*>(pValue);
+  m_Buffer.insert(std::end(m_Buffer), pBytes, pBytes + Size);
+
+  // Consecutive writes (e.g. memcpy) have a null delta
+  m_LastWrite = LinearAddress + Size;
+}
+
+void TraceRecorder::RecordRestore(void)
+{
+  if (!IsRecording())
+    return;
+
+  RecordRegisters();
+  m_Buffer.push_back(RestoreRecord);
+}
+
+void TraceRecorder::Stop(void)
+{
+  if (!IsRecording())
+    return;
+
+  RecordRegisters();
+  m_Buffer.push_back(EndRecord);
+  if (m_pStream != nullptr)
+    Flush();
+  m_pCpuCtxt = nullptr;
+}
+
+void TraceRecorder::RecordRegisters(void)
+{
+  u32 CtxtSize = m_pCpuCtxt->GetContextSize();
+  auto pCtxt   = static_cast<u8 const*>(m_pCpuCtxt->GetContextAddress());
+
+  // Most blocks only modify a few words, the record is omitted if none is modified
+  u32 ModifiedNo = 0;
+  for (u32 WordIdx = 0; WordIdx < m_Registers.size(); ++WordIdx)
+  {
+    u64 Word = 0;
+    u32 Off  = WordIdx * sizeof(u64);
+    memcpy(&Word, pCtxt + Off, std::min<u32>(sizeof(u64), CtxtSize - Off));
+    if (Word != m_Registers[WordIdx])
+      ++ModifiedNo;
+  }
+  if (ModifiedNo == 0)
+    return;
+
+  m_Buffer.push_back(RegisterRecord);
+  WriteUnsigned(ModifiedNo);
+  u32 NextIdx = 0;
+  for (u32 WordIdx = 0; WordIdx < m_Registers.size(); ++WordIdx)
+  {
+    u64 Word = 0;
+    u32 Off  = WordIdx * sizeof(u64);
+    memcpy(&Word, pCtxt + Off, std::min<u32>(sizeof(u64), CtxtSize - Off));
+    if (Word == m_Registers[WordIdx])
+      continue;
+
+    // Registers usually change by a few bits, so the xor is shorter than the value
+    WriteUnsigned(WordIdx - NextIdx);
+    WriteUnsigned(Word ^ m_Registers[WordIdx]);
+    m_Registers[WordIdx] = Word;
+    NextIdx = WordIdx + 1;
+  }
+}
+
+void TraceRecorder::WriteUnsigned(u64 Value)
+{
+  while (Value >= 0x80)
+  {
+    m_Buffer.push_back(static_cast<u8>(Value | 0x80));
+    Value >>= 7;
+  }
+  m_Buffer.push_back(static_cast<u8>(Value));
+}
+
+void TraceRecorder::Flush(void)
+{
+  if (m_Buffer.empty())
+    return;
+  m_pStream->write(reinterpret_cast<char const*>(m_Buffer.data()), m_Buffer.size());
+  m_Buffer.clear();
+}
+
+bool TraceReader::Open(std::vector<u8> const& rTrace)
+{
+  m_Trace = rTrace;
+  m_ContextSize = 0;
+  m_DataOffset  = 0;
+  m_Indexed     = false;
+  m_WriteIndex.clear();
+
+  if (m_Trace.size() < sizeof(u32) + 1)
+    return false;
+
+  u32 Magic = 0;
+  for (u32 i = 0; i < sizeof(Magic); ++i)
+    Magic |= static_cast<u32>(m_Trace[i]) << (i * 8);
+  if (Magic != TraceRecorder::Magic || m_Trace[sizeof(Magic)] != TraceRecorder::Version)
+    return false;
+
+  size_t Pos = sizeof(Magic) + 1;
+  u64 CtxtSize;
+  if (ReadUnsigned(m_Trace, Pos, CtxtSize) == false || CtxtSize == 0)
+    return false;
+
+  m_ContextSize = static_cast<u32>(CtxtSize);
+  m_DataOffset  = static_cast<u32>(Pos);
+  return true;
+}
+
+bool TraceReader::Open(std::istream& rStream)
+{
+  std::vector<u8> Trace((std::istreambuf_iterator<char>(rStream)), std::istreambuf_iterator<char>());
+  return Open(Trace);
+}
+
+bool TraceReader::Replay(ReplayCallback Callback) const
+{
+  if (m_ContextSize == 0)
+    return false;
+
+  std::vector<u8> Registers(m_ContextSize);
+  u64 BlockNo = 0, LastBlock = 0, LastWrite = 0;
+  size_t Pos = m_DataOffset;
+
+  while (Pos < m_Trace.size())
+  {
+    Event CurEvent;
+    CurEvent.m_Type = m_Trace[Pos++];
+    switch (CurEvent.m_Type)
+    {
+    case TraceRecorder::EndRecord:
+      return true;
+
+    case TraceRecorder::RegisterRecord:
+      {
+        u64 ModifiedNo, WordIdx = 0;
+        if (ReadUnsigned(m_Trace, Pos, ModifiedNo) == false)
+          return false;
+        while (ModifiedNo-- != 0)
+        {
+          u64 IdxDelta, Xor;
+          if (ReadUnsigned(m_Trace, Pos, IdxDelta) == false || ReadUnsigned(m_Trace, Pos, Xor) == false)
+            return false;
+          WordIdx += IdxDelta;
+          u64 Off = WordIdx * sizeof(u64);
+          if (Off >= m_ContextSize)
+            return false;
+
+          u64 Word = 0;
+          u32 WordSize = std::min<u32>(sizeof(u64), static_cast<u32>(m_ContextSize - Off));
+          memcpy(&Word, &Registers[Off], WordSize);
+          Word ^= Xor;
+          memcpy(&Registers[Off], &Word, WordSize);
+          ++WordIdx;
+        }
+        continue;
+      }
+
+    case TraceRecorder::BlockRecord:
+      {
+        s64 Delta;
+        if (ReadSigned(m_Trace, Pos, Delta) == false)
+          return false;
+        LastBlock += Delta;
+        CurEvent.m_BlockIndex = BlockNo++;
+        CurEvent.m_Address    = LastBlock;
+        CurEvent.m_Size       = 0;
+        CurEvent.m_pData      = nullptr;
+        break;
+      }
+
+    case TraceRecorder::MemoryRecord:
+      {
+        s64 Delta;
+        u64 Size;
+        if (ReadSigned(m_Trace, Pos, Delta) == false || ReadUnsigned(m_Trace, Pos, Size) == false)
+          return false;
+        if (Pos + Size > m_Trace.size())
+          return false;
+        LastWrite += Delta;
+        // Writes done before the first block are attributed to it
+        CurEvent.m_BlockIndex = BlockNo != 0 ? BlockNo - 1 : 0;
+        CurEvent.m_Address    = LastWrite;
+        CurEvent.m_Size       = static_cast<u32>(Size);
+        CurEvent.m_pData      = &m_Trace[Pos];
+        Pos       += static_cast<size_t>(Size);
+        LastWrite += Size;
+        break;
+      }
+
+    case TraceRecorder::RestoreRecord:
+      CurEvent.m_BlockIndex = BlockNo;
+      CurEvent.m_Address    = 0;
+      CurEvent.m_Size       = 0;
+      CurEvent.m_pData      = nullptr;
+      break;
+
+    default:
+      return false;
+    }
+
+    if (Callback(CurEvent, Registers) == false)
+      return true;
+  }
+
+  // The recorder was not stopped, the trace is usable up to here
+  return true;
+}
+
+bool TraceReader::GetRegisters(u64 BlockIndex, std::vector<u8>& rRegisters) const
+{
+  bool Found = false;
+  Replay([&](Event const& rEvent, std::vector<u8> const& rCurRegisters)
+  {
+    if (rEvent.m_Type != TraceRecorder::BlockRecord || rEvent.m_BlockIndex != BlockIndex)
+      return true;
+    rRegisters = rCurRegisters;
+    Found = true;
+    return false;
+  });
+  return Found;
+}
+
+bool TraceReader::Index(void)
+{
+  m_WriteIndex.clear();
+  m_Indexed = Replay([&](Event const& rEvent, std::vector<u8> const&)
+  {
+    if (rEvent.m_Type != TraceRecorder::MemoryRecord || rEvent.m_Size == 0)
+      return true;
+
+    WriteEntry Entry;
+    Entry.m_BlockIndex = rEvent.m_BlockIndex;
+    Entry.m_Address    = rEvent.m_Address;
+    Entry.m_Size       = rEvent.m_Size;
+
+    u64 FirstPage = rEvent.m_Address >> IndexPageBits;
+    u64 LastPage  = (rEvent.m_Address + rEvent.m_Size - 1) >> IndexPageBits;
+    for (u64 Page = FirstPage; Page <= LastPage; ++Page)
+      m_WriteIndex[Page].push_back(Entry);
+    return true;
+  });
+  return m_Indexed;
+}
+
+bool TraceReader::FindWrites(u64 LinearAddress, u32 Size, std::vector<u64>& rBlockIndexes)
+{
+  rBlockIndexes.clear();
+  if (Size == 0)
+    return false;
+  if (!m_Indexed && Index() == false)
+    return false;
+
+  u64 FirstPage = LinearAddress >> IndexPageBits;
+  u64 LastPage  = (LinearAddress + Size - 1) >> IndexPageBits;
+  for (u64 Page = FirstPage; Page <= LastPage; ++Page)
+  {
+    auto itPage = m_WriteIndex.find(Page);
+    if (itPage == std::end(m_WriteIndex))
+      continue;
+    for (auto itWrite = std::begin(itPage->second); itWrite != std::end(itPage->second); ++itWrite)
+      if (itWrite->m_Address < LinearAddress + Size && LinearAddress < itWrite->m_Address + itWrite->m_Size)
+        rBlockIndexes.push_back(itWrite->m_BlockIndex);
+  }
+
+  // A write on several pages is indexed for each of them
+  std::sort(std::begin(rBlockIndexes), std::end(rBlockIndexes));
+  rBlockIndexes.erase(std::unique(std::begin(rBlockIndexes), std::end(rBlockIndexes)), std::end(rBlockIndexes));
+  return true;
+}
+
+MEDUSA_NAMESPACE_END
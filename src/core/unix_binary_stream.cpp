@@ -20,6 +20,32 @@ BinaryStream::~BinaryStream(void)
 {
 }
 
+void* BinaryStream::MapPrivateMemory(TOffset Position, u32 Length, u32 Size) const
+{
+  if (Size == 0 || Length > Size)
+    return nullptr;
+
+  if (Length != 0 && (m_pBuffer == nullptr || m_pBuffer == MAP_FAILED || Position + Length < Position || Position + Length > m_Size))
+    return nullptr;
+
+  // Anonymous pages are zero and only allocated when they're touched
+  void* pMemory = mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (pMemory == MAP_FAILED)
+    return nullptr;
+
+  if (Length != 0)
+    memcpy(pMemory, reinterpret_cast<u8 const*>(m_pBuffer) + Position, Length);
+  return pMemory;
+}
+
+void BinaryStream::UnmapPrivateMemory(void* pMemory, u32 Size)
+{
+  // Mappings start on a page, the memory is at the file offset in this page
+  u64 PageMask = static_cast<u64>(sysconf(_SC_PAGESIZE)) - 1;
+  u8* pBase    = reinterpret_cast<u8*>(reinterpret_cast<u64>(pMemory) & ~PageMask);
+  munmap(pBase, (static_cast<u8*>(pMemory) - pBase) + Size);
+}
+
 /* file binary stream */
 
 FileBinaryStream::FileBinaryStream(void)
@@ -97,6 +123,39 @@ void FileBinaryStream::Close(void)
   m_Size = 0;
 }
 
+void* FileBinaryStream::MapPrivateMemory(TOffset Position, u32 Length, u32 Size) const
+{
+  if (Length == 0 || m_FileHandle == -1)
+    return BinaryStream::MapPrivateMemory(Position, Length, Size);
+
+  if (Length > Size || Position + Length < Position || Position + Length > m_Size)
+    return nullptr;
+
+  u64 PageSize = static_cast<u64>(sysconf(_SC_PAGESIZE));
+  u32 Delta    = static_cast<u32>(Position % PageSize);
+
+  // The whole range is reserved with anonymous pages, so the area can be larger than the file
+  u8* pBase = static_cast<u8*>(mmap(NULL, Delta + Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+  if (pBase == MAP_FAILED)
+    return nullptr;
+
+  if (mmap(pBase, Delta + Length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, m_FileHandle, Position - Delta) == MAP_FAILED)
+  {
+    munmap(pBase, Delta + Size);
+    return nullptr;
+  }
+
+  // The last file page can contain data after Length, it must be zero like the rest of the area
+  u8* pMemory = pBase + Delta;
+  u32 TailSize = static_cast<u32>((PageSize - (Delta + Length) % PageSize) % PageSize);
+  if (TailSize > Size - Length)
+    TailSize = Size - Length;
+  if (TailSize != 0)
+    memset(pMemory + Length, 0x0, TailSize);
+
+  return pMemory;
+}
+
 /* memory binary stream */
 
 MemoryBinaryStream::MemoryBinaryStream(void)
@@ -21,6 +21,40 @@ BinaryStream::~BinaryStream(void)
 {
 }
 
+static u64 GetAllocationGranularity(void)
+{
+  SYSTEM_INFO SysInfo;
+  GetSystemInfo(&SysInfo);
+  return SysInfo.dwAllocationGranularity;
+}
+
+void* BinaryStream::MapPrivateMemory(TOffset Position, u32 Length, u32 Size) const
+{
+  if (Size == 0 || Length > Size)
+    return nullptr;
+
+  if (Length != 0 && (m_pBuffer == nullptr || Position + Length < Position || Position + Length > m_Size))
+    return nullptr;
+
+  // Committed pages are zero and only allocated when they're touched
+  void* pMemory = VirtualAlloc(nullptr, Size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+  if (pMemory == nullptr)
+    return nullptr;
+
+  if (Length != 0)
+    memcpy(pMemory, reinterpret_cast<u8 const*>(m_pBuffer) + Position, Length);
+  return pMemory;
+}
+
+void BinaryStream::UnmapPrivateMemory(void* pMemory, u32 Size)
+{
+  // Views and allocations start on the allocation granularity
+  u64 GranMask = GetAllocationGranularity() - 1;
+  void* pBase  = reinterpret_cast<void*>(reinterpret_cast<u64>(pMemory) & ~GranMask);
+  if (UnmapViewOfFile(pBase) == FALSE)
+    VirtualFree(pBase, 0, MEM_RELEASE);
+}
+
 /* file binary stream */
 
 FileBinaryStream::FileBinaryStream(void)
@@ -119,6 +153,31 @@ void FileBinaryStream::Close(void)
   m_Size = 0;
 }
 
+void* FileBinaryStream::MapPrivateMemory(TOffset Position, u32 Length, u32 Size) const
+{
+  // A view can't be followed by zero pages, so only areas fully backed by the file are mapped
+  if (Length == 0 || Length != Size || m_MapHandle == nullptr)
+    return BinaryStream::MapPrivateMemory(Position, Length, Size);
+
+  if (Position + Length < Position || Position + Length > m_Size)
+    return nullptr;
+
+  u64 ViewOff = Position - Position % GetAllocationGranularity();
+  u32 Delta   = static_cast<u32>(Position - ViewOff);
+
+  u8* pBase = static_cast<u8*>(MapViewOfFile(
+      m_MapHandle,
+      FILE_MAP_COPY,
+      static_cast<DWORD>(ViewOff >> 32), static_cast<DWORD>(ViewOff),
+      Delta + Length
+      ));
+
+  if (pBase == nullptr)
+    return nullptr;
+
+  return pBase + Delta;
+}
+
 /* memory binary stream */
 
 MemoryBinaryStream::MemoryBinaryStream(void)
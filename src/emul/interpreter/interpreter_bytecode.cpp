@@ -0,0 +1,863 @@
+#include "interpreter_bytecode.hpp"
+#include "interpreter_emulator.hpp"
+
+#include <medusa/emulation.hpp>
+#include <medusa/extend.hpp>
+
+#include <cassert>
+
+namespace
+{
+  // This visitor only records the kind and the fields of the visited expression
+  struct ExpressionNode : public ExpressionVisitor
+  {
+    enum Kind
+    {
+      UnknownNode,
+      BindNode,
+      ConditionNode,
+      IfConditionNode,
+      IfElseConditionNode,
+      WhileConditionNode,
+      OperationNode,
+      ConstantNode,
+      IdentifierNode,
+      MemoryNode,
+      VariableNode
+    };
+
+    ExpressionNode(Expression const* pExpr)
+      : m_Kind(UnknownNode), m_Type(), m_Value(), m_pExprList(nullptr), m_pName(nullptr), m_Deref(false)
+    {
+      m_pSubExprs[0] = m_pSubExprs[1] = m_pSubExprs[2] = m_pSubExprs[3] = nullptr;
+      pExpr->Visit(this);
+    }
+
+    virtual Expression* VisitBind(Expression::List const& rExprList)
+    {
+      m_Kind      = BindNode;
+      m_pExprList = &rExprList;
+      return nullptr;
+    }
+
+    virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+    {
+      m_Kind = ConditionNode;
+      m_Type = Type;
+      m_pSubExprs[0] = pRefExpr;
+      m_pSubExprs[1] = pTestExpr;
+      return nullptr;
+    }
+
+    virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+    {
+      VisitCondition(Type, pRefExpr, pTestExpr);
+      m_Kind = IfConditionNode;
+      m_pSubExprs[2] = pThenExpr;
+      return nullptr;
+    }
+
+    virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+    {
+      VisitCondition(Type, pRefExpr, pTestExpr);
+      m_Kind = IfElseConditionNode;
+      m_pSubExprs[2] = pThenExpr;
+      m_pSubExprs[3] = pElseExpr;
+      return nullptr;
+    }
+
+    virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+    {
+      VisitCondition(Type, pRefExpr, pTestExpr);
+      m_Kind = WhileConditionNode;
+      m_pSubExprs[2] = pBodyExpr;
+      return nullptr;
+    }
+
+    virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+    {
+      m_Kind = OperationNode;
+      m_Type = Type;
+      m_pSubExprs[0] = pLeftExpr;
+      m_pSubExprs[1] = pRightExpr;
+      return nullptr;
+    }
+
+    virtual Expression* VisitConstant(u32 Type, u64 Value)
+    {
+      m_Kind  = ConstantNode;
+      m_Type  = Type;
+      m_Value = Value;
+      return nullptr;
+    }
+
+    virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo)
+    {
+      m_Kind = IdentifierNode;
+      m_Type = Id;
+      return nullptr;
+    }
+
+    virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+    {
+      m_Kind  = MemoryNode;
+      m_Type  = AccessSizeInBit;
+      m_Deref = Deref;
+      m_pSubExprs[0] = pBaseExpr;
+      m_pSubExprs[1] = pOffsetExpr;
+      return nullptr;
+    }
+
+    virtual Expression* VisitVariable(u32 SizeInBit, std::string const& rName)
+    {
+      m_Kind  = VariableNode;
+      m_Type  = SizeInBit;
+      m_pName = &rName;
+      return nullptr;
+    }
+
+    Kind                    m_Kind;
+    u32                     m_Type;
+    u64                     m_Value;
+    Expression const*       m_pSubExprs[4];
+    Expression::List const* m_pExprList;
+    std::string const*      m_pName;
+    bool                    m_Deref;
+  };
+
+  // Values are truncated like ConstantExpression does
+  u64 GetValueMask(u32 SizeInBit)
+  {
+    if (SizeInBit == 0 || SizeInBit >= 64)
+      return ~0ULL;
+    return (1ULL << SizeInBit) - 1;
+  }
+}
+
+bool InterpreterCompiler::Compile(Expression::List const& rExprList, InterpreterBytecode& rCode)
+{
+  rCode.Clear();
+  m_pCode = &rCode;
+
+  u32 RegPc = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister);
+  if (RegPc == CpuInformation::InvalidRegister)
+    return false;
+  IdentifierExpression PcExpr(RegPc, m_pCpuInfo);
+
+  for (auto itExpr = std::begin(rExprList); itExpr != std::end(rExprList); ++itExpr)
+  {
+    m_CurSlot = 0;
+    if (CompileStatement(*itExpr) == false)
+      return false;
+
+    // Like the interpreter, execute hooks are tested after each statement
+    Value PcVal;
+    if (CompileValue(&PcExpr, false, PcVal) == false)
+      return false;
+    Emit(InterpreterBytecode::OpExecHook, 0, InterpreterBytecode::NoSlot, PcVal.m_Slot, InterpreterBytecode::NoSlot, 0);
+  }
+
+  Emit(InterpreterBytecode::OpEnd, 0, InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, 0);
+  return true;
+}
+
+bool InterpreterCompiler::CompileStatement(Expression const* pExpr)
+{
+  ExpressionNode Node(pExpr);
+
+  switch (Node.m_Kind)
+  {
+  case ExpressionNode::BindNode:
+    for (auto itExpr = std::begin(*Node.m_pExprList); itExpr != std::end(*Node.m_pExprList); ++itExpr)
+      if (CompileNestedStatement(*itExpr) == false)
+        return false;
+    return true;
+
+  case ExpressionNode::ConditionNode:
+    {
+      u16 CondSlot;
+      return CompileCondition(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], CondSlot);
+    }
+
+  case ExpressionNode::IfConditionNode:
+    {
+      u16 CondSlot;
+      if (CompileCondition(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], CondSlot) == false)
+        return false;
+      u32 JumpIdx = Emit(InterpreterBytecode::OpJumpIfZero, 0, InterpreterBytecode::NoSlot, CondSlot, InterpreterBytecode::NoSlot, 0);
+      if (CompileNestedStatement(Node.m_pSubExprs[2]) == false)
+        return false;
+      m_pCode->m_Code[JumpIdx].m_Imm = m_pCode->m_Code.size();
+      return true;
+    }
+
+  case ExpressionNode::IfElseConditionNode:
+    {
+      u16 CondSlot;
+      if (CompileCondition(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], CondSlot) == false)
+        return false;
+      u32 ElseIdx = Emit(InterpreterBytecode::OpJumpIfZero, 0, InterpreterBytecode::NoSlot, CondSlot, InterpreterBytecode::NoSlot, 0);
+      if (CompileNestedStatement(Node.m_pSubExprs[2]) == false)
+        return false;
+      u32 EndIdx = Emit(InterpreterBytecode::OpJump, 0, InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, 0);
+      m_pCode->m_Code[ElseIdx].m_Imm = m_pCode->m_Code.size();
+      if (CompileNestedStatement(Node.m_pSubExprs[3]) == false)
+        return false;
+      m_pCode->m_Code[EndIdx].m_Imm = m_pCode->m_Code.size();
+      return true;
+    }
+
+  case ExpressionNode::OperationNode:
+    return CompileOperation(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], nullptr);
+
+  case ExpressionNode::ConstantNode:
+  case ExpressionNode::IdentifierNode:
+    return true;
+
+  case ExpressionNode::MemoryNode:
+    {
+      Value Addr;
+      u16 LinearSlot;
+      return CompileAddress(Node.m_pSubExprs[0], Node.m_pSubExprs[1], Addr, LinearSlot);
+    }
+
+  case ExpressionNode::VariableNode:
+    if (Node.m_Type != 0)
+      Emit(InterpreterBytecode::OpAllocVar, static_cast<u8>(Node.m_Type), InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, m_pVarCtxt->GetSlot(*Node.m_pName));
+    return true;
+
+  // The interpreter evaluates the body of a loop once, it's left to it
+  case ExpressionNode::WhileConditionNode:
+  default:
+    return false;
+  }
+}
+
+bool InterpreterCompiler::CompileNestedStatement(Expression const* pExpr)
+{
+  InterpreterBytecode::Recovery Rcvr;
+  Rcvr.m_Begin = static_cast<u32>(m_pCode->m_Code.size());
+  if (CompileStatement(pExpr) == false)
+    return false;
+  Rcvr.m_End = static_cast<u32>(m_pCode->m_Code.size());
+  if (Rcvr.m_Begin != Rcvr.m_End)
+    m_pCode->m_Recoveries.push_back(Rcvr);
+  return true;
+}
+
+bool InterpreterCompiler::CompileValue(Expression const* pExpr, bool SignExtend, Value& rValue)
+{
+  ExpressionNode Node(pExpr);
+
+  switch (Node.m_Kind)
+  {
+  case ExpressionNode::ConstantNode:
+    if (AllocateSlot(rValue.m_Slot) == false)
+      return false;
+    rValue.m_SizeInBit = Node.m_Type;
+    Emit(InterpreterBytecode::OpConst, 0, rValue.m_Slot, InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, Node.m_Value & GetValueMask(Node.m_Type));
+    return true;
+
+  case ExpressionNode::IdentifierNode:
+  case ExpressionNode::VariableNode:
+    {
+      Location Loc;
+      if (CompileLocation(pExpr, Loc) == false)
+        return false;
+      if (CompileLoad(Loc, rValue) == false)
+        return false;
+
+      // Only registers are sign extended by ContextExpression::Read
+      if (SignExtend && Node.m_Kind == ExpressionNode::IdentifierNode)
+        switch (rValue.m_SizeInBit)
+        {
+        case 8: case 16: case 32:
+          Emit(InterpreterBytecode::OpSignExtend, static_cast<u8>(rValue.m_SizeInBit), rValue.m_Slot, rValue.m_Slot, InterpreterBytecode::NoSlot, 0);
+          break;
+        default:
+          break;
+        }
+      return true;
+    }
+
+  case ExpressionNode::MemoryNode:
+    {
+      Location Loc;
+      Loc.m_Type      = Location::MemoryLocation;
+      Loc.m_SizeInBit = Node.m_Type;
+      if (CompileAddress(Node.m_pSubExprs[0], Node.m_pSubExprs[1], Loc.m_Address, Loc.m_LinearSlot) == false)
+        return false;
+
+      if (Node.m_Deref == false)
+      {
+        rValue.m_Slot      = Loc.m_LinearSlot;
+        rValue.m_SizeInBit = Node.m_Type;
+        return true;
+      }
+      return CompileLoad(Loc, rValue);
+    }
+
+  case ExpressionNode::OperationNode:
+    return CompileOperation(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], &rValue);
+
+  case ExpressionNode::ConditionNode:
+    rValue.m_SizeInBit = ConstantExpression::Const1Bit;
+    return CompileCondition(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], rValue.m_Slot);
+
+  // Statements can't be used as value
+  default:
+    return false;
+  }
+}
+
+bool InterpreterCompiler::CompileLocation(Expression const* pExpr, Location& rLoc)
+{
+  ExpressionNode Node(pExpr);
+
+  switch (Node.m_Kind)
+  {
+  case ExpressionNode::IdentifierNode:
+    rLoc.m_Type      = Location::RegisterLocation;
+    rLoc.m_Id        = Node.m_Type;
+    rLoc.m_SizeInBit = m_pCpuInfo->GetSizeOfRegisterInBit(Node.m_Type);
+    return true;
+
+  case ExpressionNode::MemoryNode:
+    if (Node.m_Deref == false)
+      return false;
+    rLoc.m_Type      = Location::MemoryLocation;
+    rLoc.m_SizeInBit = Node.m_Type;
+    return CompileAddress(Node.m_pSubExprs[0], Node.m_pSubExprs[1], rLoc.m_Address, rLoc.m_LinearSlot);
+
+  case ExpressionNode::VariableNode:
+    rLoc.m_Type      = Location::VariableLocation;
+    rLoc.m_Id        = m_pVarCtxt->GetSlot(*Node.m_pName);
+    rLoc.m_SizeInBit = Node.m_Type;
+    if (Node.m_Type != 0)
+      Emit(InterpreterBytecode::OpAllocVar, static_cast<u8>(Node.m_Type), InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, rLoc.m_Id);
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+bool InterpreterCompiler::CompileAddress(Expression const* pBaseExpr, Expression const* pOffsetExpr, Value& rAddr, u16& rLinearSlot)
+{
+  if (pBaseExpr != nullptr)
+  {
+    Value BaseVal;
+    if (CompileValue(pBaseExpr, false, BaseVal) == false)
+      return false;
+    rAddr.m_BaseSlot = BaseVal.m_Slot;
+  }
+
+  Value OffsetVal;
+  if (CompileValue(pOffsetExpr, false, OffsetVal) == false)
+    return false;
+  rAddr.m_OffsetSlot = OffsetVal.m_Slot;
+  rAddr.m_IsMemory   = true;
+
+  if (AllocateSlot(rLinearSlot) == false)
+    return false;
+  Emit(InterpreterBytecode::OpAddress, 0, rLinearSlot, rAddr.m_BaseSlot, rAddr.m_OffsetSlot, 0);
+  return true;
+}
+
+bool InterpreterCompiler::CompileOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr, Value* pValue)
+{
+  u16 ResSlot = InterpreterBytecode::NoSlot;
+
+  switch (Type)
+  {
+  case OperationExpression::OpAff:
+    {
+      Location DstLoc;
+      Value SrcVal;
+      if (CompileLocation(pLeftExpr, DstLoc) == false)
+        return false;
+      if (CompileValue(pRightExpr, false, SrcVal) == false)
+        return false;
+
+      if (DstLoc.m_Type == Location::MemoryLocation)
+        CompileHook(DstLoc.m_Address, Emulator::HookOnWrite);
+      if (SrcVal.m_IsMemory)
+        CompileHook(SrcVal, Emulator::HookOnRead);
+
+      CompileStore(DstLoc, SrcVal.m_Slot);
+
+      // The left operand is not read
+      if (pValue != nullptr)
+      {
+        if (AllocateSlot(ResSlot) == false)
+          return false;
+        Emit(InterpreterBytecode::OpConst, 0, ResSlot, InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, 0);
+        pValue->m_Slot      = ResSlot;
+        pValue->m_SizeInBit = DstLoc.m_SizeInBit;
+      }
+      return true;
+    }
+
+  case OperationExpression::OpXchg:
+    {
+      Location LeftLoc, RightLoc;
+      Value LeftVal, RightVal;
+      if (CompileLocation(pLeftExpr, LeftLoc) == false || CompileLocation(pRightExpr, RightLoc) == false)
+        return false;
+      if (CompileLoad(LeftLoc, LeftVal) == false || CompileLoad(RightLoc, RightVal) == false)
+        return false;
+
+      if (LeftLoc.m_Type == Location::MemoryLocation)
+        CompileHook(LeftLoc.m_Address, Emulator::HookOnWrite);
+      if (RightLoc.m_Type == Location::MemoryLocation)
+        CompileHook(RightLoc.m_Address, Emulator::HookOnRead);
+
+      CompileStore(LeftLoc,  RightVal.m_Slot);
+      CompileStore(RightLoc, LeftVal.m_Slot);
+
+      if (pValue != nullptr)
+      {
+        if (AllocateSlot(ResSlot) == false)
+          return false;
+        Emit(InterpreterBytecode::OpAnd, 0, ResSlot, LeftVal.m_Slot, LeftVal.m_Slot, GetValueMask(LeftVal.m_SizeInBit));
+        pValue->m_Slot      = ResSlot;
+        pValue->m_SizeInBit = LeftVal.m_SizeInBit;
+      }
+      return true;
+    }
+
+  case OperationExpression::OpSext:
+    {
+      // The size of the result depends on the right operand, so it must be known now
+      ExpressionNode RightNode(pRightExpr);
+      if (RightNode.m_Kind != ExpressionNode::ConstantNode)
+        return false;
+      u64 NewSizeInBit = (RightNode.m_Value & GetValueMask(RightNode.m_Type)) * 8;
+      if (NewSizeInBit > 64)
+        return false;
+
+      Value LeftVal;
+      if (CompileValue(pLeftExpr, true, LeftVal) == false)
+        return false;
+      if (LeftVal.m_IsMemory)
+        CompileHook(LeftVal, Emulator::HookOnWrite);
+
+      if (AllocateSlot(ResSlot) == false)
+        return false;
+      Emit(InterpreterBytecode::OpSext, static_cast<u8>(LeftVal.m_SizeInBit), ResSlot, LeftVal.m_Slot, InterpreterBytecode::NoSlot, NewSizeInBit);
+      if (pValue != nullptr)
+      {
+        pValue->m_Slot      = ResSlot;
+        pValue->m_SizeInBit = static_cast<u32>(NewSizeInBit);
+      }
+      return true;
+    }
+
+  default:
+    break;
+  }
+
+  u8 Op;
+  switch (Type)
+  {
+  case OperationExpression::OpAdd:  Op = InterpreterBytecode::OpAdd; break;
+  case OperationExpression::OpSub:  Op = InterpreterBytecode::OpSub; break;
+  case OperationExpression::OpMul:  Op = InterpreterBytecode::OpMul; break;
+  case OperationExpression::OpUDiv:
+  case OperationExpression::OpSDiv: Op = InterpreterBytecode::OpDiv; break;
+  case OperationExpression::OpAnd:  Op = InterpreterBytecode::OpAnd; break;
+  case OperationExpression::OpOr:   Op = InterpreterBytecode::OpOr;  break;
+  case OperationExpression::OpXor:  Op = InterpreterBytecode::OpXor; break;
+  case OperationExpression::OpLls:  Op = InterpreterBytecode::OpLls; break;
+  case OperationExpression::OpLrs:  Op = InterpreterBytecode::OpLrs; break;
+  case OperationExpression::OpArs:  Op = InterpreterBytecode::OpArs; break;
+  default: return false;
+  }
+
+  // Multiplication and arithmetic shift use the sign extended left operand
+  bool SignedLeft = (Type == OperationExpression::OpMul || Type == OperationExpression::OpArs);
+
+  Value LeftVal, RightVal;
+  if (CompileValue(pLeftExpr, SignedLeft, LeftVal) == false)
+    return false;
+  if (CompileValue(pRightExpr, false, RightVal) == false)
+    return false;
+
+  if (LeftVal.m_IsMemory)
+    CompileHook(LeftVal, Emulator::HookOnWrite);
+  if (RightVal.m_IsMemory)
+    CompileHook(RightVal, Emulator::HookOnRead);
+
+  if (AllocateSlot(ResSlot) == false)
+    return false;
+  Emit(Op, 0, ResSlot, LeftVal.m_Slot, RightVal.m_Slot, GetValueMask(LeftVal.m_SizeInBit));
+  if (pValue != nullptr)
+  {
+    pValue->m_Slot      = ResSlot;
+    pValue->m_SizeInBit = LeftVal.m_SizeInBit;
+  }
+  return true;
+}
+
+bool InterpreterCompiler::CompileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, u16& rSlot)
+{
+  Value RefVal, TestVal;
+  if (CompileValue(pRefExpr, true, RefVal) == false)
+    return false;
+  if (CompileValue(pTestExpr, true, TestVal) == false)
+    return false;
+
+  if (AllocateSlot(rSlot) == false)
+    return false;
+  Emit(InterpreterBytecode::OpCond, static_cast<u8>(Type), rSlot, RefVal.m_Slot, TestVal.m_Slot, 0);
+  return true;
+}
+
+bool InterpreterCompiler::CompileLoad(Location const& rLoc, Value& rValue)
+{
+  if (AllocateSlot(rValue.m_Slot) == false)
+    return false;
+  rValue.m_SizeInBit = rLoc.m_SizeInBit;
+
+  switch (rLoc.m_Type)
+  {
+  case Location::RegisterLocation:
+    {
+      u16 Offset;
+      u8 ReadSize, WriteSize;
+      if (m_rRegLayout.GetStorage(rLoc.m_Id, Offset, ReadSize, WriteSize))
+      {
+        u8 Op;
+        switch (ReadSize)
+        {
+        case 1: Op = InterpreterBytecode::OpLoadReg8;  break;
+        case 2: Op = InterpreterBytecode::OpLoadReg16; break;
+        case 4: Op = InterpreterBytecode::OpLoadReg32; break;
+        case 8: Op = InterpreterBytecode::OpLoadReg64; break;
+        default: Op = InterpreterBytecode::OpReadReg;  break;
+        }
+        if (Op != InterpreterBytecode::OpReadReg)
+        {
+          Emit(Op, ReadSize, rValue.m_Slot, InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, Offset);
+          return true;
+        }
+      }
+      Emit(InterpreterBytecode::OpReadReg, static_cast<u8>(rLoc.m_SizeInBit / 8), rValue.m_Slot, InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, rLoc.m_Id);
+      return true;
+    }
+
+  case Location::MemoryLocation:
+    rValue.m_IsMemory   = true;
+    rValue.m_BaseSlot   = rLoc.m_Address.m_BaseSlot;
+    rValue.m_OffsetSlot = rLoc.m_Address.m_OffsetSlot;
+    Emit(InterpreterBytecode::OpLoadMem, static_cast<u8>(rLoc.m_SizeInBit / 8), rValue.m_Slot, rLoc.m_LinearSlot, InterpreterBytecode::NoSlot, 0);
+    return true;
+
+  case Location::VariableLocation:
+    Emit(InterpreterBytecode::OpReadVar, 0, rValue.m_Slot, InterpreterBytecode::NoSlot, InterpreterBytecode::NoSlot, rLoc.m_Id);
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+void InterpreterCompiler::CompileStore(Location const& rLoc, u16 Slot)
+{
+  switch (rLoc.m_Type)
+  {
+  case Location::RegisterLocation:
+    {
+      u16 Offset;
+      u8 ReadSize, WriteSize;
+      u32 RegSize = rLoc.m_SizeInBit / 8;
+      if (m_rRegLayout.GetStorage(rLoc.m_Id, Offset, ReadSize, WriteSize))
+      {
+        u8 Op = InterpreterBytecode::OpWriteReg;
+        if (WriteSize <= RegSize)
+          switch (WriteSize)
+          {
+          case 1: Op = InterpreterBytecode::OpStoreReg8;  break;
+          case 2: Op = InterpreterBytecode::OpStoreReg16; break;
+          case 4: Op = InterpreterBytecode::OpStoreReg32; break;
+          case 8: Op = InterpreterBytecode::OpStoreReg64; break;
+          default: break;
+          }
+        else if (RegSize == 2 && WriteSize == 4)
+          Op = InterpreterBytecode::OpStoreReg16To32;
+        else if (RegSize == 4 && WriteSize == 8)
+          Op = InterpreterBytecode::OpStoreReg32To64;
+
+        if (Op != InterpreterBytecode::OpWriteReg)
+        {
+          Emit(Op, WriteSize, InterpreterBytecode::NoSlot, Slot, InterpreterBytecode::NoSlot, Offset);
+          return;
+        }
+      }
+      Emit(InterpreterBytecode::OpWriteReg, static_cast<u8>(RegSize), InterpreterBytecode::NoSlot, Slot, InterpreterBytecode::NoSlot, rLoc.m_Id);
+      return;
+    }
+
+  case Location::MemoryLocation:
+    Emit(InterpreterBytecode::OpStoreMem, static_cast<u8>(rLoc.m_SizeInBit / 8), InterpreterBytecode::NoSlot, rLoc.m_LinearSlot, Slot, 0);
+    return;
+
+  case Location::VariableLocation:
+    Emit(InterpreterBytecode::OpWriteVar, 0, InterpreterBytecode::NoSlot, Slot, InterpreterBytecode::NoSlot, rLoc.m_Id);
+    return;
+
+  default:
+    return;
+  }
+}
+
+void InterpreterCompiler::CompileHook(Value const& rAddr, u32 HookType)
+{
+  Emit(InterpreterBytecode::OpHook, 0, InterpreterBytecode::NoSlot, rAddr.m_BaseSlot, rAddr.m_OffsetSlot, HookType);
+}
+
+bool InterpreterCompiler::AllocateSlot(u16& rSlot)
+{
+  if (m_CurSlot >= InterpreterBytecode::NoSlot)
+    return false;
+  rSlot = static_cast<u16>(m_CurSlot++);
+  if (m_pCode->m_SlotNo < m_CurSlot)
+    m_pCode->m_SlotNo = m_CurSlot;
+  return true;
+}
+
+u32 InterpreterCompiler::Emit(u8 Op, u8 Size, u16 Dst, u16 Src0, u16 Src1, u64 Imm)
+{
+  InterpreterBytecode::Insn Insn;
+  Insn.m_Op   = Op;
+  Insn.m_Size = Size;
+  Insn.m_Dst  = Dst;
+  Insn.m_Src0 = Src0;
+  Insn.m_Src1 = Src1;
+  Insn.m_Imm  = Imm;
+  m_pCode->m_Code.push_back(Insn);
+  return static_cast<u32>(m_pCode->m_Code.size() - 1);
+}
+
+bool InterpreterEmulator::Run(InterpreterBytecode const& rCode)
+{
+  if (m_Slots.size() < rCode.m_SlotNo)
+    m_Slots.resize(rCode.m_SlotNo);
+
+  u64* pSlots = m_Slots.data();
+  u8*  pCtxt  = static_cast<u8*>(m_pCpuCtxt->GetContextAddress());
+  auto pCode  = rCode.m_Code.data();
+  u32  CurIdx = 0;
+
+  while (true)
+  {
+    auto const& rInsn = pCode[CurIdx];
+    bool Failed = false;
+
+    switch (rInsn.m_Op)
+    {
+    case InterpreterBytecode::OpConst:     pSlots[rInsn.m_Dst] = rInsn.m_Imm; break;
+
+    case InterpreterBytecode::OpLoadReg8:  pSlots[rInsn.m_Dst] = *reinterpret_cast<u8  const*>(pCtxt + rInsn.m_Imm); break;
+    case InterpreterBytecode::OpLoadReg16: pSlots[rInsn.m_Dst] = *reinterpret_cast<u16 const*>(pCtxt + rInsn.m_Imm); break;
+    case InterpreterBytecode::OpLoadReg32: pSlots[rInsn.m_Dst] = *reinterpret_cast<u32 const*>(pCtxt + rInsn.m_Imm); break;
+    case InterpreterBytecode::OpLoadReg64: pSlots[rInsn.m_Dst] = *reinterpret_cast<u64 const*>(pCtxt + rInsn.m_Imm); break;
+
+    case InterpreterBytecode::OpReadReg:
+      {
+        u64 Value = 0;
+        if (m_pCpuCtxt->ReadRegister(static_cast<u32>(rInsn.m_Imm), &Value, rInsn.m_Size) == false)
+          Failed = true;
+        pSlots[rInsn.m_Dst] = Value;
+        break;
+      }
+
+    case InterpreterBytecode::OpStoreReg8:      *reinterpret_cast<u8  *>(pCtxt + rInsn.m_Imm) = static_cast<u8 >(pSlots[rInsn.m_Src0]); break;
+    case InterpreterBytecode::OpStoreReg16:     *reinterpret_cast<u16 *>(pCtxt + rInsn.m_Imm) = static_cast<u16>(pSlots[rInsn.m_Src0]); break;
+    case InterpreterBytecode::OpStoreReg32:     *reinterpret_cast<u32 *>(pCtxt + rInsn.m_Imm) = static_cast<u32>(pSlots[rInsn.m_Src0]); break;
+    case InterpreterBytecode::OpStoreReg64:     *reinterpret_cast<u64 *>(pCtxt + rInsn.m_Imm) = pSlots[rInsn.m_Src0];                   break;
+    case InterpreterBytecode::OpStoreReg16To32: *reinterpret_cast<u32 *>(pCtxt + rInsn.m_Imm) = static_cast<u16>(pSlots[rInsn.m_Src0]); break;
+    case InterpreterBytecode::OpStoreReg32To64: *reinterpret_cast<u64 *>(pCtxt + rInsn.m_Imm) = static_cast<u32>(pSlots[rInsn.m_Src0]); break;
+
+    case InterpreterBytecode::OpWriteReg:
+      m_pCpuCtxt->WriteRegister(static_cast<u32>(rInsn.m_Imm), &pSlots[rInsn.m_Src0], rInsn.m_Size);
+      break;
+
+    case InterpreterBytecode::OpSignExtend:
+      switch (rInsn.m_Size)
+      {
+      case 8:  pSlots[rInsn.m_Dst] = medusa::SignExtend<s64,  8>(pSlots[rInsn.m_Src0]); break;
+      case 16: pSlots[rInsn.m_Dst] = medusa::SignExtend<s64, 16>(pSlots[rInsn.m_Src0]); break;
+      case 32: pSlots[rInsn.m_Dst] = medusa::SignExtend<s64, 32>(pSlots[rInsn.m_Src0]); break;
+      default: pSlots[rInsn.m_Dst] = pSlots[rInsn.m_Src0];                              break;
+      }
+      break;
+
+    case InterpreterBytecode::OpAdd: pSlots[rInsn.m_Dst] = (pSlots[rInsn.m_Src0] + pSlots[rInsn.m_Src1]) & rInsn.m_Imm; break;
+    case InterpreterBytecode::OpSub: pSlots[rInsn.m_Dst] = (pSlots[rInsn.m_Src0] - pSlots[rInsn.m_Src1]) & rInsn.m_Imm; break;
+    case InterpreterBytecode::OpMul: pSlots[rInsn.m_Dst] = (pSlots[rInsn.m_Src0] * pSlots[rInsn.m_Src1]) & rInsn.m_Imm; break;
+    case InterpreterBytecode::OpAnd: pSlots[rInsn.m_Dst] = (pSlots[rInsn.m_Src0] & pSlots[rInsn.m_Src1]) & rInsn.m_Imm; break;
+    case InterpreterBytecode::OpOr:  pSlots[rInsn.m_Dst] = (pSlots[rInsn.m_Src0] | pSlots[rInsn.m_Src1]) & rInsn.m_Imm; break;
+    case InterpreterBytecode::OpXor: pSlots[rInsn.m_Dst] = (pSlots[rInsn.m_Src0] ^ pSlots[rInsn.m_Src1]) & rInsn.m_Imm; break;
+
+    case InterpreterBytecode::OpDiv:
+      if (pSlots[rInsn.m_Src1] == 0)
+      {
+        Failed = true;
+        break;
+      }
+      pSlots[rInsn.m_Dst] = (pSlots[rInsn.m_Src0] / pSlots[rInsn.m_Src1]) & rInsn.m_Imm;
+      break;
+
+    case InterpreterBytecode::OpLls:
+      pSlots[rInsn.m_Dst] = pSlots[rInsn.m_Src1] >= 64 ? 0 : (pSlots[rInsn.m_Src0] << pSlots[rInsn.m_Src1]) & rInsn.m_Imm;
+      break;
+
+    case InterpreterBytecode::OpLrs:
+      pSlots[rInsn.m_Dst] = pSlots[rInsn.m_Src1] >= 64 ? 0 : (pSlots[rInsn.m_Src0] >> pSlots[rInsn.m_Src1]) & rInsn.m_Imm;
+      break;
+
+    case InterpreterBytecode::OpArs:
+      {
+        u64 Shift = pSlots[rInsn.m_Src1] >= 64 ? 63 : pSlots[rInsn.m_Src1];
+        pSlots[rInsn.m_Dst] = static_cast<u64>(static_cast<s64>(pSlots[rInsn.m_Src0]) >> Shift) & rInsn.m_Imm;
+        break;
+      }
+
+    case InterpreterBytecode::OpSext:
+      {
+        // Same steps as ConstantExpression::SignExtend
+        u64 Value = pSlots[rInsn.m_Src0] & GetValueMask(static_cast<u32>(rInsn.m_Imm));
+        bool Extended = true;
+        switch (rInsn.m_Size)
+        {
+        case 8:  Value = medusa::SignExtend<s64,  8>(Value); break;
+        case 16: Value = medusa::SignExtend<s64, 16>(Value); break;
+        case 32: Value = medusa::SignExtend<s64, 32>(Value); break;
+        case 64:                                             break;
+        default: Extended = false;                           break;
+        }
+        if (Extended) switch (rInsn.m_Imm)
+        {
+        case 8:  Value &= 0x000000ff; break;
+        case 16: Value &= 0x0000ffff; break;
+        case 32: Value &= 0xffffffff; break;
+        default:                      break;
+        }
+        pSlots[rInsn.m_Dst] = Value;
+        break;
+      }
+
+    case InterpreterBytecode::OpCond:
+      {
+        u64 Ref = pSlots[rInsn.m_Src0], Test = pSlots[rInsn.m_Src1];
+        bool Cond = false;
+        switch (rInsn.m_Size)
+        {
+        case ConditionExpression::CondEq:  Cond = Ref == Test;                                     break;
+        case ConditionExpression::CondNe:  Cond = Ref != Test;                                     break;
+        case ConditionExpression::CondUgt: Cond = Ref >  Test;                                     break;
+        case ConditionExpression::CondUge: Cond = Ref >= Test;                                     break;
+        case ConditionExpression::CondUlt: Cond = Ref <  Test;                                     break;
+        case ConditionExpression::CondUle: Cond = Ref <= Test;                                     break;
+        case ConditionExpression::CondSgt: Cond = static_cast<s64>(Ref) >  static_cast<s64>(Test); break;
+        case ConditionExpression::CondSge: Cond = static_cast<s64>(Ref) >= static_cast<s64>(Test); break;
+        case ConditionExpression::CondSlt: Cond = static_cast<s64>(Ref) <  static_cast<s64>(Test); break;
+        case ConditionExpression::CondSle: Cond = static_cast<s64>(Ref) <= static_cast<s64>(Test); break;
+        default:                                                                                   break;
+        }
+        pSlots[rInsn.m_Dst] = Cond ? 1 : 0;
+        break;
+      }
+
+    case InterpreterBytecode::OpAddress:
+      {
+        u64 Base = rInsn.m_Src0 != InterpreterBytecode::NoSlot ? pSlots[rInsn.m_Src0] : 0;
+        u64 Offset = pSlots[rInsn.m_Src1];
+        u64 LinAddr;
+        if (m_pCpuCtxt->Translate(Address(static_cast<u16>(Base), Offset), LinAddr) == false)
+          LinAddr = Offset;
+        pSlots[rInsn.m_Dst] = LinAddr;
+        break;
+      }
+
+    case InterpreterBytecode::OpLoadMem:
+      {
+        u64 Value = 0;
+        if (m_pMemCtxt->ReadMemory(pSlots[rInsn.m_Src0], &Value, rInsn.m_Size) == false)
+          Failed = true;
+        pSlots[rInsn.m_Dst] = Value;
+        break;
+      }
+
+    case InterpreterBytecode::OpStoreMem:
+      m_pMemCtxt->WriteMemory(pSlots[rInsn.m_Src0], &pSlots[rInsn.m_Src1], rInsn.m_Size);
+      break;
+
+    case InterpreterBytecode::OpHook:
+      if (HasHooks())
+      {
+        u64 Base = rInsn.m_Src0 != InterpreterBytecode::NoSlot ? pSlots[rInsn.m_Src0] : 0;
+        TestHook(Address(static_cast<u16>(Base), pSlots[rInsn.m_Src1]), static_cast<u32>(rInsn.m_Imm));
+      }
+      break;
+
+    case InterpreterBytecode::OpAllocVar:
+      if (m_pVarCtxt->AllocateVariable(rInsn.m_Size, static_cast<u32>(rInsn.m_Imm)) == false)
+        Failed = true;
+      break;
+
+    case InterpreterBytecode::OpReadVar:
+      {
+        u64 Value = 0;
+        if (m_pVarCtxt->ReadVariable(static_cast<u32>(rInsn.m_Imm), Value) == false)
+          Failed = true;
+        pSlots[rInsn.m_Dst] = Value;
+        break;
+      }
+
+    case InterpreterBytecode::OpWriteVar:
+      m_pVarCtxt->WriteVariable(static_cast<u32>(rInsn.m_Imm), pSlots[rInsn.m_Src0]);
+      break;
+
+    case InterpreterBytecode::OpJumpIfZero:
+      if (pSlots[rInsn.m_Src0] == 0)
+      {
+        CurIdx = static_cast<u32>(rInsn.m_Imm);
+        continue;
+      }
+      break;
+
+    case InterpreterBytecode::OpJump:
+      CurIdx = static_cast<u32>(rInsn.m_Imm);
+      continue;
+
+    case InterpreterBytecode::OpExecHook:
+      if (HasHooks())
+        TestHook(Address(pSlots[rInsn.m_Src0]), Emulator::HookOnExecute);
+      break;
+
+    case InterpreterBytecode::OpEnd:
+      return true;
+
+    default:
+      assert(0 && "Unknown bytecode");
+      return false;
+    }
+
+    if (Failed)
+    {
+      // Resume after the innermost nested statement, if any
+      auto itRcvr = std::begin(rCode.m_Recoveries);
+      for (; itRcvr != std::end(rCode.m_Recoveries); ++itRcvr)
+        if (CurIdx >= itRcvr->m_Begin && CurIdx < itRcvr->m_End)
+          break;
+      if (itRcvr == std::end(rCode.m_Recoveries))
+        return false;
+      CurIdx = itRcvr->m_End;
+      continue;
+    }
+
+    ++CurIdx;
+  }
+}
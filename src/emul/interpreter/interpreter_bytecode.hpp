@@ -0,0 +1,158 @@
+#ifndef _EMUL_INTERPRETER_BYTECODE_
+#define _EMUL_INTERPRETER_BYTECODE_
+
+#include <medusa/namespace.hpp>
+#include <medusa/types.hpp>
+#include <medusa/information.hpp>
+#include <medusa/context.hpp>
+#include <medusa/expression.hpp>
+
+#include <string>
+#include <vector>
+
+MEDUSA_NAMESPACE_USE
+
+//! InterpreterBytecode holds semantic compiled to a register-based bytecode.
+//! Intermediate values live in numbered slots, registers are accessed with their offset in the
+//! CpuContext buffer when it's available (@see CpuContext::GetRegisterStorage).
+struct InterpreterBytecode
+{
+  enum Opcode
+  {
+    OpConst,                  //! dst = imm
+    OpLoadReg8,               //! dst = *(u8  *)(ctxt + imm)
+    OpLoadReg16,              //! dst = *(u16 *)(ctxt + imm)
+    OpLoadReg32,              //! dst = *(u32 *)(ctxt + imm)
+    OpLoadReg64,              //! dst = *(u64 *)(ctxt + imm)
+    OpReadReg,                //! dst = ReadRegister(imm, size)
+    OpStoreReg8,              //! *(u8  *)(ctxt + imm) = src0
+    OpStoreReg16,             //! *(u16 *)(ctxt + imm) = src0
+    OpStoreReg32,             //! *(u32 *)(ctxt + imm) = src0
+    OpStoreReg64,             //! *(u64 *)(ctxt + imm) = src0
+    OpStoreReg16To32,         //! *(u32 *)(ctxt + imm) = (u16)src0
+    OpStoreReg32To64,         //! *(u64 *)(ctxt + imm) = (u32)src0
+    OpWriteReg,               //! WriteRegister(imm, src0, size)
+    OpSignExtend,             //! dst = sign_extend(src0) from size bits
+    OpAdd,                    //! dst = (src0 + src1) & imm
+    OpSub,                    //! dst = (src0 - src1) & imm
+    OpMul,                    //! dst = (src0 * src1) & imm
+    OpDiv,                    //! dst = (src0 / src1) & imm, fails on zero
+    OpAnd,                    //! dst = (src0 & src1) & imm
+    OpOr,                     //! dst = (src0 | src1) & imm
+    OpXor,                    //! dst = (src0 ^ src1) & imm
+    OpLls,                    //! dst = (src0 << src1) & imm
+    OpLrs,                    //! dst = (src0 >> src1) & imm
+    OpArs,                    //! dst = ((s64)src0 >> src1) & imm
+    OpSext,                   //! dst = src0 sign extended from size to imm bits, like OperationExpression::OpSext
+    OpCond,                   //! dst = src0 <size> src1 where size is a ConditionExpression::Type
+    OpAddress,                //! dst = linear address of src0:src1, src0 is NoSlot if there's no base
+    OpLoadMem,                //! dst = ReadMemory(src0, size)
+    OpStoreMem,               //! WriteMemory(src0, src1, size)
+    OpHook,                   //! call hooks of type imm at src0:src1
+    OpAllocVar,               //! AllocateVariable(size, slot imm)
+    OpReadVar,                //! dst = ReadVariable(slot imm)
+    OpWriteVar,               //! WriteVariable(slot imm, src0)
+    OpJumpIfZero,             //! if src0 == 0 then jump to imm
+    OpJump,                   //! jump to imm
+    OpExecHook,               //! call execute hooks at src0
+    OpEnd
+  };
+
+  enum
+  {
+    NoSlot = 0xffff
+  };
+
+  struct Insn
+  {
+    u8  m_Op;
+    u8  m_Size;
+    u16 m_Dst;
+    u16 m_Src0;
+    u16 m_Src1;
+    u64 m_Imm;
+  };
+
+  //! Failures inside [m_Begin, m_End) are ignored and the execution resumes at m_End,
+  //! this is how the interpreter handles failures of nested statements.
+  struct Recovery
+  {
+    u32 m_Begin;
+    u32 m_End;
+  };
+
+  InterpreterBytecode(void) : m_SlotNo() {}
+
+  void Clear(void)
+  {
+    m_Code.clear();
+    m_Recoveries.clear();
+    m_SlotNo = 0;
+  }
+
+  std::vector<Insn>     m_Code;
+  std::vector<Recovery> m_Recoveries; //! Sorted from the innermost range
+  u32                   m_SlotNo;
+};
+
+//! InterpreterCompiler translates semantic statements to InterpreterBytecode,
+//! the generated code behaves like InterpreterEmulator::InterpreterExpressionVisitor.
+//! Registers and variables are resolved while compiling, so the bytecode must run with the
+//! CpuContext of rRegLayout and pVarCtxt.
+class InterpreterCompiler
+{
+public:
+  InterpreterCompiler(CpuInformation const* pCpuInfo, RegisterLayout& rRegLayout, VariableContext* pVarCtxt)
+    : m_pCpuInfo(pCpuInfo), m_rRegLayout(rRegLayout), m_pVarCtxt(pVarCtxt), m_pCode(nullptr), m_CurSlot() {}
+
+  //! This method compiles rExprList into rCode.
+  //\return false if an expression can't be compiled (e.g. a loop), rCode is left unusable.
+  bool Compile(Expression::List const& rExprList, InterpreterBytecode& rCode);
+
+private:
+  struct Value
+  {
+    Value(void) : m_Slot(InterpreterBytecode::NoSlot), m_SizeInBit(), m_IsMemory(false), m_BaseSlot(InterpreterBytecode::NoSlot), m_OffsetSlot(InterpreterBytecode::NoSlot) {}
+
+    u16  m_Slot;
+    u32  m_SizeInBit;
+    bool m_IsMemory;   //! True if the value is read from memory, hooks need its logical address
+    u16  m_BaseSlot;
+    u16  m_OffsetSlot;
+  };
+
+  struct Location
+  {
+    enum Type { RegisterLocation, MemoryLocation, VariableLocation };
+
+    Location(void) : m_Type(RegisterLocation), m_SizeInBit(), m_Id(), m_LinearSlot(InterpreterBytecode::NoSlot) {}
+
+    Type  m_Type;
+    u32   m_SizeInBit;
+    u32   m_Id;         //! Register identifier or variable slot
+    u16   m_LinearSlot;
+    Value m_Address;    //! Logical address of a memory location
+  };
+
+  bool CompileStatement(Expression const* pExpr);
+  bool CompileNestedStatement(Expression const* pExpr);
+  bool CompileValue(Expression const* pExpr, bool SignExtend, Value& rValue);
+  bool CompileLocation(Expression const* pExpr, Location& rLoc);
+  bool CompileAddress(Expression const* pBaseExpr, Expression const* pOffsetExpr, Value& rAddr, u16& rLinearSlot);
+  bool CompileOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr, Value* pValue);
+  bool CompileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, u16& rSlot);
+  bool CompileLoad(Location const& rLoc, Value& rValue);
+  void CompileStore(Location const& rLoc, u16 Slot);
+  void CompileHook(Value const& rAddr, u32 HookType);
+
+  bool AllocateSlot(u16& rSlot);
+  u32  Emit(u8 Op, u8 Size, u16 Dst, u16 Src0, u16 Src1, u64 Imm);
+
+  CpuInformation const* m_pCpuInfo;
+  RegisterLayout&       m_rRegLayout;
+  VariableContext*      m_pVarCtxt;
+  InterpreterBytecode*  m_pCode;
+  u32                   m_CurSlot;
+};
+
+#endif // !_EMUL_INTERPRETER_BYTECODE_
@@ -6,32 +6,48 @@ MEDUSA_NAMESPACE_USE
 InterpreterEmulator::InterpreterEmulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext *pMemCtxt)
 : Emulator(pCpuInfo, pCpuCtxt, pMemCtxt, new VariableContext)
 {
+  // The module manager creates an emulator without context to get its name
+  if (m_pMemCtxt == nullptr)
+    return;
+
+  m_pMemCtxt->SetCodeWriteCallback([this](u64 PageAddress)
+  {
+    InvalidatePage(PageAddress);
+  });
 }
 
 InterpreterEmulator::~InterpreterEmulator(void)
 {
+  if (m_pMemCtxt != nullptr)
+    m_pMemCtxt->SetCodeWriteCallback(nullptr);
 }
 
 bool InterpreterEmulator::Execute(Address const& rAddress, Expression const& rExpr)
 {
-  InterpreterExpressionVisitor Visitor(m_Hooks, m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt);
+  InterpreterExpressionVisitor Visitor(*this, m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, m_TmpArena);
   auto pCurExpr = rExpr.Visit(&Visitor);
 
   if (pCurExpr == nullptr)
     return false;
 
   auto RegPc = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister);
-  auto RegSz = m_pCpuInfo->GetSizeOfRegisterInBit(RegPc) / 8;
   u64 CurPc  = 0;
-  m_pCpuCtxt->ReadRegister(RegPc, &CurPc, RegSz);
+  m_RegLayout.Read(RegPc, CurPc);
   TestHook(Address(CurPc), Emulator::HookOnExecute);
   delete pCurExpr;
+  m_TmpArena.Reset();
   return true;
 }
 
 bool InterpreterEmulator::Execute(Address const& rAddress, Expression::List const& rExprList)
 {
-  InterpreterExpressionVisitor Visitor(m_Hooks, m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt);
+  // Compiled semantic avoids to allocate and dispatch a temporary expression for each node,
+  // constructs the compiler doesn't handle are still interpreted by the visitor
+  InterpreterCompiler Compiler(m_pCpuInfo, m_RegLayout, m_pVarCtxt);
+  if (Compiler.Compile(rExprList, m_Bytecode))
+    return Run(m_Bytecode);
+
+  InterpreterExpressionVisitor Visitor(*this, m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, m_TmpArena);
   for (auto itExpr = std::begin(rExprList); itExpr != std::end(rExprList); ++itExpr)
   {
     //Log::Write("emul_interpreter") << "\n" << (*itExpr)->ToString() << "\n" << m_pCpuCtxt->ToString() << LogEnd;
@@ -40,21 +56,112 @@ bool InterpreterEmulator::Execute(Address const& rAddress, Expression::List cons
       return false;
 
     auto RegPc = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister);
-    auto RegSz = m_pCpuInfo->GetSizeOfRegisterInBit(RegPc) / 8;
     u64 CurPc = 0;
-    m_pCpuCtxt->ReadRegister(RegPc, &CurPc, RegSz);
+    m_RegLayout.Read(RegPc, CurPc);
     TestHook(Address(CurPc), Emulator::HookOnExecute);
     delete pCurExpr;
+    m_TmpArena.Reset();
   }
   return true;
 }
 
+bool InterpreterEmulator::TranslateBlock(Address const& rAddress, u32 Size, Expression::List const& rExprList)
+{
+  std::shared_ptr<InterpreterBytecode> spBlock = std::make_shared<InterpreterBytecode>();
+  InterpreterCompiler Compiler(m_pCpuInfo, m_RegLayout, m_pVarCtxt);
+  if (Compiler.Compile(rExprList, *spBlock) == false)
+    return false;
+
+  u64 LinAddr = GetLinearAddress(rAddress);
+  RemoveBlock(LinAddr);
+
+  // Writing to one of these pages means the block could have been modified
+  u64 FirstPage = LinAddr & ~static_cast<u64>(MemoryContext::CodePageSize - 1);
+  u64 LastPage  = (LinAddr + (Size != 0 ? Size - 1 : 0)) & ~static_cast<u64>(MemoryContext::CodePageSize - 1);
+  CachedBlock Block = { spBlock, FirstPage, LastPage };
+  m_BlockCache[LinAddr] = Block;
+  for (u64 CurPage = FirstPage; ; CurPage += MemoryContext::CodePageSize)
+  {
+    m_PageBlocks[CurPage].insert(LinAddr);
+    if (CurPage == LastPage)
+      break;
+  }
+  m_pMemCtxt->MarkCodePages(LinAddr, Size);
+
+  return true;
+}
+
+bool InterpreterEmulator::IsBlockTranslated(Address const& rAddress) const
+{
+  return m_BlockCache.find(GetLinearAddress(rAddress)) != std::end(m_BlockCache);
+}
+
+bool InterpreterEmulator::ExecuteBlock(Address const& rAddress)
+{
+  auto itBlock = m_BlockCache.find(GetLinearAddress(rAddress));
+  if (itBlock == std::end(m_BlockCache))
+    return false;
+
+  // Keep a reference, the block could be invalidated by its own writes
+  auto spBlock = itBlock->second.m_spCode;
+  return Run(*spBlock);
+}
+
+void InterpreterEmulator::InvalidateBlocks(void)
+{
+  m_BlockCache.clear();
+  m_PageBlocks.clear();
+}
+
+u64 InterpreterEmulator::GetLinearAddress(Address const& rAddress) const
+{
+  u64 LinAddr;
+  if (m_pCpuCtxt->Translate(rAddress, LinAddr) == false)
+    LinAddr = rAddress.GetOffset();
+  return LinAddr;
+}
+
+void InterpreterEmulator::InvalidatePage(u64 PageAddress)
+{
+  auto itPage = m_PageBlocks.find(PageAddress);
+  if (itPage == std::end(m_PageBlocks))
+    return;
+
+  // RemoveBlock updates the list of this page too
+  auto BlkAddrs = std::move(itPage->second);
+  m_PageBlocks.erase(itPage);
+  for (auto itBlkAddr = std::begin(BlkAddrs); itBlkAddr != std::end(BlkAddrs); ++itBlkAddr)
+    RemoveBlock(*itBlkAddr);
+}
+
+void InterpreterEmulator::RemoveBlock(u64 LinAddr)
+{
+  auto itBlock = m_BlockCache.find(LinAddr);
+  if (itBlock == std::end(m_BlockCache))
+    return;
+
+  // Blocks spanning several pages are listed in each of them
+  for (u64 CurPage = itBlock->second.m_FirstPage; ; CurPage += MemoryContext::CodePageSize)
+  {
+    auto itPage = m_PageBlocks.find(CurPage);
+    if (itPage != std::end(m_PageBlocks))
+    {
+      itPage->second.erase(LinAddr);
+      if (itPage->second.empty())
+        m_PageBlocks.erase(itPage);
+    }
+    if (CurPage == itBlock->second.m_LastPage)
+      break;
+  }
+  m_BlockCache.erase(itBlock);
+}
+
 Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitBind(Expression::List const& rExprList)
 {
   Expression::List SmplExprList;
   for (auto itExpr = std::begin(rExprList); itExpr != std::end(rExprList); ++itExpr)
     SmplExprList.push_back((*itExpr)->Visit(this));
-  return new BindExpression(SmplExprList);
+  return new (m_rArena) BindExpression(SmplExprList);
 }
 
 Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
@@ -89,7 +196,7 @@ Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitCondition(u3
   case ConditionExpression::CondSle:Cond = (Ref.s <= Test.s) ? true : false; break;
   }
 
-  return new ConstantExpression(ConstantExpression::Const1Bit, Cond);
+  return new (m_rArena) ConstantExpression(ConstantExpression::Const1Bit, Cond);
 }
 
 Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
@@ -124,7 +231,7 @@ Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitIfCondition(
   case ConditionExpression::CondSle:Cond = (Ref.s <= Test.s) ? true : false; break;
   }
 
-  auto pExpr = Cond == true ? pThenExpr->Clone() : new ConstantExpression(ConstantExpression::Const1Bit, Cond); // what are we supposed to return?
+  auto pExpr = Cond == true ? pThenExpr->Clone(m_rArena) : new (m_rArena) ConstantExpression(ConstantExpression::Const1Bit, Cond); // what are we supposed to return?
   if (pExpr != nullptr)
   {
     auto pStmtExpr = pExpr->Visit(this);
@@ -171,7 +278,7 @@ Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitIfElseCondit
   case ConditionExpression::CondSle:Cond = (Ref.s <= Test.s) ? true : false; break;
   }
 
-  auto pExpr = (Cond ? pThenExpr->Clone() : pElseExpr->Clone());
+  auto pExpr = (Cond ? pThenExpr->Clone(m_rArena) : pElseExpr->Clone(m_rArena));
   if (pExpr != nullptr)
   {
     auto pStmtExpr = pExpr->Visit(this);
@@ -217,7 +324,7 @@ Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitWhileConditi
   case ConditionExpression::CondSle:Cond = (Ref.s <= Test.s) ? true : false; break;
   }
 
-  auto pExpr = Cond == true ? pBodyExpr->Clone() : nullptr;
+  auto pExpr = Cond == true ? pBodyExpr->Clone(m_rArena) : nullptr;
   if (pExpr != nullptr)
   {
     auto pStmtExpr = pExpr->Visit(this);
@@ -256,18 +363,10 @@ Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitOperation(u3
 
   Address LeftAddress, RightAddress;
   if (pLeft->GetAddress(m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, LeftAddress) == true)
-  {
-    auto itHook = m_rHooks.find(LeftAddress);
-    if (itHook != std::end(m_rHooks) && itHook->second.m_Type & Emulator::HookOnWrite)
-      itHook->second.m_Callback(m_pCpuCtxt, m_pMemCtxt);
-  }
+    m_rEmul.TestHook(LeftAddress, Emulator::HookOnWrite);
 
   if (pRight->GetAddress(m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, RightAddress) == true)
-  {
-    auto itHook = m_rHooks.find(RightAddress);
-    if (itHook != std::end(m_rHooks) && itHook->second.m_Type & Emulator::HookOnRead)
-      itHook->second.m_Callback(m_pCpuCtxt, m_pMemCtxt);
-  }
+    m_rEmul.TestHook(RightAddress, Emulator::HookOnRead);
 
   u64 SignedLeft = 0;
   pLeft->Read(m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, SignedLeft, true);
@@ -295,7 +394,7 @@ Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitOperation(u3
       // FIXME: Handle error case
       u64 Value = 0;
       pLeft->Read(m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, Value, true);
-      auto pReadValue = new ConstantExpression(static_cast<u32>(Right * 8), Value);
+      auto pReadValue = new (m_rArena) ConstantExpression(static_cast<u32>(Right * 8), Value);
       pReadValue->SignExtend(pLeft->GetSizeInBit());
       delete pLeft;
       delete pRight;
@@ -307,17 +406,17 @@ Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitOperation(u3
   u32 Bit = pLeft->GetSizeInBit();
   delete pLeft;
   delete pRight;
-  return new ConstantExpression(Bit, Left);
+  return new (m_rArena) ConstantExpression(Bit, Left);
 }
 
 Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitConstant(u32 Type, u64 Value)
 {
-  return new ConstantExpression(Type, Value);
+  return new (m_rArena) ConstantExpression(Type, Value);
 }
 
 Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo)
 {
-  return new IdentifierExpression(Id, pCpuInfo);
+  return new (m_rArena) IdentifierExpression(Id, pCpuInfo);
 }
 
 Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
@@ -328,12 +427,12 @@ Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitMemory(u32 A
 
   auto pOffsetExprVisited = pOffsetExpr->Visit(this);
 
-  return new MemoryExpression(AccessSizeInBit, pBaseExprVisited, pOffsetExprVisited, Deref);
+  return new (m_rArena) MemoryExpression(AccessSizeInBit, pBaseExprVisited, pOffsetExprVisited, Deref);
 }
 
 Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitVariable(u32 Type, std::string const& rName)
 {
   if (Type && m_pVarCtxt->AllocateVariable(Type, rName) == false)
     return nullptr;
-  return new VariableExpression(Type, rName);
+  return new (m_rArena) VariableExpression(Type, rName);
 }
\ No newline at end of file
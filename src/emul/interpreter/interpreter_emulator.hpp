@@ -3,6 +3,12 @@
 
 #include <medusa/emulation.hpp>
 
+#include "interpreter_bytecode.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
 #if defined(_WIN32) || defined(WIN32)
 # ifdef emul_interpreter_EXPORTS
 #  define EMUL_INTERPRETER_EXPORT __declspec(dllexport)
@@ -28,14 +34,43 @@ public:
   virtual bool Execute(Address const& rAddress, Expression const& rExpr);
   virtual bool Execute(Address const& rAddress, Expression::List const& rExprList);
 
+  virtual bool TranslateBlock(Address const& rAddress, u32 Size, Expression::List const& rExprList);
+  virtual bool IsBlockTranslated(Address const& rAddress) const;
+  virtual bool ExecuteBlock(Address const& rAddress);
+  virtual void InvalidateBlocks(void);
+
 protected:
 
 private:
+  u64  GetLinearAddress(Address const& rAddress) const;
+  void InvalidatePage(u64 PageAddress);
+  void RemoveBlock(u64 LinAddr);
+
+  //! This method runs compiled semantic, it's defined in interpreter_bytecode.cpp.
+  //\return false if a top-level statement fails, like the visitor does.
+  bool Run(InterpreterBytecode const& rCode);
+
+  ExpressionArena     m_TmpArena; //! Temporary expressions created while interpreting are allocated here
+  InterpreterBytecode m_Bytecode; //! Last compiled block, reused to avoid reallocations
+  std::vector<u64>    m_Slots;    //! Intermediate values of the bytecode
+
+  // Blocks are shared so a block can invalidate itself while it's running
+  struct CachedBlock
+  {
+    std::shared_ptr<InterpreterBytecode> m_spCode;
+    u64                                  m_FirstPage; //! Pages the block was decoded from
+    u64                                  m_LastPage;
+  };
+  typedef std::unordered_map<u64, CachedBlock>             BlockCacheType;
+  typedef std::unordered_map<u64, std::unordered_set<u64>> PageBlocksType;
+  BlockCacheType m_BlockCache; //! Translated blocks indexed by their linear address
+  PageBlocksType m_PageBlocks; //! Linear address of blocks decoded from each code page
+
   class InterpreterExpressionVisitor : public ExpressionVisitor
   {
   public:
-    InterpreterExpressionVisitor(HookAddressHashMap const& Hooks, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt)
-      : m_rHooks(Hooks), m_pCpuCtxt(pCpuCtxt), m_pMemCtxt(pMemCtxt), m_pVarCtxt(pVarCtxt) {}
+    InterpreterExpressionVisitor(InterpreterEmulator const& rEmul, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt, ExpressionArena& rArena)
+      : m_rEmul(rEmul), m_pCpuCtxt(pCpuCtxt), m_pMemCtxt(pMemCtxt), m_pVarCtxt(pVarCtxt), m_rArena(rArena) {}
     virtual Expression* VisitBind(Expression::List const& rExprList);
     virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr);
     virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr);
@@ -48,10 +83,11 @@ private:
     virtual Expression* VisitVariable(u32 SizeInBit, std::string const& rName);
 
   protected:
-    HookAddressHashMap const& m_rHooks;
-    CpuContext*               m_pCpuCtxt;
-    MemoryContext*            m_pMemCtxt;
-    VariableContext*          m_pVarCtxt;
+    InterpreterEmulator const& m_rEmul; //! Used to test hooks
+    CpuContext*                m_pCpuCtxt;
+    MemoryContext*             m_pMemCtxt;
+    VariableContext*           m_pVarCtxt;
+    ExpressionArena&           m_rArena;
   };
 };
 
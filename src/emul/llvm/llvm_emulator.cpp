@@ -1,554 +1,1558 @@
 #include "llvm_emulator.hpp"
 
-#include "medusa/log.hpp"
+#include <medusa/log.hpp>
+#include <medusa/module.hpp>
+
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/SwapByteOrder.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/ExecutionEngine/Orc/Core.h>
+#include <llvm/ExecutionEngine/Orc/IRTransformLayer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <cstddef>
+#include <sstream>
 
-// To avoid unresolved external symbol LLVMLinkInMCJIT
-//#include <llvm/ExecutionEngine/MCJIT.h>
+MEDUSA_NAMESPACE_USE
 
-#include <llvm/ExecutionEngine/JIT.h>
+namespace
+{
+  // This visitor only records the kind and the fields of the visited expression
+  struct ExpressionNode : public ExpressionVisitor
+  {
+    enum Kind
+    {
+      UnknownNode,
+      BindNode,
+      ConditionNode,
+      IfConditionNode,
+      IfElseConditionNode,
+      WhileConditionNode,
+      OperationNode,
+      ConstantNode,
+      IdentifierNode,
+      MemoryNode,
+      VariableNode
+    };
+
+    ExpressionNode(Expression const* pExpr)
+      : m_Kind(UnknownNode), m_Type(), m_Value(), m_pExprList(nullptr), m_pName(nullptr), m_Deref(false)
+    {
+      m_pSubExprs[0] = m_pSubExprs[1] = m_pSubExprs[2] = m_pSubExprs[3] = nullptr;
+      pExpr->Visit(this);
+    }
 
-MEDUSA_NAMESPACE_USE
+    virtual Expression* VisitBind(Expression::List const& rExprList)
+    {
+      m_Kind      = BindNode;
+      m_pExprList = &rExprList;
+      return nullptr;
+    }
+
+    virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+    {
+      m_Kind = ConditionNode;
+      m_Type = Type;
+      m_pSubExprs[0] = pRefExpr;
+      m_pSubExprs[1] = pTestExpr;
+      return nullptr;
+    }
 
-llvm::Module*           LlvmEmulator::sm_pModule          = nullptr;
-llvm::ExecutionEngine*  LlvmEmulator::sm_pExecutionEngine = nullptr;
-llvm::DataLayout*       LlvmEmulator::sm_pDataLayout      = nullptr;
+    virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+    {
+      VisitCondition(Type, pRefExpr, pTestExpr);
+      m_Kind = IfConditionNode;
+      m_pSubExprs[2] = pThenExpr;
+      return nullptr;
+    }
 
-static void* GetMemory(u8* pCpuCtxtObj, u8* pMemCtxtObj, TBase Base, TOffset Offset, u32 AccessSizeInBit)
-{
-  auto pCpuCtxt = reinterpret_cast<CpuContext*>(pCpuCtxtObj);
-  auto pMemCtxt = reinterpret_cast<MemoryContext*>(pMemCtxtObj);
-  void* pMemory;
+    virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+    {
+      VisitCondition(Type, pRefExpr, pTestExpr);
+      m_Kind = IfElseConditionNode;
+      m_pSubExprs[2] = pThenExpr;
+      m_pSubExprs[3] = pElseExpr;
+      return nullptr;
+    }
 
-  u64 LinAddr;
-  if (pCpuCtxt->Translate(Address(Base, Offset), LinAddr) == false)
-    LinAddr = Offset; // FIXME later
+    virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+    {
+      VisitCondition(Type, pRefExpr, pTestExpr);
+      m_Kind = WhileConditionNode;
+      m_pSubExprs[2] = pBodyExpr;
+      return nullptr;
+    }
+
+    virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+    {
+      m_Kind = OperationNode;
+      m_Type = Type;
+      m_pSubExprs[0] = pLeftExpr;
+      m_pSubExprs[1] = pRightExpr;
+      return nullptr;
+    }
+
+    virtual Expression* VisitConstant(u32 Type, u64 Value)
+    {
+      m_Kind  = ConstantNode;
+      m_Type  = Type;
+      m_Value = Value;
+      return nullptr;
+    }
+
+    virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo)
+    {
+      m_Kind = IdentifierNode;
+      m_Type = Id;
+      return nullptr;
+    }
+
+    virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+    {
+      m_Kind  = MemoryNode;
+      m_Type  = AccessSizeInBit;
+      m_Deref = Deref;
+      m_pSubExprs[0] = pBaseExpr;
+      m_pSubExprs[1] = pOffsetExpr;
+      return nullptr;
+    }
+
+    virtual Expression* VisitVariable(u32 SizeInBit, std::string const& rName)
+    {
+      m_Kind  = VariableNode;
+      m_Type  = SizeInBit;
+      m_pName = &rName;
+      return nullptr;
+    }
 
-  if (pMemCtxt->FindMemory(LinAddr, pMemory, AccessSizeInBit) == false)
+    Kind                    m_Kind;
+    u32                     m_Type;
+    u64                     m_Value;
+    Expression const*       m_pSubExprs[4];
+    Expression::List const* m_pExprList;
+    std::string const*      m_pName;
+    bool                    m_Deref;
+  };
+
+  // Values are truncated like ConstantExpression does
+  u64 GetValueMask(u32 SizeInBit)
   {
-    Log::Write("emul_llvm") << "Invalid memory access: linear address: " << LinAddr << LogEnd;
-    Log::Write("emul_llvm") << pMemCtxt->ToString() << LogEnd;
-    return nullptr;
+    if (SizeInBit == 0 || SizeInBit >= 64)
+      return ~0ULL;
+    return (1ULL << SizeInBit) - 1;
   }
-  return pMemory;
-}
 
-static llvm::Function* s_pGetMemoryFunc = nullptr;
+  // Each module contains one block, it's optimized when the block is materialized
+  llvm::Expected<llvm::orc::ThreadSafeModule> OptimizeModule(llvm::orc::ThreadSafeModule ThreadSafeMod, llvm::orc::MaterializationResponsibility const& rResp)
+  {
+    ThreadSafeMod.withModuleDo([](llvm::Module& rModule)
+    {
+      // Blocks compiled without optimization are marked optnone, the code generator honors it too
+      for (auto itFunc = std::begin(rModule); itFunc != std::end(rModule); ++itFunc)
+        if (!itFunc->isDeclaration() && itFunc->hasOptNone())
+          return;
+
+      llvm::LoopAnalysisManager     LoopAnalysisMgr;
+      llvm::FunctionAnalysisManager FuncAnalysisMgr;
+      llvm::CGSCCAnalysisManager    CgsccAnalysisMgr;
+      llvm::ModuleAnalysisManager   ModAnalysisMgr;
+
+      llvm::PassBuilder PassBld;
+      PassBld.registerModuleAnalyses(ModAnalysisMgr);
+      PassBld.registerCGSCCAnalyses(CgsccAnalysisMgr);
+      PassBld.registerFunctionAnalyses(FuncAnalysisMgr);
+      PassBld.registerLoopAnalyses(LoopAnalysisMgr);
+      PassBld.crossRegisterProxies(LoopAnalysisMgr, FuncAnalysisMgr, CgsccAnalysisMgr, ModAnalysisMgr);
+
+      auto ModPassMgr = PassBld.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O2);
+      ModPassMgr.run(rModule, ModAnalysisMgr);
+    });
+    return std::move(ThreadSafeMod);
+  }
+}
 
 LlvmEmulator::LlvmEmulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext *pMemCtxt)
-  : Emulator(pCpuInfo, pCpuCtxt, pMemCtxt, nullptr)
-  , m_Builder(llvm::getGlobalContext())
+  : Emulator(pCpuInfo, pCpuCtxt, pMemCtxt, new VariableContext)
+  , m_JitFailed(false), m_ModuleNo()
+  , m_Chaining(false), m_HasStopAddress(false), m_StopAddress(), m_LastExitAddress()
 {
-  m_pVarCtxt = new LlvmVariableContext(m_Builder);
-  llvm::InitializeNativeTarget();
-  llvm::InitializeNativeTargetAsmPrinter();
-  llvm::LLVMContext& rCtxt = llvm::getGlobalContext();
-  std::string ErrStr;
+  m_Runtime.m_pEmul      = this;
+  m_Runtime.m_pLastBlock = nullptr;
+  m_Runtime.m_Failed     = 0;
+
+  // The module manager creates an emulator without context to get its name
+  if (m_pMemCtxt == nullptr)
+    return;
+
+  // The interpreter sets its own code write callback, so it's created first
+  auto pGetInterpreter = ModuleManager::Instance().GetEmulator("interpreter");
+  if (pGetInterpreter != nullptr)
+    m_upInterpreter.reset(pGetInterpreter(pCpuInfo, pCpuCtxt, pMemCtxt));
 
-  if (sm_pModule == nullptr)
-    sm_pModule = new llvm::Module("medusa-emulator-llvm", rCtxt);
-  if (sm_pExecutionEngine == nullptr)
+  m_pMemCtxt->SetCodeWriteCallback([this](u64 PageAddress)
   {
-    sm_pExecutionEngine = llvm::EngineBuilder(sm_pModule).setUseMCJIT(false).setErrorStr(&ErrStr).create();
+    InvalidatePage(PageAddress);
+  });
+}
 
-    auto pChkStkType = llvm::FunctionType::get(llvm::Type::getVoidTy(llvm::getGlobalContext()), false);
-    llvm::IRBuilder<> ChkStkBld(llvm::getGlobalContext());
-    auto pChkStk = llvm::Function::Create(pChkStkType, llvm::GlobalValue::ExternalLinkage, "__chkstk", sm_pModule);
-    sm_pExecutionEngine->addGlobalMapping(pChkStk, (void*)0x1337);
-  }
-  if (sm_pExecutionEngine == nullptr)
-    Log::Write("emul_llvm") << "Error: " << ErrStr << LogEnd;
-  if (sm_pDataLayout == nullptr)
-    sm_pDataLayout = new llvm::DataLayout(sm_pModule);
+LlvmEmulator::~LlvmEmulator(void)
+{
+  if (m_pMemCtxt != nullptr)
+    m_pMemCtxt->SetCodeWriteCallback(nullptr);
+}
 
+LlvmEmulator::TranslatedBlock::~TranslatedBlock(void)
+{
+  if (m_spTracker)
+    llvm::consumeError(m_spTracker->remove());
+  for (auto itExpr = std::begin(m_Semantic); itExpr != std::end(m_Semantic); ++itExpr)
+    delete *itExpr;
+}
 
-  if (s_pGetMemoryFunc == nullptr)
+bool LlvmEmulator::InitializeJit(void)
+{
+  if (m_upJit != nullptr)
+    return true;
+  if (m_JitFailed)
+    return false;
+
+  // Targets are registered globally, emulators created on other threads must not do it again
+  static std::once_flag s_TargetInitialized;
+  std::call_once(s_TargetInitialized, []
   {
-    auto& rCtxt = llvm::getGlobalContext();
-    std::vector<llvm::Type*> Params;
-    Params.push_back(llvm::Type::getInt8PtrTy(rCtxt));
-    Params.push_back(llvm::Type::getInt8PtrTy(rCtxt));
-    Params.push_back(llvm::Type::getInt16Ty(rCtxt));
-    Params.push_back(llvm::Type::getInt64Ty(rCtxt));
-    Params.push_back(llvm::Type::getInt32Ty(rCtxt));
-    auto pGetMemoryFuncType = llvm::FunctionType::get(llvm::Type::getInt8PtrTy(rCtxt), Params, false);
-    s_pGetMemoryFunc = llvm::Function::Create(pGetMemoryFuncType, llvm::GlobalValue::ExternalLinkage, "GetMemory", sm_pModule);
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+  });
 
-    sm_pExecutionEngine->addGlobalMapping(s_pGetMemoryFunc, (void*)GetMemory);
+  auto ExpJit = llvm::orc::LLJITBuilder().create();
+  if (!ExpJit)
+  {
+    Log::Write("emul_llvm") << "Error: " << llvm::toString(ExpJit.takeError()) << LogEnd;
+    m_JitFailed = true;
+    return false;
   }
+  m_upJit = std::move(*ExpJit);
+  m_upJit->getIRTransformLayer().setTransform(OptimizeModule);
 
-  llvm::FunctionPassManager FuncPassMgr(sm_pModule);
-  FuncPassMgr.add(new llvm::DataLayout(*sm_pExecutionEngine->getDataLayout()));
-  FuncPassMgr.add(llvm::createBasicAliasAnalysisPass());
-  FuncPassMgr.add(llvm::createInstructionCombiningPass());
-  FuncPassMgr.add(llvm::createReassociatePass());
-  FuncPassMgr.add(llvm::createGVNPass());
-  FuncPassMgr.add(llvm::createCFGSimplificationPass());
-  FuncPassMgr.add(llvm::createPromoteMemoryToRegisterPass());
-  FuncPassMgr.add(llvm::createDeadCodeEliminationPass());
-  FuncPassMgr.doInitialization();
-}
+  // Generated code calls helpers by name
+  llvm::orc::SymbolMap Helpers;
+  auto AddHelper = [&](char const* pName, llvm::JITTargetAddress HelperAddr)
+  {
+    Helpers[m_upJit->mangleAndIntern(pName)] = llvm::JITEvaluatedSymbol(HelperAddr, llvm::JITSymbolFlags::Exported | llvm::JITSymbolFlags::Callable);
+  };
+  AddHelper("medusa_read_register",  llvm::pointerToJITTargetAddress(&ReadRegisterHelper));
+  AddHelper("medusa_write_register", llvm::pointerToJITTargetAddress(&WriteRegisterHelper));
+  AddHelper("medusa_translate",      llvm::pointerToJITTargetAddress(&TranslateHelper));
+  AddHelper("medusa_read_memory",    llvm::pointerToJITTargetAddress(&ReadMemoryHelper));
+  AddHelper("medusa_write_memory",   llvm::pointerToJITTargetAddress(&WriteMemoryHelper));
+  AddHelper("medusa_test_hook",      llvm::pointerToJITTargetAddress(&TestHookHelper));
+  AddHelper("medusa_execute_hook",   llvm::pointerToJITTargetAddress(&ExecuteHookHelper));
+
+  if (auto Err = m_upJit->getMainJITDylib().define(llvm::orc::absoluteSymbols(Helpers)))
+  {
+    Log::Write("emul_llvm") << "Error: " << llvm::toString(std::move(Err)) << LogEnd;
+    m_upJit.reset();
+    m_JitFailed = true;
+    return false;
+  }
 
-LlvmEmulator::~LlvmEmulator(void)
-{
+  m_ThreadSafeContext = llvm::orc::ThreadSafeContext(std::make_unique<llvm::LLVMContext>());
+  return true;
 }
 
 bool LlvmEmulator::Execute(Address const& rAddress, Expression const& rExpr)
 {
-  assert(0 && "Not implemented");
-  return false;
+  Expression::List ExprList;
+  ExprList.push_back(rExpr.Clone());
+  bool Res = Execute(rAddress, ExprList);
+  delete ExprList.front();
+  return Res;
 }
 
 bool LlvmEmulator::Execute(Address const& rAddress, Expression::List const& rExprList)
 {
-  auto RegPc = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister);
-  auto RegSz = m_pCpuInfo->GetSizeOfRegisterInBit(RegPc) / 8;
-  u64 CurPc  = 0;
-  m_pCpuCtxt->ReadRegister(RegPc, &CurPc, RegSz);
+  // The block is not kept, so it can't be chained either
+  u64 LinAddr = GetLinearAddress(rAddress);
+  if (m_upInterpreter != nullptr && !HasHooks() && IsSelfModifying(LinAddr & ~static_cast<u64>(MemoryContext::CodePageSize - 1)))
+  {
+    m_Runtime.m_pLastBlock = nullptr;
+    return m_upInterpreter->Execute(rAddress, rExprList);
+  }
+
+  auto upBlock = Compile(LinAddr, std::vector<Expression::List const*>(1, &rExprList), std::vector<u64>(1, LinAddr), false);
+  if (upBlock == nullptr)
+    return false;
+  bool Res = Run(upBlock.get());
+  m_Runtime.m_pLastBlock = nullptr;
+  return Res;
+}
 
-  static llvm::FunctionType* s_pExecFuncType = nullptr;
-  if (s_pExecFuncType == nullptr)
+bool LlvmEmulator::TranslateBlock(Address const& rAddress, u32 Size, Expression::List const& rExprList)
+{
+  u64 LinAddr = GetLinearAddress(rAddress);
+
+  // Writing to one of these pages means the block could have been modified
+  std::vector<u64> Pages;
+  u64 CurPage  = LinAddr & ~static_cast<u64>(MemoryContext::CodePageSize - 1);
+  u64 LastPage = (LinAddr + (Size != 0 ? Size - 1 : 0)) & ~static_cast<u64>(MemoryContext::CodePageSize - 1);
+  while (true)
   {
-    auto pBytePtrType = llvm::Type::getInt8PtrTy(llvm::getGlobalContext());
-    std::vector<llvm::Type*> Params;
-    Params.push_back(pBytePtrType);
-    Params.push_back(pBytePtrType);
-    Params.push_back(pBytePtrType);
-    s_pExecFuncType = llvm::FunctionType::get(llvm::Type::getVoidTy(llvm::getGlobalContext()), Params, false);
+    Pages.push_back(CurPage);
+    if (CurPage == LastPage)
+      break;
+    CurPage += MemoryContext::CodePageSize;
   }
 
-  u64 LinAddr;
-  if (m_pCpuCtxt->Translate(rAddress, LinAddr) == false)
-    return nullptr;
+  // Blocks of self-modifying code are compiled again soon, compiling them costs more than it saves.
+  // Execute interprets them, hooks are only tested by the generated code.
+  bool Optimize = true;
+  for (auto itPage = std::begin(Pages); itPage != std::end(Pages); ++itPage)
+    if (IsSelfModifying(*itPage))
+      Optimize = false;
+  if (!Optimize && m_upInterpreter != nullptr && !HasHooks())
+    return false;
+
+  auto upBlock = Compile(LinAddr, std::vector<Expression::List const*>(1, &rExprList), std::vector<u64>(1, LinAddr), false, Optimize);
+  if (upBlock == nullptr)
+    return false;
+  upBlock->m_Size       = Size;
+  upBlock->m_Pages      = Pages;
+  upBlock->m_TraceTried = !Optimize;
+  for (auto itExpr = std::begin(rExprList); itExpr != std::end(rExprList); ++itExpr)
+    upBlock->m_Semantic.push_back((*itExpr)->Clone());
+
+  if (RetireBlock(m_BlockCache, m_PageBlocks, LinAddr))
+    UnchainBlocks();
+  for (auto itPage = std::begin(Pages); itPage != std::end(Pages); ++itPage)
+    m_PageBlocks[*itPage].insert(LinAddr);
+  m_BlockCache[LinAddr] = std::move(upBlock);
+  m_pMemCtxt->MarkCodePages(LinAddr, Size);
+
+  return true;
+}
+
+bool LlvmEmulator::IsBlockTranslated(Address const& rAddress) const
+{
+  return m_BlockCache.find(GetLinearAddress(rAddress)) != std::end(m_BlockCache);
+}
+
+bool LlvmEmulator::ExecuteBlock(Address const& rAddress)
+{
+  u64 LinAddr = GetLinearAddress(rAddress);
+  auto itBlock = m_BlockCache.find(LinAddr);
+  if (itBlock == std::end(m_BlockCache))
+    return false;
+  auto pBlock = itBlock->second.get();
+
+  // Traces are only compiled while blocks are chained
+  auto itTrace = m_TraceCache.find(LinAddr);
+  if (itTrace != std::end(m_TraceCache))
+    pBlock = itTrace->second.get();
+
+  // The previous block jumped here, it can jump directly next time. Generated code compares
+  // the program pointer to the chain slots, so only blocks without address translation are chained.
+  auto pLastBlock = m_Runtime.m_pLastBlock;
+  if (m_Chaining && pLastBlock != nullptr && !HasHooks()
+    && m_LastExitAddress == rAddress.GetOffset() && LinAddr == rAddress.GetOffset()
+    && !(m_HasStopAddress && m_StopAddress == LinAddr))
+    Chain(pLastBlock, pBlock);
+
+  if (Run(pBlock) == false)
+    return false;
+
+  // A hot block returns here once, so a trace can be compiled from it
+  auto pHotBlock = m_Runtime.m_pLastBlock;
+  if (m_Chaining && !HasHooks() && pHotBlock != nullptr
+    && !pHotBlock->m_IsTrace && !pHotBlock->m_TraceTried && pHotBlock->m_ExecNo >= HotThreshold)
+  {
+    // Execution only measures TranslateBlock, traces are measured here
+    auto TranslationStart = std::chrono::steady_clock::now();
+    CompileTrace(pHotBlock);
+    m_TranslationTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - TranslationStart).count();
+  }
+
+  return true;
+}
+
+void LlvmEmulator::InvalidateBlocks(void)
+{
+  RetireTraces();
+  for (auto itBlock = std::begin(m_BlockCache); itBlock != std::end(m_BlockCache); ++itBlock)
+    m_RetiredBlocks.push_back(std::move(itBlock->second));
+  m_BlockCache.clear();
+  m_PageBlocks.clear();
+  m_Runtime.m_pLastBlock = nullptr;
+}
 
-  llvm::Function* pExecFunc = m_FunctionCache[LinAddr];
-  if (pExecFunc == nullptr)
+void LlvmEmulator::SetBlockChaining(bool Enable, Address const* pStopAddr)
+{
+  u64 StopAddress = pStopAddr != nullptr ? pStopAddr->GetOffset() : 0;
+  if (Enable == m_Chaining && (pStopAddr != nullptr) == m_HasStopAddress && StopAddress == m_StopAddress)
+    return;
+
+  m_Chaining       = Enable;
+  m_HasStopAddress = pStopAddr != nullptr;
+  m_StopAddress    = StopAddress;
+
+  // Existing chains and traces could lead to the stop address
+  RetireTraces();
+  UnchainBlocks();
+  for (auto itBlock = std::begin(m_BlockCache); itBlock != std::end(m_BlockCache); ++itBlock)
   {
-    pExecFunc = llvm::Function::Create(s_pExecFuncType, llvm::GlobalValue::ExternalLinkage, std::string("fn_") + rAddress.ToString(), sm_pModule);
+    itBlock->second->m_ExecNo     = 0;
+    itBlock->second->m_TraceTried = false;
+  }
+}
 
-    auto itParam          = pExecFunc->arg_begin();
-    auto pCpuCtxtParam    = itParam++;
-    auto pCpuCtxtObjParam = itParam++;
-    auto pMemCtxtObjParam = itParam;
+bool LlvmEmulator::AddHook(Address const& rAddress, u32 Size, u32 Type, HookCallback Callback)
+{
+  if (Emulator::AddHook(rAddress, Size, Type, Callback) == false)
+    return false;
+  InvalidateBlocks();
+  return true;
+}
 
-    auto pBscBlk = llvm::BasicBlock::Create(llvm::getGlobalContext(), "bb", pExecFunc);
-    m_Builder.SetInsertPoint(pBscBlk);
+bool LlvmEmulator::RemoveHook(Address const& rAddress)
+{
+  if (Emulator::RemoveHook(rAddress) == false)
+    return false;
+  InvalidateBlocks();
+  return true;
+}
 
+LlvmEmulator::TranslatedBlockPtr LlvmEmulator::Compile(u64 LinAddr, std::vector<Expression::List const*> const& rSemantics, std::vector<u64> const& rAddresses, bool Loop, bool Optimize)
+{
+  if (InitializeJit() == false)
+    return nullptr;
 
-    CpuContext::RegisterList RegList;
-    m_pCpuCtxt->GetRegisters(RegList);
-    std::for_each(std::begin(RegList), std::end(RegList), [&](u32 Reg)
-    {
-      u32  RegSize = m_pCpuInfo->GetSizeOfRegisterInBit(Reg);
-      auto RegName = m_pCpuInfo->ConvertIdentifierToName(Reg);
-      auto RegOff  = m_pCpuCtxt->GetRegisterOffset(Reg);
+  TranslatedBlockPtr upBlock(new TranslatedBlock);
+  upBlock->m_Address = LinAddr;
+  upBlock->m_IsTrace = rSemantics.size() > 1 || Loop;
 
-      assert(m_pVarCtxt->AllocateVariable(RegSize, RegName));
+  // A block can be translated again after being invalidated, so each translation has its own name
+  std::ostringstream NameStream;
+  NameStream << "blk_" << std::hex << LinAddr << "_" << std::dec << m_ModuleNo++;
+  std::string Name = NameStream.str();
 
-      auto pSrcPtr = m_Builder.CreateGEP(pCpuCtxtParam, llvm::ConstantInt::get(llvm::getGlobalContext(), llvm::APInt(32, RegOff)));
-      auto pValPtr = m_Builder.CreateBitCast(pSrcPtr, llvm::Type::getIntNPtrTy(llvm::getGlobalContext(), RegSize));
-      auto pVal = m_Builder.CreateLoad(pValPtr);
+  {
+    auto Lock = m_ThreadSafeContext.getLock();
+    auto& rCtxt = *m_ThreadSafeContext.getContext();
 
-      auto pVarPtr = reinterpret_cast<llvm::Value*>(m_pVarCtxt->GetVariable(RegName));
-      m_Builder.CreateStore(pVal, pVarPtr);
-    });
+    auto upModule = std::make_unique<llvm::Module>(Name, rCtxt);
+    upModule->setDataLayout(m_upJit->getDataLayout());
 
-    LlvmExpressionVisitor Visitor(m_Hooks, m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, m_Builder, pCpuCtxtParam, pCpuCtxtObjParam, pMemCtxtObjParam);
+    LlvmBlockCompiler Compiler(m_pCpuInfo, m_pCpuCtxt, m_RegLayout, HasHooks() ? m_HookFilter : nullptr, rCtxt, *upModule);
+    if (Compiler.Compile(rSemantics, rAddresses, Loop, Name, upBlock.get()) == false)
+      return nullptr;
+    if (!Optimize)
+    {
+      auto pFunc = upModule->getFunction(Name);
+      pFunc->addFnAttr(llvm::Attribute::OptimizeNone);
+      pFunc->addFnAttr(llvm::Attribute::NoInline);
+    }
 
-    for (auto itExpr = std::begin(rExprList); itExpr != std::end(rExprList); ++itExpr)
+    upBlock->m_spTracker = m_upJit->getMainJITDylib().createResourceTracker();
+    if (auto Err = m_upJit->addIRModule(upBlock->m_spTracker, llvm::orc::ThreadSafeModule(std::move(upModule), m_ThreadSafeContext)))
     {
-      Log::Write("emul_llvm") << "Compiling: " << (*itExpr)->ToString() << LogEnd;
-      auto itBscBlk = m_BasicBlockCache.find(CurPc);
-      if (itBscBlk == std::end(m_BasicBlockCache))
-      {
-        auto pCurExpr = (*itExpr)->Visit(&Visitor);
-        delete pCurExpr;
-      }
+      Log::Write("emul_llvm") << "Error: " << llvm::toString(std::move(Err)) << LogEnd;
+      return nullptr;
     }
+  }
 
-    m_Builder.CreateRetVoid();
-    m_FunctionCache[LinAddr] = pExecFunc;
+  // The module is optimized and compiled here
+  auto ExpSym = m_upJit->lookup(Name);
+  if (!ExpSym)
+  {
+    Log::Write("emul_llvm") << "Error: " << llvm::toString(ExpSym.takeError()) << LogEnd;
+    return nullptr;
   }
+  upBlock->m_pCode = reinterpret_cast<BlockCode>(static_cast<uintptr_t>(ExpSym->getAddress()));
+  return upBlock;
+}
 
-  pExecFunc->dump();
-  auto pCode = reinterpret_cast<BasicBlockCode>(sm_pExecutionEngine->getPointerToFunction(pExecFunc));
-  pCode(reinterpret_cast<u8*>(m_pCpuCtxt->GetContextAddress()), reinterpret_cast<u8*>(m_pCpuCtxt), reinterpret_cast<u8*>(m_pMemCtxt));
+bool LlvmEmulator::Run(TranslatedBlock* pBlock)
+{
+  m_Runtime.m_pLastBlock = nullptr;
+  m_Runtime.m_Failed     = 0;
+
+  pBlock->m_pCode(static_cast<u8*>(m_pCpuCtxt->GetContextAddress()), &m_Runtime);
 
-  m_pCpuCtxt->ReadRegister(RegPc, &CurPc, RegSz);
-  TestHook(Address(CurPc), Emulator::HookOnExecute);
+  // Invalidated blocks can be freed now that no generated code is running
+  m_RetiredBlocks.clear();
 
+  if (m_Runtime.m_Failed != 0)
+  {
+    m_Runtime.m_pLastBlock = nullptr;
+    return false;
+  }
+
+  auto RegPc = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister);
+  u64 CurPc  = 0;
+  m_RegLayout.Read(RegPc, CurPc);
+  m_LastExitAddress = CurPc;
   return true;
 }
 
-LlvmEmulator::LlvmVariableContext::LlvmVariableContext(llvm::IRBuilder<>& rBuilder) : m_rBuilder(rBuilder)
+void LlvmEmulator::CompileTrace(TranslatedBlock* pHeadBlock)
 {
-}
+  pHeadBlock->m_TraceTried = true;
 
-bool LlvmEmulator::LlvmVariableContext::ReadVariable(std::string const& rVariableName, u64& rValue) const
-{
-  return false;
+  // The trace follows the first successor recorded in the chain slots
+  std::vector<TranslatedBlock*> Blocks(1, pHeadBlock);
+  bool Loop = false;
+  auto pCurBlock = pHeadBlock;
+  while (Blocks.size() < MaxTraceBlockNo)
+  {
+    auto const& rSlot = pCurBlock->m_Chains[0];
+    if (rSlot.m_pCode == nullptr)
+      break;
+    if (rSlot.m_Address == pHeadBlock->m_Address)
+    {
+      Loop = true;
+      break;
+    }
+    auto itBlock = m_BlockCache.find(rSlot.m_Address);
+    if (itBlock == std::end(m_BlockCache))
+      break;
+    pCurBlock = itBlock->second.get();
+    if (m_HasStopAddress && pCurBlock->m_Address == m_StopAddress)
+      break;
+    if (std::find(std::begin(Blocks), std::end(Blocks), pCurBlock) != std::end(Blocks))
+      break;
+    Blocks.push_back(pCurBlock);
+  }
+
+  // A single block without loop wouldn't be faster
+  if (Blocks.size() == 1 && !Loop)
+    return;
+
+  std::vector<Expression::List const*> Semantics;
+  std::vector<u64> Addresses;
+  for (auto itBlock = std::begin(Blocks); itBlock != std::end(Blocks); ++itBlock)
+  {
+    Semantics.push_back(&(*itBlock)->m_Semantic);
+    Addresses.push_back((*itBlock)->m_Address);
+  }
+
+  auto upTrace = Compile(pHeadBlock->m_Address, Semantics, Addresses, Loop);
+  if (upTrace == nullptr)
+    return;
+
+  // The trace is removed if any of its blocks is modified
+  for (auto itBlock = std::begin(Blocks); itBlock != std::end(Blocks); ++itBlock)
+    for (auto itPage = std::begin((*itBlock)->m_Pages); itPage != std::end((*itBlock)->m_Pages); ++itPage)
+      if (std::find(std::begin(upTrace->m_Pages), std::end(upTrace->m_Pages), *itPage) == std::end(upTrace->m_Pages))
+        upTrace->m_Pages.push_back(*itPage);
+
+  RetireBlock(m_TraceCache, m_PageTraces, pHeadBlock->m_Address);
+  for (auto itPage = std::begin(upTrace->m_Pages); itPage != std::end(upTrace->m_Pages); ++itPage)
+    m_PageTraces[*itPage].insert(pHeadBlock->m_Address);
+
+  // Blocks chained to the first block must now jump to the trace
+  m_TraceCache[pHeadBlock->m_Address] = std::move(upTrace);
+  UnchainBlocks();
 }
 
-bool LlvmEmulator::LlvmVariableContext::WriteVariable(std::string const& rVariableName, u64 Value, bool SignExtend)
+void LlvmEmulator::RetireTraces(void)
 {
-  return false;
+  for (auto itTrace = std::begin(m_TraceCache); itTrace != std::end(m_TraceCache); ++itTrace)
+    m_RetiredBlocks.push_back(std::move(itTrace->second));
+  m_TraceCache.clear();
+  m_PageTraces.clear();
+  m_Runtime.m_pLastBlock = nullptr;
 }
 
-bool LlvmEmulator::LlvmVariableContext::AllocateVariable(u32 Type, std::string const& rVariableName)
+bool LlvmEmulator::RetireBlock(BlockCacheType& rCache, PageBlocksType& rPageBlocks, u64 LinAddr)
 {
-  FreeVariable(rVariableName);
+  auto itBlock = rCache.find(LinAddr);
+  if (itBlock == std::end(rCache))
+    return false;
 
-  auto pAlloca = m_rBuilder.CreateAlloca(llvm::Type::getIntNTy(llvm::getGlobalContext(), Type), 0, rVariableName);
-  auto pVarVal = m_rBuilder.CreateBitCast(pAlloca, llvm::Type::getIntNPtrTy(llvm::getGlobalContext(), Type));
+  auto const& rPages = itBlock->second->m_Pages;
+  for (auto itPage = std::begin(rPages); itPage != std::end(rPages); ++itPage)
+  {
+    auto itPageBlocks = rPageBlocks.find(*itPage);
+    if (itPageBlocks == std::end(rPageBlocks))
+      continue;
+    itPageBlocks->second.erase(LinAddr);
+    if (itPageBlocks->second.empty())
+      rPageBlocks.erase(itPageBlocks);
+  }
 
-  m_Variables[rVariableName] = VariableInformation(Type, pVarVal);
+  m_RetiredBlocks.push_back(std::move(itBlock->second));
+  rCache.erase(itBlock);
   return true;
 }
 
-std::string LlvmEmulator::LlvmVariableContext::ToString(void) const
+void LlvmEmulator::Chain(TranslatedBlock* pFromBlock, TranslatedBlock* pToBlock)
 {
-  return "";
+  for (u32 i = 0; i < ChainSlotNo; ++i)
+  {
+    auto& rSlot = pFromBlock->m_Chains[i];
+    if (rSlot.m_pCode == nullptr || rSlot.m_Address == pToBlock->m_Address)
+    {
+      rSlot.m_Address = pToBlock->m_Address;
+      rSlot.m_pCode   = pToBlock->m_pCode;
+      return;
+    }
+  }
+
+  // All slots are used, the last one is replaced
+  auto& rLastSlot = pFromBlock->m_Chains[ChainSlotNo - 1];
+  rLastSlot.m_Address = pToBlock->m_Address;
+  rLastSlot.m_pCode   = pToBlock->m_pCode;
 }
 
-LlvmEmulator::LlvmExpressionVisitor::LlvmExpressionVisitor(
-  HookAddressHashMap const& Hooks
-  , CpuContext* pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt
-  , llvm::IRBuilder<>& rBuilder, llvm::Value* pCpuCtxtParam, llvm::Value* pCpuCtxtObjParam, llvm::Value* pMemCtxtObjParam)
-  : m_rHooks(Hooks), m_pCpuCtxt(pCpuCtxt), m_pMemCtxt(pMemCtxt), m_pVarCtxt(pVarCtxt)
-  , m_rBuilder(rBuilder), m_pCpuCtxtParam(pCpuCtxtParam), m_pCpuCtxtObjParam(pCpuCtxtObjParam), m_pMemCtxtObjParam(pMemCtxtObjParam)
+void LlvmEmulator::UnchainBlocks(void)
 {
+  for (auto itBlock = std::begin(m_BlockCache); itBlock != std::end(m_BlockCache); ++itBlock)
+    itBlock->second->UnchainSlots();
+  for (auto itTrace = std::begin(m_TraceCache); itTrace != std::end(m_TraceCache); ++itTrace)
+    itTrace->second->UnchainSlots();
+  m_Runtime.m_pLastBlock = nullptr;
 }
 
-Expression* LlvmEmulator::LlvmExpressionVisitor::VisitBind(Expression::List const& rExprList)
+u64 LlvmEmulator::GetLinearAddress(Address const& rAddress) const
 {
-  std::for_each(std::begin(rExprList), std::end(rExprList), [&](Expression const* pExpr)
-  { pExpr->Visit(this); });
-  return nullptr;
+  u64 LinAddr;
+  if (m_pCpuCtxt->Translate(rAddress, LinAddr) == false)
+    LinAddr = rAddress.GetOffset();
+  return LinAddr;
 }
 
-Expression* LlvmEmulator::LlvmExpressionVisitor::VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+void LlvmEmulator::InvalidatePage(u64 PageAddress)
 {
-  llvm::Value* pCondVal = nullptr,* pRefVal = nullptr,* pTestVal = nullptr;
-
-  pRefExpr->Visit(this);
-  pTestExpr->Visit(this);
+  ++m_PageInvalidationNo[PageAddress];
 
-  if (m_ValueStack.size() < 2)
+  // Blocks can be invalidated by their own writes, their code is freed after they return.
+  // RetireBlock updates the list of this page too, so it's copied first.
+  bool Retired = false;
+  auto itTracePage = m_PageTraces.find(PageAddress);
+  if (itTracePage != std::end(m_PageTraces))
   {
-    assert(0 && "Unable to JIT condition expression");
-    return nullptr;
+    auto TraceAddrs = itTracePage->second;
+    for (auto itTraceAddr = std::begin(TraceAddrs); itTraceAddr != std::end(TraceAddrs); ++itTraceAddr)
+      Retired |= RetireBlock(m_TraceCache, m_PageTraces, *itTraceAddr);
   }
 
-  pTestVal = std::get<1>(m_ValueStack.top());
-  m_ValueStack.pop();
-  pRefVal = std::get<1>(m_ValueStack.top());
-  m_ValueStack.pop();
-
-  switch (Type)
+  auto itPage = m_PageBlocks.find(PageAddress);
+  if (itPage != std::end(m_PageBlocks))
   {
-  case ConditionExpression::CondEq:  pCondVal = m_rBuilder.CreateICmpEQ(pRefVal, pTestVal); break;
-  case ConditionExpression::CondNe:  pCondVal = m_rBuilder.CreateICmpNE(pRefVal, pTestVal); break;
-  case ConditionExpression::CondSge: pCondVal = m_rBuilder.CreateICmpSGE(pRefVal, pTestVal); break;
-  case ConditionExpression::CondSgt: pCondVal = m_rBuilder.CreateICmpSGT(pRefVal, pTestVal); break;
-  case ConditionExpression::CondSle: pCondVal = m_rBuilder.CreateICmpSLE(pRefVal, pTestVal); break;
-  case ConditionExpression::CondSlt: pCondVal = m_rBuilder.CreateICmpSLT(pRefVal, pTestVal); break;
-  case ConditionExpression::CondUge: pCondVal = m_rBuilder.CreateICmpUGE(pRefVal, pTestVal); break;
-  case ConditionExpression::CondUgt: pCondVal = m_rBuilder.CreateICmpUGT(pRefVal, pTestVal); break;
-  case ConditionExpression::CondUle: pCondVal = m_rBuilder.CreateICmpULE(pRefVal, pTestVal); break;
-  case ConditionExpression::CondUlt: pCondVal = m_rBuilder.CreateICmpULT(pRefVal, pTestVal); break;
-
-  case ConditionExpression::CondUnk:
-  default:
-    return nullptr;
+    auto BlkAddrs = itPage->second;
+    for (auto itBlkAddr = std::begin(BlkAddrs); itBlkAddr != std::end(BlkAddrs); ++itBlkAddr)
+      Retired |= RetireBlock(m_BlockCache, m_PageBlocks, *itBlkAddr);
   }
 
-  m_ValueStack.push(std::make_tuple(nullptr, pCondVal));
+  // Any block could be chained to a removed one
+  if (Retired)
+    UnchainBlocks();
+}
 
-  return nullptr; // TODO
+bool LlvmEmulator::IsSelfModifying(u64 PageAddress) const
+{
+  auto itInvNo = m_PageInvalidationNo.find(PageAddress);
+  return itInvNo != std::end(m_PageInvalidationNo) && itInvNo->second >= SelfModifyingThreshold;
 }
 
-Expression* LlvmEmulator::LlvmExpressionVisitor::VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+u64 LlvmEmulator::ReadRegisterHelper(Runtime* pRuntime, u32 Register, u32 Size)
 {
-  VisitCondition(Type, pRefExpr, pTestExpr);
-  if (m_ValueStack.empty())
-  {
-    assert(0 && "Unable to JIT condition expression");
-    return nullptr;
-  }
+  u64 Value = 0;
+  if (pRuntime->m_pEmul->m_pCpuCtxt->ReadRegister(Register, &Value, Size) == false)
+    pRuntime->m_Failed = 1;
+  return Value;
+}
 
-  auto pCondVal = std::get<1>(m_ValueStack.top());
-  m_ValueStack.pop();
+void LlvmEmulator::WriteRegisterHelper(Runtime* pRuntime, u32 Register, u64 Value, u32 Size)
+{
+  pRuntime->m_pEmul->m_pCpuCtxt->WriteRegister(Register, &Value, Size);
+}
 
-  auto pFunc = m_rBuilder.GetInsertBlock()->getParent();
-  auto pThenBasicBlock   = llvm::BasicBlock::Create(llvm::getGlobalContext(), "then", pFunc);
-  auto pMergedBasicBlock = llvm::BasicBlock::Create(llvm::getGlobalContext(), "merged", pFunc);
-  auto pIfCondVal        = m_rBuilder.CreateCondBr(pCondVal, pThenBasicBlock, pMergedBasicBlock);
+u64 LlvmEmulator::TranslateHelper(Runtime* pRuntime, u16 Base, u64 Offset)
+{
+  u64 LinAddr;
+  if (pRuntime->m_pEmul->m_pCpuCtxt->Translate(Address(Base, Offset), LinAddr) == false)
+    LinAddr = Offset;
+  return LinAddr;
+}
 
-  m_rBuilder.SetInsertPoint(pThenBasicBlock);
-  LlvmExpressionVisitor ThenVisitor(m_rHooks, m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, m_rBuilder, m_pCpuCtxtParam, m_pCpuCtxtObjParam, m_pMemCtxtObjParam);
-  pThenExpr->Visit(&ThenVisitor);
-  ThenVisitor.ClearValues();
-  m_rBuilder.CreateBr(pMergedBasicBlock);
+u64 LlvmEmulator::ReadMemoryHelper(Runtime* pRuntime, u64 LinearAddress, u32 Size)
+{
+  u64 Value = 0;
+  if (pRuntime->m_pEmul->m_pMemCtxt->ReadMemory(LinearAddress, &Value, Size) == false)
+    pRuntime->m_Failed = 1;
+  return Value;
+}
+
+void LlvmEmulator::WriteMemoryHelper(Runtime* pRuntime, u64 LinearAddress, u64 Value, u32 Size)
+{
+  pRuntime->m_pEmul->m_pMemCtxt->WriteMemory(LinearAddress, &Value, Size);
+}
 
-  m_rBuilder.SetInsertPoint(pMergedBasicBlock);
+void LlvmEmulator::TestHookHelper(Runtime* pRuntime, u16 Base, u64 Offset, u32 Type)
+{
+  pRuntime->m_pEmul->TestHook(Address(Base, Offset), Type);
+}
 
-  return nullptr; // TODO
+void LlvmEmulator::ExecuteHookHelper(Runtime* pRuntime)
+{
+  auto pEmul = pRuntime->m_pEmul;
+  auto RegPc = pEmul->m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister);
+  u64 CurPc  = 0;
+  pEmul->m_RegLayout.Read(RegPc, CurPc);
+  pEmul->TestHook(Address(CurPc), Emulator::HookOnExecute);
 }
 
-Expression* LlvmEmulator::LlvmExpressionVisitor::VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+LlvmEmulator::LlvmBlockCompiler::LlvmBlockCompiler(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, RegisterLayout& rRegLayout, u8 const* pHookFilter, llvm::LLVMContext& rCtxt, llvm::Module& rModule)
+  : m_pCpuInfo(pCpuInfo), m_pCpuCtxt(pCpuCtxt), m_rRegLayout(rRegLayout), m_pHookFilter(pHookFilter)
+  , m_rCtxt(rCtxt), m_rModule(rModule), m_Builder(rCtxt)
+  , m_pFunc(nullptr), m_pEntryBlock(nullptr), m_pExitBlock(nullptr), m_pCpuCtxtParam(nullptr), m_pRuntimeParam(nullptr), m_MayFail(false)
+  , m_ContextSize(pCpuCtxt->GetContextSize())
 {
-  VisitCondition(Type, pRefExpr, pTestExpr);
-  if (m_ValueStack.empty())
+}
+
+bool LlvmEmulator::LlvmBlockCompiler::Compile(std::vector<Expression::List const*> const& rSemantics, std::vector<u64> const& rAddresses, bool Loop, std::string const& rName, TranslatedBlock* pBlock)
+{
+  u32 RegPc = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister);
+  if (RegPc == CpuInformation::InvalidRegister || rSemantics.empty() || rSemantics.size() != rAddresses.size())
+    return false;
+  Location PcLoc;
+  PcLoc.m_Type      = Location::RegisterLocation;
+  PcLoc.m_Id        = RegPc;
+  PcLoc.m_SizeInBit = m_pCpuInfo->GetSizeOfRegisterInBit(RegPc);
+
+  auto pBytePtrType = llvm::Type::getInt8PtrTy(m_rCtxt);
+  auto pInt32Type   = llvm::Type::getInt32Ty(m_rCtxt);
+  auto pFuncType    = llvm::FunctionType::get(llvm::Type::getVoidTy(m_rCtxt), { pBytePtrType, pBytePtrType }, false);
+  m_pFunc = llvm::Function::Create(pFuncType, llvm::GlobalValue::ExternalLinkage, rName, &m_rModule);
+
+  auto itParam    = m_pFunc->arg_begin();
+  m_pCpuCtxtParam = &*itParam++;
+  m_pRuntimeParam = &*itParam;
+
+  m_pEntryBlock = llvm::BasicBlock::Create(m_rCtxt, "entry", m_pFunc);
+  m_pExitBlock  = llvm::BasicBlock::Create(m_rCtxt, "exit",  m_pFunc);
+
+  std::vector<llvm::BasicBlock*> Blocks;
+  for (std::size_t i = 0; i < rSemantics.size(); ++i)
+    Blocks.push_back(llvm::BasicBlock::Create(m_rCtxt, "blk", m_pFunc, m_pExitBlock));
+
+  // Blocks invalidated while running are not chained from, so the block is recorded first
+  m_Builder.SetInsertPoint(m_pEntryBlock);
+  auto pLastBlockPtr = MakeFieldPointer(m_pRuntimeParam, offsetof(Runtime, m_pLastBlock), 0);
+  m_Builder.CreateStore(MakePointer(pBlock), pLastBlockPtr);
+
+  // Only blocks are counted, traces are compiled from them
+  llvm::Value* pExecNo = nullptr;
+  if (!pBlock->m_IsTrace)
   {
-    assert(0 && "Unable to JIT condition expression");
-    return nullptr;
+    auto pExecNoPtr = m_Builder.CreateBitCast(MakePointer(&pBlock->m_ExecNo), pInt32Type->getPointerTo());
+    pExecNo = m_Builder.CreateAdd(m_Builder.CreateLoad(pInt32Type, pExecNoPtr), MakeInteger(32, 1));
+    m_Builder.CreateStore(pExecNo, pExecNoPtr);
   }
+  m_Builder.CreateBr(Blocks.front());
 
-  auto pCondVal = std::get<1>(m_ValueStack.top());
-  m_ValueStack.pop();
-
-  auto pFunc = m_rBuilder.GetInsertBlock()->getParent();
-  auto pMergedBasicBlock = llvm::BasicBlock::Create(llvm::getGlobalContext(), "merged", pFunc);
-  auto pThenBasicBlock   = llvm::BasicBlock::Create(llvm::getGlobalContext(), "then",   pFunc);
-  auto pElseBasicBlock   = llvm::BasicBlock::Create(llvm::getGlobalContext(), "else",   pFunc);
+  for (std::size_t i = 0; i < rSemantics.size(); ++i)
+  {
+    m_Builder.SetInsertPoint(Blocks[i]);
+    auto const& rExprList = *rSemantics[i];
+    for (auto itExpr = std::begin(rExprList); itExpr != std::end(rExprList); ++itExpr)
+    {
+      m_MayFail = false;
+      if (CompileStatement(*itExpr) == false)
+        return false;
 
-  auto pOriginBlock = m_rBuilder.GetInsertBlock();
+      // Like the interpreter, execute hooks are tested after each statement
+      if (m_pHookFilter != nullptr)
+        CompileExecuteHook();
 
-  m_rBuilder.SetInsertPoint(pThenBasicBlock);
-  LlvmExpressionVisitor ThenVisitor(m_rHooks, m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, m_rBuilder, m_pCpuCtxtParam, m_pCpuCtxtObjParam, m_pMemCtxtObjParam);
-  pThenExpr->Visit(&ThenVisitor);
-  m_rBuilder.CreateBr(pMergedBasicBlock);
+      // Like the interpreter, the block stops after a failing statement
+      if (m_MayFail)
+        CompileFailureCheck();
+    }
 
-  m_rBuilder.SetInsertPoint(pElseBasicBlock);
-  LlvmExpressionVisitor ElseVisitor(m_rHooks, m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, m_rBuilder, m_pCpuCtxtParam, m_pCpuCtxtObjParam, m_pMemCtxtObjParam);
-  pElseExpr->Visit(&ElseVisitor);
-  m_rBuilder.CreateBr(pMergedBasicBlock);
+    // The trace goes on only if the program pointer reaches the next block (side exit otherwise),
+    // and it's left if one of its blocks has been invalidated
+    bool IsLast = i + 1 == rSemantics.size();
+    if (IsLast && !Loop)
+    {
+      m_Builder.CreateBr(m_pExitBlock);
+      continue;
+    }
+    std::size_t NextIdx = IsLast ? 0 : i + 1;
+    Value PcVal;
+    CompileLoad(PcLoc, PcVal);
+    auto pCurLastBlock = m_Builder.CreateLoad(pBytePtrType, pLastBlockPtr);
+    auto pGoOn = m_Builder.CreateAnd(
+      m_Builder.CreateICmpEQ(PcVal.m_pValue, MakeInteger(64, rAddresses[NextIdx])),
+      m_Builder.CreateICmpEQ(pCurLastBlock, MakePointer(pBlock)));
+    m_Builder.CreateCondBr(pGoOn, Blocks[NextIdx], m_pExitBlock);
+  }
 
-  m_rBuilder.SetInsertPoint(pOriginBlock);
-  auto pIfCondVal        = m_rBuilder.CreateCondBr(pCondVal, pThenBasicBlock, pElseBasicBlock);
+  m_Builder.SetInsertPoint(m_pExitBlock);
+  auto pFailed = m_Builder.CreateLoad(pInt32Type, MakeFieldPointer(m_pRuntimeParam, offsetof(Runtime, m_Failed), 32));
+  auto pChainBlock = llvm::BasicBlock::Create(m_rCtxt, "chain", m_pFunc);
+  auto pRetBlock   = llvm::BasicBlock::Create(m_rCtxt, "ret",   m_pFunc);
+  auto pCanChain   = m_Builder.CreateICmpEQ(pFailed, MakeInteger(32, 0));
 
-  m_rBuilder.SetInsertPoint(pMergedBasicBlock);
+  // A hot block returns once to the emulator, so it can compile a trace
+  if (pExecNo != nullptr)
+    pCanChain = m_Builder.CreateAnd(pCanChain, m_Builder.CreateICmpNE(pExecNo, MakeInteger(32, HotThreshold)));
+  m_Builder.CreateCondBr(pCanChain, pChainBlock, pRetBlock);
+  m_Builder.SetInsertPoint(pRetBlock);
+  m_Builder.CreateRetVoid();
 
-  m_ValueStack.push(std::make_tuple(nullptr, pIfCondVal));
+  m_Builder.SetInsertPoint(pChainBlock);
+  CompileChaining(pBlock);
 
-  return nullptr; // TODO
+  FinalizeWords();
+  return true;
 }
 
-Expression* LlvmEmulator::LlvmExpressionVisitor::VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+bool LlvmEmulator::LlvmBlockCompiler::CompileStatement(Expression const* pExpr)
 {
-  return nullptr; // TODO
-}
+  ExpressionNode Node(pExpr);
 
-Expression* LlvmEmulator::LlvmExpressionVisitor::VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
-{
-  pLeftExpr->Visit(this);
-  pRightExpr->Visit(this);
+  switch (Node.m_Kind)
+  {
+  case ExpressionNode::BindNode:
+    for (auto itExpr = std::begin(*Node.m_pExprList); itExpr != std::end(*Node.m_pExprList); ++itExpr)
+      if (CompileStatement(*itExpr) == false)
+        return false;
+    return true;
+
+  case ExpressionNode::ConditionNode:
+    {
+      llvm::Value* pCond;
+      return CompileCondition(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], pCond);
+    }
+
+  case ExpressionNode::IfConditionNode:
+    {
+      llvm::Value* pCond;
+      if (CompileCondition(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], pCond) == false)
+        return false;
+      auto pThenBlock   = llvm::BasicBlock::Create(m_rCtxt, "then",   m_pFunc);
+      auto pMergedBlock = llvm::BasicBlock::Create(m_rCtxt, "merged", m_pFunc);
+      m_Builder.CreateCondBr(pCond, pThenBlock, pMergedBlock);
+
+      m_Builder.SetInsertPoint(pThenBlock);
+      if (CompileStatement(Node.m_pSubExprs[2]) == false)
+        return false;
+      m_Builder.CreateBr(pMergedBlock);
+
+      m_Builder.SetInsertPoint(pMergedBlock);
+      return true;
+    }
+
+  case ExpressionNode::IfElseConditionNode:
+    {
+      llvm::Value* pCond;
+      if (CompileCondition(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], pCond) == false)
+        return false;
+      auto pThenBlock   = llvm::BasicBlock::Create(m_rCtxt, "then",   m_pFunc);
+      auto pElseBlock   = llvm::BasicBlock::Create(m_rCtxt, "else",   m_pFunc);
+      auto pMergedBlock = llvm::BasicBlock::Create(m_rCtxt, "merged", m_pFunc);
+      m_Builder.CreateCondBr(pCond, pThenBlock, pElseBlock);
+
+      m_Builder.SetInsertPoint(pThenBlock);
+      if (CompileStatement(Node.m_pSubExprs[2]) == false)
+        return false;
+      m_Builder.CreateBr(pMergedBlock);
+
+      m_Builder.SetInsertPoint(pElseBlock);
+      if (CompileStatement(Node.m_pSubExprs[3]) == false)
+        return false;
+      m_Builder.CreateBr(pMergedBlock);
+
+      m_Builder.SetInsertPoint(pMergedBlock);
+      return true;
+    }
 
-  llvm::Value* pLeftPointer  = nullptr;
-  llvm::Value* pRightPointer = nullptr;
-  llvm::Value* pLeftValue    = nullptr;
-  llvm::Value* pRightValue   = nullptr;
+  case ExpressionNode::WhileConditionNode:
+    {
+      auto pCondBlock   = llvm::BasicBlock::Create(m_rCtxt, "while", m_pFunc);
+      auto pBodyBlock   = llvm::BasicBlock::Create(m_rCtxt, "body",  m_pFunc);
+      auto pMergedBlock = llvm::BasicBlock::Create(m_rCtxt, "done",  m_pFunc);
+      m_Builder.CreateBr(pCondBlock);
+
+      // The loop also stops if its body fails
+      m_Builder.SetInsertPoint(pCondBlock);
+      llvm::Value* pCond;
+      if (CompileCondition(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], pCond) == false)
+        return false;
+      auto pFailed = m_Builder.CreateLoad(llvm::Type::getInt32Ty(m_rCtxt), MakeFieldPointer(m_pRuntimeParam, offsetof(Runtime, m_Failed), 32));
+      pCond = m_Builder.CreateAnd(pCond, m_Builder.CreateICmpEQ(pFailed, MakeInteger(32, 0)));
+      m_Builder.CreateCondBr(pCond, pBodyBlock, pMergedBlock);
+
+      m_Builder.SetInsertPoint(pBodyBlock);
+      if (CompileStatement(Node.m_pSubExprs[2]) == false)
+        return false;
+      m_Builder.CreateBr(pCondBlock);
+
+      m_Builder.SetInsertPoint(pMergedBlock);
+      return true;
+    }
 
-  assert(m_ValueStack.size() >= 2 && "Not enough value for operation");
+  case ExpressionNode::OperationNode:
+    return CompileOperation(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], nullptr);
 
-  pRightPointer = std::get<0>(m_ValueStack.top());
-  pRightValue = std::get<1>(m_ValueStack.top());
-  m_ValueStack.pop();
+  case ExpressionNode::ConstantNode:
+  case ExpressionNode::IdentifierNode:
+  case ExpressionNode::MemoryNode:
+    return true;
 
-  pLeftPointer = std::get<0>(m_ValueStack.top());
-  pLeftValue = std::get<1>(m_ValueStack.top());
-  m_ValueStack.pop();
+  case ExpressionNode::VariableNode:
+    if (Node.m_Type != 0)
+      m_Builder.CreateStore(MakeInteger(64, 0), AllocateVariable(*Node.m_pName));
+    return true;
 
-  llvm::Value* pResult = nullptr;
+  default:
+    return false;
+  }
+}
 
-#define LLVM_OP_CASE(op_type)\
-  case OperationExpression::Op##op_type:\
-  if (pLeftValue == nullptr || pRightValue == nullptr)\
-  {\
-  assert(0 && "Error while JIT operation " #op_type);\
-  break;\
-  }\
-  pResult = m_rBuilder.Create##op_type(pLeftValue, pRightValue);
+bool LlvmEmulator::LlvmBlockCompiler::CompileValue(Expression const* pExpr, bool SignExtend, Value& rValue)
+{
+  ExpressionNode Node(pExpr);
 
-  switch (Type)
+  switch (Node.m_Kind)
   {
-    LLVM_OP_CASE(Add ); break;
-    LLVM_OP_CASE(Sub ); break;
-    LLVM_OP_CASE(Mul ); break;
-    LLVM_OP_CASE(UDiv); break;
-    LLVM_OP_CASE(SDiv); break;
-    LLVM_OP_CASE(And ); break;
-    LLVM_OP_CASE(Or  ); break;
-    LLVM_OP_CASE(Xor ); break;
+  case ExpressionNode::ConstantNode:
+    rValue.m_pValue    = MakeInteger(64, Node.m_Value & GetValueMask(Node.m_Type));
+    rValue.m_SizeInBit = Node.m_Type;
+    return true;
 
-  case OperationExpression::OpAff:
-    if (pLeftPointer == nullptr || pRightValue == nullptr)
+  case ExpressionNode::IdentifierNode:
+  case ExpressionNode::VariableNode:
     {
-      assert(0 && "Error while JIT affectation");
-      break;
+      Location Loc;
+      if (CompileLocation(pExpr, Loc) == false)
+        return false;
+      if (CompileLoad(Loc, rValue) == false)
+        return false;
+
+      // Only registers are sign extended by ContextExpression::Read
+      if (SignExtend && Node.m_Kind == ExpressionNode::IdentifierNode)
+        switch (rValue.m_SizeInBit)
+        {
+        case 8: case 16: case 32:
+          rValue.m_pValue = m_Builder.CreateSExt(
+            m_Builder.CreateTrunc(rValue.m_pValue, llvm::Type::getIntNTy(m_rCtxt, rValue.m_SizeInBit)),
+            llvm::Type::getInt64Ty(m_rCtxt));
+          break;
+        default:
+          break;
+        }
+      return true;
     }
-    pResult = m_rBuilder.CreateStore(pRightValue, pLeftPointer, true);
-    break;
 
+  case ExpressionNode::MemoryNode:
+    {
+      Location Loc;
+      Loc.m_Type      = Location::MemoryLocation;
+      Loc.m_SizeInBit = Node.m_Type;
+      if (CompileAddress(Node.m_pSubExprs[0], Node.m_pSubExprs[1], Loc) == false)
+        return false;
+
+      if (Node.m_Deref == false)
+      {
+        rValue.m_pValue    = Loc.m_pLinAddr;
+        rValue.m_SizeInBit = Node.m_Type;
+        return true;
+      }
+      return CompileLoad(Loc, rValue);
+    }
+
+  case ExpressionNode::OperationNode:
+    return CompileOperation(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], &rValue);
+
+  case ExpressionNode::ConditionNode:
+    {
+      llvm::Value* pCond;
+      if (CompileCondition(Node.m_Type, Node.m_pSubExprs[0], Node.m_pSubExprs[1], pCond) == false)
+        return false;
+      rValue.m_pValue    = m_Builder.CreateZExt(pCond, llvm::Type::getInt64Ty(m_rCtxt));
+      rValue.m_SizeInBit = ConstantExpression::Const1Bit;
+      return true;
+    }
+
+  // Statements can't be used as value
   default:
-    break;
+    return false;
   }
+}
 
-  if (pResult)
+bool LlvmEmulator::LlvmBlockCompiler::CompileLocation(Expression const* pExpr, Location& rLoc)
+{
+  ExpressionNode Node(pExpr);
+
+  switch (Node.m_Kind)
   {
-    m_ValueStack.push(std::make_tuple(nullptr, pResult));
-  }
+  case ExpressionNode::IdentifierNode:
+    rLoc.m_Type      = Location::RegisterLocation;
+    rLoc.m_Id        = Node.m_Type;
+    rLoc.m_SizeInBit = m_pCpuInfo->GetSizeOfRegisterInBit(Node.m_Type);
+    return true;
+
+  case ExpressionNode::MemoryNode:
+    if (Node.m_Deref == false)
+      return false;
+    rLoc.m_Type      = Location::MemoryLocation;
+    rLoc.m_SizeInBit = Node.m_Type;
+    return CompileAddress(Node.m_pSubExprs[0], Node.m_pSubExprs[1], rLoc);
+
+  case ExpressionNode::VariableNode:
+    {
+      rLoc.m_Type      = Location::VariableLocation;
+      rLoc.m_SizeInBit = Node.m_Type;
+      if (Node.m_Type != 0)
+      {
+        rLoc.m_pVar = AllocateVariable(*Node.m_pName);
+        m_Builder.CreateStore(MakeInteger(64, 0), rLoc.m_pVar);
+        return true;
+      }
 
-#undef LLVM_OP_CASE
+      // Variables only live in the block which allocates them
+      auto itVar = m_Variables.find(*Node.m_pName);
+      if (itVar == std::end(m_Variables))
+        return false;
+      rLoc.m_pVar = itVar->second;
+      return true;
+    }
 
-  return nullptr; // TODO
+  default:
+    return false;
+  }
 }
 
-Expression* LlvmEmulator::LlvmExpressionVisitor::VisitConstant(u32 Type, u64 Value)
+bool LlvmEmulator::LlvmBlockCompiler::CompileAddress(Expression const* pBaseExpr, Expression const* pOffsetExpr, Location& rLoc)
 {
-  auto pValue = MakeInteger(Type, Value);
-  assert(pValue && "Invalid integer");
-  m_ValueStack.push(std::make_tuple(nullptr, pValue));
-  return nullptr;
+  rLoc.m_pBase = MakeInteger(16, 0);
+  if (pBaseExpr != nullptr)
+  {
+    Value BaseVal;
+    if (CompileValue(pBaseExpr, false, BaseVal) == false)
+      return false;
+    rLoc.m_pBase = m_Builder.CreateTrunc(BaseVal.m_pValue, llvm::Type::getInt16Ty(m_rCtxt));
+  }
+
+  Value OffsetVal;
+  if (CompileValue(pOffsetExpr, false, OffsetVal) == false)
+    return false;
+  rLoc.m_pOffset = OffsetVal.m_pValue;
+
+  auto pRetType = llvm::Type::getInt64Ty(m_rCtxt);
+  auto pHelper  = GetHelper("medusa_translate", pRetType, { llvm::Type::getInt8PtrTy(m_rCtxt), llvm::Type::getInt16Ty(m_rCtxt), pRetType });
+  rLoc.m_pLinAddr = m_Builder.CreateCall(pHelper, { m_pRuntimeParam, rLoc.m_pBase, rLoc.m_pOffset });
+  return true;
 }
 
-Expression* LlvmEmulator::LlvmExpressionVisitor::VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo)
+bool LlvmEmulator::LlvmBlockCompiler::CompileOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr, Value* pValue)
 {
-  auto pIdName = m_pCpuCtxt->GetCpuInformation().ConvertIdentifierToName(Id);
-  assert(pIdName && "Unable to retrieve identifier name");
+  auto pInt64Type = llvm::Type::getInt64Ty(m_rCtxt);
 
-  auto pIdVarPtr = reinterpret_cast<llvm::Value*>(m_pVarCtxt->GetVariable(pIdName));
-  assert(pIdVarPtr && "Unknown identifier variable");
+  switch (Type)
+  {
+  case OperationExpression::OpAff:
+    {
+      Location DstLoc;
+      Value SrcVal;
+      if (CompileLocation(pLeftExpr, DstLoc) == false)
+        return false;
+      if (CompileValue(pRightExpr, false, SrcVal) == false)
+        return false;
+
+      if (DstLoc.m_Type == Location::MemoryLocation)
+        CompileHook(DstLoc.m_pBase, DstLoc.m_pOffset, Emulator::HookOnWrite);
+      if (SrcVal.m_IsMemory)
+        CompileHook(SrcVal.m_pBase, SrcVal.m_pOffset, Emulator::HookOnRead);
+
+      CompileStore(DstLoc, SrcVal.m_pValue);
+
+      // The left operand is not read
+      if (pValue != nullptr)
+      {
+        pValue->m_pValue    = MakeInteger(64, 0);
+        pValue->m_SizeInBit = DstLoc.m_SizeInBit;
+      }
+      return true;
+    }
 
-  auto pIdVar = m_rBuilder.CreateLoad(pIdVarPtr, false);
+  case OperationExpression::OpXchg:
+    {
+      Location LeftLoc, RightLoc;
+      Value LeftVal, RightVal;
+      if (CompileLocation(pLeftExpr, LeftLoc) == false || CompileLocation(pRightExpr, RightLoc) == false)
+        return false;
+      if (CompileLoad(LeftLoc, LeftVal) == false || CompileLoad(RightLoc, RightVal) == false)
+        return false;
+
+      if (LeftLoc.m_Type == Location::MemoryLocation)
+        CompileHook(LeftLoc.m_pBase, LeftLoc.m_pOffset, Emulator::HookOnWrite);
+      if (RightLoc.m_Type == Location::MemoryLocation)
+        CompileHook(RightLoc.m_pBase, RightLoc.m_pOffset, Emulator::HookOnRead);
+
+      CompileStore(LeftLoc,  RightVal.m_pValue);
+      CompileStore(RightLoc, LeftVal.m_pValue);
+
+      if (pValue != nullptr)
+      {
+        pValue->m_pValue    = m_Builder.CreateAnd(LeftVal.m_pValue, MakeInteger(64, GetValueMask(LeftVal.m_SizeInBit)));
+        pValue->m_SizeInBit = LeftVal.m_SizeInBit;
+      }
+      return true;
+    }
 
-  m_ValueStack.push(std::make_tuple(pIdVarPtr, pIdVar));
+  case OperationExpression::OpSext:
+    {
+      // The size of the result depends on the right operand, so it must be known now
+      ExpressionNode RightNode(pRightExpr);
+      if (RightNode.m_Kind != ExpressionNode::ConstantNode)
+        return false;
+      u64 NewSizeInBit = (RightNode.m_Value & GetValueMask(RightNode.m_Type)) * 8;
+      if (NewSizeInBit > 64)
+        return false;
+
+      Value LeftVal;
+      if (CompileValue(pLeftExpr, true, LeftVal) == false)
+        return false;
+      if (LeftVal.m_IsMemory)
+        CompileHook(LeftVal.m_pBase, LeftVal.m_pOffset, Emulator::HookOnWrite);
+
+      // Same steps as ConstantExpression::SignExtend
+      auto pResult = m_Builder.CreateAnd(LeftVal.m_pValue, MakeInteger(64, GetValueMask(static_cast<u32>(NewSizeInBit))));
+      switch (LeftVal.m_SizeInBit)
+      {
+      case 8: case 16: case 32:
+        pResult = m_Builder.CreateSExt(m_Builder.CreateTrunc(pResult, llvm::Type::getIntNTy(m_rCtxt, LeftVal.m_SizeInBit)), pInt64Type);
+        // Fall through
+      case 64:
+        if (NewSizeInBit == 8 || NewSizeInBit == 16 || NewSizeInBit == 32)
+          pResult = m_Builder.CreateAnd(pResult, MakeInteger(64, GetValueMask(static_cast<u32>(NewSizeInBit))));
+        break;
+      default:
+        break;
+      }
 
-  return nullptr;
+      if (pValue != nullptr)
+      {
+        pValue->m_pValue    = pResult;
+        pValue->m_SizeInBit = static_cast<u32>(NewSizeInBit);
+      }
+      return true;
+    }
 
-  //if (IdSize == 1)
-  //{
-  //  std::string IdName = m_pCpuCtxt->GetCpuInformation().ConvertIdentifierToName(Id);
-  //  //if (m_pVarCtxt->GetVariable(IdName) == nullptr)
-  //  VisitVariable(8, IdName);
-  //  VisitVariable(0, IdName);
-  //}
+  default:
+    break;
+  }
 
-  //u16 CtxtOff = m_pCpuCtxt->GetRegisterOffset(Id);
-  //if (CtxtOff == -1)
-  //{
-  //  assert(0 && "Invalid register offset");
-  //  return nullptr;
-  //}
+  switch (Type)
+  {
+  case OperationExpression::OpAdd:  case OperationExpression::OpSub:  case OperationExpression::OpMul:
+  case OperationExpression::OpUDiv: case OperationExpression::OpSDiv:
+  case OperationExpression::OpAnd:  case OperationExpression::OpOr:   case OperationExpression::OpXor:
+  case OperationExpression::OpLls:  case OperationExpression::OpLrs:  case OperationExpression::OpArs:
+    break;
+  default:
+    return false;
+  }
 
-  //auto pIdPtr = MakePointer(IdSize, m_pCpuCtxtParam, CtxtOff);
-  //if (pIdPtr == nullptr)
-  //{
-  //  assert(0 && "Unable to make pointer to register");
-  //  return nullptr;
-  //}
+  // Multiplication and arithmetic shift use the sign extended left operand
+  bool SignedLeft = (Type == OperationExpression::OpMul || Type == OperationExpression::OpArs);
 
-  //auto pIdValue = m_rBuilder.CreateLoad(pIdPtr, false);
-  //assert(pIdValue && "Invalid identifier value");
+  Value LeftVal, RightVal;
+  if (CompileValue(pLeftExpr, SignedLeft, LeftVal) == false)
+    return false;
+  if (CompileValue(pRightExpr, false, RightVal) == false)
+    return false;
 
-  //m_ValueStack.push(std::make_tuple(pIdPtr, pIdValue));
+  if (LeftVal.m_IsMemory)
+    CompileHook(LeftVal.m_pBase, LeftVal.m_pOffset, Emulator::HookOnWrite);
+  if (RightVal.m_IsMemory)
+    CompileHook(RightVal.m_pBase, RightVal.m_pOffset, Emulator::HookOnRead);
 
-  //return nullptr;
+  auto pLeft  = LeftVal.m_pValue;
+  auto pRight = RightVal.m_pValue;
+  auto pTooLarge = m_Builder.CreateICmpUGE(pRight, MakeInteger(64, 64));
+  llvm::Value* pResult = nullptr;
+
+  switch (Type)
+  {
+  case OperationExpression::OpAdd: pResult = m_Builder.CreateAdd(pLeft, pRight); break;
+  case OperationExpression::OpSub: pResult = m_Builder.CreateSub(pLeft, pRight); break;
+  case OperationExpression::OpMul: pResult = m_Builder.CreateMul(pLeft, pRight); break;
+  case OperationExpression::OpAnd: pResult = m_Builder.CreateAnd(pLeft, pRight); break;
+  case OperationExpression::OpOr:  pResult = m_Builder.CreateOr (pLeft, pRight); break;
+  case OperationExpression::OpXor: pResult = m_Builder.CreateXor(pLeft, pRight); break;
+
+  // Like the interpreter, both divisions are unsigned and dividing by zero fails
+  case OperationExpression::OpUDiv:
+  case OperationExpression::OpSDiv:
+    {
+      auto pIsZero   = m_Builder.CreateICmpEQ(pRight, MakeInteger(64, 0));
+      auto pFailedPtr = MakeFieldPointer(m_pRuntimeParam, offsetof(Runtime, m_Failed), 32);
+      auto pFailed   = m_Builder.CreateLoad(llvm::Type::getInt32Ty(m_rCtxt), pFailedPtr);
+      m_Builder.CreateStore(m_Builder.CreateOr(pFailed, m_Builder.CreateZExt(pIsZero, llvm::Type::getInt32Ty(m_rCtxt))), pFailedPtr);
+      pResult = m_Builder.CreateUDiv(pLeft, m_Builder.CreateSelect(pIsZero, MakeInteger(64, 1), pRight));
+      m_MayFail = true;
+      break;
+    }
+
+  case OperationExpression::OpLls:
+    pResult = m_Builder.CreateSelect(pTooLarge, MakeInteger(64, 0), m_Builder.CreateShl(pLeft, pRight));
+    break;
+
+  case OperationExpression::OpLrs:
+    pResult = m_Builder.CreateSelect(pTooLarge, MakeInteger(64, 0), m_Builder.CreateLShr(pLeft, pRight));
+    break;
+
+  case OperationExpression::OpArs:
+    pResult = m_Builder.CreateAShr(pLeft, m_Builder.CreateSelect(pTooLarge, MakeInteger(64, 63), pRight));
+    break;
+
+  default:
+    return false;
+  }
+
+  if (pValue != nullptr)
+  {
+    pValue->m_pValue    = m_Builder.CreateAnd(pResult, MakeInteger(64, GetValueMask(LeftVal.m_SizeInBit)));
+    pValue->m_SizeInBit = LeftVal.m_SizeInBit;
+  }
+  return true;
 }
 
-Expression* LlvmEmulator::LlvmExpressionVisitor::VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+bool LlvmEmulator::LlvmBlockCompiler::CompileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, llvm::Value*& rpCond)
 {
-  pOffsetExpr->Visit(this);
-  if (m_ValueStack.empty())
+  Value RefVal, TestVal;
+  if (CompileValue(pRefExpr, true, RefVal) == false)
+    return false;
+  if (CompileValue(pTestExpr, true, TestVal) == false)
+    return false;
+
+  auto pRef = RefVal.m_pValue, pTest = TestVal.m_pValue;
+  switch (Type)
   {
-    assert(0 && "Unable to JIT offset calculation");
-    return nullptr;
+  case ConditionExpression::CondEq:  rpCond = m_Builder.CreateICmpEQ (pRef, pTest); break;
+  case ConditionExpression::CondNe:  rpCond = m_Builder.CreateICmpNE (pRef, pTest); break;
+  case ConditionExpression::CondUgt: rpCond = m_Builder.CreateICmpUGT(pRef, pTest); break;
+  case ConditionExpression::CondUge: rpCond = m_Builder.CreateICmpUGE(pRef, pTest); break;
+  case ConditionExpression::CondUlt: rpCond = m_Builder.CreateICmpULT(pRef, pTest); break;
+  case ConditionExpression::CondUle: rpCond = m_Builder.CreateICmpULE(pRef, pTest); break;
+  case ConditionExpression::CondSgt: rpCond = m_Builder.CreateICmpSGT(pRef, pTest); break;
+  case ConditionExpression::CondSge: rpCond = m_Builder.CreateICmpSGE(pRef, pTest); break;
+  case ConditionExpression::CondSlt: rpCond = m_Builder.CreateICmpSLT(pRef, pTest); break;
+  case ConditionExpression::CondSle: rpCond = m_Builder.CreateICmpSLE(pRef, pTest); break;
+  default:                           rpCond = m_Builder.getFalse();                 break;
   }
-  auto pOffVal = std::get<1>(m_ValueStack.top());
-  pOffVal = m_rBuilder.CreateZExt(pOffVal, llvm::Type::getInt64Ty(llvm::getGlobalContext()));
-  m_ValueStack.pop();
+  return true;
+}
+
+bool LlvmEmulator::LlvmBlockCompiler::CompileLoad(Location const& rLoc, Value& rValue)
+{
+  auto pInt64Type    = llvm::Type::getInt64Ty(m_rCtxt);
+  auto pBytePtrType  = llvm::Type::getInt8PtrTy(m_rCtxt);
+  auto pInt32Type    = llvm::Type::getInt32Ty(m_rCtxt);
+  rValue.m_SizeInBit = rLoc.m_SizeInBit;
 
-  llvm::Value* pBaseVal = nullptr;
-  if (pBaseExpr == nullptr)
+  switch (rLoc.m_Type)
   {
-    pBaseVal = MakeInteger(16, 0x0);
+  case Location::RegisterLocation:
+    {
+      u16 Offset;
+      u8 ReadSize, WriteSize;
+      if (m_rRegLayout.GetStorage(rLoc.m_Id, Offset, ReadSize, WriteSize)
+        && (ReadSize == 1 || ReadSize == 2 || ReadSize == 4 || ReadSize == 8))
+      {
+        if (IsCached(Offset, ReadSize))
+        {
+          auto pWord = m_Builder.CreateLoad(pInt64Type, GetWord(Offset / 8));
+          auto pReg  = m_Builder.CreateLShr(pWord, MakeInteger(64, (Offset % 8) * 8));
+          rValue.m_pValue = m_Builder.CreateAnd(pReg, MakeInteger(64, GetValueMask(ReadSize * 8)));
+          return true;
+        }
+
+        auto pRegType = llvm::Type::getIntNTy(m_rCtxt, ReadSize * 8);
+        auto pReg = m_Builder.CreateLoad(pRegType, MakeFieldPointer(m_pCpuCtxtParam, Offset, ReadSize * 8));
+        AddSyncPoint(pReg);
+        rValue.m_pValue = m_Builder.CreateZExt(pReg, pInt64Type);
+        return true;
+      }
+
+      auto pHelper = GetHelper("medusa_read_register", pInt64Type, { pBytePtrType, pInt32Type, pInt32Type });
+      rValue.m_pValue = m_Builder.CreateCall(pHelper, { m_pRuntimeParam, MakeInteger(32, rLoc.m_Id), MakeInteger(32, rLoc.m_SizeInBit / 8) });
+      AddSyncPoint(rValue.m_pValue);
+      m_MayFail = true;
+      return true;
+    }
+
+  case Location::MemoryLocation:
+    {
+      auto pHelper = GetHelper("medusa_read_memory", pInt64Type, { pBytePtrType, pInt64Type, pInt32Type });
+      rValue.m_pValue   = m_Builder.CreateCall(pHelper, { m_pRuntimeParam, rLoc.m_pLinAddr, MakeInteger(32, rLoc.m_SizeInBit / 8) });
+      rValue.m_IsMemory = true;
+      rValue.m_pBase    = rLoc.m_pBase;
+      rValue.m_pOffset  = rLoc.m_pOffset;
+      m_MayFail = true;
+      return true;
+    }
+
+  case Location::VariableLocation:
+    rValue.m_pValue = m_Builder.CreateLoad(pInt64Type, rLoc.m_pVar);
+    return true;
+
+  default:
+    return false;
   }
-  else
+}
+
+void LlvmEmulator::LlvmBlockCompiler::CompileStore(Location const& rLoc, llvm::Value* pValue)
+{
+  auto pInt64Type   = llvm::Type::getInt64Ty(m_rCtxt);
+  auto pBytePtrType = llvm::Type::getInt8PtrTy(m_rCtxt);
+  auto pInt32Type   = llvm::Type::getInt32Ty(m_rCtxt);
+
+  switch (rLoc.m_Type)
   {
-    pBaseExpr->Visit(this);
-    if (m_ValueStack.empty())
+  case Location::RegisterLocation:
     {
-      pBaseVal = MakeInteger(16, 0x0);
+      u16 Offset;
+      u8 ReadSize, WriteSize;
+      if (rLoc.m_SizeInBit >= 8 && m_rRegLayout.GetStorage(rLoc.m_Id, Offset, ReadSize, WriteSize)
+        && (WriteSize == 1 || WriteSize == 2 || WriteSize == 4 || WriteSize == 8))
+      {
+        // The register is zero-extended to the stored size
+        auto pRegVal = m_Builder.CreateAnd(pValue, MakeInteger(64, GetValueMask(rLoc.m_SizeInBit)));
+        if (IsCached(Offset, WriteSize))
+        {
+          u32  Shift = (Offset % 8) * 8;
+          u64  Mask  = GetValueMask(WriteSize * 8);
+          auto pWordVar = GetWord(Offset / 8);
+          auto pWord = m_Builder.CreateAnd(m_Builder.CreateLoad(pInt64Type, pWordVar), MakeInteger(64, ~(Mask << Shift)));
+          pRegVal = m_Builder.CreateShl(m_Builder.CreateAnd(pRegVal, MakeInteger(64, Mask)), MakeInteger(64, Shift));
+          m_Builder.CreateStore(m_Builder.CreateOr(pWord, pRegVal), pWordVar);
+          m_DirtyWords.insert(Offset / 8);
+          return;
+        }
+
+        pRegVal = m_Builder.CreateTrunc(pRegVal, llvm::Type::getIntNTy(m_rCtxt, WriteSize * 8));
+        AddSyncPoint(m_Builder.CreateStore(pRegVal, MakeFieldPointer(m_pCpuCtxtParam, Offset, WriteSize * 8)));
+        return;
+      }
+
+      auto pHelper = GetHelper("medusa_write_register", llvm::Type::getVoidTy(m_rCtxt), { pBytePtrType, pInt32Type, pInt64Type, pInt32Type });
+      AddSyncPoint(m_Builder.CreateCall(pHelper, { m_pRuntimeParam, MakeInteger(32, rLoc.m_Id), pValue, MakeInteger(32, rLoc.m_SizeInBit / 8) }));
+      return;
     }
-    else
+
+  case Location::MemoryLocation:
     {
-      pBaseVal = std::get<1>(m_ValueStack.top());
-      m_ValueStack.pop();
+      auto pHelper = GetHelper("medusa_write_memory", llvm::Type::getVoidTy(m_rCtxt), { pBytePtrType, pInt64Type, pInt64Type, pInt32Type });
+      m_Builder.CreateCall(pHelper, { m_pRuntimeParam, rLoc.m_pLinAddr, pValue, MakeInteger(32, rLoc.m_SizeInBit / 8) });
+      return;
     }
+
+  case Location::VariableLocation:
+    m_Builder.CreateStore(pValue, rLoc.m_pVar);
+    return;
+
+  default:
+    return;
   }
+}
 
-  assert(pBaseVal && "Invalid base value");
+void LlvmEmulator::LlvmBlockCompiler::CompileHook(llvm::Value* pBase, llvm::Value* pOffset, u32 HookType)
+{
+  if (m_pHookFilter == nullptr)
+    return;
+
+  // Helpers are only called if the page filter matches
+  auto pHookBlock = llvm::BasicBlock::Create(m_rCtxt, "hook", m_pFunc);
+  auto pNextBlock = llvm::BasicBlock::Create(m_rCtxt, "next", m_pFunc);
+  m_Builder.CreateCondBr(CompileHookFilter(pOffset, HookType), pHookBlock, pNextBlock);
 
-  auto pAccessSizeInBitVal = MakeInteger(32, AccessSizeInBit);
-  auto pCallVal = m_rBuilder.CreateCall5(s_pGetMemoryFunc, m_pCpuCtxtObjParam, m_pMemCtxtObjParam, pBaseVal, pOffVal, pAccessSizeInBitVal);
-  auto pPtrVal = m_rBuilder.CreateBitCast(pCallVal, llvm::Type::getIntNPtrTy(llvm::getGlobalContext(), AccessSizeInBit));
-  auto pVal = m_rBuilder.CreateLoad(pPtrVal, false);
-  m_ValueStack.push(std::make_tuple(pPtrVal, pVal));
+  m_Builder.SetInsertPoint(pHookBlock);
+  auto pHelper = GetHelper("medusa_test_hook", llvm::Type::getVoidTy(m_rCtxt),
+    { llvm::Type::getInt8PtrTy(m_rCtxt), llvm::Type::getInt16Ty(m_rCtxt), llvm::Type::getInt64Ty(m_rCtxt), llvm::Type::getInt32Ty(m_rCtxt) });
+  AddSyncPoint(m_Builder.CreateCall(pHelper, { m_pRuntimeParam, pBase, pOffset, MakeInteger(32, HookType) }));
+  m_Builder.CreateBr(pNextBlock);
 
-  return nullptr; // TODO
+  m_Builder.SetInsertPoint(pNextBlock);
 }
 
-Expression* LlvmEmulator::LlvmExpressionVisitor::VisitVariable(u32 SizeInBit, std::string const& rName)
+void LlvmEmulator::LlvmBlockCompiler::CompileExecuteHook(void)
 {
-  if (SizeInBit)
-  {
-    m_pVarCtxt->AllocateVariable(SizeInBit, rName);
-    return nullptr;
-  }
+  u32 RegPc = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister);
+  Location PcLoc;
+  PcLoc.m_Type      = Location::RegisterLocation;
+  PcLoc.m_Id        = RegPc;
+  PcLoc.m_SizeInBit = m_pCpuInfo->GetSizeOfRegisterInBit(RegPc);
+  Value PcVal;
+  CompileLoad(PcLoc, PcVal);
+
+  auto pHookBlock = llvm::BasicBlock::Create(m_rCtxt, "hook", m_pFunc);
+  auto pNextBlock = llvm::BasicBlock::Create(m_rCtxt, "next", m_pFunc);
+  m_Builder.CreateCondBr(CompileHookFilter(PcVal.m_pValue, Emulator::HookOnExecute), pHookBlock, pNextBlock);
+
+  m_Builder.SetInsertPoint(pHookBlock);
+  AddSyncPoint(m_Builder.CreateCall(GetHelper("medusa_execute_hook", llvm::Type::getVoidTy(m_rCtxt), { llvm::Type::getInt8PtrTy(m_rCtxt) }), { m_pRuntimeParam }));
+  m_Builder.CreateBr(pNextBlock);
+
+  m_Builder.SetInsertPoint(pNextBlock);
+}
+
+llvm::Value* LlvmEmulator::LlvmBlockCompiler::CompileHookFilter(llvm::Value* pOffset, u32 HookType)
+{
+  // The filter is read at run time, it's updated when hooks are added
+  auto pInt8Type = llvm::Type::getInt8Ty(m_rCtxt);
+  auto pIndex    = m_Builder.CreateAnd(m_Builder.CreateLShr(pOffset, MakeInteger(64, Emulator::HookPageBits)), MakeInteger(64, Emulator::HookFilterSize - 1));
+  auto pEntry    = m_Builder.CreateLoad(pInt8Type, m_Builder.CreateGEP(pInt8Type, MakePointer(m_pHookFilter), pIndex));
+  return m_Builder.CreateICmpNE(m_Builder.CreateAnd(pEntry, MakeInteger(8, HookType)), MakeInteger(8, 0));
+}
 
-  auto pVarPtrVal = reinterpret_cast<llvm::Value*>(m_pVarCtxt->GetVariable(rName));
-  if (pVarPtrVal == nullptr)
+void LlvmEmulator::LlvmBlockCompiler::CompileFailureCheck(void)
+{
+  auto pFailed = m_Builder.CreateLoad(llvm::Type::getInt32Ty(m_rCtxt), MakeFieldPointer(m_pRuntimeParam, offsetof(Runtime, m_Failed), 32));
+  auto pNextBlock = llvm::BasicBlock::Create(m_rCtxt, "next", m_pFunc);
+  m_Builder.CreateCondBr(m_Builder.CreateICmpNE(pFailed, MakeInteger(32, 0)), m_pExitBlock, pNextBlock);
+  m_Builder.SetInsertPoint(pNextBlock);
+}
+
+void LlvmEmulator::LlvmBlockCompiler::CompileChaining(TranslatedBlock* pBlock)
+{
+  u32 RegPc = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister);
+  Location PcLoc;
+  PcLoc.m_Type      = Location::RegisterLocation;
+  PcLoc.m_Id        = RegPc;
+  PcLoc.m_SizeInBit = m_pCpuInfo->GetSizeOfRegisterInBit(RegPc);
+  Value PcVal;
+  CompileLoad(PcLoc, PcVal);
+
+  // The slots are read each time, so the emulator can chain and unchain blocks without
+  // generating code again. The next block is tail called, chained blocks don't grow the stack.
+  auto pBytePtrType = llvm::Type::getInt8PtrTy(m_rCtxt);
+  auto pCodeType    = m_pFunc->getFunctionType();
+  for (u32 i = 0; i < ChainSlotNo; ++i)
   {
-    assert(0 && "Unknown variable");
-    return nullptr;
-  }
+    auto& rSlot = pBlock->m_Chains[i];
+    auto pSlotAddr = m_Builder.CreateLoad(llvm::Type::getInt64Ty(m_rCtxt), m_Builder.CreateBitCast(MakePointer(&rSlot.m_Address), llvm::Type::getInt64PtrTy(m_rCtxt)));
+    auto pSlotCode = m_Builder.CreateLoad(pBytePtrType, m_Builder.CreateBitCast(MakePointer(&rSlot.m_pCode), pBytePtrType->getPointerTo()));
+    auto pIsChained = m_Builder.CreateAnd(
+      m_Builder.CreateICmpEQ(PcVal.m_pValue, pSlotAddr),
+      m_Builder.CreateICmpNE(pSlotCode, llvm::ConstantPointerNull::get(pBytePtrType)));
+
+    auto pChainBlock = llvm::BasicBlock::Create(m_rCtxt, "chain", m_pFunc);
+    auto pNextBlock  = llvm::BasicBlock::Create(m_rCtxt, "next",  m_pFunc);
+    m_Builder.CreateCondBr(pIsChained, pChainBlock, pNextBlock);
+
+    m_Builder.SetInsertPoint(pChainBlock);
+    auto pCall = m_Builder.CreateCall(pCodeType, m_Builder.CreateBitCast(pSlotCode, pCodeType->getPointerTo()), { m_pCpuCtxtParam, m_pRuntimeParam });
+    pCall->setTailCallKind(llvm::CallInst::TCK_MustTail);
+    m_Builder.CreateRetVoid();
 
-  auto pVarVal = m_rBuilder.CreateLoad(pVarPtrVal);
+    m_Builder.SetInsertPoint(pNextBlock);
+  }
+  m_Builder.CreateRetVoid();
+}
 
-  m_ValueStack.push(std::make_tuple(pVarPtrVal, pVarVal));
+bool LlvmEmulator::LlvmBlockCompiler::IsCached(u16 Offset, u8 Size) const
+{
+  // A word contains the register in the same order only on little-endian hosts
+  if (!llvm::sys::IsLittleEndianHost)
+    return false;
+  return (Offset % 8) + Size <= 8 && static_cast<u32>(Offset / 8 + 1) * 8 <= m_ContextSize;
+}
 
-  return nullptr; // TODO
+llvm::Value* LlvmEmulator::LlvmBlockCompiler::GetWord(u32 WordIdx)
+{
+  auto itWord = m_Words.find(WordIdx);
+  if (itWord != std::end(m_Words))
+    return itWord->second;
+
+  llvm::IRBuilder<> EntryBuilder(m_pEntryBlock, m_pEntryBlock->begin());
+  auto pWord = EntryBuilder.CreateAlloca(llvm::Type::getInt64Ty(m_rCtxt));
+  m_Words[WordIdx] = pWord;
+  return pWord;
 }
 
-void LlvmEmulator::LlvmExpressionVisitor::ClearValues(void)
+void LlvmEmulator::LlvmBlockCompiler::AddSyncPoint(llvm::Value* pInsn)
 {
-  while (!m_ValueStack.empty())
-    m_ValueStack.pop();
+  m_SyncPoints.push_back(llvm::cast<llvm::Instruction>(pInsn));
 }
 
-llvm::Value* LlvmEmulator::LlvmExpressionVisitor::MakeInteger(u32 Bits, u64 Value) const
+void LlvmEmulator::LlvmBlockCompiler::FinalizeWords(void)
 {
-  return llvm::ConstantInt::get(llvm::getGlobalContext(), llvm::APInt(Bits, Value));
+  if (m_Words.empty())
+    return;
+
+  auto pInt64Type = llvm::Type::getInt64Ty(m_rCtxt);
+  auto LoadWords = [&](void)
+  {
+    for (auto itWord = std::begin(m_Words); itWord != std::end(m_Words); ++itWord)
+      m_Builder.CreateStore(m_Builder.CreateLoad(pInt64Type, MakeFieldPointer(m_pCpuCtxtParam, itWord->first * 8, 64)), itWord->second);
+  };
+  auto StoreWords = [&](void)
+  {
+    for (auto itWord = std::begin(m_DirtyWords); itWord != std::end(m_DirtyWords); ++itWord)
+      m_Builder.CreateStore(m_Builder.CreateLoad(pInt64Type, m_Words[*itWord]), MakeFieldPointer(m_pCpuCtxtParam, *itWord * 8, 64));
+  };
+
+  m_Builder.SetInsertPoint(m_pEntryBlock->getTerminator());
+  LoadWords();
+
+  // Words which are not written always match the cpu context, they only have to be reloaded
+  for (auto itInsn = std::begin(m_SyncPoints); itInsn != std::end(m_SyncPoints); ++itInsn)
+  {
+    m_Builder.SetInsertPoint(*itInsn);
+    StoreWords();
+    m_Builder.SetInsertPoint((*itInsn)->getNextNode());
+    LoadWords();
+  }
+
+  m_Builder.SetInsertPoint(m_pExitBlock, m_pExitBlock->getFirstInsertionPt());
+  StoreWords();
 }
 
-llvm::Value* LlvmEmulator::LlvmExpressionVisitor::MakePointer(u32 Bits, void* pPointer, s32 Offset) const
+llvm::Value* LlvmEmulator::LlvmBlockCompiler::MakeInteger(u32 Bits, u64 Value) const
 {
-  //src: http://llvm.1065342.n5.nabble.com/Creating-Pointer-Constants-td31886.html
-  auto pConstInt = llvm::ConstantInt::get(llvm::Type::getInt64Ty(llvm::getGlobalContext()), reinterpret_cast<u64>(pPointer));
-  auto pPtr = llvm::ConstantExpr::getIntToPtr(pConstInt, llvm::PointerType::getIntNPtrTy(llvm::getGlobalContext(), Bits));
+  return llvm::ConstantInt::get(m_rCtxt, llvm::APInt(Bits, Value));
+}
 
-  if (Offset == 0x0)
-    return pPtr;
+llvm::Value* LlvmEmulator::LlvmBlockCompiler::MakePointer(void const* pPointer) const
+{
+  auto pConstInt = llvm::ConstantInt::get(llvm::Type::getInt64Ty(m_rCtxt), reinterpret_cast<u64>(pPointer));
+  return llvm::ConstantExpr::getIntToPtr(pConstInt, llvm::Type::getInt8PtrTy(m_rCtxt));
+}
 
-  return m_rBuilder.CreateGEP(pPtr, MakeInteger(32, Offset));
+llvm::Value* LlvmEmulator::LlvmBlockCompiler::MakeFieldPointer(llvm::Value* pBasePointer, u32 Offset, u32 Bits)
+{
+  auto pFieldPtr = m_Builder.CreateGEP(llvm::Type::getInt8Ty(m_rCtxt), pBasePointer, MakeInteger(32, Offset));
+  auto pFieldType = Bits != 0 ? static_cast<llvm::Type*>(llvm::Type::getIntNTy(m_rCtxt, Bits)) : llvm::Type::getInt8PtrTy(m_rCtxt);
+  return m_Builder.CreateBitCast(pFieldPtr, pFieldType->getPointerTo());
 }
 
-llvm::Value* LlvmEmulator::LlvmExpressionVisitor::MakePointer(u32 Bits, llvm::Value* pPointerValue, s32 Offset) const
+llvm::Value* LlvmEmulator::LlvmBlockCompiler::AllocateVariable(std::string const& rName)
 {
-  if (Offset != 0x0)
-  {
-    //src: http://llvm.1065342.n5.nabble.com/Creating-Pointer-Constants-td31886.html
-    pPointerValue = m_rBuilder.CreateGEP(pPointerValue, MakeInteger(32, Offset));
-  }
+  auto itVar = m_Variables.find(rName);
+  if (itVar != std::end(m_Variables))
+    return itVar->second;
+
+  // Allocas are placed in the entry block so they are promoted to registers
+  auto& rEntryBlock = m_pFunc->getEntryBlock();
+  llvm::IRBuilder<> EntryBuilder(&rEntryBlock, rEntryBlock.begin());
+  auto pVar = EntryBuilder.CreateAlloca(llvm::Type::getInt64Ty(m_rCtxt), nullptr, rName);
+  m_Variables[rName] = pVar;
+  return pVar;
+}
 
-  return m_rBuilder.CreateBitCast(pPointerValue, llvm::PointerType::getIntNPtrTy(llvm::getGlobalContext(), Bits));
+llvm::Function* LlvmEmulator::LlvmBlockCompiler::GetHelper(char const* pName, llvm::Type* pRetType, std::vector<llvm::Type*> const& rParams)
+{
+  auto pHelper = m_rModule.getFunction(pName);
+  if (pHelper != nullptr)
+    return pHelper;
+  auto pHelperType = llvm::FunctionType::get(pRetType, rParams, false);
+  return llvm::Function::Create(pHelperType, llvm::GlobalValue::ExternalLinkage, pName, &m_rModule);
 }
@@ -3,10 +3,13 @@
 
 #include <medusa/emulation.hpp>
 
-#include <stack>
-#include <tuple>
-
-#include <llvm/Support/TargetSelect.h>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
@@ -15,13 +18,9 @@
 #include <llvm/IR/BasicBlock.h>
 #include <llvm/IR/Type.h>
 #include <llvm/IR/DerivedTypes.h>
-#include <llvm/IR/DataLayout.h>
 
-#include <llvm/ExecutionEngine/ExecutionEngine.h>
-#include <llvm/PassManager.h>
-#include <llvm/Analysis/Passes.h>
-#include <llvm/Transforms/Scalar.h>
-#include <llvm/Target/TargetMachine.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
 
 #if defined(_WIN32) || defined(WIN32)
 # ifdef emul_llvm_EXPORTS
@@ -37,7 +36,15 @@ MEDUSA_NAMESPACE_USE
 
   extern "C" EMUL_LLVM_EXPORT Emulator* GetEmulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext *pMemCtxt);
 
-// TODO: overload VariableContext to use llvm Alloca
+//! LlvmEmulator compiles each block to native code with ORC, blocks are optimized when they're
+//! materialized. A block jumps directly to the next one if it has already been executed after it
+//! (block chaining), writing to a code page removes the blocks decoded from it.
+//! Once a block has been executed HotThreshold times, it's compiled again with the blocks chained
+//! after it as a trace: registers are kept in SSA values for the whole trace, a loop back to the
+//! first block stays in the trace and any other path leaves it (side exit).
+//! Pages invalidated SelfModifyingThreshold times contain self-modifying code, their blocks are
+//! executed by the interpreter, or compiled without optimization if it's not available or if
+//! there are hooks.
 class LlvmEmulator : public medusa::Emulator
 {
 public:
@@ -49,75 +56,198 @@ public:
   virtual bool Execute(Address const& rAddress, Expression const& rExpr);
   virtual bool Execute(Address const& rAddress, Expression::List const& rExprList);
 
-private:
-  typedef void (*BasicBlockCode)(u8* pCpuCtxt, u8* pCpuCtxtObj, u8* pMemCtxtObj);
+  virtual bool TranslateBlock(Address const& rAddress, u32 Size, Expression::List const& rExprList);
+  virtual bool IsBlockTranslated(Address const& rAddress) const;
+  virtual bool ExecuteBlock(Address const& rAddress);
+  virtual void InvalidateBlocks(void);
+  virtual void SetBlockChaining(bool Enable, Address const* pStopAddr = nullptr);
 
-  llvm::IRBuilder<>             m_Builder;
-  static llvm::Module*          sm_pModule;
-  static llvm::ExecutionEngine* sm_pExecutionEngine;
-  static llvm::DataLayout*      sm_pDataLayout;
+  // Hooks are tested by the generated code only if they exist when the block is translated
+  using Emulator::AddHook;
+  virtual bool AddHook(Address const& rAddress, u32 Size, u32 Type, HookCallback Callback);
+  virtual bool RemoveHook(Address const& rAddress);
 
-  // TODO: Implement InvalidCache to handle self-modifying code
-  // TODO: Implement a method in CpuContext to get the current address (we can't always rely on CpuInformation::ProgramPointerRegister)
-  typedef std::unordered_map<u64, llvm::BasicBlock*> BasicBlockCacheType;
-  typedef std::unordered_map<u64, llvm::Function*>   FunctionCacheType;
-  BasicBlockCacheType           m_BasicBlockCache;
-  FunctionCacheType             m_FunctionCache;
+private:
+  struct Runtime;
+  typedef void (*BlockCode)(u8* pCpuCtxt, Runtime* pRuntime);
 
-  class LlvmVariableContext : public VariableContext
+  struct ChainSlot
   {
-  public:
-    LlvmVariableContext(llvm::IRBuilder<>& rBuilder);
-
-    virtual bool ReadVariable(std::string const& rVariableName, u64& rValue) const;
-    virtual bool WriteVariable(std::string const& rVariableName, u64 Value, bool SignExtend = false);
-
-    virtual bool AllocateVariable(u32 Type, std::string const& rVariableName);
+    u64       m_Address; //! Linear address of the next block
+    BlockCode m_pCode;   //! Code of the next block, nullptr if the slot is unused
+  };
 
-    virtual std::string ToString(void) const;
+  enum
+  {
+    ChainSlotNo            = 2,  // Taken and not taken branches
+    HotThreshold           = 64, // Executions before a trace is compiled from a block
+    MaxTraceBlockNo        = 8,
+    SelfModifyingThreshold = 4,  // Invalidations of a page before its code is treated as self-modifying
+  };
 
-  private:
-    llvm::IRBuilder<>& m_rBuilder;
+  //! Generated code reads the chain slots at run time, chaining or unchaining a block only writes them.
+  struct TranslatedBlock
+  {
+    TranslatedBlock(void) : m_Address(), m_Size(), m_pCode(nullptr), m_ExecNo(), m_IsTrace(false), m_TraceTried(false) { UnchainSlots(); }
+    ~TranslatedBlock(void);
+
+    void UnchainSlots(void) { for (u32 i = 0; i < ChainSlotNo; ++i) { m_Chains[i].m_Address = 0; m_Chains[i].m_pCode = nullptr; } }
+
+    u64                            m_Address;
+    u32                            m_Size;
+    BlockCode                      m_pCode;
+    ChainSlot                      m_Chains[ChainSlotNo];
+    u32                            m_ExecNo;     //! Incremented by the generated code of a block
+    bool                           m_IsTrace;
+    bool                           m_TraceTried; //! A trace has already been compiled from this block
+    Expression::List               m_Semantic;   //! Copy of the semantic, used to compile traces
+    std::vector<u64>               m_Pages;      //! Code pages of the block, or of all the blocks of the trace
+    llvm::orc::ResourceTrackerSP   m_spTracker;  //! Owns the native code
   };
 
+  //! Generated code receives this structure, helpers use it to reach the emulator.
+  struct Runtime
+  {
+    LlvmEmulator*    m_pEmul;
+    TranslatedBlock* m_pLastBlock; //! Last block executed, written by the generated code
+    u32              m_Failed;     //! Set by helpers when an access fails
+  };
 
-  class LlvmExpressionVisitor : public ExpressionVisitor
+  typedef std::unique_ptr<TranslatedBlock>                  TranslatedBlockPtr;
+  typedef std::unordered_map<u64, TranslatedBlockPtr>       BlockCacheType;
+  typedef std::unordered_map<u64, std::unordered_set<u64>> PageBlocksType;
+
+  //! Each emulator has its own JIT and LLVM context, so emulators can run on different threads.
+  //! The JIT is created by the first translation: the module manager creates an emulator only to get its name.
+  bool InitializeJit(void);
+  //\param Optimize is false to compile the code without optimization.
+  TranslatedBlockPtr Compile(u64 LinAddr, std::vector<Expression::List const*> const& rSemantics, std::vector<u64> const& rAddresses, bool Loop, bool Optimize = true);
+  void CompileTrace(TranslatedBlock* pHeadBlock);
+  void RetireTraces(void);
+  //! This method moves the block or the trace at LinAddr to m_RetiredBlocks and removes it from the list of each of its pages.
+  //\return false if there's no block at LinAddr.
+  bool RetireBlock(BlockCacheType& rCache, PageBlocksType& rPageBlocks, u64 LinAddr);
+  bool Run(TranslatedBlock* pBlock);
+  void Chain(TranslatedBlock* pFromBlock, TranslatedBlock* pToBlock);
+  void UnchainBlocks(void);
+  u64  GetLinearAddress(Address const& rAddress) const;
+  void InvalidatePage(u64 PageAddress);
+  bool IsSelfModifying(u64 PageAddress) const;
+
+  // Helpers called by the generated code
+  static u64  ReadRegisterHelper (Runtime* pRuntime, u32 Register, u32 Size);
+  static void WriteRegisterHelper(Runtime* pRuntime, u32 Register, u64 Value, u32 Size);
+  static u64  TranslateHelper    (Runtime* pRuntime, u16 Base, u64 Offset);
+  static u64  ReadMemoryHelper   (Runtime* pRuntime, u64 LinearAddress, u32 Size);
+  static void WriteMemoryHelper  (Runtime* pRuntime, u64 LinearAddress, u64 Value, u32 Size);
+  static void TestHookHelper     (Runtime* pRuntime, u16 Base, u64 Offset, u32 Type);
+  static void ExecuteHookHelper  (Runtime* pRuntime);
+
+  // Translated blocks remove their code from the JIT, so it's declared before the caches
+  llvm::orc::ThreadSafeContext      m_ThreadSafeContext;
+  std::unique_ptr<llvm::orc::LLJIT> m_upJit;
+  bool                              m_JitFailed; //! Don't try again to create the JIT
+  u32                               m_ModuleNo;
+
+  Runtime                         m_Runtime;
+  BlockCacheType                  m_BlockCache;    //! Translated blocks indexed by their linear address
+  PageBlocksType                  m_PageBlocks;    //! Linear address of blocks decoded from each code page
+  BlockCacheType                  m_TraceCache;    //! Traces indexed by the linear address of their first block
+  PageBlocksType                  m_PageTraces;    //! Linear address of traces containing a block decoded from each code page
+  std::unordered_map<u64, u32>    m_PageInvalidationNo; //! Number of times each code page was written after being translated
+  std::unique_ptr<Emulator>       m_upInterpreter;      //! Executes self-modifying code, nullptr if the module isn't loaded
+  std::vector<TranslatedBlockPtr> m_RetiredBlocks; //! Invalidated blocks, freed when no generated code is running
+  bool                            m_Chaining;
+  bool                            m_HasStopAddress;
+  u64                             m_StopAddress;
+  u64                             m_LastExitAddress; //! Program pointer after m_Runtime.m_pLastBlock
+
+  class LlvmBlockCompiler
   {
   public:
-    LlvmExpressionVisitor(
-      HookAddressHashMap const& Hooks,
-      CpuContext* pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt,
-      llvm::IRBuilder<>& rBulder, llvm::Value* pCpuCtxtParam, llvm::Value* pCpuCtxtObjParam, llvm::Value* pMemCtxtObjParam);
-    virtual Expression* VisitBind(Expression::List const& rExprList);
-    virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr);
-    virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr);
-    virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr);
-    virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr);
-    virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr);
-    virtual Expression* VisitConstant(u32 Type, u64 Value);
-    virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo);
-    virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref);
-    virtual Expression* VisitVariable(u32 SizeInBit, std::string const& rName);
-
-    void ClearValues(void);
-
-  protected:
-    llvm::Value* MakeInteger(u32 Bits, u64 Value) const;
-    llvm::Value* MakePointer(u32 Bits, void* pPointer, s32 Offset = 0) const;
-    llvm::Value* MakePointer(u32 Bits, llvm::Value* pPointerValue, s32 Offset = 0) const;
-
-    HookAddressHashMap const& m_rHooks;
-    CpuContext*               m_pCpuCtxt;
-    MemoryContext*            m_pMemCtxt;
-    VariableContext*          m_pVarCtxt;
-    llvm::IRBuilder<>&        m_rBuilder;
-
-    std::stack<std::tuple<llvm::Value*, llvm::Value*>>  m_ValueStack;
-    std::map<std::string, llvm::Value*>                 m_Variables;
-    llvm::Value*                                        m_pCpuCtxtParam;
-    llvm::Value*                                        m_pCpuCtxtObjParam;
-    llvm::Value*                                        m_pMemCtxtObjParam;
+    //\param pHookFilter is the page filter of the hooks, or nullptr if there's no hook.
+    LlvmBlockCompiler(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, RegisterLayout& rRegLayout, u8 const* pHookFilter, llvm::LLVMContext& rCtxt, llvm::Module& rModule);
+
+    //! This method generates the function of a block or a trace, chain slots are read from pBlock.
+    //! The generated code leaves the trace when the program pointer doesn't match the address of
+    //! the next block, if Loop is true the last block is followed by the first one.
+    //\return false if the semantic can't be compiled.
+    bool Compile(std::vector<Expression::List const*> const& rSemantics, std::vector<u64> const& rAddresses, bool Loop, std::string const& rName, TranslatedBlock* pBlock);
+
+  private:
+    struct Value
+    {
+      Value(void) : m_pValue(nullptr), m_SizeInBit(), m_IsMemory(false), m_pBase(nullptr), m_pOffset(nullptr) {}
+
+      llvm::Value* m_pValue;    //! Always an i64
+      u32          m_SizeInBit;
+      bool         m_IsMemory;  //! Read from memory at m_pBase:m_pOffset, used by hooks
+      llvm::Value* m_pBase;
+      llvm::Value* m_pOffset;
+    };
+
+    struct Location
+    {
+      enum Type { RegisterLocation, MemoryLocation, VariableLocation };
+
+      Location(void) : m_Type(RegisterLocation), m_Id(), m_SizeInBit(), m_pLinAddr(nullptr), m_pBase(nullptr), m_pOffset(nullptr), m_pVar(nullptr) {}
+
+      Type         m_Type;
+      u32          m_Id;
+      u32          m_SizeInBit;
+      llvm::Value* m_pLinAddr;
+      llvm::Value* m_pBase;
+      llvm::Value* m_pOffset;
+      llvm::Value* m_pVar;
+    };
+
+    bool CompileStatement(Expression const* pExpr);
+    bool CompileValue(Expression const* pExpr, bool SignExtend, Value& rValue);
+    bool CompileLocation(Expression const* pExpr, Location& rLoc);
+    bool CompileAddress(Expression const* pBaseExpr, Expression const* pOffsetExpr, Location& rLoc);
+    bool CompileOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr, Value* pValue);
+    bool CompileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, llvm::Value*& rpCond);
+    bool CompileLoad(Location const& rLoc, Value& rValue);
+    void CompileStore(Location const& rLoc, llvm::Value* pValue);
+    void CompileHook(llvm::Value* pBase, llvm::Value* pOffset, u32 HookType);
+    void CompileExecuteHook(void);
+    llvm::Value* CompileHookFilter(llvm::Value* pOffset, u32 HookType);
+    void CompileFailureCheck(void);
+    void CompileChaining(TranslatedBlock* pBlock);
+
+    // Registers are cached by 8-byte word of the cpu context buffer in allocas, which the
+    // optimizer promotes to SSA values. Words are loaded on entry, written back on exit and
+    // around the calls to helpers which can access the cpu context (sync points).
+    bool         IsCached(u16 Offset, u8 Size) const;
+    llvm::Value* GetWord(u32 WordIdx);
+    void         AddSyncPoint(llvm::Value* pCall);
+    void         FinalizeWords(void);
+
+    llvm::Value*    MakeInteger(u32 Bits, u64 Value) const;
+    llvm::Value*    MakePointer(void const* pPointer) const;
+    llvm::Value*    MakeFieldPointer(llvm::Value* pBasePointer, u32 Offset, u32 Bits);
+    llvm::Value*    AllocateVariable(std::string const& rName);
+    llvm::Function* GetHelper(char const* pName, llvm::Type* pRetType, std::vector<llvm::Type*> const& rParams);
+
+    CpuInformation const*   m_pCpuInfo;
+    CpuContext*             m_pCpuCtxt;
+    RegisterLayout&         m_rRegLayout;
+    u8 const*               m_pHookFilter;
+    llvm::LLVMContext&      m_rCtxt;
+    llvm::Module&           m_rModule;
+    llvm::IRBuilder<>       m_Builder;
+    llvm::Function*         m_pFunc;
+    llvm::BasicBlock*       m_pEntryBlock;
+    llvm::BasicBlock*       m_pExitBlock; //! Writes back the registers and leaves
+    llvm::Value*            m_pCpuCtxtParam;
+    llvm::Value*            m_pRuntimeParam;
+    bool                    m_MayFail; //! The current statement calls a helper which can fail
+    u32                     m_ContextSize;
+    std::map<u32, llvm::Value*> m_Words;      //! Allocas caching the words of the cpu context
+    std::set<u32>               m_DirtyWords; //! Words written by the generated code
+    std::vector<llvm::Instruction*> m_SyncPoints;
+    std::unordered_map<std::string, llvm::Value*> m_Variables; //! Allocas of the variables of the block
   };
 };
 
-#endif // !_EMUL_LLVM_
\ No newline at end of file
+#endif // !_EMUL_LLVM_
@@ -1,5 +1,7 @@
 ﻿#include "stack_analyzer.hpp"
 
+#include <boost/format.hpp>
+
 Expression* ExpressionVisitor_FindOperations::VisitBind(Expression::List const& rExprList)
 {
   for (auto itSem = std::begin(rExprList); itSem != std::end(rExprList); ++itSem)
@@ -241,7 +243,7 @@ X86StackAnalyzerTracker::X86StackAnalyzerTracker(CpuInformation const* pCpuInfo)
 
 bool X86StackAnalyzerTracker::Track(Analyzer& rAnlz, Document& rDoc, Address const& rAddr)
 {
-  auto spInsn = std::dynamic_pointer_cast<Instruction>(rDoc.GetCell(rAddr));
+  auto spInsn = std::dynamic_pointer_cast<Instruction>(rDoc.GetCellWithSemantic(rAddr));
   if (spInsn == nullptr)
     return false;
   if (spInsn->GetSubType() == Instruction::ReturnType)
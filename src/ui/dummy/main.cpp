@@ -187,7 +187,7 @@ class PrintSemanticTracker : public Analyzer::Tracker
 public:
   virtual bool Track(Analyzer& rAnlz, Document& rDoc, Address const& rAddr)
   {
-    auto spInsn = std::dynamic_pointer_cast<Instruction const>(rDoc.GetCell(rAddr));
+    auto spInsn = std::dynamic_pointer_cast<Instruction const>(rDoc.GetCellWithSemantic(rAddr));
     if (spInsn == nullptr)
       return false;
     if (spInsn->GetSubType() == Instruction::ReturnType)
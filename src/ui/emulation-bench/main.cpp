@@ -0,0 +1,419 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32) || defined(WIN32)
+# include <windows.h>
+# include <psapi.h>
+#else
+# include <sys/resource.h>
+#endif
+
+#include <medusa/configuration.hpp>
+#include <medusa/address.hpp>
+#include <medusa/medusa.hpp>
+#include <medusa/document.hpp>
+#include <medusa/log.hpp>
+#include <medusa/execution.hpp>
+#include <medusa/module.hpp>
+
+MEDUSA_NAMESPACE_USE
+
+// Each architecture has a raw image mapped at 0x0 which contains all its workloads. A workload
+// is executed from its first instruction until the program pointer reaches its end (the return
+// is never executed), the number of executed instructions is known from the code:
+// - arith:   register arithmetic in a loop, blocks are chained and traces compiled,
+// - memcpy:  a byte copy loop between two buffers in the stack area, memory accesses dominate,
+// - calls:   a loop calling a leaf function, blocks end on each call and return,
+// - selfmod: a loop patching the immediate of its next instruction, each write invalidates
+//            the translated blocks of the page and the patched instruction is decoded again
+//            from the emulated memory.
+// AVR8 executes from the flash memory which can't be written by the program, so it has no
+// self-modifying workload.
+// Each run must leave the expected value in the result register of its workload, a faster
+// emulator which computes a wrong result is a failure.
+
+struct Workload
+{
+  char const* m_pName;
+  u64         m_StartAddress;
+  u64         m_EndAddress;
+  u64         m_InstructionNo;
+  char const* m_pResultRegister;
+  u64         m_ResultValue;
+};
+
+struct ArchitectureBench
+{
+  char const*           m_pName;          // Name on the command line
+  char const*           m_pArchName;      // Name of the architecture module
+  u8 const*             m_pImage;
+  u32                   m_ImageSize;
+  Workload const*       m_pWorkloads;
+  u32                   m_WorkloadNo;
+  u64                   m_StackAddress;
+  u32                   m_StackSize;
+};
+
+/* x86 32-bit
+ * arith:   mov ecx, 100000 / xor eax, eax / mov edx, 1
+ *   loop:  add eax, ecx / xor eax, edx / shl edx, 1 / add edx, 3 / dec ecx / jnz loop
+ * memcpy:  mov esi, 0x2000000 / mov edi, 0x2010000 / mov ecx, 0x8000
+ *   loop:  mov al, [esi] / mov [edi], al / inc esi / inc edi / dec ecx / jnz loop
+ * calls:   mov ecx, 50000 / xor eax, eax
+ *   loop:  call leaf / dec ecx / jnz loop
+ *   leaf:  add eax, ecx / ret
+ * selfmod: mov ecx, 500 / xor edx, edx
+ *   loop:  mov [patch + 1], cl / patch: mov al, 0 / add dl, al / dec ecx / jnz loop
+ */
+static u8 const s_X86Image[] =
+{
+  0xb9, 0xa0, 0x86, 0x01, 0x00, 0x31, 0xc0, 0xba, 0x01, 0x00, 0x00, 0x00, 0x01, 0xc8, 0x31, 0xd0,
+  0xd1, 0xe2, 0x83, 0xc2, 0x03, 0x49, 0x75, 0xf4, 0xc3, 0xbe, 0x00, 0x00, 0x00, 0x02, 0xbf, 0x00,
+  0x00, 0x01, 0x02, 0xb9, 0x00, 0x80, 0x00, 0x00, 0x8a, 0x06, 0x88, 0x07, 0x46, 0x47, 0x49, 0x75,
+  0xf7, 0xc3, 0xb9, 0x50, 0xc3, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x04, 0x00, 0x00, 0x00, 0x49, 0x75,
+  0xf8, 0xc3, 0x01, 0xc8, 0xc3, 0xb9, 0xf4, 0x01, 0x00, 0x00, 0x31, 0xd2, 0x88, 0x0d, 0x53, 0x00,
+  0x00, 0x00, 0xb0, 0x00, 0x00, 0xc2, 0x49, 0x75, 0xf3, 0xc3,
+};
+
+static Workload const s_X86Workloads[] =
+{
+  { "arith",   0x00, 0x18, 3 + 6 * 100000, "eax", 0x55432c24 },
+  { "memcpy",  0x19, 0x31, 3 + 6 * 0x8000, "edi", 0x2018000  },
+  { "calls",   0x32, 0x41, 2 + 5 * 50000,  "eax", 0x4a81de28 },
+  { "selfmod", 0x45, 0x59, 2 + 5 * 500,    "edx", 0x42       },
+};
+
+/* ARM (A32)
+ * arith:   mov r2, #0x18000 / mov r0, #0 / mov r1, #1
+ *   loop:  add r0, r0, r2 / eor r0, r0, r1 / lsl r1, r1, #1 / add r1, r1, #3 / subs r2, r2, #1 / bne loop
+ * memcpy:  mov r0, #0x2000000 / add r1, r0, #0x10000 / mov r2, #0x8000
+ *   loop:  ldrb r3, [r0], #1 / strb r3, [r1], #1 / subs r2, r2, #1 / bne loop
+ * calls:   mov r2, #0xc000 / mov r0, #0
+ *   loop:  bl leaf / subs r2, r2, #1 / bne loop
+ *   leaf:  add r0, r0, r2 / bx lr
+ * selfmod: mov r2, #0x200 / mov r0, #0 / adr r1, patch
+ *   loop:  strb r2, [r1] / patch: mov r3, #0 / add r0, r0, r3 / subs r2, r2, #1 / bne loop
+ */
+static u8 const s_ArmImage[] =
+{
+  0x06, 0x29, 0xa0, 0xe3, 0x00, 0x00, 0xa0, 0xe3, 0x01, 0x10, 0xa0, 0xe3, 0x02, 0x00, 0x80, 0xe0,
+  0x01, 0x00, 0x20, 0xe0, 0x81, 0x10, 0xa0, 0xe1, 0x03, 0x10, 0x81, 0xe2, 0x01, 0x20, 0x52, 0xe2,
+  0xf9, 0xff, 0xff, 0x1a, 0x1e, 0xff, 0x2f, 0xe1, 0x02, 0x04, 0xa0, 0xe3, 0x01, 0x18, 0x80, 0xe2,
+  0x02, 0x29, 0xa0, 0xe3, 0x01, 0x30, 0xd0, 0xe4, 0x01, 0x30, 0xc1, 0xe4, 0x01, 0x20, 0x52, 0xe2,
+  0xfb, 0xff, 0xff, 0x1a, 0x1e, 0xff, 0x2f, 0xe1, 0x03, 0x29, 0xa0, 0xe3, 0x00, 0x00, 0xa0, 0xe3,
+  0x02, 0x00, 0x00, 0xeb, 0x01, 0x20, 0x52, 0xe2, 0xfc, 0xff, 0xff, 0x1a, 0x1e, 0xff, 0x2f, 0xe1,
+  0x02, 0x00, 0x80, 0xe0, 0x1e, 0xff, 0x2f, 0xe1, 0x02, 0x2c, 0xa0, 0xe3, 0x00, 0x00, 0xa0, 0xe3,
+  0x00, 0x10, 0x8f, 0xe2, 0x00, 0x20, 0xc1, 0xe5, 0x00, 0x30, 0xa0, 0xe3, 0x03, 0x00, 0x80, 0xe0,
+  0x01, 0x20, 0x52, 0xe2, 0xfa, 0xff, 0xff, 0x1a, 0x1e, 0xff, 0x2f, 0xe1,
+};
+
+static Workload const s_ArmWorkloads[] =
+{
+  { "arith",   0x00, 0x24, 3 + 6 * 0x18000, "r0", 0x55431554 },
+  { "memcpy",  0x28, 0x44, 3 + 4 * 0x8000,  "r1", 0x2018000  },
+  { "calls",   0x48, 0x5c, 2 + 5 * 0xc000,  "r0", 0x48006000 },
+  { "selfmod", 0x68, 0x88, 3 + 5 * 0x200,   "r0", 0xff00     },
+};
+
+/* AVR8
+ * arith:   ldi r24, lo8(20000) / ldi r25, hi8(20000) / ldi r16, 0 / ldi r17, 1
+ *   loop:  add r16, r24 / eor r16, r17 / lsl r17 / subi r17, -3 / sbiw r24, 1 / brne loop
+ * memcpy:  ldi r26:r27, 0x100 / ldi r30:r31, 0x600 / ldi r24:r25, 0x400
+ *   loop:  ld r0, X+ / st Z+, r0 / sbiw r24, 1 / brne loop
+ * calls:   ldi r24, lo8(20000) / ldi r25, hi8(20000) / ldi r16, 0
+ *   loop:  rcall leaf / sbiw r24, 1 / brne loop
+ *   leaf:  add r16, r24 / ret
+ */
+static u8 const s_Avr8Image[] =
+{
+  0x80, 0xe2, 0x9e, 0xe4, 0x00, 0xe0, 0x11, 0xe0, 0x08, 0x0f, 0x01, 0x27, 0x11, 0x0f, 0x1d, 0x5f,
+  0x01, 0x97, 0xd1, 0xf7, 0x08, 0x95, 0xa0, 0xe0, 0xb1, 0xe0, 0xe0, 0xe0, 0xf6, 0xe0, 0x80, 0xe0,
+  0x94, 0xe0, 0x0d, 0x90, 0x01, 0x92, 0x01, 0x97, 0xe1, 0xf7, 0x08, 0x95, 0x80, 0xe2, 0x9e, 0xe4,
+  0x00, 0xe0, 0x03, 0xd0, 0x01, 0x97, 0xe9, 0xf7, 0x08, 0x95, 0x08, 0x0f, 0x08, 0x95,
+};
+
+static Workload const s_Avr8Workloads[] =
+{
+  { "arith",   0x00, 0x14, 4 + 6 * 20000, "r16", 0xe4 },
+  { "memcpy",  0x16, 0x2a, 6 + 4 * 0x400, "r27", 0x05 },
+  { "calls",   0x2c, 0x38, 3 + 5 * 20000, "r16", 0x10 },
+};
+
+#define BENCH_ARCH(Name, ArchName, Image, Workloads, StackAddress, StackSize) \
+  { Name, ArchName, Image, sizeof(Image), Workloads, sizeof(Workloads) / sizeof(*Workloads), StackAddress, StackSize }
+
+static ArchitectureBench const s_Benches[] =
+{
+  BENCH_ARCH("x86",  "Intel x86",       s_X86Image,  s_X86Workloads,  0x2000000, 0x40000),
+  BENCH_ARCH("arm",  "ARM",             s_ArmImage,  s_ArmWorkloads,  0x2000000, 0x40000),
+  BENCH_ARCH("avr8", "Atmel AVR 8-bit", s_Avr8Image, s_Avr8Workloads, 0x100,     0x1000),
+};
+
+static char const* s_EmulatorNames[] = { "interpreter", "llvm" };
+
+enum { WarmRunNo = 3 };
+
+struct Result
+{
+  Result(void) : m_pStatus("ok"), m_ColdTime(), m_WarmTime(), m_ColdTranslationTime(), m_WarmTranslationTime(), m_MaxMemory() {}
+
+  char const* m_pStatus;
+  double      m_ColdTime;            // First run in ms: decoding, translation and execution
+  double      m_WarmTime;            // Fastest of the next runs in ms, blocks are already translated
+  double      m_ColdTranslationTime; // Part of m_ColdTime spent translating, in ms
+  double      m_WarmTranslationTime; // Part of m_WarmTime spent translating, e.g. code written again
+  u64         m_MaxMemory;           // Peak resident memory of the process in KiB
+};
+
+static u64 GetMaxMemory(void)
+{
+#if defined(_WIN32) || defined(WIN32)
+  PROCESS_MEMORY_COUNTERS Counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &Counters, sizeof(Counters)))
+    return 0;
+  return Counters.PeakWorkingSetSize / 1024;
+#else
+  rusage Usage;
+  if (getrusage(RUSAGE_SELF, &Usage) != 0)
+    return 0;
+# ifdef __APPLE__
+  return Usage.ru_maxrss / 1024; // bytes on OS X
+# else
+  return Usage.ru_maxrss;
+# endif
+#endif
+}
+
+// One JSON object by line, so results can be appended and compared between builds
+static void WriteResult(std::ostream& rOut, ArchitectureBench const& rBench, char const* pEmulName, Workload const& rWorkload, Result const& rRes)
+{
+  rOut << std::fixed << std::setprecision(3)
+    << "{\"architecture\": \"" << rBench.m_pName << "\""
+    << ", \"emulator\": \""    << pEmulName << "\""
+    << ", \"workload\": \""    << rWorkload.m_pName << "\""
+    << ", \"status\": \""      << rRes.m_pStatus << "\"";
+
+  if (std::string(rRes.m_pStatus) == "ok")
+  {
+    double InsnPerSec      = rRes.m_WarmTime > 0.0 ? rWorkload.m_InstructionNo / (rRes.m_WarmTime / 1000.0) : 0.0;
+    rOut
+      << ", \"instructions\": "            << rWorkload.m_InstructionNo
+      << ", \"cold_ms\": "                 << rRes.m_ColdTime
+      << ", \"warm_ms\": "                 << rRes.m_WarmTime
+      << ", \"translation_ms\": "          << rRes.m_ColdTranslationTime
+      << ", \"warm_translation_ms\": "     << rRes.m_WarmTranslationTime
+      << ", \"instructions_per_second\": " << std::setprecision(0) << InsnPerSec
+      << ", \"max_rss_kb\": "              << rRes.m_MaxMemory;
+  }
+
+  rOut << "}" << std::endl;
+}
+
+static Result RunWorkload(Medusa& rCore, Architecture::SharedPtr spArch, OperatingSystem::SharedPtr spOs, ArchitectureBench const& rBench, char const* pEmulName, Workload const& rWorkload)
+{
+  Result Res;
+
+  // A new execution for each workload, so the first run always translates its blocks
+  Execution Exec(&rCore, spArch, spOs);
+  if (!Exec.Initialize(rBench.m_StackAddress, rBench.m_StackSize) || !Exec.SetEmulator(pEmulName))
+  {
+    Res.m_pStatus = "failed";
+    return Res;
+  }
+
+  auto pCpuInfo = spArch->GetCpuInformation();
+  u32 ResReg     = pCpuInfo->ConvertNameToIdentifier(rWorkload.m_pResultRegister);
+  u32 ResRegSize = pCpuInfo->GetSizeOfRegisterInBit(ResReg) / 8;
+
+  typedef std::chrono::steady_clock Clock;
+  Clock::time_point StartTime;
+  u64 StartTranslationTime = 0;
+  bool AllReached = true, AllCorrect = true;
+
+  u32 RunNo = Exec.ExecuteFromSnapshot(Address(rWorkload.m_StartAddress), Address(rWorkload.m_EndAddress), 1 + WarmRunNo,
+    [&](u32, CpuContext*, MemoryContext*)
+  {
+    StartTranslationTime = Exec.GetTranslationTime();
+    StartTime = Clock::now();
+    return true;
+  },
+    [&](u32 RunIdx, bool Reached, CpuContext* pCpuCtxt, MemoryContext*)
+  {
+    double Time = std::chrono::duration<double, std::milli>(Clock::now() - StartTime).count();
+    double TranslationTime = (Exec.GetTranslationTime() - StartTranslationTime) / 1000000.0;
+    AllReached &= Reached;
+
+    // The result is read after the time is taken, so it isn't measured
+    u64 ResVal = 0;
+    if (!pCpuCtxt->ReadRegister(ResReg, &ResVal, ResRegSize) || ResVal != rWorkload.m_ResultValue)
+    {
+      if (AllCorrect)
+        std::cerr << rBench.m_pName << " " << pEmulName << " " << rWorkload.m_pName << ": "
+          << rWorkload.m_pResultRegister << " is " << std::hex << ResVal << " instead of " << rWorkload.m_ResultValue << std::dec << std::endl;
+      AllCorrect = false;
+    }
+    if (RunIdx == 0)
+    {
+      Res.m_ColdTime            = Time;
+      Res.m_ColdTranslationTime = TranslationTime;
+    }
+    else if (RunIdx == 1 || Time < Res.m_WarmTime)
+    {
+      Res.m_WarmTime            = Time;
+      Res.m_WarmTranslationTime = TranslationTime;
+    }
+  });
+
+  if (RunNo != 1 + WarmRunNo || !AllReached || !AllCorrect)
+    Res.m_pStatus = "failed";
+  Res.m_MaxMemory = GetMaxMemory();
+  return Res;
+}
+
+void QuietLog(std::wstring const&)
+{
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 2 && argc != 3)
+  {
+    std::cerr << "usage: " << argv[0] << " x86|arm|avr8 [output file]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  ArchitectureBench const* pBench = nullptr;
+  for (auto const& rBench : s_Benches)
+    if (rBench.m_pName == std::string(argv[1]))
+      pBench = &rBench;
+  if (pBench == nullptr)
+  {
+    std::cerr << "unknown architecture: " << argv[1] << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::ofstream OutFile;
+  if (argc == 3)
+  {
+    OutFile.open(argv[2], std::ios_base::out | std::ios_base::app);
+    if (!OutFile.is_open())
+    {
+      std::cerr << "unable to open " << argv[2] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  std::ostream& rOut = argc == 3 ? OutFile : std::cout;
+
+  Log::SetLog(QuietLog);
+
+  try
+  {
+    BinaryStream::SharedPtr spBinStrm = std::make_shared<MemoryBinaryStream>(pBench->m_pImage, pBench->m_ImageSize);
+
+    auto& rModMgr = ModuleManager::Instance();
+    rModMgr.LoadModules(L".", *spBinStrm);
+
+    Loader::SharedPtr spLdr;
+    auto Loaders = rModMgr.GetLoaders();
+    for (auto itLdr = std::begin(Loaders); itLdr != std::end(Loaders); ++itLdr)
+      if ((*itLdr)->GetName() == "Raw file")
+        spLdr = *itLdr;
+
+    Architecture::SharedPtr spArch;
+    auto Archs = rModMgr.GetArchitectures();
+    for (auto itArch = std::begin(Archs); itArch != std::end(Archs); ++itArch)
+      if ((*itArch)->GetName() == pBench->m_pArchName)
+        spArch = *itArch;
+
+    auto spDb = rModMgr.GetDatabase("Text");
+    if (spLdr == nullptr || spArch == nullptr || spDb == nullptr)
+    {
+      std::cerr << "raw loader, text database or " << pBench->m_pArchName << " module not found" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // Architectures without contexts can't be emulated yet, they're still reported so
+    // results of all architectures have the same rows
+    auto pCpuCtxt = spArch->MakeCpuContext();
+    auto pMemCtxt = spArch->MakeMemoryContext();
+    bool Supported = pCpuCtxt != nullptr && pMemCtxt != nullptr;
+    delete pCpuCtxt;
+    delete pMemCtxt;
+    if (!Supported)
+    {
+      for (auto pEmulName : s_EmulatorNames)
+        for (u32 WorkloadIdx = 0; WorkloadIdx < pBench->m_WorkloadNo; ++WorkloadIdx)
+        {
+          Result Res;
+          Res.m_pStatus = "unsupported";
+          WriteResult(rOut, *pBench, pEmulName, pBench->m_pWorkloads[WorkloadIdx], Res);
+        }
+      return EXIT_SUCCESS;
+    }
+
+    ConfigurationModel CfgMdl;
+    spArch->FillConfigurationModel(CfgMdl);
+    spLdr->Configure(CfgMdl.GetConfiguration());
+    spArch->UseConfiguration(CfgMdl.GetConfiguration());
+    auto spOs = rModMgr.GetOperatingSystem(spLdr, spArch);
+
+    std::string DbPath = std::string("emulbench_") + pBench->m_pName + spDb->GetExtension();
+    std::wstring WDbPath(std::begin(DbPath), std::end(DbPath));
+    if (spDb->Create(WDbPath, true) == false)
+    {
+      std::cerr << "unable to create " << DbPath << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    for (u32 WorkloadIdx = 0; WorkloadIdx < pBench->m_WorkloadNo; ++WorkloadIdx)
+    {
+      auto const& rWorkload = pBench->m_pWorkloads[WorkloadIdx];
+      spDb->AddLabel(rWorkload.m_StartAddress, Label(rWorkload.m_pName, Label::Code | Label::Exported));
+    }
+
+    Medusa Core;
+    Core.Start(spBinStrm, spLdr, spArch, spOs, spDb);
+    Core.WaitForTasks();
+
+    bool Failed = false;
+    for (auto pEmulName : s_EmulatorNames)
+    {
+      bool Available = rModMgr.GetEmulator(pEmulName) != nullptr;
+      for (u32 WorkloadIdx = 0; WorkloadIdx < pBench->m_WorkloadNo; ++WorkloadIdx)
+      {
+        auto const& rWorkload = pBench->m_pWorkloads[WorkloadIdx];
+        Result Res;
+        if (Available)
+          Res = RunWorkload(Core, spArch, spOs, *pBench, pEmulName, rWorkload);
+        else
+          Res.m_pStatus = "unavailable";
+        if (std::string(Res.m_pStatus) == "failed")
+          Failed = true;
+        WriteResult(rOut, *pBench, pEmulName, rWorkload, Res);
+      }
+    }
+
+    spDb->Close();
+    std::remove(DbPath.c_str());
+
+    return Failed ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  catch (Exception& e)
+  {
+    std::wcerr << e.What() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
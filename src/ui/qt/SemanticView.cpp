@@ -18,7 +18,7 @@ SemanticView::SemanticView(QWidget *parent, medusa::Medusa const& core, medusa::
   cfg.ForEachInstruction([&](medusa::Address const& addr)
   {
     QString addrStr = QString::fromStdString(addr.ToString()) + ": ";
-    auto insn = std::dynamic_pointer_cast<medusa::Instruction const>(core.GetCell(addr));
+    auto insn = std::dynamic_pointer_cast<medusa::Instruction const>(core.GetCellWithSemantic(addr));
     if (insn == nullptr)
     {
       append(addrStr + "(not an instruction)\n");
@@ -0,0 +1,903 @@
+// Encodings in the order the former ARM and Thumb dispatchers tested them (one mask after the
+// other), test_arm_dispatch checks the decision trees select the same encodings.
+// Each entry holds the mask, the value, the mnemonic and the length of the instruction.
+
+static ArmEncoding const s_ArmEncodings[] =
+{
+  { 0x0fe00000, 0x02a00000, "ADC",       4 },
+  { 0x0fe00000, 0x02800000, "ADD",       4 },
+  { 0x0fe00000, 0x02000000, "AND",       4 },
+  { 0x0fe00000, 0x03c00000, "BIC",       4 },
+  { 0x0fe00000, 0x02200000, "EOR",       4 },
+  { 0x0fe00000, 0x03800000, "ORR",       4 },
+  { 0x0fe00000, 0x02600000, "RSB",       4 },
+  { 0x0fe00000, 0x02e00000, "RSC",       4 },
+  { 0x0fe00000, 0x02c00000, "SBC",       4 },
+  { 0x0fe00000, 0x02400000, "SUB",       4 },
+  { 0x0ff0f000, 0x03700000, "CMN",       4 },
+  { 0x0ff0f000, 0x03500000, "CMP",       4 },
+  { 0x0ff0f000, 0x03300000, "TEQ",       4 },
+  { 0x0ff0f000, 0x03100000, "TST",       4 },
+  { 0x0fff0000, 0x028f0000, "ADR",       4 },
+  { 0x0fff0000, 0x024f0000, "SUB",       4 },
+  { 0x0fff0000, 0x08bd0000, "POP",       4 },
+  { 0x0fff0000, 0x092d0000, "PUSH",      4 },
+  { 0xff800b50, 0xf2800340, "VQD",       4 },
+  { 0xff30f010, 0xf710f000, "PLD",       4 },
+  { 0x0ff00ff0, 0x01000050, "QADD",      4 },
+  { 0x0ff00ff0, 0x06200f10, "QADD16",    4 },
+  { 0x0ff00ff0, 0x06200f90, "QADD8",     4 },
+  { 0x0ff00ff0, 0x06200f30, "QASX",      4 },
+  { 0x0ff00ff0, 0x01400050, "QDADD",     4 },
+  { 0x0ff00ff0, 0x01600050, "QDSUB",     4 },
+  { 0x0ff00ff0, 0x06200f50, "QSAX",      4 },
+  { 0x0ff00ff0, 0x01200050, "QSUB",      4 },
+  { 0x0ff00ff0, 0x06200f70, "QSUB16",    4 },
+  { 0x0ff00ff0, 0x06200ff0, "QSUB8",     4 },
+  { 0x0ff00ff0, 0x06100f10, "SADD16",    4 },
+  { 0x0ff00ff0, 0x06100f90, "SADD8",     4 },
+  { 0x0ff00ff0, 0x06100f30, "SASX",      4 },
+  { 0x0ff00ff0, 0x06800fb0, "SEL",       4 },
+  { 0x0ff00ff0, 0x06300f10, "SHADD16",   4 },
+  { 0x0ff00ff0, 0x06300f90, "SHADD8",    4 },
+  { 0x0ff00ff0, 0x06300f30, "SHASX",     4 },
+  { 0x0ff00ff0, 0x06300f50, "SHSAX",     4 },
+  { 0x0ff00ff0, 0x06300f70, "SHSUB16",   4 },
+  { 0x0ff00ff0, 0x06300ff0, "SHSUB8",    4 },
+  { 0x0ff00ff0, 0x06a00f30, "SSAT16",    4 },
+  { 0x0ff00ff0, 0x06100f50, "SSAX",      4 },
+  { 0x0ff00ff0, 0x06100f70, "SSUB16",    4 },
+  { 0x0ff00ff0, 0x06100ff0, "SSUB8",     4 },
+  { 0x0ff00ff0, 0x01800f90, "STREX",     4 },
+  { 0x0ff00ff0, 0x01c00f90, "STREXB",    4 },
+  { 0x0ff00ff0, 0x01a00f90, "STREXD",    4 },
+  { 0x0ff00ff0, 0x01e00f90, "STREXH",    4 },
+  { 0x0ff00ff0, 0x06500f10, "UADD16",    4 },
+  { 0x0ff00ff0, 0x06500f90, "UADD8",     4 },
+  { 0x0ff00ff0, 0x06500f30, "UASX",      4 },
+  { 0x0ff00ff0, 0x06700f10, "UHADD16",   4 },
+  { 0x0ff00ff0, 0x06700f90, "UHADD8",    4 },
+  { 0x0ff00ff0, 0x06700f30, "UHASX",     4 },
+  { 0x0ff00ff0, 0x06700f50, "UHSAX",     4 },
+  { 0x0ff00ff0, 0x06700f70, "UHSUB16",   4 },
+  { 0x0ff00ff0, 0x06700ff0, "UHSUB8",    4 },
+  { 0x0ff00ff0, 0x06600f10, "UQADD16",   4 },
+  { 0x0ff00ff0, 0x06600f90, "UQADD8",    4 },
+  { 0x0ff00ff0, 0x06600f30, "UQASX",     4 },
+  { 0x0ff00ff0, 0x06600f50, "UQSAX",     4 },
+  { 0x0ff00ff0, 0x06600f70, "UQSUB16",   4 },
+  { 0x0ff00ff0, 0x06600ff0, "UQSUB8",    4 },
+  { 0x0ff00ff0, 0x06e00f30, "USAT16",    4 },
+  { 0x0ff00ff0, 0x06500f50, "USAX",      4 },
+  { 0x0ff00ff0, 0x06500f70, "USUB16",    4 },
+  { 0x0ff00ff0, 0x06500ff0, "USUB8",     4 },
+  { 0x0e500010, 0x06100000, "LDR",       4 },
+  { 0x0e500010, 0x06500000, "LDRB",      4 },
+  { 0x0e500010, 0x06000000, "STR",       4 },
+  { 0x0e500010, 0x06400000, "STRB",      4 },
+  { 0xfe100000, 0xfc100000, "LDC2",      4 },
+  { 0xfe100000, 0xfc000000, "STC2",      4 },
+  { 0x0ff000b0, 0x01200080, "SMLAW",     4 },
+  { 0x0ff000b0, 0x012000a0, "SMULW",     4 },
+  { 0xfffffff0, 0xf57ff050, "DMB",       4 },
+  { 0xfffffff0, 0xf57ff040, "DSB",       4 },
+  { 0xfffffff0, 0xf57ff060, "ISB",       4 },
+  { 0x0f7f00f0, 0x014f00d0, "LDRD",      4 },
+  { 0x0f7f00f0, 0x015f00b0, "LDRH",      4 },
+  { 0x0f7f00f0, 0x015f00d0, "LDRSB",     4 },
+  { 0x0f7f00f0, 0x015f00f0, "LDRSH",     4 },
+  { 0x0fe00030, 0x06a00010, "SSAT",      4 },
+  { 0x0fe00030, 0x06e00010, "USAT",      4 },
+  { 0xfe870fd0, 0xf2800a10, "VMOVL",     4 },
+  { 0x0fbf0f00, 0x0cbd0b00, "VPOP",      4 },
+  { 0x0fbf0f00, 0x0cbd0a00, "FLDMX",     4 },
+  { 0x0fbf0f00, 0x0d2d0b00, "VPUSH",     4 },
+  { 0x0fbf0f00, 0x0d2d0a00, "FSTMX",     4 },
+  { 0x0fd00000, 0x08900000, "LDM",       4 },
+  { 0x0fd00000, 0x08100000, "LDMDA",     4 },
+  { 0x0fd00000, 0x09100000, "LDMDB",     4 },
+  { 0x0fd00000, 0x09900000, "LDMIB",     4 },
+  { 0x0fd00000, 0x08800000, "STM",       4 },
+  { 0x0fd00000, 0x08000000, "STMDA",     4 },
+  { 0x0fd00000, 0x09000000, "STMDB",     4 },
+  { 0x0fd00000, 0x09800000, "STMIB",     4 },
+  { 0xfe800f10, 0xf2000710, "VABA",      4 },
+  { 0xfe800f10, 0xf2000700, "VABD",      4 },
+  { 0xfe800f10, 0xf2000310, "VCGE",      4 },
+  { 0xfe800f10, 0xf2000300, "VCGT",      4 },
+  { 0xfe800f10, 0xf2000900, "V",         4 },
+  { 0xfe800f10, 0xf2000910, "VMUL",      4 },
+  { 0xfe800f10, 0xf2000010, "VQADD",     4 },
+  { 0xfe800f10, 0xf2000510, "VQRSHL",    4 },
+  { 0xfe800f10, 0xf2000410, "VQSHL",     4 },
+  { 0xfe800f10, 0xf2000210, "VQSUB",     4 },
+  { 0xfe800f10, 0xf2000100, "VRHADD",    4 },
+  { 0xfe800f10, 0xf2000500, "VRSHL",     4 },
+  { 0xfe800f10, 0xf2800210, "VRSHR",     4 },
+  { 0xfe800f10, 0xf2800310, "VRSRA",     4 },
+  { 0xfe800f10, 0xf2000400, "VSHL",      4 },
+  { 0xfe800f10, 0xf2800010, "VSHR",      4 },
+  { 0xfe800f10, 0xf2800110, "VSRA",      4 },
+  { 0x0ff003f0, 0x06a00070, "SXTAB",     4 },
+  { 0x0ff003f0, 0x06800070, "SXTAB16",   4 },
+  { 0x0ff003f0, 0x06b00070, "SXTAH",     4 },
+  { 0x0ff003f0, 0x06e00070, "UXTAB",     4 },
+  { 0x0ff003f0, 0x06c00070, "UXTAB16",   4 },
+  { 0x0ff003f0, 0x06f00070, "UXTAH",     4 },
+  { 0xffb00c10, 0xf3b00800, "V",         4 },
+  { 0x0ff000f0, 0x01200070, "BKPT",      4 },
+  { 0x0ff000f0, 0x00600090, "MLS",       4 },
+  { 0x0ff000f0, 0x00400090, "UMAAL",     4 },
+  { 0x0ff000f0, 0x07800010, "USADA8",    4 },
+  { 0xfe800d10, 0xf2000000, "VH",        4 },
+  { 0x0fbf0e50, 0x0eb40a40, "VCMP",      4 },
+  { 0xffb30e10, 0xf3b30600, "VCVT",      4 },
+  { 0xffb30e10, 0xf3b00000, "VREV",      4 },
+  { 0x0f7f0000, 0x051f0000, "LDR",       4 },
+  { 0x0f7f0000, 0x055f0000, "LDRB",      4 },
+  { 0xffb00f10, 0xf2000110, "VAND",      4 },
+  { 0xffb00f10, 0xf2100110, "VBIC",      4 },
+  { 0xffb00f10, 0xf3000110, "VEOR",      4 },
+  { 0xffb00f10, 0xf2300110, "VORN",      4 },
+  { 0xffb00f10, 0xf2200110, "VORR",      4 },
+  { 0xff70f010, 0xf650f000, "PLI",       4 },
+  { 0x0f700000, 0x04700000, "LDRBT",     4 },
+  { 0x0f700000, 0x04300000, "LDRT",      4 },
+  { 0x0f700000, 0x04600000, "STRBT",     4 },
+  { 0x0f700000, 0x04200000, "STRT",      4 },
+  { 0x0ff00fff, 0x01900f9f, "LDREX",     4 },
+  { 0x0ff00fff, 0x01d00f9f, "LDREXB",    4 },
+  { 0x0ff00fff, 0x01b00f9f, "LDREXD",    4 },
+  { 0x0ff00fff, 0x01f00f9f, "LDREXH",    4 },
+  { 0x0ff0f090, 0x01700010, "CMN",       4 },
+  { 0x0ff0f090, 0x01500010, "CMP",       4 },
+  { 0x0ff0f090, 0x01300010, "TEQ",       4 },
+  { 0x0ff0f090, 0x01100010, "TST",       4 },
+  { 0x0ff000d0, 0x07000010, "SMLAD",     4 },
+  { 0x0ff000d0, 0x07400010, "SMLALD",    4 },
+  { 0x0ff000d0, 0x07000050, "SMLSD",     4 },
+  { 0x0ff000d0, 0x07400050, "SMLSLD",    4 },
+  { 0x0ff000d0, 0x07500010, "SMMLA",     4 },
+  { 0x0ff000d0, 0x075000d0, "SMMLS",     4 },
+  { 0x0fef0070, 0x01a00040, "ASR",       4 },
+  { 0x0fef0070, 0x01a00000, "LSL",       4 },
+  { 0x0fef0070, 0x01a00020, "LSR",       4 },
+  { 0x0fef0070, 0x01a00060, "ROR",       4 },
+  { 0x0fe00fd0, 0x0c400a10, "VMOV",      4 },
+  { 0x0fe00fd0, 0x0c400b10, "VMOV",      4 },
+  { 0x0e100f00, 0x0c100b00, "VLDM",      4 },
+  { 0x0e100f00, 0x0c100a00, "FLDMX",     4 },
+  { 0x0e100f00, 0x0c000b00, "VSTM",      4 },
+  { 0x0e100f00, 0x0c000a00, "FSTMX",     4 },
+  { 0xfff00000, 0xfc400000, "MCRR2",     4 },
+  { 0xfff00000, 0xfc500000, "MRRC2",     4 },
+  { 0xffb00f00, 0xf4a00c00, "VLD1",      4 },
+  { 0x0fbf0e7f, 0x0eb50a40, "VCMP",      4 },
+  { 0x0fe00090, 0x00a00010, "ADC",       4 },
+  { 0x0fe00090, 0x00800010, "ADD",       4 },
+  { 0x0fe00090, 0x00000010, "AND",       4 },
+  { 0x0fe00090, 0x01c00010, "BIC",       4 },
+  { 0x0fe00090, 0x00200010, "EOR",       4 },
+  { 0x0fe00090, 0x01800010, "ORR",       4 },
+  { 0x0fe00090, 0x00600010, "RSB",       4 },
+  { 0x0fe00090, 0x00e00010, "RSC",       4 },
+  { 0x0fe00090, 0x00c00010, "SBC",       4 },
+  { 0x0fe00090, 0x00400010, "SUB",       4 },
+  { 0xfe800ed0, 0xf2800850, "VQRSHR",    4 },
+  { 0xfe800ed0, 0xf2800810, "VQSHR",     4 },
+  { 0xfeb80090, 0xf2800010, "VMOV",      4 },
+  { 0xffb30f10, 0xf3b00600, "VPADAL",    4 },
+  { 0xffb30f10, 0xf3b00200, "VPADDL",    4 },
+  { 0xffb30f10, 0xf3b20200, "VQMOV",     4 },
+  { 0x0ff3f000, 0x0320f000, "MSR",       4 },
+  { 0x0f000000, 0x0a000000, "B",         4 },
+  { 0x0f000000, 0x0b000000, "BL",        4 },
+  { 0x0f000000, 0x0f000000, "SVC",       4 },
+  { 0x0fb00ef0, 0x0eb00a00, "VMOV",      4 },
+  { 0x0fe00070, 0x07c00010, "BFI",       4 },
+  { 0x0fe00070, 0x07a00050, "SBFX",      4 },
+  { 0x0fe00070, 0x07e00050, "UBFX",      4 },
+  { 0x0fef00f0, 0x01a00050, "ASR",       4 },
+  { 0x0fef00f0, 0x01a00010, "LSL",       4 },
+  { 0x0fef00f0, 0x01a00030, "LSR",       4 },
+  { 0x0fef00f0, 0x01a00070, "ROR",       4 },
+  { 0x0fff0ff0, 0x016f0f10, "CLZ",       4 },
+  { 0x0fff0ff0, 0x06ff0f30, "RBIT",      4 },
+  { 0x0fff0ff0, 0x06bf0f30, "REV",       4 },
+  { 0x0fff0ff0, 0x06bf0fb0, "REV16",     4 },
+  { 0x0fff0ff0, 0x06ff0fb0, "REVSH",     4 },
+  { 0xfe800fd0, 0xf2800a10, "VSHLL",     4 },
+  { 0xfeb800b0, 0xf2800030, "VBIC",      4 },
+  { 0xfeb800b0, 0xf2800010, "VORR",      4 },
+  { 0x0f100f1f, 0x0e100b10, "VMOV",      4 },
+  { 0x0e100000, 0x0c100000, "LDC",       4 },
+  { 0x0e100000, 0x0c000000, "STC",       4 },
+  { 0x0f300f00, 0x0d100b00, "VLDR",      4 },
+  { 0x0f300f00, 0x0d100a00, "VLDR",      4 },
+  { 0x0f300f00, 0x0d000b00, "VSTR",      4 },
+  { 0x0f300f00, 0x0d000a00, "VSTR",      4 },
+  { 0xffb30ed0, 0xf3b20600, "VCVT",      4 },
+  { 0xffb00010, 0xf2b00000, "VEXT",      4 },
+  { 0x0fbf0ed0, 0x0eb00ac0, "VABS",      4 },
+  { 0x0fbf0ed0, 0x0eb70ac0, "VCVT",      4 },
+  { 0x0fbf0ed0, 0x0eb00a40, "VMOV",      4 },
+  { 0x0fbf0ed0, 0x0eb10a40, "VNEG",      4 },
+  { 0x0fbf0ed0, 0x0eb10ac0, "VSQRT",     4 },
+  { 0x0fe000f0, 0x00200090, "MLA",       4 },
+  { 0x0fe000f0, 0x00e00090, "SMLAL",     4 },
+  { 0x0fe000f0, 0x00c00090, "SMULL",     4 },
+  { 0x0fe000f0, 0x00a00090, "UMLAL",     4 },
+  { 0x0fe000f0, 0x00800090, "UMULL",     4 },
+  { 0x0fbe0f50, 0x0eb20a40, "VCVT",      4 },
+  { 0x0fef0090, 0x01e00010, "MVN",       4 },
+  { 0xfe000000, 0xfa000000, "BLX",       4 },
+  { 0x0fe0f0f0, 0x00000090, "MUL",       4 },
+  { 0x0fe00f7f, 0x0e000a10, "VMOV",      4 },
+  { 0x0fe0007f, 0x07c0001f, "BFC",       4 },
+  { 0x0fef0ff0, 0x01a00000, "MOV",       4 },
+  { 0x0fef0ff0, 0x01a00060, "RRX",       4 },
+  { 0x0f100010, 0x0e000010, "MCR",       4 },
+  { 0x0f100010, 0x0e100010, "MRC",       4 },
+  { 0xffb00300, 0xf4a00000, "VLD1",      4 },
+  { 0xffb00300, 0xf4800000, "VST1",      4 },
+  { 0xffb30e90, 0xf3b30400, "VRECPE",    4 },
+  { 0xffb30e90, 0xf3b30480, "VRSQRTE",   4 },
+  { 0x0e5000f0, 0x004000d0, "LDRD",      4 },
+  { 0x0e5000f0, 0x005000b0, "LDRH",      4 },
+  { 0x0e5000f0, 0x005000d0, "LDRSB",     4 },
+  { 0x0e5000f0, 0x005000f0, "LDRSH",     4 },
+  { 0x0e5000f0, 0x004000f0, "STRD",      4 },
+  { 0x0e5000f0, 0x004000b0, "STRH",      4 },
+  { 0xffa00f10, 0xf3200d00, "VABD",      4 },
+  { 0xffa00f10, 0xf2000d00, "VADD",      4 },
+  { 0xffa00f10, 0xf2000e00, "VCEQ",      4 },
+  { 0xffa00f10, 0xf3000e00, "VCGE",      4 },
+  { 0xffa00f10, 0xf3200e00, "VCGT",      4 },
+  { 0xffa00f10, 0xf3000d10, "VMUL",      4 },
+  { 0xffa00f10, 0xf3000d00, "VPADD",     4 },
+  { 0xffa00f10, 0xf2000f10, "VRECPS",    4 },
+  { 0xffa00f10, 0xf2200f10, "VRSQRTS",   4 },
+  { 0xffa00f10, 0xf2200d00, "VSUB",      4 },
+  { 0x0f700ff0, 0x003000b0, "LDRHT",     4 },
+  { 0x0f700ff0, 0x003000d0, "LDRSBT",    4 },
+  { 0x0f700ff0, 0x003000f0, "LDRSHT",    4 },
+  { 0x0f700ff0, 0x002000b0, "STRHT",     4 },
+  { 0xff800d50, 0xf2800900, "VQD",       4 },
+  { 0x0fff03f0, 0x06af0070, "SXTB",      4 },
+  { 0x0fff03f0, 0x068f0070, "SXTB16",    4 },
+  { 0x0fff03f0, 0x06bf0070, "SXTH",      4 },
+  { 0x0fff03f0, 0x06ef0070, "UXTB",      4 },
+  { 0x0fff03f0, 0x06cf0070, "UXTB16",    4 },
+  { 0x0fff03f0, 0x06ff0070, "UXTH",      4 },
+  { 0x0f900f1f, 0x0e000b10, "VMOV",      4 },
+  { 0x0ff00030, 0x06800010, "PKHTB",     4 },
+  { 0x0fe00010, 0x00a00000, "ADC",       4 },
+  { 0x0fe00010, 0x00800000, "ADD",       4 },
+  { 0x0fe00010, 0x00000000, "AND",       4 },
+  { 0x0fe00010, 0x01c00000, "BIC",       4 },
+  { 0x0fe00010, 0x00200000, "EOR",       4 },
+  { 0x0fe00010, 0x01800000, "ORR",       4 },
+  { 0x0fe00010, 0x00600000, "RSB",       4 },
+  { 0x0fe00010, 0x00e00000, "RSC",       4 },
+  { 0x0fe00010, 0x00c00000, "SBC",       4 },
+  { 0x0fe00010, 0x00400000, "SUB",       4 },
+  { 0xfe800e50, 0xf2800000, "VADDW",     4 },
+  { 0xfe800e50, 0xf2800840, "VMUL",      4 },
+  { 0xfe800e50, 0xf2800200, "VSUBW",     4 },
+  { 0xffb30fd0, 0xf3b20200, "VMOVN",     4 },
+  { 0xffb30fd0, 0xf3b20300, "VSHLL",     4 },
+  { 0x0fef0000, 0x028d0000, "ADD",       4 },
+  { 0x0fef0000, 0x03a00000, "MOV",       4 },
+  { 0x0fef0000, 0x03e00000, "MVN",       4 },
+  { 0x0fef0000, 0x024d0000, "SUB",       4 },
+  { 0x0e500000, 0x04100000, "LDR",       4 },
+  { 0x0e500000, 0x04500000, "LDRB",      4 },
+  { 0x0e500000, 0x04000000, "STR",       4 },
+  { 0x0e500000, 0x04400000, "STRB",      4 },
+  { 0x0e500ff0, 0x000000d0, "LDRD",      4 },
+  { 0x0e500ff0, 0x001000b0, "LDRH",      4 },
+  { 0x0e500ff0, 0x001000d0, "LDRSB",     4 },
+  { 0x0e500ff0, 0x001000f0, "LDRSH",     4 },
+  { 0x0e500ff0, 0x000000f0, "STRD",      4 },
+  { 0x0e500ff0, 0x000000b0, "STRH",      4 },
+  { 0xffb30b90, 0xf3b10300, "VABS",      4 },
+  { 0xffb30b90, 0xf3b10100, "VCEQ",      4 },
+  { 0xffb30b90, 0xf3b10080, "VCGE",      4 },
+  { 0xffb30b90, 0xf3b10000, "VCGT",      4 },
+  { 0xffb30b90, 0xf3b10180, "VCLE",      4 },
+  { 0xffb30b90, 0xf3b10200, "VCLT",      4 },
+  { 0xffb30b90, 0xf3b10380, "VNEG",      4 },
+  { 0x0f7000f0, 0x007000b0, "LDRHT",     4 },
+  { 0x0f7000f0, 0x007000d0, "LDRSBT",    4 },
+  { 0x0f7000f0, 0x007000f0, "LDRSHT",    4 },
+  { 0x0f7000f0, 0x006000b0, "STRHT",     4 },
+  { 0xfe800f50, 0xf2800500, "VABAL",     4 },
+  { 0xfe800f50, 0xf2800700, "VABDL",     4 },
+  { 0xfe800f50, 0xf2800a40, "VMULL",     4 },
+  { 0xfe800f50, 0xf2800c40, "VQDMULH",   4 },
+  { 0xfe800f50, 0xf2800d40, "VQRDMULH",  4 },
+  { 0xff800fd0, 0xf2800850, "VRSHRN",    4 },
+  { 0xff800fd0, 0xf2800810, "VSHRN",     4 },
+  { 0xfe800e90, 0xf2800e10, "VCVT",      4 },
+  { 0xff000010, 0xfe000000, "CDP2",      4 },
+  { 0x0f900f5f, 0x0e800b10, "VDUP",      4 },
+  { 0x0ff00090, 0x01000080, "SMLA",      4 },
+  { 0x0ff00090, 0x01400080, "SMLAL",     4 },
+  { 0x0ff00090, 0x01600080, "SMUL",      4 },
+  { 0xffb00f90, 0xf3b00c00, "VDUP",      4 },
+  { 0xfe800f00, 0xf2000600, "V",         4 },
+  { 0xfe800f00, 0xf2000a00, "VP",        4 },
+  { 0x0ff0f010, 0x01700000, "CMN",       4 },
+  { 0x0ff0f010, 0x01500000, "CMP",       4 },
+  { 0x0ff0f010, 0x01300000, "TEQ",       4 },
+  { 0x0ff0f010, 0x01100000, "TST",       4 },
+  { 0x0ff00000, 0x0c400000, "MCRR",      4 },
+  { 0x0ff00000, 0x03000000, "MOVW",      4 },
+  { 0x0ff00000, 0x03400000, "MOVT",      4 },
+  { 0x0ff00000, 0x0c500000, "MRRC",      4 },
+  { 0xfe800e10, 0xf2800610, "VQSHL",     4 },
+  { 0x0f000010, 0x0e000000, "CDP",       4 },
+  { 0x0f700010, 0x06700000, "LDRBT",     4 },
+  { 0x0f700010, 0x06300000, "LDRT",      4 },
+  { 0x0f700010, 0x06600000, "STRBT",     4 },
+  { 0x0f700010, 0x06200000, "STRT",      4 },
+  { 0xff7ff000, 0xf55ff000, "PLD",       4 },
+  { 0xffb30f90, 0xf3b00400, "VCLS",      4 },
+  { 0xffb30f90, 0xf3b00480, "VCLZ",      4 },
+  { 0xffb30f90, 0xf3b00500, "VCNT",      4 },
+  { 0xffb30f90, 0xf3b00580, "VMVN",      4 },
+  { 0xffb30f90, 0xf3b00700, "VQABS",     4 },
+  { 0xffb30f90, 0xf3b00780, "VQNEG",     4 },
+  { 0xffb30f90, 0xf3b20000, "VSWP",      4 },
+  { 0xffb30f90, 0xf3b20080, "VTRN",      4 },
+  { 0xffb30f90, 0xf3b20100, "VUZP",      4 },
+  { 0xffb30f90, 0xf3b20180, "VZIP",      4 },
+  { 0x0fb00ff0, 0x01000090, "SWP",       4 },
+  { 0xfe1f0000, 0xfc1f0000, "LDC2",      4 },
+  { 0xff100010, 0xfe000010, "MCR2",      4 },
+  { 0xff100010, 0xfe100010, "MRC2",      4 },
+  { 0x0fb80e50, 0x0eb80a40, "VCVT",      4 },
+  { 0x0ffffff0, 0x012fff30, "BLX",       4 },
+  { 0x0ffffff0, 0x012fff10, "BX",        4 },
+  { 0x0ffffff0, 0x012fff20, "BXJ",       4 },
+  { 0x0ffffff0, 0x0320f0f0, "DBG",       4 },
+  { 0xff30f000, 0xf510f000, "PLD",       4 },
+  { 0x0ff0f0f0, 0x0780f010, "USAD8",     4 },
+  { 0x0fb00e10, 0x0e000a00, "V",         4 },
+  { 0x0fb00e10, 0x0e100a00, "VNMLS",     4 },
+  { 0xfe800a50, 0xf2800040, "V",         4 },
+  { 0xfe800b50, 0xf2800240, "V",         4 },
+  { 0xfe800d50, 0xf2800800, "V",         4 },
+  { 0xfe800d50, 0xf2800c00, "VMULL",     4 },
+  { 0xfffffdff, 0xf1010000, "SETEND",    4 },
+  { 0x0fba0e50, 0x0eba0a40, "VCVT",      4 },
+  { 0xff800f10, 0xf3000e10, "V",         4 },
+  { 0xff800f10, 0xf2000800, "VADD",      4 },
+  { 0xff800f10, 0xf3000110, "V",         4 },
+  { 0xff800f10, 0xf3000810, "VCEQ",      4 },
+  { 0xff800f10, 0xf2000f00, "V",         4 },
+  { 0xff800f10, 0xf2000d10, "V",         4 },
+  { 0xff800f10, 0xf2000b10, "VPADD",     4 },
+  { 0xff800f10, 0xf3000f00, "VP",        4 },
+  { 0xff800f10, 0xf2000b00, "VQDMULH",   4 },
+  { 0xff800f10, 0xf3000b00, "VQRDMULH",  4 },
+  { 0xff800f10, 0xf2800510, "VSHL",      4 },
+  { 0xff800f10, 0xf3800510, "VSLI",      4 },
+  { 0xff800f10, 0xf3800410, "VSRI",      4 },
+  { 0xff800f10, 0xf3000800, "VSUB",      4 },
+  { 0xff800f10, 0xf2000810, "VTST",      4 },
+  { 0xff70f000, 0xf450f000, "PLI",       4 },
+  { 0x0e1f0000, 0x0c1f0000, "LDC",       4 },
+  { 0xff800f50, 0xf2800400, "VADDHN",    4 },
+  { 0xff800f50, 0xf2800d00, "VQDMULL",   4 },
+  { 0xff800f50, 0xf2800b40, "VQDMULL",   4 },
+  { 0xff800f50, 0xf3800400, "VRADDHN",   4 },
+  { 0xff800f50, 0xf3800600, "VRSUBHN",   4 },
+  { 0xff800f50, 0xf2800600, "VSUBHN",    4 },
+  { 0x0fb00e50, 0x0e300a00, "VADD",      4 },
+  { 0x0fb00e50, 0x0e800a00, "VDIV",      4 },
+  { 0x0fb00e50, 0x0e200a00, "VMUL",      4 },
+  { 0x0fb00e50, 0x0e200a40, "VNMUL",     4 },
+  { 0x0fb00e50, 0x0e300a40, "VSUB",      4 },
+  { 0x0fef0010, 0x008d0000, "ADD",       4 },
+  { 0x0fef0010, 0x01e00000, "MVN",       4 },
+  { 0x0fef0010, 0x004d0000, "SUB",       4 },
+  { 0xffffffff, 0xf57ff01f, "CLREX",     4 },
+  { 0x0ff0f0d0, 0x0750f010, "SMMUL",     4 },
+  { 0x0ff0f0d0, 0x0700f010, "SMUAD",     4 },
+  { 0x0ff0f0d0, 0x0700f050, "SMUSD",     4 },
+  { 0x0ff3fff0, 0x0120f000, "MSR",       4 },
+  { 0x0fff0fff, 0x010f0000, "MRS",       4 },
+  { 0x0fff0fff, 0x049d0004, "POP",       4 },
+  { 0x0fff0fff, 0x052d0004, "PUSH",      4 },
+  { 0x0fff0fff, 0x0ef10a10, "VMRS",      4 },
+  { 0x0fff0fff, 0x0ee10a10, "VMSR",      4 },
+  { 0xffb00000, 0xf4200000, "VLD1",      4 },
+  { 0xffb00000, 0xf4000000, "VST1",      4 },
+  { 0x0fffffff, 0x0320f000, "NOP",       4 },
+  { 0x0fffffff, 0x0320f004, "SEV",       4 },
+  { 0x0fffffff, 0x0320f002, "WFE",       4 },
+  { 0x0fffffff, 0x0320f003, "WFI",       4 },
+  { 0x0fffffff, 0x0320f001, "YIELD",     4 },
+};
+
+static ArmEncoding const s_ThumbEncodings[] =
+{
+  { 0xfbe08000, 0xf1400000, "ADC",       4 },
+  { 0xfbe08000, 0xf1000000, "ADD",       4 },
+  { 0xfbe08000, 0xf0000000, "AND",       4 },
+  { 0xfbe08000, 0xf0200000, "BIC",       4 },
+  { 0xfbe08000, 0xf0800000, "EOR",       4 },
+  { 0xfbe08000, 0xf0600000, "ORN",       4 },
+  { 0xfbe08000, 0xf0400000, "ORR",       4 },
+  { 0xfbe08000, 0xf1c00000, "RSB",       4 },
+  { 0xfbe08000, 0xf1600000, "SBC",       4 },
+  { 0xfbe08000, 0xf1a00000, "SUB",       4 },
+  { 0xffff2000, 0xe8bd0000, "POP",       4 },
+  { 0xfbf08000, 0xf2000000, "ADDW",      4 },
+  { 0xfbf08000, 0xf2400000, "MOVW",      4 },
+  { 0xfbf08000, 0xf2c00000, "MOVT",      4 },
+  { 0xfbf08000, 0xf2a00000, "SUBW",      4 },
+  { 0xf800d001, 0xf000c000, "BLX",       4 },
+  { 0xff800b50, 0xef800340, "VQD",       4 },
+  { 0xfffff0c0, 0xfa4ff080, "SXTB",      4 },
+  { 0xfffff0c0, 0xfa2ff080, "SXTB16",    4 },
+  { 0xfffff0c0, 0xfa0ff080, "SXTH",      4 },
+  { 0xfffff0c0, 0xfa5ff080, "UXTB",      4 },
+  { 0xfffff0c0, 0xfa3ff080, "UXTB16",    4 },
+  { 0xfffff0c0, 0xfa1ff080, "UXTH",      4 },
+  { 0xff000010, 0xee000000, "CDP",       4 },
+  { 0xff000010, 0xfe000000, "CDP2",      4 },
+  { 0xffb00300, 0xf9a00000, "VLD1",      4 },
+  { 0xffb00300, 0xf9800000, "VST1",      4 },
+  { 0xfe100000, 0xec100000, "LDC",       4 },
+  { 0xfe100000, 0xfc100000, "LDC2",      4 },
+  { 0xfe100000, 0xec000000, "STC",       4 },
+  { 0xfe100000, 0xfc000000, "STC2",      4 },
+  { 0xffff8020, 0xf36f0000, "BFC",       4 },
+  { 0xffef8030, 0xea4f0020, "ASR",       4 },
+  { 0xffef8030, 0xea4f0000, "LSL",       4 },
+  { 0xffef8030, 0xea4f0010, "LSR",       4 },
+  { 0xffef8030, 0xea4f0030, "ROR",       4 },
+  { 0xffd0ff00, 0xf810fc00, "PLD",       4 },
+  { 0xef870fd0, 0xef800a10, "VMOVL",     4 },
+  { 0xffbf0f00, 0xecbd0b00, "VPOP",      4 },
+  { 0xffbf0f00, 0xecbd0a00, "VPOP",      4 },
+  { 0xffbf0f00, 0xed2d0b00, "VPUSH",     4 },
+  { 0xffbf0f00, 0xed2d0a00, "VPUSH",     4 },
+  { 0xffe08000, 0xeb400000, "ADC",       4 },
+  { 0xffe08000, 0xeb000000, "ADD",       4 },
+  { 0xffe08000, 0xea000000, "AND",       4 },
+  { 0xffe08000, 0xea200000, "BIC",       4 },
+  { 0xffe08000, 0xea800000, "EOR",       4 },
+  { 0xffe08000, 0xea600000, "ORN",       4 },
+  { 0xffe08000, 0xea400000, "ORR",       4 },
+  { 0xffe08000, 0xebc00000, "RSB",       4 },
+  { 0xffe08000, 0xeb600000, "SBC",       4 },
+  { 0xffe08000, 0xeba00000, "SUB",       4 },
+  { 0xfff00800, 0xf8500800, "LDR",       4 },
+  { 0xfff00800, 0xf8100800, "LDRB",      4 },
+  { 0xfff00800, 0xf8300800, "LDRH",      4 },
+  { 0xfff00800, 0xf9100800, "LDRSB",     4 },
+  { 0xfff00800, 0xf9300800, "LDRSH",     4 },
+  { 0xfff00800, 0xf8400800, "STR",       4 },
+  { 0xfff00800, 0xf8000800, "STRB",      4 },
+  { 0xfff00800, 0xf8200800, "STRH",      4 },
+  { 0xffb00c10, 0xffb00800, "V",         4 },
+  { 0xef800d10, 0xef000000, "VH",        4 },
+  { 0xffb80e50, 0xeeb80a40, "VCVT",      4 },
+  { 0xffb30e10, 0xffb30600, "VCVT",      4 },
+  { 0xffb30e10, 0xffb00000, "VREV",      4 },
+  { 0xff7f0000, 0xf85f0000, "LDR",       4 },
+  { 0xff7f0000, 0xf81f0000, "LDRB",      4 },
+  { 0xff7f0000, 0xf83f0000, "LDRH",      4 },
+  { 0xff7f0000, 0xf91f0000, "LDRSB",     4 },
+  { 0xff7f0000, 0xf93f0000, "LDRSH",     4 },
+  { 0xef800f10, 0xef000710, "VABA",      4 },
+  { 0xef800f10, 0xef000700, "VABD",      4 },
+  { 0xef800f10, 0xef000310, "VCGE",      4 },
+  { 0xef800f10, 0xef000300, "VCGT",      4 },
+  { 0xef800f10, 0xef000900, "V",         4 },
+  { 0xef800f10, 0xef000910, "VMUL",      4 },
+  { 0xef800f10, 0xef000010, "VQADD",     4 },
+  { 0xef800f10, 0xef000510, "VQRSHL",    4 },
+  { 0xef800f10, 0xef000410, "VQSHL",     4 },
+  { 0xef800f10, 0xef000210, "VQSUB",     4 },
+  { 0xef800f10, 0xef000100, "VRHADD",    4 },
+  { 0xef800f10, 0xef000500, "VRSHL",     4 },
+  { 0xef800f10, 0xef800210, "VRSHR",     4 },
+  { 0xef800f10, 0xef800310, "VRSRA",     4 },
+  { 0xef800f10, 0xef000400, "VSHL",      4 },
+  { 0xef800f10, 0xef800010, "VSHR",      4 },
+  { 0xef800f10, 0xef800110, "VSRA",      4 },
+  { 0xffb00f10, 0xef000110, "VAND",      4 },
+  { 0xffb00f10, 0xef100110, "VBIC",      4 },
+  { 0xffb00f10, 0xff000110, "VEOR",      4 },
+  { 0xffb00f10, 0xef300110, "VORN",      4 },
+  { 0xffb00f10, 0xef200110, "VORR",      4 },
+  { 0xffff0fff, 0xf85d0b04, "POP",       4 },
+  { 0xffff0fff, 0xf84d0d04, "PUSH",      4 },
+  { 0xffff0fff, 0xeef10a10, "VMRS",      4 },
+  { 0xffff0fff, 0xeee10a10, "VMSR",      4 },
+  { 0xffe00fd0, 0xec400a10, "VMOV",      4 },
+  { 0xffe00fd0, 0xec400b10, "VMOV",      4 },
+  { 0xfff0f0c0, 0xfb10f000, "SMUL",      4 },
+  { 0xfff0f0c0, 0xfa40f080, "SXTAB",     4 },
+  { 0xfff0f0c0, 0xfa20f080, "SXTAB16",   4 },
+  { 0xfff0f0c0, 0xfa00f080, "SXTAH",     4 },
+  { 0xfff0f0c0, 0xfa50f080, "UXTAB",     4 },
+  { 0xfff0f0c0, 0xfa30f080, "UXTAB16",   4 },
+  { 0xfff0f0c0, 0xfa10f080, "UXTAH",     4 },
+  { 0xfff00f00, 0xf8100e00, "LDRBT",     4 },
+  { 0xfff00f00, 0xe8500f00, "LDREX",     4 },
+  { 0xfff00f00, 0xf8300e00, "LDRHT",     4 },
+  { 0xfff00f00, 0xf9100e00, "LDRSBT",    4 },
+  { 0xfff00f00, 0xf9300e00, "LDRSHT",    4 },
+  { 0xfff00f00, 0xf8500e00, "LDRT",      4 },
+  { 0xfff00f00, 0xf8000e00, "STRBT",     4 },
+  { 0xfff00f00, 0xf8200e00, "STRHT",     4 },
+  { 0xfff00f00, 0xf8400e00, "STRT",      4 },
+  { 0xfff00000, 0xf8d00000, "LDR",       4 },
+  { 0xfff00000, 0xf8900000, "LDRB",      4 },
+  { 0xfff00000, 0xf8b00000, "LDRH",      4 },
+  { 0xfff00000, 0xf9900000, "LDRSB",     4 },
+  { 0xfff00000, 0xf9b00000, "LDRSH",     4 },
+  { 0xfff00000, 0xec400000, "MCRR",      4 },
+  { 0xfff00000, 0xfc400000, "MCRR2",     4 },
+  { 0xfff00000, 0xec500000, "MRRC",      4 },
+  { 0xfff00000, 0xfc500000, "MRRC2",     4 },
+  { 0xfff00000, 0xf8c00000, "STR",       4 },
+  { 0xfff00000, 0xf8800000, "STRB",      4 },
+  { 0xfff00000, 0xe8400000, "STREX",     4 },
+  { 0xfff00000, 0xf8a00000, "STRH",      4 },
+  { 0xfff08f00, 0xeb100f00, "CMN",       4 },
+  { 0xfff08f00, 0xebb00f00, "CMP",       4 },
+  { 0xfff08f00, 0xea900f00, "TEQ",       4 },
+  { 0xfff08f00, 0xea100f00, "TST",       4 },
+  { 0xffbf0e7f, 0xeeb50a40, "VCMP",      4 },
+  { 0xfff0ffc0, 0xf910f000, "PLI",       4 },
+  { 0xfe100f00, 0xec100b00, "VLDM",      4 },
+  { 0xfe100f00, 0xec100a00, "VLDM",      4 },
+  { 0xfe100f00, 0xec000b00, "VSTM",      4 },
+  { 0xfe100f00, 0xec000a00, "VSTM",      4 },
+  { 0x0000ffc0, 0x00004140, "ADCS",      2 },
+  { 0x0000ffc0, 0x00004000, "ANDS",      2 },
+  { 0x0000ffc0, 0x00004100, "ASRS",      2 },
+  { 0x0000ffc0, 0x00004380, "BICS",      2 },
+  { 0x0000ffc0, 0x000042c0, "CMN",       2 },
+  { 0x0000ffc0, 0x00004280, "CMP",       2 },
+  { 0x0000ffc0, 0x00004040, "EORS",      2 },
+  { 0x0000ffc0, 0x00004080, "LSLS",      2 },
+  { 0x0000ffc0, 0x000040c0, "LSRS",      2 },
+  { 0x0000ffc0, 0x00000000, "MOVS",      2 },
+  { 0x0000ffc0, 0x00004340, "MULS",      2 },
+  { 0x0000ffc0, 0x000043c0, "MVNS",      2 },
+  { 0x0000ffc0, 0x00004300, "ORRS",      2 },
+  { 0x0000ffc0, 0x0000ba00, "REV",       2 },
+  { 0x0000ffc0, 0x0000ba40, "REV16",     2 },
+  { 0x0000ffc0, 0x0000bac0, "REVSH",     2 },
+  { 0x0000ffc0, 0x000041c0, "RORS",      2 },
+  { 0x0000ffc0, 0x00004240, "RSBS",      2 },
+  { 0x0000ffc0, 0x00004180, "SBCS",      2 },
+  { 0x0000ffc0, 0x0000b240, "SXTB",      2 },
+  { 0x0000ffc0, 0x0000b200, "SXTH",      2 },
+  { 0x0000ffc0, 0x00004200, "TST",       2 },
+  { 0x0000ffc0, 0x0000b2c0, "UXTB",      2 },
+  { 0x0000ffc0, 0x0000b280, "UXTH",      2 },
+  { 0xf800d000, 0xf0008000, "B",         4 },
+  { 0xf800d000, 0xf0009000, "B",         4 },
+  { 0xf800d000, 0xf000d000, "BL",        4 },
+  { 0xef800e90, 0xef800e10, "VCVT",      4 },
+  { 0xffb30f10, 0xffb00600, "VPADAL",    4 },
+  { 0xffb30f10, 0xffb00200, "VPADDL",    4 },
+  { 0xffb30f10, 0xffb20200, "VQMOV",     4 },
+  { 0xffb00ef0, 0xeeb00a00, "VMOV",      4 },
+  { 0xffe0f0f0, 0xfa40f000, "ASR",       4 },
+  { 0xffe0f0f0, 0xfa00f000, "LSL",       4 },
+  { 0xffe0f0f0, 0xfa20f000, "LSR",       4 },
+  { 0xffe0f0f0, 0xfa60f000, "ROR",       4 },
+  { 0xfff00ff0, 0xe8c00f40, "STREXB",    4 },
+  { 0xfff00ff0, 0xe8c00f50, "STREXH",    4 },
+  { 0xefb800b0, 0xef800030, "VBIC",      4 },
+  { 0xefb800b0, 0xef800010, "VORR",      4 },
+  { 0xff100f1f, 0xee100b10, "VMOV",      4 },
+  { 0xfff000c0, 0xfb100000, "SMLA",      4 },
+  { 0xfff000c0, 0xfbc00080, "SMLAL",     4 },
+  { 0xfff08020, 0xf3600000, "BFI",       4 },
+  { 0xfff08020, 0xf3400000, "SBFX",      4 },
+  { 0xfff08020, 0xf3c00000, "UBFX",      4 },
+  { 0xff300f00, 0xed100b00, "VLDR",      4 },
+  { 0xff300f00, 0xed100a00, "VLDR",      4 },
+  { 0xff300f00, 0xed000b00, "VSTR",      4 },
+  { 0xff300f00, 0xed000a00, "VSTR",      4 },
+  { 0xffb00f00, 0xf9a00c00, "VLD1",      4 },
+  { 0xffb30ed0, 0xffb20600, "VCVT",      4 },
+  { 0xffd0ffc0, 0xf810f000, "PLD",       4 },
+  { 0xef800ed0, 0xef800850, "VQRSHR",    4 },
+  { 0xef800ed0, 0xef800810, "VQSHR",     4 },
+  { 0xfff0f0e0, 0xfb50f000, "SMMUL",     4 },
+  { 0xfff0f0e0, 0xfb20f000, "SMUAD",     4 },
+  { 0xfff0f0e0, 0xfb30f000, "SMULW",     4 },
+  { 0xfff0f0e0, 0xfb40f000, "SMUSD",     4 },
+  { 0xffbf0ed0, 0xeeb00ac0, "VABS",      4 },
+  { 0xffbf0ed0, 0xeeb70ac0, "VCVT",      4 },
+  { 0xffbf0ed0, 0xeeb00a40, "VMOV",      4 },
+  { 0xffbf0ed0, 0xeeb10a40, "VNEG",      4 },
+  { 0xffbf0ed0, 0xeeb10ac0, "VSQRT",     4 },
+  { 0xffbe0f50, 0xeeb20a40, "VCVT",      4 },
+  { 0xffd0f000, 0xf890f000, "PLD",       4 },
+  { 0xefb80090, 0xef800010, "VMOV",      4 },
+  { 0xfff0f0f0, 0xfab0f080, "CLZ",       4 },
+  { 0xfff0f0f0, 0xfb00f000, "MUL",       4 },
+  { 0xfff0f0f0, 0xfa80f080, "QADD",      4 },
+  { 0xfff0f0f0, 0xfa90f010, "QADD16",    4 },
+  { 0xfff0f0f0, 0xfa80f010, "QADD8",     4 },
+  { 0xfff0f0f0, 0xfaa0f010, "QASX",      4 },
+  { 0xfff0f0f0, 0xfa80f090, "QDADD",     4 },
+  { 0xfff0f0f0, 0xfa80f0b0, "QDSUB",     4 },
+  { 0xfff0f0f0, 0xfae0f010, "QSAX",      4 },
+  { 0xfff0f0f0, 0xfa80f0a0, "QSUB",      4 },
+  { 0xfff0f0f0, 0xfad0f010, "QSUB16",    4 },
+  { 0xfff0f0f0, 0xfac0f010, "QSUB8",     4 },
+  { 0xfff0f0f0, 0xfa90f0a0, "RBIT",      4 },
+  { 0xfff0f0f0, 0xfa90f080, "REV",       4 },
+  { 0xfff0f0f0, 0xfa90f090, "REV16",     4 },
+  { 0xfff0f0f0, 0xfa90f0b0, "REVSH",     4 },
+  { 0xfff0f0f0, 0xfa90f000, "SADD16",    4 },
+  { 0xfff0f0f0, 0xfa80f000, "SADD8",     4 },
+  { 0xfff0f0f0, 0xfaa0f000, "SASX",      4 },
+  { 0xfff0f0f0, 0xfb90f0f0, "SDIV",      4 },
+  { 0xfff0f0f0, 0xfaa0f080, "SEL",       4 },
+  { 0xfff0f0f0, 0xfa90f020, "SHADD16",   4 },
+  { 0xfff0f0f0, 0xfa80f020, "SHADD8",    4 },
+  { 0xfff0f0f0, 0xfaa0f020, "SHASX",     4 },
+  { 0xfff0f0f0, 0xfae0f020, "SHSAX",     4 },
+  { 0xfff0f0f0, 0xfad0f020, "SHSUB16",   4 },
+  { 0xfff0f0f0, 0xfac0f020, "SHSUB8",    4 },
+  { 0xfff0f0f0, 0xf3200000, "SSAT16",    4 },
+  { 0xfff0f0f0, 0xfae0f000, "SSAX",      4 },
+  { 0xfff0f0f0, 0xfad0f000, "SSUB16",    4 },
+  { 0xfff0f0f0, 0xfac0f000, "SSUB8",     4 },
+  { 0xfff0f0f0, 0xfa90f040, "UADD16",    4 },
+  { 0xfff0f0f0, 0xfa80f040, "UADD8",     4 },
+  { 0xfff0f0f0, 0xfaa0f040, "UASX",      4 },
+  { 0xfff0f0f0, 0xfbb0f0f0, "UDIV",      4 },
+  { 0xfff0f0f0, 0xfa90f060, "UHADD16",   4 },
+  { 0xfff0f0f0, 0xfa80f060, "UHADD8",    4 },
+  { 0xfff0f0f0, 0xfaa0f060, "UHASX",     4 },
+  { 0xfff0f0f0, 0xfae0f060, "UHSAX",     4 },
+  { 0xfff0f0f0, 0xfad0f060, "UHSUB16",   4 },
+  { 0xfff0f0f0, 0xfac0f060, "UHSUB8",    4 },
+  { 0xfff0f0f0, 0xfa90f050, "UQADD16",   4 },
+  { 0xfff0f0f0, 0xfa80f050, "UQADD8",    4 },
+  { 0xfff0f0f0, 0xfaa0f050, "UQASX",     4 },
+  { 0xfff0f0f0, 0xfae0f050, "UQSAX",     4 },
+  { 0xfff0f0f0, 0xfad0f050, "UQSUB16",   4 },
+  { 0xfff0f0f0, 0xfac0f050, "UQSUB8",    4 },
+  { 0xfff0f0f0, 0xfb70f000, "USAD8",     4 },
+  { 0xfff0f0f0, 0xf3a00000, "USAT16",    4 },
+  { 0xfff0f0f0, 0xfae0f040, "USAX",      4 },
+  { 0xfff0f0f0, 0xfad0f040, "USUB16",    4 },
+  { 0xfff0f0f0, 0xfac0f040, "USUB8",     4 },
+  { 0xffe00f7f, 0xee000a10, "VMOV",      4 },
+  { 0xffbf0e50, 0xeeb40a40, "VCMP",      4 },
+  { 0xfffff0ff, 0xf3ef8000, "MRS",       4 },
+  { 0xfbf08f00, 0xf1100f00, "CMN",       4 },
+  { 0xfbf08f00, 0xf1b00f00, "CMP",       4 },
+  { 0xfbf08f00, 0xf0900f00, "TEQ",       4 },
+  { 0xfbf08f00, 0xf0100f00, "TST",       4 },
+  { 0xffd0a000, 0xe8800000, "STM",       4 },
+  { 0xffd0a000, 0xe9000000, "STMDB",     4 },
+  { 0xffffa000, 0xe8ad0000, "PUSH",      4 },
+  { 0xef800b50, 0xef800240, "V",         4 },
+  { 0xffa00f10, 0xff200d00, "VABD",      4 },
+  { 0xffa00f10, 0xef000d00, "VADD",      4 },
+  { 0xffa00f10, 0xef000e00, "VCEQ",      4 },
+  { 0xffa00f10, 0xff000e00, "VCGE",      4 },
+  { 0xffa00f10, 0xff200e00, "VCGT",      4 },
+  { 0xffa00f10, 0xff000d10, "VMUL",      4 },
+  { 0xffa00f10, 0xff000d00, "VPADD",     4 },
+  { 0xffa00f10, 0xef000f10, "VRECPS",    4 },
+  { 0xffa00f10, 0xef200f10, "VRSQRTS",   4 },
+  { 0xffa00f10, 0xef200d00, "VSUB",      4 },
+  { 0xff800d50, 0xef800900, "VQD",       4 },
+  { 0xff900f1f, 0xee000b10, "VMOV",      4 },
+  { 0xffd02000, 0xe8900000, "LDM",       4 },
+  { 0xffd02000, 0xe9100000, "LDMDB",     4 },
+  { 0xfff0f000, 0xf990f000, "PLI",       4 },
+  { 0xffb30fd0, 0xffb20200, "VMOVN",     4 },
+  { 0xffb30fd0, 0xffb20300, "VSHLL",     4 },
+  { 0xfe500000, 0xe8500000, "LDRD",      4 },
+  { 0xfe500000, 0xe8400000, "STRD",      4 },
+  { 0xfff000e0, 0xfb200000, "SMLAD",     4 },
+  { 0xfff000e0, 0xfbc000c0, "SMLALD",    4 },
+  { 0xfff000e0, 0xfb300000, "SMLAW",     4 },
+  { 0xfff000e0, 0xfb400000, "SMLSD",     4 },
+  { 0xfff000e0, 0xfbd000c0, "SMLSLD",    4 },
+  { 0xfff000e0, 0xfb500000, "SMMLA",     4 },
+  { 0xfff000e0, 0xfb600000, "SMMLS",     4 },
+  { 0xfff0f3ff, 0xf3808000, "MSR",       4 },
+  { 0xffef8000, 0xeb0d0000, "ADD",       4 },
+  { 0xffef8000, 0xea6f0000, "MVN",       4 },
+  { 0xffef8000, 0xebad0000, "SUB",       4 },
+  { 0x0000f000, 0x0000d000, "B",         2 },
+  { 0xef800f50, 0xef800500, "VABAL",     4 },
+  { 0xef800f50, 0xef800700, "VABDL",     4 },
+  { 0xef800f50, 0xef800a40, "VMULL",     4 },
+  { 0xef800f50, 0xef800c40, "VQDMULH",   4 },
+  { 0xef800f50, 0xef800d40, "VQRDMULH",  4 },
+  { 0x0000ff00, 0x00004400, "ADD",       2 },
+  { 0x0000ff00, 0x0000be00, "BKPT",      2 },
+  { 0x0000ff00, 0x00004500, "CMP",       2 },
+  { 0x0000ff00, 0x0000bf00, "IT",        2 },
+  { 0x0000ff00, 0x00004600, "MOV",       2 },
+  { 0x0000ff00, 0x0000df00, "SVC",       2 },
+  { 0xff800fd0, 0xef800850, "VRSHRN",    4 },
+  { 0xff800fd0, 0xef800810, "VSHRN",     4 },
+  { 0xffb30e90, 0xffb30400, "VRECPE",    4 },
+  { 0xffb30e90, 0xffb30480, "VRSQRTE",   4 },
+  { 0xff900f5f, 0xee800b10, "VDUP",      4 },
+  { 0xffb30f90, 0xffb00400, "VCLS",      4 },
+  { 0xffb30f90, 0xffb00480, "VCLZ",      4 },
+  { 0xffb30f90, 0xffb00500, "VCNT",      4 },
+  { 0xffb30f90, 0xffb00580, "VMVN",      4 },
+  { 0xffb30f90, 0xffb00700, "VQABS",     4 },
+  { 0xffb30f90, 0xffb00780, "VQNEG",     4 },
+  { 0xffb30f90, 0xffb20000, "VSWP",      4 },
+  { 0xffb30f90, 0xffb20080, "VTRN",      4 },
+  { 0xffb30f90, 0xffb20100, "VUZP",      4 },
+  { 0xffb30f90, 0xffb20180, "VZIP",      4 },
+  { 0xffb00f90, 0xffb00c00, "VDUP",      4 },
+  { 0xef800f00, 0xef000600, "V",         4 },
+  { 0xef800f00, 0xef000a00, "VP",        4 },
+  { 0xff800f50, 0xef800400, "VADDHN",    4 },
+  { 0xff800f50, 0xef800d00, "VQDMULL",   4 },
+  { 0xff800f50, 0xef800b40, "VQDMULL",   4 },
+  { 0xff800f50, 0xff800400, "VRADDHN",   4 },
+  { 0xff800f50, 0xff800600, "VRSUBHN",   4 },
+  { 0xff800f50, 0xef800600, "VSUBHN",    4 },
+  { 0x0000ff78, 0x00004468, "ADD",       2 },
+  { 0xef800e10, 0xef800610, "VQSHL",     4 },
+  { 0xffb00010, 0xefb00000, "VEXT",      4 },
+  { 0x0000ff80, 0x0000b000, "ADD",       2 },
+  { 0x0000ff80, 0x0000b080, "SUB",       2 },
+  { 0xff7ff000, 0xf81ff000, "PLD",       4 },
+  { 0xff7ff000, 0xf91ff000, "PLI",       4 },
+  { 0x0000ff87, 0x00004485, "ADD",       2 },
+  { 0x0000ff87, 0x00004780, "BLX",       2 },
+  { 0x0000ff87, 0x00004700, "BX",        2 },
+  { 0xffb00e50, 0xee300a00, "VADD",      4 },
+  { 0xffb00e50, 0xee800a00, "VDIV",      4 },
+  { 0xffb00e50, 0xee200a00, "VMUL",      4 },
+  { 0xffb00e50, 0xee200a40, "VNMUL",     4 },
+  { 0xffb00e50, 0xee300a40, "VSUB",      4 },
+  { 0xffb30b90, 0xffb10300, "VABS",      4 },
+  { 0xffb30b90, 0xffb10100, "VCEQ",      4 },
+  { 0xffb30b90, 0xffb10080, "VCGE",      4 },
+  { 0xffb30b90, 0xffb10000, "VCGT",      4 },
+  { 0xffb30b90, 0xffb10180, "VCLE",      4 },
+  { 0xffb30b90, 0xffb10200, "VCLT",      4 },
+  { 0xffb30b90, 0xffb10380, "VNEG",      4 },
+  { 0xfe1f0000, 0xec1f0000, "LDC",       4 },
+  { 0xfe1f0000, 0xfc1f0000, "LDC2",      4 },
+  { 0xfff08010, 0xeac00000, "PKHTB",     4 },
+  { 0xfff000f0, 0xfb000000, "MLA",       4 },
+  { 0xfff000f0, 0xfb000010, "MLS",       4 },
+  { 0xfff000f0, 0xfbc00000, "SMLAL",     4 },
+  { 0xfff000f0, 0xfb800000, "SMULL",     4 },
+  { 0xfff000f0, 0xe8c00070, "STREXD",    4 },
+  { 0xfff000f0, 0xfbe00060, "UMAAL",     4 },
+  { 0xfff000f0, 0xfbe00000, "UMLAL",     4 },
+  { 0xfff000f0, 0xfba00000, "UMULL",     4 },
+  { 0xfff000f0, 0xfb700000, "USADA8",    4 },
+  { 0xfbff8000, 0xf20d0000, "ADDW",      4 },
+  { 0xfbff8000, 0xf2af0000, "SUB",       4 },
+  { 0xfbff8000, 0xf20f0000, "ADR",       4 },
+  { 0xfbff8000, 0xf2ad0000, "SUBW",      4 },
+  { 0xffeff0f0, 0xea4f0000, "MOV",       4 },
+  { 0xffeff0f0, 0xea4f0030, "RRX",       4 },
+  { 0x0000f500, 0x0000b100, "CB",        2 },
+  { 0xffb00e10, 0xee000a00, "V",         4 },
+  { 0xffb00e10, 0xee100a00, "VNMLA",     4 },
+  { 0xef800fd0, 0xef800a10, "VSHLL",     4 },
+  { 0xef800a50, 0xef800040, "V",         4 },
+  { 0xfff00fc0, 0xf8500000, "LDR",       4 },
+  { 0xfff00fc0, 0xf8100000, "LDRB",      4 },
+  { 0xfff00fc0, 0xf8300000, "LDRH",      4 },
+  { 0xfff00fc0, 0xf9100000, "LDRSB",     4 },
+  { 0xfff00fc0, 0xf9300000, "LDRSH",     4 },
+  { 0xfff00fc0, 0xf8400000, "STR",       4 },
+  { 0xfff00fc0, 0xf8000000, "STRB",      4 },
+  { 0xfff00fc0, 0xf8200000, "STRH",      4 },
+  { 0xfff0ffff, 0xf3c08f00, "BXJ",       4 },
+  { 0x0000f800, 0x00003000, "ADDS",      2 },
+  { 0x0000f800, 0x0000a800, "ADD",       2 },
+  { 0x0000f800, 0x0000a000, "ADR",       2 },
+  { 0x0000f800, 0x00001000, "ASRS",      2 },
+  { 0x0000f800, 0x0000e000, "B",         2 },
+  { 0x0000f800, 0x00002800, "CMP",       2 },
+  { 0x0000f800, 0x0000c800, "LDM",       2 },
+  { 0x0000f800, 0x00006800, "LDR",       2 },
+  { 0x0000f800, 0x00009800, "LDR",       2 },
+  { 0x0000f800, 0x00004800, "LDR",       2 },
+  { 0x0000f800, 0x00007800, "LDRB",      2 },
+  { 0x0000f800, 0x00008800, "LDRH",      2 },
+  { 0x0000f800, 0x00000000, "LSLS",      2 },
+  { 0x0000f800, 0x00000800, "LSRS",      2 },
+  { 0x0000f800, 0x00002000, "MOVS",      2 },
+  { 0x0000f800, 0x0000c000, "STM",       2 },
+  { 0x0000f800, 0x00006000, "STR",       2 },
+  { 0x0000f800, 0x00009000, "STR",       2 },
+  { 0x0000f800, 0x00007000, "STRB",      2 },
+  { 0x0000f800, 0x00008000, "STRH",      2 },
+  { 0x0000f800, 0x00003800, "SUBS",      2 },
+  { 0xffd08020, 0xf3000000, "SSAT",      4 },
+  { 0xffd08020, 0xf3800000, "USAT",      4 },
+  { 0xef800d50, 0xef800800, "V",         4 },
+  { 0xef800d50, 0xef800c00, "VMULL",     4 },
+  { 0xef800e50, 0xef800000, "VADDL",     4 },
+  { 0xef800e50, 0xef800840, "VMUL",      4 },
+  { 0xef800e50, 0xef800200, "VSUBL",     4 },
+  { 0xff800f10, 0xff000e10, "V",         4 },
+  { 0xff800f10, 0xef000800, "VADD",      4 },
+  { 0xff800f10, 0xff000110, "V",         4 },
+  { 0xff800f10, 0xff000810, "VCEQ",      4 },
+  { 0xff800f10, 0xef000f00, "V",         4 },
+  { 0xff800f10, 0xef000d10, "V",         4 },
+  { 0xff800f10, 0xef000b10, "VPADD",     4 },
+  { 0xff800f10, 0xff000f00, "VP",        4 },
+  { 0xff800f10, 0xef000b00, "VQDMULH",   4 },
+  { 0xff800f10, 0xff000b00, "VQRDMULH",  4 },
+  { 0xff800f10, 0xef800510, "VSHL",      4 },
+  { 0xff800f10, 0xff800510, "VSLI",      4 },
+  { 0xff800f10, 0xff800410, "VSRI",      4 },
+  { 0xff800f10, 0xff000800, "VSUB",      4 },
+  { 0xff800f10, 0xef000810, "VTST",      4 },
+  { 0xfbef8000, 0xf10d0000, "ADD",       4 },
+  { 0xfbef8000, 0xf04f0000, "MOV",       4 },
+  { 0xfbef8000, 0xf06f0000, "MVN",       4 },
+  { 0xfbef8000, 0xf1ad0000, "SUB",       4 },
+  { 0xfe7f0000, 0xe85f0000, "LDRD",      4 },
+  { 0xfff0ffe0, 0xe8d0f000, "TBH",       4 },
+  { 0xffba0e50, 0xeeba0a40, "VCVT",      4 },
+  { 0xff100010, 0xee000010, "MCR",       4 },
+  { 0xff100010, 0xfe000010, "MCR2",      4 },
+  { 0xff100010, 0xee100010, "MRC",       4 },
+  { 0xff100010, 0xfe100010, "MRC2",      4 },
+  { 0xffffffff, 0xf3bf8f2f, "CLREX",     4 },
+  { 0xffffffff, 0xf3af8000, "NOP",       4 },
+  { 0xffffffff, 0xf3af8004, "SEV",       4 },
+  { 0xffffffff, 0xf3af8002, "WFE",       4 },
+  { 0xffffffff, 0xf3af8003, "WFI",       4 },
+  { 0xffffffff, 0xf3af8001, "YIELD",     4 },
+  { 0xfff000ff, 0xe8d0007f, "LDREXD",    4 },
+  { 0xfffffff0, 0xf3af80f0, "DBG",       4 },
+  { 0xfffffff0, 0xf3bf8f50, "DMB",       4 },
+  { 0xfffffff0, 0xf3bf8f40, "DSB",       4 },
+  { 0xfffffff0, 0xf3bf8f60, "ISB",       4 },
+  { 0x0000fe00, 0x00001c00, "ADDS",      2 },
+  { 0x0000fe00, 0x00001800, "ADDS",      2 },
+  { 0x0000fe00, 0x00005800, "LDR",       2 },
+  { 0x0000fe00, 0x00005c00, "LDRB",      2 },
+  { 0x0000fe00, 0x00005a00, "LDRH",      2 },
+  { 0x0000fe00, 0x00005600, "LDRSB",     2 },
+  { 0x0000fe00, 0x00005e00, "LDRSH",     2 },
+  { 0x0000fe00, 0x0000bc00, "POP",       2 },
+  { 0x0000fe00, 0x0000b400, "PUSH",      2 },
+  { 0x0000fe00, 0x00005000, "STR",       2 },
+  { 0x0000fe00, 0x00005400, "STRB",      2 },
+  { 0x0000fe00, 0x00005200, "STRH",      2 },
+  { 0x0000fe00, 0x00001e00, "SUBS",      2 },
+  { 0x0000fe00, 0x00001a00, "SUBS",      2 },
+  { 0x0000fff7, 0x0000b650, "SETEND",    2 },
+  { 0x0000ffff, 0x0000bf00, "NOP",       2 },
+  { 0x0000ffff, 0x0000bf40, "SEV",       2 },
+  { 0x0000ffff, 0x0000bf20, "WFE",       2 },
+  { 0x0000ffff, 0x0000bf30, "WFI",       2 },
+  { 0x0000ffff, 0x0000bf10, "YIELD",     2 },
+  { 0xffb00000, 0xf9200000, "VLD1",      4 },
+  { 0xffb00000, 0xf9000000, "VST1",      4 },
+  { 0xfff0ff00, 0xf910fc00, "PLI",       4 },
+  { 0xfff00fff, 0xe8d00f4f, "LDREXB",    4 },
+  { 0xfff00fff, 0xe8d00f5f, "LDREXH",    4 },
+};
@@ -0,0 +1,157 @@
+#ifndef _MEDUSA_TEST_
+#define _MEDUSA_TEST_
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <medusa/namespace.hpp>
+#include <medusa/types.hpp>
+#include <medusa/architecture.hpp>
+#include <medusa/binary_stream.hpp>
+#include <medusa/configuration.hpp>
+#include <medusa/log.hpp>
+#include <medusa/medusa.hpp>
+#include <medusa/module.hpp>
+
+MEDUSA_NAMESPACE_USE
+
+// Tests are plain executables run by ctest from the output directory, so modules can be loaded
+// like the user interfaces do. A failed check is reported and the test goes on, the process
+// returns EXIT_FAILURE if at least one check failed.
+
+static u32 s_TestFailureNo = 0;
+
+#define MEDUSA_CHECK(Cond)                                                                    \
+  do                                                                                          \
+  {                                                                                           \
+    if (!(Cond))                                                                              \
+    {                                                                                         \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " << #Cond << std::endl;  \
+      ++s_TestFailureNo;                                                                      \
+    }                                                                                         \
+  } while (0)
+
+#define MEDUSA_CHECK_EQUAL(Lhs, Rhs)                                                          \
+  do                                                                                          \
+  {                                                                                           \
+    u64 LhsVal = (Lhs);                                                                       \
+    u64 RhsVal = (Rhs);                                                                       \
+    if (!(LhsVal == RhsVal))                                                                  \
+    {                                                                                         \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " << #Lhs << " == " << #Rhs \
+        << " (" << std::hex << LhsVal << " != " << RhsVal << std::dec << ")" << std::endl;   \
+      ++s_TestFailureNo;                                                                      \
+    }                                                                                         \
+  } while (0)
+
+#define MEDUSA_TEST_RESULT() (s_TestFailureNo == 0 ? EXIT_SUCCESS : EXIT_FAILURE)
+
+inline void TestQuietLog(std::wstring const&)
+{
+}
+
+//! This function loads all modules from the working directory, it must be called once.
+inline void TestLoadModules(BinaryStream const& rBinStrm)
+{
+  Log::SetLog(TestQuietLog);
+  ModuleManager::Instance().LoadModules(L".", rBinStrm);
+}
+
+//! This function returns the architecture named pName configured with its default values.
+inline Architecture::SharedPtr TestGetArchitecture(char const* pName)
+{
+  auto Archs = ModuleManager::Instance().GetArchitectures();
+  for (auto itArch = std::begin(Archs); itArch != std::end(Archs); ++itArch)
+    if ((*itArch)->GetName() == pName)
+    {
+      ConfigurationModel CfgMdl;
+      (*itArch)->FillConfigurationModel(CfgMdl);
+      (*itArch)->UseConfiguration(CfgMdl.GetConfiguration());
+      return *itArch;
+    }
+  std::cerr << "architecture " << pName << " not found" << std::endl;
+  std::exit(EXIT_FAILURE);
+}
+
+inline u8 TestGetMode(Architecture const& rArch, char const* pName)
+{
+  auto Modes = rArch.GetModes();
+  for (auto itMode = std::begin(Modes); itMode != std::end(Modes); ++itMode)
+    if (std::get<0>(*itMode) == std::string(pName))
+      return std::get<1>(*itMode);
+  std::cerr << "mode " << pName << " not found in " << rArch.GetName() << std::endl;
+  std::exit(EXIT_FAILURE);
+}
+
+//! TestDocument analyzes an image mapped at 0x0 by the raw loader, each entry is labelled as code.
+//! It loads the modules and the database module is shared, so a test uses one TestDocument.
+//! The database is created in the working directory and removed on destruction.
+class TestDocument
+{
+public:
+  TestDocument(char const* pArchName, u8 const* pImage, u32 ImageSize, u64 const* pEntries, u32 EntryNo)
+    : m_spBinStrm(std::make_shared<MemoryBinaryStream>(pImage, ImageSize))
+  {
+    TestLoadModules(*m_spBinStrm);
+    auto& rModMgr = ModuleManager::Instance();
+
+    auto Loaders = rModMgr.GetLoaders();
+    for (auto itLdr = std::begin(Loaders); itLdr != std::end(Loaders); ++itLdr)
+      if ((*itLdr)->GetName() == "Raw file")
+        m_spLdr = *itLdr;
+    m_spArch = TestGetArchitecture(pArchName);
+    m_spDb   = rModMgr.GetDatabase("Text");
+    if (m_spLdr == nullptr || m_spDb == nullptr)
+    {
+      std::cerr << "raw loader or text database not found" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    ConfigurationModel CfgMdl;
+    m_spArch->FillConfigurationModel(CfgMdl);
+    m_spLdr->Configure(CfgMdl.GetConfiguration());
+    m_spOs = rModMgr.GetOperatingSystem(m_spLdr, m_spArch);
+
+    m_DbPath = std::string("test_") + m_spArch->GetName() + m_spDb->GetExtension();
+    for (auto& rChr : m_DbPath)
+      if (rChr == ' ')
+        rChr = '_';
+    if (!m_spDb->Create(std::wstring(std::begin(m_DbPath), std::end(m_DbPath)), true))
+    {
+      std::cerr << "unable to create " << m_DbPath << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    for (u32 EntryIdx = 0; EntryIdx < EntryNo; ++EntryIdx)
+    {
+      char EntryName[0x20];
+      std::sprintf(EntryName, "entry_%u", EntryIdx);
+      m_spDb->AddLabel(pEntries[EntryIdx], Label(EntryName, Label::Code | Label::Exported));
+    }
+
+    m_Core.Start(m_spBinStrm, m_spLdr, m_spArch, m_spOs, m_spDb);
+    m_Core.WaitForTasks();
+  }
+
+  ~TestDocument(void)
+  {
+    m_spDb->Close();
+    std::remove(m_DbPath.c_str());
+  }
+
+  Medusa&                    GetCore(void)            { return m_Core;   }
+  Architecture::SharedPtr    GetArchitecture(void)    { return m_spArch; }
+  OperatingSystem::SharedPtr GetOperatingSystem(void) { return m_spOs;   }
+
+private:
+  BinaryStream::SharedPtr    m_spBinStrm;
+  Loader::SharedPtr          m_spLdr;
+  Architecture::SharedPtr    m_spArch;
+  OperatingSystem::SharedPtr m_spOs;
+  Database::SharedPtr        m_spDb;
+  std::string                m_DbPath;
+  Medusa                     m_Core;
+};
+
+#endif // !_MEDUSA_TEST_
@@ -0,0 +1,110 @@
+#include "test.hpp"
+
+#include <medusa/instruction.hpp>
+
+#include <cstring>
+#include <string>
+
+// ARM and Thumb opcodes are dispatched with decision trees generated by yaml2cpp.py, they must
+// select the encoding the former dispatchers selected: the first matching one in arm_dispatch.ipp.
+// 16-bit Thumb encodings are tried before the 32-bit ones, since both are matched on the same
+// 32-bit read and a 16-bit instruction must not be taken for the 32-bit encoding of its halfword.
+
+struct ArmEncoding
+{
+  u32         m_Mask;
+  u32         m_Value;
+  char const* m_pName;
+  u16         m_Length;
+};
+
+#include "arm_dispatch.ipp"
+
+// xorshift32, the sequence must be the same on each run
+static u32 NextRandom(u32& rState)
+{
+  rState ^= rState << 13;
+  rState ^= rState >> 17;
+  rState ^= rState << 5;
+  return rState;
+}
+
+static ArmEncoding const* FindEncoding(ArmEncoding const* pEncodings, size_t EncodingNo, u32 Opcode, bool Thumb)
+{
+  // Thumb does two passes: 16-bit encodings, then 32-bit ones
+  for (int Pass = 0; Pass < (Thumb ? 2 : 1); ++Pass)
+    for (size_t EncIdx = 0; EncIdx < EncodingNo; ++EncIdx)
+    {
+      auto const& rEnc = pEncodings[EncIdx];
+      if (Thumb && (rEnc.m_Length == 2) != (Pass == 0))
+        continue;
+      if ((Opcode & rEnc.m_Mask) == rEnc.m_Value)
+        return &rEnc;
+    }
+  return nullptr;
+}
+
+// Literal loads read their value up to 4 KiB around the instruction
+enum
+{
+  OpcodeOffset = 0x1000,
+  CodeSize     = 0x2010
+};
+
+static void CheckOpcode(Architecture& rArch, u8 Mode, ArmEncoding const* pEncodings, size_t EncodingNo, u32 Opcode, bool Thumb, u32& rMismatchNo)
+{
+  static u8 Code[CodeSize];
+  memcpy(Code + OpcodeOffset, &Opcode, sizeof(Opcode));
+  MemoryBinaryStream BinStrm(Code, sizeof(Code));
+  Instruction Insn;
+  bool Decoded = rArch.Disassemble(BinStrm, OpcodeOffset, Insn, Mode, Architecture::DisasmDecodeOnly);
+
+  auto pEnc = FindEncoding(pEncodings, EncodingNo, Opcode, Thumb);
+  bool Same = pEnc == nullptr
+    ? !Decoded
+    : Decoded && Insn.GetName() != nullptr && std::string(Insn.GetName()) == pEnc->m_pName && Insn.GetLength() == pEnc->m_Length;
+
+  if (!Same)
+  {
+    // Only report the first mismatches
+    if (rMismatchNo++ < 16)
+      std::cerr << (Thumb ? "thumb" : "arm") << ": opcode " << std::hex << Opcode << std::dec
+      << " decoded as " << (Decoded && Insn.GetName() != nullptr ? Insn.GetName() : "nothing")
+      << " instead of " << (pEnc != nullptr ? pEnc->m_pName : "nothing") << std::endl;
+    ++s_TestFailureNo;
+  }
+}
+
+static void TestDispatch(Architecture& rArch, char const* pModeName, ArmEncoding const* pEncodings, size_t EncodingNo, bool Thumb)
+{
+  u8 Mode = TestGetMode(rArch, pModeName);
+  u32 Random = 0x2545f491;
+  u32 MismatchNo = 0;
+
+  // Each encoding with all its free bits cleared, set and random
+  for (size_t EncIdx = 0; EncIdx < EncodingNo; ++EncIdx)
+  {
+    auto const& rEnc = pEncodings[EncIdx];
+    CheckOpcode(rArch, Mode, pEncodings, EncodingNo, rEnc.m_Value, Thumb, MismatchNo);
+    CheckOpcode(rArch, Mode, pEncodings, EncodingNo, rEnc.m_Value | ~rEnc.m_Mask, Thumb, MismatchNo);
+    for (int CurRand = 0; CurRand < 64; ++CurRand)
+      CheckOpcode(rArch, Mode, pEncodings, EncodingNo, rEnc.m_Value | (NextRandom(Random) & ~rEnc.m_Mask), Thumb, MismatchNo);
+  }
+
+  // Random opcodes
+  for (int CurRand = 0; CurRand < 0x40000; ++CurRand)
+    CheckOpcode(rArch, Mode, pEncodings, EncodingNo, NextRandom(Random), Thumb, MismatchNo);
+}
+
+int main(void)
+{
+  u32 Dummy = 0;
+  MemoryBinaryStream BinStrm(&Dummy, sizeof(Dummy));
+  TestLoadModules(BinStrm);
+
+  auto spArch = TestGetArchitecture("ARM");
+  TestDispatch(*spArch, "arm",   s_ArmEncodings,   sizeof(s_ArmEncodings)   / sizeof(*s_ArmEncodings),   false);
+  TestDispatch(*spArch, "thumb", s_ThumbEncodings, sizeof(s_ThumbEncodings) / sizeof(*s_ThumbEncodings), true);
+
+  return MEDUSA_TEST_RESULT();
+}
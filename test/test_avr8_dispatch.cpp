@@ -0,0 +1,171 @@
+#include "test.hpp"
+
+#include <medusa/instruction.hpp>
+
+#include <avr8/avr8_register.hpp>
+
+#include <cstring>
+#include <string>
+
+// AVR8 opcodes are dispatched by m_OpcodeMap, generated by avr8_arch.py, straight to the handler
+// of the instruction. Every 16-bit word must decode as it did with the former nibble dispatchers.
+
+// The 32-bit instructions read their second word from here
+static u8 const s_SecondWord[] = { 0x34, 0x12 };
+
+static bool DecodeWord(Architecture& rArch, u16 Word, Instruction& rInsn)
+{
+  u8 Code[4] = { static_cast<u8>(Word), static_cast<u8>(Word >> 8), s_SecondWord[0], s_SecondWord[1] };
+  MemoryBinaryStream BinStrm(Code, sizeof(Code));
+  return rArch.Disassemble(BinStrm, 0, rInsn, 0, Architecture::DisasmDecodeOnly);
+}
+
+// FNV-1a
+static void HashValue(u64& rHash, u64 Value, u8 Size)
+{
+  for (u8 CurByte = 0; CurByte < Size; ++CurByte)
+  {
+    rHash ^= (Value >> (CurByte * 8)) & 0xff;
+    rHash *= 0x100000001b3ULL;
+  }
+}
+
+struct Avr8Decoding
+{
+  u16         m_Word;
+  char const* m_pName;
+  u16         m_Length;
+  u32         m_FirstType;
+  u64         m_FirstValue;  // register or value, depending on the type
+  u32         m_SecondType;
+  u64         m_SecondValue;
+};
+
+static u64 GetOperandValue(Operand const& rOprd)
+{
+  return rOprd.GetType() & O_REG ? rOprd.GetReg() : rOprd.GetRawValue();
+}
+
+static Avr8Decoding const s_Decodings[] =
+{
+  { 0x0000, "nop",    2, O_NONE,                   0x00, O_NONE,                   0x00 },
+  { 0x0123, "movw",   2, O_REG8,                   0x04, O_REG8,                   0x06 },
+  { 0x02ff, "muls",   2, O_REG8,                   0x1f, O_REG8,                   0x1f },
+  { 0x0377, "mulsu",  2, O_REG8,                   0x17, O_REG8,                   0x17 },
+  { 0x038f, "fmulsu", 2, O_REG8,                   0x10, O_REG8,                   0x17 },
+  { 0x0f12, "add",    2, O_REG8,                   0x11, O_REG8,                   0x12 },
+  { 0x1c01, "adc",    2, O_REG8,                   0x00, O_REG8,                   0x01 },
+  { 0x2fff, "mov",    2, O_REG8,                   0x1f, O_REG8,                   0x1f },
+  { 0x3a5c, "cpi",    2, O_REG8,                   0x15, O_IMM8,                   0xac },
+  { 0x7f0f, "andi",   2, O_REG8,                   0x10, O_IMM8,                   0xff },
+  { 0x8008, "ld",     2, O_REG8,                   0x00, O_MEM8 | O_REG16,         AVR8_RegY },
+  { 0x8310, "st",     2, O_MEM8 | O_REG16,         AVR8_RegZ, O_REG8,              0x11 },
+  { 0x8c0f, "ldd",    2, O_REG8,                   0x00, O_MEM8 | O_REG16 | O_DISP, AVR8_RegY },
+  { 0x8e01, "std",    2, O_MEM8 | O_REG16 | O_DISP, AVR8_RegZ, O_REG8,             0x00 },
+  { 0x9100, "lds",    4, O_REG8,                   0x10, O_MEM8 | O_IMM16,         0x1234 },
+  { 0x900c, "ld",     2, O_REG8,                   0x00, O_MEM8 | O_REG16,         AVR8_RegX },
+  { 0x91f5, "lpm",    2, O_REG8,                   0x1f, O_MEM8 | O_REG16,         AVR8_RegZ_PostInc },
+  { 0x920f, "push",   2, O_REG8,                   0x00, O_NONE,                   0x00 },
+  { 0x9408, "sec",    2, O_NONE,                   0x00, O_NONE,                   0x00 },
+  { 0x94f8, "cli",    2, O_NONE,                   0x00, O_NONE,                   0x00 },
+  { 0x9419, "eijmp",  2, O_NONE,                   0x00, O_NONE,                   0x00 },
+  { 0x9508, "ret",    2, O_NONE,                   0x00, O_NONE,                   0x00 },
+  { 0x9511, "eicall", 2, O_NONE,                   0x00, O_NONE,                   0x00 },
+  { 0x95c8, "lpm",    2, O_NONE,                   0x00, O_NONE,                   0x00 },
+  { 0x95f8, "spm",    2, O_NONE,                   0x00, O_NONE,                   0x00 },
+  { 0x95fa, "dec",    2, O_REG8,                   0x1f, O_NONE,                   0x00 },
+  { 0x9421, "neg",    2, O_REG8,                   0x02, O_NONE,                   0x00 },
+  { 0x940c, "jmp",    4, O_ABS,                    0x2468, O_NONE,                 0x00 },
+  { 0x95ff, "call",   4, O_ABS,                    0x7e2468, O_NONE,               0x00 },
+  { 0x96cf, "adiw",   2, O_REG,                    0x18, O_IMM,                    0x3f },
+  { 0x97f0, "sbiw",   2, O_REG,                    0x1e, O_IMM,                    0x30 },
+  { 0x9aff, "sbi",    2, O_IMM,                    0x1f, O_IMM,                    0x07 },
+  { 0x9fff, "mulu",   2, O_REG8,                   0x1f, O_REG8,                   0x1f },
+  { 0xb7ff, "in",     2, O_REG8,                   0x1f, O_IMM,                    0x3f },
+  { 0xb80f, "out",    2, O_IMM,                    0x0f, O_REG8,                   0x00 },
+  { 0xcfff, "rjmp",   2, O_REL,                    static_cast<u64>(-2), O_NONE,   0x00 },
+  { 0xe5a5, "ldi",    2, O_REG8,                   0x1a, O_IMM,                    0x55 },
+  { 0xf7f9, "brne",   2, O_REL,                    static_cast<u64>(-2), O_NONE,   0x00 },
+  { 0xf011, "breq",   2, O_REL,                    0x04, O_NONE,                   0x00 },
+  { 0xfdf7, "sbrc",   2, O_REG8,                   0x1f, O_IMM,                    0x07 },
+};
+
+// Words which are not decoded
+static u16 const s_InvalidWords[] = { 0x9003, 0x9008, 0x9203, 0x940b, 0x95fb, 0x9404, 0x95b8, 0xa000, 0xafff };
+
+static void TestDecodings(Architecture& rArch)
+{
+  for (size_t DecIdx = 0; DecIdx < sizeof(s_Decodings) / sizeof(*s_Decodings); ++DecIdx)
+  {
+    auto const& rDec = s_Decodings[DecIdx];
+    Instruction Insn;
+    if (!DecodeWord(rArch, rDec.m_Word, Insn))
+    {
+      std::cerr << "word " << std::hex << rDec.m_Word << std::dec << " is not decoded" << std::endl;
+      ++s_TestFailureNo;
+      continue;
+    }
+    MEDUSA_CHECK(Insn.GetName() != nullptr && std::string(Insn.GetName()) == rDec.m_pName);
+    MEDUSA_CHECK_EQUAL(Insn.GetLength(), rDec.m_Length);
+    MEDUSA_CHECK_EQUAL(Insn.FirstOperand().GetType(), rDec.m_FirstType);
+    MEDUSA_CHECK_EQUAL(GetOperandValue(Insn.FirstOperand()), rDec.m_FirstValue);
+    MEDUSA_CHECK_EQUAL(Insn.SecondOperand().GetType(), rDec.m_SecondType);
+    MEDUSA_CHECK_EQUAL(GetOperandValue(Insn.SecondOperand()), rDec.m_SecondValue);
+  }
+
+  for (size_t WordIdx = 0; WordIdx < sizeof(s_InvalidWords) / sizeof(*s_InvalidWords); ++WordIdx)
+  {
+    Instruction Insn;
+    MEDUSA_CHECK(!DecodeWord(rArch, s_InvalidWords[WordIdx], Insn));
+  }
+}
+
+static void TestAllWords(Architecture& rArch)
+{
+  // Hash of the decoding of every word by the former dispatchers
+  static u64 const s_ExpectedHash = 0x040dd87df5e0fc63ULL;
+
+  u64 Hash = 0xcbf29ce484222325ULL;
+  u32 DecodedNo = 0;
+
+  for (u32 Word = 0; Word < 0x10000; ++Word)
+  {
+    Instruction Insn;
+    bool Decoded = DecodeWord(rArch, static_cast<u16>(Word), Insn);
+
+    HashValue(Hash, Word, 2);
+    HashValue(Hash, Decoded, 1);
+    if (!Decoded)
+      continue;
+    ++DecodedNo;
+
+    for (char const* pName = Insn.GetName(); *pName != '\0'; ++pName)
+      HashValue(Hash, *pName, 1);
+    HashValue(Hash, Insn.GetLength(), 2);
+    HashValue(Hash, Insn.GetSubType(), 1);
+    HashValue(Hash, Insn.GetOpcode(), 4);
+    for (u8 OprdIdx = 0; OprdIdx < 2; ++OprdIdx)
+    {
+      auto pOprd = Insn.Operand(OprdIdx);
+      HashValue(Hash, pOprd->GetType(), 4);
+      HashValue(Hash, pOprd->GetReg(), 2);
+      HashValue(Hash, pOprd->GetRawValue(), 8);
+    }
+  }
+
+  MEDUSA_CHECK_EQUAL(DecodedNo, 0x10000 - 4516);
+  MEDUSA_CHECK_EQUAL(Hash, s_ExpectedHash);
+}
+
+int main(void)
+{
+  u32 Dummy = 0;
+  MemoryBinaryStream BinStrm(&Dummy, sizeof(Dummy));
+  TestLoadModules(BinStrm);
+
+  auto spArch = TestGetArchitecture("Atmel AVR 8-bit");
+  TestDecodings(*spArch);
+  TestAllWords(*spArch);
+
+  return MEDUSA_TEST_RESULT();
+}
@@ -0,0 +1,178 @@
+#include "test.hpp"
+
+#include <medusa/context.hpp>
+#include <medusa/emulation.hpp>
+#include <medusa/execution.hpp>
+
+#include <x86/x86_const.hpp>
+
+// The interpreter keeps translated blocks until the memory they were decoded from is written,
+// Execution then decodes the modified code from the emulated memory.
+
+// selfmod: mov ecx, 500 / xor edx, edx
+//   loop:  mov [patch + 1], cl / patch: mov al, 0 / add dl, al / dec ecx / jnz loop / ret
+// caller:  xor eax, eax / call leaf / return: ret
+//   leaf:  inc eax / ret
+static u8 const s_Code[] =
+{
+  0xb9, 0xf4, 0x01, 0x00, 0x00, 0x31, 0xd2, 0x88, 0x0d, 0x0e, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00,
+  0xc2, 0x49, 0x75, 0xf3, 0xc3, 0x31, 0xc0, 0xe8, 0x01, 0x00, 0x00, 0x00, 0xc3, 0x40, 0xc3,
+};
+
+enum
+{
+  StackAddress  = 0x100000,
+  StackSize     = 0x10000,
+  StopAddress   = 0x14, // ret
+  CallerAddress = 0x15,
+  ReturnAddress = 0x1c, // the instruction after the call
+};
+
+// Blocks are dropped when one of their pages is written, blocks of other pages are kept
+static void TestInvalidation(Architecture& rArch)
+{
+  auto pGetEmulator = ModuleManager::Instance().GetEmulator("interpreter");
+  MEDUSA_CHECK(pGetEmulator != nullptr);
+  if (pGetEmulator == nullptr)
+    return;
+
+  auto pCpuInfo = rArch.GetCpuInformation();
+  auto pCpuCtxt = rArch.MakeCpuContext();
+  auto pMemCtxt = rArch.MakeMemoryContext();
+  auto pEmul    = pGetEmulator(pCpuInfo, pCpuCtxt, pMemCtxt);
+  MEDUSA_CHECK(pMemCtxt->AllocateMemory(0x0, 4 * MemoryContext::CodePageSize, nullptr));
+
+  // eax = eax + 1
+  Expression::List Sems;
+  Sems.push_back(new OperationExpression(OperationExpression::OpAff,
+    new IdentifierExpression(X86_Reg_Eax, pCpuInfo),
+    new OperationExpression(OperationExpression::OpAdd,
+    /**/new IdentifierExpression(X86_Reg_Eax, pCpuInfo),
+    /**/new ConstantExpression(32, 1))));
+
+  Address FirstBlk(0x10), CrossBlk(2 * MemoryContext::CodePageSize - 0x4);
+  MEDUSA_CHECK(pEmul->TranslateBlock(FirstBlk, 0x8, Sems));
+  MEDUSA_CHECK(pEmul->TranslateBlock(CrossBlk, 0x8, Sems));
+  MEDUSA_CHECK(pEmul->IsBlockTranslated(FirstBlk));
+  MEDUSA_CHECK(pEmul->IsBlockTranslated(CrossBlk));
+
+  MEDUSA_CHECK(pEmul->ExecuteBlock(FirstBlk));
+  MEDUSA_CHECK(pEmul->ExecuteBlock(CrossBlk));
+  u32 Eax = 0;
+  pCpuCtxt->ReadRegister(X86_Reg_Eax, &Eax, sizeof(Eax));
+  MEDUSA_CHECK_EQUAL(Eax, 2);
+
+  // The fourth page doesn't contain code
+  u32 Value = 0xcafebabe;
+  MEDUSA_CHECK(pMemCtxt->WriteMemory(3 * MemoryContext::CodePageSize, &Value, sizeof(Value)));
+  MEDUSA_CHECK(pEmul->IsBlockTranslated(FirstBlk));
+  MEDUSA_CHECK(pEmul->IsBlockTranslated(CrossBlk));
+
+  // Writing the last page of the block which crosses pages only drops this block
+  MEDUSA_CHECK(pMemCtxt->WriteMemory(2 * MemoryContext::CodePageSize, &Value, sizeof(Value)));
+  MEDUSA_CHECK(pEmul->IsBlockTranslated(FirstBlk));
+  MEDUSA_CHECK(!pEmul->IsBlockTranslated(CrossBlk));
+  MEDUSA_CHECK(!pEmul->ExecuteBlock(CrossBlk));
+
+  // Writing far from the block still drops it, pages are the unit of invalidation
+  MEDUSA_CHECK(pMemCtxt->WriteMemory(MemoryContext::CodePageSize - sizeof(Value), &Value, sizeof(Value)));
+  MEDUSA_CHECK(!pEmul->IsBlockTranslated(FirstBlk));
+
+  // A block translated again is tracked again
+  MEDUSA_CHECK(pEmul->TranslateBlock(FirstBlk, 0x8, Sems));
+  MEDUSA_CHECK(pEmul->IsBlockTranslated(FirstBlk));
+
+  // The block which crosses pages is dropped from both pages, translated again within its first
+  // page it's no longer dropped by writes to the second one
+  Address SecondPageBlk(2 * MemoryContext::CodePageSize + 0x10);
+  MEDUSA_CHECK(pEmul->TranslateBlock(CrossBlk, 0x8, Sems));
+  MEDUSA_CHECK(pMemCtxt->WriteMemory(MemoryContext::CodePageSize, &Value, sizeof(Value)));
+  MEDUSA_CHECK(!pEmul->IsBlockTranslated(CrossBlk));
+  for (u32 TranslationNo = 0; TranslationNo < 4; ++TranslationNo)
+    MEDUSA_CHECK(pEmul->TranslateBlock(CrossBlk, 0x4, Sems));
+  MEDUSA_CHECK(pEmul->TranslateBlock(SecondPageBlk, 0x8, Sems));
+  MEDUSA_CHECK(pMemCtxt->WriteMemory(2 * MemoryContext::CodePageSize, &Value, sizeof(Value)));
+  MEDUSA_CHECK(pEmul->IsBlockTranslated(CrossBlk));
+  MEDUSA_CHECK(!pEmul->IsBlockTranslated(SecondPageBlk));
+  MEDUSA_CHECK(pMemCtxt->WriteMemory(MemoryContext::CodePageSize, &Value, sizeof(Value)));
+  MEDUSA_CHECK(!pEmul->IsBlockTranslated(CrossBlk));
+
+  pEmul->InvalidateBlocks();
+  MEDUSA_CHECK(!pEmul->IsBlockTranslated(FirstBlk));
+
+  for (auto pExpr : Sems)
+    delete pExpr;
+  delete pEmul;
+  delete pMemCtxt;
+  delete pCpuCtxt;
+}
+
+// The loop patches its next instruction, each iteration must add the new immediate
+static void TestSelfModifyingCode(TestDocument& rDoc, u32 TraceMask)
+{
+  auto& rCore = rDoc.GetCore();
+  Execution Exec(&rCore, rDoc.GetArchitecture(), rDoc.GetOperatingSystem());
+  MEDUSA_CHECK(Exec.Initialize(StackAddress, StackSize));
+  MEDUSA_CHECK(Exec.SetEmulator("interpreter"));
+  Exec.SetTrace(TraceMask);
+
+  u32 Edx = 0, Ecx = 0;
+  bool Reached = false;
+  Address StartAddr = rCore.GetDocument().MakeAddress(0x0, 0x0);
+  Address StopAddr  = rCore.GetDocument().MakeAddress(0x0, StopAddress);
+  MEDUSA_CHECK_EQUAL(Exec.ExecuteFromSnapshot(StartAddr, StopAddr, 1, nullptr,
+    [&](u32, bool RunReached, CpuContext* pCpuCtxt, MemoryContext*)
+  {
+    Reached = RunReached;
+    pCpuCtxt->ReadRegister(X86_Reg_Edx, &Edx, sizeof(Edx));
+    pCpuCtxt->ReadRegister(X86_Reg_Ecx, &Ecx, sizeof(Ecx));
+  }), 1);
+
+  // dl = (500 + 499 + ... + 1) & 0xff
+  MEDUSA_CHECK(Reached);
+  MEDUSA_CHECK_EQUAL(Ecx, 0);
+  MEDUSA_CHECK_EQUAL(Edx, (500 * 501 / 2) & 0xff);
+}
+
+// The program pointer is already past the call when its semantic runs, so the call must push
+// it as is and ret must come back to the next instruction
+static void TestCallReturn(TestDocument& rDoc)
+{
+  auto& rCore = rDoc.GetCore();
+  Execution Exec(&rCore, rDoc.GetArchitecture(), rDoc.GetOperatingSystem());
+  MEDUSA_CHECK(Exec.Initialize(StackAddress, StackSize));
+  MEDUSA_CHECK(Exec.SetEmulator("interpreter"));
+
+  u32 Eax = 0, InitEsp = 0, Esp = 0;
+  bool Reached = false;
+  Address StartAddr = rCore.GetDocument().MakeAddress(0x0, CallerAddress);
+  Address StopAddr  = rCore.GetDocument().MakeAddress(0x0, ReturnAddress);
+  MEDUSA_CHECK_EQUAL(Exec.ExecuteFromSnapshot(StartAddr, StopAddr, 1,
+    [&](u32, CpuContext* pCpuCtxt, MemoryContext*)
+  {
+    return pCpuCtxt->ReadRegister(X86_Reg_Esp, &InitEsp, sizeof(InitEsp));
+  },
+    [&](u32, bool RunReached, CpuContext* pCpuCtxt, MemoryContext*)
+  {
+    Reached = RunReached;
+    pCpuCtxt->ReadRegister(X86_Reg_Eax, &Eax, sizeof(Eax));
+    pCpuCtxt->ReadRegister(X86_Reg_Esp, &Esp, sizeof(Esp));
+  }), 1);
+
+  MEDUSA_CHECK(Reached);
+  MEDUSA_CHECK_EQUAL(Eax, 1);
+  MEDUSA_CHECK_EQUAL(Esp, InitEsp);
+}
+
+int main(void)
+{
+  static u64 const s_Entries[] = { 0x0, CallerAddress };
+  TestDocument Doc("Intel x86", s_Code, sizeof(s_Code), s_Entries, 2);
+
+  TestInvalidation(*Doc.GetArchitecture());
+  TestSelfModifyingCode(Doc, Execution::TraceNone);
+  TestSelfModifyingCode(Doc, Execution::TraceInstruction);
+  TestCallReturn(Doc);
+
+  return MEDUSA_TEST_RESULT();
+}
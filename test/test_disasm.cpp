@@ -0,0 +1,294 @@
+#include "test.hpp"
+
+#include <medusa/decoded_instruction.hpp>
+#include <medusa/instruction.hpp>
+
+#include <x86/x86_const.hpp>
+
+#include <algorithm>
+#include <vector>
+
+// Every architecture must decode the same instructions whether it uses Disassemble one
+// instruction at a time or DisassembleRange by batch.
+
+struct Sample
+{
+  char const* m_pArchName;
+  char const* m_pModeName;
+  u8 const*   m_pCode;
+  u32         m_CodeSize;
+  u32         m_PaddingSize; // Trailing bytes which are only read by the previous instruction
+};
+
+// mov ecx, 100000 / xor eax, eax / add eax, ecx / shl edx, 1 / add edx, 3 / dec ecx / jnz $-10 /
+// mov al, [esi] / mov [edi], al / lock inc dword [eax] / rep movsb / mov ax, fs:[0x30] /
+// lea eax, [eax + ecx * 4 + 0x10] / call $+5 / ret
+static u8 const s_X86Code[] =
+{
+  0xb9, 0xa0, 0x86, 0x01, 0x00, 0x31, 0xc0, 0x01, 0xc8, 0xd1, 0xe2, 0x83, 0xc2, 0x03, 0x49, 0x75,
+  0xf4, 0x8a, 0x06, 0x88, 0x07, 0xf0, 0xff, 0x00, 0xf3, 0xa4, 0x66, 0x64, 0xa1, 0x30, 0x00, 0x00,
+  0x00, 0x8d, 0x44, 0x88, 0x10, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+
+// mov r2, #0x18000 / add r0, r0, r2 / ldrb r3, [r0], #1 / strb r3, [r1], #1 / subs r2, r2, #1 /
+// bne $-8 / bl $+8 / push {r4, lr} / bx lr
+static u8 const s_ArmCode[] =
+{
+  0x06, 0x29, 0xa0, 0xe3, 0x02, 0x00, 0x80, 0xe0, 0x01, 0x30, 0xd0, 0xe4, 0x01, 0x30, 0xc1, 0xe4,
+  0x01, 0x20, 0x52, 0xe2, 0xfb, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0xeb, 0x10, 0x40, 0x2d, 0xe9,
+  0x1e, 0xff, 0x2f, 0xe1,
+};
+
+// movs r0, #1 / adds r1, r0, r2 / ldr r3, [r1, #4] / push {r4, lr} / bne $-4 / pop {r4, pc}
+// The Thumb decoder always reads 32 bits, so the last halfword is padding
+static u8 const s_ThumbCode[] =
+{
+  0x01, 0x20, 0x81, 0x18, 0x4b, 0x68, 0x10, 0xb5, 0xfc, 0xd1, 0x10, 0xbd, 0x00, 0xbf,
+};
+
+// ldi r24, 0x20 / add r16, r24 / eor r16, r17 / sbiw r24, 1 / ld r0, X+ / st Z+, r0 / brne $-4 /
+// rcall $+8 / lds r16, 0x100 / ret
+static u8 const s_Avr8Code[] =
+{
+  0x80, 0xe2, 0x08, 0x0f, 0x01, 0x27, 0x01, 0x97, 0x0d, 0x90, 0x01, 0x92, 0xe9, 0xf7, 0x03, 0xd0,
+  0x00, 0x91, 0x00, 0x01, 0x08, 0x95,
+};
+
+// ld a, 0x10 / swap a / ld hl, 0xc000 / ld (hl+), a / jr nz, $-2 / jp 0x150 / call 0x200 / nop / ret
+static u8 const s_GbCode[] =
+{
+  0x3e, 0x10, 0xcb, 0x37, 0x21, 0x00, 0xc0, 0x22, 0x20, 0xfe, 0xc3, 0x50, 0x01, 0xcd, 0x00, 0x02,
+  0x00, 0xc9,
+};
+
+#define SAMPLE(ArchName, ModeName, Code, PaddingSize) { ArchName, ModeName, Code, sizeof(Code), PaddingSize }
+
+static Sample const s_Samples[] =
+{
+  SAMPLE("Intel x86",            "32-bit",  s_X86Code,   0),
+  SAMPLE("ARM",                  "arm",     s_ArmCode,   0),
+  SAMPLE("ARM",                  "thumb",   s_ThumbCode, 2),
+  SAMPLE("Atmel AVR 8-bit",      "avr8",    s_Avr8Code,  0),
+  SAMPLE("Nintendo GameBoy Z80", "gameboy", s_GbCode,    0),
+};
+
+static bool IsSameInstruction(DecodedInstruction const& rLhs, DecodedInstruction const& rRhs)
+{
+  if (rLhs.m_Offset != rRhs.m_Offset
+    || rLhs.m_Opcode       != rRhs.m_Opcode
+    || rLhs.m_Prefix       != rRhs.m_Prefix
+    || rLhs.m_SemId        != rRhs.m_SemId
+    || rLhs.m_TestedFlags  != rRhs.m_TestedFlags
+    || rLhs.m_UpdatedFlags != rRhs.m_UpdatedFlags
+    || rLhs.m_ClearedFlags != rRhs.m_ClearedFlags
+    || rLhs.m_FixedFlags   != rRhs.m_FixedFlags
+    || rLhs.m_Length       != rRhs.m_Length
+    || rLhs.m_SubType      != rRhs.m_SubType
+    || rLhs.m_Mode         != rRhs.m_Mode)
+    return false;
+
+  if ((rLhs.m_pName == nullptr) != (rRhs.m_pName == nullptr))
+    return false;
+  if (rLhs.m_pName != nullptr && std::string(rLhs.m_pName) != rRhs.m_pName)
+    return false;
+
+  for (u8 CurOprd = 0; CurOprd < DecodedInstruction::OperandNo; ++CurOprd)
+  {
+    DecodedOperand const& rLhsOprd = rLhs.m_Oprd[CurOprd];
+    DecodedOperand const& rRhsOprd = rRhs.m_Oprd[CurOprd];
+    if (rLhsOprd.m_Value != rRhsOprd.m_Value
+      || rLhsOprd.m_Type     != rRhsOprd.m_Type
+      || rLhsOprd.m_Reg      != rRhsOprd.m_Reg
+      || rLhsOprd.m_SecReg   != rRhsOprd.m_SecReg
+      || rLhsOprd.m_Seg      != rRhsOprd.m_Seg
+      || rLhsOprd.m_SegValue != rRhsOprd.m_SegValue
+      || rLhsOprd.m_Offset   != rRhsOprd.m_Offset)
+      return false;
+  }
+
+  return true;
+}
+
+static void TestDisassembleRange(Sample const& rSample)
+{
+  auto spArch = TestGetArchitecture(rSample.m_pArchName);
+  u8 Mode = TestGetMode(*spArch, rSample.m_pModeName);
+  MemoryBinaryStream BinStrm(rSample.m_pCode, rSample.m_CodeSize);
+
+  // Reference: one instruction at a time
+  std::vector<DecodedInstruction> RefInsns;
+  TOffset RefOffset = 0;
+  while (RefOffset < rSample.m_CodeSize)
+  {
+    Instruction Insn;
+    if (!spArch->Disassemble(BinStrm, RefOffset, Insn, Mode, Architecture::DisasmDecodeOnly) || Insn.GetLength() == 0)
+      break;
+    RefInsns.push_back(DecodedInstruction(RefOffset, Insn, Mode));
+    RefOffset += Insn.GetLength();
+  }
+
+  // Samples only contain valid instructions
+  MEDUSA_CHECK_EQUAL(RefOffset, rSample.m_CodeSize - rSample.m_PaddingSize);
+  if (RefInsns.empty())
+    return;
+
+  // Small batches check the range is resumed correctly
+  static size_t const BatchSizes[] = { 1, 3, 64 };
+  for (auto BatchSize : BatchSizes)
+  {
+    std::vector<DecodedInstruction> Insns(BatchSize);
+    std::vector<DecodedInstruction> RangeInsns;
+    TOffset Offset = 0;
+    while (Offset < rSample.m_CodeSize)
+    {
+      size_t InsnNo = spArch->DisassembleRange(BinStrm, Offset, static_cast<u32>(rSample.m_CodeSize - Offset), Mode, Insns.data(), Insns.size());
+      if (InsnNo == 0)
+        break;
+      RangeInsns.insert(std::end(RangeInsns), std::begin(Insns), std::begin(Insns) + InsnNo);
+      Offset = Insns[InsnNo - 1].m_Offset + Insns[InsnNo - 1].m_Length;
+    }
+
+    MEDUSA_CHECK_EQUAL(RangeInsns.size(), RefInsns.size());
+    for (size_t InsnIdx = 0; InsnIdx < std::min(RangeInsns.size(), RefInsns.size()); ++InsnIdx)
+      if (!IsSameInstruction(RangeInsns[InsnIdx], RefInsns[InsnIdx]))
+      {
+        std::cerr << rSample.m_pArchName << " (" << rSample.m_pModeName << "): instruction at offset "
+          << RefInsns[InsnIdx].m_Offset << " differs" << std::endl;
+        ++s_TestFailureNo;
+      }
+  }
+
+  // The last instruction must not be decoded if it doesn't fit in the range
+  DecodedInstruction LastInsn;
+  auto const& rRefLastInsn = RefInsns.back();
+  MEDUSA_CHECK_EQUAL(spArch->DisassembleRange(BinStrm, rRefLastInsn.m_Offset, rRefLastInsn.m_Length - 1, Mode, &LastInsn, 1), 0);
+
+  // The record must give back the instruction
+  Instruction Insn;
+  rRefLastInsn.ToInstruction(Insn);
+  MEDUSA_CHECK(IsSameInstruction(DecodedInstruction(rRefLastInsn.m_Offset, Insn, Mode), rRefLastInsn));
+}
+
+// The length decoder must agree with the full decoder on every opcode of every map, with
+// several prefixes and ModR/M bytes. The full decoder doesn't follow the processor on a few
+// encodings, the length decoder gives the processor length for them (see TestX86Exceptions).
+static bool IsX86LengthException(u32 Bit, std::vector<u8> const& rPrefixes, std::vector<u8> const& rMap, u8 Opcode)
+{
+  bool AdSize = std::find(std::begin(rPrefixes), std::end(rPrefixes), 0x67) != std::end(rPrefixes);
+  bool LateRex = rPrefixes.size() >= 2 && (rPrefixes[0] & 0xf0) == 0x40;
+
+  if (rMap.empty())
+  {
+    if (AdSize && Opcode >= 0xa0 && Opcode <= 0xa3)  // moffs size depends on the address size
+      return true;
+    if (Bit == X86_Bit_64 && (Opcode == 0x60 || Opcode == 0x61)) // pusha/popa are invalid
+      return true;
+  }
+  else if (rMap.size() == 1 && Opcode == 0xb9) // ud1 has a ModR/M byte
+    return true;
+
+  return Bit == X86_Bit_64 && LateRex; // REX is ignored if it's not the last prefix
+}
+
+static void UseX86Bit(Architecture& rArch, u32 Bit)
+{
+  ConfigurationModel CfgMdl;
+  rArch.FillConfigurationModel(CfgMdl);
+  auto& rCfg = CfgMdl.GetConfiguration();
+  rCfg.Set("Bit", Bit);
+  rArch.UseConfiguration(rCfg);
+}
+
+static bool GetX86Length(Architecture& rArch, std::vector<u8> const& rCode, u32 Bit, u16& rLength)
+{
+  MemoryBinaryStream BinStrm(rCode.data(), static_cast<u32>(rCode.size()));
+  return rArch.GetInstructionLength(BinStrm, 0, static_cast<u8>(Bit), rLength);
+}
+
+static void TestX86InstructionLength(void)
+{
+  auto spArch = TestGetArchitecture("Intel x86");
+
+  static u32 const Bits[] = { X86_Bit_16, X86_Bit_32, X86_Bit_64 };
+  std::vector<std::vector<u8>> const Prefixes = { {}, { 0x66 }, { 0x67 }, { 0xf2 }, { 0xf3 }, { 0x2e }, { 0x48 }, { 0x66, 0x48 }, { 0x48, 0x66 } };
+  std::vector<std::vector<u8>> const Maps     = { {}, { 0x0f }, { 0x0f, 0x38 }, { 0x0f, 0x3a } };
+  static u8 const ModRms[] = { 0x00, 0x04, 0x05, 0x06, 0x0c, 0x38, 0x44, 0x46, 0x80, 0x84, 0x86, 0xc0, 0xf8 };
+
+  u32 CheckNo = 0;
+  for (auto Bit : Bits)
+  {
+    UseX86Bit(*spArch, Bit);
+
+    for (auto const& rPrefixes : Prefixes)
+      for (auto const& rMap : Maps)
+        for (u32 Opcode = 0; Opcode < 0x100; ++Opcode)
+          for (auto ModRm : ModRms)
+          {
+            if (IsX86LengthException(Bit, rPrefixes, rMap, static_cast<u8>(Opcode)))
+              continue;
+
+            // SIB with a 32-bit displacement, then distinct bytes for displacements and immediates
+            std::vector<u8> Code(rPrefixes);
+            Code.insert(std::end(Code), std::begin(rMap), std::end(rMap));
+            Code.push_back(static_cast<u8>(Opcode));
+            Code.push_back(ModRm);
+            Code.push_back(0x25);
+            for (u8 Byte = 0x11; Byte < 0x21; ++Byte)
+              Code.push_back(Byte);
+
+            MemoryBinaryStream BinStrm(Code.data(), static_cast<u32>(Code.size()));
+            Instruction Insn;
+            if (!spArch->Disassemble(BinStrm, 0, Insn, static_cast<u8>(Bit), Architecture::DisasmDecodeOnly) || Insn.GetLength() == 0)
+              continue;
+
+            u16 Length = 0;
+            ++CheckNo;
+            if (!GetX86Length(*spArch, Code, Bit, Length) || Length != Insn.GetLength())
+            {
+              std::cerr << "x86 " << Bit << "-bit: length of";
+              for (size_t CurByte = 0; CurByte < Code.size() - 16; ++CurByte)
+                std::cerr << " " << std::hex << static_cast<u32>(Code[CurByte]) << std::dec;
+              std::cerr << " is " << Length << " instead of " << Insn.GetLength() << std::endl;
+              ++s_TestFailureNo;
+            }
+          }
+  }
+  MEDUSA_CHECK(CheckNo > 100000);
+
+  // Instructions longer than 15 bytes are invalid, even if they only contain prefixes
+  UseX86Bit(*spArch, X86_Bit_32);
+  u16 Length;
+  std::vector<u8> Code(14, 0x66);
+  Code.push_back(0x90);
+  MEDUSA_CHECK(GetX86Length(*spArch, Code, X86_Bit_32, Length) && Length == 15);
+  Code.insert(std::begin(Code), 0x66);
+  MEDUSA_CHECK(!GetX86Length(*spArch, Code, X86_Bit_32, Length));
+  MEDUSA_CHECK(!GetX86Length(*spArch, std::vector<u8>(64, 0x66), X86_Bit_32, Length));
+
+  // Encodings where the length decoder follows the processor
+  UseX86Bit(*spArch, X86_Bit_64);
+  MEDUSA_CHECK(GetX86Length(*spArch, { 0x48, 0xb8, 1, 2, 3, 4, 5, 6, 7, 8 }, X86_Bit_64, Length) && Length == 10);
+  MEDUSA_CHECK(GetX86Length(*spArch, { 0x48, 0x66, 0xb8, 1, 2, 3, 4, 5, 6, 7, 8 }, X86_Bit_64, Length) && Length == 5);
+  MEDUSA_CHECK(GetX86Length(*spArch, { 0x66, 0x48, 0xb8, 1, 2, 3, 4, 5, 6, 7, 8 }, X86_Bit_64, Length) && Length == 11);
+  MEDUSA_CHECK(GetX86Length(*spArch, { 0x67, 0xa1, 1, 2, 3, 4, 5, 6, 7, 8 }, X86_Bit_64, Length) && Length == 6);
+  MEDUSA_CHECK(!GetX86Length(*spArch, { 0x60 }, X86_Bit_64, Length));
+  UseX86Bit(*spArch, X86_Bit_32);
+  MEDUSA_CHECK(GetX86Length(*spArch, { 0x67, 0xa1, 1, 2, 3, 4 }, X86_Bit_32, Length) && Length == 4);
+  MEDUSA_CHECK(GetX86Length(*spArch, { 0x40 }, X86_Bit_32, Length) && Length == 1);
+  MEDUSA_CHECK(GetX86Length(*spArch, { 0x0f, 0xb9, 0x00 }, X86_Bit_32, Length) && Length == 3);
+
+  UseX86Bit(*spArch, X86_Bit_32);
+}
+
+int main(void)
+{
+  MemoryBinaryStream BinStrm(s_X86Code, sizeof(s_X86Code));
+  TestLoadModules(BinStrm);
+
+  for (auto const& rSample : s_Samples)
+    TestDisassembleRange(rSample);
+
+  TestX86InstructionLength();
+
+  return MEDUSA_TEST_RESULT();
+}
@@ -0,0 +1,180 @@
+#include "test.hpp"
+
+#include <medusa/context.hpp>
+#include <medusa/emulation.hpp>
+
+#include <x86/x86_const.hpp>
+
+// Hooks are called by the compiled bytecode and by the expression visitor of the interpreter,
+// the page filter must only skip addresses which have no hook.
+
+enum : u64
+{
+  DataAddress  = 0x1000,
+  RangeAddress = 0x2000,
+  RangeSize    = 0x100,
+  AliasAddress = DataAddress + 0x1000 * 0x1000, // Same index than DataAddress in the page filter
+  CodeAddress  = 0x4000,
+};
+
+struct HookCounts
+{
+  u32 m_Read, m_Write, m_Execute, m_Range;
+};
+
+static Expression* Id(u32 Reg, CpuInformation const* pCpuInfo)
+{
+  return new IdentifierExpression(Reg, pCpuInfo);
+}
+
+static Expression* Mem(u64 LinearAddress)
+{
+  return new MemoryExpression(32, nullptr, new ConstantExpression(32, LinearAddress));
+}
+
+static Expression* Aff(Expression* pDst, Expression* pSrc)
+{
+  return new OperationExpression(OperationExpression::OpAff, pDst, pSrc);
+}
+
+// Runs the statements either compiled as a whole or one by one through the visitor
+static bool Run(Emulator& rEmul, Expression::List const& rSems, bool Compiled)
+{
+  bool Res = true;
+  if (Compiled)
+    Res = rEmul.Execute(Address(0x0), rSems);
+  else
+    for (auto pExpr : rSems)
+      if (!rEmul.Execute(Address(0x0), *pExpr))
+        Res = false;
+  for (auto pExpr : rSems)
+    delete pExpr;
+  return Res;
+}
+
+static void TestHooks(Architecture& rArch, bool Compiled)
+{
+  auto pGetEmulator = ModuleManager::Instance().GetEmulator("interpreter");
+  MEDUSA_CHECK(pGetEmulator != nullptr);
+  if (pGetEmulator == nullptr)
+    return;
+
+  auto pCpuInfo = rArch.GetCpuInformation();
+  auto pCpuCtxt = rArch.MakeCpuContext();
+  auto pMemCtxt = rArch.MakeMemoryContext();
+  auto pEmul    = pGetEmulator(pCpuInfo, pCpuCtxt, pMemCtxt);
+  MEDUSA_CHECK(pMemCtxt->AllocateMemory(DataAddress, 0x2000, nullptr));
+  MEDUSA_CHECK(pMemCtxt->AllocateMemory(AliasAddress & ~0xfffULL, 0x1000, nullptr));
+
+  HookCounts Counts = {};
+  MEDUSA_CHECK(!pEmul->HasHooks());
+  MEDUSA_CHECK(pEmul->AddHook(Address(DataAddress + 0x10), Emulator::HookOnRead,
+    [&](CpuContext*, MemoryContext*) { ++Counts.m_Read; }));
+  MEDUSA_CHECK(pEmul->AddHook(Address(DataAddress + 0x10), Emulator::HookOnWrite,
+    [&](CpuContext*, MemoryContext*) { ++Counts.m_Write; }));
+  MEDUSA_CHECK(pEmul->AddHook(Address(CodeAddress), Emulator::HookOnExecute,
+    [&](CpuContext*, MemoryContext*) { ++Counts.m_Execute; }));
+  MEDUSA_CHECK(pEmul->AddHook(Address(RangeAddress), RangeSize, Emulator::HookOnRead | Emulator::HookOnWrite,
+    [&](CpuContext*, MemoryContext*) { ++Counts.m_Range; }));
+  MEDUSA_CHECK(pEmul->HasHooks());
+
+  // Invalid hooks are refused
+  MEDUSA_CHECK(!pEmul->AddHook(Address(DataAddress), 0, Emulator::HookOnRead, nullptr));
+  MEDUSA_CHECK(!pEmul->AddHook(Address(DataAddress), Emulator::HookUnknown, nullptr));
+
+  // Each type of access only calls its hook
+  {
+    Expression::List Sems;
+    Sems.push_back(Aff(Mem(DataAddress + 0x10), Id(X86_Reg_Eax, pCpuInfo)));
+    Sems.push_back(Aff(Id(X86_Reg_Ebx, pCpuInfo), Mem(DataAddress + 0x10)));
+    Sems.push_back(Aff(Id(X86_Reg_Ebx, pCpuInfo), Mem(DataAddress + 0x14)));
+    MEDUSA_CHECK(Run(*pEmul, Sems, Compiled));
+  }
+  MEDUSA_CHECK_EQUAL(Counts.m_Read, 1);
+  MEDUSA_CHECK_EQUAL(Counts.m_Write, 1);
+  MEDUSA_CHECK_EQUAL(Counts.m_Range, 0);
+
+  // A page with the same index in the filter doesn't have the hooks
+  {
+    Expression::List Sems;
+    Sems.push_back(Aff(Mem(AliasAddress + 0x10), Id(X86_Reg_Eax, pCpuInfo)));
+    Sems.push_back(Aff(Id(X86_Reg_Ebx, pCpuInfo), Mem(AliasAddress + 0x10)));
+    MEDUSA_CHECK(Run(*pEmul, Sems, Compiled));
+  }
+  MEDUSA_CHECK_EQUAL(Counts.m_Read, 1);
+  MEDUSA_CHECK_EQUAL(Counts.m_Write, 1);
+
+  // Range hooks cover [RangeAddress, RangeAddress + RangeSize)
+  {
+    Expression::List Sems;
+    Sems.push_back(Aff(Mem(RangeAddress), Id(X86_Reg_Eax, pCpuInfo)));
+    Sems.push_back(Aff(Id(X86_Reg_Ebx, pCpuInfo), Mem(RangeAddress + RangeSize - 4)));
+    Sems.push_back(Aff(Id(X86_Reg_Ebx, pCpuInfo), Mem(RangeAddress + RangeSize)));
+    Sems.push_back(Aff(Id(X86_Reg_Ebx, pCpuInfo), Mem(RangeAddress - 4)));
+    MEDUSA_CHECK(Run(*pEmul, Sems, Compiled));
+  }
+  MEDUSA_CHECK_EQUAL(Counts.m_Range, 2);
+
+  // Execute hooks are tested on the program counter after each statement
+  {
+    Expression::List Sems;
+    Sems.push_back(Aff(Id(X86_Reg_Eip, pCpuInfo), new ConstantExpression(32, CodeAddress)));
+    Sems.push_back(Aff(Id(X86_Reg_Eax, pCpuInfo), new ConstantExpression(32, 1)));
+    Sems.push_back(Aff(Id(X86_Reg_Eip, pCpuInfo), new ConstantExpression(32, CodeAddress + 1)));
+    MEDUSA_CHECK(Run(*pEmul, Sems, Compiled));
+  }
+  MEDUSA_CHECK_EQUAL(Counts.m_Execute, 2);
+  MEDUSA_CHECK_EQUAL(Counts.m_Read, 1);
+  MEDUSA_CHECK_EQUAL(Counts.m_Write, 1);
+
+  // Adding a hook of the same type replaces the callback, other types are kept
+  u32 NewReadNo = 0;
+  MEDUSA_CHECK(pEmul->AddHook(Address(DataAddress + 0x10), Emulator::HookOnRead,
+    [&](CpuContext*, MemoryContext*) { ++NewReadNo; }));
+  {
+    Expression::List Sems;
+    Sems.push_back(Aff(Mem(DataAddress + 0x10), Mem(DataAddress + 0x10)));
+    MEDUSA_CHECK(Run(*pEmul, Sems, Compiled));
+  }
+  MEDUSA_CHECK_EQUAL(NewReadNo, 1);
+  MEDUSA_CHECK_EQUAL(Counts.m_Read, 1);
+  MEDUSA_CHECK_EQUAL(Counts.m_Write, 2);
+
+  // Removing hooks removes every type on the address and the ranges starting there
+  MEDUSA_CHECK(pEmul->RemoveHook(Address(DataAddress + 0x10)));
+  MEDUSA_CHECK(!pEmul->RemoveHook(Address(DataAddress + 0x10)));
+  MEDUSA_CHECK(!pEmul->RemoveHook(Address(RangeAddress + 4)));
+  MEDUSA_CHECK(pEmul->RemoveHook(Address(RangeAddress)));
+  {
+    Expression::List Sems;
+    Sems.push_back(Aff(Mem(DataAddress + 0x10), Mem(RangeAddress)));
+    Sems.push_back(Aff(Id(X86_Reg_Eip, pCpuInfo), new ConstantExpression(32, CodeAddress)));
+    MEDUSA_CHECK(Run(*pEmul, Sems, Compiled));
+  }
+  MEDUSA_CHECK_EQUAL(NewReadNo, 1);
+  MEDUSA_CHECK_EQUAL(Counts.m_Write, 2);
+  MEDUSA_CHECK_EQUAL(Counts.m_Range, 2);
+  MEDUSA_CHECK_EQUAL(Counts.m_Execute, 3);
+
+  MEDUSA_CHECK(pEmul->RemoveHook(Address(CodeAddress)));
+  MEDUSA_CHECK(!pEmul->HasHooks());
+
+  delete pEmul;
+  delete pMemCtxt;
+  delete pCpuCtxt;
+}
+
+int main(void)
+{
+  MemoryBinaryStream BinStrm;
+  TestLoadModules(BinStrm);
+  auto spArch = TestGetArchitecture("Intel x86");
+  MEDUSA_CHECK(spArch != nullptr);
+  if (spArch == nullptr)
+    return MEDUSA_TEST_RESULT();
+
+  TestHooks(*spArch, true);
+  TestHooks(*spArch, false);
+
+  return MEDUSA_TEST_RESULT();
+}
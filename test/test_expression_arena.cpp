@@ -0,0 +1,146 @@
+#include "test.hpp"
+
+#include <medusa/expression.hpp>
+#include <medusa/expression_arena.hpp>
+#include <medusa/instruction.hpp>
+
+#include <cstring>
+
+// ExpressionArena hands out aligned memory which is only released by Reset, expressions
+// allocated from it can be mixed with heap ones and deleted as usual.
+
+static u32 s_DestroyedNo = 0;
+
+class CountedExpression : public ConstantExpression
+{
+public:
+  CountedExpression(u64 Value) : ConstantExpression(ConstantExpression::Const32Bit, Value) {}
+  virtual ~CountedExpression(void) { ++s_DestroyedNo; }
+};
+
+static bool IsAligned(void const* pMem)
+{
+  return (reinterpret_cast<size_t>(pMem) & (ExpressionArena::Alignment - 1)) == 0;
+}
+
+static void TestAllocate(void)
+{
+  ExpressionArena Arena(0x40);
+  MEDUSA_CHECK_EQUAL(Arena.GetUsedSize(), 0);
+
+  auto pFirst  = static_cast<u8*>(Arena.Allocate(1));
+  auto pSecond = static_cast<u8*>(Arena.Allocate(3));
+  MEDUSA_CHECK(IsAligned(pFirst));
+  MEDUSA_CHECK(IsAligned(pSecond));
+  MEDUSA_CHECK(pSecond == pFirst + ExpressionArena::Alignment);
+  MEDUSA_CHECK_EQUAL(Arena.GetUsedSize(), 2 * ExpressionArena::Alignment);
+
+  // Larger than a chunk, it gets its own
+  auto pLarge = Arena.Allocate(0x100);
+  MEDUSA_CHECK(IsAligned(pLarge));
+  std::memset(pLarge, 0xcc, 0x100);
+  MEDUSA_CHECK_EQUAL(Arena.GetUsedSize(), 2 * ExpressionArena::Alignment + 0x100);
+
+  // Filling several chunks mustn't overlap previous allocations
+  u8* Allocs[0x20];
+  for (u8 AllocIdx = 0; AllocIdx < 0x20; ++AllocIdx)
+  {
+    Allocs[AllocIdx] = static_cast<u8*>(Arena.Allocate(0x18));
+    std::memset(Allocs[AllocIdx], AllocIdx, 0x18);
+  }
+  for (u8 AllocIdx = 0; AllocIdx < 0x20; ++AllocIdx)
+    MEDUSA_CHECK(Allocs[AllocIdx][0] == AllocIdx && Allocs[AllocIdx][0x17] == AllocIdx);
+  MEDUSA_CHECK(static_cast<u8*>(pLarge)[0xff] == 0xcc);
+
+  Arena.Reset();
+  MEDUSA_CHECK_EQUAL(Arena.GetUsedSize(), 0);
+  MEDUSA_CHECK(IsAligned(Arena.Allocate(8)));
+}
+
+static void TestReset(void)
+{
+  ExpressionArena Arena(0x40);
+
+  // The chunk is kept, so the same memory is handed out again
+  auto pFirst = Arena.Allocate(0x10);
+  Arena.Reset();
+  MEDUSA_CHECK(Arena.Allocate(0x10) == pFirst);
+
+  // An empty arena can be reset
+  ExpressionArena EmptyArena;
+  EmptyArena.Reset();
+  MEDUSA_CHECK_EQUAL(EmptyArena.GetUsedSize(), 0);
+}
+
+static void TestExpressions(void)
+{
+  ExpressionArena Arena;
+  s_DestroyedNo = 0;
+
+  // Arena and heap nodes in the same tree
+  Expression* pLeft  = new (Arena) CountedExpression(1);
+  Expression* pRight = new CountedExpression(2);
+  Expression* pOp    = new (Arena) OperationExpression(OperationExpression::OpAdd, pLeft, pRight);
+  size_t UsedSize = Arena.GetUsedSize();
+  MEDUSA_CHECK(UsedSize != 0);
+
+  auto pClone = pOp->Clone(Arena);
+  MEDUSA_CHECK(pClone->ToString() == pOp->ToString());
+  MEDUSA_CHECK(Arena.GetUsedSize() > UsedSize);
+
+  // The destructors are run, the arena memory is kept until Reset
+  UsedSize = Arena.GetUsedSize();
+  delete pOp;
+  MEDUSA_CHECK_EQUAL(s_DestroyedNo, 2);
+  MEDUSA_CHECK_EQUAL(Arena.GetUsedSize(), UsedSize);
+  delete pClone;
+
+  // A null arena allocates from the heap
+  ExpressionArena* pNoArena = nullptr;
+  Expression* pHeapExpr = new (pNoArena) CountedExpression(3);
+  MEDUSA_CHECK_EQUAL(Arena.GetUsedSize(), UsedSize);
+  delete pHeapExpr;
+  MEDUSA_CHECK_EQUAL(s_DestroyedNo, 3);
+}
+
+// add eax, ecx
+static u8 const s_X86Code[] = { 0x01, 0xc8 };
+
+static void TestInstructionArena(BinaryStream const& rBinStrm)
+{
+  auto spArch = TestGetArchitecture("Intel x86");
+  u8 Mode = TestGetMode(*spArch, "32-bit");
+
+  Instruction Insn;
+  MEDUSA_CHECK(spArch->Disassemble(rBinStrm, 0, Insn, Mode, Architecture::DisasmSemantic));
+  MEDUSA_CHECK(!Insn.GetSemantic().empty());
+  MEDUSA_CHECK(Insn.SemanticArena().GetUsedSize() != 0);
+
+  std::string Semantic;
+  for (auto pExpr : Insn.GetSemantic())
+    Semantic += pExpr->ToString();
+
+  // The semantic is released with the instruction, it can be built again
+  Insn.Reset();
+  MEDUSA_CHECK(Insn.GetSemantic().empty());
+  MEDUSA_CHECK_EQUAL(Insn.SemanticArena().GetUsedSize(), 0);
+
+  MEDUSA_CHECK(spArch->Disassemble(rBinStrm, 0, Insn, Mode, Architecture::DisasmSemantic));
+  std::string NewSemantic;
+  for (auto pExpr : Insn.GetSemantic())
+    NewSemantic += pExpr->ToString();
+  MEDUSA_CHECK(NewSemantic == Semantic);
+}
+
+int main(void)
+{
+  TestAllocate();
+  TestReset();
+  TestExpressions();
+
+  MemoryBinaryStream BinStrm(s_X86Code, sizeof(s_X86Code));
+  TestLoadModules(BinStrm);
+  TestInstructionArena(BinStrm);
+
+  return MEDUSA_TEST_RESULT();
+}
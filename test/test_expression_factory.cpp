@@ -0,0 +1,180 @@
+#include "test.hpp"
+
+#include <medusa/expression.hpp>
+#include <medusa/expression_factory.hpp>
+#include <medusa/instruction.hpp>
+
+#include <x86/x86_const.hpp>
+
+#include <thread>
+#include <vector>
+
+// ExpressionFactory builds structurally equal expressions once, so they can be compared by
+// pointer, and computes their facts once.
+
+static void TestInterning(CpuInformation const* pCpuInfo)
+{
+  ExpressionFactory Factory;
+
+  auto pOne = Factory.MakeConstant(ConstantExpression::Const32Bit, 1);
+  MEDUSA_CHECK(pOne == Factory.MakeConstant(ConstantExpression::Const32Bit, 1));
+  MEDUSA_CHECK(pOne != Factory.MakeConstant(ConstantExpression::Const32Bit, 2));
+  MEDUSA_CHECK(pOne != Factory.MakeConstant(ConstantExpression::Const16Bit, 1));
+  MEDUSA_CHECK(pOne->IsShared());
+
+  // eax = eax + 1
+  auto pEax = Factory.MakeIdentifier(X86_Reg_Eax, pCpuInfo);
+  auto pAdd = Factory.MakeOperation(OperationExpression::OpAdd, pEax, pOne);
+  auto pAff = Factory.MakeOperation(OperationExpression::OpAff, pEax, pAdd);
+  MEDUSA_CHECK(pAff == Factory.MakeOperation(OperationExpression::OpAff, pEax, Factory.MakeOperation(OperationExpression::OpAdd, pEax, pOne)));
+  MEDUSA_CHECK(pAdd != Factory.MakeOperation(OperationExpression::OpSub, pEax, pOne));
+  size_t ExprNo = Factory.GetExpressionCount();
+
+  // Heap trees are interned to the same node, they're left untouched
+  auto pHeapAff = new OperationExpression(OperationExpression::OpAff,
+    new IdentifierExpression(X86_Reg_Eax, pCpuInfo),
+    new OperationExpression(OperationExpression::OpAdd,
+      new IdentifierExpression(X86_Reg_Eax, pCpuInfo),
+      new ConstantExpression(ConstantExpression::Const32Bit, 1)));
+  MEDUSA_CHECK(Factory.Intern(pHeapAff) == pAff);
+  MEDUSA_CHECK(!pHeapAff->IsShared());
+  MEDUSA_CHECK(pHeapAff->ToString() == pAff->ToString());
+  MEDUSA_CHECK_EQUAL(Factory.GetExpressionCount(), ExprNo);
+  delete pHeapAff;
+
+  MEDUSA_CHECK(Factory.Intern(nullptr) == nullptr);
+
+  // Variables are compared by name, memory accesses by dereference
+  MEDUSA_CHECK(Factory.MakeVariable(32, "a") == Factory.MakeVariable(32, "a"));
+  MEDUSA_CHECK(Factory.MakeVariable(32, "a") != Factory.MakeVariable(32, "b"));
+  MEDUSA_CHECK(Factory.MakeMemory(32, nullptr, pEax, true) != Factory.MakeMemory(32, nullptr, pEax, false));
+
+  // Shared expressions are never released
+  Expression::Release(const_cast<Expression*>(pOne));
+  MEDUSA_CHECK(pOne->ToString() == Factory.MakeConstant(ConstantExpression::Const32Bit, 1)->ToString());
+}
+
+static void TestFacts(CpuInformation const* pCpuInfo)
+{
+  ExpressionFactory Factory;
+
+  auto pEax   = Factory.MakeIdentifier(X86_Reg_Eax, pCpuInfo);
+  auto pEsi   = Factory.MakeIdentifier(X86_Reg_Esi, pCpuInfo);
+  auto pMem   = Factory.MakeMemory(32, nullptr, pEsi, true);
+  auto pConst = Factory.MakeConstant(ConstantExpression::Const32Bit, 0);
+
+  // eax = [esi]
+  auto const& rLoadFacts = Factory.GetFacts(Factory.MakeOperation(OperationExpression::OpAff, pEax, pMem));
+  MEDUSA_CHECK(rLoadFacts.ReadsMemory());
+  MEDUSA_CHECK(!rLoadFacts.WritesMemory());
+  MEDUSA_CHECK(rLoadFacts.ReadsRegister(X86_Reg_Esi));
+  MEDUSA_CHECK(!rLoadFacts.ReadsRegister(X86_Reg_Eax));
+  MEDUSA_CHECK(rLoadFacts.WritesRegister(X86_Reg_Eax));
+  MEDUSA_CHECK(!rLoadFacts.WritesRegister(X86_Reg_Esi));
+
+  // [esi] = eax, the address is only read
+  auto const& rStoreFacts = Factory.GetFacts(Factory.MakeOperation(OperationExpression::OpAff, pMem, pEax));
+  MEDUSA_CHECK(rStoreFacts.WritesMemory());
+  MEDUSA_CHECK(!rStoreFacts.ReadsMemory());
+  MEDUSA_CHECK(rStoreFacts.ReadsRegister(X86_Reg_Esi));
+  MEDUSA_CHECK(rStoreFacts.ReadsRegister(X86_Reg_Eax));
+  MEDUSA_CHECK(rStoreFacts.GetWrittenRegisters().empty());
+
+  // if eax == 0 { tmp = esi }
+  auto pCond = Factory.MakeIfCondition(ConditionExpression::CondEq, pEax, pConst,
+    Factory.MakeOperation(OperationExpression::OpAff, Factory.MakeVariable(32, "tmp"), pEsi));
+  auto const& rCondFacts = Factory.GetFacts(pCond);
+  MEDUSA_CHECK(rCondFacts.IsConditional());
+  MEDUSA_CHECK(rCondFacts.WritesVariable());
+  MEDUSA_CHECK(!rCondFacts.ReadsVariable());
+  MEDUSA_CHECK(rCondFacts.ReadsRegister(X86_Reg_Eax));
+  MEDUSA_CHECK(rCondFacts.ReadsRegister(X86_Reg_Esi));
+
+  // A bind merges the facts of its statements
+  std::vector<Expression const*> Stmts;
+  Stmts.push_back(Factory.MakeOperation(OperationExpression::OpAff, pEax, pMem));
+  Stmts.push_back(pCond);
+  auto const& rBindFacts = Factory.GetFacts(Factory.MakeBind(Stmts));
+  MEDUSA_CHECK(rBindFacts.ReadsMemory() && rBindFacts.IsConditional() && rBindFacts.WritesRegister(X86_Reg_Eax));
+}
+
+// push eax / mov eax, [esi]
+static u8 const s_X86Code[] = { 0x50, 0x8b, 0x06 };
+
+static void TestSemantic(BinaryStream const& rBinStrm, Architecture& rArch)
+{
+  ExpressionFactory Factory;
+  u8 Mode = TestGetMode(rArch, "32-bit");
+
+  Instruction Push;
+  MEDUSA_CHECK(rArch.Disassemble(rBinStrm, 0, Push, Mode, Architecture::DisasmSemantic));
+  std::vector<Expression const*> PushSem;
+  Factory.Intern(Push.GetSemantic(), PushSem);
+  MEDUSA_CHECK_EQUAL(PushSem.size(), Push.GetSemantic().size());
+
+  bool WritesEsp = false, WritesMem = false, ReadsEax = false;
+  for (auto pExpr : PushSem)
+  {
+    auto const& rFacts = Factory.GetFacts(pExpr);
+    WritesEsp |= rFacts.WritesRegister(X86_Reg_Esp);
+    WritesMem |= rFacts.WritesMemory();
+    ReadsEax  |= rFacts.ReadsRegister(X86_Reg_Eax);
+  }
+  MEDUSA_CHECK(WritesEsp && WritesMem && ReadsEax);
+
+  // The same semantic built again is interned to the same nodes
+  Instruction OtherPush;
+  MEDUSA_CHECK(rArch.Disassemble(rBinStrm, 0, OtherPush, Mode, Architecture::DisasmSemantic));
+  size_t ExprNo = Factory.GetExpressionCount();
+  std::vector<Expression const*> OtherPushSem;
+  Factory.Intern(OtherPush.GetSemantic(), OtherPushSem);
+  MEDUSA_CHECK(OtherPushSem == PushSem);
+  MEDUSA_CHECK_EQUAL(Factory.GetExpressionCount(), ExprNo);
+
+  Instruction Load;
+  MEDUSA_CHECK(rArch.Disassemble(rBinStrm, 1, Load, Mode, Architecture::DisasmSemantic));
+  std::vector<Expression const*> LoadSem;
+  Factory.Intern(Load.GetSemantic(), LoadSem);
+  bool WritesEspInLoad = false;
+  for (auto pExpr : LoadSem)
+    WritesEspInLoad |= Factory.GetFacts(pExpr).WritesRegister(X86_Reg_Esp);
+  MEDUSA_CHECK(!WritesEspInLoad);
+}
+
+static void TestConcurrentInterning(CpuInformation const* pCpuInfo)
+{
+  enum { ThreadNo = 4, ConstNo = 0x400 };
+  ExpressionFactory Factory;
+  std::vector<Expression const*> Results[ThreadNo];
+
+  std::vector<std::thread> Threads;
+  for (u32 ThreadIdx = 0; ThreadIdx < ThreadNo; ++ThreadIdx)
+    Threads.push_back(std::thread([&, ThreadIdx]()
+  {
+    auto pEax = Factory.MakeIdentifier(X86_Reg_Eax, pCpuInfo);
+    for (u32 ConstIdx = 0; ConstIdx < ConstNo; ++ConstIdx)
+      Results[ThreadIdx].push_back(Factory.MakeOperation(OperationExpression::OpAdd, pEax,
+        Factory.MakeConstant(ConstantExpression::Const32Bit, ConstIdx)));
+  }));
+  for (auto& rThread : Threads)
+    rThread.join();
+
+  for (u32 ThreadIdx = 1; ThreadIdx < ThreadNo; ++ThreadIdx)
+    MEDUSA_CHECK(Results[ThreadIdx] == Results[0]);
+  MEDUSA_CHECK_EQUAL(Factory.GetExpressionCount(), 1 + 2 * ConstNo);
+}
+
+int main(void)
+{
+  MemoryBinaryStream BinStrm(s_X86Code, sizeof(s_X86Code));
+  TestLoadModules(BinStrm);
+  auto spArch = TestGetArchitecture("Intel x86");
+  auto pCpuInfo = spArch->GetCpuInformation();
+
+  TestInterning(pCpuInfo);
+  TestFacts(pCpuInfo);
+  TestSemantic(BinStrm, *spArch);
+  TestConcurrentInterning(pCpuInfo);
+
+  return MEDUSA_TEST_RESULT();
+}
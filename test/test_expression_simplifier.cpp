@@ -0,0 +1,209 @@
+#include "test.hpp"
+
+#include <medusa/context.hpp>
+#include <medusa/expression.hpp>
+#include <medusa/expression_simplifier.hpp>
+
+#include <x86/x86_const.hpp>
+
+#include <vector>
+
+// ExpressionSimplifier folds constants, removes identities and removes register writes which
+// are overwritten in the same block. A write only covers earlier writes of its sub-registers.
+
+static CpuInformation const* s_pCpuInfo;
+
+static Expression* Id(u32 Id)
+{
+  return new IdentifierExpression(Id, s_pCpuInfo);
+}
+
+static Expression* Cst(u64 Value, u32 Bit = ConstantExpression::Const32Bit)
+{
+  return new ConstantExpression(Bit, Value);
+}
+
+static Expression* Op(OperationExpression::Type OpType, Expression* pLeftExpr, Expression* pRightExpr)
+{
+  return new OperationExpression(OpType, pLeftExpr, pRightExpr);
+}
+
+static Expression* Aff(Expression* pDstExpr, Expression* pSrcExpr)
+{
+  return Op(OperationExpression::OpAff, pDstExpr, pSrcExpr);
+}
+
+static std::string ToString(Expression* pExpr)
+{
+  std::string Result = pExpr->ToString();
+  delete pExpr;
+  return Result;
+}
+
+// This function simplifies rStmts as a block and returns the remaining statements
+static std::vector<std::string> Simplify(ExpressionSimplifier const& rSmpl, std::vector<Expression*> const& rStmts)
+{
+  ExpressionArena Arena;
+  Expression::List Stmts;
+  for (auto pStmt : rStmts)
+  {
+    rSmpl.Simplify(pStmt, Stmts, Arena);
+    delete pStmt;
+  }
+  rSmpl.EliminateDeadAssignments(Stmts);
+
+  std::vector<std::string> Result;
+  for (auto pStmt : Stmts)
+  {
+    Result.push_back(pStmt->ToString());
+    Expression::Release(pStmt);
+  }
+  return Result;
+}
+
+static void TestFolding(ExpressionSimplifier const& rSmpl)
+{
+  // eax = 1 + 2
+  auto Stmts = Simplify(rSmpl, { Aff(Id(X86_Reg_Eax), Op(OperationExpression::OpAdd, Cst(1), Cst(2))) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 1);
+  MEDUSA_CHECK(!Stmts.empty() && Stmts[0] == ToString(Aff(Id(X86_Reg_Eax), Cst(3))));
+
+  // eax = (ebx + 0) ^ 0, ecx = ecx * 1
+  Stmts = Simplify(rSmpl, {
+    Aff(Id(X86_Reg_Eax), Op(OperationExpression::OpXor, Op(OperationExpression::OpAdd, Id(X86_Reg_Ebx), Cst(0)), Cst(0))),
+    Aff(Id(X86_Reg_Ecx), Op(OperationExpression::OpMul, Id(X86_Reg_Ecx), Cst(1))) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 1);
+  MEDUSA_CHECK(!Stmts.empty() && Stmts[0] == ToString(Aff(Id(X86_Reg_Eax), Id(X86_Reg_Ebx))));
+
+  // if 1 == 1 { eax = 1 } else { eax = 2 }
+  Stmts = Simplify(rSmpl, { new IfElseConditionExpression(ConditionExpression::CondEq, Cst(1), Cst(1),
+    Aff(Id(X86_Reg_Eax), Cst(1)), Aff(Id(X86_Reg_Eax), Cst(2))) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 1);
+  MEDUSA_CHECK(!Stmts.empty() && Stmts[0] == ToString(Aff(Id(X86_Reg_Eax), Cst(1))));
+
+  // if 1 != 1 { eax = 1 }
+  Stmts = Simplify(rSmpl, { new IfConditionExpression(ConditionExpression::CondNe, Cst(1), Cst(1), Aff(Id(X86_Reg_Eax), Cst(1))) });
+  MEDUSA_CHECK(Stmts.empty());
+
+  // A memory read is kept even if its value is ignored: eax = [esi] & 0
+  Stmts = Simplify(rSmpl, { Aff(Id(X86_Reg_Eax), Op(OperationExpression::OpAnd, new MemoryExpression(32, nullptr, Id(X86_Reg_Esi)), Cst(0))) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 1);
+}
+
+static void TestIdentity(ExpressionSimplifier const& rSmpl)
+{
+  // eax = eax, eax = eax + 0
+  auto Stmts = Simplify(rSmpl, {
+    Aff(Id(X86_Reg_Eax), Id(X86_Reg_Eax)),
+    Aff(Id(X86_Reg_Eax), Op(OperationExpression::OpAdd, Id(X86_Reg_Eax), Cst(0))) });
+  MEDUSA_CHECK(Stmts.empty());
+
+  // ax = eax isn't an identity
+  Stmts = Simplify(rSmpl, { Aff(Id(X86_Reg_Ax), Id(X86_Reg_Eax)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 1);
+}
+
+static void TestDeadAssignments(ExpressionSimplifier const& rSmpl)
+{
+  // eax = 1, eax = 2
+  auto Stmts = Simplify(rSmpl, { Aff(Id(X86_Reg_Eax), Cst(1)), Aff(Id(X86_Reg_Eax), Cst(2)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 1);
+
+  // eax = 1, ebx = eax, eax = 2: the first write is read
+  Stmts = Simplify(rSmpl, { Aff(Id(X86_Reg_Eax), Cst(1)), Aff(Id(X86_Reg_Ebx), Id(X86_Reg_Eax)), Aff(Id(X86_Reg_Eax), Cst(2)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 3);
+
+  // al = 1, eax = 2: eax contains al
+  Stmts = Simplify(rSmpl, { Aff(Id(X86_Reg_Al), Cst(1, 8)), Aff(Id(X86_Reg_Eax), Cst(2)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 1);
+
+  // ah = 1, ax = 2: ax contains ah
+  Stmts = Simplify(rSmpl, { Aff(Id(X86_Reg_Ah), Cst(1, 8)), Aff(Id(X86_Reg_Ax), Cst(2, 16)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 1);
+
+  // eax = 1, al = 2 / ah = 1, al = 2: the first write is partially or not overwritten
+  Stmts = Simplify(rSmpl, { Aff(Id(X86_Reg_Eax), Cst(1)), Aff(Id(X86_Reg_Al), Cst(2, 8)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 2);
+  Stmts = Simplify(rSmpl, { Aff(Id(X86_Reg_Ah), Cst(1, 8)), Aff(Id(X86_Reg_Al), Cst(2, 8)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 2);
+
+  // [esi] = 1 reads esi: esi = 1, [esi] = 1, esi = 2
+  Stmts = Simplify(rSmpl, {
+    Aff(Id(X86_Reg_Esi), Cst(1)),
+    Aff(new MemoryExpression(32, nullptr, Id(X86_Reg_Esi)), Cst(1)),
+    Aff(Id(X86_Reg_Esi), Cst(2)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 3);
+}
+
+static void TestDeadFlags(ExpressionSimplifier const& rSmpl)
+{
+  enum { DirectionFlag = 0x400, CarryFlag = 0x1 };
+
+  // eflags = eflags & ~DF, eflags = eflags | DF
+  auto Stmts = Simplify(rSmpl, {
+    Aff(Id(X86_Reg_Eflags), Op(OperationExpression::OpAnd, Id(X86_Reg_Eflags), Cst(~DirectionFlag & 0xffffffff))),
+    Aff(Id(X86_Reg_Eflags), Op(OperationExpression::OpOr, Id(X86_Reg_Eflags), Cst(DirectionFlag))) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 1);
+
+  // eflags = eflags & ~DF, eflags = eflags | CF: different bits are written
+  Stmts = Simplify(rSmpl, {
+    Aff(Id(X86_Reg_Eflags), Op(OperationExpression::OpAnd, Id(X86_Reg_Eflags), Cst(~DirectionFlag & 0xffffffff))),
+    Aff(Id(X86_Reg_Eflags), Op(OperationExpression::OpOr, Id(X86_Reg_Eflags), Cst(CarryFlag))) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 2);
+
+  // eflags = eflags & ~DF, then the lazy flags are written: they don't hold DF, the earlier
+  // partial write must survive
+  Stmts = Simplify(rSmpl, {
+    Aff(Id(X86_Reg_Eflags), Op(OperationExpression::OpAnd, Id(X86_Reg_Eflags), Cst(~DirectionFlag & 0xffffffff))),
+    Aff(Id(X86_Reg_LazyOp),  Cst(0)),
+    Aff(Id(X86_Reg_LazyDst), Cst(0, 64)),
+    Aff(Id(X86_Reg_LazySrc), Cst(0, 64)),
+    Aff(Id(X86_Reg_LazyRes), Cst(0, 64)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 5);
+  MEDUSA_CHECK(!Stmts.empty() && Stmts[0].find("eflags") != std::string::npos);
+
+  // Lazy flags written twice, the first ones are dead unless the flags are read in between
+  Stmts = Simplify(rSmpl, { Aff(Id(X86_Reg_LazyOp), Cst(1)), Aff(Id(X86_Reg_LazyOp), Cst(2)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 1);
+  Stmts = Simplify(rSmpl, {
+    Aff(Id(X86_Reg_LazyOp), Cst(1)),
+    Aff(Id(X86_Reg_Eax), Id(X86_Reg_Eflags)),
+    Aff(Id(X86_Reg_LazyOp), Cst(2)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 3);
+}
+
+static void TestWithoutContext(void)
+{
+  // Without a context, registers aren't known to be stored together
+  ExpressionSimplifier Smpl(s_pCpuInfo);
+  auto Stmts = Simplify(Smpl, { Aff(Id(X86_Reg_Al), Cst(1, 8)), Aff(Id(X86_Reg_Eax), Cst(2)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 2);
+  Stmts = Simplify(Smpl, { Aff(Id(X86_Reg_Eax), Cst(1)), Aff(Id(X86_Reg_Eax), Cst(2)) });
+  MEDUSA_CHECK_EQUAL(Stmts.size(), 1);
+}
+
+int main(void)
+{
+  static u8 const Dummy[1] = {};
+  MemoryBinaryStream BinStrm(Dummy, sizeof(Dummy));
+  TestLoadModules(BinStrm);
+  auto spArch = TestGetArchitecture("Intel x86");
+  s_pCpuInfo = spArch->GetCpuInformation();
+
+  auto pCpuCtxt = spArch->MakeCpuContext();
+  MEDUSA_CHECK(pCpuCtxt != nullptr);
+  if (pCpuCtxt == nullptr)
+    return MEDUSA_TEST_RESULT();
+
+  ExpressionSimplifier Smpl(s_pCpuInfo);
+  Smpl.UseCpuContext(pCpuCtxt);
+
+  TestFolding(Smpl);
+  TestIdentity(Smpl);
+  TestDeadAssignments(Smpl);
+  TestDeadFlags(Smpl);
+  TestWithoutContext();
+
+  delete pCpuCtxt;
+  return MEDUSA_TEST_RESULT();
+}
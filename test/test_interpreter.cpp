@@ -0,0 +1,241 @@
+#include "test.hpp"
+
+#include <medusa/context.hpp>
+#include <medusa/emulation.hpp>
+#include <medusa/instruction.hpp>
+
+#include <x86/x86_const.hpp>
+
+#include <vector>
+
+// The interpreter compiles semantic lists to bytecode and only uses its expression visitor
+// for single expressions. Both must leave the same registers and memory.
+
+// mov eax, 0x80000001 / mov ebx, 0x7fffffff / add eax, ebx / adc al, bl / sub ecx, edx /
+// sbb ax, cx / imul eax, ecx / shl edx, 3 / sar eax, 4 / shr ebx, 1 / movsx eax, byte [esi] /
+// movzx ecx, word [esi + 2] / mov [edi + 4], eax / push eax / pop ebx / xchg eax, ecx /
+// lea edx, [eax + ecx * 4 + 0x10] / inc dword [edi] / dec cx / and al, 0xf / or eax, 0x100 /
+// xor ebx, ebx / neg eax / not ecx / std / cld / cmp eax, ecx / jnz $+4 / div ecx
+static u8 const s_Code[] =
+{
+  0xb8, 0x01, 0x00, 0x00, 0x80, 0xbb, 0xff, 0xff, 0xff, 0x7f, 0x01, 0xd8, 0x10, 0xd8, 0x29, 0xd1,
+  0x66, 0x19, 0xc8, 0x0f, 0xaf, 0xc1, 0xc1, 0xe2, 0x03, 0xc1, 0xf8, 0x04, 0xd1, 0xeb, 0x0f, 0xbe,
+  0x06, 0x0f, 0xb7, 0x4e, 0x02, 0x89, 0x47, 0x04, 0x50, 0x5b, 0x91, 0x8d, 0x54, 0x88, 0x10, 0xff,
+  0x07, 0x66, 0x49, 0x24, 0x0f, 0x0d, 0x00, 0x01, 0x00, 0x00, 0x31, 0xdb, 0xf7, 0xd8, 0xf7, 0xd1,
+  0xfd, 0xfc, 0x39, 0xc8, 0x75, 0x02, 0xf7, 0xf1,
+};
+
+enum
+{
+  CodeAddress  = 0x1000,
+  DataAddress  = 0x10000,
+  StackAddress = 0x20000,
+  MemorySize   = 0x1000,
+};
+
+// Emul holds an emulator with its own contexts
+struct Emul
+{
+  Emul(Architecture& rArch, TGetEmulator pGetEmulator)
+    : m_pCpuCtxt(rArch.MakeCpuContext()), m_pMemCtxt(rArch.MakeMemoryContext()), m_pEmul(nullptr)
+  {
+    m_pEmul = pGetEmulator(rArch.GetCpuInformation(), m_pCpuCtxt, m_pMemCtxt);
+
+    void* pRawMem;
+    m_pMemCtxt->AllocateMemory(DataAddress, MemorySize, &pRawMem);
+    for (u32 Idx = 0; Idx < MemorySize; ++Idx)
+      static_cast<u8*>(pRawMem)[Idx] = static_cast<u8>(Idx * 7 + 0x81);
+    m_pMemCtxt->AllocateMemory(StackAddress, MemorySize, &pRawMem);
+
+    static struct { u32 m_Reg; u32 m_Val; } const s_InitRegs[] =
+    {
+      { X86_Reg_Eax, 0x01234567 }, { X86_Reg_Ebx, 0x89abcdef }, { X86_Reg_Ecx, 0x00000003 },
+      { X86_Reg_Edx, 0xfffffff0 }, { X86_Reg_Esi, DataAddress }, { X86_Reg_Edi, DataAddress + 0x10 },
+      { X86_Reg_Esp, StackAddress + MemorySize / 2 }, { X86_Reg_Eip, CodeAddress },
+    };
+    for (auto const& rInitReg : s_InitRegs)
+      m_pCpuCtxt->WriteRegister(rInitReg.m_Reg, &rInitReg.m_Val, sizeof(rInitReg.m_Val));
+  }
+
+  ~Emul(void)
+  {
+    delete m_pEmul;
+    delete m_pMemCtxt;
+    delete m_pCpuCtxt;
+  }
+
+  CpuContext*    m_pCpuCtxt;
+  MemoryContext* m_pMemCtxt;
+  Emulator*      m_pEmul;
+};
+
+static void CheckSameState(Architecture& rArch, Emul const& rLhs, Emul const& rRhs, u64 InsnAddr)
+{
+  auto pCpuInfo = rArch.GetCpuInformation();
+  CpuContext::RegisterList Regs;
+  rLhs.m_pCpuCtxt->GetRegisters(Regs);
+  for (auto Reg : Regs)
+  {
+    u32 RegSize = pCpuInfo->GetSizeOfRegisterInBit(Reg) / 8;
+    u64 LhsReg = 0, RhsReg = 0;
+    MEDUSA_CHECK(rLhs.m_pCpuCtxt->ReadRegister(Reg, &LhsReg, RegSize));
+    MEDUSA_CHECK(rRhs.m_pCpuCtxt->ReadRegister(Reg, &RhsReg, RegSize));
+    if (LhsReg != RhsReg)
+      std::cerr << "after instruction at " << std::hex << InsnAddr << ", " << pCpuInfo->ConvertIdentifierToName(Reg) << std::dec << std::endl;
+    MEDUSA_CHECK_EQUAL(LhsReg, RhsReg);
+  }
+
+  u8 LhsMem[MemorySize], RhsMem[MemorySize];
+  for (u64 MemAddr : { DataAddress, StackAddress })
+  {
+    MEDUSA_CHECK(rLhs.m_pMemCtxt->ReadMemory(MemAddr, LhsMem, MemorySize));
+    MEDUSA_CHECK(rRhs.m_pMemCtxt->ReadMemory(MemAddr, RhsMem, MemorySize));
+    MEDUSA_CHECK(memcmp(LhsMem, RhsMem, MemorySize) == 0);
+  }
+}
+
+// This function builds the semantic of the instruction at Offset with the update of the program pointer
+static u32 BuildSemantic(Architecture& rArch, u8 Mode, BinaryStream const& rBinStrm, TOffset Offset, Expression::List& rSems)
+{
+  Instruction Insn;
+  if (!rArch.Disassemble(rBinStrm, Offset, Insn, Mode, Architecture::DisasmSemantic))
+    return 0;
+
+  auto pCpuInfo = rArch.GetCpuInformation();
+  u32 ProgPtr = pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister);
+  u32 ProgPtrSize = pCpuInfo->GetSizeOfRegisterInBit(ProgPtr);
+  rSems.push_back(new OperationExpression(OperationExpression::OpAff,
+    new IdentifierExpression(ProgPtr, pCpuInfo),
+    new OperationExpression(OperationExpression::OpAdd,
+    /**/new IdentifierExpression(ProgPtr, pCpuInfo),
+    /**/new ConstantExpression(ProgPtrSize, Insn.GetLength()))));
+  for (auto pExpr : Insn.GetSemantic())
+    rSems.push_back(pExpr->Clone());
+  return Insn.GetLength();
+}
+
+static void ReleaseSemantic(Expression::List& rSems)
+{
+  for (auto pExpr : rSems)
+    delete pExpr;
+  rSems.clear();
+}
+
+// Each instruction runs alone, the compiled and visited semantic are compared after each one
+static void TestInstructions(Architecture& rArch, u8 Mode, TGetEmulator pGetEmulator, BinaryStream const& rBinStrm)
+{
+  Emul Compiled(rArch, pGetEmulator), Visited(rArch, pGetEmulator);
+
+  TOffset Offset = 0;
+  u32 InsnNo = 0;
+  while (Offset < sizeof(s_Code))
+  {
+    Expression::List Sems;
+    u32 InsnLen = BuildSemantic(rArch, Mode, rBinStrm, Offset, Sems);
+    MEDUSA_CHECK(InsnLen != 0);
+    if (InsnLen == 0)
+      break;
+
+    // Execution starts each instruction from its address, like a jump would do
+    u32 InsnAddr = static_cast<u32>(CodeAddress + Offset);
+    Compiled.m_pCpuCtxt->WriteRegister(X86_Reg_Eip, &InsnAddr, sizeof(InsnAddr));
+    Visited.m_pCpuCtxt->WriteRegister(X86_Reg_Eip, &InsnAddr, sizeof(InsnAddr));
+
+    MEDUSA_CHECK(Compiled.m_pEmul->Execute(Address(InsnAddr), Sems));
+    for (auto pExpr : Sems)
+      MEDUSA_CHECK(Visited.m_pEmul->Execute(Address(InsnAddr), *pExpr));
+    CheckSameState(rArch, Compiled, Visited, InsnAddr);
+
+    ReleaseSemantic(Sems);
+    Offset += InsnLen;
+    ++InsnNo;
+  }
+  MEDUSA_CHECK_EQUAL(InsnNo, 29);
+
+  // Known results: mov eax, 0x80000001 / mov ebx, 0x7fffffff / add eax, ebx
+  Emul Check(rArch, pGetEmulator);
+  Expression::List Sems;
+  Offset = 0;
+  for (u32 Idx = 0; Idx < 3; ++Idx)
+    Offset += BuildSemantic(rArch, Mode, rBinStrm, Offset, Sems);
+  MEDUSA_CHECK(Check.m_pEmul->Execute(Address(CodeAddress), Sems));
+  ReleaseSemantic(Sems);
+  u32 Eax = 0, Eip = 0, Eflags = 0;
+  Check.m_pCpuCtxt->ReadRegister(X86_Reg_Eax, &Eax, sizeof(Eax));
+  Check.m_pCpuCtxt->ReadRegister(X86_Reg_Eip, &Eip, sizeof(Eip));
+  Check.m_pCpuCtxt->ReadRegister(X86_Reg_Eflags, &Eflags, sizeof(Eflags));
+  MEDUSA_CHECK_EQUAL(Eax, 0x0);
+  MEDUSA_CHECK_EQUAL(Eip, CodeAddress + Offset);
+  MEDUSA_CHECK_EQUAL(Eflags & ((1 << X86_CfBit) | (1 << X86_ZfBit) | (1 << X86_SfBit)), (1 << X86_CfBit) | (1 << X86_ZfBit));
+}
+
+// The whole code is compiled as a single block, it must behave like the visitor
+static void TestBlock(Architecture& rArch, u8 Mode, TGetEmulator pGetEmulator, BinaryStream const& rBinStrm)
+{
+  Emul Compiled(rArch, pGetEmulator), Visited(rArch, pGetEmulator), Translated(rArch, pGetEmulator);
+
+  Expression::List Sems;
+  TOffset Offset = 0;
+  while (Offset < sizeof(s_Code))
+  {
+    u32 InsnLen = BuildSemantic(rArch, Mode, rBinStrm, Offset, Sems);
+    if (InsnLen == 0)
+      break;
+    Offset += InsnLen;
+  }
+
+  MEDUSA_CHECK(Compiled.m_pEmul->Execute(Address(CodeAddress), Sems));
+  for (auto pExpr : Sems)
+    MEDUSA_CHECK(Visited.m_pEmul->Execute(Address(CodeAddress), *pExpr));
+  MEDUSA_CHECK(Translated.m_pEmul->TranslateBlock(Address(CodeAddress), sizeof(s_Code), Sems));
+  MEDUSA_CHECK(Translated.m_pEmul->IsBlockTranslated(Address(CodeAddress)));
+  MEDUSA_CHECK(Translated.m_pEmul->ExecuteBlock(Address(CodeAddress)));
+  ReleaseSemantic(Sems);
+
+  CheckSameState(rArch, Compiled, Visited, CodeAddress);
+  CheckSameState(rArch, Compiled, Translated, CodeAddress);
+}
+
+// A failing statement fails the list, the visitor fails the same way
+static void TestFailure(Architecture& rArch, TGetEmulator pGetEmulator)
+{
+  Emul Compiled(rArch, pGetEmulator);
+  auto pCpuInfo = rArch.GetCpuInformation();
+
+  // eax = [0xdead0000]: the memory isn't allocated
+  Expression::List Sems;
+  Sems.push_back(new OperationExpression(OperationExpression::OpAff,
+    new IdentifierExpression(X86_Reg_Eax, pCpuInfo),
+    new MemoryExpression(32, nullptr, new ConstantExpression(32, 0xdead0000))));
+  MEDUSA_CHECK(!Compiled.m_pEmul->Execute(Address(CodeAddress), Sems));
+  MEDUSA_CHECK(!Compiled.m_pEmul->Execute(Address(CodeAddress), *Sems.front()));
+  ReleaseSemantic(Sems);
+
+  // eax = eax / 0
+  Sems.push_back(new OperationExpression(OperationExpression::OpAff,
+    new IdentifierExpression(X86_Reg_Eax, pCpuInfo),
+    new OperationExpression(OperationExpression::OpUDiv,
+    /**/new IdentifierExpression(X86_Reg_Eax, pCpuInfo),
+    /**/new ConstantExpression(32, 0))));
+  MEDUSA_CHECK(!Compiled.m_pEmul->Execute(Address(CodeAddress), Sems));
+  ReleaseSemantic(Sems);
+}
+
+int main(void)
+{
+  MemoryBinaryStream BinStrm(s_Code, sizeof(s_Code));
+  TestLoadModules(BinStrm);
+  auto spArch = TestGetArchitecture("Intel x86");
+  u8 Mode = TestGetMode(*spArch, "32-bit");
+
+  auto pGetEmulator = ModuleManager::Instance().GetEmulator("interpreter");
+  MEDUSA_CHECK(pGetEmulator != nullptr);
+  if (pGetEmulator == nullptr)
+    return MEDUSA_TEST_RESULT();
+
+  TestInstructions(*spArch, Mode, pGetEmulator, BinStrm);
+  TestBlock(*spArch, Mode, pGetEmulator, BinStrm);
+  TestFailure(*spArch, pGetEmulator);
+
+  return MEDUSA_TEST_RESULT();
+}
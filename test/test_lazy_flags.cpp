@@ -0,0 +1,233 @@
+#include "test.hpp"
+
+#include <medusa/context.hpp>
+#include <medusa/emulation.hpp>
+#include <medusa/execution.hpp>
+#include <medusa/instruction.hpp>
+
+#include <x86/x86_const.hpp>
+
+#include <vector>
+
+// x86 arithmetic instructions only record their operands, the cpu context computes the flags
+// when they're read. The computed flags must match the flags defined by the instruction set.
+
+// cld / xor eax, eax / jmp $+2 / ret: xor writes the lazy flags after cld cleared DF in the same block
+static u8 const s_Code[] = { 0xfc, 0x31, 0xc0, 0xeb, 0x00, 0xc3 };
+
+enum
+{
+  StackAddress = 0x100000,
+  StackSize    = 0x10000,
+  StopAddress  = 0x5, // ret
+};
+
+enum
+{
+  CarryFlag     = 1 << X86_CfBit,
+  ParityFlag    = 1 << X86_PfBit,
+  AdjustFlag    = 1 << X86_AfBit,
+  ZeroFlag      = 1 << X86_ZfBit,
+  SignFlag      = 1 << X86_SfBit,
+  InterruptFlag = 1 << X86_IfBit,
+  DirectionFlag = 1 << X86_DfBit,
+  OverflowFlag  = 1 << X86_OfBit,
+  ArithFlags    = CarryFlag | ParityFlag | AdjustFlag | ZeroFlag | SignFlag | OverflowFlag,
+};
+
+// The lazy flags written by xor must not hide the write of DF by cld in the same block
+static void TestClearDirection(TestDocument& rDoc)
+{
+  auto& rCore = rDoc.GetCore();
+  Execution Exec(&rCore, rDoc.GetArchitecture(), rDoc.GetOperatingSystem());
+  MEDUSA_CHECK(Exec.Initialize(StackAddress, StackSize));
+  MEDUSA_CHECK(Exec.SetEmulator("interpreter"));
+
+  u32 Eflags = 0, Eax = 0;
+  bool Reached = false;
+  Address StartAddr = rCore.GetDocument().MakeAddress(0x0, 0x0);
+  Address StopAddr  = rCore.GetDocument().MakeAddress(0x0, StopAddress);
+  MEDUSA_CHECK_EQUAL(Exec.ExecuteFromSnapshot(StartAddr, StopAddr, 1,
+    [](u32, CpuContext* pCpuCtxt, MemoryContext*)
+  {
+    u32 InitFlags = DirectionFlag | CarryFlag, InitEax = 0x1234;
+    return pCpuCtxt->WriteRegister(X86_Reg_Eflags, &InitFlags, sizeof(InitFlags))
+      && pCpuCtxt->WriteRegister(X86_Reg_Eax, &InitEax, sizeof(InitEax));
+  },
+    [&](u32, bool RunReached, CpuContext* pCpuCtxt, MemoryContext*)
+  {
+    Reached = RunReached;
+    pCpuCtxt->ReadRegister(X86_Reg_Eflags, &Eflags, sizeof(Eflags));
+    pCpuCtxt->ReadRegister(X86_Reg_Eax, &Eax, sizeof(Eax));
+  }), 1);
+
+  MEDUSA_CHECK(Reached);
+  MEDUSA_CHECK_EQUAL(Eax, 0);
+  MEDUSA_CHECK_EQUAL(Eflags & (DirectionFlag | ArithFlags), ZeroFlag | ParityFlag);
+}
+
+enum RefOp { RefAdd, RefAdc, RefSub, RefSbb, RefAnd, RefOr, RefXor, RefInc, RefDec };
+
+// This function computes the result and the flags of an instruction the way the manual defines them
+static u64 Reference(RefOp Op, u32 Bit, u64 Dst, u64 Src, bool CarryIn, u32& rFlags)
+{
+  u64 Mask = (1ULL << Bit) - 1, SignBit = 1ULL << (Bit - 1);
+  u64 Carry = CarryIn ? 1 : 0, Res = 0;
+  bool Cf = false, Of = false, Af = false;
+
+  if (Op == RefAdd || Op == RefSub)
+    Carry = 0;
+  if (Op == RefInc || Op == RefDec)
+  {
+    Src   = 1;
+    Carry = 0;
+  }
+
+  switch (Op)
+  {
+  case RefAdd: case RefAdc: case RefInc:
+    Res = Dst + Src + Carry;
+    Cf  = Res > Mask;
+    Of  = (Dst & SignBit) == (Src & SignBit) && (Res & SignBit) != (Dst & SignBit);
+    Af  = ((Dst & 0xf) + (Src & 0xf) + Carry) > 0xf;
+    break;
+
+  case RefSub: case RefSbb: case RefDec:
+    Res = Dst - Src - Carry;
+    Cf  = Dst < Src + Carry;
+    Of  = (Dst & SignBit) != (Src & SignBit) && (Res & SignBit) != (Dst & SignBit);
+    Af  = (Dst & 0xf) < (Src & 0xf) + Carry;
+    break;
+
+  case RefAnd: Res = Dst & Src; break;
+  case RefOr:  Res = Dst | Src; break;
+  case RefXor: Res = Dst ^ Src; break;
+  }
+  Res &= Mask;
+
+  // inc and dec keep the carry flag
+  if (Op == RefInc || Op == RefDec)
+    Cf = CarryIn;
+
+  u32 SetBits = 0;
+  for (u32 Idx = 0; Idx < 8; ++Idx)
+    SetBits += (Res >> Idx) & 1;
+
+  rFlags = 0;
+  if (Cf)               rFlags |= CarryFlag;
+  if (!(SetBits & 1))   rFlags |= ParityFlag;
+  if (Af)               rFlags |= AdjustFlag;
+  if (Res == 0)         rFlags |= ZeroFlag;
+  if (Res & SignBit)    rFlags |= SignFlag;
+  if (Of)               rFlags |= OverflowFlag;
+  return Res;
+}
+
+struct LazyInstruction
+{
+  char const* m_pName;
+  RefOp       m_Op;
+  u32         m_Bit;
+  u8          m_Code[3];
+  u8          m_Size;
+};
+
+// Operations apply to al/ax/eax and bl/bx/ebx, inc and dec are tested in their short and modrm forms
+static LazyInstruction const s_Insns[] =
+{
+  { "add al, bl",   RefAdd,  8, { 0x00, 0xd8 }, 2 }, { "add ax, bx",  RefAdd, 16, { 0x66, 0x01, 0xd8 }, 3 }, { "add eax, ebx", RefAdd, 32, { 0x01, 0xd8 }, 2 },
+  { "adc al, bl",   RefAdc,  8, { 0x10, 0xd8 }, 2 }, { "adc ax, bx",  RefAdc, 16, { 0x66, 0x11, 0xd8 }, 3 }, { "adc eax, ebx", RefAdc, 32, { 0x11, 0xd8 }, 2 },
+  { "sub al, bl",   RefSub,  8, { 0x28, 0xd8 }, 2 }, { "sub ax, bx",  RefSub, 16, { 0x66, 0x29, 0xd8 }, 3 }, { "sub eax, ebx", RefSub, 32, { 0x29, 0xd8 }, 2 },
+  { "sbb al, bl",   RefSbb,  8, { 0x18, 0xd8 }, 2 }, { "sbb ax, bx",  RefSbb, 16, { 0x66, 0x19, 0xd8 }, 3 }, { "sbb eax, ebx", RefSbb, 32, { 0x19, 0xd8 }, 2 },
+  { "and al, bl",   RefAnd,  8, { 0x20, 0xd8 }, 2 }, { "and ax, bx",  RefAnd, 16, { 0x66, 0x21, 0xd8 }, 3 }, { "and eax, ebx", RefAnd, 32, { 0x21, 0xd8 }, 2 },
+  { "or al, bl",    RefOr,   8, { 0x08, 0xd8 }, 2 }, { "or ax, bx",   RefOr,  16, { 0x66, 0x09, 0xd8 }, 3 }, { "or eax, ebx",  RefOr,  32, { 0x09, 0xd8 }, 2 },
+  { "xor al, bl",   RefXor,  8, { 0x30, 0xd8 }, 2 }, { "xor ax, bx",  RefXor, 16, { 0x66, 0x31, 0xd8 }, 3 }, { "xor eax, ebx", RefXor, 32, { 0x31, 0xd8 }, 2 },
+  { "inc al",       RefInc,  8, { 0xfe, 0xc0 }, 2 }, { "inc ax",      RefInc, 16, { 0x66, 0x40 }, 2 },       { "inc eax",      RefInc, 32, { 0x40 }, 1 },
+  { "dec al",       RefDec,  8, { 0xfe, 0xc8 }, 2 }, { "dec ax",      RefDec, 16, { 0x66, 0x48 }, 2 },       { "dec eax",      RefDec, 32, { 0x48 }, 1 },
+  { "inc ax (ff)",  RefInc, 16, { 0x66, 0xff, 0xc0 }, 3 }, { "inc eax (ff)", RefInc, 32, { 0xff, 0xc0 }, 2 },
+  { "dec ax (ff)",  RefDec, 16, { 0x66, 0xff, 0xc8 }, 3 }, { "dec eax (ff)", RefDec, 32, { 0xff, 0xc8 }, 2 },
+};
+
+static u32 const s_Values[] =
+{
+  0x00000000, 0x00000001, 0x0000000f, 0x00000010, 0x0000007f, 0x00000080, 0x000000ff, 0x00007fff,
+  0x00008000, 0x0000ffff, 0x7fffffff, 0x80000000, 0xffffffff, 0x12345678, 0xfedcba98, 0x0001ff01,
+};
+
+static void TestInstruction(Architecture& rArch, u8 Mode, TGetEmulator pGetEmulator, LazyInstruction const& rInsn)
+{
+  MemoryBinaryStream CodeStrm(rInsn.m_Code, rInsn.m_Size);
+  Instruction Insn;
+  MEDUSA_CHECK(rArch.Disassemble(CodeStrm, 0, Insn, Mode, Architecture::DisasmSemantic));
+  MEDUSA_CHECK_EQUAL(Insn.GetLength(), rInsn.m_Size);
+
+  auto pCpuInfo = rArch.GetCpuInformation();
+  auto pCpuCtxt = rArch.MakeCpuContext();
+  auto pMemCtxt = rArch.MakeMemoryContext();
+  auto pEmul    = pGetEmulator(pCpuInfo, pCpuCtxt, pMemCtxt);
+
+  Expression::List Sems;
+  for (auto pExpr : Insn.GetSemantic())
+    Sems.push_back(pExpr->Clone());
+
+  // AF is undefined after a logic operation
+  u32 CheckedFlags = ArithFlags;
+  if (rInsn.m_Op == RefAnd || rInsn.m_Op == RefOr || rInsn.m_Op == RefXor)
+    CheckedFlags &= ~AdjustFlag;
+
+  u64 Mask = (1ULL << rInsn.m_Bit) - 1;
+  u32 ErrorNo = 0;
+  for (u32 Dst : s_Values)
+    for (u32 Src : s_Values)
+      for (bool CarryIn : { false, true })
+      {
+        // Upper bits of the registers and flags which aren't computed must be kept
+        u32 Eax = Dst, Ebx = Src ^ 0x5a000000;
+        u32 InitFlags = (CarryIn ? CarryFlag : 0) | DirectionFlag | InterruptFlag;
+        pCpuCtxt->WriteRegister(X86_Reg_Eax, &Eax, sizeof(Eax));
+        pCpuCtxt->WriteRegister(X86_Reg_Ebx, &Ebx, sizeof(Ebx));
+        pCpuCtxt->WriteRegister(X86_Reg_Eflags, &InitFlags, sizeof(InitFlags));
+
+        MEDUSA_CHECK(pEmul->Execute(Address(0x0), Sems));
+
+        u32 ResEax = 0, ResFlags = 0, RefFlags = 0;
+        pCpuCtxt->ReadRegister(X86_Reg_Eax, &ResEax, sizeof(ResEax));
+        pCpuCtxt->ReadRegister(X86_Reg_Eflags, &ResFlags, sizeof(ResFlags));
+        u64 RefRes = Reference(rInsn.m_Op, rInsn.m_Bit, Dst & Mask, Ebx & Mask, CarryIn, RefFlags);
+        u32 RefEax = static_cast<u32>((Eax & ~Mask) | RefRes);
+
+        bool Same = ResEax == RefEax
+          && (ResFlags & CheckedFlags) == (RefFlags & CheckedFlags)
+          && (ResFlags & ~ArithFlags) == (InitFlags & ~ArithFlags);
+        if (!Same && ErrorNo++ < 4)
+          std::cerr << rInsn.m_pName << std::hex << " with " << Dst << ", " << Ebx << ", cf " << CarryIn
+          << ": eax " << ResEax << " flags " << ResFlags << ", expected eax " << RefEax << " flags " << RefFlags << std::dec << std::endl;
+        MEDUSA_CHECK(Same);
+      }
+
+  for (auto pExpr : Sems)
+    delete pExpr;
+  delete pEmul;
+  delete pMemCtxt;
+  delete pCpuCtxt;
+}
+
+int main(void)
+{
+  static u64 const s_Entries[] = { 0x0 };
+  TestDocument Doc("Intel x86", s_Code, sizeof(s_Code), s_Entries, 1);
+
+  TestClearDirection(Doc);
+
+  auto pGetEmulator = ModuleManager::Instance().GetEmulator("interpreter");
+  MEDUSA_CHECK(pGetEmulator != nullptr);
+  if (pGetEmulator == nullptr)
+    return MEDUSA_TEST_RESULT();
+
+  auto& rArch = *Doc.GetArchitecture();
+  u8 Mode = TestGetMode(rArch, "32-bit");
+  for (auto const& rInsn : s_Insns)
+    TestInstruction(rArch, Mode, pGetEmulator, rInsn);
+
+  return MEDUSA_TEST_RESULT();
+}
@@ -0,0 +1,258 @@
+#include "test.hpp"
+
+#include <medusa/context.hpp>
+#include <medusa/memory_area.hpp>
+#include <medusa/paged_memory.hpp>
+
+#include <x86/x86_const.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+// PagedMemoryContext must behave like a flat memory: chunks which aren't aligned on pages share
+// them, accesses can cross pages and chunks, and snapshots restore every written byte.
+
+enum : u64
+{
+  PageSize = PagedMemoryContext::PageSize,
+  ChunkA   = 0x1000, // [0x1000, 0x2800)
+  ChunkB   = 0x2800, // [0x2800, 0x3800), the page 0x2000 is shared with ChunkA
+  ChunkC   = 0x7fff0000000, // Far from other chunks, so it has its own directories
+  SizeA    = 0x1800,
+  SizeB    = 0x1000,
+  SizeC    = 0x2000,
+};
+
+static void Fill(MemoryContext& rMemCtxt, u64 LinearAddress, u32 Size, u8 Seed)
+{
+  std::vector<u8> Data(Size);
+  for (u32 Idx = 0; Idx < Size; ++Idx)
+    Data[Idx] = static_cast<u8>(Seed + Idx * 13);
+  MEDUSA_CHECK(rMemCtxt.WriteMemory(LinearAddress, Data.data(), Size));
+}
+
+static std::vector<u8> Dump(MemoryContext const& rMemCtxt, u64 LinearAddress, u32 Size)
+{
+  std::vector<u8> Data(Size);
+  MEDUSA_CHECK(rMemCtxt.ReadMemory(LinearAddress, Data.data(), Size));
+  return Data;
+}
+
+static void TestAccesses(CpuInformation const& rCpuInfo)
+{
+  PagedMemoryContext MemCtxt(rCpuInfo);
+  MEDUSA_CHECK(MemCtxt.AllocateMemory(ChunkA, SizeA, nullptr));
+  MEDUSA_CHECK(MemCtxt.AllocateMemory(ChunkB, SizeB, nullptr));
+  MEDUSA_CHECK(MemCtxt.AllocateMemory(ChunkC, SizeC, nullptr));
+  MEDUSA_CHECK(!MemCtxt.AllocateMemory(0x10000, 0, nullptr));
+
+  // Inside a page, across pages of a chunk and across chunks on a shared page
+  u32 Value = 0x11223344, Read = 0;
+  MEDUSA_CHECK(MemCtxt.WriteMemory(ChunkA + 0x10, &Value, sizeof(Value)));
+  MEDUSA_CHECK(MemCtxt.ReadMemory(ChunkA + 0x10, &Read, sizeof(Read)));
+  MEDUSA_CHECK_EQUAL(Read, Value);
+  Fill(MemCtxt, ChunkA + PageSize - 3, 8, 0x20);
+  Fill(MemCtxt, ChunkB - 2, 4, 0x40);
+  Fill(MemCtxt, ChunkC + PageSize - 1, 2, 0x60);
+  auto Data = Dump(MemCtxt, ChunkB - 2, 4);
+  MEDUSA_CHECK_EQUAL(Data[0], 0x40);
+  MEDUSA_CHECK_EQUAL(Data[3], static_cast<u8>(0x40 + 3 * 13));
+  MEDUSA_CHECK_EQUAL(Dump(MemCtxt, ChunkC + PageSize, 1)[0], static_cast<u8>(0x60 + 13));
+
+  // FindMemory returns the memory at the address, up to the end of its chunk
+  void* pHost;
+  u32 HostSize;
+  MEDUSA_CHECK(MemCtxt.FindMemory(ChunkA + 0x10, pHost, HostSize));
+  MEDUSA_CHECK_EQUAL(HostSize, SizeA - 0x10);
+  MEDUSA_CHECK(memcmp(pHost, &Value, sizeof(Value)) == 0);
+  MEDUSA_CHECK(MemCtxt.FindMemory(ChunkB + 1, pHost, HostSize));
+  MEDUSA_CHECK_EQUAL(HostSize, SizeB - 1);
+
+  // Pages which collide in the TLB must not be mixed up
+  u64 CollidingAddr = ChunkC + PagedMemoryContext::TlbSize * PageSize;
+  MEDUSA_CHECK(MemCtxt.AllocateMemory(CollidingAddr, PageSize, nullptr));
+  u32 Value0 = 0xaaaaaaaa, Value1 = 0xbbbbbbbb;
+  for (u32 Idx = 0; Idx < 4; ++Idx)
+  {
+    MEDUSA_CHECK(MemCtxt.WriteMemory(ChunkC, &Value0, sizeof(Value0)));
+    MEDUSA_CHECK(MemCtxt.WriteMemory(CollidingAddr, &Value1, sizeof(Value1)));
+    MEDUSA_CHECK(MemCtxt.ReadMemory(ChunkC, &Read, sizeof(Read)));
+    MEDUSA_CHECK_EQUAL(Read, Value0);
+    MEDUSA_CHECK(MemCtxt.ReadMemory(CollidingAddr, &Read, sizeof(Read)));
+    MEDUSA_CHECK_EQUAL(Read, Value1);
+  }
+
+  // Unmapped memory faults, the last fault is kept
+  u64 FaultAddr = 0;
+  u32 FaultAccess = 0, FaultNo = 0;
+  MemCtxt.SetFaultCallback([&](u64 LinearAddress, u32, u32 Access)
+  {
+    FaultAddr   = LinearAddress;
+    FaultAccess = Access;
+    ++FaultNo;
+  });
+  MEDUSA_CHECK(!MemCtxt.ReadMemory(0x5000, &Read, sizeof(Read)));
+  MEDUSA_CHECK_EQUAL(FaultNo, 1);
+  MEDUSA_CHECK_EQUAL(FaultAddr, 0x5000);
+  MEDUSA_CHECK_EQUAL(FaultAccess, MemoryArea::Read);
+  MEDUSA_CHECK(!MemCtxt.WriteMemory(ChunkB + SizeB - 2, &Value, sizeof(Value)));
+  u64 LastAddr;
+  u32 LastAccess;
+  MEDUSA_CHECK(MemCtxt.GetLastFault(LastAddr, LastAccess));
+  MEDUSA_CHECK_EQUAL(LastAccess, MemoryArea::Write);
+
+  // A write crossing into a read-only page fails without writing the first page
+  MEDUSA_CHECK(MemCtxt.ProtectMemory(ChunkA + PageSize, PageSize, MemoryArea::Read));
+  u32 Access = 0;
+  MEDUSA_CHECK(MemCtxt.GetMemoryAccess(ChunkA + PageSize, Access));
+  MEDUSA_CHECK_EQUAL(Access, MemoryArea::Read);
+  auto Before = Dump(MemCtxt, ChunkA + PageSize - 2, 4);
+  MEDUSA_CHECK(!MemCtxt.WriteMemory(ChunkA + PageSize - 2, &Value, sizeof(Value)));
+  MEDUSA_CHECK(Dump(MemCtxt, ChunkA + PageSize - 2, 4) == Before);
+  MEDUSA_CHECK(MemCtxt.ReadMemory(ChunkA + PageSize, &Read, sizeof(Read)));
+  MEDUSA_CHECK(!MemCtxt.ProtectMemory(0x5000, PageSize, MemoryArea::Read));
+
+  // Freeing a chunk keeps the other chunk of a shared page
+  MEDUSA_CHECK(MemCtxt.FreeMemory(ChunkA));
+  MEDUSA_CHECK(!MemCtxt.ReadMemory(ChunkA, &Read, sizeof(Read)));
+  MEDUSA_CHECK(!MemCtxt.ReadMemory(ChunkB - 4, &Read, sizeof(Read)));
+  MEDUSA_CHECK_EQUAL(Dump(MemCtxt, ChunkB, 1)[0], static_cast<u8>(0x40 + 2 * 13));
+  MEDUSA_CHECK(!MemCtxt.FreeMemory(ChunkA));
+}
+
+static void TestSnapshots(CpuInformation const& rCpuInfo)
+{
+  PagedMemoryContext MemCtxt(rCpuInfo);
+  MEDUSA_CHECK(!MemCtxt.RestoreSnapshot());
+  MEDUSA_CHECK(MemCtxt.AllocateMemory(ChunkA, SizeA, nullptr));
+  MEDUSA_CHECK(MemCtxt.AllocateMemory(ChunkB, SizeB, nullptr));
+  Fill(MemCtxt, ChunkA, SizeA, 0x1);
+  Fill(MemCtxt, ChunkB, SizeB, 0x2);
+  auto InitA = Dump(MemCtxt, ChunkA, SizeA), InitB = Dump(MemCtxt, ChunkB, SizeB);
+
+  u32 CodeWriteNo = 0;
+  MemCtxt.SetCodeWriteCallback([&](u64) { ++CodeWriteNo; });
+
+  MEDUSA_CHECK(MemCtxt.TakeSnapshot());
+  for (u32 RunIdx = 0; RunIdx < 3; ++RunIdx)
+  {
+    // Each run writes other pages, the shared page is written through both chunks
+    MemCtxt.MarkCodePages(ChunkA, 1);
+    switch (RunIdx)
+    {
+    case 0:
+      Fill(MemCtxt, ChunkB - 2, 4, 0x80);
+      Fill(MemCtxt, ChunkA, 4, 0x81);
+      break;
+    case 1:
+      Fill(MemCtxt, ChunkA + PageSize - 8, 0x10, 0x90);
+      Fill(MemCtxt, ChunkB + SizeB - 4, 4, 0x91);
+      break;
+    case 2:
+      Fill(MemCtxt, ChunkA, SizeA, 0xa0);
+      Fill(MemCtxt, ChunkB, SizeB, 0xa1);
+      break;
+    }
+    MEDUSA_CHECK(Dump(MemCtxt, ChunkA, SizeA) != InitA);
+
+    MEDUSA_CHECK(MemCtxt.RestoreSnapshot());
+    MEDUSA_CHECK(Dump(MemCtxt, ChunkA, SizeA) == InitA);
+    MEDUSA_CHECK(Dump(MemCtxt, ChunkB, SizeB) == InitB);
+  }
+  // The code page is written by each run, then its content is restored
+  MEDUSA_CHECK(CodeWriteNo >= 3);
+
+  // A new snapshot keeps the current content
+  Fill(MemCtxt, ChunkB, 4, 0xb0);
+  auto SnapB = Dump(MemCtxt, ChunkB, SizeB);
+  MEDUSA_CHECK(MemCtxt.TakeSnapshot());
+  Fill(MemCtxt, ChunkB, SizeB, 0xb1);
+  MEDUSA_CHECK(MemCtxt.RestoreSnapshot());
+  MEDUSA_CHECK(Dump(MemCtxt, ChunkB, SizeB) == SnapB);
+  MEDUSA_CHECK(Dump(MemCtxt, ChunkA, SizeA) == InitA);
+}
+
+// Mapped memory is copy-on-write: the stream is never modified and snapshots restore it
+static void TestMappedMemory(CpuInformation const& rCpuInfo)
+{
+  static char const* s_pPath = "test_paged_memory.bin";
+  std::vector<u8> File(3 * PageSize);
+  for (size_t Idx = 0; Idx < File.size(); ++Idx)
+    File[Idx] = static_cast<u8>(Idx ^ (Idx >> 8));
+  {
+    std::ofstream FileStrm(s_pPath, std::ios::binary);
+    FileStrm.write(reinterpret_cast<char const*>(File.data()), File.size());
+  }
+
+  {
+    FileBinaryStream FileStrm(L"test_paged_memory.bin");
+    MemoryBinaryStream MemStrm(File.data(), static_cast<u32>(File.size()));
+
+    // The file offset isn't aligned on a page and the mapping is larger than the mapped data
+    PagedMemoryContext MemCtxt(rCpuInfo);
+    MEDUSA_CHECK(MemCtxt.MapMemory(ChunkA, 2 * PageSize, FileStrm, 0x123, PageSize, nullptr));
+    MEDUSA_CHECK(MemCtxt.MapMemory(ChunkA + 2 * PageSize, PageSize, MemStrm, 0x10, PageSize, nullptr));
+    MEDUSA_CHECK(!MemCtxt.MapMemory(0x100000, PageSize, MemStrm, File.size() - 0x10, 0x20, nullptr));
+
+    auto Mapped = Dump(MemCtxt, ChunkA, 3 * PageSize);
+    MEDUSA_CHECK(memcmp(Mapped.data(), File.data() + 0x123, PageSize) == 0);
+    MEDUSA_CHECK(std::count(Mapped.begin() + PageSize, Mapped.begin() + 2 * PageSize, 0) == PageSize);
+    MEDUSA_CHECK(memcmp(Mapped.data() + 2 * PageSize, File.data() + 0x10, PageSize) == 0);
+
+    MEDUSA_CHECK(MemCtxt.TakeSnapshot());
+    Fill(MemCtxt, ChunkA + PageSize - 2, 2 * PageSize, 0xc0);
+    MEDUSA_CHECK(Dump(MemCtxt, ChunkA, 3 * PageSize) != Mapped);
+    MEDUSA_CHECK(memcmp(FileStrm.GetBuffer(), File.data(), File.size()) == 0);
+    MEDUSA_CHECK(memcmp(MemStrm.GetBuffer(), File.data(), File.size()) == 0);
+
+    MEDUSA_CHECK(MemCtxt.RestoreSnapshot());
+    MEDUSA_CHECK(Dump(MemCtxt, ChunkA, 3 * PageSize) == Mapped);
+    MEDUSA_CHECK(MemCtxt.FreeMemory(ChunkA));
+  }
+
+  std::vector<u8> Written(File.size());
+  {
+    std::ifstream FileStrm(s_pPath, std::ios::binary);
+    FileStrm.read(reinterpret_cast<char*>(Written.data()), Written.size());
+  }
+  MEDUSA_CHECK(Written == File);
+  std::remove(s_pPath);
+}
+
+// The cpu context has its own snapshot
+static void TestCpuSnapshot(Architecture& rArch)
+{
+  auto pCpuCtxt = rArch.MakeCpuContext();
+  MEDUSA_CHECK(!pCpuCtxt->RestoreSnapshot());
+
+  u32 Eax = 0x1234, Ebx = 0x5678;
+  pCpuCtxt->WriteRegister(X86_Reg_Eax, &Eax, sizeof(Eax));
+  MEDUSA_CHECK(pCpuCtxt->TakeSnapshot());
+  pCpuCtxt->WriteRegister(X86_Reg_Eax, &Ebx, sizeof(Ebx));
+  pCpuCtxt->WriteRegister(X86_Reg_Ebx, &Ebx, sizeof(Ebx));
+  MEDUSA_CHECK(pCpuCtxt->RestoreSnapshot());
+
+  u32 Read = 0;
+  pCpuCtxt->ReadRegister(X86_Reg_Eax, &Read, sizeof(Read));
+  MEDUSA_CHECK_EQUAL(Read, Eax);
+  pCpuCtxt->ReadRegister(X86_Reg_Ebx, &Read, sizeof(Read));
+  MEDUSA_CHECK_EQUAL(Read, 0);
+  delete pCpuCtxt;
+}
+
+int main(void)
+{
+  static u8 const Dummy[1] = {};
+  MemoryBinaryStream BinStrm(Dummy, sizeof(Dummy));
+  TestLoadModules(BinStrm);
+  auto spArch = TestGetArchitecture("Intel x86");
+  auto const& rCpuInfo = *spArch->GetCpuInformation();
+
+  TestAccesses(rCpuInfo);
+  TestSnapshots(rCpuInfo);
+  TestMappedMemory(rCpuInfo);
+  TestCpuSnapshot(*spArch);
+
+  return MEDUSA_TEST_RESULT();
+}
@@ -0,0 +1,147 @@
+#include "test.hpp"
+
+#include <medusa/context.hpp>
+#include <medusa/execution.hpp>
+
+#include <x86/x86_const.hpp>
+
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+// Sessions of ParallelExecution run on several threads and share the log, every message must
+// be received once and whole.
+
+// double: mov eax, ecx / add eax, ecx / ret
+// falloff: inc ecx, the execution stops at the end of the image before the block is executed
+static u8 const s_Code[] = { 0x89, 0xc8, 0x01, 0xc8, 0xc3, 0x41 };
+
+enum
+{
+  DoubleAddress  = 0x0,
+  FallOffAddress = 0x5,
+  StackAddress   = 0x100000,
+  StackSize      = 0x10000,
+  StopAddress    = 0xdead0000,
+  ThreadNo       = 4,
+  FuncNo         = 64,
+  MessageNo      = 200,
+};
+
+static std::mutex               s_LogMutex;
+static std::vector<std::wstring> s_Messages;
+
+static void CollectLog(std::wstring const& rMsg)
+{
+  std::lock_guard<std::mutex> Lock(s_LogMutex);
+  s_Messages.push_back(rMsg);
+}
+
+static u32 CountMessages(std::wstring const& rPrefix)
+{
+  std::lock_guard<std::mutex> Lock(s_LogMutex);
+  u32 Count = 0;
+  for (auto const& rMsg : s_Messages)
+    if (rMsg.compare(0, rPrefix.size(), rPrefix) == 0)
+      ++Count;
+  return Count;
+}
+
+// Threads write complete messages to the same type and split messages to their own type
+static void TestLog(void)
+{
+  std::vector<std::thread> Threads;
+  for (u32 ThreadIdx = 0; ThreadIdx < ThreadNo; ++ThreadIdx)
+    Threads.push_back(std::thread([ThreadIdx]()
+    {
+      std::ostringstream Type;
+      Type << "thread" << ThreadIdx;
+      for (u32 MsgIdx = 0; MsgIdx < MessageNo; ++MsgIdx)
+      {
+        Log::Write("shared") << "thread " << std::string(1, static_cast<char>('0' + ThreadIdx)) << " message" << LogEnd;
+        Log::Write(Type.str()) << "begin ";
+        Log::Write(Type.str()) << "end" << LogEnd;
+      }
+    }));
+  for (auto& rThread : Threads)
+    rThread.join();
+
+  std::lock_guard<std::mutex> Lock(s_LogMutex);
+  MEDUSA_CHECK_EQUAL(s_Messages.size(), 2 * ThreadNo * MessageNo);
+  std::vector<u32> SharedNo(ThreadNo), SplitNo(ThreadNo);
+  for (auto const& rMsg : s_Messages)
+    for (u32 ThreadIdx = 0; ThreadIdx < ThreadNo; ++ThreadIdx)
+    {
+      std::wostringstream Shared, Split;
+      Shared << L"shared: thread " << ThreadIdx << L" message\n";
+      Split << L"thread" << ThreadIdx << L": begin end\n";
+      if (rMsg == Shared.str())
+        ++SharedNo[ThreadIdx];
+      if (rMsg == Split.str())
+        ++SplitNo[ThreadIdx];
+    }
+  for (u32 ThreadIdx = 0; ThreadIdx < ThreadNo; ++ThreadIdx)
+  {
+    MEDUSA_CHECK_EQUAL(SharedNo[ThreadIdx], MessageNo);
+    MEDUSA_CHECK_EQUAL(SplitNo[ThreadIdx], MessageNo);
+  }
+  s_Messages.clear();
+}
+
+// Functions which reach the return address and functions which fall off the image are mixed,
+// the latter log the end of their execution
+static void TestSessions(TestDocument& rDoc)
+{
+  auto& rCore = rDoc.GetCore();
+  ParallelExecution ParExec(&rCore, rDoc.GetArchitecture(), rDoc.GetOperatingSystem(), ThreadNo);
+  MEDUSA_CHECK_EQUAL(ParExec.GetThreadNo(), ThreadNo);
+  MEDUSA_CHECK(ParExec.Initialize(StackAddress, StackSize, "interpreter"));
+
+  std::vector<Address> FuncAddrs;
+  for (u32 FuncIdx = 0; FuncIdx < FuncNo; ++FuncIdx)
+    FuncAddrs.push_back(rCore.GetDocument().MakeAddress(0x0, FuncIdx % 2 ? FallOffAddress : DoubleAddress));
+  Address StopAddr(0x0, StopAddress); // outside the document, MakeAddress would return an empty address
+
+  std::vector<u32> Results(FuncNo, 0xffffffff);
+  std::vector<u8>  Reached(FuncNo, 0);
+  u32 ExecutedNo = ParExec.Execute(FuncAddrs, StopAddr,
+    [](u32 FuncIdx, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt)
+  {
+    // ecx = FuncIdx, push StopAddress
+    u32 Ecx = FuncIdx, Esp = 0, RetAddr = StopAddress;
+    pCpuCtxt->WriteRegister(X86_Reg_Ecx, &Ecx, sizeof(Ecx));
+    pCpuCtxt->ReadRegister(X86_Reg_Esp, &Esp, sizeof(Esp));
+    Esp -= sizeof(RetAddr);
+    pCpuCtxt->WriteRegister(X86_Reg_Esp, &Esp, sizeof(Esp));
+    return pMemCtxt->WriteMemory(Esp, &RetAddr, sizeof(RetAddr));
+  },
+    [&](u32 FuncIdx, bool FuncReached, CpuContext* pCpuCtxt, MemoryContext*)
+  {
+    // Each function has its own index, there's no need to lock
+    pCpuCtxt->ReadRegister(FuncIdx % 2 ? X86_Reg_Ecx : X86_Reg_Eax, &Results[FuncIdx], sizeof(u32));
+    Reached[FuncIdx] = FuncReached ? 1 : 0;
+  });
+  MEDUSA_CHECK_EQUAL(ExecutedNo, FuncNo);
+
+  for (u32 FuncIdx = 0; FuncIdx < FuncNo; ++FuncIdx)
+  {
+    bool FallOff = FuncIdx % 2 != 0;
+    MEDUSA_CHECK_EQUAL(Reached[FuncIdx], (FallOff ? 0 : 1));
+    MEDUSA_CHECK_EQUAL(Results[FuncIdx], (FallOff ? FuncIdx : FuncIdx * 2));
+  }
+  MEDUSA_CHECK_EQUAL(CountMessages(L"exec: execution finished\n"), FuncNo / 2);
+}
+
+int main(void)
+{
+  static u64 const s_Entries[] = { DoubleAddress, FallOffAddress };
+  TestDocument Doc("Intel x86", s_Code, sizeof(s_Code), s_Entries, 2);
+  Log::SetLog(CollectLog);
+
+  TestLog();
+  TestSessions(Doc);
+
+  Log::SetLog(TestQuietLog);
+  return MEDUSA_TEST_RESULT();
+}
@@ -0,0 +1,70 @@
+#include "test.hpp"
+
+#include <medusa/printer.hpp>
+
+#include <sstream>
+
+// The printer formats cells into a reused buffer and decodes instructions into a reused
+// instruction, it must print the same text as the string formatter of the document cells.
+
+// mov ecx, 100000 / xor eax, eax / add eax, ecx / mov al, [esi] / lea eax, [eax + ecx * 4 + 0x10] /
+// call $+5 / ret / data
+static u8 const s_X86Code[] =
+{
+  0xb9, 0xa0, 0x86, 0x01, 0x00, 0x31, 0xc0, 0x01, 0xc8, 0x8a, 0x06, 0x8d, 0x44, 0x88, 0x10, 0xe8,
+  0x00, 0x00, 0x00, 0x00, 0xc3, 0x12, 0x34,
+};
+
+static u64 const s_Entries[] = { 0x0 };
+
+class CellPrinter : public StreamPrinter
+{
+public:
+  CellPrinter(Medusa const& rCore, std::ostream& rStream) : StreamPrinter(rCore, rStream) {}
+
+  using StreamPrinter::PrintCell;
+};
+
+int main(void)
+{
+  TestDocument Doc("Intel x86", s_X86Code, sizeof(s_X86Code), s_Entries, 1);
+  auto& rCore = Doc.GetCore();
+
+  // The same printer is used for all cells
+  std::ostringstream Printed;
+  CellPrinter Print(rCore, Printed);
+
+  u32 InsnNo = 0, CellNo = 0;
+  u64 CurAddr = 0;
+  while (CurAddr < sizeof(s_X86Code))
+  {
+    Address Addr(CurAddr);
+    auto spCell = rCore.GetCell(Addr);
+    MEDUSA_CHECK(spCell != nullptr);
+    if (spCell == nullptr)
+      break;
+
+    std::string Expected;
+    Cell::Mark::List Marks;
+    MEDUSA_CHECK(rCore.FormatCell(Addr, *spCell, Expected, Marks));
+
+    Printed.str("");
+    Print.PrintCell(Addr, 0, 0);
+    MEDUSA_CHECK(Printed.str() == Expected + "\n");
+    if (Printed.str() != Expected + "\n")
+      std::cerr << "at " << Addr.ToString() << ": \"" << Printed.str() << "\" instead of \"" << Expected << "\"" << std::endl;
+
+    // Labels can be longer than the cell
+    MEDUSA_CHECK(Print.GetLineWidth(Addr, 0) >= Expected.length());
+
+    if (spCell->GetType() == Cell::InstructionType)
+      ++InsnNo;
+    ++CellNo;
+    CurAddr += spCell->GetLength();
+  }
+
+  MEDUSA_CHECK_EQUAL(InsnNo, 7);
+  MEDUSA_CHECK_EQUAL(CellNo, 9);
+
+  return MEDUSA_TEST_RESULT();
+}
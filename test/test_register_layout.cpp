@@ -0,0 +1,141 @@
+#include "test.hpp"
+
+#include <medusa/context.hpp>
+
+#include <x86/x86_const.hpp>
+
+// RegisterLayout accesses the context buffer directly, it must leave the same context than
+// CpuContext::ReadRegister and CpuContext::WriteRegister for every register.
+
+static void Fill(CpuContext& rCpuCtxt, u8 Seed)
+{
+  auto pCtxt = static_cast<u8*>(rCpuCtxt.GetContextAddress());
+  for (u32 Idx = 0; Idx < rCpuCtxt.GetContextSize(); ++Idx)
+    pCtxt[Idx] = static_cast<u8>(Seed + Idx * 29);
+}
+
+static bool SameContext(CpuContext& rLhsCtxt, CpuContext& rRhsCtxt)
+{
+  return memcmp(rLhsCtxt.GetContextAddress(), rRhsCtxt.GetContextAddress(), rLhsCtxt.GetContextSize()) == 0;
+}
+
+static void TestRegisters(Architecture& rArch)
+{
+  auto pCpuInfo = rArch.GetCpuInformation();
+  auto pLayoutCtxt = rArch.MakeCpuContext();
+  auto pRefCtxt    = rArch.MakeCpuContext();
+  MEDUSA_CHECK(pLayoutCtxt->GetContextSize() != 0);
+  RegisterLayout Layout(pLayoutCtxt);
+
+  // Flags are computed when they're read, other registers are stored in the buffer
+  u16 Offset;
+  u8 ReadSize, WriteSize;
+  MEDUSA_CHECK(!Layout.GetStorage(X86_Reg_Eflags, Offset, ReadSize, WriteSize));
+  MEDUSA_CHECK(Layout.GetStorage(X86_Reg_Ah, Offset, ReadSize, WriteSize));
+  MEDUSA_CHECK_EQUAL(ReadSize, 1);
+  MEDUSA_CHECK(Layout.GetStorage(X86_Reg_Eax, Offset, ReadSize, WriteSize));
+  MEDUSA_CHECK_EQUAL(ReadSize, 4);
+  MEDUSA_CHECK_EQUAL(WriteSize, 8);
+
+  u32 TestedNo = 0;
+  for (u32 Reg = X86_Reg_Unknown + 1; Reg <= X86_Reg_LazyRes; ++Reg)
+  {
+    u32 RegBit = pCpuInfo->GetSizeOfRegisterInBit(Reg);
+    if (RegBit < 8 || RegBit > 64)
+      continue;
+    u32 RegSize = RegBit / 8;
+
+    u64 RefVal = 0;
+    if (!pRefCtxt->ReadRegister(Reg, &RefVal, RegSize))
+      continue;
+    ++TestedNo;
+
+    // Read
+    Fill(*pLayoutCtxt, static_cast<u8>(Reg));
+    Fill(*pRefCtxt, static_cast<u8>(Reg));
+    u64 LayoutVal = 0;
+    RefVal = 0;
+    MEDUSA_CHECK(Layout.Read(Reg, LayoutVal));
+    MEDUSA_CHECK(pRefCtxt->ReadRegister(Reg, &RefVal, RegSize));
+    MEDUSA_CHECK_EQUAL(LayoutVal, RefVal);
+
+    // Write, the value is larger than the register to check it's truncated
+    u64 Value = 0xfedcba9876543210ULL ^ (static_cast<u64>(Reg) << 8);
+    MEDUSA_CHECK(Layout.Write(Reg, Value));
+    MEDUSA_CHECK(pRefCtxt->WriteRegister(Reg, &Value, RegSize));
+    bool Same = SameContext(*pLayoutCtxt, *pRefCtxt);
+    if (!Same)
+      std::cerr << "register " << pCpuInfo->ConvertIdentifierToName(Reg) << " is written differently" << std::endl;
+    MEDUSA_CHECK(Same);
+
+    MEDUSA_CHECK(Layout.Read(Reg, LayoutVal));
+    MEDUSA_CHECK(pRefCtxt->ReadRegister(Reg, &RefVal, RegSize));
+    MEDUSA_CHECK_EQUAL(LayoutVal, RefVal);
+  }
+  MEDUSA_CHECK(TestedNo > 50);
+
+  // 32-bit registers clear the upper half of their 64-bit register, 8 and 16-bit ones don't
+  u64 Rax = 0;
+  MEDUSA_CHECK(Layout.Write(X86_Reg_Rax, 0x1122334455667788ULL));
+  MEDUSA_CHECK(Layout.Write(X86_Reg_Ah, 0xaa));
+  MEDUSA_CHECK(Layout.Read(X86_Reg_Rax, Rax));
+  MEDUSA_CHECK_EQUAL(Rax, 0x112233445566aa88ULL);
+  MEDUSA_CHECK(Layout.Write(X86_Reg_Ax, 0xbbcc));
+  MEDUSA_CHECK(Layout.Read(X86_Reg_Rax, Rax));
+  MEDUSA_CHECK_EQUAL(Rax, 0x112233445566bbccULL);
+  MEDUSA_CHECK(Layout.Write(X86_Reg_Eax, 0xddeeff00));
+  MEDUSA_CHECK(Layout.Read(X86_Reg_Rax, Rax));
+  MEDUSA_CHECK_EQUAL(Rax, 0xddeeff00ULL);
+
+  // Flags go through the context, a flags write drops the pending lazy flags
+  MEDUSA_CHECK(Layout.Write(X86_Reg_LazyOp, 0xffffffff));
+  MEDUSA_CHECK(Layout.Write(X86_Reg_Eflags, 1 << X86_CfBit));
+  u64 Flags = 0, LazyOp = 0;
+  MEDUSA_CHECK(Layout.Read(X86_Reg_Eflags, Flags));
+  MEDUSA_CHECK(Layout.Read(X86_Reg_LazyOp, LazyOp));
+  MEDUSA_CHECK_EQUAL(Flags, 1 << X86_CfBit);
+  MEDUSA_CHECK_EQUAL(LazyOp, X86_LazyOp_None);
+
+  delete pRefCtxt;
+  delete pLayoutCtxt;
+}
+
+// MakeCpuContext returns a base pointer, deleting it must destroy the architecture context
+class DestroyedContext : public CpuContext
+{
+public:
+  DestroyedContext(CpuInformation const& rCpuInfo, bool& rDestroyed) : CpuContext(rCpuInfo), m_rDestroyed(rDestroyed) {}
+  ~DestroyedContext(void) { m_rDestroyed = true; }
+
+  virtual bool        ReadRegister (u32, void*, u32) const             { return false;   }
+  virtual bool        WriteRegister(u32, void const*, u32, bool)       { return false;   }
+  virtual void*       GetRegisterAddress(u32)                          { return nullptr; }
+  virtual void*       GetContextAddress(void)                          { return nullptr; }
+  virtual u16         GetRegisterOffset(u32)                           { return 0;       }
+  virtual void        GetRegisters(RegisterList&) const                {                 }
+  virtual std::string ToString(void) const                             { return "";      }
+
+private:
+  bool& m_rDestroyed;
+};
+
+static void TestDestruction(Architecture& rArch)
+{
+  bool Destroyed = false;
+  CpuContext* pCpuCtxt = new DestroyedContext(*rArch.GetCpuInformation(), Destroyed);
+  delete pCpuCtxt;
+  MEDUSA_CHECK(Destroyed);
+}
+
+int main(void)
+{
+  static u8 const Dummy[1] = {};
+  MemoryBinaryStream BinStrm(Dummy, sizeof(Dummy));
+  TestLoadModules(BinStrm);
+  auto spArch = TestGetArchitecture("Intel x86");
+
+  TestRegisters(*spArch);
+  TestDestruction(*spArch);
+
+  return MEDUSA_TEST_RESULT();
+}
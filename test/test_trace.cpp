@@ -0,0 +1,227 @@
+#include "test.hpp"
+
+#include <medusa/context.hpp>
+#include <medusa/execution.hpp>
+#include <medusa/trace.hpp>
+
+#include <x86/x86_const.hpp>
+
+#include <sstream>
+#include <vector>
+
+// A trace recorded by TraceRecorder must be replayed by TraceReader with the same blocks,
+// registers and memory writes.
+
+// mov ecx, 3 / loop: mov [0x100100 + ecx * 4], ecx / dec ecx / jnz loop / ret, the stores are in the stack
+static u8 const s_Code[] =
+{
+  0xb9, 0x03, 0x00, 0x00, 0x00, 0x89, 0x0c, 0x8d, 0x00, 0x01, 0x10, 0x00, 0x49, 0x75, 0xf6, 0xc3,
+};
+
+enum
+{
+  StackAddress = 0x100000,
+  StackSize    = 0x10000,
+  LoopAddress  = 0x5,
+  StopAddress  = 0xf, // ret
+};
+
+struct RecordedBlock
+{
+  u64             m_Address;
+  std::vector<u8> m_Registers;
+};
+
+static std::vector<u8> GetContext(CpuContext& rCpuCtxt)
+{
+  auto pCtxt = static_cast<u8 const*>(rCpuCtxt.GetContextAddress());
+  return std::vector<u8>(pCtxt, pCtxt + rCpuCtxt.GetContextSize());
+}
+
+// The recorder is driven directly, the blocks and writes are known
+static void TestRoundTrip(Architecture& rArch, bool UseStream)
+{
+  auto pCpuCtxt = rArch.MakeCpuContext();
+  std::ostringstream Strm;
+  TraceRecorder Recorder(UseStream ? &Strm : nullptr);
+  MEDUSA_CHECK(Recorder.Start(pCpuCtxt));
+  MEDUSA_CHECK(Recorder.IsRecording());
+
+  std::vector<RecordedBlock> Blocks;
+  auto Record = [&](u64 BlkAddr)
+  {
+    RecordedBlock Blk = { BlkAddr, GetContext(*pCpuCtxt) };
+    Blocks.push_back(Blk);
+    Recorder.RecordBlock(BlkAddr);
+  };
+
+  u32 Eax = 0x1234, Ecx = 0xffffffff;
+  u8 Data[0x20];
+  for (u32 Idx = 0; Idx < sizeof(Data); ++Idx)
+    Data[Idx] = static_cast<u8>(Idx * 3);
+
+  Record(0x401000);
+  pCpuCtxt->WriteRegister(X86_Reg_Eax, &Eax, sizeof(Eax));
+  Recorder.RecordMemoryWrite(0x2000, Data, 4);
+  Recorder.RecordMemoryWrite(0x2004, Data + 4, 4);
+  Record(0x400ff0); // backward
+  pCpuCtxt->WriteRegister(X86_Reg_Ecx, &Ecx, sizeof(Ecx));
+  Recorder.RecordMemoryWrite(0x2ff8, Data, sizeof(Data)); // crosses a page
+  Record(0x401000);
+  Record(0x401000); // no register modified
+  Recorder.RecordRestore();
+  Eax = 0;
+  pCpuCtxt->WriteRegister(X86_Reg_Eax, &Eax, sizeof(Eax));
+  Record(0x7fff00000000ULL);
+  Recorder.RecordMemoryWrite(0x1000, Data, 1);
+  MEDUSA_CHECK_EQUAL(Recorder.GetBlockNo(), Blocks.size());
+  Recorder.Stop();
+  MEDUSA_CHECK(!Recorder.IsRecording());
+
+  TraceReader Reader;
+  if (UseStream)
+  {
+    MEDUSA_CHECK(Recorder.GetBuffer().empty());
+    std::istringstream InStrm(Strm.str());
+    MEDUSA_CHECK(Reader.Open(InStrm));
+  }
+  else
+    MEDUSA_CHECK(Reader.Open(Recorder.GetBuffer()));
+  MEDUSA_CHECK_EQUAL(Reader.GetContextSize(), pCpuCtxt->GetContextSize());
+
+  // Replay returns the events in order with the registers at the beginning of each block
+  std::vector<TraceReader::Event> Events;
+  std::vector<std::vector<u8>> Registers;
+  MEDUSA_CHECK(Reader.Replay([&](TraceReader::Event const& rEvent, std::vector<u8> const& rRegisters)
+  {
+    Events.push_back(rEvent);
+    Registers.push_back(rRegisters);
+    return true;
+  }));
+
+  static struct { u8 m_Type; u64 m_BlockIndex; u64 m_Address; u32 m_Size; } const s_Expected[] =
+  {
+    { TraceRecorder::BlockRecord,   0, 0x401000,      0                  },
+    { TraceRecorder::MemoryRecord,  0, 0x2000,        4                  },
+    { TraceRecorder::MemoryRecord,  0, 0x2004,        4                  },
+    { TraceRecorder::BlockRecord,   1, 0x400ff0,      0                  },
+    { TraceRecorder::MemoryRecord,  1, 0x2ff8,        sizeof(Data)       },
+    { TraceRecorder::BlockRecord,   2, 0x401000,      0                  },
+    { TraceRecorder::BlockRecord,   3, 0x401000,      0                  },
+    { TraceRecorder::RestoreRecord, 4, 0x0,           0                  },
+    { TraceRecorder::BlockRecord,   4, 0x7fff00000000ULL, 0              },
+    { TraceRecorder::MemoryRecord,  4, 0x1000,        1                  },
+  };
+  MEDUSA_CHECK_EQUAL(Events.size(), sizeof(s_Expected) / sizeof(*s_Expected));
+  for (u32 Idx = 0; Idx < Events.size() && Idx < sizeof(s_Expected) / sizeof(*s_Expected); ++Idx)
+  {
+    MEDUSA_CHECK_EQUAL(Events[Idx].m_Type, s_Expected[Idx].m_Type);
+    MEDUSA_CHECK_EQUAL(Events[Idx].m_BlockIndex, s_Expected[Idx].m_BlockIndex);
+    MEDUSA_CHECK_EQUAL(Events[Idx].m_Address, s_Expected[Idx].m_Address);
+    MEDUSA_CHECK_EQUAL(Events[Idx].m_Size, s_Expected[Idx].m_Size);
+    if (Events[Idx].m_Type == TraceRecorder::MemoryRecord)
+      MEDUSA_CHECK(memcmp(Events[Idx].m_pData, Data + (Events[Idx].m_Address == 0x2004 ? 4 : 0), Events[Idx].m_Size) == 0);
+    if (Events[Idx].m_Type == TraceRecorder::BlockRecord)
+      MEDUSA_CHECK(Registers[Idx] == Blocks[static_cast<size_t>(Events[Idx].m_BlockIndex)].m_Registers);
+  }
+
+  // GetRegisters seeks the same registers
+  std::vector<u8> BlkRegs;
+  for (u64 BlkIdx = 0; BlkIdx < Blocks.size(); ++BlkIdx)
+  {
+    MEDUSA_CHECK(Reader.GetRegisters(BlkIdx, BlkRegs));
+    MEDUSA_CHECK(BlkRegs == Blocks[static_cast<size_t>(BlkIdx)].m_Registers);
+  }
+  MEDUSA_CHECK(!Reader.GetRegisters(Blocks.size(), BlkRegs));
+
+  // FindWrites returns each writing block once, even if its write crosses pages
+  std::vector<u64> BlkIdxs;
+  MEDUSA_CHECK(Reader.FindWrites(0x2000, 0x1000, BlkIdxs));
+  MEDUSA_CHECK(BlkIdxs == std::vector<u64>({ 0, 1 }));
+  MEDUSA_CHECK(Reader.FindWrites(0x3000, 0x10, BlkIdxs));
+  MEDUSA_CHECK(BlkIdxs == std::vector<u64>({ 1 }));
+  MEDUSA_CHECK(Reader.FindWrites(0x2004, 1, BlkIdxs));
+  MEDUSA_CHECK(BlkIdxs == std::vector<u64>({ 0 }));
+  MEDUSA_CHECK(Reader.FindWrites(0x2008, 0x10, BlkIdxs));
+  MEDUSA_CHECK(BlkIdxs.empty());
+  MEDUSA_CHECK(Reader.FindWrites(0x1000, 1, BlkIdxs));
+  MEDUSA_CHECK(BlkIdxs == std::vector<u64>({ 4 }));
+  MEDUSA_CHECK(!Reader.FindWrites(0x1000, 0, BlkIdxs));
+
+  // Truncated and invalid traces
+  std::string StrmTrace = Strm.str();
+  auto Trace = UseStream ? std::vector<u8>(StrmTrace.begin(), StrmTrace.end()) : Recorder.GetBuffer();
+  Trace.resize(Trace.size() - 3);
+  MEDUSA_CHECK(Reader.Open(Trace));
+  MEDUSA_CHECK(!Reader.Replay([](TraceReader::Event const&, std::vector<u8> const&) { return true; }));
+  Trace[0] ^= 0xff;
+  MEDUSA_CHECK(!Reader.Open(Trace));
+
+  delete pCpuCtxt;
+}
+
+// Each run of ExecuteFromSnapshot is recorded, followed by the restoration of the snapshot
+static void TestExecution(TestDocument& rDoc)
+{
+  auto& rCore = rDoc.GetCore();
+  Execution Exec(&rCore, rDoc.GetArchitecture(), rDoc.GetOperatingSystem());
+  MEDUSA_CHECK(Exec.Initialize(StackAddress, StackSize));
+  MEDUSA_CHECK(Exec.SetEmulator("interpreter"));
+
+  TraceRecorder Recorder;
+  MEDUSA_CHECK(Exec.SetTraceRecorder(&Recorder));
+
+  Address StartAddr = rCore.GetDocument().MakeAddress(0x0, 0x0);
+  Address StopAddr  = rCore.GetDocument().MakeAddress(0x0, StopAddress);
+  MEDUSA_CHECK_EQUAL(Exec.ExecuteFromSnapshot(StartAddr, StopAddr, 2, nullptr, nullptr), 2);
+  MEDUSA_CHECK(Exec.SetTraceRecorder(nullptr));
+
+  TraceReader Reader;
+  MEDUSA_CHECK(Reader.Open(Recorder.GetBuffer()));
+  u32 RestoreNo = 0, LoopNo = 0;
+  std::vector<u64> WriteAddrs;
+  MEDUSA_CHECK(Reader.Replay([&](TraceReader::Event const& rEvent, std::vector<u8> const&)
+  {
+    switch (rEvent.m_Type)
+    {
+    case TraceRecorder::RestoreRecord: ++RestoreNo;                           break;
+    case TraceRecorder::BlockRecord:   LoopNo += rEvent.m_Address == LoopAddress; break;
+    case TraceRecorder::MemoryRecord:  WriteAddrs.push_back(rEvent.m_Address);  break;
+    }
+    return true;
+  }));
+
+  // The first store ends the block of mov ecx, 3, the other ones start a block in each run
+  MEDUSA_CHECK_EQUAL(RestoreNo, 2);
+  MEDUSA_CHECK_EQUAL(LoopNo, 2 * 2);
+  MEDUSA_CHECK(WriteAddrs == std::vector<u64>({ 0x10010c, 0x100108, 0x100104, 0x10010c, 0x100108, 0x100104 }));
+
+  // The registers before the store of the second iteration have ecx = 2
+  std::vector<u64> BlkIdxs;
+  std::vector<u8> BlkRegs;
+  MEDUSA_CHECK(Reader.FindWrites(0x100108, 4, BlkIdxs));
+  MEDUSA_CHECK_EQUAL(BlkIdxs.size(), 2);
+  if (!BlkIdxs.empty() && Reader.GetRegisters(BlkIdxs[0], BlkRegs))
+  {
+    auto pCpuCtxt = rDoc.GetArchitecture()->MakeCpuContext();
+    memcpy(pCpuCtxt->GetContextAddress(), BlkRegs.data(), BlkRegs.size());
+    u32 Ecx = 0;
+    pCpuCtxt->ReadRegister(X86_Reg_Ecx, &Ecx, sizeof(Ecx));
+    MEDUSA_CHECK_EQUAL(Ecx, 2);
+    delete pCpuCtxt;
+  }
+  else
+    MEDUSA_CHECK(false);
+}
+
+int main(void)
+{
+  static u64 const s_Entries[] = { 0x0 };
+  TestDocument Doc("Intel x86", s_Code, sizeof(s_Code), s_Entries, 1);
+
+  TestRoundTrip(*Doc.GetArchitecture(), false);
+  TestRoundTrip(*Doc.GetArchitecture(), true);
+  TestExecution(Doc);
+
+  return MEDUSA_TEST_RESULT();
+}
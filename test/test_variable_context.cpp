@@ -0,0 +1,70 @@
+#include "test.hpp"
+
+#include <medusa/context.hpp>
+
+// VariableContext resolves each name to a slot once, accesses by name and by slot must see
+// the same variables.
+
+static void TestSlots(void)
+{
+  VariableContext VarCtxt;
+
+  // Slots are created on demand and stay the same for a name
+  MEDUSA_CHECK_EQUAL(VarCtxt.FindSlot("res"), VariableContext::InvalidSlot);
+  u32 ResSlot = VarCtxt.GetSlot("res");
+  u32 TmpSlot = VarCtxt.GetSlot("tmp");
+  MEDUSA_CHECK(ResSlot != VariableContext::InvalidSlot);
+  MEDUSA_CHECK(ResSlot != TmpSlot);
+  MEDUSA_CHECK_EQUAL(VarCtxt.GetSlot("res"), ResSlot);
+  MEDUSA_CHECK_EQUAL(VarCtxt.FindSlot("res"), ResSlot);
+  MEDUSA_CHECK(VarCtxt.GetSlotName(TmpSlot) == "tmp");
+
+  // A slot isn't a variable until it's allocated
+  u64 Value = 0xdead;
+  MEDUSA_CHECK(!VarCtxt.ReadVariable(ResSlot, Value));
+  MEDUSA_CHECK(!VarCtxt.WriteVariable(ResSlot, 1));
+  MEDUSA_CHECK(!VarCtxt.ReadVariable("res", Value));
+  MEDUSA_CHECK(!VarCtxt.ReadVariable("unknown", Value));
+  MEDUSA_CHECK(!VarCtxt.WriteVariable("unknown", 1));
+  MEDUSA_CHECK(!VarCtxt.AllocateVariable(VariableContext::Var32Bit, 1000));
+  MEDUSA_CHECK_EQUAL(VarCtxt.FindSlot("unknown"), VariableContext::InvalidSlot);
+
+  // Names and slots access the same value, writes are truncated to the type
+  MEDUSA_CHECK(VarCtxt.AllocateVariable(VariableContext::Var8Bit, "res"));
+  MEDUSA_CHECK(VarCtxt.WriteVariable(ResSlot, 0x1234));
+  MEDUSA_CHECK(VarCtxt.ReadVariable("res", Value));
+  MEDUSA_CHECK_EQUAL(Value, 0x34);
+  MEDUSA_CHECK(VarCtxt.WriteVariable("res", 0x1ff));
+  MEDUSA_CHECK(VarCtxt.ReadVariable(ResSlot, Value));
+  MEDUSA_CHECK_EQUAL(Value, 0xff);
+
+  MEDUSA_CHECK(VarCtxt.AllocateVariable(VariableContext::Var1Bit, TmpSlot));
+  MEDUSA_CHECK(VarCtxt.WriteVariable(TmpSlot, 2));
+  MEDUSA_CHECK(VarCtxt.ReadVariable(TmpSlot, Value));
+  MEDUSA_CHECK_EQUAL(Value, 0);
+
+  // Allocating again resets the value and may change the type
+  MEDUSA_CHECK(VarCtxt.AllocateVariable(VariableContext::Var64Bit, ResSlot));
+  MEDUSA_CHECK(VarCtxt.ReadVariable(ResSlot, Value));
+  MEDUSA_CHECK_EQUAL(Value, 0);
+  MEDUSA_CHECK(VarCtxt.WriteVariable(ResSlot, 0x0123456789abcdefULL));
+  MEDUSA_CHECK(VarCtxt.ReadVariable("res", Value));
+  MEDUSA_CHECK_EQUAL(Value, 0x0123456789abcdefULL);
+  MEDUSA_CHECK(VarCtxt.ToString().find("res") != std::string::npos);
+
+  // Freeing a variable keeps its slot
+  MEDUSA_CHECK(VarCtxt.FreeVariable("res"));
+  MEDUSA_CHECK(!VarCtxt.FreeVariable("res"));
+  MEDUSA_CHECK(!VarCtxt.FreeVariable("unknown"));
+  MEDUSA_CHECK(!VarCtxt.ReadVariable(ResSlot, Value));
+  MEDUSA_CHECK(VarCtxt.ToString().find("res") == std::string::npos);
+  MEDUSA_CHECK_EQUAL(VarCtxt.FindSlot("res"), ResSlot);
+  MEDUSA_CHECK(VarCtxt.AllocateVariable(VariableContext::Var16Bit, "res"));
+  MEDUSA_CHECK_EQUAL(VarCtxt.GetSlot("res"), ResSlot);
+}
+
+int main(void)
+{
+  TestSlots();
+  return MEDUSA_TEST_RESULT();
+}